@@ -0,0 +1,133 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "cppconst.h"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Memory used by AST nodes of one CppObjType.
+ */
+struct CppAstMemoryUsage
+{
+  size_t numNodes {0};
+  size_t shallowBytes {0};   ///< Size of the node objects themselves.
+  size_t stringBytes {0};    ///< Heap memory of strings owned by the nodes.
+  size_t containerBytes {0}; ///< Heap memory of lists and of out of line parts of the nodes.
+
+  size_t totalBytes() const
+  {
+    return shallowBytes + stringBytes + containerBytes;
+  }
+
+  CppAstMemoryUsage& operator+=(const CppAstMemoryUsage& rhs)
+  {
+    numNodes += rhs.numNodes;
+    shallowBytes += rhs.shallowBytes;
+    stringBytes += rhs.stringBytes;
+    containerBytes += rhs.containerBytes;
+    return *this;
+  }
+};
+
+/**
+ * Memory used by an AST, broken down by CppObjType.
+ *
+ * Memory of a list or of an out of line part is accounted to the node that owns it,
+ * e.g. catch blocks are accounted to kTryBlock and the retained source buffer to kCompound.
+ * Interned identifiers and shared var types live as long as the process and are not part of any AST,
+ * so they are not accounted. Nor is memory that allocators use beyond the requested size.
+ */
+class CppAstMemoryReport
+{
+public:
+  static constexpr size_t kNumObjTypes = static_cast<size_t>(CppObjType::kCppControlStatementEnds);
+
+  const CppAstMemoryUsage& usage(CppObjType objType) const
+  {
+    return usages_[static_cast<size_t>(objType)];
+  }
+  CppAstMemoryUsage& usage(CppObjType objType)
+  {
+    return usages_[static_cast<size_t>(objType)];
+  }
+
+  CppAstMemoryUsage total() const
+  {
+    CppAstMemoryUsage ret;
+    for (const auto& usage : usages_)
+      ret += usage;
+    return ret;
+  }
+
+  CppAstMemoryReport& operator+=(const CppAstMemoryReport& rhs)
+  {
+    for (size_t i = 0; i < kNumObjTypes; ++i)
+      usages_[i] += rhs.usages_[i];
+    return *this;
+  }
+
+private:
+  std::array<CppAstMemoryUsage, kNumObjTypes> usages_;
+};
+
+/**
+ * Memory used by AST of a file relative to the size of the file.
+ */
+struct CppFileMemoryReport
+{
+  std::string        file;
+  size_t             sourceBytes {0};
+  CppAstMemoryReport ast;
+
+  /**
+   * @return Bytes of AST per byte of source, 0 if size of source is not known.
+   */
+  double astToSourceRatio() const
+  {
+    return sourceBytes ? static_cast<double>(ast.total().totalBytes()) / sourceBytes : 0;
+  }
+};
+
+struct CppProgramMemoryReport
+{
+  std::vector<CppFileMemoryReport> files;
+
+  CppAstMemoryReport total() const
+  {
+    CppAstMemoryReport ret;
+    for (const auto& file : files)
+      ret += file.ast;
+    return ret;
+  }
+};
+
+/**
+ * @return Name of \a objType without the k prefix, e.g. "Compound" for CppObjType::kCompound.
+ */
+const char* cppObjTypeName(CppObjType objType);
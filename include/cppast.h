@@ -33,28 +33,63 @@
  * the mutation of object needs to be controlled through use of mutating method.
  */
 
+#include "cppast-memory.h"
 #include "cppconst.h"
 #include "cppeasyptr.h"
+#include "cppidentifier.h"
+#include "cppsource-buffer.h"
+#include "cppsourcetext.h"
 #include "typemodifier.h"
 
 #include "string-utils.h"
 
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
-#include <list>
+#include <cstring>
 #include <memory>
+#include <new>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 //////////////////////////////////////////////////////////////////////////
 
 struct CppCompound;
+class CppObjFactory;
+
+/**
+ * @return An empty string that accessors of optional parts of nodes return when the part is absent.
+ */
+inline const std::string& cppEmptyString()
+{
+  static const std::string empty;
+  return empty;
+}
+
+/**
+ * Base of all AST nodes, it only decides where memory of a node comes from.
+ * Nodes created using CppObjFactory::Create() live in the memory that factory uses, e.g. slabs of an arena.
+ * Every node still has sole owner and is deleted like any other object, wherever its memory came from.
+ */
+struct CppAstNode
+{
+  static void* operator new(std::size_t size);
+  static void* operator new(std::size_t size, const CppObjFactory& objFactory);
+  static void  operator delete(void* ptr, std::size_t size);
+  static void  operator delete(void* ptr, const CppObjFactory& objFactory);
+
+  /**
+   * @return Total size of the nodes deleted so far by the calling thread.
+   */
+  static std::size_t numBytesDeletedByThisThread();
+};
 
 /**
  * An abstract class that is used as base class of all other classes.
  */
-struct CppObj
+struct CppObj : public CppAstNode
 {
   const CppObjType    objType_;
   const CppAccessType accessType_; ///< All objects do not need this.
@@ -79,6 +114,8 @@ struct CppObj
   virtual ~CppObj() {}
 
 private:
+  friend struct CppCompound; // To detach a member that is moved out of its owner.
+
   CppCompound* owner_;
 };
 
@@ -88,12 +125,13 @@ private:
 struct CppBlob : public CppObj
 {
   static constexpr CppObjType kObjectType = CppObjType::kBlob;
-  std::string                 blob_;
+  CppSourceText               blob_;
 
-  CppBlob(std::string blob)
+  CppBlob(CppSourceText blob)
     : CppObj(CppObjType::kBlob, CppAccessType::kUnknown)
-    , blob_(std::move(trimBlob(blob)))
+    , blob_(std::move(blob))
   {
+    blob_.narrow(trimBlob(blob_.view()));
   }
 };
 
@@ -109,11 +147,11 @@ struct CppDefine : public CppObj
     kConstCharDef,
     kComplexMacro,
   };
-  const DefType     defType_;
-  const std::string name_;
-  const std::string defn_; ///< This will contain everything after name.
+  const DefType       defType_;
+  const std::string   name_;
+  const CppSourceText defn_; ///< This will contain everything after name.
 
-  CppDefine(DefType defType, std::string name, std::string defn = std::string())
+  CppDefine(DefType defType, std::string name, CppSourceText defn = CppSourceText())
     : CppObj(kObjectType, CppAccessType::kUnknown)
     , defType_(defType)
     , name_(std::move(name))
@@ -294,10 +332,20 @@ using CppObjPtr            = std::unique_ptr<CppObj>;
 struct CppFunctionPointer;
 struct CppEnum;
 
+/**
+ * Type of a variable, parameter, or return value.
+ *
+ * When CppParser::shareVarTypes() is on, structurally identical types of variables are replaced by one canonical
+ * instance that lives till the process ends. Such shared instances are immutable, see shared().
+ */
 struct CppVarType : public CppObj, public AttribSpecified
 {
   static constexpr CppObjType kObjectType = CppObjType::kVarType;
 
+private:
+  bool shared_ {false};
+
+public:
   bool paramPack_ {false};
 
   CppVarType(std::string baseType, CppTypeModifier modifier = CppTypeModifier());
@@ -311,8 +359,13 @@ struct CppVarType : public CppObj, public AttribSpecified
   {
     return baseType_;
   }
+  CppIdentifier baseTypeId() const
+  {
+    return baseType_;
+  }
   void baseType(std::string _baseType)
   {
+    assert(!shared_);
     baseType_ = std::move(_baseType);
   }
   CppObj* compound() const
@@ -325,10 +378,12 @@ struct CppVarType : public CppObj, public AttribSpecified
   }
   void typeAttr(std::uint32_t attr)
   {
+    assert(!shared_);
     typeAttr_ = attr;
   }
   void addAttr(std::uint32_t attr)
   {
+    assert(!shared_);
     if ((attr & CppIdentifierAttrib::kConst) == 0)
       typeAttr_ |= attr;
     else
@@ -342,10 +397,37 @@ struct CppVarType : public CppObj, public AttribSpecified
 
   CppTypeModifier& typeModifier()
   {
+    assert(!shared_);
     return typeModifier_;
   }
 
+  /**
+   * @return true if this is the canonical instance that structurally identical types share.
+   * \note A shared instance must not be mutated, owners like CppVar replace it with a copy before mutating.
+   */
+  bool shared() const
+  {
+    return shared_;
+  }
+  /**
+   * @return true if this type can be shared, i.e. it does not define a compound, enum, or function pointer
+   * and has no attribute specifier.
+   */
+  bool shareable() const
+  {
+    return !compound_ && !attribSpecifierSequence();
+  }
+  /**
+   * @return Hash of everything that decides equality of types, it is computed only once for shared types.
+   */
+  std::uint32_t structuralHash() const
+  {
+    return shared_ ? hash_ : computeStructuralHash();
+  }
+
 private:
+  friend class CppVarTypePool;
+
   CppVarType(CppAccessType accessType, std::string baseType, std::uint32_t typeAttr, CppTypeModifier modifier)
     : CppObj(kObjectType, accessType)
     , baseType_(cleanseIdentifier(baseType))
@@ -354,13 +436,42 @@ private:
   {
   }
 
+  std::uint32_t computeStructuralHash() const;
+
 private:
-  std::string     baseType_; // This is the basic data type of var e.g. for 'const int*& pi' base-type is int.
+  CppIdentifier   baseType_; // This is the basic data type of var e.g. for 'const int*& pi' base-type is int.
   CppObjPtr       compound_;
   CppTypeModifier typeModifier_;
   std::uint32_t   typeAttr_ {0}; // Attribute associated with type, e.g. static, extern, extern "C", const, volatile.
+  std::uint32_t   hash_ {0};     // Structural hash, valid only for shared instances.
 };
 
+/**
+ * Types are equal if they are structurally identical.
+ * A type that defines a compound, enum, or function pointer, or has attribute specifiers, is equal only to itself.
+ * Two distinct shared instances are never equal and so comparing shared types is a pointer compare.
+ */
+bool operator==(const CppVarType& lhs, const CppVarType& rhs);
+
+inline bool operator!=(const CppVarType& lhs, const CppVarType& rhs)
+{
+  return !(lhs == rhs);
+}
+
+/**
+ * Deletes a CppVarType unless it is a shared instance, which lives till the process ends.
+ */
+struct CppVarTypeDeleter
+{
+  void operator()(CppVarType* varType) const
+  {
+    if ((varType != nullptr) && !varType->shared())
+      delete varType;
+  }
+};
+
+using CppVarTypePtr = std::unique_ptr<CppVarType, CppVarTypeDeleter>;
+
 using CppVarTypeEPtr      = CppEasyPtr<CppVarType>;
 using CppConstVarTypeEPtr = CppEasyPtr<const CppVarType>;
 
@@ -379,6 +490,10 @@ struct CppVarDecl
   {
     return name_;
   }
+  CppIdentifier nameId() const
+  {
+    return name_;
+  }
   void name(std::string _name)
   {
     name_ = std::move(_name);
@@ -418,19 +533,65 @@ struct CppVarDecl
   }
 
 private:
-  std::string   name_;
+  CppIdentifier name_;
   CppExprPtr    assignValue_; // Value assigned at declaration.
   AssignType    assignType_ {AssignType::kNone};
   CppExprPtr    bitField_;
   CppArraySizes arraySizes_;
 };
 
-using CppVarTypePtr = std::unique_ptr<CppVarType>;
+struct CppFunctionPointer;
+/**
+ * Parameter types that are used to define a template class or function.
+ */
+struct CppTemplateParam
+{
+  // If not nullptr then template param is not of type typename/class
+  std::unique_ptr<const CppObj> paramType_;
+  CppIdentifier                 paramName_;
+
+  CppTemplateParam(std::string paramName)
+    : paramType_(nullptr)
+    , paramName_(std::move(paramName))
+  {
+  }
+
+  CppTemplateParam(const CppVarType* paramType, std::string paramName)
+    : paramType_(paramType)
+    , paramName_(std::move(paramName))
+  {
+  }
+
+  CppTemplateParam(const CppFunctionPointer* paramType, std::string paramName);
+
+  CppObj* defaultArg() const
+  {
+    return defaultArg_.get();
+  }
 
-struct CppTemplateParam;
-using CppTemplateParamList    = std::vector<std::unique_ptr<CppTemplateParam>>;
+  void defaultArg(CppObj* defParam)
+  {
+    assert(!defaultArg_);
+    defaultArg_.reset(defParam);
+  }
+
+private:
+  CppObjPtr defaultArg_; //< Can be CppVarType or CppExpr
+};
+
+// Parameters are stored by value so that traversing the list does not chase a pointer per parameter.
+using CppTemplateParamList    = std::vector<CppTemplateParam>;
 using CppTemplateParamListPtr = std::unique_ptr<CppTemplateParamList>;
 
+/**
+ * Parts of CppVar that most variables do not have.
+ */
+struct CppVarExtras
+{
+  std::string             apidecor; // It holds things like WINAPI, __declspec(dllexport), etc.
+  CppTemplateParamListPtr templSpec;
+};
+
 /**
  * Class to represent C++ variable definition.
  * A variable can be global, local or member of a struct, class, namespace, or union.
@@ -461,7 +622,10 @@ struct CppVar : public CppObj
   {
   }
 
-  CppVarType* varType() const
+  /**
+   * @return Type of this var, which may be shared with other vars, see mutableVarType() for changing it.
+   */
+  const CppVarType* varType() const
   {
     return varType_.get();
   }
@@ -469,11 +633,24 @@ struct CppVar : public CppObj
   {
     varType_ = std::move(_varType);
   }
+  /**
+   * @return Type of this var that can be mutated, a shared type is first replaced by a copy owned by this var.
+   */
+  CppVarType* mutableVarType()
+  {
+    if (varType_->shared())
+      varType_.reset(new CppVarType(*varType_));
+    return varType_.get();
+  }
 
   const std::string& name() const
   {
     return varDecl_.name();
   }
+  CppIdentifier nameId() const
+  {
+    return varDecl_.nameId();
+  }
 
   std::uint32_t typeAttr() const
   {
@@ -481,7 +658,7 @@ struct CppVar : public CppObj
   }
   void addAttr(std::uint32_t attr)
   {
-    varType_->addAttr(attr);
+    mutableVarType()->addAttr(attr);
   }
 
   const CppVarDecl& varDecl() const
@@ -522,27 +699,38 @@ struct CppVar : public CppObj
 
   const std::string& apidecor() const
   {
-    return apidecor_;
+    return extras_ ? extras_->apidecor : cppEmptyString();
   }
   void apidecor(std::string _apidecor)
   {
-    apidecor_ = std::move(_apidecor);
+    if (!_apidecor.empty() || extras_)
+      extras().apidecor = std::move(_apidecor);
   }
 
   const CppTemplateParamList* templateParamList() const
   {
-    return templSpec_.get();
+    return extras_ ? extras_->templSpec.get() : nullptr;
   }
   void templateParamList(CppTemplateParamList* templParamList)
   {
-    templSpec_.reset(templParamList);
+    if (templParamList || extras_)
+      extras().templSpec.reset(templParamList);
   }
 
 private:
-  CppVarTypePtr           varType_;
-  CppVarDecl              varDecl_;
-  std::string             apidecor_; // It holds things like WINAPI, __declspec(dllexport), etc.
-  CppTemplateParamListPtr templSpec_;
+  friend class CppAstMemoryCounter;
+
+  CppVarExtras& extras()
+  {
+    if (!extras_)
+      extras_.reset(new CppVarExtras);
+    return *extras_;
+  }
+
+private:
+  CppVarTypePtr                 varType_;
+  CppVarDecl                    varDecl_;
+  std::unique_ptr<CppVarExtras> extras_; // Allocated only when a rarely used part is set.
 };
 
 using CppVarPtr       = std::unique_ptr<CppVar>;
@@ -629,9 +817,9 @@ struct CppMacroCall : CppObj
 {
   static constexpr CppObjType kObjectType = CppObjType::kMacroCall;
 
-  const std::string macroCall_;
+  const CppSourceText macroCall_;
 
-  CppMacroCall(std::string macroCall, CppAccessType accessType)
+  CppMacroCall(CppSourceText macroCall, CppAccessType accessType)
     : CppObj(kObjectType, accessType)
     , macroCall_(std::move(macroCall))
   {
@@ -644,7 +832,7 @@ using CppMacroCallEPtr = CppEasyPtr<CppMacroCall>;
 
 struct CppInheritInfo
 {
-  const std::string   baseName;
+  const CppIdentifier baseName;
   const CppAccessType inhType;
   const bool          isVirtual {false};
 
@@ -656,45 +844,6 @@ struct CppInheritInfo
   }
 };
 
-struct CppFunctionPointer;
-/**
- * Parameter types that are used to define a template class or function.
- */
-struct CppTemplateParam
-{
-  // If not nullptr then template param is not of type typename/class
-  const std::unique_ptr<const CppObj> paramType_;
-  const std::string                   paramName_;
-
-  CppTemplateParam(std::string paramName)
-    : paramType_(nullptr)
-    , paramName_(std::move(paramName))
-  {
-  }
-
-  CppTemplateParam(const CppVarType* paramType, std::string paramName)
-    : paramType_(paramType)
-    , paramName_(std::move(paramName))
-  {
-  }
-
-  CppTemplateParam(const CppFunctionPointer* paramType, std::string paramName);
-
-  CppObj* defaultArg() const
-  {
-    return defaultArg_.get();
-  }
-
-  void defaultArg(CppObj* defParam)
-  {
-    assert(!defaultArg_);
-    defaultArg_.reset(defParam);
-  }
-
-private:
-  CppObjPtr defaultArg_; //< Can be CppVarType or CppExpr
-};
-
 struct CppFwdClsDecl : public CppObj
 {
   static constexpr CppObjType kObjectType = CppObjType::kFwdClsDecl;
@@ -745,13 +894,29 @@ private:
 
 using CppFwdClsDeclEPtr = CppEasyPtr<CppFwdClsDecl>;
 
-using CppInheritanceList    = std::list<CppInheritInfo>;
+using CppInheritanceList    = std::vector<CppInheritInfo>;
 using CppInheritanceListPtr = std::unique_ptr<CppInheritanceList>;
 using CppObjPtrArray        = std::vector<std::unique_ptr<CppObj>>;
 
 struct CppConstructor;
 struct CppDestructor;
 
+/**
+ * Parts of CppCompound that only classes, or rarely any compound, have.
+ */
+struct CppCompoundExtras
+{
+  std::string             apidecor;
+  CppTemplateParamListPtr templSpec;
+
+  std::vector<const CppConstructor*> ctors;
+  const CppConstructor*              copyCtor {nullptr};
+  const CppConstructor*              moveCtor {nullptr};
+  const CppDestructor*               dtor {nullptr};
+
+  std::unique_ptr<const CppSourceBuffer> source;
+};
+
 /**
  * All classes, structs, unions, and namespaces can be classified as a Compound object.
  * Besides that followings too are compound objects:
@@ -786,18 +951,27 @@ struct CppCompound : public CppObj, public AttribSpecified
   {
   }
 
+  /**
+   * Members are deleted in a loop instead of recursively, so that deeply nested compounds can't overflow the stack.
+   */
+  ~CppCompound() override;
+
   const std::string& name() const
   {
     return name_;
   }
+  CppIdentifier nameId() const
+  {
+    return name_;
+  }
   void name(std::string _name)
   {
     name_ = std::move(_name);
   }
   std::string justName() const
   {
-    const auto itr = name_.rfind(':');
-    if (itr == name_.npos)
+    const auto itr = name().rfind(':');
+    if (itr == std::string::npos)
       return name();
     return name().substr(itr + 1);
   }
@@ -822,24 +996,26 @@ struct CppCompound : public CppObj, public AttribSpecified
 
   const std::string& apidecor() const
   {
-    return apidecor_;
+    return extras_ ? extras_->apidecor : cppEmptyString();
   }
   void apidecor(std::string apidecor)
   {
-    apidecor_ = std::move(apidecor);
+    if (!apidecor.empty() || extras_)
+      extras().apidecor = std::move(apidecor);
   }
 
   const CppTemplateParamList* templateParamList() const
   {
-    return templSpec_.get();
+    return extras_ ? extras_->templSpec.get() : nullptr;
   }
   void templateParamList(CppTemplateParamListPtr _templateParamList)
   {
-    templSpec_ = std::move(_templateParamList);
+    if (_templateParamList || extras_)
+      extras().templSpec = std::move(_templateParamList);
   }
   void templateParamList(CppTemplateParamList* _templateParamList)
   {
-    templSpec_.reset(_templateParamList);
+    templateParamList(CppTemplateParamListPtr(_templateParamList));
   }
 
   const CppInheritanceListPtr& inheritanceList() const
@@ -873,6 +1049,7 @@ struct CppCompound : public CppObj, public AttribSpecified
     assert(idx < members_.size());
     auto ret = std::move(members_[idx]);
     members_.erase(members_.begin() + idx);
+    ret->owner_ = nullptr;
 
     return ret;
   }
@@ -888,22 +1065,27 @@ struct CppCompound : public CppObj, public AttribSpecified
   bool                  hasPureVirtual() const;
   const CppConstructor* copyCtor() const
   {
-    return copyCtor_;
+    return extras_ ? extras_->copyCtor : nullptr;
   }
   const CppConstructor* moveCtor() const
   {
-    return moveCtor_;
+    return extras_ ? extras_->moveCtor : nullptr;
   }
   const std::vector<const CppConstructor*>& ctors() const
   {
-    return ctors_;
+    static const std::vector<const CppConstructor*> noCtors;
+    return extras_ ? extras_->ctors : noCtors;
   }
   const CppDestructor* dtor() const
   {
-    return dtor_;
+    return extras_ ? extras_->dtor : nullptr;
   }
   bool triviallyConstructable() const;
 
+  std::uint32_t attr() const
+  {
+    return attr_;
+  }
   void addAttr(std::uint32_t _attr)
   {
     attr_ |= _attr;
@@ -919,22 +1101,44 @@ struct CppCompound : public CppObj, public AttribSpecified
     return (members_.size() == 1) && (members_.front()->objType_ == CppBlob::kObjectType);
   }
 
+  /**
+   * Keeps \a source alive as long as this compound because text of objects in it refers to \a source.
+   * \see CppParser::retainSourceBuffer()
+   */
+  void retainSource(std::unique_ptr<const CppSourceBuffer> source)
+  {
+    if (source || extras_)
+      extras().source = std::move(source);
+  }
+  const CppSourceBuffer* retainedSource() const
+  {
+    return extras_ ? extras_->source.get() : nullptr;
+  }
+
+  /**
+   * @return Memory used by this compound and everything in it, broken down by type of node.
+   */
+  CppAstMemoryReport memoryReport() const;
+
 private:
+  friend class CppAstMemoryCounter;
+
   void assignSpecialMember(const CppObj* mem);
 
-private:
-  std::string             name_;
-  CppCompoundType         compoundType_;
-  CppObjPtrArray          members_; // Objects arranged in sequential order from top to bottom.
-  CppInheritanceListPtr   inheritanceList_;
-  std::string             apidecor_;
-  CppTemplateParamListPtr templSpec_;
-  std::uint32_t           attr_ {0}; // e.g. final
+  CppCompoundExtras& extras()
+  {
+    if (!extras_)
+      extras_.reset(new CppCompoundExtras);
+    return *extras_;
+  }
 
-  std::vector<const CppConstructor*> ctors_;
-  const CppConstructor*              copyCtor_ {nullptr};
-  const CppConstructor*              moveCtor_ {nullptr};
-  const CppDestructor*               dtor_ {nullptr};
+private:
+  CppIdentifier                      name_;
+  CppCompoundType                    compoundType_;
+  std::uint32_t                      attr_ {0}; // e.g. final
+  CppObjPtrArray                     members_;  // Objects arranged in sequential order from top to bottom.
+  CppInheritanceListPtr              inheritanceList_;
+  std::unique_ptr<CppCompoundExtras> extras_; // Allocated only when a rarely used part is set.
 
   mutable TriStateBool hasVirtual_     = TriStateBool::Unknown;
   mutable TriStateBool hasPureVirtual_ = TriStateBool::Unknown;
@@ -950,15 +1154,27 @@ using CppFuncThrowSpec    = CppIdentifierList;
 using CppCompoundPtr      = std::unique_ptr<CppCompound>;
 using CppFuncThrowSpecPtr = std::unique_ptr<CppFuncThrowSpec>;
 
+/**
+ * Parts of functions and lambdas that most of them do not have.
+ */
+struct CppFuncExtras
+{
+  CppFuncThrowSpecPtr     throwSpec;
+  std::string             decor1; // e.g. __declspec(dllexport)
+  std::string             decor2; // e.g. __stdcall
+  CppTemplateParamListPtr templSpec;
+};
+
 struct CppFuncLikeBase : public CppObj
 {
   const CppFuncThrowSpec* throwSpec() const
   {
-    return throwSpec_.get();
+    return extras_ ? extras_->throwSpec.get() : nullptr;
   }
   void throwSpec(CppFuncThrowSpec* _throwSpec)
   {
-    throwSpec_.reset(_throwSpec);
+    if (_throwSpec || extras_)
+      extras().throwSpec.reset(_throwSpec);
   }
 
   const CppCompound* defn() const
@@ -976,9 +1192,20 @@ protected:
   {
   }
 
+  CppFuncExtras& extras()
+  {
+    if (!extras_)
+      extras_.reset(new CppFuncExtras);
+    return *extras_;
+  }
+
+protected:
+  friend class CppAstMemoryCounter;
+
+  std::unique_ptr<CppFuncExtras> extras_; // Allocated only when a rarely used part is set.
+
 private:
-  CppCompoundPtr      defn_; // If it is nullptr then this object is just for declaration.
-  CppFuncThrowSpecPtr throwSpec_;
+  CppCompoundPtr defn_; // If it is nullptr then this object is just for declaration.
 };
 
 /**
@@ -986,7 +1213,7 @@ private:
  */
 struct CppFunctionBase : public CppFuncLikeBase
 {
-  const std::string name_;
+  const CppIdentifier name_;
 
   std::uint32_t attr() const
   {
@@ -1003,29 +1230,32 @@ struct CppFunctionBase : public CppFuncLikeBase
 
   const std::string& decor1() const
   {
-    return decor1_;
+    return extras_ ? extras_->decor1 : cppEmptyString();
   }
   void decor1(std::string _decor)
   {
-    decor1_ = std::move(_decor);
+    if (!_decor.empty() || extras_)
+      extras().decor1 = std::move(_decor);
   }
 
   const std::string& decor2() const
   {
-    return decor2_;
+    return extras_ ? extras_->decor2 : cppEmptyString();
   }
   void decor2(std::string _decor)
   {
-    decor2_ = std::move(_decor);
+    if (!_decor.empty() || extras_)
+      extras().decor2 = std::move(_decor);
   }
 
   const CppTemplateParamList* templateParamList() const
   {
-    return templSpec_.get();
+    return extras_ ? extras_->templSpec.get() : nullptr;
   }
   void templateParamList(CppTemplateParamList* templParamList)
   {
-    templSpec_.reset(templParamList);
+    if (templParamList || extras_)
+      extras().templSpec.reset(templParamList);
   }
 
 protected:
@@ -1037,10 +1267,7 @@ protected:
   }
 
 private:
-  std::uint32_t           attr_;   // e.g.: const, static, virtual, inline, constexpr, etc.
-  std::string             decor1_; // e.g. __declspec(dllexport)
-  std::string             decor2_; // e.g. __stdcall
-  CppTemplateParamListPtr templSpec_;
+  std::uint32_t attr_; // e.g.: const, static, virtual, inline, constexpr, etc.
 };
 
 using CppParamVector    = std::vector<CppObjPtr>;
@@ -1073,8 +1300,6 @@ protected:
   const CppParamVectorPtr params_;
 };
 
-using CppVarTypePtr  = std::unique_ptr<CppVarType>;
-using CppVarTypeEPtr = CppEasyPtr<CppVarType>;
 
 struct CppFunction : public CppFuncCtorBase
 {
@@ -1157,6 +1382,8 @@ using CppFunctionPointerEPtr = CppEasyPtr<CppFunctionPointer>;
  */
 using CppMemInit = std::pair<std::string, CppExpr*>;
 
+using CppMemInitList = std::vector<CppMemInit>;
+
 /**
  * Entire member initialization list.
  */
@@ -1165,8 +1392,8 @@ struct CppMemInits
   bool memInitListIsABlob_;
   union
   {
-    std::list<CppMemInit>* memInitList;
-    CppBlob*               blob;
+    CppMemInitList* memInitList;
+    CppBlob*        blob;
   };
 };
 
@@ -1175,7 +1402,7 @@ inline CppMemInits makeEmptyCppMemInitList()
   return CppMemInits {false, {nullptr}};
 }
 
-inline CppMemInits makeCppMemInitList(std::list<CppMemInit>* memInitList)
+inline CppMemInits makeCppMemInitList(CppMemInitList* memInitList)
 {
   CppMemInits memInits = makeEmptyCppMemInitList();
   memInits.memInitList = memInitList;
@@ -1208,13 +1435,7 @@ struct CppConstructor : public CppFuncCtorBase
   {
   }
 
-  ~CppConstructor() override
-  {
-    if (memInits_.memInitListIsABlob_)
-      delete memInits_.blob;
-    else
-      delete memInits_.memInitList;
-  }
+  ~CppConstructor() override;
 
   bool isCopyConstructor() const;
   bool isMoveConstructor() const;
@@ -1353,18 +1574,25 @@ using CppDocCommentEPtr = CppEasyPtr<CppDocComment>;
 struct CppExpr;
 /**
  * An individual expression.
+ *
+ * Identifiers and literals are the most numerous atoms and so short ones are stored in the atom itself instead of on heap.
+ * Longer ones are kept in a buffer that the atom owns.
+ * \note Room for inline text makes an atom 24 bytes, 8 more than a pointer and a type, and so a CppExpr 24 bytes more.
  */
 struct CppExprAtom
 {
+  static constexpr size_t kMaxInlineAtomSize = 16;
+
   union
   {
-    std::string* atom;
-    CppExpr*     expr;
-    CppLambda*   lambda;
-    CppVarType*  varType; //!< For type cast, and sizeof expression.
+    char        inlineAtom_[kMaxInlineAtomSize];
+    char*       ownedAtom_; // Size of text followed by the text.
+    CppExpr*    expr;
+    CppLambda*  lambda;
+    CppVarType* varType; //!< For type cast, and sizeof expression.
   };
 
-  enum
+  enum : std::uint8_t
   {
     kInvalid,
     kAtom,
@@ -1373,24 +1601,44 @@ struct CppExprAtom
     kVarType
   } type;
 
+private:
+  static constexpr std::uint8_t kOwnedAtom = 0xFF;
+
+  std::uint8_t atomSize_ = 0; // Size of inline atom, or kOwnedAtom.
+
+public:
   bool isExpr() const
   {
     return (type & kExpr) == kExpr;
   }
 
+  CppExprAtom(std::string_view atom)
+    : type(kAtom)
+  {
+    if (atom.size() <= kMaxInlineAtomSize)
+    {
+      std::memcpy(inlineAtom_, atom.data(), atom.size());
+      atomSize_ = static_cast<std::uint8_t>(atom.size());
+    }
+    else
+    {
+      const auto size = atom.size();
+      ownedAtom_      = new char[sizeof(size) + size];
+      std::memcpy(ownedAtom_, &size, sizeof(size));
+      std::memcpy(ownedAtom_ + sizeof(size), atom.data(), size);
+      atomSize_ = kOwnedAtom;
+    }
+  }
   CppExprAtom(const char* sz, size_t l)
-    : atom(new std::string(sz, l))
-    , type(kAtom)
+    : CppExprAtom(std::string_view(sz, l))
   {
   }
   CppExprAtom(const char* sz)
-    : atom(new std::string(sz))
-    , type(kAtom)
+    : CppExprAtom(std::string_view(sz))
   {
   }
-  CppExprAtom(std::string tok)
-    : atom(new std::string(std::move(tok)))
-    , type(kAtom)
+  CppExprAtom(const std::string& tok)
+    : CppExprAtom(std::string_view(tok))
   {
   }
   CppExprAtom(CppExpr* e)
@@ -1409,10 +1657,31 @@ struct CppExprAtom
   {
   }
   CppExprAtom()
-    : atom(nullptr)
+    : expr(nullptr)
     , type(kInvalid)
   {
   }
+
+  /**
+   * @return Text of atom, valid only when type is kAtom.
+   */
+  std::string_view atom() const
+  {
+    if (atomSize_ != kOwnedAtom)
+      return std::string_view(inlineAtom_, atomSize_);
+    size_t size;
+    std::memcpy(&size, ownedAtom_, sizeof(size));
+    return std::string_view(ownedAtom_ + sizeof(size), size);
+  }
+
+  /**
+   * @return Size of heap memory that atom owns for its text.
+   */
+  size_t ownedBytes() const
+  {
+    return ((type == kAtom) && (atomSize_ == kOwnedAtom)) ? sizeof(size_t) + atom().size() : 0;
+  }
+
   /**
    * It is expected to be called explicitly to destroy an CppExprAtom object.
    */
@@ -1492,8 +1761,8 @@ struct CppExpr : public CppObj
   {
   }
 
-  CppExpr(std::string name)
-    : CppExpr(CppExprAtom(std::move(name)), CppOperator::kNone)
+  CppExpr(std::string_view name)
+    : CppExpr(CppExprAtom(name), CppOperator::kNone)
   {
   }
 
@@ -1505,12 +1774,10 @@ struct CppExpr : public CppObj
   {
   }
 
-  ~CppExpr() override
-  {
-    expr1_.destroy();
-    expr2_.destroy();
-    expr3_.destroy();
-  }
+  /**
+   * Sub-expressions are deleted in a loop instead of recursively, so that deep expressions can't overflow the stack.
+   */
+  ~CppExpr() override;
 };
 
 using CppExprEPtr      = CppEasyPtr<CppExpr>;
@@ -1520,8 +1787,8 @@ using CppConstExprEPtr = CppEasyPtr<const CppExpr>;
 
 struct CppEnumItem
 {
-  const std::string name_;
-  const CppObjPtr   val_;
+  std::string name_;
+  CppObjPtr   val_;
 
   CppEnumItem(std::string name, CppExpr* val = nullptr)
     : name_(std::move(name))
@@ -1535,7 +1802,8 @@ struct CppEnumItem
   }
 };
 
-using CppEnumItemList    = std::list<CppEnumItem*>;
+// Items are stored by value so that traversing the list does not chase a pointer per item.
+using CppEnumItemList    = std::vector<CppEnumItem>;
 using CppEnumItemListPtr = std::unique_ptr<CppEnumItemList>;
 
 struct CppEnum : public CppObj
@@ -1588,6 +1856,10 @@ struct CppIfBlock : public CppCommonBlock<CppObjType::kIfBlock>
     , else_ {_else}
   {
   }
+  /**
+   * Else part is deleted in a loop instead of recursively, so that a deep else-if ladder can't overflow the stack.
+   */
+  ~CppIfBlock() override;
   const CppObj* elsePart() const
   {
     return else_.get();
@@ -1679,11 +1951,18 @@ struct CppSwitchBlock : public CppObj
 
 using CppSwitchBlockEPtr = CppEasyPtr<CppSwitchBlock>;
 
-struct CppCatchBlock
+struct CppCatchBlock : public CppAstNode
 {
   const CppVarTypePtr  exceptionType_;
   const std::string    exceptionName_;
   const CppCompoundPtr catchStmt_;
+
+  CppCatchBlock(CppVarTypePtr exceptionType, std::string exceptionName, CppCompoundPtr catchStmt)
+    : exceptionType_(std::move(exceptionType))
+    , exceptionName_(std::move(exceptionName))
+    , catchStmt_(std::move(catchStmt))
+  {
+  }
 };
 
 using CppCatchBlockPtr = std::unique_ptr<CppCatchBlock>;
@@ -1707,6 +1986,11 @@ struct CppTryBlock : public CppObj
     catchBlocks_.emplace_back(catchBlock);
   }
 
+  const CppCatchBlocks& catchBlocks() const
+  {
+    return catchBlocks_;
+  }
+
 private:
   CppCatchBlocks catchBlocks_;
 };
@@ -1718,9 +2002,9 @@ struct CppTemplateArg;
 
 struct CppAsmBlock : public CppObj
 {
-  const std::string asm_; // Entire asm block including keyword asm.
+  const CppSourceText asm_; // Entire asm block including keyword asm.
 
-  CppAsmBlock(std::string asmBlock)
+  CppAsmBlock(CppSourceText asmBlock)
     : CppObj(CppObjType::kAsmBlock, CppAccessType::kUnknown)
     , asm_(std::move(asmBlock))
   {
@@ -1734,7 +2018,8 @@ inline void CppExprAtom::destroy() const
   switch (type)
   {
     case CppExprAtom::kAtom:
-      delete atom;
+      if (atomSize_ == kOwnedAtom)
+        delete[] ownedAtom_;
       break;
     case CppExprAtom::kExpr:
       delete expr;
@@ -1805,8 +2090,9 @@ inline CppVarType::CppVarType(CppAccessType accessType, CppEnum* enumObj, CppTyp
 }
 
 inline CppVarType::CppVarType(const CppVarType& varType)
-  : CppVarType(varType.accessType_, varType.baseType(), varType.typeModifier())
+  : CppVarType(varType.accessType_, varType.baseType(), varType.typeAttr_, varType.typeModifier())
 {
+  paramPack_ = varType.paramPack_;
   // TODO: clone compound_.
 }
 
@@ -1831,7 +2117,7 @@ inline bool operator==(const CppExprAtom& exprAtom1, const CppExprAtom& exprAtom
     return false;
   if (exprAtom1.type == CppExprAtom::kAtom)
   {
-    return (*exprAtom1.atom) == (*exprAtom2.atom);
+    return exprAtom1.atom() == exprAtom2.atom();
   }
   if (exprAtom1.type == CppExprAtom::kExpr)
   {
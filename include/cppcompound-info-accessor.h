@@ -30,6 +30,8 @@
 #include "cppobj-info-accessor.h"
 
 #include <functional>
+#include <utility>
+#include <vector>
 
 inline bool forEachMember(CppConstCompoundEPtr compound, std::function<bool(const CppObj*)> visitor)
 {
@@ -91,28 +93,54 @@ inline std::string fullName(CppConstCompoundEPtr compound)
     return compound->name();
 }
 
+/**
+ * Visits members of \a compound, and those of namespace-like members, after visiting their members.
+ * When \a visitor returns true the remaining members of the compound owning the visited one are skipped.
+ * Nested compounds are tracked on an explicit stack, so that deep nesting can't overflow the call stack.
+ * @return false always, the traversal of outer compounds isn't stopped by \a visitor.
+ */
 inline bool traverse(CppConstCompoundEPtr compound, std::function<bool(const CppObj*)> visitor)
 {
-  forEachMember(compound, [&](const CppObj* mem) {
-    if (isNamespaceLike(mem) && traverse(mem, visitor))
-      return true;
-    if (visitor(mem))
-      return true;
-
-    return false;
-  });
+  // Compounds being traversed with index of their member to visit next.
+  std::vector<std::pair<const CppCompound*, size_t>> compounds {{compound.get(), 0}};
+  while (!compounds.empty())
+  {
+    auto& [cur, memIdx] = compounds.back();
+    if (memIdx == cur->members().size())
+    {
+      const auto* traversed = cur;
+      compounds.pop_back();
+      if (compounds.empty())
+        break;
+      auto& [owner, ownerMemIdx] = compounds.back();
+      ownerMemIdx                = visitor(traversed) ? owner->members().size() : ownerMemIdx + 1;
+      continue;
+    }
+
+    const auto* mem = cur->members()[memIdx].get();
+    if (isNamespaceLike(mem))
+    {
+      compounds.emplace_back(static_cast<const CppCompound*>(mem), 0);
+      continue;
+    }
+    memIdx = visitor(mem) ? cur->members().size() : memIdx + 1;
+  }
 
   return false;
 }
 
+/**
+ * Visits members of \a compound, each before traversing it with traverse() if it is namespace-like.
+ * When \a visitor returns true for a member of \a compound the remaining members of \a compound are skipped.
+ * @return false always.
+ */
 inline bool traversePreorder(CppConstCompoundEPtr compound, std::function<bool(const CppObj*)> visitor)
 {
   forEachMember(compound, [&](const CppObj* mem) {
     if (visitor(mem))
       return true;
-    if (isNamespaceLike(mem) && traverse(mem, visitor))
-      return true;
-
+    if (isNamespaceLike(mem))
+      traverse(mem, visitor);
     return false;
   });
 
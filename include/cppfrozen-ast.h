@@ -0,0 +1,372 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "cppconst.h"
+#include "typemodifier.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct CppCompound;
+
+using CppFrozenNodeId = std::uint32_t;
+
+constexpr CppFrozenNodeId kNoFrozenNode = ~CppFrozenNodeId(0);
+
+/**
+ * Ids of a contiguous part of the child array of CppFrozenAst.
+ */
+class CppFrozenNodeIds
+{
+public:
+  CppFrozenNodeIds(const CppFrozenNodeId* beg, const CppFrozenNodeId* end)
+    : beg_(beg)
+    , end_(end)
+  {
+  }
+
+  const CppFrozenNodeId* begin() const
+  {
+    return beg_;
+  }
+  const CppFrozenNodeId* end() const
+  {
+    return end_;
+  }
+  size_t size() const
+  {
+    return end_ - beg_;
+  }
+  bool empty() const
+  {
+    return beg_ == end_;
+  }
+  CppFrozenNodeId operator[](size_t idx) const
+  {
+    return beg_[idx];
+  }
+
+private:
+  const CppFrozenNodeId* beg_;
+  const CppFrozenNodeId* end_;
+};
+
+/**
+ * Type of a frozen variable or return type of a frozen function.
+ */
+struct CppFrozenType
+{
+  std::string_view baseType;
+  CppTypeModifier  typeModifier;
+  std::uint32_t    typeAttr;
+};
+
+struct CppFrozenBase
+{
+  std::string_view baseName;
+  CppAccessType    inhType;
+  bool             isVirtual;
+};
+
+class CppFrozenCompound;
+class CppFrozenFunction;
+class CppFrozenVar;
+
+/**
+ * \brief Compact, immutable copy of the declarations in an AST, meant for passes that walk the same AST many times.
+ *
+ * Nodes are identified by dense ids given in preorder, so the descendants of a node are the ids that follow it
+ * up to subtreeEnd(), and visiting every node is a loop over ids.
+ * Every property is kept in an array of its own that is indexed by id, children of a node are a range of one array
+ * of ids, and all text is in one string pool. It does not refer to the AST it is made from.
+ *
+ * Children of a compound are its members, those of functions are their parameters followed by their definition,
+ * and those of control blocks are their bodies. Typedefs and variable lists have their variable as child,
+ * and a variable whose type defines a compound, enum, or function pointer has that as child.
+ * Every other node, including any expression, is a leaf.
+ */
+class CppFrozenAst
+{
+public:
+  explicit CppFrozenAst(const CppCompound& root);
+
+public:
+  size_t numNodes() const
+  {
+    return objTypes_.size();
+  }
+  CppFrozenNodeId root() const
+  {
+    return 0;
+  }
+
+  CppObjType objType(CppFrozenNodeId id) const
+  {
+    return objTypes_[id];
+  }
+  CppAccessType accessType(CppFrozenNodeId id) const
+  {
+    return accessTypes_[id];
+  }
+  /**
+   * @return Name of compound, function, variable, enum, forward declared class, using declaration,
+   * namespace alias, or typedef, and empty string for other nodes.
+   */
+  std::string_view name(CppFrozenNodeId id) const
+  {
+    return str(names_[id]);
+  }
+  CppFrozenNodeId parent(CppFrozenNodeId id) const
+  {
+    return parents_[id];
+  }
+  CppFrozenNodeIds children(CppFrozenNodeId id) const
+  {
+    return CppFrozenNodeIds(childIds_.data() + childStarts_[id], childIds_.data() + childStarts_[id + 1]);
+  }
+  /**
+   * @return Id that follows the last descendant of \a id.
+   */
+  CppFrozenNodeId subtreeEnd(CppFrozenNodeId id) const
+  {
+    return subtreeEnds_[id];
+  }
+
+  CppFrozenCompound compound(CppFrozenNodeId id) const;
+  CppFrozenFunction function(CppFrozenNodeId id) const;
+  CppFrozenVar      var(CppFrozenNodeId id) const;
+
+  /**
+   * @return Number of bytes used by all arrays and by the string pool.
+   */
+  size_t numBytes() const;
+
+private:
+  friend class CppFrozenAstBuilder;
+  friend class CppFrozenNode;
+  friend class CppFrozenCompound;
+  friend class CppFrozenFunction;
+  friend class CppFrozenVar;
+
+  struct StrRef
+  {
+    std::uint32_t offset;
+    std::uint32_t size;
+  };
+
+  std::string_view str(StrRef ref) const
+  {
+    return std::string_view(strPool_.data() + ref.offset, ref.size);
+  }
+  CppFrozenType type(std::uint32_t typeIdx) const
+  {
+    return CppFrozenType {str(typeBaseTypes_[typeIdx]), typeModifiers_[typeIdx], typeAttrs_[typeIdx]};
+  }
+
+private:
+  // Indexed by node id.
+  std::vector<CppObjType>      objTypes_;
+  std::vector<CppAccessType>   accessTypes_;
+  std::vector<StrRef>          names_;
+  std::vector<CppFrozenNodeId> parents_;
+  std::vector<CppFrozenNodeId> subtreeEnds_;
+  std::vector<std::uint32_t>   childStarts_; // Children of id end where those of id + 1 start.
+  std::vector<std::uint32_t>   details_;     // Index in the table of compounds, functions, or variables.
+
+  std::vector<CppFrozenNodeId> childIds_;
+
+  // Indexed by detail of compounds.
+  std::vector<CppCompoundType> compoundTypes_;
+  std::vector<std::uint32_t>   compoundAttrs_;
+  std::vector<std::uint32_t>   baseStarts_; // One more than number of compounds.
+
+  std::vector<StrRef>        baseNames_;
+  std::vector<CppAccessType> baseInhTypes_;
+  std::vector<std::uint8_t>  baseIsVirtual_;
+
+  // Indexed by detail of functions.
+  std::vector<std::uint32_t>   funcAttrs_;
+  std::vector<std::uint32_t>   funcRetTypes_; // Index of type, ~0 if function has no return type.
+  std::vector<std::uint32_t>   funcNumParams_;
+  std::vector<CppFrozenNodeId> funcDefns_;
+
+  // Indexed by detail of variables.
+  std::vector<std::uint32_t> varTypes_;
+
+  // Indexed by type index.
+  std::vector<StrRef>          typeBaseTypes_;
+  std::vector<CppTypeModifier> typeModifiers_;
+  std::vector<std::uint32_t>   typeAttrs_;
+
+  std::string strPool_;
+};
+
+/**
+ * Typed view of a frozen node, it is valid as long as the CppFrozenAst it views.
+ */
+class CppFrozenNode
+{
+public:
+  CppFrozenNode(const CppFrozenAst& ast, CppFrozenNodeId id)
+    : ast_(&ast)
+    , id_(id)
+  {
+  }
+
+  CppFrozenNodeId id() const
+  {
+    return id_;
+  }
+  CppObjType objType() const
+  {
+    return ast_->objType(id_);
+  }
+  CppAccessType accessType() const
+  {
+    return ast_->accessType(id_);
+  }
+  std::string_view name() const
+  {
+    return ast_->name(id_);
+  }
+  CppFrozenNodeId owner() const
+  {
+    return ast_->parent(id_);
+  }
+
+protected:
+  std::uint32_t detail() const
+  {
+    return ast_->details_[id_];
+  }
+
+protected:
+  const CppFrozenAst* ast_;
+  CppFrozenNodeId     id_;
+};
+
+class CppFrozenCompound : public CppFrozenNode
+{
+public:
+  using CppFrozenNode::CppFrozenNode;
+
+  CppCompoundType compoundType() const
+  {
+    return ast_->compoundTypes_[detail()];
+  }
+  std::uint32_t attr() const
+  {
+    return ast_->compoundAttrs_[detail()];
+  }
+  bool hasAttr(std::uint32_t _attr) const
+  {
+    return (attr() & _attr) == _attr;
+  }
+  CppFrozenNodeIds members() const
+  {
+    return ast_->children(id_);
+  }
+  size_t numBases() const
+  {
+    return ast_->baseStarts_[detail() + 1] - ast_->baseStarts_[detail()];
+  }
+  CppFrozenBase base(size_t idx) const
+  {
+    const auto baseIdx = ast_->baseStarts_[detail()] + idx;
+    return CppFrozenBase {
+      ast_->str(ast_->baseNames_[baseIdx]), ast_->baseInhTypes_[baseIdx], ast_->baseIsVirtual_[baseIdx] != 0};
+  }
+};
+
+/**
+ * View of a function, function pointer, constructor, destructor, or type converter.
+ */
+class CppFrozenFunction : public CppFrozenNode
+{
+public:
+  using CppFrozenNode::CppFrozenNode;
+
+  std::uint32_t attr() const
+  {
+    return ast_->funcAttrs_[detail()];
+  }
+  bool hasAttr(std::uint32_t _attr) const
+  {
+    return (attr() & _attr) == _attr;
+  }
+  bool hasReturnType() const
+  {
+    return ast_->funcRetTypes_[detail()] != ~std::uint32_t(0);
+  }
+  /**
+   * @return Return type of function and function pointer, or the type a type converter converts to.
+   * \pre hasReturnType()
+   */
+  CppFrozenType returnType() const
+  {
+    return ast_->type(ast_->funcRetTypes_[detail()]);
+  }
+  CppFrozenNodeIds params() const
+  {
+    const auto children = ast_->children(id_);
+    return CppFrozenNodeIds(children.begin(), children.begin() + ast_->funcNumParams_[detail()]);
+  }
+  /**
+   * @return Id of compound that is the body of function, kNoFrozenNode if it is only declared.
+   */
+  CppFrozenNodeId defn() const
+  {
+    return ast_->funcDefns_[detail()];
+  }
+};
+
+class CppFrozenVar : public CppFrozenNode
+{
+public:
+  using CppFrozenNode::CppFrozenNode;
+
+  CppFrozenType varType() const
+  {
+    return ast_->type(ast_->varTypes_[detail()]);
+  }
+};
+
+inline CppFrozenCompound CppFrozenAst::compound(CppFrozenNodeId id) const
+{
+  return CppFrozenCompound(*this, id);
+}
+
+inline CppFrozenFunction CppFrozenAst::function(CppFrozenNodeId id) const
+{
+  return CppFrozenFunction(*this, id);
+}
+
+inline CppFrozenVar CppFrozenAst::var(CppFrozenNodeId id) const
+{
+  return CppFrozenVar(*this, id);
+}
@@ -0,0 +1,162 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+/**
+ * Handle to a string interned in the process wide symbol table.
+ *
+ * Names and types repeat a lot across files of a program and so AST stores them as CppIdentifier.
+ * Every distinct string is stored only once and two identifiers are equal only if they refer to the same entry,
+ * which makes their comparison a pointer compare.
+ * \note Interned strings are never freed.
+ */
+class CppIdentifier
+{
+public:
+  CppIdentifier();
+  explicit CppIdentifier(std::string_view str);
+  CppIdentifier(const std::string& str)
+    : CppIdentifier(std::string_view(str))
+  {
+  }
+  CppIdentifier(const char* str)
+    : CppIdentifier(std::string_view(str))
+  {
+  }
+
+  /**
+   * @return Identifier for \a str if it has already been interned.
+   * \note Unlike constructor it does not add \a str to the symbol table.
+   */
+  static std::optional<CppIdentifier> findInterned(std::string_view str);
+  /**
+   * @return Number of distinct strings interned so far.
+   */
+  static size_t numInterned();
+
+  const std::string& str() const
+  {
+    return *str_;
+  }
+  operator const std::string&() const
+  {
+    return *str_;
+  }
+
+  bool empty() const
+  {
+    return str_->empty();
+  }
+  size_t size() const
+  {
+    return str_->size();
+  }
+  const char* c_str() const
+  {
+    return str_->c_str();
+  }
+
+  friend bool operator==(CppIdentifier lhs, CppIdentifier rhs)
+  {
+    return lhs.str_ == rhs.str_;
+  }
+  friend bool operator!=(CppIdentifier lhs, CppIdentifier rhs)
+  {
+    return lhs.str_ != rhs.str_;
+  }
+  /**
+   * Identifiers are ordered by their strings so that containers keyed by them are iterated alphabetically.
+   */
+  friend bool operator<(CppIdentifier lhs, CppIdentifier rhs)
+  {
+    return (lhs.str_ != rhs.str_) && (*lhs.str_ < *rhs.str_);
+  }
+
+private:
+  explicit CppIdentifier(const std::string* str)
+    : str_(str)
+  {
+  }
+
+private:
+  const std::string* str_;
+};
+
+inline bool operator==(CppIdentifier lhs, const std::string& rhs)
+{
+  return lhs.str() == rhs;
+}
+inline bool operator==(const std::string& lhs, CppIdentifier rhs)
+{
+  return rhs == lhs;
+}
+inline bool operator!=(CppIdentifier lhs, const std::string& rhs)
+{
+  return !(lhs == rhs);
+}
+inline bool operator!=(const std::string& lhs, CppIdentifier rhs)
+{
+  return !(rhs == lhs);
+}
+inline bool operator==(CppIdentifier lhs, const char* rhs)
+{
+  return lhs.str() == rhs;
+}
+inline bool operator==(const char* lhs, CppIdentifier rhs)
+{
+  return rhs == lhs;
+}
+inline bool operator!=(CppIdentifier lhs, const char* rhs)
+{
+  return !(lhs == rhs);
+}
+inline bool operator!=(const char* lhs, CppIdentifier rhs)
+{
+  return !(rhs == lhs);
+}
+
+inline std::ostream& operator<<(std::ostream& stm, CppIdentifier id)
+{
+  return stm << id.str();
+}
+
+namespace std {
+
+template <>
+struct hash<CppIdentifier>
+{
+  size_t operator()(CppIdentifier id) const
+  {
+    return hash<const void*>()(&id.str());
+  }
+};
+
+} // namespace std
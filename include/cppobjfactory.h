@@ -26,16 +26,40 @@
 #include "cppast.h"
 #include "cppconst.h"
 
+#include <memory>
+#include <utility>
+
 /*!
  * \brief Factory class to create various CppObj instances.
  *
- * Ideally this factory class should be used to create any CppObj object so that clients of CppParser can supply its own
- * type.
- * At present creation of only few are added as per the requirement of CIB, https://github.com/satya-das/cib.
+ * Parser creates every AST node using this factory.
+ * Clients of CppParser can supply their own types for the objects that have virtual Create functions,
+ * these are added as per the requirement of CIB, https://github.com/satya-das/cib.
+ * All other nodes are created by Create() in the memory that the factory uses.
  */
 class CppObjFactory
 {
 public:
+  CppObjFactory()
+    : CppObjFactory(false)
+  {
+  }
+  virtual ~CppObjFactory() = default;
+
+  /**
+   * @brief Creates an AST node of type T in the memory that this factory uses.
+   */
+  template <typename T, typename... Params>
+  T* Create(Params&&... params) const
+  {
+    return new (*this) T(std::forward<Params>(params)...);
+  }
+
+  bool arenaBacked() const
+  {
+    return arenaBacked_;
+  }
+
   virtual CppCompound* CreateCompound(std::string name, CppAccessType accessType, CppCompoundType type) const;
   virtual CppCompound* CreateCompound(CppAccessType   accessType,
                                       CppCompoundType type = CppCompoundType::kUnknownCompound) const;
@@ -54,6 +78,32 @@ public:
                                            CppParamVector* params,
                                            unsigned int    attr) const;
   virtual CppTypeConverter* CreateTypeConverter(CppVarType* type, std::string name) const;
+
+protected:
+  explicit CppObjFactory(bool arenaBacked)
+    : arenaBacked_(arenaBacked)
+  {
+  }
+
+private:
+  const bool arenaBacked_;
+};
+
+/*!
+ * \brief Factory that creates objects in large slabs of memory instead of allocating each on the heap.
+ *
+ * Each thread allocates from its own slab, so one factory can be shared by parsers running concurrently.
+ * Memory of a page of slab goes back to the system when all objects in it are deleted and its thread has moved past it,
+ * and slab itself goes back to the heap when that has happened to all its pages.
+ * Objects are owned and deleted the usual way, deleting one just doesn't free its memory individually.
+ */
+class CppArenaObjFactory : public CppObjFactory
+{
+public:
+  CppArenaObjFactory()
+    : CppObjFactory(true)
+  {
+  }
 };
 
 using CppObjFactoryPtr = std::unique_ptr<CppObjFactory>;
@@ -25,16 +25,36 @@
 
 #include "cppobjfactory.h"
 
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <string_view>
 #include <utility>
+#include <vector>
+
+struct ParserConfig;
+struct ParseStats;
+class ParseStacks;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief A token as lexer hands it to parser, see CppParser::tokenize().
+ */
+struct CppLexToken
+{
+  /// Token code of the grammar, a single char token like ';' has the char as its code.
+  int      kind;
+  uint32_t offset;
+  uint32_t length;
+};
+
 /**
  * @brief Parses C++ source and generates an AST.
  *
- * @warning Although its a class it is not reentrant because underlying btyacc is not reentrant.
- * So, any change done through this class is global and affects the result of other instances too.
+ * Every instance has its own configuration and parse state, so different instances can parse concurrently.
+ * A single instance must not be used from more than one thread at a time.
+ * Parser stacks are kept between parses, so one instance parsing many files allocates them only once.
  */
 class CppParser
 {
@@ -44,10 +64,8 @@ public:
 
 public:
   CppParser(CppObjFactoryPtr objFactory = nullptr);
-  CppParser(CppParser&& rhs)
-    : objFactory_(std::move(rhs.objFactory_))
-  {
-  }
+  CppParser(CppParser&& rhs);
+  ~CppParser();
 
 public:
   void addKnownMacro(std::string knownMacro);
@@ -68,14 +86,109 @@ public:
 
   void parseEnumBodyAsBlob();
   void parseFunctionBodyAsBlob(bool asBlob);
+  /**
+   * @brief Makes parseFile() keep file content in the returned AST instead of copying parts of it.
+   *
+   * Blobs, asm blocks, macro definitions, and macro calls then refer to the content retained by the compound
+   * of the file, see CppCompound::retainedSource(). So, they must not outlive that compound.
+   */
+  void retainSourceBuffer(bool retain);
+  /**
+   * @brief Makes structurally identical types of variables and function parameters share one immutable instance.
+   *
+   * Equality of shared types is a pointer compare and AST needs less memory when many variables have the same type.
+   * CppVar replaces a shared type by its own copy before mutating it, see CppVar::mutableVarType().
+   * Shared types live till the process ends.
+   */
+  void shareVarTypes(bool share);
+  /**
+   * @brief Makes lexer skip every comment, so AST has no CppDocComment.
+   *
+   * Parsing is faster as block comments are skipped in one scan and brackets aren't tracked to find out
+   * which comments can be kept.
+   */
+  void ignoreComments(bool ignore);
 
 public:
+  /**
+   * @brief Parses a file without copying it, see CppSourceBuffer.
+   */
   CppCompoundPtr parseFile(const std::string& filename);
+  /**
+   * @brief Parses a writable buffer that ends with 2 null chars.
+   *
+   * Lexer temporarily writes into \a stm while parsing but puts back the original content.
+   */
   CppCompoundPtr parseStream(char* stm, size_t stmSize);
+  /**
+   * @brief Parses a copy of \a stm, so it needs neither be writable nor end with null chars.
+   */
+  CppCompoundPtr parseStream(std::string_view stm);
+
+  /**
+   * @brief Parses a single file using many threads.
+   *
+   * Source is split at top level declarations, including those directly inside an extern "C" block,
+   * and the pieces are parsed concurrently. Members of all pieces are put in one compound of type kCppFile
+   * in the same order as they are in the source.
+   * A piece that can't be parsed on its own is parsed again together with its neighbours.
+   * If that fails too the whole file is parsed serially, so errors are reported the same way as by parseFile().
+   *
+   * @param numThreads Number of threads, 0 means one per hardware thread.
+   */
+  CppCompoundPtr parseFileInParallel(const std::string& filename, size_t numThreads = 0);
+  CppCompoundPtr parseStreamInParallel(const char* stm, size_t stmSize, size_t numThreads = 0);
+
+  /**
+   * @brief Parses files in a pool of forked worker processes.
+   *
+   * A worker that crashes, or exceeds workerMemoryLimit, loses only the file it was parsing and is replaced by a new one.
+   * Memory used by workers goes back to the OS when they exit.
+   * ASTs are sent back to this process in a compact binary form and rebuilt using the object factory of this parser.
+   * On platforms without fork() files are parsed in the calling process.
+   *
+   * @param numProcesses Number of worker processes, 0 means one per hardware thread.
+   * @param workerMemoryLimit Maximum address space in bytes of a worker process, 0 means no limit.
+   * @return ASTs in the same order as files, nullptr for the files that could not be parsed.
+   */
+  std::vector<CppCompoundPtr> parseFilesInWorkerProcesses(const std::vector<std::string>& files,
+                                                          size_t                          numProcesses      = 0,
+                                                          size_t                          workerMemoryLimit = 0);
+
+  /**
+   * @brief Runs only the lexer, so its cost can be measured apart from that of the parser.
+   *
+   * Configuration of this parser is used in the same way as by parseStream(). Comments, and blobs like
+   * function bodies when they are parsed as blob, are single tokens. A line comment that starts a line
+   * inside a block comment is a token too, and comes before the token of the block comment that encloses it.
+   * Unlike parsing, lexing goes on past code that parser would reject, e.g. an unmatched '}'.
+   * @param stm Writable buffer that ends with 2 null chars, it is left unmodified.
+   */
+  std::vector<CppLexToken> tokenize(char* stm, size_t stmSize);
 
   void setErrorHandler(ErrorHandler errorHandler);
   void resetErrorHandler();
 
+  /**
+   * @brief Size of AST nodes that parses done by this parser built but could not use.
+   *
+   * A failed parse, including that of a chunk by parseFileInParallel(), deletes the nodes it has built so far.
+   */
+  size_t numBytesReclaimed() const;
+
+  /**
+   * @brief Counters of backtracking done by parses of this parser.
+   *
+   * Grammar conflicts are resolved by trial parses, a failed trial backtracks and reads its tokens again.
+   * Bytes copied are those of parser stacks that were saved before a trial and restored after it.
+   */
+  size_t numTrialParses() const;
+  size_t numTokensReplayed() const;
+  size_t numBytesCopiedForTrials() const;
+
 private:
-  CppObjFactoryPtr objFactory_;
+  CppObjFactoryPtr              objFactory_;
+  std::unique_ptr<ParserConfig> config_;
+  std::unique_ptr<ParseStats>   stats_;
+  std::unique_ptr<ParseStacks>  stacks_;
 };
@@ -51,6 +51,12 @@ inline bool selectHeadersOnly(const std::string& file)
 
 using CppCompoundArray    = std::vector<CppCompoundPtr>;
 using CppProgFileSelecter = std::function<bool(const std::string&)>;
+using CppParserFactory    = std::function<CppParser()>;
+
+inline CppParser constructDefaultCppParser()
+{
+  return CppParser();
+}
 
 /**
  * \brief Represents an entire C++ program.
@@ -62,6 +68,18 @@ public:
              CppParser                  parser       = CppParser(),
              const CppProgFileSelecter& fileSelector = selectHeadersOnly);
   CppProgram(const std::vector<std::string>& files, CppParser parser = CppParser());
+  /**
+   * Parses files concurrently, every thread uses its own parser created by \a parserFactory.
+   * Larger files are parsed first and the resulting program is identical to the one built by parsing files serially.
+   * @param numThreads Number of threads to use, 0 means as many as the hardware supports.
+   */
+  CppProgram(const std::string&         folder,
+             size_t                     numThreads,
+             const CppParserFactory&    parserFactory = constructDefaultCppParser,
+             const CppProgFileSelecter& fileSelector  = selectHeadersOnly);
+  CppProgram(const std::vector<std::string>& files,
+             size_t                          numThreads,
+             const CppParserFactory&         parserFactory = constructDefaultCppParser);
 
 public:
   /**
@@ -98,6 +116,10 @@ public:
    * @return An array of CppCompound each element of which represents AST of a C++ file.
    */
   const CppCompoundArray& getFileAsts() const;
+  /**
+   * @return Memory used by AST of every file along with size of the file.
+   */
+  CppProgramMemoryReport memoryReport() const;
 
 public:
   /**
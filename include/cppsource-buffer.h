@@ -0,0 +1,104 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/**
+ * Content of a source file in the form the lexer needs, i.e. followed by a new line and 2 null chars.
+ *
+ * On POSIX systems the file is memory mapped, so buffers retained by ASTs are backed by the page cache
+ * instead of private copies. Elsewhere the file is read in memory.
+ * \warning A mapped file must not be modified or truncated while its buffer is alive.
+ * \see CppParser::retainSourceBuffer()
+ */
+class CppSourceBuffer
+{
+public:
+  /**
+   * @return nullptr if the file can't be opened.
+   */
+  static std::unique_ptr<CppSourceBuffer> fromFile(const std::string& filename);
+  static std::unique_ptr<CppSourceBuffer> fromText(std::string_view text);
+
+  ~CppSourceBuffer();
+
+  CppSourceBuffer(const CppSourceBuffer&) = delete;
+  CppSourceBuffer& operator=(const CppSourceBuffer&) = delete;
+
+public:
+  std::string_view text() const
+  {
+    return std::string_view(data_, size_);
+  }
+  const char* data() const
+  {
+    return data_;
+  }
+  size_t size() const
+  {
+    return size_;
+  }
+  bool isMapped() const
+  {
+    return mappedSize_ != 0;
+  }
+
+private:
+  friend class CppParser;
+
+  CppSourceBuffer() = default;
+
+  static std::unique_ptr<CppSourceBuffer> allocate(size_t size);
+  static std::unique_ptr<CppSourceBuffer> readFile(const std::string& filename);
+
+  void terminate();
+
+  /**
+   * Flex stores '\0' after every token it matches and puts the original char back before matching the next one.
+   * So, lexer needs a writable buffer but leaves its content unchanged at the end of parse.
+   */
+  char* lexerBuffer() const
+  {
+    return data_;
+  }
+  size_t lexerBufferSize() const
+  {
+    return size_ + 3;
+  }
+
+  /**
+   * Drops private copies of mapped pages that lexer has written, so they are shared with page cache again.
+   */
+  void releaseWrittenPages();
+
+private:
+  char*                   data_ {nullptr};
+  size_t                  size_ {0};
+  size_t                  mappedSize_ {0};
+  std::unique_ptr<char[]> ownedData_;
+};
@@ -0,0 +1,134 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+/**
+ * Text copied verbatim from source, e.g. blob, asm block, or macro definition.
+ *
+ * It either owns the text or refers to the source buffer retained by the AST of the file.
+ * \see CppParser::retainSourceBuffer()
+ */
+class CppSourceText
+{
+public:
+  CppSourceText(std::string text = std::string())
+    : text_(std::move(text))
+  {
+  }
+  CppSourceText(const char* text)
+    : text_(std::string(text))
+  {
+  }
+
+  /**
+   * @return Text that refers to \a text instead of owning a copy of it.
+   * \warning Memory \a text points to must outlive the returned object.
+   */
+  static CppSourceText referTo(std::string_view text)
+  {
+    CppSourceText ret;
+    ret.text_ = text;
+    return ret;
+  }
+
+  bool refersToSource() const
+  {
+    return std::holds_alternative<std::string_view>(text_);
+  }
+
+  std::string_view view() const
+  {
+    if (refersToSource())
+      return std::get<std::string_view>(text_);
+    return std::get<std::string>(text_);
+  }
+  /**
+   * Shrinks the text to \a part, which must be a part of view().
+   */
+  void narrow(std::string_view part)
+  {
+    if (refersToSource())
+    {
+      text_ = part;
+    }
+    else
+    {
+      auto&      text  = std::get<std::string>(text_);
+      const auto start = static_cast<size_t>(part.data() - text.data());
+      text.resize(start + part.size());
+      text.erase(0, start);
+    }
+  }
+
+  std::string str() const
+  {
+    return std::string(view());
+  }
+  operator std::string() const
+  {
+    return str();
+  }
+
+  bool empty() const
+  {
+    return view().empty();
+  }
+  size_t size() const
+  {
+    return view().size();
+  }
+  std::string_view::const_iterator begin() const
+  {
+    return view().begin();
+  }
+  std::string_view::const_iterator end() const
+  {
+    return view().end();
+  }
+
+private:
+  friend class CppAstMemoryCounter;
+
+  std::variant<std::string, std::string_view> text_;
+};
+
+inline bool operator==(const CppSourceText& lhs, std::string_view rhs)
+{
+  return lhs.view() == rhs;
+}
+inline bool operator!=(const CppSourceText& lhs, std::string_view rhs)
+{
+  return lhs.view() != rhs;
+}
+
+inline std::ostream& operator<<(std::ostream& stm, const CppSourceText& text)
+{
+  return stm << text.view();
+}
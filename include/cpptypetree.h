@@ -25,8 +25,11 @@
 
 #include "cppast.h"
 
-#include <map>
+#include <algorithm>
 #include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 struct CppTypeTreeNode;
 /**
@@ -36,9 +39,11 @@ struct CppTypeTreeNode;
  * The root of the tree is the global namespace which contains other compound objects like namespace, class, struct,
  * etc. And each of those compound object can form another branch of tree.
  *
+ * Children are keyed by interned identifiers and so finding one hashes a pointer instead of comparing strings.
  * \note This tree has no relation with inheritance hierarchy.
+ * \note Order of iterating a CppTypeTree is unspecified, CppTypeTreeNode::sortedChildren() orders them by name.
  */
-using CppTypeTree = std::map<std::string, CppTypeTreeNode>;
+using CppTypeTree = std::unordered_map<CppIdentifier, CppTypeTreeNode>;
 
 struct CppObjSetCmp
 {
@@ -84,6 +89,19 @@ struct CppTypeTreeNode
     return false;
   }
 
+  /**
+   * @return Children ordered by their names, for where order of visiting them matters.
+   */
+  std::vector<const CppTypeTree::value_type*> sortedChildren() const
+  {
+    std::vector<const CppTypeTree::value_type*> sorted;
+    sorted.reserve(children.size());
+    for (const auto& child : children)
+      sorted.push_back(&child);
+    std::sort(sorted.begin(), sorted.end(), [](const auto* lhs, const auto* rhs) { return lhs->first < rhs->first; });
+    return sorted;
+  }
+
   const CppObj* getObjInSet(CppObjType objType) const
   {
     for (const auto obj : cppObjSet)
@@ -33,7 +33,7 @@ inline std::uint8_t ptrLevel(const CppVarType* varType)
   return varType->typeModifier().ptrLevel_;
 }
 
-inline std::uint8_t ptrLevel(const std::unique_ptr<CppVarType>& varType)
+inline std::uint8_t ptrLevel(const CppVarTypePtr& varType)
 {
   return varType->typeModifier().ptrLevel_;
 }
@@ -53,7 +53,7 @@ inline CppRefType refType(const CppVarType* varType)
   return varType->typeModifier().refType_;
 }
 
-inline CppRefType refType(const std::unique_ptr<CppVarType>& varType)
+inline CppRefType refType(const CppVarTypePtr& varType)
 {
   return varType->typeModifier().refType_;
 }
@@ -88,7 +88,7 @@ inline const std::string& baseType(const CppVarType* varType)
   return varType->baseType();
 }
 
-inline const std::string& baseType(const std::unique_ptr<CppVarType>& varType)
+inline const std::string& baseType(const CppVarTypePtr& varType)
 {
   return varType->baseType();
 }
@@ -124,7 +124,7 @@ inline bool isVoid(const CppVarType* varType)
   return (strncmp(varType->baseType().c_str() + varType->baseType().length() - 4, "void", 4) == 0);
 }
 
-inline bool isVoid(const std::unique_ptr<CppVarType>& varType)
+inline bool isVoid(const CppVarTypePtr& varType)
 {
   return isVoid(varType.get());
 }
@@ -134,7 +134,7 @@ inline bool isByRef(const CppVarType* varType)
   return varType->typeModifier().refType_ == CppRefType::kByRef;
 }
 
-inline bool isByRef(const std::unique_ptr<CppVarType>& varType)
+inline bool isByRef(const CppVarTypePtr& varType)
 {
   return isByRef(varType.get());
 }
@@ -154,7 +154,7 @@ inline bool isByRValueRef(const CppVarType* varType)
   return varType->typeModifier().refType_ == CppRefType::kRValRef;
 }
 
-inline bool isByRValueRef(const std::unique_ptr<CppVarType>& varType)
+inline bool isByRValueRef(const CppVarTypePtr& varType)
 {
   return isByRValueRef(varType.get());
 }
@@ -174,7 +174,7 @@ inline bool isConst(const CppVarType* varType)
   return ((varType->typeAttr() & kConst) == kConst) || (varType->typeModifier().constBits_ & 1);
 }
 
-inline bool isConst(const std::unique_ptr<CppVarType>& varType)
+inline bool isConst(const CppVarTypePtr& varType)
 {
   return isConst(varType.get());
 }
@@ -195,7 +195,7 @@ inline bool isByValue(const CppVarType* varType)
          && (varType->typeModifier().ptrLevel_ == 0);
 }
 
-inline bool isByValue(const std::unique_ptr<CppVarType>& varType)
+inline bool isByValue(const CppVarTypePtr& varType)
 {
   return isByValue(varType.get());
 }
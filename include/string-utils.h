@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <cstring>
 #include <string>
+#include <string_view>
 
 inline size_t stripChar(char* s, size_t len, char c)
 {
@@ -39,7 +40,10 @@ inline void stripChar(std::string& s, char c)
   s.resize(len);
 }
 
-inline std::string& trimBlob(std::string& s)
+/**
+ * @return \a s without trailing white spaces and without leading lines that have only white spaces.
+ */
+inline std::string_view trimBlob(std::string_view s)
 {
   auto len = s.size();
 
@@ -48,7 +52,7 @@ inline std::string& trimBlob(std::string& s)
     if (!isspace(s[len - 1]))
       break;
   }
-  s.resize(len);
+  s = s.substr(0, len);
 
   size_t start = 0;
   for (size_t i = 0; i < s.size(); ++i)
@@ -59,8 +63,16 @@ inline std::string& trimBlob(std::string& s)
       start = i + 1;
   }
 
-  if (start > 0)
-    s = s.substr(start);
+  return s.substr(start);
+}
+
+inline std::string& trimBlob(std::string& s)
+{
+  const auto trimmed = trimBlob(std::string_view(s));
+  const auto start   = static_cast<size_t>(trimmed.data() - s.data());
+  s.resize(start + trimmed.size());
+  s.erase(0, start);
+
   return s;
 }
 
@@ -0,0 +1,95 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "cppast.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Every AST node type with the size in bytes it is not allowed to grow beyond.
+ * Budgets are for 64 bit targets where std::string takes 32 bytes or less, cppast.cpp static_asserts them there.
+ */
+#define CPPPARSER_AST_NODE_SIZE_BUDGETS(X) \
+  X(CppBlob, 64)                           \
+  X(CppDefine, 104)                        \
+  X(CppUndef, 56)                          \
+  X(CppInclude, 56)                        \
+  X(CppImport, 56)                         \
+  X(CppHashIf, 64)                         \
+  X(CppPragma, 56)                         \
+  X(CppHashError, 56)                      \
+  X(CppHashWarning, 56)                    \
+  X(CppUnRecogPrePro, 88)                  \
+  X(CppVarType, 72)                        \
+  X(CppVar, 96)                            \
+  X(CppVarList, 56)                        \
+  X(CppTypedefName, 32)                    \
+  X(CppTypedefList, 32)                    \
+  X(CppMacroCall, 64)                      \
+  X(CppFwdClsDecl, 112)                    \
+  X(CppCompound, 96)                       \
+  X(CppFunction, 72)                       \
+  X(CppLambda, 72)                         \
+  X(CppFunctionPointer, 104)               \
+  X(CppConstructor, 88)                    \
+  X(CppDestructor, 56)                     \
+  X(CppTypeConverter, 64)                  \
+  X(CppUsingNamespaceDecl, 56)             \
+  X(CppUsingDecl, 72)                      \
+  X(CppNamespaceAlias, 88)                 \
+  X(CppDocComment, 56)                     \
+  X(CppExpr, 104)                          \
+  X(CppEnum, 104)                          \
+  X(CppIfBlock, 48)                        \
+  X(CppWhileBlock, 40)                     \
+  X(CppDoWhileBlock, 40)                   \
+  X(CppForBlock, 56)                       \
+  X(CppRangeForBlock, 48)                  \
+  X(CppSwitchBlock, 40)                    \
+  X(CppCatchBlock, 48)                     \
+  X(CppTryBlock, 56)                       \
+  X(CppAsmBlock, 64)                       \
+  X(CppLabel, 56)
+
+constexpr bool kAstNodeSizeBudgetsApply = (sizeof(void*) == 8) && (sizeof(std::string) <= 32);
+
+struct AstNodeSize
+{
+  const char* typeName;
+  size_t      size;
+  size_t      budget;
+};
+
+/**
+ * @return Size and size budget of every AST node type.
+ */
+inline std::vector<AstNodeSize> astNodeSizes()
+{
+#define CPPPARSER_AST_NODE_SIZE(type, budget) AstNodeSize {#type, sizeof(type), budget},
+  return {CPPPARSER_AST_NODE_SIZE_BUDGETS(CPPPARSER_AST_NODE_SIZE)};
+#undef CPPPARSER_AST_NODE_SIZE
+}
@@ -0,0 +1,1314 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ast-serializer.h"
+#include "cppobjfactory.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Bumped whenever the encoding changes.
+constexpr std::uint64_t kFormatVersion = 2;
+
+/**
+ * Every object starts with its CppObjType, its CppAccessType, and the number of its child objects, nullptr is encoded
+ * as CppObjType::kUnknown. Children follow and then the fields of the object itself, so that reader can create an
+ * object from its fields once it has created its children.
+ * Optional lists are encoded as 0 when absent and as 1 + number of items otherwise.
+ */
+class AstWriter
+{
+public:
+  std::string& buffer()
+  {
+    return buf_;
+  }
+
+  void writeUInt(std::uint64_t val)
+  {
+    if (children_)
+      return;
+    for (; val >= 0x80; val >>= 7)
+      buf_.push_back(static_cast<char>((val & 0x7f) | 0x80));
+    buf_.push_back(static_cast<char>(val));
+  }
+
+  void writeBool(bool val)
+  {
+    writeUInt(val ? 1 : 0);
+  }
+
+  template <typename T>
+  void writeEnum(T val)
+  {
+    writeUInt(static_cast<std::uint64_t>(val));
+  }
+
+  // First occurrence of a string is written as 0, length, and text. Later ones refer to it as 1 + its index.
+  void writeStr(const std::string& str)
+  {
+    if (children_)
+      return;
+    const auto itr = strIndices_.find(str);
+    if (itr != strIndices_.end())
+    {
+      writeUInt(itr->second + 1);
+      return;
+    }
+    writeUInt(0);
+    writeUInt(str.size());
+    buf_.append(str);
+    strIndices_.emplace(str, strIndices_.size());
+  }
+
+  /**
+   * Writes \a obj and all objects in it, those yet to be written are kept on an explicit stack.
+   */
+  void writeObj(const CppObj* obj);
+
+private:
+  // Child objects are only collected while children_ is set, and are skipped while fields are written.
+  void writeChild(const CppObj* obj)
+  {
+    if (children_)
+      children_->push_back(obj);
+  }
+
+  void collectChildren(const CppObj* obj, std::vector<const CppObj*>& children)
+  {
+    children_ = &children;
+    writeFields(obj);
+    children_ = nullptr;
+  }
+
+  void writeFields(const CppObj* obj);
+
+  void writeTypeModifier(const CppTypeModifier& modifier)
+  {
+    writeEnum(modifier.refType_);
+    writeUInt(modifier.ptrLevel_);
+    writeUInt(modifier.constBits_);
+  }
+
+  void writeAttribSpecifiers(const AttribSpecified& attribSpecified)
+  {
+    const auto& attribSpecifiers = attribSpecified.attribSpecifierSequence();
+    if (!attribSpecifiers)
+      return writeUInt(0);
+    writeUInt(attribSpecifiers->size() + 1);
+    for (const auto& attribSpecifier : *attribSpecifiers)
+      writeChild(attribSpecifier.get());
+  }
+
+  void writeTemplateParamList(const CppTemplateParamList* templParamList)
+  {
+    if (!templParamList)
+      return writeUInt(0);
+    writeUInt(templParamList->size() + 1);
+    for (const auto& templParam : *templParamList)
+    {
+      writeChild(templParam.paramType_.get());
+      writeStr(templParam.paramName_);
+      writeChild(templParam.defaultArg());
+    }
+  }
+
+  void writeVarDecl(const CppVarDecl& varDecl)
+  {
+    writeStr(varDecl.name());
+    writeChild(varDecl.assignValue());
+    writeEnum(varDecl.assignType());
+    writeChild(varDecl.bitField());
+    writeUInt(varDecl.arraySizes().size());
+    for (const auto& arraySize : varDecl.arraySizes())
+      writeChild(arraySize.get());
+  }
+
+  void writeParams(const CppParamVector* params)
+  {
+    if (!params)
+      return writeUInt(0);
+    writeUInt(params->size() + 1);
+    for (const auto& param : *params)
+      writeChild(param.get());
+  }
+
+  void writeFuncLikeBase(const CppFuncLikeBase* func)
+  {
+    const auto* throwSpec = func->throwSpec();
+    if (!throwSpec)
+    {
+      writeUInt(0);
+    }
+    else
+    {
+      writeUInt(throwSpec->size() + 1);
+      for (const auto& exceptionName : *throwSpec)
+        writeStr(exceptionName);
+    }
+    writeChild(func->defn());
+  }
+
+  void writeFunctionBase(const CppFunctionBase* func)
+  {
+    writeStr(func->name_);
+    writeUInt(func->attr());
+    writeStr(func->decor1());
+    writeStr(func->decor2());
+    writeTemplateParamList(func->templateParamList());
+    writeFuncLikeBase(func);
+  }
+
+  void writeExprAtom(const CppExprAtom& atom)
+  {
+    writeEnum(atom.type);
+    switch (atom.type)
+    {
+      case CppExprAtom::kAtom:
+        writeStr(std::string(atom.atom()));
+        break;
+      case CppExprAtom::kExpr:
+        writeChild(atom.expr);
+        break;
+      case CppExprAtom::kLambda:
+        writeChild(atom.lambda);
+        break;
+      case CppExprAtom::kVarType:
+        writeChild(atom.varType);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  void writeCompound(const CppCompound* compound);
+
+private:
+  std::string                             buf_;
+  std::unordered_map<std::string, size_t> strIndices_;
+  std::vector<const CppObj*>*             children_ {nullptr};
+};
+
+void AstWriter::writeCompound(const CppCompound* compound)
+{
+  writeStr(compound->name());
+  writeEnum(compound->compoundType());
+  const auto& inheritanceList = compound->inheritanceList();
+  if (!inheritanceList)
+  {
+    writeUInt(0);
+  }
+  else
+  {
+    writeUInt(inheritanceList->size() + 1);
+    for (const auto& inheritInfo : *inheritanceList)
+    {
+      writeStr(inheritInfo.baseName);
+      writeEnum(inheritInfo.inhType);
+      writeBool(inheritInfo.isVirtual);
+    }
+  }
+  writeStr(compound->apidecor());
+  writeTemplateParamList(compound->templateParamList());
+  writeUInt(compound->attr());
+  writeAttribSpecifiers(*compound);
+  writeUInt(compound->members().size());
+  for (const auto& mem : compound->members())
+    writeChild(mem.get());
+}
+
+void AstWriter::writeObj(const CppObj* obj)
+{
+  // Objects whose children are being written, with their children and index of the next one to write.
+  struct PendingObj
+  {
+    const CppObj*              obj;
+    std::vector<const CppObj*> children;
+    size_t                     nextChild;
+  };
+  std::vector<PendingObj> pendingObjs;
+
+  const auto startObj = [&](const CppObj* obj) {
+    if (!obj)
+      return writeEnum(CppObjType::kUnknown);
+    pendingObjs.push_back({obj, {}, 0});
+    collectChildren(obj, pendingObjs.back().children);
+    writeEnum(obj->objType_);
+    writeEnum(obj->accessType_);
+    writeUInt(pendingObjs.back().children.size());
+  };
+
+  startObj(obj);
+  while (!pendingObjs.empty())
+  {
+    auto& pendingObj = pendingObjs.back();
+    if (pendingObj.nextChild < pendingObj.children.size())
+    {
+      startObj(pendingObj.children[pendingObj.nextChild++]);
+      continue;
+    }
+    writeFields(pendingObj.obj);
+    pendingObjs.pop_back();
+  }
+}
+
+void AstWriter::writeFields(const CppObj* obj)
+{
+  switch (obj->objType_)
+  {
+    case CppObjType::kDocComment:
+      writeStr(static_cast<const CppDocComment*>(obj)->doc_);
+      break;
+    case CppObjType::kHashIf:
+    {
+      const auto* hashIf = static_cast<const CppHashIf*>(obj);
+      writeEnum(hashIf->condType_);
+      writeStr(hashIf->cond_);
+    }
+    break;
+    case CppObjType::kHashInclude:
+      writeStr(static_cast<const CppInclude*>(obj)->name_);
+      break;
+    case CppObjType::kHashImport:
+      writeStr(static_cast<const CppImport*>(obj)->name_);
+      break;
+    case CppObjType::kHashDefine:
+    {
+      const auto* hashDefine = static_cast<const CppDefine*>(obj);
+      writeEnum(hashDefine->defType_);
+      writeStr(hashDefine->name_);
+      writeStr(hashDefine->defn_);
+    }
+    break;
+    case CppObjType::kHashUndef:
+      writeStr(static_cast<const CppUndef*>(obj)->name_);
+      break;
+    case CppObjType::kHashPragma:
+      writeStr(static_cast<const CppPragma*>(obj)->defn_);
+      break;
+    case CppObjType::kHashError:
+      writeStr(static_cast<const CppHashError*>(obj)->err_);
+      break;
+    case CppObjType::kHashWarning:
+      writeStr(static_cast<const CppHashWarning*>(obj)->err_);
+      break;
+    case CppObjType::kUnRecogPrePro:
+    {
+      const auto* unRecogPrePro = static_cast<const CppUnRecogPrePro*>(obj);
+      writeStr(unRecogPrePro->name_);
+      writeStr(unRecogPrePro->defn_);
+    }
+    break;
+    case CppObjType::kVarType:
+    {
+      const auto* varType = static_cast<const CppVarType*>(obj);
+      writeStr(varType->baseType());
+      writeChild(varType->compound());
+      writeTypeModifier(varType->typeModifier());
+      writeUInt(varType->typeAttr());
+      writeBool(varType->paramPack_);
+      writeAttribSpecifiers(*varType);
+    }
+    break;
+    case CppObjType::kVar:
+    {
+      const auto* var = static_cast<const CppVar*>(obj);
+      writeChild(var->varType());
+      writeVarDecl(var->varDecl());
+      writeStr(var->apidecor());
+      writeTemplateParamList(var->templateParamList());
+    }
+    break;
+    case CppObjType::kVarList:
+    {
+      const auto* varList = static_cast<const CppVarList*>(obj);
+      writeChild(varList->firstVar().get());
+      writeUInt(varList->varDeclList().size());
+      for (const auto& varDecl : varList->varDeclList())
+      {
+        writeTypeModifier(varDecl);
+        writeVarDecl(varDecl);
+      }
+    }
+    break;
+    case CppObjType::kTypedefName:
+      writeChild(static_cast<const CppTypedefName*>(obj)->var_.get());
+      break;
+    case CppObjType::kTypedefNameList:
+      writeChild(static_cast<const CppTypedefList*>(obj)->varList_.get());
+      break;
+    case CppObjType::kNamespaceAlias:
+    {
+      const auto* namespaceAlias = static_cast<const CppNamespaceAlias*>(obj);
+      writeStr(namespaceAlias->name_);
+      writeStr(namespaceAlias->alias_);
+    }
+    break;
+    case CppObjType::kUsingNamespaceDecl:
+      writeStr(static_cast<const CppUsingNamespaceDecl*>(obj)->name_);
+      break;
+    case CppObjType::kUsingDecl:
+    {
+      const auto* usingDecl = static_cast<const CppUsingDecl*>(obj);
+      writeStr(usingDecl->name_);
+      writeChild(usingDecl->cppObj_.get());
+      writeTemplateParamList(usingDecl->templateParamList());
+    }
+    break;
+    case CppObjType::kEnum:
+    {
+      const auto* enumObj = static_cast<const CppEnum*>(obj);
+      writeStr(enumObj->name_);
+      if (!enumObj->itemList_)
+      {
+        writeUInt(0);
+      }
+      else
+      {
+        writeUInt(enumObj->itemList_->size() + 1);
+        for (const auto& enumItem : *(enumObj->itemList_))
+        {
+          writeStr(enumItem.name_);
+          writeChild(enumItem.val_.get());
+        }
+      }
+      writeBool(enumObj->isClass_);
+      writeStr(enumObj->underlyingType_);
+    }
+    break;
+    case CppObjType::kCompound:
+      writeCompound(static_cast<const CppCompound*>(obj));
+      break;
+    case CppObjType::kFwdClsDecl:
+    {
+      const auto* fwdClsDecl = static_cast<const CppFwdClsDecl*>(obj);
+      writeEnum(fwdClsDecl->cmpType_);
+      writeStr(fwdClsDecl->name_);
+      writeStr(fwdClsDecl->apidecor_);
+      writeUInt(fwdClsDecl->attr());
+      writeTemplateParamList(fwdClsDecl->templateParamList());
+    }
+    break;
+    case CppObjType::kFunction:
+    case CppObjType::kFunctionPtr:
+    {
+      const auto* func = static_cast<const CppFunction*>(obj);
+      writeFunctionBase(func);
+      writeParams(func->params());
+      writeChild(func->retType_.get());
+      if (obj->objType_ == CppObjType::kFunctionPtr)
+        writeStr(static_cast<const CppFunctionPointer*>(obj)->ownerName_);
+    }
+    break;
+    case CppObjType::kLambda:
+    {
+      const auto* lambda = static_cast<const CppLambda*>(obj);
+      writeChild(lambda->captures_.get());
+      writeParams(lambda->params_.get());
+      writeChild(lambda->retType_.get());
+      writeChild(lambda->defn_.get());
+      writeFuncLikeBase(lambda);
+    }
+    break;
+    case CppObjType::kConstructor:
+    {
+      const auto* ctor = static_cast<const CppConstructor*>(obj);
+      writeFunctionBase(ctor);
+      writeParams(ctor->params());
+      writeBool(ctor->memInits_.memInitListIsABlob_);
+      if (ctor->memInits_.memInitListIsABlob_)
+      {
+        writeChild(ctor->memInits_.blob);
+      }
+      else if (!ctor->memInits_.memInitList)
+      {
+        writeUInt(0);
+      }
+      else
+      {
+        writeUInt(ctor->memInits_.memInitList->size() + 1);
+        for (const auto& memInit : *(ctor->memInits_.memInitList))
+        {
+          writeStr(memInit.first);
+          writeChild(memInit.second);
+        }
+      }
+    }
+    break;
+    case CppObjType::kDestructor:
+      writeFunctionBase(static_cast<const CppDestructor*>(obj));
+      break;
+    case CppObjType::kTypeConverter:
+    {
+      const auto* typeConverter = static_cast<const CppTypeConverter*>(obj);
+      writeChild(typeConverter->to_.get());
+      writeFunctionBase(typeConverter);
+    }
+    break;
+    case CppObjType::kExpression:
+    {
+      const auto* expr = static_cast<const CppExpr*>(obj);
+      writeExprAtom(expr->expr1_);
+      writeExprAtom(expr->expr2_);
+      writeExprAtom(expr->expr3_);
+      writeEnum(expr->oper_);
+      writeUInt(static_cast<std::uint16_t>(expr->flags_));
+    }
+    break;
+    case CppObjType::kMacroCall:
+      writeStr(static_cast<const CppMacroCall*>(obj)->macroCall_);
+      break;
+    case CppObjType::kAsmBlock:
+      writeStr(static_cast<const CppAsmBlock*>(obj)->asm_);
+      break;
+    case CppObjType::kBlob:
+      writeStr(static_cast<const CppBlob*>(obj)->blob_);
+      break;
+    case CppObjType::kLabel:
+      writeStr(static_cast<const CppLabel*>(obj)->label_);
+      break;
+    case CppObjType::kIfBlock:
+    {
+      const auto* ifBlock = static_cast<const CppIfBlock*>(obj);
+      writeChild(ifBlock->cond_.get());
+      writeChild(ifBlock->body_.get());
+      writeChild(ifBlock->elsePart());
+    }
+    break;
+    case CppObjType::kWhileBlock:
+    {
+      const auto* whileBlock = static_cast<const CppWhileBlock*>(obj);
+      writeChild(whileBlock->cond_.get());
+      writeChild(whileBlock->body_.get());
+    }
+    break;
+    case CppObjType::kDoWhileBlock:
+    {
+      const auto* doWhileBlock = static_cast<const CppDoWhileBlock*>(obj);
+      writeChild(doWhileBlock->cond_.get());
+      writeChild(doWhileBlock->body_.get());
+    }
+    break;
+    case CppObjType::kForBlock:
+    {
+      const auto* forBlock = static_cast<const CppForBlock*>(obj);
+      writeChild(forBlock->start_.get());
+      writeChild(forBlock->stop_.get());
+      writeChild(forBlock->step_.get());
+      writeChild(forBlock->body_.get());
+    }
+    break;
+    case CppObjType::kRangeForBlock:
+    {
+      const auto* rangeForBlock = static_cast<const CppRangeForBlock*>(obj);
+      writeChild(rangeForBlock->var_.get());
+      writeChild(rangeForBlock->expr_.get());
+      writeChild(rangeForBlock->body_.get());
+    }
+    break;
+    case CppObjType::kSwitchBlock:
+    {
+      const auto* switchBlock = static_cast<const CppSwitchBlock*>(obj);
+      writeChild(switchBlock->cond_.get());
+      if (!switchBlock->body_)
+      {
+        writeUInt(0);
+      }
+      else
+      {
+        writeUInt(switchBlock->body_->size() + 1);
+        for (const auto& caseStmt : *(switchBlock->body_))
+        {
+          writeChild(caseStmt.case_.get());
+          writeChild(caseStmt.body_.get());
+        }
+      }
+    }
+    break;
+    case CppObjType::kTryBlock:
+    {
+      const auto* tryBlock = static_cast<const CppTryBlock*>(obj);
+      writeChild(tryBlock->tryStmt_.get());
+      writeUInt(tryBlock->catchBlocks().size());
+      for (const auto& catchBlock : tryBlock->catchBlocks())
+      {
+        writeChild(catchBlock->exceptionType_.get());
+        writeStr(catchBlock->exceptionName_);
+        writeChild(catchBlock->catchStmt_.get());
+      }
+    }
+    break;
+
+    default:
+      assert(false && "Object of this type is never created by parser.");
+      break;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+/**
+ * Decodes what AstWriter encodes.
+ * Any inconsistency in the data marks the reader as failed, after which every read returns an empty value.
+ */
+class AstReader
+{
+public:
+  AstReader(const char* data, size_t size, const CppObjFactory& objFactory)
+    : cur_(data)
+    , end_(data + size)
+    , objFactory_(objFactory)
+  {
+  }
+
+  bool failed() const
+  {
+    return failed_;
+  }
+  std::nullptr_t fail()
+  {
+    failed_ = true;
+    return nullptr;
+  }
+  bool atEnd() const
+  {
+    return cur_ == end_;
+  }
+
+  std::uint64_t readUInt()
+  {
+    std::uint64_t val = 0;
+    for (unsigned shift = 0; (shift < 64) && (cur_ != end_); shift += 7)
+    {
+      const auto byte = static_cast<unsigned char>(*cur_++);
+      val |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+        return val;
+    }
+    fail();
+    return 0;
+  }
+
+  bool readBool()
+  {
+    return readUInt() != 0;
+  }
+
+  template <typename T>
+  T readEnum()
+  {
+    return static_cast<T>(readUInt());
+  }
+
+  std::string readStr()
+  {
+    const auto ref = readUInt();
+    if (ref != 0)
+    {
+      if (ref > strings_.size())
+        fail();
+      return failed_ ? std::string() : strings_[ref - 1];
+    }
+    const auto len = readUInt();
+    if (len > static_cast<size_t>(end_ - cur_))
+    {
+      fail();
+      return std::string();
+    }
+    strings_.emplace_back(cur_, len);
+    cur_ += len;
+    return strings_.back();
+  }
+
+  /**
+   * Reads an object and all objects in it, those yet to be created are kept on an explicit stack.
+   */
+  CppObj* readObj();
+
+  template <typename T>
+  T* readObjOf()
+  {
+    CppObjPtr obj(readObj());
+    if (obj && (obj->objType_ != T::kObjectType))
+      return fail();
+    return static_cast<T*>(obj.release());
+  }
+
+private:
+  // Object whose children are being read.
+  struct PendingObj
+  {
+    CppObjType             objType;
+    CppAccessType          accessType;
+    size_t                 numChildren;
+    std::vector<CppObjPtr> children;
+  };
+
+  // Children of the object being created are taken in the order they were written.
+  CppObj* takeChild()
+  {
+    if (failed_ || (nextChild_ == children_->size()))
+      return fail();
+    return (*children_)[nextChild_++].release();
+  }
+
+  template <typename T>
+  T* takeChildOf()
+  {
+    CppObjPtr obj(takeChild());
+    if (obj && (obj->objType_ != T::kObjectType))
+      return fail();
+    return static_cast<T*>(obj.release());
+  }
+
+  // Every item takes at least a byte or a child not yet taken, and so a count that is more than those is certainly
+  // corrupt.
+  size_t readCount()
+  {
+    const auto count        = readUInt();
+    const auto numRemaining = static_cast<size_t>(end_ - cur_) + (children_ ? children_->size() - nextChild_ : 0);
+    if (count > numRemaining)
+    {
+      fail();
+      return 0;
+    }
+    return count;
+  }
+
+  // Reads count of an optional list, returns false if the list is absent.
+  bool readOptionalCount(size_t& count)
+  {
+    count = readCount();
+    if (count == 0)
+      return false;
+    --count;
+    return true;
+  }
+
+  CppTypeModifier readTypeModifier()
+  {
+    const auto refType   = readEnum<CppRefType>();
+    const auto ptrLevel  = static_cast<std::uint8_t>(readUInt());
+    const auto constBits = static_cast<std::uint8_t>(readUInt());
+    return makeCppTypeModifier(refType, ptrLevel, constBits);
+  }
+
+  AttribSpecifierArray* readAttribSpecifiers()
+  {
+    size_t count = 0;
+    if (!readOptionalCount(count))
+      return nullptr;
+    auto* attribSpecifiers = new AttribSpecifierArray;
+    for (size_t i = 0; (i < count) && !failed_; ++i)
+      attribSpecifiers->emplace_back(takeChildOf<CppExpr>());
+    return attribSpecifiers;
+  }
+
+  CppTemplateParamList* readTemplateParamList()
+  {
+    size_t count = 0;
+    if (!readOptionalCount(count))
+      return nullptr;
+    auto* templParamList = new CppTemplateParamList;
+    for (size_t i = 0; (i < count) && !failed_; ++i)
+    {
+      CppObjPtr  paramType(takeChild());
+      const auto paramName = readStr();
+      auto*      defaultArg = takeChild();
+
+      if (!paramType)
+        templParamList->emplace_back(paramName);
+      else if (paramType->objType_ == CppVarType::kObjectType)
+        templParamList->emplace_back(static_cast<const CppVarType*>(paramType.release()), paramName);
+      else if (paramType->objType_ == CppFunctionPointer::kObjectType)
+        templParamList->emplace_back(static_cast<const CppFunctionPointer*>(paramType.release()), paramName);
+      else
+      {
+        delete defaultArg;
+        fail();
+        continue;
+      }
+
+      if (defaultArg)
+        templParamList->back().defaultArg(defaultArg);
+    }
+    return templParamList;
+  }
+
+  CppVarDecl readVarDecl()
+  {
+    const auto name        = readStr();
+    auto*      assignValue = takeChildOf<CppExpr>();
+    const auto assignType  = readEnum<AssignType>();
+    CppVarDecl varDecl(name, assignValue, assignType);
+    varDecl.bitField(takeChildOf<CppExpr>());
+    const auto numArraySizes = readCount();
+    for (size_t i = 0; (i < numArraySizes) && !failed_; ++i)
+      varDecl.addArraySize(takeChildOf<CppExpr>());
+    return varDecl;
+  }
+
+  CppParamVector* readParams()
+  {
+    size_t count = 0;
+    if (!readOptionalCount(count))
+      return nullptr;
+    auto* params = new CppParamVector;
+    for (size_t i = 0; (i < count) && !failed_; ++i)
+      params->emplace_back(takeChild());
+    return params;
+  }
+
+  struct FuncLikeBaseInfo
+  {
+    CppFuncThrowSpec* throwSpec {nullptr};
+    CppCompound*      defn {nullptr};
+  };
+
+  struct FunctionBaseInfo
+  {
+    std::string           name;
+    std::uint32_t         attr {0};
+    std::string           decor1;
+    std::string           decor2;
+    CppTemplateParamList* templParamList {nullptr};
+    FuncLikeBaseInfo      funcLikeBaseInfo;
+  };
+
+  FuncLikeBaseInfo readFuncLikeBase()
+  {
+    FuncLikeBaseInfo info;
+    size_t           count = 0;
+    if (readOptionalCount(count))
+    {
+      info.throwSpec = new CppFuncThrowSpec;
+      for (size_t i = 0; (i < count) && !failed_; ++i)
+        info.throwSpec->push_back(readStr());
+    }
+    info.defn = takeChildOf<CppCompound>();
+    return info;
+  }
+
+  FunctionBaseInfo readFunctionBase()
+  {
+    FunctionBaseInfo info;
+    info.name             = readStr();
+    info.attr             = static_cast<std::uint32_t>(readUInt());
+    info.decor1           = readStr();
+    info.decor2           = readStr();
+    info.templParamList   = readTemplateParamList();
+    info.funcLikeBaseInfo = readFuncLikeBase();
+    return info;
+  }
+
+  static void applyFuncLikeBase(CppFuncLikeBase* func, const FuncLikeBaseInfo& info)
+  {
+    func->throwSpec(info.throwSpec);
+    func->defn(info.defn);
+  }
+
+  static void applyFunctionBase(CppFunctionBase* func, FunctionBaseInfo& info)
+  {
+    func->decor1(std::move(info.decor1));
+    func->decor2(std::move(info.decor2));
+    func->templateParamList(info.templParamList);
+    applyFuncLikeBase(func, info.funcLikeBaseInfo);
+  }
+
+  CppExprAtom readExprAtom()
+  {
+    switch (readUInt())
+    {
+      case CppExprAtom::kAtom:
+        return CppExprAtom(readStr());
+      case CppExprAtom::kExpr:
+        return CppExprAtom(takeChildOf<CppExpr>());
+      case CppExprAtom::kLambda:
+        return CppExprAtom(takeChildOf<CppLambda>());
+      case CppExprAtom::kVarType:
+        return CppExprAtom(takeChildOf<CppVarType>());
+
+      default:
+        return CppExprAtom();
+    }
+  }
+
+  CppObj* readVarType(CppAccessType accessType);
+  CppObj* readCompound(CppAccessType accessType);
+  CppObj* createObj(PendingObj& pendingObj);
+  CppObj* createObj(CppObjType objType, CppAccessType accessType);
+
+private:
+  const char*              cur_;
+  const char* const        end_;
+  const CppObjFactory&     objFactory_;
+  std::vector<std::string> strings_;
+  std::vector<CppObjPtr>*  children_ {nullptr};
+  size_t                   nextChild_ {0};
+  bool                     failed_ {false};
+};
+
+CppObj* AstReader::readVarType(CppAccessType accessType)
+{
+  const auto baseType = readStr();
+  CppObjPtr  compound(takeChild());
+  const auto modifier = readTypeModifier();
+
+  CppVarType* varType = nullptr;
+  if (!compound)
+    varType = objFactory_.Create<CppVarType>(accessType, std::string(), modifier);
+  else if (compound->objType_ == CppCompound::kObjectType)
+    varType = objFactory_.Create<CppVarType>(accessType, static_cast<CppCompound*>(compound.release()), modifier);
+  else if (compound->objType_ == CppFunctionPointer::kObjectType)
+    varType = objFactory_.Create<CppVarType>(accessType, static_cast<CppFunctionPointer*>(compound.release()),
+                                             modifier);
+  else if (compound->objType_ == CppEnum::kObjectType)
+    varType = objFactory_.Create<CppVarType>(accessType, static_cast<CppEnum*>(compound.release()), modifier);
+  else
+    return fail();
+
+  // Base type is assigned after construction so that it is not cleansed again.
+  varType->baseType(baseType);
+  varType->typeAttr(static_cast<std::uint32_t>(readUInt()));
+  varType->paramPack_ = readBool();
+  varType->attribSpecifierSequence(readAttribSpecifiers());
+  return varType;
+}
+
+CppObj* AstReader::readCompound(CppAccessType accessType)
+{
+  auto       name         = readStr();
+  const auto compoundType = readEnum<CppCompoundType>();
+  auto*      compound     = objFactory_.CreateCompound(std::move(name), accessType, compoundType);
+  size_t     count        = 0;
+  if (readOptionalCount(count))
+  {
+    auto* inheritanceList = new CppInheritanceList;
+    for (size_t i = 0; (i < count) && !failed_; ++i)
+    {
+      auto       baseName  = readStr();
+      const auto inhType   = readEnum<CppAccessType>();
+      const auto isVirtual = readBool();
+      inheritanceList->emplace_back(std::move(baseName), inhType, isVirtual);
+    }
+    compound->inheritanceList(inheritanceList);
+  }
+  compound->apidecor(readStr());
+  compound->templateParamList(readTemplateParamList());
+  compound->addAttr(static_cast<std::uint32_t>(readUInt()));
+  compound->attribSpecifierSequence(readAttribSpecifiers());
+  const auto numMembers = readCount();
+  for (size_t i = 0; (i < numMembers) && !failed_; ++i)
+  {
+    if (auto* mem = takeChild())
+      compound->addMember(mem);
+  }
+  return compound;
+}
+
+CppObj* AstReader::readObj()
+{
+  std::vector<PendingObj> pendingObjs;
+  do
+  {
+    const auto objType = readEnum<CppObjType>();
+    if (objType != CppObjType::kUnknown)
+    {
+      const auto accessType  = readEnum<CppAccessType>();
+      const auto numChildren = readCount();
+      pendingObjs.push_back({objType, accessType, numChildren, {}});
+    }
+    else if (!pendingObjs.empty())
+    {
+      pendingObjs.back().children.emplace_back();
+    }
+    else
+    {
+      return nullptr;
+    }
+
+    // Every pending object that now has all its children is created and becomes a child of the one below it.
+    while (!failed_ && (pendingObjs.back().children.size() == pendingObjs.back().numChildren))
+    {
+      CppObjPtr obj(createObj(pendingObjs.back()));
+      pendingObjs.pop_back();
+      if (pendingObjs.empty())
+        return failed_ ? nullptr : obj.release();
+      pendingObjs.back().children.push_back(std::move(obj));
+    }
+  } while (!failed_);
+
+  return nullptr;
+}
+
+CppObj* AstReader::createObj(PendingObj& pendingObj)
+{
+  children_  = &pendingObj.children;
+  nextChild_ = 0;
+  CppObjPtr obj(createObj(pendingObj.objType, pendingObj.accessType));
+  children_ = nullptr;
+  if (nextChild_ != pendingObj.children.size())
+    return fail();
+  return obj.release();
+}
+
+CppObj* AstReader::createObj(CppObjType objType, CppAccessType accessType)
+{
+  switch (objType)
+  {
+    case CppObjType::kDocComment:
+      return objFactory_.Create<CppDocComment>(readStr(), accessType);
+    case CppObjType::kHashIf:
+    {
+      const auto condType = readEnum<CppHashIf::CondType>();
+      return objFactory_.Create<CppHashIf>(condType, readStr());
+    }
+    case CppObjType::kHashInclude:
+      return objFactory_.Create<CppInclude>(readStr());
+    case CppObjType::kHashImport:
+      return objFactory_.Create<CppImport>(readStr());
+    case CppObjType::kHashDefine:
+    {
+      const auto defType = readEnum<CppDefine::DefType>();
+      auto       name    = readStr();
+      return objFactory_.Create<CppDefine>(defType, std::move(name), readStr());
+    }
+    case CppObjType::kHashUndef:
+      return objFactory_.Create<CppUndef>(readStr());
+    case CppObjType::kHashPragma:
+      return objFactory_.Create<CppPragma>(readStr());
+    case CppObjType::kHashError:
+      return objFactory_.Create<CppHashError>(readStr());
+    case CppObjType::kHashWarning:
+      return objFactory_.Create<CppHashWarning>(readStr());
+    case CppObjType::kUnRecogPrePro:
+    {
+      auto name = readStr();
+      return objFactory_.Create<CppUnRecogPrePro>(std::move(name), readStr());
+    }
+    case CppObjType::kVarType:
+      return readVarType(accessType);
+    case CppObjType::kVar:
+    {
+      CppVarTypePtr varType(takeChildOf<CppVarType>());
+      auto          varDecl = readVarDecl();
+      if (!varType)
+        return fail();
+      auto* var = objFactory_.Create<CppVar>(std::move(varType), std::move(varDecl));
+      var->apidecor(readStr());
+      var->templateParamList(readTemplateParamList());
+      return var;
+    }
+    case CppObjType::kVarList:
+    {
+      CppVarPtr  firstVar(takeChildOf<CppVar>());
+      const auto numVarDecls = readCount();
+      if (!firstVar || (numVarDecls == 0))
+        return fail();
+      auto  modifier = readTypeModifier();
+      auto* varList  = objFactory_.Create<CppVarList>(firstVar.release(), CppVarDeclInList(modifier, readVarDecl()));
+      for (size_t i = 1; (i < numVarDecls) && !failed_; ++i)
+      {
+        modifier = readTypeModifier();
+        varList->addVarDecl(CppVarDeclInList(modifier, readVarDecl()));
+      }
+      return varList;
+    }
+    case CppObjType::kTypedefName:
+    {
+      auto* var = takeChildOf<CppVar>();
+      if (!var)
+        return fail();
+      return objFactory_.Create<CppTypedefName>(var);
+    }
+    case CppObjType::kTypedefNameList:
+    {
+      auto* varList = takeChildOf<CppVarList>();
+      if (!varList)
+        return fail();
+      return objFactory_.Create<CppTypedefList>(varList);
+    }
+    case CppObjType::kNamespaceAlias:
+    {
+      auto name = readStr();
+      return objFactory_.Create<CppNamespaceAlias>(std::move(name), readStr());
+    }
+    case CppObjType::kUsingNamespaceDecl:
+      return objFactory_.Create<CppUsingNamespaceDecl>(readStr());
+    case CppObjType::kUsingDecl:
+    {
+      auto          name = readStr();
+      CppObjPtr     cppObj(takeChild());
+      CppUsingDecl* usingDecl = nullptr;
+      if (!cppObj)
+        usingDecl = objFactory_.Create<CppUsingDecl>(std::move(name), accessType);
+      else if (cppObj->objType_ == CppVarType::kObjectType)
+        usingDecl = objFactory_.Create<CppUsingDecl>(std::move(name), static_cast<CppVarType*>(cppObj.release()));
+      else if (cppObj->objType_ == CppFunctionPointer::kObjectType)
+        usingDecl = objFactory_.Create<CppUsingDecl>(std::move(name),
+                                                     static_cast<CppFunctionPointer*>(cppObj.release()));
+      else if (cppObj->objType_ == CppCompound::kObjectType)
+        usingDecl = objFactory_.Create<CppUsingDecl>(std::move(name), static_cast<CppCompound*>(cppObj.release()));
+      else
+        return fail();
+      usingDecl->templateParamList(readTemplateParamList());
+      return usingDecl;
+    }
+    case CppObjType::kEnum:
+    {
+      auto             name     = readStr();
+      CppEnumItemList* itemList = nullptr;
+      size_t           count    = 0;
+      if (readOptionalCount(count))
+      {
+        itemList = new CppEnumItemList;
+        for (size_t i = 0; (i < count) && !failed_; ++i)
+        {
+          auto itemName = readStr();
+          auto val      = takeChild();
+          if (itemName.empty() && val)
+            itemList->emplace_back(val);
+          else if (!val || (val->objType_ == CppExpr::kObjectType))
+            itemList->emplace_back(std::move(itemName), static_cast<CppExpr*>(val));
+          else
+          {
+            delete val;
+            fail();
+          }
+        }
+      }
+      const auto isClass = readBool();
+      return objFactory_.Create<CppEnum>(accessType, std::move(name), itemList, isClass, readStr());
+    }
+    case CppObjType::kCompound:
+      return readCompound(accessType);
+    case CppObjType::kFwdClsDecl:
+    {
+      const auto cmpType    = readEnum<CppCompoundType>();
+      auto       name       = readStr();
+      auto       apidecor   = readStr();
+      auto*      fwdClsDecl = objFactory_.Create<CppFwdClsDecl>(accessType, std::move(name), std::move(apidecor),
+                                                                cmpType);
+      fwdClsDecl->addAttr(static_cast<std::uint32_t>(readUInt()));
+      fwdClsDecl->templateParamList(readTemplateParamList());
+      return fwdClsDecl;
+    }
+    case CppObjType::kFunction:
+    case CppObjType::kFunctionPtr:
+    {
+      auto  info    = readFunctionBase();
+      auto* params  = readParams();
+      auto* retType = takeChildOf<CppVarType>();
+
+      CppFunction* func = nullptr;
+      if (objType == CppObjType::kFunction)
+        func = objFactory_.CreateFunction(accessType, std::move(info.name), retType, params, info.attr);
+      else
+        func = objFactory_.Create<CppFunctionPointer>(accessType, std::move(info.name), retType, params, info.attr,
+                                                      readStr());
+      applyFunctionBase(func, info);
+      return func;
+    }
+    case CppObjType::kLambda:
+    {
+      auto* captures = takeChildOf<CppExpr>();
+      auto* params   = readParams();
+      auto* retType  = takeChildOf<CppVarType>();
+      auto* defn     = takeChildOf<CppCompound>();
+      auto* lambda   = objFactory_.Create<CppLambda>(captures, params, defn, retType);
+      applyFuncLikeBase(lambda, readFuncLikeBase());
+      return lambda;
+    }
+    case CppObjType::kConstructor:
+    {
+      auto        info     = readFunctionBase();
+      auto*       params   = readParams();
+      CppMemInits memInits = makeEmptyCppMemInitList();
+      if (readBool())
+      {
+        memInits = makeCppMemInitList(takeChildOf<CppBlob>());
+      }
+      else
+      {
+        size_t count = 0;
+        if (readOptionalCount(count))
+        {
+          auto* memInitList = new CppMemInitList;
+          for (size_t i = 0; (i < count) && !failed_; ++i)
+          {
+            auto memName = readStr();
+            memInitList->emplace_back(std::move(memName), takeChildOf<CppExpr>());
+          }
+          memInits = makeCppMemInitList(memInitList);
+        }
+      }
+      auto* ctor = objFactory_.CreateConstructor(accessType, std::move(info.name), params, memInits, info.attr);
+      applyFunctionBase(ctor, info);
+      return ctor;
+    }
+    case CppObjType::kDestructor:
+    {
+      auto  info = readFunctionBase();
+      auto* dtor = objFactory_.CreateDestructor(accessType, std::move(info.name), info.attr);
+      applyFunctionBase(dtor, info);
+      return dtor;
+    }
+    case CppObjType::kTypeConverter:
+    {
+      auto* to   = takeChildOf<CppVarType>();
+      auto  info = readFunctionBase();
+      if (!to)
+        return fail();
+      auto* typeConverter = objFactory_.CreateTypeConverter(to, std::move(info.name));
+      typeConverter->addAttr(info.attr);
+      applyFunctionBase(typeConverter, info);
+      return typeConverter;
+    }
+    case CppObjType::kExpression:
+    {
+      const auto expr1 = readExprAtom();
+      const auto expr2 = readExprAtom();
+      const auto expr3 = readExprAtom();
+      const auto oper  = readEnum<CppOperator>();
+      const auto flags = static_cast<short>(readUInt());
+      if (oper != CppOperator::kTertiaryOperator)
+      {
+        expr3.destroy();
+        return objFactory_.Create<CppExpr>(expr1, oper, expr2, flags);
+      }
+      auto* expr   = objFactory_.Create<CppExpr>(expr1, expr2, expr3);
+      expr->flags_ = flags;
+      return expr;
+    }
+    case CppObjType::kMacroCall:
+      return objFactory_.Create<CppMacroCall>(readStr(), accessType);
+    case CppObjType::kAsmBlock:
+      return objFactory_.Create<CppAsmBlock>(readStr());
+    case CppObjType::kBlob:
+    {
+      // Blob is assigned after construction so that it is not trimmed again.
+      auto* blob  = objFactory_.Create<CppBlob>(std::string());
+      blob->blob_ = readStr();
+      return blob;
+    }
+    case CppObjType::kLabel:
+      return objFactory_.Create<CppLabel>(readStr());
+    case CppObjType::kIfBlock:
+    {
+      auto* cond = takeChild();
+      auto* body = takeChild();
+      return objFactory_.Create<CppIfBlock>(cond, body, takeChild());
+    }
+    case CppObjType::kWhileBlock:
+    {
+      auto* cond = takeChild();
+      return objFactory_.Create<CppWhileBlock>(cond, takeChild());
+    }
+    case CppObjType::kDoWhileBlock:
+    {
+      auto* cond = takeChild();
+      return objFactory_.Create<CppDoWhileBlock>(cond, takeChild());
+    }
+    case CppObjType::kForBlock:
+    {
+      auto* start = takeChild();
+      auto* stop  = takeChildOf<CppExpr>();
+      auto* step  = takeChildOf<CppExpr>();
+      return objFactory_.Create<CppForBlock>(start, stop, step, takeChild());
+    }
+    case CppObjType::kRangeForBlock:
+    {
+      auto* var  = takeChildOf<CppVar>();
+      auto* expr = takeChildOf<CppExpr>();
+      return objFactory_.Create<CppRangeForBlock>(var, expr, takeChild());
+    }
+    case CppObjType::kSwitchBlock:
+    {
+      auto*          cond  = takeChildOf<CppExpr>();
+      CppSwitchBody* body  = nullptr;
+      size_t         count = 0;
+      if (readOptionalCount(count))
+      {
+        body = new CppSwitchBody;
+        for (size_t i = 0; (i < count) && !failed_; ++i)
+        {
+          auto* caseExpr = takeChildOf<CppExpr>();
+          body->emplace_back(caseExpr, takeChildOf<CppCompound>());
+        }
+      }
+      return objFactory_.Create<CppSwitchBlock>(cond, body);
+    }
+    case CppObjType::kTryBlock:
+    {
+      CppCompoundPtr tryStmt(takeChildOf<CppCompound>());
+      const auto     numCatchBlocks = readCount();
+      CppTryBlock*   tryBlock       = nullptr;
+      for (size_t i = 0; (i < numCatchBlocks) && !failed_; ++i)
+      {
+        CppVarTypePtr exceptionType(takeChildOf<CppVarType>());
+        auto          exceptionName = readStr();
+        CppCompoundPtr catchStmt(takeChildOf<CppCompound>());
+        auto* catchBlock = objFactory_.Create<CppCatchBlock>(std::move(exceptionType), std::move(exceptionName),
+                                                             std::move(catchStmt));
+        if (tryBlock)
+          tryBlock->addCatchBlock(catchBlock);
+        else
+          tryBlock = objFactory_.Create<CppTryBlock>(tryStmt.release(), catchBlock);
+      }
+      if (!tryBlock)
+        return fail();
+      return tryBlock;
+    }
+
+    default:
+      return fail();
+  }
+}
+
+} // namespace
+
+std::string serializeAst(const CppCompound& ast)
+{
+  AstWriter writer;
+  writer.writeUInt(kFormatVersion);
+  writer.writeObj(&ast);
+
+  return std::move(writer.buffer());
+}
+
+CppCompoundPtr deserializeAst(const char* data, size_t size, const CppObjFactory& objFactory)
+{
+  AstReader reader(data, size, objFactory);
+  if (reader.readUInt() != kFormatVersion)
+    return nullptr;
+
+  CppCompoundPtr ast(reader.readObjOf<CppCompound>());
+  if (reader.failed() || !reader.atEnd())
+    return nullptr;
+
+  return ast;
+}
@@ -0,0 +1,46 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "cppast.h"
+
+#include <cstddef>
+#include <string>
+
+class CppObjFactory;
+
+/**
+ * @brief Encodes an AST in a compact binary form that can be sent to another process.
+ *
+ * Integers are stored as variable length quantities and every distinct string is stored only once.
+ */
+std::string serializeAst(const CppCompound& ast);
+
+/**
+ * @brief Rebuilds the AST encoded by serializeAst().
+ *
+ * Objects that CppObjFactory knows about are created using objFactory.
+ * @return nullptr if data is not a valid encoding.
+ */
+CppCompoundPtr deserializeAst(const char* data, size_t size, const CppObjFactory& objFactory);
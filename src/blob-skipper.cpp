@@ -0,0 +1,319 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "blob-skipper.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#  define BLOB_SKIPPER_USE_SSE2
+#  include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#endif
+
+namespace {
+
+// Input is looked at a block at a time, a block gives a bit mask of the positions where a char is found.
+#if defined(__AVX2__)
+
+constexpr size_t kBlockSize = 32;
+using Block                 = __m256i;
+
+Block loadBlock(const char* p)
+{
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+std::uint32_t matchMask(Block block, char c)
+{
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(c))));
+}
+
+#elif defined(BLOB_SKIPPER_USE_SSE2)
+
+constexpr size_t kBlockSize = 16;
+using Block                 = __m128i;
+
+Block loadBlock(const char* p)
+{
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+std::uint32_t matchMask(Block block, char c)
+{
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(c))));
+}
+
+#else
+
+constexpr size_t kBlockSize = 16;
+using Block                 = const char*;
+
+Block loadBlock(const char* p)
+{
+  return p;
+}
+
+std::uint32_t matchMask(Block block, char c)
+{
+  std::uint32_t mask = 0;
+  for (size_t i = 0; i < kBlockSize; ++i)
+    mask |= static_cast<std::uint32_t>(block[i] == c) << i;
+  return mask;
+}
+
+#endif
+
+int countTrailingZeros(std::uint32_t mask)
+{
+#if defined(_MSC_VER)
+  unsigned long idx = 0;
+  _BitScanForward(&idx, mask);
+  return static_cast<int>(idx);
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+template <char... kChars>
+const char* findFirstOf(const char* p, const char* end)
+{
+  for (; static_cast<size_t>(end - p) >= kBlockSize; p += kBlockSize)
+  {
+    const auto block = loadBlock(p);
+    const auto mask  = (matchMask(block, kChars) | ...);
+    if (mask != 0)
+      return p + countTrailingZeros(mask);
+  }
+  for (; p < end; ++p)
+  {
+    if (((*p == kChars) || ...))
+      return p;
+  }
+
+  return end;
+}
+
+bool isIdChar(char c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_') || ((c >= '0') && (c <= '9'));
+}
+
+bool isDigit(char c)
+{
+  return (c >= '0') && (c <= '9');
+}
+
+bool isRawStringPrefix(std::string_view token)
+{
+  return (token == "R") || (token == "LR") || (token == "uR") || (token == "UR") || (token == "u8R");
+}
+
+// Start of the line that has p, it is never before from.
+const char* lineStartOf(const char* from, const char* p)
+{
+  while ((p != from) && (p[-1] != '\n'))
+    --p;
+  return p;
+}
+
+// Only spaces can precede '#' for rules that match a directive at line start.
+bool isDirectiveStart(const char* input, const char* hash)
+{
+  auto p = hash;
+  while ((p != input) && ((p[-1] == ' ') || (p[-1] == '\t')))
+    --p;
+  return (p == input) || (p[-1] == '\n');
+}
+
+// Digits of a number can be separated by quotes, e.g. 1'000'000, which must not be mistaken as char literals.
+bool isDigitSeparator(const char* input, const char* quote)
+{
+  auto start = quote;
+  while ((start != input) && (isIdChar(start[-1]) || (start[-1] == '.') || (start[-1] == '\'')))
+    --start;
+  if (start == quote)
+    return false;
+  return isDigit(*start) || ((*start == '.') && isDigit(start[1]));
+}
+
+const char* skipQuoted(const char* quote, const char* end)
+{
+  for (auto p = quote + 1; p < end; ++p)
+  {
+    if ((*p == '\\') && (p + 1 < end))
+      ++p;
+    else if (*p == *quote)
+      return p + 1;
+    else if (*p == '\n')
+      return p; // Unterminated literal, let the new line be seen as usual.
+  }
+
+  return end;
+}
+
+const char* skipRawString(const char* quote, const char* end)
+{
+  // quote is the opening quote of R"delimiter( ... )delimiter"
+  const auto delimStart = quote + 1;
+  auto       delimEnd   = delimStart;
+  while ((delimEnd < end) && (delimEnd - delimStart <= 16) && (*delimEnd != '(') && (*delimEnd != ' ')
+         && (*delimEnd != '\t') && (*delimEnd != '\r') && (*delimEnd != '\n'))
+  {
+    ++delimEnd;
+  }
+  if ((delimEnd >= end) || (*delimEnd != '('))
+    return skipQuoted(quote, end);
+
+  const auto closing = ")" + std::string(delimStart, delimEnd) + "\"";
+  const auto itr     = std::string_view(delimEnd + 1, end - delimEnd - 1).find(closing);
+  return (itr == std::string_view::npos) ? end : delimEnd + 1 + itr + closing.size();
+}
+
+template <char... kStoppers>
+BlobSkip skipLines(const char* input, const char* inputEnd, const char* from)
+{
+  for (auto p = from;;)
+  {
+    p = findFirstOf<kStoppers...>(p, inputEnd);
+    if (p == inputEnd)
+      return {p};
+    if (((*p == '#') && !isDirectiveStart(input, p)) || ((*p == '\r') && (p[1] == '\n')))
+    {
+      ++p;
+      continue;
+    }
+    return {lineStartOf(from, p)};
+  }
+}
+
+} // namespace
+
+void appendLineStarts(const char* begin, const char* end, std::vector<const char*>& lineStarts)
+{
+  auto p = begin;
+  for (; static_cast<size_t>(end - p) >= kBlockSize; p += kBlockSize)
+  {
+    const auto block       = loadBlock(p);
+    const auto newLineMask = matchMask(block, '\n');
+    auto       crMask      = matchMask(block, '\r');
+    if (crMask != 0)
+    {
+      const auto followedByNewLine = (newLineMask >> 1) | (std::uint32_t(p[kBlockSize] == '\n') << (kBlockSize - 1));
+      crMask &= ~followedByNewLine;
+    }
+    for (auto mask = newLineMask | crMask; mask != 0; mask &= mask - 1)
+      lineStarts.push_back(p + countTrailingZeros(mask) + 1);
+  }
+  for (; p < end; ++p)
+  {
+    if ((*p == '\n') || ((*p == '\r') && (p[1] != '\n')))
+      lineStarts.push_back(p + 1);
+  }
+}
+
+BlobSkip skipFunctionBody(const char* input, const char* inputEnd, const char* from, int depth, bool stopAtDirective)
+{
+  for (auto p = from;;)
+  {
+    p = findFirstOf<'{', '}', '"', '\'', '/', '#'>(p, inputEnd);
+    if (p == inputEnd)
+      return BlobSkip {p, depth};
+
+    switch (*p)
+    {
+      case '{':
+        ++depth;
+        ++p;
+        break;
+
+      case '}':
+        if (depth == 0)
+        {
+          if (p == from)
+            return BlobSkip {p, depth};
+          // Brace that closes a nested block just before the body ends is left for lexer too.
+          return BlobSkip {p - 1, (p[-1] == '}') ? 1 : 0};
+        }
+        --depth;
+        ++p;
+        break;
+
+      case '"':
+      {
+        auto prefixStart = p;
+        while ((prefixStart != input) && isIdChar(prefixStart[-1]))
+          --prefixStart;
+        p = isRawStringPrefix(std::string_view(prefixStart, p - prefixStart)) ? skipRawString(p, inputEnd)
+                                                                                : skipQuoted(p, inputEnd);
+        break;
+      }
+
+      case '\'':
+        p = isDigitSeparator(input, p) ? p + 1 : skipQuoted(p, inputEnd);
+        break;
+
+      case '/':
+        if (p[1] == '*')
+          return BlobSkip {p, depth};
+        p = (p[1] == '/') ? findFirstOf<'\n'>(p, inputEnd) : p + 1;
+        break;
+
+      case '#':
+        if (stopAtDirective && isDirectiveStart(input, p))
+          return BlobSkip {lineStartOf(from, p), depth};
+        ++p;
+        break;
+    }
+  }
+}
+
+BlobSkip skipDisabledCode(const char* input, const char* inputEnd, const char* from)
+{
+  return skipLines<'/', '#'>(input, inputEnd, from);
+}
+
+BlobSkip skipBlockComment(const char* input, const char* inputEnd, const char* from)
+{
+  return skipLines<'/', '#', '\r'>(input, inputEnd, from);
+}
+
+const char* findBlockCommentEnd(const char* from, const char* inputEnd)
+{
+  // '/' is searched for because doc comments are full of '*'.
+  for (auto p = findFirstOf<'/'>(from, inputEnd); p != inputEnd; p = findFirstOf<'/'>(p + 1, inputEnd))
+  {
+    if ((p != from) && (p[-1] == '*'))
+      return p + 1;
+  }
+
+  return inputEnd;
+}
@@ -0,0 +1,70 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Result of skipping a region of input that lexer would otherwise consume a char at a time without any effect.
+ */
+struct BlobSkip
+{
+  const char* stop;      ///< First char that lexer has to look at again.
+  int         depth {0}; ///< Depth of nested curly brackets at stop, used only for function body.
+};
+
+/**
+ * Appends the position after every line break in [begin, end) to lineStarts.
+ * A line break is '\n' or a '\r' that isn't followed by '\n', like {NL} of lexer.
+ * The char at end is read to know if a '\r' just before it is alone.
+ */
+void appendLineStarts(const char* begin, const char* end, std::vector<const char*>& lineStarts);
+
+/**
+ * Skips text of a function body from position from, depth is the number of unclosed curly brackets after the one
+ * that started the body. String, char, and raw string literals, and line comments are skipped as a whole.
+ * It stops at the start of a block comment, at the start of a line that begins with '#' when stopAtDirective is
+ * true, and before the last char that precedes the closing brace of the body so that the rules that return the blob
+ * can match it. input is start of the whole input, which is needed to look behind quotes.
+ * Like the other skips it may read the char at inputEnd, which is null for lexer's buffer.
+ */
+BlobSkip skipFunctionBody(const char* input, const char* inputEnd, const char* from, int depth, bool stopAtDirective);
+
+/**
+ * Skips whole lines of disabled code from position from.
+ * It stops at the start of a line that has '/' or that begins with '#', or at from itself if it is on such a line.
+ */
+BlobSkip skipDisabledCode(const char* input, const char* inputEnd, const char* from);
+
+/**
+ * Skips whole lines of a block comment in the same way as skipDisabledCode().
+ * A line with a '\r' that is not followed by '\n' is also not skipped.
+ */
+BlobSkip skipBlockComment(const char* input, const char* inputEnd, const char* from);
+
+/**
+ * @return Position after the end marker of block comment whose text starts at from, or inputEnd if it isn't closed.
+ */
+const char* findBlockCommentEnd(const char* from, const char* inputEnd);
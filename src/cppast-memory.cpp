@@ -0,0 +1,606 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "cppast-memory.h"
+#include "cppast.h"
+
+#include <vector>
+
+namespace {
+
+size_t stringBytes(const std::string& str)
+{
+  static const size_t kInlineCapacity = std::string().capacity();
+  return (str.capacity() > kInlineCapacity) ? (str.capacity() + 1) : 0;
+}
+
+template <typename T>
+size_t vectorBytes(const std::vector<T>& vec)
+{
+  return vec.capacity() * sizeof(T);
+}
+
+size_t nodeSize(const CppObj* obj)
+{
+  switch (obj->objType_)
+  {
+    case CppObjType::kDocComment:
+      return sizeof(CppDocComment);
+    case CppObjType::kHashIf:
+      return sizeof(CppHashIf);
+    case CppObjType::kHashInclude:
+      return sizeof(CppInclude);
+    case CppObjType::kHashImport:
+      return sizeof(CppImport);
+    case CppObjType::kHashDefine:
+      return sizeof(CppDefine);
+    case CppObjType::kHashUndef:
+      return sizeof(CppUndef);
+    case CppObjType::kHashPragma:
+      return sizeof(CppPragma);
+    case CppObjType::kHashError:
+      return sizeof(CppHashError);
+    case CppObjType::kHashWarning:
+      return sizeof(CppHashWarning);
+    case CppObjType::kUnRecogPrePro:
+      return sizeof(CppUnRecogPrePro);
+    case CppObjType::kVarType:
+      return sizeof(CppVarType);
+    case CppObjType::kVar:
+      return sizeof(CppVar);
+    case CppObjType::kVarList:
+      return sizeof(CppVarList);
+    case CppObjType::kTypedefName:
+      return sizeof(CppTypedefName);
+    case CppObjType::kTypedefNameList:
+      return sizeof(CppTypedefList);
+    case CppObjType::kNamespaceAlias:
+      return sizeof(CppNamespaceAlias);
+    case CppObjType::kUsingNamespaceDecl:
+      return sizeof(CppUsingNamespaceDecl);
+    case CppObjType::kUsingDecl:
+      return sizeof(CppUsingDecl);
+    case CppObjType::kEnum:
+      return sizeof(CppEnum);
+    case CppObjType::kCompound:
+      return sizeof(CppCompound);
+    case CppObjType::kFwdClsDecl:
+      return sizeof(CppFwdClsDecl);
+    case CppObjType::kFunction:
+      return sizeof(CppFunction);
+    case CppObjType::kLambda:
+      return sizeof(CppLambda);
+    case CppObjType::kConstructor:
+      return sizeof(CppConstructor);
+    case CppObjType::kDestructor:
+      return sizeof(CppDestructor);
+    case CppObjType::kTypeConverter:
+      return sizeof(CppTypeConverter);
+    case CppObjType::kFunctionPtr:
+      return sizeof(CppFunctionPointer);
+    case CppObjType::kExpression:
+      return sizeof(CppExpr);
+    case CppObjType::kMacroCall:
+      return sizeof(CppMacroCall);
+    case CppObjType::kAsmBlock:
+      return sizeof(CppAsmBlock);
+    case CppObjType::kBlob:
+      return sizeof(CppBlob);
+    case CppObjType::kLabel:
+      return sizeof(CppLabel);
+    case CppObjType::kIfBlock:
+      return sizeof(CppIfBlock);
+    case CppObjType::kForBlock:
+      return sizeof(CppForBlock);
+    case CppObjType::kRangeForBlock:
+      return sizeof(CppRangeForBlock);
+    case CppObjType::kWhileBlock:
+      return sizeof(CppWhileBlock);
+    case CppObjType::kDoWhileBlock:
+      return sizeof(CppDoWhileBlock);
+    case CppObjType::kSwitchBlock:
+      return sizeof(CppSwitchBlock);
+    case CppObjType::kTryBlock:
+      return sizeof(CppTryBlock);
+
+    default:
+      assert(false && "Object of this type is never created by parser.");
+      return 0;
+  }
+}
+
+} // namespace
+
+/**
+ * Accounts memory of nodes to the report it is constructed with.
+ * Nodes yet to be accounted are kept on an explicit stack so that deep ASTs can't overflow the call stack.
+ */
+class CppAstMemoryCounter
+{
+public:
+  CppAstMemoryCounter(CppAstMemoryReport& report)
+    : report_(report)
+  {
+  }
+
+  void count(const CppObj* root)
+  {
+    push(root);
+    while (!pending_.empty())
+    {
+      const auto* obj = pending_.back();
+      pending_.pop_back();
+      countObj(obj);
+    }
+  }
+
+private:
+  void push(const CppObj* obj)
+  {
+    if (obj)
+      pending_.push_back(obj);
+  }
+
+  void countText(const CppSourceText& text, CppAstMemoryUsage& usage)
+  {
+    if (!text.refersToSource())
+      usage.stringBytes += stringBytes(std::get<std::string>(text.text_));
+  }
+
+  void countAttribSpecifiers(const AttribSpecified& attribSpecified, CppAstMemoryUsage& usage)
+  {
+    const auto& attribSpecifiers = attribSpecified.attribSpecifierSequence();
+    if (!attribSpecifiers)
+      return;
+    usage.containerBytes += sizeof(AttribSpecifierArray) + vectorBytes(*attribSpecifiers);
+    for (const auto& attribSpecifier : *attribSpecifiers)
+      push(attribSpecifier.get());
+  }
+
+  void countTemplateParamList(const CppTemplateParamList* templParamList, CppAstMemoryUsage& usage)
+  {
+    if (!templParamList)
+      return;
+    usage.containerBytes += sizeof(CppTemplateParamList) + vectorBytes(*templParamList);
+    for (const auto& templParam : *templParamList)
+    {
+      push(templParam.paramType_.get());
+      push(templParam.defaultArg());
+    }
+  }
+
+  void countVarDecl(const CppVarDecl& varDecl, CppAstMemoryUsage& usage)
+  {
+    push(varDecl.assignValue());
+    push(varDecl.bitField());
+    usage.containerBytes += vectorBytes(varDecl.arraySizes());
+    for (const auto& arraySize : varDecl.arraySizes())
+      push(arraySize.get());
+  }
+
+  void countParams(const CppParamVector* params, CppAstMemoryUsage& usage)
+  {
+    if (!params)
+      return;
+    usage.containerBytes += sizeof(CppParamVector) + vectorBytes(*params);
+    for (const auto& param : *params)
+      push(param.get());
+  }
+
+  void countFuncLikeBase(const CppFuncLikeBase* func, CppAstMemoryUsage& usage)
+  {
+    push(func->defn());
+    const auto& extras = func->extras_;
+    if (!extras)
+      return;
+    usage.containerBytes += sizeof(CppFuncExtras);
+    usage.stringBytes += stringBytes(extras->decor1) + stringBytes(extras->decor2);
+    if (extras->throwSpec)
+    {
+      usage.containerBytes += sizeof(CppFuncThrowSpec) + vectorBytes(*extras->throwSpec);
+      for (const auto& exceptionName : *extras->throwSpec)
+        usage.stringBytes += stringBytes(exceptionName);
+    }
+    countTemplateParamList(extras->templSpec.get(), usage);
+  }
+
+  void countExprAtom(const CppExprAtom& atom, CppAstMemoryUsage& usage)
+  {
+    usage.stringBytes += atom.ownedBytes();
+    switch (atom.type)
+    {
+      case CppExprAtom::kExpr:
+        push(atom.expr);
+        break;
+      case CppExprAtom::kLambda:
+        push(atom.lambda);
+        break;
+      case CppExprAtom::kVarType:
+        push(atom.varType);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  void countCompound(const CppCompound* compound, CppAstMemoryUsage& usage);
+  void countObj(const CppObj* obj);
+
+private:
+  CppAstMemoryReport&        report_;
+  std::vector<const CppObj*> pending_;
+};
+
+void CppAstMemoryCounter::countCompound(const CppCompound* compound, CppAstMemoryUsage& usage)
+{
+  usage.containerBytes += vectorBytes(compound->members());
+  for (const auto& mem : compound->members())
+    push(mem.get());
+  if (const auto& inheritanceList = compound->inheritanceList())
+    usage.containerBytes += sizeof(CppInheritanceList) + vectorBytes(*inheritanceList);
+  countAttribSpecifiers(*compound, usage);
+
+  const auto& extras = compound->extras_;
+  if (!extras)
+    return;
+  usage.containerBytes += sizeof(CppCompoundExtras) + vectorBytes(extras->ctors);
+  usage.stringBytes += stringBytes(extras->apidecor);
+  countTemplateParamList(extras->templSpec.get(), usage);
+  if (extras->source)
+  {
+    usage.containerBytes += sizeof(CppSourceBuffer);
+    usage.stringBytes += extras->source->size();
+  }
+}
+
+void CppAstMemoryCounter::countObj(const CppObj* obj)
+{
+  // Shared types belong to the process wide pool and not to the AST that refers to them.
+  if ((obj->objType_ == CppObjType::kVarType) && static_cast<const CppVarType*>(obj)->shared())
+    return;
+
+  auto& usage = report_.usage(obj->objType_);
+  ++usage.numNodes;
+  usage.shallowBytes += nodeSize(obj);
+  switch (obj->objType_)
+  {
+    case CppObjType::kDocComment:
+      usage.stringBytes += stringBytes(static_cast<const CppDocComment*>(obj)->doc_);
+      break;
+    case CppObjType::kHashIf:
+      usage.stringBytes += stringBytes(static_cast<const CppHashIf*>(obj)->cond_);
+      break;
+    case CppObjType::kHashInclude:
+      usage.stringBytes += stringBytes(static_cast<const CppInclude*>(obj)->name_);
+      break;
+    case CppObjType::kHashImport:
+      usage.stringBytes += stringBytes(static_cast<const CppImport*>(obj)->name_);
+      break;
+    case CppObjType::kHashDefine:
+    {
+      const auto* hashDefine = static_cast<const CppDefine*>(obj);
+      usage.stringBytes += stringBytes(hashDefine->name_);
+      countText(hashDefine->defn_, usage);
+    }
+    break;
+    case CppObjType::kHashUndef:
+      usage.stringBytes += stringBytes(static_cast<const CppUndef*>(obj)->name_);
+      break;
+    case CppObjType::kHashPragma:
+      usage.stringBytes += stringBytes(static_cast<const CppPragma*>(obj)->defn_);
+      break;
+    case CppObjType::kHashError:
+      usage.stringBytes += stringBytes(static_cast<const CppHashError*>(obj)->err_);
+      break;
+    case CppObjType::kHashWarning:
+      usage.stringBytes += stringBytes(static_cast<const CppHashWarning*>(obj)->err_);
+      break;
+    case CppObjType::kUnRecogPrePro:
+    {
+      const auto* unRecogPrePro = static_cast<const CppUnRecogPrePro*>(obj);
+      usage.stringBytes += stringBytes(unRecogPrePro->name_) + stringBytes(unRecogPrePro->defn_);
+    }
+    break;
+    case CppObjType::kVarType:
+    {
+      const auto* varType = static_cast<const CppVarType*>(obj);
+      push(varType->compound());
+      countAttribSpecifiers(*varType, usage);
+    }
+    break;
+    case CppObjType::kVar:
+    {
+      const auto* var = static_cast<const CppVar*>(obj);
+      push(var->varType());
+      countVarDecl(var->varDecl(), usage);
+      if (const auto& extras = var->extras_)
+      {
+        usage.containerBytes += sizeof(CppVarExtras);
+        usage.stringBytes += stringBytes(extras->apidecor);
+        countTemplateParamList(extras->templSpec.get(), usage);
+      }
+    }
+    break;
+    case CppObjType::kVarList:
+    {
+      const auto* varList = static_cast<const CppVarList*>(obj);
+      push(varList->firstVar().get());
+      usage.containerBytes += vectorBytes(varList->varDeclList());
+      for (const auto& varDecl : varList->varDeclList())
+        countVarDecl(varDecl, usage);
+    }
+    break;
+    case CppObjType::kTypedefName:
+      push(static_cast<const CppTypedefName*>(obj)->var_.get());
+      break;
+    case CppObjType::kTypedefNameList:
+      push(static_cast<const CppTypedefList*>(obj)->varList_.get());
+      break;
+    case CppObjType::kNamespaceAlias:
+    {
+      const auto* namespaceAlias = static_cast<const CppNamespaceAlias*>(obj);
+      usage.stringBytes += stringBytes(namespaceAlias->name_) + stringBytes(namespaceAlias->alias_);
+    }
+    break;
+    case CppObjType::kUsingNamespaceDecl:
+      usage.stringBytes += stringBytes(static_cast<const CppUsingNamespaceDecl*>(obj)->name_);
+      break;
+    case CppObjType::kUsingDecl:
+    {
+      const auto* usingDecl = static_cast<const CppUsingDecl*>(obj);
+      usage.stringBytes += stringBytes(usingDecl->name_);
+      push(usingDecl->cppObj_.get());
+      countTemplateParamList(usingDecl->templateParamList(), usage);
+    }
+    break;
+    case CppObjType::kEnum:
+    {
+      const auto* enumObj = static_cast<const CppEnum*>(obj);
+      usage.stringBytes += stringBytes(enumObj->name_) + stringBytes(enumObj->underlyingType_);
+      if (enumObj->itemList_)
+      {
+        usage.containerBytes += sizeof(CppEnumItemList) + vectorBytes(*(enumObj->itemList_));
+        for (const auto& enumItem : *(enumObj->itemList_))
+        {
+          usage.stringBytes += stringBytes(enumItem.name_);
+          push(enumItem.val_.get());
+        }
+      }
+    }
+    break;
+    case CppObjType::kCompound:
+      countCompound(static_cast<const CppCompound*>(obj), usage);
+      break;
+    case CppObjType::kFwdClsDecl:
+    {
+      const auto* fwdClsDecl = static_cast<const CppFwdClsDecl*>(obj);
+      usage.stringBytes += stringBytes(fwdClsDecl->name_) + stringBytes(fwdClsDecl->apidecor_);
+      countTemplateParamList(fwdClsDecl->templateParamList(), usage);
+    }
+    break;
+    case CppObjType::kFunction:
+    case CppObjType::kFunctionPtr:
+    {
+      const auto* func = static_cast<const CppFunction*>(obj);
+      countFuncLikeBase(func, usage);
+      countParams(func->params(), usage);
+      push(func->retType_.get());
+      if (obj->objType_ == CppObjType::kFunctionPtr)
+        usage.stringBytes += stringBytes(static_cast<const CppFunctionPointer*>(obj)->ownerName_);
+    }
+    break;
+    case CppObjType::kLambda:
+    {
+      const auto* lambda = static_cast<const CppLambda*>(obj);
+      push(lambda->captures_.get());
+      countParams(lambda->params_.get(), usage);
+      push(lambda->retType_.get());
+      push(lambda->defn_.get());
+      countFuncLikeBase(lambda, usage);
+    }
+    break;
+    case CppObjType::kConstructor:
+    {
+      const auto* ctor = static_cast<const CppConstructor*>(obj);
+      countFuncLikeBase(ctor, usage);
+      countParams(ctor->params(), usage);
+      if (ctor->memInits_.memInitListIsABlob_)
+      {
+        push(ctor->memInits_.blob);
+      }
+      else if (ctor->memInits_.memInitList)
+      {
+        usage.containerBytes += sizeof(CppMemInitList) + vectorBytes(*(ctor->memInits_.memInitList));
+        for (const auto& memInit : *(ctor->memInits_.memInitList))
+        {
+          usage.stringBytes += stringBytes(memInit.first);
+          push(memInit.second);
+        }
+      }
+    }
+    break;
+    case CppObjType::kDestructor:
+      countFuncLikeBase(static_cast<const CppDestructor*>(obj), usage);
+      break;
+    case CppObjType::kTypeConverter:
+    {
+      const auto* typeConverter = static_cast<const CppTypeConverter*>(obj);
+      push(typeConverter->to_.get());
+      countFuncLikeBase(typeConverter, usage);
+    }
+    break;
+    case CppObjType::kExpression:
+    {
+      const auto* expr = static_cast<const CppExpr*>(obj);
+      countExprAtom(expr->expr1_, usage);
+      countExprAtom(expr->expr2_, usage);
+      countExprAtom(expr->expr3_, usage);
+    }
+    break;
+    case CppObjType::kMacroCall:
+      countText(static_cast<const CppMacroCall*>(obj)->macroCall_, usage);
+      break;
+    case CppObjType::kAsmBlock:
+      countText(static_cast<const CppAsmBlock*>(obj)->asm_, usage);
+      break;
+    case CppObjType::kBlob:
+      countText(static_cast<const CppBlob*>(obj)->blob_, usage);
+      break;
+    case CppObjType::kLabel:
+      usage.stringBytes += stringBytes(static_cast<const CppLabel*>(obj)->label_);
+      break;
+    case CppObjType::kIfBlock:
+    {
+      const auto* ifBlock = static_cast<const CppIfBlock*>(obj);
+      push(ifBlock->cond_.get());
+      push(ifBlock->body_.get());
+      push(ifBlock->elsePart());
+    }
+    break;
+    case CppObjType::kWhileBlock:
+    {
+      const auto* whileBlock = static_cast<const CppWhileBlock*>(obj);
+      push(whileBlock->cond_.get());
+      push(whileBlock->body_.get());
+    }
+    break;
+    case CppObjType::kDoWhileBlock:
+    {
+      const auto* doWhileBlock = static_cast<const CppDoWhileBlock*>(obj);
+      push(doWhileBlock->cond_.get());
+      push(doWhileBlock->body_.get());
+    }
+    break;
+    case CppObjType::kForBlock:
+    {
+      const auto* forBlock = static_cast<const CppForBlock*>(obj);
+      push(forBlock->start_.get());
+      push(forBlock->stop_.get());
+      push(forBlock->step_.get());
+      push(forBlock->body_.get());
+    }
+    break;
+    case CppObjType::kRangeForBlock:
+    {
+      const auto* rangeForBlock = static_cast<const CppRangeForBlock*>(obj);
+      push(rangeForBlock->var_.get());
+      push(rangeForBlock->expr_.get());
+      push(rangeForBlock->body_.get());
+    }
+    break;
+    case CppObjType::kSwitchBlock:
+    {
+      const auto* switchBlock = static_cast<const CppSwitchBlock*>(obj);
+      push(switchBlock->cond_.get());
+      if (switchBlock->body_)
+      {
+        usage.containerBytes += sizeof(CppSwitchBody) + vectorBytes(*(switchBlock->body_));
+        for (const auto& caseStmt : *(switchBlock->body_))
+        {
+          push(caseStmt.case_.get());
+          push(caseStmt.body_.get());
+        }
+      }
+    }
+    break;
+    case CppObjType::kTryBlock:
+    {
+      const auto* tryBlock = static_cast<const CppTryBlock*>(obj);
+      push(tryBlock->tryStmt_.get());
+      usage.containerBytes += vectorBytes(tryBlock->catchBlocks());
+      for (const auto& catchBlock : tryBlock->catchBlocks())
+      {
+        usage.containerBytes += sizeof(CppCatchBlock);
+        usage.stringBytes += stringBytes(catchBlock->exceptionName_);
+        push(catchBlock->exceptionType_.get());
+        push(catchBlock->catchStmt_.get());
+      }
+    }
+    break;
+
+    default:
+      break;
+  }
+}
+
+CppAstMemoryReport CppCompound::memoryReport() const
+{
+  CppAstMemoryReport report;
+  CppAstMemoryCounter(report).count(this);
+  return report;
+}
+
+const char* cppObjTypeName(CppObjType objType)
+{
+  switch (objType)
+  {
+#define CPPPARSER_OBJ_TYPE_NAME(name) \
+  case CppObjType::k##name:           \
+    return #name;
+    CPPPARSER_OBJ_TYPE_NAME(DocComment)
+    CPPPARSER_OBJ_TYPE_NAME(HashIf)
+    CPPPARSER_OBJ_TYPE_NAME(HashInclude)
+    CPPPARSER_OBJ_TYPE_NAME(HashImport)
+    CPPPARSER_OBJ_TYPE_NAME(HashDefine)
+    CPPPARSER_OBJ_TYPE_NAME(HashUndef)
+    CPPPARSER_OBJ_TYPE_NAME(HashPragma)
+    CPPPARSER_OBJ_TYPE_NAME(HashError)
+    CPPPARSER_OBJ_TYPE_NAME(HashWarning)
+    CPPPARSER_OBJ_TYPE_NAME(UnRecogPrePro)
+    CPPPARSER_OBJ_TYPE_NAME(VarType)
+    CPPPARSER_OBJ_TYPE_NAME(Var)
+    CPPPARSER_OBJ_TYPE_NAME(VarList)
+    CPPPARSER_OBJ_TYPE_NAME(TypedefName)
+    CPPPARSER_OBJ_TYPE_NAME(TypedefNameList)
+    CPPPARSER_OBJ_TYPE_NAME(NamespaceAlias)
+    CPPPARSER_OBJ_TYPE_NAME(UsingNamespaceDecl)
+    CPPPARSER_OBJ_TYPE_NAME(UsingDecl)
+    CPPPARSER_OBJ_TYPE_NAME(Enum)
+    CPPPARSER_OBJ_TYPE_NAME(Compound)
+    CPPPARSER_OBJ_TYPE_NAME(FwdClsDecl)
+    CPPPARSER_OBJ_TYPE_NAME(Function)
+    CPPPARSER_OBJ_TYPE_NAME(Lambda)
+    CPPPARSER_OBJ_TYPE_NAME(Constructor)
+    CPPPARSER_OBJ_TYPE_NAME(Destructor)
+    CPPPARSER_OBJ_TYPE_NAME(TypeConverter)
+    CPPPARSER_OBJ_TYPE_NAME(FunctionPtr)
+    CPPPARSER_OBJ_TYPE_NAME(Expression)
+    CPPPARSER_OBJ_TYPE_NAME(ExpressionList)
+    CPPPARSER_OBJ_TYPE_NAME(MacroCall)
+    CPPPARSER_OBJ_TYPE_NAME(AsmBlock)
+    CPPPARSER_OBJ_TYPE_NAME(Blob)
+    CPPPARSER_OBJ_TYPE_NAME(Label)
+    CPPPARSER_OBJ_TYPE_NAME(IfBlock)
+    CPPPARSER_OBJ_TYPE_NAME(ForBlock)
+    CPPPARSER_OBJ_TYPE_NAME(RangeForBlock)
+    CPPPARSER_OBJ_TYPE_NAME(WhileBlock)
+    CPPPARSER_OBJ_TYPE_NAME(DoWhileBlock)
+    CPPPARSER_OBJ_TYPE_NAME(SwitchBlock)
+    CPPPARSER_OBJ_TYPE_NAME(TryBlock)
+#undef CPPPARSER_OBJ_TYPE_NAME
+
+    default:
+      return "Unknown";
+  }
+}
@@ -22,6 +22,7 @@
  */
 
 #include "cppast.h"
+#include "ast-node-sizes.h"
 #include "cpputil.h"
 
 #include "cppcompound-info-accessor.h"
@@ -29,6 +30,20 @@
 #include "cppobj-info-accessor.h"
 #include "cppvar-info-accessor.h"
 
+CppConstructor::~CppConstructor()
+{
+  if (memInits_.memInitListIsABlob_)
+  {
+    delete memInits_.blob;
+  }
+  else if (memInits_.memInitList)
+  {
+    for (auto& memInit : *memInits_.memInitList)
+      delete memInit.second;
+    delete memInits_.memInitList;
+  }
+}
+
 bool CppConstructor::isCopyConstructor() const
 {
   if (isCopyConstructor_ != TriStateBool::Unknown)
@@ -54,7 +69,7 @@ bool CppConstructor::isCopyConstructor() const
     if (var->varType()->baseType().substr(0, templStartPos) != name_)
       return false;
   }
-  else if (var->varType()->baseType() != name_)
+  else if (var->varType()->baseTypeId() != name_)
   {
     return false;
   }
@@ -90,7 +105,7 @@ bool CppConstructor::isMoveConstructor() const
     if (var->varType()->baseType().substr(0, templStartPos) != name_)
       return false;
   }
-  else if (var->varType()->baseType() != name_)
+  else if (var->varType()->baseTypeId() != name_)
   {
     return false;
   }
@@ -159,9 +174,9 @@ bool CppCompound::hasPureVirtual() const
 
 bool CppCompound::triviallyConstructable() const
 {
-  if (ctors_.empty())
+  if (ctors().empty())
     return true;
-  for (auto* ctor : ctors_)
+  for (auto* ctor : ctors())
   {
     if (!ctor->hasParams())
       return true;
@@ -174,15 +189,15 @@ void CppCompound::assignSpecialMember(const CppObj* mem)
   if (mem->objType_ == CppObjType::kConstructor)
   {
     auto* ctor = static_cast<const CppConstructor*>(mem);
-    ctors_.push_back(ctor);
+    extras().ctors.push_back(ctor);
     if (ctor->isCopyConstructor())
-      copyCtor_ = ctor;
+      extras().copyCtor = ctor;
     else if (ctor->isMoveConstructor())
-      moveCtor_ = ctor;
+      extras().moveCtor = ctor;
   }
   else if (mem->objType_ == CppObjType::kDestructor)
   {
-    dtor_ = static_cast<const CppDestructor*>(mem);
+    extras().dtor = static_cast<const CppDestructor*>(mem);
   }
 }
 
@@ -191,6 +206,74 @@ CppObjType objType(const CppObj* cppObj)
   return cppObj ? cppObj->objType_ : CppObjType::kUnknown;
 }
 
+namespace {
+
+// Nodes left for the outermost destructor, among those that delete their sub-nodes later, of the calling thread.
+thread_local std::vector<const CppObj*>* gNodesToDelete = nullptr;
+
+void deleteLater(const CppObj* node)
+{
+  if (node)
+    gNodesToDelete->push_back(node);
+}
+
+void deleteLater(const CppExprAtom& exprAtom)
+{
+  if (exprAtom.type == CppExprAtom::kExpr)
+    deleteLater(exprAtom.expr);
+  else
+    exprAtom.destroy();
+}
+
+/**
+ * Calls \a handOverSubNodes, which passes sub-nodes of a node being destroyed to deleteLater().
+ * The outermost such call of a thread then deletes them in a loop, so depth of AST doesn't decide depth of call stack.
+ */
+template <typename _HandOverSubNodes>
+void deleteSubNodes(_HandOverSubNodes handOverSubNodes)
+{
+  if (gNodesToDelete)
+  {
+    handOverSubNodes();
+    return;
+  }
+
+  std::vector<const CppObj*> nodesToDelete;
+  gNodesToDelete = &nodesToDelete;
+  handOverSubNodes();
+  while (!nodesToDelete.empty())
+  {
+    const auto* node = nodesToDelete.back();
+    nodesToDelete.pop_back();
+    delete node;
+  }
+  gNodesToDelete = nullptr;
+}
+
+} // namespace
+
+CppCompound::~CppCompound()
+{
+  deleteSubNodes([this]() {
+    for (auto& mem : members_)
+      deleteLater(mem.release());
+  });
+}
+
+CppIfBlock::~CppIfBlock()
+{
+  deleteSubNodes([this]() { deleteLater(else_.release()); });
+}
+
+CppExpr::~CppExpr()
+{
+  deleteSubNodes([this]() {
+    deleteLater(expr1_);
+    deleteLater(expr2_);
+    deleteLater(expr3_);
+  });
+}
+
 bool operator==(const CppExpr& expr1, const CppExpr& expr2)
 {
   if (expr1.flags_ != expr2.flags_)
@@ -209,3 +292,41 @@ bool operator==(const CppExpr& expr1, const CppExpr& expr2)
 
   return false;
 }
+
+std::uint32_t CppVarType::computeStructuralHash() const
+{
+  // Base type is interned and so its address identifies it.
+  std::size_t hash = std::hash<CppIdentifier>()(baseType_);
+  for (const std::size_t part : {static_cast<std::size_t>(accessType_),
+                                 static_cast<std::size_t>(typeModifier_.refType_),
+                                 static_cast<std::size_t>(typeModifier_.ptrLevel_),
+                                 static_cast<std::size_t>(typeModifier_.constBits_),
+                                 static_cast<std::size_t>(typeAttr_),
+                                 static_cast<std::size_t>(paramPack_)})
+  {
+    hash = hash * 31 + part;
+  }
+
+  return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
+
+bool operator==(const CppVarType& lhs, const CppVarType& rhs)
+{
+  if (&lhs == &rhs)
+    return true;
+  if ((lhs.shared() && rhs.shared()) || !lhs.shareable() || !rhs.shareable())
+    return false;
+
+  const auto& lhsModifier = lhs.typeModifier();
+  const auto& rhsModifier = rhs.typeModifier();
+
+  return (lhs.baseTypeId() == rhs.baseTypeId()) && (lhs.accessType_ == rhs.accessType_)
+         && (lhsModifier.refType_ == rhsModifier.refType_) && (lhsModifier.ptrLevel_ == rhsModifier.ptrLevel_)
+         && (lhsModifier.constBits_ == rhsModifier.constBits_) && (lhs.typeAttr() == rhs.typeAttr())
+         && (lhs.paramPack_ == rhs.paramPack_);
+}
+
+#define CPPPARSER_CHECK_AST_NODE_SIZE(type, budget) \
+  static_assert(!kAstNodeSizeBudgetsApply || (sizeof(type) <= budget), #type " has grown beyond its size budget");
+CPPPARSER_AST_NODE_SIZE_BUDGETS(CPPPARSER_CHECK_AST_NODE_SIZE)
+#undef CPPPARSER_CHECK_AST_NODE_SIZE
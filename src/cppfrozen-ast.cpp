@@ -0,0 +1,412 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "cppfrozen-ast.h"
+#include "cppast.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+template <typename... _Vectors>
+size_t capacityBytes(const _Vectors&... vecs)
+{
+  return (0 + ... + (vecs.capacity() * sizeof(typename _Vectors::value_type)));
+}
+
+template <typename... _Vectors>
+void shrinkToFit(_Vectors&... vecs)
+{
+  (vecs.shrink_to_fit(), ...);
+}
+
+std::string_view nameOf(const CppObj* obj)
+{
+  switch (obj->objType_)
+  {
+    case CppObjType::kCompound:
+      return static_cast<const CppCompound*>(obj)->name();
+    case CppObjType::kFunction:
+    case CppObjType::kConstructor:
+    case CppObjType::kDestructor:
+    case CppObjType::kTypeConverter:
+    case CppObjType::kFunctionPtr:
+      return static_cast<const CppFunctionBase*>(obj)->name_.str();
+    case CppObjType::kVar:
+      return static_cast<const CppVar*>(obj)->name();
+    case CppObjType::kVarList:
+      return static_cast<const CppVarList*>(obj)->firstVar()->name();
+    case CppObjType::kTypedefName:
+      return static_cast<const CppTypedefName*>(obj)->var_->name();
+    case CppObjType::kTypedefNameList:
+      return static_cast<const CppTypedefList*>(obj)->varList_->firstVar()->name();
+    case CppObjType::kEnum:
+      return static_cast<const CppEnum*>(obj)->name_;
+    case CppObjType::kFwdClsDecl:
+      return static_cast<const CppFwdClsDecl*>(obj)->name_;
+    case CppObjType::kUsingDecl:
+      return static_cast<const CppUsingDecl*>(obj)->name_;
+    case CppObjType::kNamespaceAlias:
+      return static_cast<const CppNamespaceAlias*>(obj)->name_;
+
+    default:
+      return std::string_view();
+  }
+}
+
+void addParams(const CppParamVector* params, std::vector<const CppObj*>& children)
+{
+  if (!params)
+    return;
+  for (const auto& param : *params)
+  {
+    if (param)
+      children.push_back(param.get());
+  }
+}
+
+void addChild(const CppObj* child, std::vector<const CppObj*>& children)
+{
+  if (child)
+    children.push_back(child);
+}
+
+/**
+ * Appends children of \a obj to \a children, in the order they are in the source.
+ */
+void collectChildren(const CppObj* obj, std::vector<const CppObj*>& children)
+{
+  switch (obj->objType_)
+  {
+    case CppObjType::kCompound:
+      for (const auto& mem : static_cast<const CppCompound*>(obj)->members())
+        children.push_back(mem.get());
+      break;
+    case CppObjType::kFunction:
+    case CppObjType::kConstructor:
+    case CppObjType::kFunctionPtr:
+      addParams(static_cast<const CppFuncCtorBase*>(obj)->params(), children);
+      addChild(static_cast<const CppFuncCtorBase*>(obj)->defn(), children);
+      break;
+    case CppObjType::kDestructor:
+    case CppObjType::kTypeConverter:
+      addChild(static_cast<const CppFunctionBase*>(obj)->defn(), children);
+      break;
+    case CppObjType::kVar:
+      addChild(static_cast<const CppVar*>(obj)->varType()->compound(), children);
+      break;
+    case CppObjType::kVarList:
+      addChild(static_cast<const CppVarList*>(obj)->firstVar().get(), children);
+      break;
+    case CppObjType::kTypedefName:
+      addChild(static_cast<const CppTypedefName*>(obj)->var_.get(), children);
+      break;
+    case CppObjType::kTypedefNameList:
+      addChild(static_cast<const CppTypedefList*>(obj)->varList_.get(), children);
+      break;
+    case CppObjType::kUsingDecl:
+    {
+      const auto* usingDecl = static_cast<const CppUsingDecl*>(obj);
+      if (usingDecl->cppObj_ && (usingDecl->cppObj_->objType_ != CppObjType::kVarType))
+        children.push_back(usingDecl->cppObj_.get());
+    }
+    break;
+    case CppObjType::kIfBlock:
+    {
+      const auto* ifBlock = static_cast<const CppIfBlock*>(obj);
+      addChild(ifBlock->body_.get(), children);
+      addChild(ifBlock->elsePart(), children);
+    }
+    break;
+    case CppObjType::kWhileBlock:
+      addChild(static_cast<const CppWhileBlock*>(obj)->body_.get(), children);
+      break;
+    case CppObjType::kDoWhileBlock:
+      addChild(static_cast<const CppDoWhileBlock*>(obj)->body_.get(), children);
+      break;
+    case CppObjType::kForBlock:
+      addChild(static_cast<const CppForBlock*>(obj)->body_.get(), children);
+      break;
+    case CppObjType::kRangeForBlock:
+    {
+      const auto* rangeForBlock = static_cast<const CppRangeForBlock*>(obj);
+      addChild(rangeForBlock->var_.get(), children);
+      addChild(rangeForBlock->body_.get(), children);
+    }
+    break;
+    case CppObjType::kSwitchBlock:
+    {
+      const auto* switchBlock = static_cast<const CppSwitchBlock*>(obj);
+      if (switchBlock->body_)
+      {
+        for (const auto& caseStmt : *(switchBlock->body_))
+          addChild(caseStmt.body_.get(), children);
+      }
+    }
+    break;
+    case CppObjType::kTryBlock:
+    {
+      const auto* tryBlock = static_cast<const CppTryBlock*>(obj);
+      addChild(tryBlock->tryStmt_.get(), children);
+      for (const auto& catchBlock : tryBlock->catchBlocks())
+        addChild(catchBlock->catchStmt_.get(), children);
+    }
+    break;
+
+    default:
+      break;
+  }
+}
+
+} // namespace
+
+/**
+ * Fills arrays of CppFrozenAst.
+ * Nodes are numbered in preorder using an explicit stack, so that deep ASTs can't overflow the call stack.
+ */
+class CppFrozenAstBuilder
+{
+  using StrRef = CppFrozenAst::StrRef;
+
+public:
+  CppFrozenAstBuilder(CppFrozenAst& ast)
+    : ast_(ast)
+  {
+  }
+
+  void build(const CppCompound& root)
+  {
+    std::vector<const CppObj*> children;
+    pending_.emplace_back(&root, kNoFrozenNode);
+    while (!pending_.empty())
+    {
+      const auto [obj, parent] = pending_.back();
+      pending_.pop_back();
+      const auto id = static_cast<CppFrozenNodeId>(ast_.objTypes_.size());
+      addNode(obj, parent);
+
+      children.clear();
+      collectChildren(obj, children);
+      for (auto itr = children.rbegin(); itr != children.rend(); ++itr)
+        pending_.emplace_back(*itr, id);
+    }
+    linkChildren();
+    shrink();
+  }
+
+private:
+  StrRef addStr(std::string_view str)
+  {
+    if (str.empty())
+      return StrRef {0, 0};
+    const auto itr = strRefs_.find(std::string(str));
+    if (itr != strRefs_.end())
+      return itr->second;
+    const StrRef ref {static_cast<std::uint32_t>(ast_.strPool_.size()), static_cast<std::uint32_t>(str.size())};
+    ast_.strPool_.append(str);
+    strRefs_.emplace(std::string(str), ref);
+    return ref;
+  }
+
+  std::uint32_t addType(const CppVarType* varType)
+  {
+    ast_.typeBaseTypes_.push_back(addStr(varType->baseType()));
+    ast_.typeModifiers_.push_back(varType->typeModifier());
+    ast_.typeAttrs_.push_back(varType->typeAttr());
+    return static_cast<std::uint32_t>(ast_.typeAttrs_.size() - 1);
+  }
+
+  void addNode(const CppObj* obj, CppFrozenNodeId parent);
+  void linkChildren();
+  void shrink();
+
+private:
+  CppFrozenAst&                                          ast_;
+  std::vector<std::pair<const CppObj*, CppFrozenNodeId>> pending_;
+  std::unordered_map<std::string, StrRef>                strRefs_;
+  std::vector<CppFrozenNodeId>                           funcsWithDefn_;
+};
+
+void CppFrozenAstBuilder::addNode(const CppObj* obj, CppFrozenNodeId parent)
+{
+  ast_.objTypes_.push_back(obj->objType_);
+  ast_.accessTypes_.push_back(obj->accessType_);
+  ast_.names_.push_back(addStr(nameOf(obj)));
+  ast_.parents_.push_back(parent);
+
+  std::uint32_t detail = 0;
+  switch (obj->objType_)
+  {
+    case CppObjType::kCompound:
+    {
+      const auto* compound = static_cast<const CppCompound*>(obj);
+      detail               = static_cast<std::uint32_t>(ast_.compoundTypes_.size());
+      ast_.compoundTypes_.push_back(compound->compoundType());
+      ast_.compoundAttrs_.push_back(compound->attr());
+      if (ast_.baseStarts_.empty())
+        ast_.baseStarts_.push_back(0);
+      if (const auto& inheritanceList = compound->inheritanceList())
+      {
+        for (const auto& inheritInfo : *inheritanceList)
+        {
+          ast_.baseNames_.push_back(addStr(inheritInfo.baseName.str()));
+          ast_.baseInhTypes_.push_back(inheritInfo.inhType);
+          ast_.baseIsVirtual_.push_back(inheritInfo.isVirtual);
+        }
+      }
+      ast_.baseStarts_.push_back(static_cast<std::uint32_t>(ast_.baseNames_.size()));
+    }
+    break;
+    case CppObjType::kFunction:
+    case CppObjType::kConstructor:
+    case CppObjType::kDestructor:
+    case CppObjType::kTypeConverter:
+    case CppObjType::kFunctionPtr:
+    {
+      const auto*       func      = static_cast<const CppFunctionBase*>(obj);
+      const CppVarType* retType   = nullptr;
+      std::uint32_t     numParams = 0;
+      if ((obj->objType_ == CppObjType::kFunction) || (obj->objType_ == CppObjType::kFunctionPtr))
+        retType = static_cast<const CppFunction*>(obj)->retType_.get();
+      else if (obj->objType_ == CppObjType::kTypeConverter)
+        retType = static_cast<const CppTypeConverter*>(obj)->to_.get();
+      if ((obj->objType_ != CppObjType::kDestructor) && (obj->objType_ != CppObjType::kTypeConverter))
+      {
+        if (const auto* params = static_cast<const CppFuncCtorBase*>(obj)->params())
+          numParams = static_cast<std::uint32_t>(std::count_if(
+            params->begin(), params->end(), [](const CppObjPtr& param) { return param != nullptr; }));
+      }
+
+      detail = static_cast<std::uint32_t>(ast_.funcAttrs_.size());
+      ast_.funcAttrs_.push_back(func->attr());
+      ast_.funcRetTypes_.push_back(retType ? addType(retType) : ~std::uint32_t(0));
+      ast_.funcNumParams_.push_back(numParams);
+      ast_.funcDefns_.push_back(kNoFrozenNode);
+      // Definition is the last child, its id is known only after the params are numbered.
+      if (func->defn())
+        funcsWithDefn_.push_back(static_cast<CppFrozenNodeId>(ast_.objTypes_.size() - 1));
+    }
+    break;
+    case CppObjType::kVar:
+      detail = static_cast<std::uint32_t>(ast_.varTypes_.size());
+      ast_.varTypes_.push_back(addType(static_cast<const CppVar*>(obj)->varType()));
+      break;
+
+    default:
+      break;
+  }
+  ast_.details_.push_back(detail);
+}
+
+void CppFrozenAstBuilder::linkChildren()
+{
+  const auto numNodes = ast_.objTypes_.size();
+
+  // Ids are in preorder, so siblings are in increasing order of ids and children are bucketed by parent in one pass.
+  ast_.childStarts_.assign(numNodes + 1, 0);
+  for (size_t id = 1; id < numNodes; ++id)
+    ++ast_.childStarts_[ast_.parents_[id] + 1];
+  for (size_t id = 0; id < numNodes; ++id)
+    ast_.childStarts_[id + 1] += ast_.childStarts_[id];
+  ast_.childIds_.resize(numNodes ? numNodes - 1 : 0);
+  std::vector<std::uint32_t> nextChildPos(ast_.childStarts_.begin(), ast_.childStarts_.end() - 1);
+  for (size_t id = 1; id < numNodes; ++id)
+    ast_.childIds_[nextChildPos[ast_.parents_[id]]++] = static_cast<CppFrozenNodeId>(id);
+
+  ast_.subtreeEnds_.resize(numNodes);
+  for (size_t id = numNodes; id-- > 0;)
+  {
+    const auto children   = ast_.children(static_cast<CppFrozenNodeId>(id));
+    ast_.subtreeEnds_[id] = children.empty() ? static_cast<CppFrozenNodeId>(id + 1)
+                                             : ast_.subtreeEnds_[children[children.size() - 1]];
+  }
+
+  for (const auto id : funcsWithDefn_)
+  {
+    const auto children                = ast_.children(id);
+    ast_.funcDefns_[ast_.details_[id]] = children[children.size() - 1];
+  }
+}
+
+void CppFrozenAstBuilder::shrink()
+{
+  shrinkToFit(ast_.objTypes_,
+              ast_.accessTypes_,
+              ast_.names_,
+              ast_.parents_,
+              ast_.subtreeEnds_,
+              ast_.childStarts_,
+              ast_.details_,
+              ast_.childIds_,
+              ast_.compoundTypes_,
+              ast_.compoundAttrs_,
+              ast_.baseStarts_,
+              ast_.baseNames_,
+              ast_.baseInhTypes_,
+              ast_.baseIsVirtual_,
+              ast_.funcAttrs_,
+              ast_.funcRetTypes_,
+              ast_.funcNumParams_,
+              ast_.funcDefns_,
+              ast_.varTypes_,
+              ast_.typeBaseTypes_,
+              ast_.typeModifiers_,
+              ast_.typeAttrs_);
+  ast_.strPool_.shrink_to_fit();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+CppFrozenAst::CppFrozenAst(const CppCompound& root)
+{
+  CppFrozenAstBuilder(*this).build(root);
+}
+
+size_t CppFrozenAst::numBytes() const
+{
+  return capacityBytes(objTypes_,
+                       accessTypes_,
+                       names_,
+                       parents_,
+                       subtreeEnds_,
+                       childStarts_,
+                       details_,
+                       childIds_,
+                       compoundTypes_,
+                       compoundAttrs_,
+                       baseStarts_,
+                       baseNames_,
+                       baseInhTypes_,
+                       baseIsVirtual_,
+                       funcAttrs_,
+                       funcRetTypes_,
+                       funcNumParams_,
+                       funcDefns_,
+                       varTypes_,
+                       typeBaseTypes_,
+                       typeModifiers_,
+                       typeAttrs_)
+         + strPool_.capacity();
+}
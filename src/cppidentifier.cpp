@@ -0,0 +1,128 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "cppidentifier.h"
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+/**
+ * Symbol table is split in shards, each guarded by its own mutex, so that parsers running concurrently rarely contend.
+ */
+class SymbolTable
+{
+public:
+  const std::string* intern(std::string_view str)
+  {
+    auto&                       shard = shardOf(str);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto itr = shard.index.find(str);
+    if (itr != shard.index.end())
+      return itr->second;
+
+    // Elements of std::deque are not moved when new ones are appended.
+    const auto& interned = shard.strings.emplace_back(str);
+    shard.index.emplace(interned, &interned);
+    ++numInterned_;
+
+    return &interned;
+  }
+
+  const std::string* find(std::string_view str)
+  {
+    auto&                       shard = shardOf(str);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto itr = shard.index.find(str);
+    return (itr == shard.index.end()) ? nullptr : itr->second;
+  }
+
+  size_t numInterned() const
+  {
+    return numInterned_;
+  }
+
+private:
+  struct Shard
+  {
+    std::mutex                                               mutex;
+    std::deque<std::string>                                  strings;
+    std::unordered_map<std::string_view, const std::string*> index;
+  };
+
+  Shard& shardOf(std::string_view str)
+  {
+    return shards_[std::hash<std::string_view>()(str) % shards_.size()];
+  }
+
+private:
+  std::array<Shard, 64> shards_;
+  std::atomic<size_t>   numInterned_ {0};
+};
+
+SymbolTable& symbolTable()
+{
+  // Never destroyed so that identifiers remain valid even in objects destroyed after static destruction begins.
+  static auto* table = new SymbolTable;
+  return *table;
+}
+
+const std::string* emptyString()
+{
+  static const auto* empty = new std::string;
+  return empty;
+}
+
+} // namespace
+
+CppIdentifier::CppIdentifier()
+  : str_(emptyString())
+{
+}
+
+CppIdentifier::CppIdentifier(std::string_view str)
+  : str_(str.empty() ? emptyString() : symbolTable().intern(str))
+{
+}
+
+std::optional<CppIdentifier> CppIdentifier::findInterned(std::string_view str)
+{
+  if (str.empty())
+    return CppIdentifier();
+  const auto* interned = symbolTable().find(str);
+  if (interned == nullptr)
+    return std::nullopt;
+
+  return CppIdentifier(interned);
+}
+
+size_t CppIdentifier::numInterned()
+{
+  return symbolTable().numInterned();
+}
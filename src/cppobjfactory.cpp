@@ -23,24 +23,313 @@
 
 #include "cppobjfactory.h"
 
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+#ifndef _WIN32
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+namespace {
+
+constexpr size_t alignUp(size_t size)
+{
+  return (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+}
+
+constexpr size_t kSlabSizeBits    = 16;
+constexpr size_t kSlabSize        = size_t(1) << kSlabSizeBits;
+constexpr size_t kPageSize        = 4096;
+constexpr size_t kNumSlabPages    = kSlabSize / kPageSize;
+constexpr size_t kMaxSlabNodeSize = kPageSize / 4; // Bigger nodes are allocated on heap.
+
+// References held on a page while it is allocated from, more than number of nodes a page can have.
+constexpr std::uint32_t kOpenPageRefs = std::uint32_t(1) << 31;
+
+/**
+ * Slab of memory that AST nodes are allocated from by CppArenaObjFactory.
+ * Slabs are aligned to their size and so the slab of a node is found from address of the node.
+ * No node crosses a page of slab, and memory of a page goes back to the system once every node in it is deleted and
+ * the thread that allocates from slab has moved past it. Slab itself is freed when that happens to all its pages.
+ * Allocating thread counts nodes of its current page without atomics and adds them to references of page only when it
+ * moves past the page, so only deleting a node costs an atomic operation.
+ */
+struct AstSlab
+{
+  std::atomic<size_t>        numLivePages {kNumSlabPages};
+  std::atomic<std::uint32_t> numPageRefs[kNumSlabPages]; // kOpenPageRefs less number of deleted nodes until closed.
+  size_t                     curPage {0};
+  size_t                     numCurPageNodes {0};
+  size_t                     used; // Offset of free memory in current page from start of slab.
+
+  AstSlab();
+};
+
+constexpr size_t kSlabDataOffset = alignUp(sizeof(AstSlab));
+
+static_assert(kSlabDataOffset + kMaxSlabNodeSize <= kPageSize, "First page must have room for the biggest slab node.");
+
+AstSlab::AstSlab()
+  : used(kSlabDataOffset)
+{
+  for (auto& numRefs : numPageRefs)
+    numRefs.store(kOpenPageRefs, std::memory_order_relaxed);
+}
+
+/**
+ * Tells whether an address is in a slab, using one bit for every slab sized block of address space.
+ * Like page maps of memory allocators the bits live in leaves that are created on first use and are never freed.
+ * Slabs at addresses beyond kAddressBits are not used.
+ */
+class SlabMap
+{
+public:
+  static bool add(const AstSlab* slab)
+  {
+    const auto addr = reinterpret_cast<std::uintptr_t>(slab);
+    if ((addr >> kAddressBits) != 0)
+      return false;
+    auto& root = roots_[rootIndex(addr)];
+    auto* leaf = root.load(std::memory_order_acquire);
+    if (leaf == nullptr)
+    {
+      auto* newLeaf = new (std::nothrow) Leaf();
+      if (newLeaf == nullptr)
+        return false;
+      if (root.compare_exchange_strong(leaf, newLeaf, std::memory_order_acq_rel))
+        leaf = newLeaf;
+      else
+        delete newLeaf;
+    }
+    leaf->bits[wordIndex(addr)].fetch_or(bitMask(addr), std::memory_order_release);
+    return true;
+  }
+
+  static void remove(const AstSlab* slab)
+  {
+    const auto addr = reinterpret_cast<std::uintptr_t>(slab);
+    roots_[rootIndex(addr)].load(std::memory_order_acquire)->bits[wordIndex(addr)].fetch_and(
+      ~bitMask(addr), std::memory_order_release);
+  }
+
+  static AstSlab* find(const void* ptr)
+  {
+    const auto addr = reinterpret_cast<std::uintptr_t>(ptr);
+    if ((addr >> kAddressBits) != 0)
+      return nullptr;
+    const auto* leaf = roots_[rootIndex(addr)].load(std::memory_order_acquire);
+    if ((leaf == nullptr) || ((leaf->bits[wordIndex(addr)].load(std::memory_order_acquire) & bitMask(addr)) == 0))
+      return nullptr;
+    return reinterpret_cast<AstSlab*>(addr & ~(kSlabSize - 1));
+  }
+
+private:
+  static constexpr size_t kAddressBits = 48;
+  static constexpr size_t kLeafBits    = 20;
+  static constexpr size_t kRootBits    = kAddressBits - kSlabSizeBits - kLeafBits;
+
+  struct Leaf
+  {
+    std::atomic<std::uint64_t> bits[(size_t(1) << kLeafBits) / 64];
+  };
+
+  static size_t rootIndex(std::uintptr_t addr)
+  {
+    return addr >> (kSlabSizeBits + kLeafBits);
+  }
+  static size_t wordIndex(std::uintptr_t addr)
+  {
+    return ((addr >> kSlabSizeBits) & ((size_t(1) << kLeafBits) - 1)) / 64;
+  }
+  static std::uint64_t bitMask(std::uintptr_t addr)
+  {
+    return std::uint64_t(1) << ((addr >> kSlabSizeBits) % 64);
+  }
+
+private:
+  static std::atomic<Leaf*> roots_[size_t(1) << kRootBits];
+};
+
+std::atomic<SlabMap::Leaf*> SlabMap::roots_[size_t(1) << SlabMap::kRootBits];
+
+AstSlab* newSlab()
+{
+  auto* mem = ::operator new(kSlabSize, std::align_val_t(kSlabSize), std::nothrow);
+  if (mem == nullptr)
+    return nullptr;
+  auto* slab = new (mem) AstSlab;
+  if (SlabMap::add(slab))
+    return slab;
+
+  slab->~AstSlab();
+  ::operator delete(mem, std::align_val_t(kSlabSize));
+  return nullptr;
+}
+
+// Memory of a page is given back only if it is a page of the system too.
+bool canDiscardPages()
+{
+#ifndef _WIN32
+  static const bool canDiscard = (sysconf(_SC_PAGESIZE) == kPageSize);
+  return canDiscard;
+#else
+  return false;
+#endif
+}
+
+/**
+ * Drops \a numRefs references to a page of slab.
+ * Memory of the page is not given back if the page was never allocated from.
+ */
+void releasePage(AstSlab* slab, size_t page, std::uint32_t numRefs)
+{
+  if (slab->numPageRefs[page].fetch_sub(numRefs, std::memory_order_acq_rel) != numRefs)
+    return;
+
+  // First page has the slab itself, and a page must be given back before slab can be freed by another thread.
+  if ((numRefs != kOpenPageRefs) && (page != 0) && canDiscardPages())
+  {
+#ifndef _WIN32
+    madvise(reinterpret_cast<char*>(slab) + page * kPageSize, kPageSize, MADV_DONTNEED);
+#endif
+  }
+  if (slab->numLivePages.fetch_sub(1, std::memory_order_acq_rel) == 1)
+  {
+    SlabMap::remove(slab);
+    slab->~AstSlab();
+    ::operator delete(slab, std::align_val_t(kSlabSize));
+  }
+}
+
+// Closes the page being allocated from, nodes allocated in it become its references.
+void closeCurPage(AstSlab* slab)
+{
+  releasePage(slab, slab->curPage, kOpenPageRefs - static_cast<std::uint32_t>(slab->numCurPageNodes));
+}
+
+// Closes the page being allocated from and all pages after it, slab may be freed after this.
+void closeRemainingPages(AstSlab* slab)
+{
+  for (auto page = kNumSlabPages - 1; page > slab->curPage; --page)
+    releasePage(slab, page, kOpenPageRefs);
+  closeCurPage(slab);
+}
+
+struct ThreadSlab
+{
+  AstSlab* slab {nullptr};
+
+  ~ThreadSlab()
+  {
+    if (slab)
+      closeRemainingPages(slab);
+  }
+};
+
+thread_local ThreadSlab gThreadSlab;
+
+void* allocateOnHeap(size_t size)
+{
+  return ::operator new(size);
+}
+
+void* allocateInSlab(size_t size)
+{
+  const auto nodeSize = alignUp(size);
+  if (nodeSize > kMaxSlabNodeSize)
+    return allocateOnHeap(size);
+
+  auto*& slab = gThreadSlab.slab;
+  if (slab && (slab->used + nodeSize > (slab->curPage + 1) * kPageSize))
+  {
+    if (slab->curPage + 1 < kNumSlabPages)
+    {
+      // Page is closed after moving past it because slab may be freed when its last page is closed.
+      const auto fullPage     = slab->curPage;
+      const auto numPageNodes = slab->numCurPageNodes;
+      slab->curPage           = fullPage + 1;
+      slab->numCurPageNodes   = 0;
+      slab->used              = slab->curPage * kPageSize;
+      releasePage(slab, fullPage, kOpenPageRefs - static_cast<std::uint32_t>(numPageNodes));
+    }
+    else
+    {
+      closeCurPage(slab);
+      slab = nullptr;
+    }
+  }
+  if ((slab == nullptr) && ((slab = newSlab()) == nullptr))
+    return allocateOnHeap(size);
+
+  auto* node = reinterpret_cast<char*>(slab) + slab->used;
+  slab->used += nodeSize;
+  ++slab->numCurPageNodes;
+
+  return node;
+}
+
+void freeNode(void* ptr)
+{
+  if (auto* slab = SlabMap::find(ptr))
+    releasePage(slab, static_cast<size_t>(static_cast<char*>(ptr) - reinterpret_cast<char*>(slab)) / kPageSize, 1);
+  else
+    ::operator delete(ptr);
+}
+
+thread_local size_t gNumBytesDeleted = 0;
+
+} // namespace
+
+void* CppAstNode::operator new(std::size_t size)
+{
+  return allocateOnHeap(size);
+}
+
+void* CppAstNode::operator new(std::size_t size, const CppObjFactory& objFactory)
+{
+  return objFactory.arenaBacked() ? allocateInSlab(size) : allocateOnHeap(size);
+}
+
+void CppAstNode::operator delete(void* ptr, std::size_t size)
+{
+  if (ptr == nullptr)
+    return;
+
+  gNumBytesDeleted += size;
+  freeNode(ptr);
+}
+
+void CppAstNode::operator delete(void* ptr, const CppObjFactory&)
+{
+  if (ptr != nullptr)
+    freeNode(ptr);
+}
+
+std::size_t CppAstNode::numBytesDeletedByThisThread()
+{
+  return gNumBytesDeleted;
+}
+
 CppCompound* CppObjFactory::CreateCompound(std::string name, CppAccessType accessType, CppCompoundType type) const
 {
-  return new CppCompound(std::move(name), accessType, type);
+  return new (*this) CppCompound(std::move(name), accessType, type);
 }
 
 CppCompound* CppObjFactory::CreateCompound(CppAccessType accessType, CppCompoundType type) const
 {
-  return new CppCompound(accessType, type);
+  return new (*this) CppCompound(accessType, type);
 }
 
 CppCompound* CppObjFactory::CreateCompound(std::string name, CppCompoundType type) const
 {
-  return new CppCompound(std::move(name), type);
+  return new (*this) CppCompound(std::move(name), type);
 }
 
 CppCompound* CppObjFactory::CreateCompound(CppCompoundType type) const
 {
-  return new CppCompound(type);
+  return new (*this) CppCompound(type);
 }
 
 CppConstructor* CppObjFactory::CreateConstructor(CppAccessType   accessType,
@@ -49,12 +338,12 @@ CppConstructor* CppObjFactory::CreateConstructor(CppAccessType   accessType,
                                                  CppMemInits     memInits,
                                                  unsigned int    attr) const
 {
-  return new CppConstructor(accessType, std::move(name), params, memInits, attr);
+  return new (*this) CppConstructor(accessType, std::move(name), params, memInits, attr);
 }
 
 CppDestructor* CppObjFactory::CreateDestructor(CppAccessType accessType, std::string name, unsigned int attr) const
 {
-  return new CppDestructor(accessType, name, attr);
+  return new (*this) CppDestructor(accessType, name, attr);
 }
 
 CppFunction* CppObjFactory::CreateFunction(CppAccessType   accessType,
@@ -63,10 +352,10 @@ CppFunction* CppObjFactory::CreateFunction(CppAccessType   accessType,
                                            CppParamVector* params,
                                            unsigned int    attr) const
 {
-  return new CppFunction(accessType, std::move(name), retType, params, attr);
+  return new (*this) CppFunction(accessType, std::move(name), retType, params, attr);
 }
 
 CppTypeConverter* CppObjFactory::CreateTypeConverter(CppVarType* type, std::string name) const
 {
-  return new CppTypeConverter(type, std::move(name));
+  return new (*this) CppTypeConverter(type, std::move(name));
 }
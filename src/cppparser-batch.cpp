@@ -0,0 +1,323 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "cppparser.h"
+#include "ast-serializer.h"
+#include "parser.h"
+#include "work-stealing-pool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+
+#  include <cerrno>
+#  include <cstdio>
+#  include <iostream>
+
+#  include <poll.h>
+#  include <sys/resource.h>
+#  include <sys/socket.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+
+namespace {
+
+constexpr size_t kNoFile = static_cast<size_t>(-1);
+
+/**
+ * Parent end of the connection to a worker process.
+ * Parent sends index of a file to parse and worker replies with a ParseResultHeader followed by the serialized AST.
+ */
+struct WorkerProcess
+{
+  pid_t  pid {-1};
+  int    fd {-1};
+  size_t fileIdx {kNoFile}; // File being parsed by this worker.
+};
+
+struct ParseResultHeader
+{
+  std::uint64_t astSize; // 0 when parsing failed.
+};
+
+bool writeAll(int fd, const void* data, size_t size)
+{
+  const auto* cur = static_cast<const char*>(data);
+  while (size > 0)
+  {
+    // send() is used instead of write() to avoid SIGPIPE when the other end has died.
+    const auto n = send(fd, cur, size, MSG_NOSIGNAL);
+    if (n < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    cur += n;
+    size -= n;
+  }
+
+  return true;
+}
+
+bool readAll(int fd, void* data, size_t size)
+{
+  auto* cur = static_cast<char*>(data);
+  while (size > 0)
+  {
+    const auto n = read(fd, cur, size);
+    if (n == 0)
+      return false;
+    if (n < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    cur += n;
+    size -= n;
+  }
+
+  return true;
+}
+
+[[noreturn]] void runWorkerProcess(CppParser& parser, const std::vector<std::string>& files, int fd)
+{
+  std::uint64_t fileIdx = 0;
+  while (readAll(fd, &fileIdx, sizeof(fileIdx)) && (fileIdx < files.size()))
+  {
+    const auto        ast  = parser.parseFile(files[fileIdx]);
+    const auto        data = ast ? serializeAst(*ast) : std::string();
+    ParseResultHeader header {data.size()};
+    if (!writeAll(fd, &header, sizeof(header)) || !writeAll(fd, data.data(), data.size()))
+      break;
+  }
+
+  std::cout.flush();
+  std::fflush(nullptr);
+  // Skip destruction of static objects, they belong to the parent.
+  _exit(0);
+}
+
+class WorkerProcessPool
+{
+public:
+  WorkerProcessPool(CppParser&                      parser,
+                    const CppObjFactory&            objFactory,
+                    const std::vector<std::string>& files,
+                    size_t                          workerMemoryLimit)
+    : parser_(parser)
+    , objFactory_(objFactory)
+    , files_(files)
+    , workerMemoryLimit_(workerMemoryLimit)
+    , asts_(files.size())
+  {
+  }
+
+  std::vector<CppCompoundPtr> run(size_t numProcesses)
+  {
+    numProcesses = std::min(numProcesses, files_.size());
+    for (size_t i = 0; i < numProcesses; ++i)
+    {
+      WorkerProcess worker;
+      if (!spawn(worker))
+        break;
+      workers_.push_back(worker);
+      assignNextFile(workers_.back());
+    }
+
+    std::vector<pollfd> pollFds;
+    while (true)
+    {
+      pollFds.clear();
+      for (const auto& worker : workers_)
+      {
+        if (worker.fileIdx != kNoFile)
+          pollFds.push_back(pollfd {worker.fd, POLLIN, 0});
+      }
+      if (pollFds.empty())
+        break;
+      if (poll(pollFds.data(), pollFds.size(), -1) < 0)
+      {
+        if (errno == EINTR)
+          continue;
+        break;
+      }
+      for (const auto& pollFd : pollFds)
+      {
+        if (pollFd.revents == 0)
+          continue;
+        auto& worker = *std::find_if(
+          workers_.begin(), workers_.end(), [&pollFd](const WorkerProcess& w) { return w.fd == pollFd.fd; });
+        if (receiveResult(worker))
+          assignNextFile(worker);
+        else
+          replace(worker);
+      }
+    }
+
+    for (auto& worker : workers_)
+      retire(worker);
+
+    // Files that could not be handed to any worker process are parsed here.
+    for (; nextFile_ < files_.size(); ++nextFile_)
+      asts_[nextFile_] = parser_.parseFile(files_[nextFile_]);
+
+    return std::move(asts_);
+  }
+
+private:
+  bool spawn(WorkerProcess& worker)
+  {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+      return false;
+
+    // Anything buffered by parent must not be written again by the child.
+    std::cout.flush();
+    std::fflush(nullptr);
+
+    const auto pid = fork();
+    if (pid < 0)
+    {
+      close(fds[0]);
+      close(fds[1]);
+      return false;
+    }
+    if (pid == 0)
+    {
+      close(fds[0]);
+      // Other workers must see EOF when the parent closes its end of their connection.
+      for (const auto& otherWorker : workers_)
+      {
+        if (otherWorker.fd >= 0)
+          close(otherWorker.fd);
+      }
+      if (workerMemoryLimit_)
+      {
+        const rlimit memLimit {workerMemoryLimit_, workerMemoryLimit_};
+        setrlimit(RLIMIT_AS, &memLimit);
+      }
+      runWorkerProcess(parser_, files_, fds[1]);
+    }
+
+    close(fds[1]);
+    worker.pid     = pid;
+    worker.fd      = fds[0];
+    worker.fileIdx = kNoFile;
+
+    return true;
+  }
+
+  void assignNextFile(WorkerProcess& worker)
+  {
+    worker.fileIdx = kNoFile;
+    if (nextFile_ == files_.size())
+      return;
+    const std::uint64_t fileIdx = nextFile_;
+    if (!writeAll(worker.fd, &fileIdx, sizeof(fileIdx)))
+      return replace(worker);
+    worker.fileIdx = nextFile_++;
+  }
+
+  bool receiveResult(WorkerProcess& worker)
+  {
+    ParseResultHeader header;
+    if (!readAll(worker.fd, &header, sizeof(header)))
+      return false;
+    if (header.astSize == 0)
+      return true;
+
+    std::string data(header.astSize, '\0');
+    if (!readAll(worker.fd, data.data(), data.size()))
+      return false;
+    asts_[worker.fileIdx] = deserializeAst(data.data(), data.size(), objFactory_);
+
+    return true;
+  }
+
+  // Worker has died, the file it was parsing is lost and a new worker takes its place.
+  void replace(WorkerProcess& worker)
+  {
+    retire(worker);
+    if ((nextFile_ < files_.size()) && spawn(worker))
+      assignNextFile(worker);
+  }
+
+  static void retire(WorkerProcess& worker)
+  {
+    if (worker.fd >= 0)
+      close(worker.fd);
+    if (worker.pid > 0)
+      waitpid(worker.pid, nullptr, 0);
+    worker = WorkerProcess();
+  }
+
+private:
+  CppParser&                      parser_;
+  const CppObjFactory&            objFactory_;
+  const std::vector<std::string>& files_;
+  const size_t                    workerMemoryLimit_;
+  std::vector<CppCompoundPtr>     asts_;
+  std::vector<WorkerProcess>      workers_;
+  size_t                          nextFile_ {0};
+};
+
+} // namespace
+
+std::vector<CppCompoundPtr> CppParser::parseFilesInWorkerProcesses(const std::vector<std::string>& files,
+                                                                   size_t                          numProcesses,
+                                                                   size_t                          workerMemoryLimit)
+{
+  auto asts = WorkerProcessPool(*this, *objFactory_, files, workerMemoryLimit).run(resolveThreadCount(numProcesses));
+  // Types in ASTs rebuilt from what workers sent are not shared yet.
+  if (config_->shareVarTypes)
+  {
+    for (auto& ast : asts)
+    {
+      if (ast)
+        ::shareVarTypes(ast.get());
+    }
+  }
+
+  return asts;
+}
+
+#else
+
+// Without fork() files are parsed in the calling process.
+std::vector<CppCompoundPtr> CppParser::parseFilesInWorkerProcesses(const std::vector<std::string>& files,
+                                                                   size_t /* numProcesses */,
+                                                                   size_t /* workerMemoryLimit */)
+{
+  std::vector<CppCompoundPtr> asts;
+  for (const auto& file : files)
+    asts.push_back(parseFile(file));
+
+  return asts;
+}
+
+#endif
@@ -0,0 +1,346 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "cppparser.h"
+#include "cppast.h"
+#include "parser.h"
+#include "top-level-splitter.h"
+#include "work-stealing-pool.h"
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Smaller chunks cost more in setting up the parser than what is gained by parsing them concurrently.
+constexpr size_t kMinChunkSize = 4 * 1024;
+// More chunks than threads so that threads that finish early can take over the remaining work.
+constexpr size_t kChunksPerThread = 4;
+
+constexpr size_t kNoChunk = static_cast<size_t>(-1);
+
+struct SourceRange
+{
+  size_t begin;
+  size_t end;
+};
+
+/**
+ * Part of source that is parsed as one unit.
+ * Chunk that has the split extern "C" block has 2 ranges, one before and one after the body of that block.
+ */
+using Chunk = std::vector<SourceRange>;
+
+size_t chunkSize(const Chunk& chunk)
+{
+  size_t size = 0;
+  for (const auto& range : chunk)
+    size += range.end - range.begin;
+  return size;
+}
+
+/**
+ * @return Boundaries that are at least minChunkSize apart. The first and the last of boundaries are always kept.
+ */
+std::vector<size_t> coarsen(const std::vector<size_t>& boundaries, size_t minChunkSize)
+{
+  std::vector<size_t> result;
+  for (size_t i = 0; i < boundaries.size(); ++i)
+  {
+    const bool isLast = (i + 1 == boundaries.size());
+    if (result.empty() || isLast || (boundaries[i] - result.back() >= minChunkSize))
+      result.push_back(boundaries[i]);
+  }
+
+  return result;
+}
+
+void moveMembers(CppCompound& from, CppCompound& to)
+{
+  // Detached from the back so that remaining members are not shifted every time.
+  std::vector<CppObjPtr> members;
+  while (!from.members().empty())
+    members.push_back(from.deassocMemberAt(from.members().size() - 1));
+  for (auto itr = members.rbegin(); itr != members.rend(); ++itr)
+    to.addMember(itr->release());
+}
+
+/**
+ * Parses chunks of source without reporting errors, caller decides what to do when a chunk fails.
+ */
+class ChunkParser
+{
+public:
+  ChunkParser(const ParserConfig& config, const CppObjFactory& objFactory, ParseStats& stats)
+    : config_(config)
+    , objFactory_(objFactory)
+    , stats_(stats)
+  {
+    config_.errorHandler = [this](const char*, size_t, size_t, int) { errorReported_ = true; };
+  }
+
+  ChunkParser(const ChunkParser&) = delete;
+  ChunkParser& operator=(const ChunkParser&) = delete;
+
+  CppCompoundPtr parse(const char* stm, const Chunk& chunk)
+  {
+    std::string buffer;
+    buffer.reserve(chunkSize(chunk) + 2);
+    for (const auto& range : chunk)
+      buffer.append(stm + range.begin, range.end - range.begin);
+    // Lexer needs the buffer to end with 2 null characters.
+    buffer.append(2, '\0');
+
+    errorReported_ = false;
+    auto ast       = ::parseStream(buffer.data(), buffer.size(), config_, objFactory_, false, &stats_, &stacks_);
+    if (errorReported_)
+      return nullptr;
+    return ast;
+  }
+
+private:
+  ParserConfig         config_;
+  const CppObjFactory& objFactory_;
+  ParseStats&          stats_;
+  ParseStacks          stacks_;
+  bool                 errorReported_ {false};
+};
+
+/**
+ * Splits source into chunks, parses them concurrently, and stitches the members of all chunks in one AST.
+ */
+class ParallelParse
+{
+public:
+  ParallelParse(const char*          stm,
+                size_t               stmSize,
+                size_t               numThreads,
+                const ParserConfig&  config,
+                const CppObjFactory& objFactory,
+                ParseStats&          stats)
+    : stm_(stm)
+    , numThreads_(numThreads)
+    , config_(config)
+    , objFactory_(objFactory)
+    , stats_(stats)
+  {
+    split(stmSize);
+  }
+
+  bool isSplit() const
+  {
+    return chunks_.size() > 1;
+  }
+
+  /**
+   * @return nullptr if some part of source could not be parsed even together with the neighbouring chunks.
+   */
+  CppCompoundPtr run()
+  {
+    parseChunks();
+
+    ChunkParser serialParser(config_, objFactory_, stats_);
+    if (!reparseFailedChunks(serialParser, 0, numFileChunks_)
+        || !reparseFailedChunks(serialParser, numFileChunks_, chunks_.size()))
+    {
+      return nullptr;
+    }
+
+    return stitch();
+  }
+
+private:
+  void split(size_t stmSize)
+  {
+    const auto boundaries   = findTopLevelBoundaries(stm_, stmSize, config_);
+    const auto numChunks    = resolveThreadCount(numThreads_) * kChunksPerThread;
+    const auto minChunkSize = std::max(kMinChunkSize, boundaries.end / numChunks);
+
+    auto fileLevel = boundaries.fileLevel;
+    fileLevel.push_back(boundaries.end);
+    fileLevel = coarsen(fileLevel, minChunkSize);
+
+    const auto blockLevel = coarsen(boundaries.externCBlockLevel, minChunkSize);
+    // Not worth splitting the extern "C" block if its body is just one chunk.
+    const bool splitBlock = (blockLevel.size() > 2);
+
+    for (size_t i = 0; i + 1 < fileLevel.size(); ++i)
+    {
+      const SourceRange range {fileLevel[i], fileLevel[i + 1]};
+      if (splitBlock && (range.begin <= blockLevel.front()) && (blockLevel.back() <= range.end))
+      {
+        externCChunk_ = chunks_.size();
+        chunks_.push_back({{range.begin, blockLevel.front()}, {blockLevel.back(), range.end}});
+      }
+      else
+      {
+        chunks_.push_back({range});
+      }
+    }
+    numFileChunks_ = chunks_.size();
+
+    if (externCChunk_ != kNoChunk)
+    {
+      for (size_t i = 0; i + 1 < blockLevel.size(); ++i)
+        chunks_.push_back({{blockLevel[i], blockLevel[i + 1]}});
+    }
+  }
+
+  void parseChunks()
+  {
+    std::vector<size_t> largestFirst(chunks_.size());
+    std::iota(largestFirst.begin(), largestFirst.end(), 0);
+    std::stable_sort(largestFirst.begin(), largestFirst.end(), [&](size_t lhs, size_t rhs) {
+      return chunkSize(chunks_[lhs]) > chunkSize(chunks_[rhs]);
+    });
+
+    asts_.resize(chunks_.size());
+    std::vector<std::optional<ChunkParser>> parsers(resolveThreadCount(numThreads_));
+    runOnWorkStealingPool(largestFirst, numThreads_, [&](size_t worker, size_t chunkIdx) {
+      if (!parsers[worker])
+        parsers[worker].emplace(config_, objFactory_, stats_);
+      asts_[chunkIdx] = parsers[worker]->parse(stm_, chunks_[chunkIdx]);
+    });
+  }
+
+  /**
+   * Parses every run of failed chunks in [begin, end) again along with one chunk on either side of it.
+   * ASTs of the chunks that are merged with the one before them are left null.
+   * @return false if a merged chunk fails too, or if the extern "C" chunk fails, because it can't be merged.
+   */
+  bool reparseFailedChunks(ChunkParser& parser, size_t begin, size_t end)
+  {
+    // Chunks before this one have been merged already.
+    auto mergeableBegin = begin;
+    for (auto i = begin; i < end; ++i)
+    {
+      if (asts_[i])
+        continue;
+      auto runEnd = i + 1;
+      while ((runEnd < end) && !asts_[runEnd])
+        ++runEnd;
+      if ((externCChunk_ >= i) && (externCChunk_ < runEnd))
+        return false;
+
+      const auto first = ((i > mergeableBegin) && (i - 1 != externCChunk_)) ? i - 1 : i;
+      const auto last  = ((runEnd < end) && (runEnd != externCChunk_)) ? runEnd : runEnd - 1;
+      const Chunk merged {{chunks_[first].front().begin, chunks_[last].back().end}};
+      auto        ast = parser.parse(stm_, merged);
+      if (!ast)
+        return false;
+      for (auto j = first; j <= last; ++j)
+        asts_[j].reset();
+      asts_[first]   = std::move(ast);
+      i              = last;
+      mergeableBegin = last + 1;
+    }
+
+    return true;
+  }
+
+  CppCompoundPtr stitch()
+  {
+    if (externCChunk_ != kNoChunk)
+    {
+      // Body of the block was cut out of this chunk, so it's the only extern "C" block in there without any member.
+      CppCompound* externCBlock = nullptr;
+      for (const auto& mem : asts_[externCChunk_]->members())
+      {
+        CppEasyPtr<CppCompound> block = mem;
+        if (!block || (block->compoundType() != CppCompoundType::kExternCBlock) || !block->members().empty())
+          continue;
+        if (externCBlock)
+          return nullptr;
+        externCBlock = block;
+      }
+      if (externCBlock == nullptr)
+        return nullptr;
+
+      for (auto i = numFileChunks_; i < chunks_.size(); ++i)
+      {
+        if (asts_[i])
+          moveMembers(*asts_[i], *externCBlock);
+      }
+    }
+
+    CppCompoundPtr result;
+    for (size_t i = 0; i < numFileChunks_; ++i)
+    {
+      if (!asts_[i])
+        continue;
+      if (result)
+        moveMembers(*asts_[i], *result);
+      else
+        result = std::move(asts_[i]);
+    }
+
+    return result;
+  }
+
+private:
+  const char*          stm_;
+  const size_t         numThreads_;
+  const ParserConfig&  config_;
+  const CppObjFactory& objFactory_;
+  ParseStats&          stats_;
+
+  std::vector<Chunk>          chunks_; // Chunks of file level followed by those of the extern "C" block.
+  size_t                      numFileChunks_ {0};
+  size_t                      externCChunk_ {kNoChunk};
+  std::vector<CppCompoundPtr> asts_;
+};
+
+} // namespace
+
+CppCompoundPtr CppParser::parseFileInParallel(const std::string& filename, size_t numThreads)
+{
+  const auto source = CppSourceBuffer::fromFile(filename);
+  if (!source)
+    return nullptr;
+  auto cppCompound = parseStreamInParallel(source->data(), source->lexerBufferSize(), numThreads);
+  if (!cppCompound)
+    return cppCompound;
+  cppCompound->name(filename);
+  return cppCompound;
+}
+
+CppCompoundPtr CppParser::parseStreamInParallel(const char* stm, size_t stmSize, size_t numThreads)
+{
+  if (stm == nullptr || stmSize == 0)
+    return nullptr;
+
+  ParallelParse parallelParse(stm, stmSize, numThreads, *config_, *objFactory_, *stats_);
+  if (parallelParse.isSplit())
+  {
+    auto ast = parallelParse.run();
+    if (ast)
+      return ast;
+  }
+
+  // Whole source is parsed serially for errors to be reported with the right line numbers.
+  std::string buffer(stm, stmSize);
+  return parseStream(buffer.data(), buffer.size());
+}
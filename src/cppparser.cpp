@@ -26,7 +26,6 @@
 #include "cppobjfactory.h"
 #include "parser.h"
 #include "string-utils.h"
-#include "utils.h"
 
 #include <algorithm>
 #include <map>
@@ -34,76 +33,78 @@
 #include <string>
 #include <vector>
 
-// Unfortunately parser is not reentrant and has no way as of now to inject parameters.
-// So, we need globals.
-
-// Globals to help parse when preprocessors are used
-std::set<std::string>      gMacroNames;
-std::set<std::string>      gKnownApiDecorNames;
-std::map<std::string, int> gDefinedNames;
-std::set<std::string>      gUndefinedNames;
-std::set<std::string>      gIgnorableMacroNames;
-std::map<std::string, int> gRenamedKeywords;
-
-bool gParseEnumBodyAsBlob     = false;
-bool gParseFunctionBodyAsBlob = false;
-
-CppObjFactory* gObjFactory = nullptr;
-
 CppParser::CppParser(CppObjFactoryPtr objFactory)
   : objFactory_(std::move(objFactory))
+  , config_(new ParserConfig)
+  , stats_(new ParseStats)
+  , stacks_(new ParseStacks)
 {
   if (!objFactory_)
     objFactory_.reset(new CppObjFactory);
 }
 
+CppParser::CppParser(CppParser&& rhs) = default;
+
+CppParser::~CppParser() = default;
+
+static void updateIdentifierClassifier(ParserConfig& config)
+{
+  config.identifierClassifier = IdentifierClassifier(config);
+}
+
 void CppParser::addKnownMacro(std::string knownMacro)
 {
-  gMacroNames.insert(std::move(knownMacro));
+  config_->macroNames.insert(std::move(knownMacro));
+  updateIdentifierClassifier(*config_);
 }
 
 void CppParser::addKnownMacros(const std::vector<std::string>& knownMacros)
 {
   for (auto& macro : knownMacros)
-    gMacroNames.insert(macro);
+    config_->macroNames.insert(macro);
+  updateIdentifierClassifier(*config_);
 }
 
 void CppParser::addDefinedName(std::string definedName, int value)
 {
-  gDefinedNames[std::move(definedName)] = value;
+  config_->definedNames[std::move(definedName)] = value;
 }
 
 void CppParser::addUndefinedName(std::string undefinedName)
 {
-  gUndefinedNames.insert(std::move(undefinedName));
+  config_->undefinedNames.insert(std::move(undefinedName));
 }
 
 void CppParser::addUndefinedNames(const std::vector<std::string>& undefinedNames)
 {
   for (auto& macro : undefinedNames)
-    gUndefinedNames.insert(macro);
+    config_->undefinedNames.insert(macro);
 }
 
 void CppParser::addIgnorableMacro(std::string ignorableMacro)
 {
-  gIgnorableMacroNames.insert(std::move(ignorableMacro));
+  config_->ignorableMacroNames.insert(std::move(ignorableMacro));
+  updateIdentifierClassifier(*config_);
 }
 
 void CppParser::addIgnorableMacros(const std::vector<std::string>& ignorableMacros)
 {
   for (auto& macro : ignorableMacros)
-    gIgnorableMacroNames.insert(macro);
+    config_->ignorableMacroNames.insert(macro);
+  updateIdentifierClassifier(*config_);
 }
 
 void CppParser::addKnownApiDecor(std::string knownApiDecor)
 {
-  gKnownApiDecorNames.insert(std::move(knownApiDecor));
+  config_->knownApiDecorNames.insert(std::move(knownApiDecor));
+  updateIdentifierClassifier(*config_);
 }
 
 void CppParser::addKnownApiDecors(const std::vector<std::string>& knownApiDecor)
 {
   for (auto& apiDecor : knownApiDecor)
-    gKnownApiDecorNames.insert(apiDecor);
+    config_->knownApiDecorNames.insert(apiDecor);
+  updateIdentifierClassifier(*config_);
 }
 
 bool CppParser::addRenamedKeyword(const std::string& keyword, std::string renamedKeyword)
@@ -112,28 +113,57 @@ bool CppParser::addRenamedKeyword(const std::string& keyword, std::string rename
   auto       id = GetKeywordId(keyword);
   if (id == -1)
     return false;
-  gRenamedKeywords.emplace(std::make_pair(std::move(renamedKeyword), id));
+  config_->renamedKeywords.emplace(std::make_pair(std::move(renamedKeyword), id));
+  updateIdentifierClassifier(*config_);
 
   return true;
 }
 
 void CppParser::parseEnumBodyAsBlob()
 {
-  gParseEnumBodyAsBlob = true;
+  config_->parseEnumBodyAsBlob = true;
 }
 
 void CppParser::parseFunctionBodyAsBlob(bool asBlob)
 {
-  gParseFunctionBodyAsBlob = asBlob;
+  config_->parseFunctionBodyAsBlob = asBlob;
+}
+
+void CppParser::retainSourceBuffer(bool retain)
+{
+  config_->retainSourceBuffer = retain;
+}
+
+void CppParser::shareVarTypes(bool share)
+{
+  config_->shareVarTypes = share;
+}
+
+void CppParser::ignoreComments(bool ignore)
+{
+  config_->ignoreComments = ignore;
 }
 
 CppCompoundPtr CppParser::parseFile(const std::string& filename)
 {
-  auto stm         = readFile(filename);
-  auto cppCompound = parseStream(stm.data(), stm.size());
+  auto source = CppSourceBuffer::fromFile(filename);
+  if (!source)
+    return nullptr;
+  auto cppCompound = ::parseStream(source->lexerBuffer(),
+                                   source->lexerBufferSize(),
+                                   *config_,
+                                   *objFactory_,
+                                   config_->retainSourceBuffer,
+                                   stats_.get(),
+                                   stacks_.get());
   if (!cppCompound)
     return cppCompound;
   cppCompound->name(filename);
+  if (config_->retainSourceBuffer)
+  {
+    source->releaseWrittenPages();
+    cppCompound->retainSource(std::move(source));
+  }
   return cppCompound;
 }
 
@@ -141,16 +171,51 @@ CppCompoundPtr CppParser::parseStream(char* stm, size_t stmSize)
 {
   if (stm == nullptr || stmSize == 0)
     return nullptr;
-  gObjFactory = objFactory_.get();
-  return ::parseStream(stm, stmSize);
+  return ::parseStream(stm, stmSize, *config_, *objFactory_, false, stats_.get(), stacks_.get());
+}
+
+CppCompoundPtr CppParser::parseStream(std::string_view stm)
+{
+  if (stm.empty())
+    return nullptr;
+  const auto source = CppSourceBuffer::fromText(stm);
+  return ::parseStream(
+    source->lexerBuffer(), source->lexerBufferSize(), *config_, *objFactory_, false, stats_.get(), stacks_.get());
+}
+
+std::vector<CppLexToken> CppParser::tokenize(char* stm, size_t stmSize)
+{
+  if (stm == nullptr || stmSize == 0)
+    return {};
+  return tokenizeStream(stm, stmSize, *config_);
+}
+
+size_t CppParser::numBytesReclaimed() const
+{
+  return stats_->numBytesReclaimed;
+}
+
+size_t CppParser::numTrialParses() const
+{
+  return stats_->numTrialParses;
+}
+
+size_t CppParser::numTokensReplayed() const
+{
+  return stats_->numTokensReplayed;
+}
+
+size_t CppParser::numBytesCopiedForTrials() const
+{
+  return stats_->numBytesCopiedForTrials;
 }
 
 void CppParser::setErrorHandler(ErrorHandler errorHandler)
 {
-  ::setErrorHandler(errorHandler);
+  config_->errorHandler = std::move(errorHandler);
 }
 
 void CppParser::resetErrorHandler()
 {
-  ::resetErrorHandler();
+  config_->errorHandler = defaultErrorHandler;
 }
@@ -30,7 +30,16 @@
 #include "cppobj-info-accessor.h"
 #include "cppvar-info-accessor.h"
 
+#include "work-stealing-pool.h"
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
 #include <iostream>
+#include <numeric>
+#include <optional>
+
+namespace bfs = boost::filesystem;
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -52,6 +61,51 @@ CppProgram::CppProgram(const std::string& folder, CppParser parser, const CppPro
 {
 }
 
+CppProgram::CppProgram(const std::vector<std::string>& files,
+                       size_t                          numThreads,
+                       const CppParserFactory&         parserFactory)
+{
+  cppObjToTypeNode_[nullptr] = &cppTypeTreeRoot_;
+
+  std::vector<uintmax_t> fileSizes(files.size());
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    boost::system::error_code ec;
+    fileSizes[i] = bfs::file_size(files[i], ec);
+    if (ec)
+      fileSizes[i] = 0;
+  }
+  std::vector<size_t> largestFirst(files.size());
+  std::iota(largestFirst.begin(), largestFirst.end(), 0);
+  std::stable_sort(largestFirst.begin(), largestFirst.end(), [&](size_t lhs, size_t rhs) {
+    return fileSizes[lhs] > fileSizes[rhs];
+  });
+
+  std::vector<std::optional<CppParser>> parsers(resolveThreadCount(numThreads));
+  std::vector<CppCompoundPtr>           fileAsts(files.size());
+  runOnWorkStealingPool(largestFirst, numThreads, [&](size_t worker, size_t fileIdx) {
+    if (!parsers[worker])
+      parsers[worker].emplace(parserFactory());
+    fileAsts[fileIdx] = parsers[worker]->parseFile(files[fileIdx]);
+  });
+
+  // Type tree is built in the order of files so that it is the same as that of serially built program.
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    std::cout << "INFO\t Parsed '" << files[i] << "'\n";
+    if (fileAsts[i])
+      addCppAst(std::move(fileAsts[i]));
+  }
+}
+
+CppProgram::CppProgram(const std::string&         folder,
+                       size_t                     numThreads,
+                       const CppParserFactory&    parserFactory,
+                       const CppProgFileSelecter& fileSelector)
+  : CppProgram(collectFiles(folder, fileSelector), numThreads, parserFactory)
+{
+}
+
 void CppProgram::addCppAst(CppCompoundPtr cppAst)
 {
   if (!isCppFile(cppAst.get()))
@@ -60,11 +114,31 @@ void CppProgram::addCppAst(CppCompoundPtr cppAst)
   fileAsts_.emplace_back(std::move(cppAst));
 }
 
+CppProgramMemoryReport CppProgram::memoryReport() const
+{
+  CppProgramMemoryReport report;
+  report.files.reserve(fileAsts_.size());
+  for (const auto& fileAst : fileAsts_)
+  {
+    CppFileMemoryReport fileReport;
+    fileReport.file = fileAst->name();
+    boost::system::error_code ec;
+    const auto                fileSize = bfs::file_size(fileReport.file, ec);
+    if (!ec)
+      fileReport.sourceBytes = static_cast<size_t>(fileSize);
+    else if (const auto* source = fileAst->retainedSource())
+      fileReport.sourceBytes = source->size();
+    fileReport.ast = fileAst->memoryReport();
+    report.files.push_back(std::move(fileReport));
+  }
+  return report;
+}
+
 void CppProgram::addCompound(const CppCompound* compound, CppTypeTreeNode* parentTypeNode)
 {
   if (compound->name().empty())
     return;
-  auto& childNode = parentTypeNode->children[compound->name()];
+  auto& childNode = parentTypeNode->children[compound->nameId()];
   childNode.cppObjSet.insert(compound);
   childNode.parent            = parentTypeNode;
   cppObjToTypeNode_[compound] = &childNode;
@@ -102,7 +176,7 @@ void CppProgram::loadType(const CppCompound* cppCompound, CppTypeTreeNode* typeN
     else if (isTypedefName(mem))
     {
       auto*            typedefName = static_cast<const CppTypedefName*>(mem);
-      CppTypeTreeNode& childNode   = typeNode->children[typedefName->var_->name()];
+      CppTypeTreeNode& childNode   = typeNode->children[typedefName->var_->nameId()];
       childNode.cppObjSet.insert(mem);
       childNode.parent       = typeNode;
       cppObjToTypeNode_[mem] = &childNode;
@@ -148,9 +222,13 @@ const CppTypeTreeNode* CppProgram::nameLookup(const std::string& name, const Cpp
   size_t nameEndPos = name.find("::", nameBegPos);
   if (nameEndPos == std::string::npos)
   {
+    // A name that was never interned cannot be in type tree.
+    const auto id = CppIdentifier::findInterned(name);
+    if (!id)
+      return NULL;
     for (; typeNode != NULL; typeNode = typeNode->parent)
     {
-      CppTypeTree::const_iterator itr = typeNode->children.find(name);
+      CppTypeTree::const_iterator itr = typeNode->children.find(*id);
       if (itr != typeNode->children.end())
         return &itr->second;
     }
@@ -168,8 +246,10 @@ const CppTypeTreeNode* CppProgram::nameLookup(const std::string& name, const Cpp
       nameEndPos = name.find("::", nameBegPos);
       if (nameEndPos == std::string::npos)
         nameEndPos = name.length();
-      nameToLookFor = name.substr(nameBegPos, nameEndPos - nameBegPos);
-      auto itr      = typeNode->children.find(nameToLookFor);
+      const auto id = CppIdentifier::findInterned(std::string_view(name).substr(nameBegPos, nameEndPos - nameBegPos));
+      if (!id)
+        return nullptr;
+      auto itr = typeNode->children.find(*id);
       if (itr == typeNode->children.end())
         return nullptr;
       typeNode = &itr->second;
@@ -180,6 +260,10 @@ const CppTypeTreeNode* CppProgram::nameLookup(const std::string& name, const Cpp
 
 const CppTypeTreeNode* CppProgram::searchTypeNode(const std::string& name, const CppTypeTreeNode* parentNode) const
 {
+  const auto id = CppIdentifier::findInterned(name);
+  if (!id)
+    return nullptr;
+
   std::vector<const CppTypeTreeNode*> nextLevelNodes(1, parentNode ? parentNode : &cppTypeTreeRoot_);
 
   do
@@ -189,12 +273,12 @@ const CppTypeTreeNode* CppProgram::searchTypeNode(const std::string& name, const
     assert(nextLevelNodes.empty());
     for (const auto* node : currentLevelNodes)
     {
-      for (const auto& child : node->children)
-      {
-        if (child.first == name)
-          return &(child.second);
-        nextLevelNodes.push_back(&(child.second));
-      }
+      const auto itr = node->children.find(*id);
+      if (itr != node->children.end())
+        return &(itr->second);
+      // Order of nodes in next level decides which one is found when the name is in more than one of them.
+      for (const auto* child : node->sortedChildren())
+        nextLevelNodes.push_back(&(child->second));
     }
   } while (!nextLevelNodes.empty());
 
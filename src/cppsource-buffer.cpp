@@ -0,0 +1,161 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "cppsource-buffer.h"
+
+#include <cstring>
+#include <fstream>
+
+#ifndef _WIN32
+
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+
+namespace {
+
+size_t pageSize()
+{
+  static const auto size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return size;
+}
+
+} // namespace
+
+#endif
+
+std::unique_ptr<CppSourceBuffer> CppSourceBuffer::allocate(size_t size)
+{
+  std::unique_ptr<CppSourceBuffer> buffer(new CppSourceBuffer);
+  buffer->ownedData_.reset(new char[size + 3]);
+  buffer->data_ = buffer->ownedData_.get();
+  buffer->size_ = size;
+
+  return buffer;
+}
+
+std::unique_ptr<CppSourceBuffer> CppSourceBuffer::fromText(std::string_view text)
+{
+  auto buffer = allocate(text.size());
+  memcpy(buffer->data_, text.data(), text.size());
+  buffer->terminate();
+
+  return buffer;
+}
+
+std::unique_ptr<CppSourceBuffer> CppSourceBuffer::readFile(const std::string& filename)
+{
+  std::ifstream in(filename, std::ios::in | std::ios::binary);
+  if (!in)
+    return nullptr;
+
+  in.seekg(0, std::ios::end);
+  const auto size = in.tellg();
+  if (size < 0)
+    return nullptr;
+  auto buffer = allocate(static_cast<size_t>(size));
+  in.seekg(0, std::ios::beg);
+  in.read(buffer->data_, buffer->size_);
+  buffer->terminate();
+
+  return buffer;
+}
+
+void CppSourceBuffer::terminate()
+{
+  data_[size_]     = '\n';
+  data_[size_ + 1] = '\0';
+  data_[size_ + 2] = '\0';
+}
+
+#ifndef _WIN32
+
+std::unique_ptr<CppSourceBuffer> CppSourceBuffer::fromFile(const std::string& filename)
+{
+  const int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return nullptr;
+
+  struct stat st;
+  if ((fstat(fd, &st) != 0) || !S_ISREG(st.st_mode))
+  {
+    close(fd);
+    return nullptr;
+  }
+
+  // Zero filled anonymous pages supply the padding past end of file, then the file is mapped over their start.
+  const auto size       = static_cast<size_t>(st.st_size);
+  const auto mappedSize = (size + 3 + pageSize() - 1) / pageSize() * pageSize();
+  auto*      region     = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (region == MAP_FAILED)
+  {
+    close(fd);
+    return readFile(filename);
+  }
+  if ((size != 0) && (mmap(region, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED))
+  {
+    munmap(region, mappedSize);
+    close(fd);
+    return readFile(filename);
+  }
+  close(fd);
+
+  std::unique_ptr<CppSourceBuffer> buffer(new CppSourceBuffer);
+  buffer->data_       = static_cast<char*>(region);
+  buffer->size_       = size;
+  buffer->mappedSize_ = mappedSize;
+  // Only the page this new line is written to gets a private copy.
+  buffer->data_[size] = '\n';
+
+  return buffer;
+}
+
+void CppSourceBuffer::releaseWrittenPages()
+{
+  // Last page of file is skipped as it has the new line written by fromFile().
+  const auto numFullPages = size_ / pageSize();
+  if (isMapped() && (numFullPages != 0))
+    madvise(data_, numFullPages * pageSize(), MADV_DONTNEED);
+}
+
+CppSourceBuffer::~CppSourceBuffer()
+{
+  if (isMapped())
+    munmap(data_, mappedSize_);
+}
+
+#else
+
+std::unique_ptr<CppSourceBuffer> CppSourceBuffer::fromFile(const std::string& filename)
+{
+  return readFile(filename);
+}
+
+void CppSourceBuffer::releaseWrittenPages()
+{
+}
+
+CppSourceBuffer::~CppSourceBuffer() = default;
+
+#endif
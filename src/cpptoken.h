@@ -55,9 +55,26 @@ struct CppToken
     return toString();
   }
 
+  /// @return true if token has '\r', that can only be the case for tokens spanning lines of source with CRLF line ends.
+  bool hasCarriageReturn() const
+  {
+    return sz && std::memchr(sz, '\r', len);
+  }
+
+  /// @return Text of token without '\r', same as that of source whose line ends are all LF.
   std::string toString() const
   {
-    return sz ? std::string(sz, len) : std::string();
+    if (!hasCarriageReturn())
+      return sz ? std::string(sz, len) : std::string();
+
+    std::string text;
+    text.reserve(len);
+    for (size_t i = 0; i < len; ++i)
+    {
+      if (sz[i] != '\r')
+        text += sz[i];
+    }
+    return text;
   }
 };
 
@@ -116,4 +133,19 @@ struct CppNtFuncDeclData
   unsigned int    funcAttr;
 };
 
+/* Non-terminal for enum item, name is null for items like comments or preprocessors */
+struct CppNtEnumItem
+{
+  CppToken name;
+  CppObj*  val;
+};
+
+/* Non-terminal for template parameter, paramType is null for typename/class parameters */
+struct CppNtTemplateParam
+{
+  CppObj*  paramType;
+  CppToken paramName;
+  CppObj*  defaultArg;
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,228 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "cppast.h"
+#include "parser.h"
+
+#include <array>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Process wide set of shared var types, split in shards like the symbol table of CppIdentifier.
+ */
+class CppVarTypePool
+{
+public:
+  CppVarType* canonical(const CppVarType& varType)
+  {
+    const auto                  hash  = varType.computeStructuralHash();
+    auto&                       shard = shards_[hash % shards_.size()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto itr = shard.types.find(const_cast<CppVarType*>(&varType));
+    if (itr != shard.types.end())
+      return *itr;
+
+    // Allocated on heap even if varType is in an arena because it has to outlive every AST.
+    auto* shared    = new CppVarType(varType);
+    shared->shared_ = true;
+    shared->hash_   = hash;
+    shard.types.insert(shared);
+
+    return shared;
+  }
+
+private:
+  struct Hash
+  {
+    size_t operator()(const CppVarType* varType) const
+    {
+      return varType->structuralHash();
+    }
+  };
+
+  struct Equal
+  {
+    bool operator()(const CppVarType* lhs, const CppVarType* rhs) const
+    {
+      return *lhs == *rhs;
+    }
+  };
+
+  struct Shard
+  {
+    std::mutex                                   mutex;
+    std::unordered_set<CppVarType*, Hash, Equal> types;
+  };
+
+private:
+  std::array<Shard, 64> shards_;
+};
+
+namespace {
+
+CppVarTypePool& varTypePool()
+{
+  // Never destroyed so that shared types remain valid even in ASTs destroyed after static destruction begins.
+  static auto* pool = new CppVarTypePool;
+  return *pool;
+}
+
+void shareVarType(CppVar* var)
+{
+  const auto* varType = var->varType();
+  if ((varType == nullptr) || varType->shared() || !varType->shareable())
+    return;
+
+  var->varType(CppVarTypePtr(varTypePool().canonical(*varType)));
+}
+
+using CppObjStack = std::vector<const CppObj*>;
+
+void pushParams(const CppParamVector* params, CppObjStack& pending)
+{
+  if (params == nullptr)
+    return;
+  for (const auto& param : *params)
+    pending.push_back(param.get());
+}
+
+template <CppObjType _ObjType>
+void pushBlock(const CppCommonBlock<_ObjType>* block, CppObjStack& pending)
+{
+  pending.push_back(block->cond_.get());
+  pending.push_back(block->body_.get());
+}
+
+/**
+ * Shares var types of \a obj itself and pushes its sub-nodes that can have vars to \a pending.
+ * Nodes are owned by the AST being processed, they are reached through const accessors only because that is what
+ * AST offers to its users.
+ */
+void shareVarTypesIn(const CppObj* obj, CppObjStack& pending)
+{
+  switch (obj->objType_)
+  {
+    case CppObjType::kCompound:
+      for (const auto& mem : static_cast<const CppCompound*>(obj)->members())
+        pending.push_back(mem.get());
+      break;
+
+    case CppObjType::kVar:
+      shareVarType(const_cast<CppVar*>(static_cast<const CppVar*>(obj)));
+      break;
+
+    case CppObjType::kVarList:
+      shareVarType(static_cast<const CppVarList*>(obj)->firstVar_.get());
+      break;
+
+    case CppObjType::kTypedefName:
+      shareVarType(static_cast<const CppTypedefName*>(obj)->var_.get());
+      break;
+
+    case CppObjType::kTypedefNameList:
+      shareVarType(static_cast<const CppTypedefList*>(obj)->varList_->firstVar_.get());
+      break;
+
+    case CppObjType::kFunction:
+    case CppObjType::kConstructor:
+    {
+      const auto* func = static_cast<const CppFuncCtorBase*>(obj);
+      pushParams(func->params(), pending);
+      pending.push_back(func->defn());
+      break;
+    }
+
+    case CppObjType::kFunctionPtr:
+      pushParams(static_cast<const CppFunctionPointer*>(obj)->params(), pending);
+      break;
+
+    case CppObjType::kDestructor:
+    case CppObjType::kTypeConverter:
+      pending.push_back(static_cast<const CppFunctionBase*>(obj)->defn());
+      break;
+
+    case CppObjType::kIfBlock:
+      pushBlock(static_cast<const CppIfBlock*>(obj), pending);
+      pending.push_back(static_cast<const CppIfBlock*>(obj)->elsePart());
+      break;
+
+    case CppObjType::kWhileBlock:
+      pushBlock(static_cast<const CppWhileBlock*>(obj), pending);
+      break;
+
+    case CppObjType::kDoWhileBlock:
+      pushBlock(static_cast<const CppDoWhileBlock*>(obj), pending);
+      break;
+
+    case CppObjType::kForBlock:
+      pending.push_back(static_cast<const CppForBlock*>(obj)->start_.get());
+      pending.push_back(static_cast<const CppForBlock*>(obj)->body_.get());
+      break;
+
+    case CppObjType::kRangeForBlock:
+      shareVarType(static_cast<const CppRangeForBlock*>(obj)->var_.get());
+      pending.push_back(static_cast<const CppRangeForBlock*>(obj)->body_.get());
+      break;
+
+    case CppObjType::kSwitchBlock:
+    {
+      const auto* switchBlock = static_cast<const CppSwitchBlock*>(obj);
+      if (switchBlock->body_)
+      {
+        for (const auto& switchCase : *switchBlock->body_)
+          pending.push_back(switchCase.body_.get());
+      }
+      break;
+    }
+
+    case CppObjType::kTryBlock:
+    {
+      const auto* tryBlock = static_cast<const CppTryBlock*>(obj);
+      pending.push_back(tryBlock->tryStmt_.get());
+      for (const auto& catchBlock : tryBlock->catchBlocks())
+        pending.push_back(catchBlock->catchStmt_.get());
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+} // namespace
+
+void shareVarTypes(CppCompound* ast)
+{
+  // Nodes are processed from an explicit stack so that depth of AST doesn't decide depth of call stack.
+  CppObjStack pending(1, ast);
+  while (!pending.empty())
+  {
+    const auto* obj = pending.back();
+    pending.pop_back();
+    if (obj)
+      shareVarTypesIn(obj, pending);
+  }
+}
@@ -347,34 +347,34 @@ void CppWriter::emitEnum(const CppEnum* enmObj, std::ostream& stm, bool emitNewL
     stm << " : " << enmObj->underlyingType_;
   if (enmObj->itemList_)
   {
-    const bool isEnumBodyBlob = !enmObj->itemList_->empty() && enmObj->itemList_->front()->val_
-                                && (enmObj->itemList_->front()->val_->objType_ == CppBlob::kObjectType);
+    const bool isEnumBodyBlob = !enmObj->itemList_->empty() && enmObj->itemList_->front().val_
+                                && (enmObj->itemList_->front().val_->objType_ == CppBlob::kObjectType);
     if (isEnumBodyBlob)
     {
       stm << " {\n";
-      emitBlob((CppBlob*) enmObj->itemList_->front()->val_.get(), stm, false, indentation);
+      emitBlob((CppBlob*) enmObj->itemList_->front().val_.get(), stm, false, indentation);
       stm << '\n' << indentation << '}';
     }
     else
     {
       stm << '\n';
       stm << indentation++ << "{\n";
-      for (auto enmItem : *(enmObj->itemList_))
+      for (const auto& enmItem : *(enmObj->itemList_))
       {
-        if (enmItem->name_.empty())
+        if (enmItem.name_.empty())
         {
-          emit(enmItem->val_.get(), stm, indentation);
+          emit(enmItem.val_.get(), stm, indentation);
         }
         else
         {
-          stm << indentation << enmItem->name_;
-          if (enmItem->val_ && isExpr(enmItem->val_.get()))
+          stm << indentation << enmItem.name_;
+          if (enmItem.val_ && isExpr(enmItem.val_.get()))
           {
-            auto* expr = static_cast<CppExpr*>(enmItem->val_.get());
+            auto* expr = static_cast<CppExpr*>(enmItem.val_.get());
             stm << " = ";
             emitExpr(expr, stm);
           }
-          if (enmItem != enmObj->itemList_->back())
+          if (&enmItem != &enmObj->itemList_->back())
             stm << ",\n";
           else
             stm << '\n';
@@ -451,23 +451,23 @@ void CppWriter::emitTemplSpec(const CppTemplateParamList* templSpec, std::ostrea
     for (auto& param : *templSpec)
     {
       stm << sep;
-      if (param->paramType_)
+      if (param.paramType_)
       {
-        if (param->paramType_->objType_ == CppVarType::kObjectType)
-          emitVarType(static_cast<const CppVarType*>(param->paramType_.get()), stm);
+        if (param.paramType_->objType_ == CppVarType::kObjectType)
+          emitVarType(static_cast<const CppVarType*>(param.paramType_.get()), stm);
         else
-          emitFunctionPtr(static_cast<const CppFunctionPointer*>(param->paramType_.get()), stm, false);
+          emitFunctionPtr(static_cast<const CppFunctionPointer*>(param.paramType_.get()), stm, false);
         stm << ' ';
       }
       else
       {
         stm << "typename ";
       }
-      stm << param->paramName_;
-      if (param->defaultArg())
+      stm << param.paramName_;
+      if (param.defaultArg())
       {
         stm << " = ";
-        emit(param->defaultArg(), stm, CppIndent(), true);
+        emit(param.defaultArg(), stm, CppIndent(), true);
       }
       sep = ", ";
     }
@@ -945,7 +945,7 @@ void CppWriter::emitExprAtom(const CppExprAtom& exprAtm,
   switch (exprAtm.type)
   {
     case CppExprAtom::kAtom:
-      stm << *(exprAtm.atom);
+      stm << exprAtm.atom();
       break;
     case CppExprAtom::kExpr:
       emitExpr(exprAtm.expr, stm);
@@ -958,145 +958,224 @@ void CppWriter::emitExprAtom(const CppExprAtom& exprAtm,
   }
 }
 
-void CppWriter::emitExpr(const CppExpr* exprObj, std::ostream& stm, CppIndent indentation /*= CppIndent()*/) const
+namespace {
+
+/**
+ * Part of an expression that is yet to be emitted, it is an atom if atom is not null, else text if that is not null,
+ * else an operator.
+ */
+struct ExprPiece
 {
-  if (exprObj == NULL)
-    return;
-  stm << indentation;
+  const CppExprAtom* atom;
+  const char*        text;
+  CppOperator        oper;
+};
+
+/**
+ * Appends parts of an expression in the order they are emitted, without expanding its sub-expressions.
+ */
+void appendExprPieces(const CppExpr* exprObj, std::vector<ExprPiece>& pieces)
+{
+  const auto atom = [&pieces](const CppExprAtom& exprAtom) { pieces.push_back({&exprAtom, nullptr, kNone}); };
+  const auto text = [&pieces](const char* str) { pieces.push_back({nullptr, str, kNone}); };
+  const auto oper = [&pieces](CppOperator op) { pieces.push_back({nullptr, nullptr, op}); };
+
   if (exprObj->flags_ & CppExpr::kReturn)
-    stm << "return ";
+    text("return ");
   if (exprObj->flags_ & CppExpr::kThrow)
-    stm << "throw ";
+    text("throw ");
   if (exprObj->flags_ & CppExpr::kInitializer)
-    stm << "{";
+    text("{");
   if (exprObj->flags_ & CppExpr::kBracketed)
-    stm << '(';
+    text("(");
   if (exprObj->flags_ & CppExpr::kNew)
-    stm << "new ";
+    text("new ");
   if (exprObj->flags_ & CppExpr::kSizeOf)
-    stm << "sizeof(";
+    text("sizeof(");
   else if (exprObj->flags_ & CppExpr::kDelete)
-    stm << "delete ";
+    text("delete ");
   else if (exprObj->flags_ & CppExpr::kDeleteArray)
-    stm << "delete[] ";
+    text("delete[] ");
   if (exprObj->oper_ == kNone)
   {
-    emitExprAtom(exprObj->expr1_, stm);
+    atom(exprObj->expr1_);
   }
   else if (exprObj->oper_ > kUnariPrefixOperatorStart && exprObj->oper_ < kUnariSufixOperatorStart)
   {
-    emitOperator(stm, exprObj->oper_);
-    emitExprAtom(exprObj->expr1_, stm);
+    oper(exprObj->oper_);
+    atom(exprObj->expr1_);
   }
   else if (exprObj->oper_ > kUnariSufixOperatorStart && exprObj->oper_ < kBinaryOperatorStart)
   {
-    emitExprAtom(exprObj->expr1_, stm);
-    emitOperator(stm, exprObj->oper_);
+    atom(exprObj->expr1_);
+    oper(exprObj->oper_);
   }
   else if (exprObj->oper_ > kBinaryOperatorStart && exprObj->oper_ < kDerefOperatorStart)
   {
-    emitExprAtom(exprObj->expr1_, stm);
+    atom(exprObj->expr1_);
     if (exprObj->oper_ != kComma)
-      stm << ' ';
-    emitOperator(stm, exprObj->oper_);
-    stm << ' ';
-    emitExprAtom(exprObj->expr2_, stm);
+      text(" ");
+    oper(exprObj->oper_);
+    text(" ");
+    atom(exprObj->expr2_);
   }
   else if (exprObj->oper_ > kDerefOperatorStart && exprObj->oper_ < kSpecialOperations)
   {
-    emitExprAtom(exprObj->expr1_, stm);
-    emitOperator(stm, exprObj->oper_);
-    emitExprAtom(exprObj->expr2_, stm);
+    atom(exprObj->expr1_);
+    oper(exprObj->oper_);
+    atom(exprObj->expr2_);
   }
   else if (exprObj->oper_ == kFunctionCall)
   {
-    emitExprAtom(exprObj->expr1_, stm);
-    stm << '(';
-    emitExprAtom(exprObj->expr2_, stm);
-    stm << ')';
+    atom(exprObj->expr1_);
+    text("(");
+    atom(exprObj->expr2_);
+    text(")");
   }
   else if (exprObj->oper_ == kUniformInitCall)
   {
-    emitExprAtom(exprObj->expr1_, stm);
-    stm << '{';
-    emitExprAtom(exprObj->expr2_, stm);
-    stm << '}';
+    atom(exprObj->expr1_);
+    text("{");
+    atom(exprObj->expr2_);
+    text("}");
   }
   else if (exprObj->oper_ == kArrayElem)
   {
-    emitExprAtom(exprObj->expr1_, stm);
-    stm << '[';
-    emitExprAtom(exprObj->expr2_, stm);
-    stm << ']';
+    atom(exprObj->expr1_);
+    text("[");
+    atom(exprObj->expr2_);
+    text("]");
   }
   else if (exprObj->oper_ == kCStyleCast)
   {
-    stm << '(';
-    emitExprAtom(exprObj->expr1_, stm);
-    stm << ") ";
-    emitExprAtom(exprObj->expr2_, stm);
+    text("(");
+    atom(exprObj->expr1_);
+    text(") ");
+    atom(exprObj->expr2_);
   }
   else if (exprObj->oper_ >= kConstCast && exprObj->oper_ <= kReinterpretCast)
   {
     if (exprObj->oper_ == kConstCast)
-      stm << "const_cast";
+      text("const_cast");
     else if (exprObj->oper_ == kStaticCast)
-      stm << "static_cast";
+      text("static_cast");
     else if (exprObj->oper_ == kDynamicCast)
-      stm << "dynamic_cast";
+      text("dynamic_cast");
     else if (exprObj->oper_ == kReinterpretCast)
-      stm << "reinterpret_cast";
-    stm << '<';
-    emitExprAtom(exprObj->expr1_, stm);
-    stm << ">(";
-    emitExprAtom(exprObj->expr2_, stm);
-    stm << ')';
+      text("reinterpret_cast");
+    text("<");
+    atom(exprObj->expr1_);
+    text(">(");
+    atom(exprObj->expr2_);
+    text(")");
   }
   else if (exprObj->oper_ == kTertiaryOperator)
   {
-    emitExprAtom(exprObj->expr1_, stm);
-    stm << " ? ";
-    emitExprAtom(exprObj->expr2_, stm);
-    stm << " : ";
-    emitExprAtom(exprObj->expr3_, stm);
+    atom(exprObj->expr1_);
+    text(" ? ");
+    atom(exprObj->expr2_);
+    text(" : ");
+    atom(exprObj->expr3_);
   }
   else if (exprObj->oper_ == kPlacementNew)
   {
-    stm << "new (";
-    emitExprAtom(exprObj->expr1_, stm);
-    stm << ") ";
-    emitExprAtom(exprObj->expr2_, stm);
+    text("new (");
+    atom(exprObj->expr1_);
+    text(") ");
+    atom(exprObj->expr2_);
   }
 
   if (exprObj->flags_ & CppExpr::kBracketed)
-    stm << ')';
+    text(")");
   if (exprObj->flags_ & CppExpr::kInitializer)
-    stm << "}";
+    text("}");
   if (exprObj->flags_ & CppExpr::kSizeOf)
-    stm << ')';
+    text(")");
 
   if (exprObj->flags_ & CppExpr::kVariadicPack)
-    stm << "...";
+    text("...");
 }
 
-void CppWriter::emitIfBlock(const CppIfBlock* ifBlock, std::ostream& stm, CppIndent indentation) const
+} // namespace
+
+void CppWriter::emitExpr(const CppExpr* exprObj, std::ostream& stm, CppIndent indentation /*= CppIndent()*/) const
 {
+  if (exprObj == NULL)
+    return;
   stm << indentation;
-  stm << "if (";
-  emit(ifBlock->cond_.get(), stm, CppIndent(), true);
-  stm << ")\n";
-  stm << indentation << "{\n";
-  ++indentation;
-  if (ifBlock->body_)
-    emit(ifBlock->body_.get(), stm, indentation);
-  --indentation;
-  stm << indentation << "}\n";
-  if (ifBlock->elsePart())
+
+  // Sub-expressions are expanded on an explicit stack, so that deep ones, like long chains of binary operations,
+  // can't overflow the call stack.
+  std::vector<ExprPiece> pendingPieces; // Top of stack is the next one to emit.
+  std::vector<ExprPiece> exprPieces;
+
+  const auto expand = [&](const CppExpr* expr) {
+    exprPieces.clear();
+    appendExprPieces(expr, exprPieces);
+    pendingPieces.insert(pendingPieces.end(), exprPieces.rbegin(), exprPieces.rend());
+  };
+
+  expand(exprObj);
+  while (!pendingPieces.empty())
+  {
+    const auto piece = pendingPieces.back();
+    pendingPieces.pop_back();
+    if (piece.atom == nullptr)
+    {
+      if (piece.text)
+        stm << piece.text;
+      else
+        emitOperator(stm, piece.oper);
+    }
+    else if (piece.atom->type == CppExprAtom::kExpr)
+    {
+      if (piece.atom->expr)
+        expand(piece.atom->expr);
+    }
+    else
+    {
+      emitExprAtom(*piece.atom, stm);
+    }
+  }
+}
+
+void CppWriter::emitIfBlock(const CppIfBlock* ifBlock, std::ostream& stm, CppIndent indentation) const
+{
+  // Else part that is an if-block is emitted nested in the else block of its parent. Such else-if ladders are walked
+  // in a loop so that deep ones can't overflow the call stack.
+  size_t numOpenElseBlocks = 0;
+  for (;;)
   {
+    stm << indentation;
+    stm << "if (";
+    emit(ifBlock->cond_.get(), stm, CppIndent(), true);
+    stm << ")\n";
+    stm << indentation << "{\n";
+    ++indentation;
+    if (ifBlock->body_)
+      emit(ifBlock->body_.get(), stm, indentation);
+    --indentation;
+    stm << indentation << "}\n";
+
+    const auto* elsePart = ifBlock->elsePart();
+    if (elsePart == nullptr)
+      break;
     stm << indentation << "else \n";
     stm << indentation << "{\n";
     ++indentation;
-    emit(ifBlock->elsePart(), stm, indentation);
+    if (elsePart->objType_ != CppObjType::kIfBlock)
+    {
+      emit(elsePart, stm, indentation);
+      --indentation;
+      stm << indentation << "}\n";
+      break;
+    }
+    ++numOpenElseBlocks;
+    ifBlock = static_cast<const CppIfBlock*>(elsePart);
+  }
+
+  for (; numOpenElseBlocks > 0; --numOpenElseBlocks)
+  {
     --indentation;
     stm << indentation << "}\n";
   }
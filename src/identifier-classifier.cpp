@@ -0,0 +1,75 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "identifier-classifier.h"
+
+#include "parser.h"
+
+IdentifierClassifier::IdentifierClassifier(const ParserConfig& config)
+{
+  const auto maxNames = config.ignorableMacroNames.size() + config.macroNames.size()
+                        + config.knownApiDecorNames.size() + config.renamedKeywords.size();
+  if (maxNames == 0)
+    return;
+
+  // At most half full so that probe sequences remain short.
+  size_t numSlots = 8;
+  while (numSlots < 2 * maxNames)
+    numSlots *= 2;
+  slots_.resize(numSlots);
+  mask_ = static_cast<std::uint32_t>(numSlots - 1);
+
+  for (const auto& name : config.ignorableMacroNames)
+    add(name, IdentifierKind::kIgnorableMacro);
+  for (const auto& name : config.macroNames)
+    add(name, IdentifierKind::kMacro);
+  for (const auto& name : config.knownApiDecorNames)
+    add(name, IdentifierKind::kApiDecor);
+  for (const auto& nameAndToken : config.renamedKeywords)
+    add(nameAndToken.first, IdentifierKind::kRenamedKeyword, nameAndToken.second);
+}
+
+void IdentifierClassifier::add(const std::string& name, IdentifierKind kind, int keywordToken)
+{
+  // Lexer never sees an empty identifier and an empty slot is marked by zero length.
+  if (name.empty())
+    return;
+  const auto hash = hashOf(name.data(), name.size());
+  for (auto idx = hash & mask_;; idx = (idx + 1) & mask_)
+  {
+    auto& slot = slots_[idx];
+    if (slot.len == 0)
+    {
+      slot.hash         = hash;
+      slot.offset       = static_cast<std::uint32_t>(names_.size());
+      slot.len          = static_cast<std::uint32_t>(name.size());
+      slot.kind         = kind;
+      slot.keywordToken = keywordToken;
+      names_ += name;
+      ++numNames_;
+      return;
+    }
+    if ((slot.hash == hash) && (slot.len == name.size()) && (names_.compare(slot.offset, slot.len, name) == 0))
+      return;
+  }
+}
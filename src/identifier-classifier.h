@@ -0,0 +1,109 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct ParserConfig;
+
+/**
+ * What lexer does with an identifier because of the names configured in ParserConfig.
+ */
+enum class IdentifierKind : std::uint8_t
+{
+  kName,           ///< Not a configured name.
+  kIgnorableMacro, ///< One of ParserConfig::ignorableMacroNames.
+  kMacro,          ///< One of ParserConfig::macroNames.
+  kApiDecor,       ///< One of ParserConfig::knownApiDecorNames.
+  kRenamedKeyword  ///< One of ParserConfig::renamedKeywords.
+};
+
+struct IdentifierClass
+{
+  IdentifierKind kind         = IdentifierKind::kName;
+  int            keywordToken = 0; ///< Token of the keyword when kind is kRenamedKeyword.
+};
+
+/**
+ * Immutable open addressing hash of all configured names that lexer has to recognize.
+ * An identifier is classified by probing it once, without making a string of it.
+ * When a name is configured in more than one way the kind that lexer checked first is kept,
+ * i.e. ignorable macro, macro, api decoration, and renamed keyword in that order.
+ */
+class IdentifierClassifier
+{
+public:
+  IdentifierClassifier() = default;
+  explicit IdentifierClassifier(const ParserConfig& config);
+
+  IdentifierClass classify(const char* id, size_t len) const
+  {
+    if (slots_.empty())
+      return IdentifierClass();
+    const auto hash = hashOf(id, len);
+    for (auto idx = hash & mask_;; idx = (idx + 1) & mask_)
+    {
+      const auto& slot = slots_[idx];
+      if (slot.len == 0)
+        return IdentifierClass();
+      if ((slot.hash == hash) && (slot.len == len) && (names_.compare(slot.offset, len, id, len) == 0))
+        return {slot.kind, slot.keywordToken};
+    }
+  }
+
+  size_t numNames() const
+  {
+    return numNames_;
+  }
+
+private:
+  // FNV-1a, identifiers are short and so a simple byte at a time hash is good enough.
+  static std::uint32_t hashOf(const char* id, size_t len)
+  {
+    std::uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; ++i)
+      hash = (hash ^ static_cast<unsigned char>(id[i])) * 16777619u;
+    return hash;
+  }
+
+  void add(const std::string& name, IdentifierKind kind, int keywordToken = 0);
+
+private:
+  struct Slot
+  {
+    std::uint32_t  hash         = 0;
+    std::uint32_t  offset       = 0; ///< Of the name in names_.
+    std::uint32_t  len          = 0; ///< Zero for an empty slot.
+    IdentifierKind kind         = IdentifierKind::kName;
+    int            keywordToken = 0;
+  };
+
+  std::string       names_; ///< All names one after another.
+  std::vector<Slot> slots_;
+  std::uint32_t     mask_     = 0;
+  size_t            numNames_ = 0;
+};
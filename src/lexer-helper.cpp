@@ -4,31 +4,24 @@
 #include <set>
 #include <string>
 
-extern std::set<std::string>      gMacroNames;
-extern std::set<std::string>      gKnownApiDecorNames;
-extern std::map<std::string, int> gDefinedNames;
-extern std::set<std::string>      gUndefinedNames;
-extern std::set<std::string>      gIgnorableMacroNames;
-extern std::map<std::string, int> gRenamedKeywords;
-
-MacroDefineInfo getMacroDefineInfo(const std::string& id)
+MacroDefineInfo getMacroDefineInfo(const ParserConfig& config, const std::string& id)
 {
-  if (gUndefinedNames.count(id))
+  if (config.undefinedNames.count(id))
     return MacroDefineInfo::kUndefined;
 
-  if (gDefinedNames.count(id))
+  if (config.definedNames.count(id))
     return MacroDefineInfo::kDefined;
 
   return MacroDefineInfo::kNoInfo;
 }
 
-std::optional<int> getIdValue(const std::string& id)
+std::optional<int> getIdValue(const ParserConfig& config, const std::string& id)
 {
-  if (gUndefinedNames.count(id))
+  if (config.undefinedNames.count(id))
     return std::nullopt;
 
-  const auto itr = gDefinedNames.find(id);
-  if (itr == gDefinedNames.end())
+  const auto itr = config.definedNames.find(id);
+  if (itr == config.definedNames.end())
     return std::nullopt;
 
   return itr->second;
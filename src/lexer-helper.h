@@ -22,6 +22,6 @@ inline MacroDependentCodeEnablement invert(MacroDependentCodeEnablement enabledC
   return MacroDependentCodeEnablement::kNoInfo;
 }
 
-MacroDefineInfo getMacroDefineInfo(const std::string& id);
+MacroDefineInfo getMacroDefineInfo(const ParserConfig& config, const std::string& id);
 
-std::optional<int> getIdValue(const std::string& id);
+std::optional<int> getIdValue(const ParserConfig& config, const std::string& id);
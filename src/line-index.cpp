@@ -0,0 +1,57 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "line-index.h"
+#include "blob-skipper.h"
+
+#include <algorithm>
+
+namespace {
+
+// Input is indexed at least this much at a time to not scan a few bytes on every lookup.
+constexpr size_t kMinIndexedChunk = 64 * 1024;
+
+} // namespace
+
+void LineIndex::reset(const char* input, const char* inputEnd)
+{
+  input_       = input;
+  inputEnd_    = inputEnd;
+  indexedTill_ = input;
+  lineStarts_.clear();
+}
+
+int LineIndex::lineNumber(const char* pos)
+{
+  if (pos > indexedTill_)
+    indexTill(pos);
+  return static_cast<int>(std::upper_bound(lineStarts_.begin(), lineStarts_.end(), pos) - lineStarts_.begin()) + 1;
+}
+
+void LineIndex::indexTill(const char* pos)
+{
+  const auto remaining = static_cast<size_t>(inputEnd_ - indexedTill_);
+  const auto end       = std::min(inputEnd_, std::max(pos, indexedTill_ + std::min(remaining, kMinIndexedChunk)));
+  appendLineStarts(indexedTill_, end, lineStarts_);
+  indexedTill_ = end;
+}
@@ -0,0 +1,52 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Finds line number of a position in input only when it is asked for, so lexer doesn't count new lines.
+ *
+ * Starts of lines are found a chunk of input at a time and are kept for later lookups.
+ */
+class LineIndex
+{
+public:
+  void reset(const char* input, const char* inputEnd);
+
+  /**
+   * @return 1 based number of the line that has pos.
+   */
+  int lineNumber(const char* pos);
+
+private:
+  void indexTill(const char* pos);
+
+private:
+  const char*              input_ {nullptr};
+  const char*              inputEnd_ {nullptr};
+  const char*              indexedTill_ {nullptr};
+  std::vector<const char*> lineStarts_; ///< Start of every line except the first one.
+};
@@ -27,34 +27,40 @@
 #include "cppobjfactory.h"
 #include "cpptoken.h"
 
-extern CppObjFactory* gObjFactory;
+#include <utility>
 
 template <typename... Params>
-CppCompound* newCompound(Params... params)
+CppCompound* newCompound(const CppObjFactory& objFactory, Params... params)
 {
-  return gObjFactory->CreateCompound(params...);
+  return objFactory.CreateCompound(params...);
 }
 
 template <typename... Params>
-CppConstructor* newConstructor(Params... params)
+CppConstructor* newConstructor(const CppObjFactory& objFactory, Params... params)
 {
-  return gObjFactory->CreateConstructor(params...);
+  return objFactory.CreateConstructor(params...);
 }
 
 template <typename... Params>
-CppDestructor* newDestructor(Params... params)
+CppDestructor* newDestructor(const CppObjFactory& objFactory, Params... params)
 {
-  return gObjFactory->CreateDestructor(params...);
+  return objFactory.CreateDestructor(params...);
 }
 
 template <typename... Params>
-CppFunction* newFunction(Params... params)
+CppFunction* newFunction(const CppObjFactory& objFactory, Params... params)
 {
-  return gObjFactory->CreateFunction(params...);
+  return objFactory.CreateFunction(params...);
 }
 
 template <typename... Params>
-CppTypeConverter* newTypeConverter(Params... params)
+CppTypeConverter* newTypeConverter(const CppObjFactory& objFactory, Params... params)
 {
-  return gObjFactory->CreateTypeConverter(params...);
+  return objFactory.CreateTypeConverter(params...);
+}
+
+template <typename T, typename... Params>
+T* newObj(const CppObjFactory& objFactory, Params&&... params)
+{
+  return objFactory.Create<T>(std::forward<Params>(params)...);
 }
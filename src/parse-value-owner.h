@@ -0,0 +1,166 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "cppast.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+/**
+ * Owns the objects that are values on the parse stack and are not yet part of anything else.
+ *
+ * Every non-trial reduction releases the values it consumes and takes ownership of the value it produces.
+ * Values that are popped, or left on the stack when a parse fails, are deleted if they are still owned.
+ * Values seen only during a btyacc trial, or copies of the same value, are never owned and so never deleted twice.
+ */
+class ParseValueOwner
+{
+public:
+  enum class Mode
+  {
+    kReclaim, ///< Delete values that are owned.
+    kRelease, ///< Give up ownership because a reduction consumed the value.
+    kTake     ///< Take ownership of a value a reduction produced.
+  };
+
+  ParseValueOwner()                                  = default;
+  ParseValueOwner(const ParseValueOwner&)            = delete;
+  ParseValueOwner& operator=(const ParseValueOwner&) = delete;
+
+  ~ParseValueOwner()
+  {
+    reclaimAll();
+  }
+
+  void mode(Mode mode)
+  {
+    mode_ = mode;
+  }
+
+  template <typename T>
+  void onValue(T* value)
+  {
+    if (value == nullptr)
+      return;
+
+    // CppObj is the first base of all AST nodes, so pointer to any of them has the same address.
+    if (mode_ != Mode::kTake)
+      forget(value);
+    else if (find(value) == owned_.rend())
+      owned_.push_back(Value {value, &deleteAs<T>});
+  }
+
+  // Which member of the union is set can be trusted only for a value that a reduction has just produced.
+  void onValue(const CppMemInits& memInits)
+  {
+    if (mode_ != Mode::kTake)
+      forget(memInits.memInitList);
+    else if (memInits.memInitListIsABlob_)
+      onValue(memInits.blob);
+    else
+      onValue(memInits.memInitList);
+  }
+
+  /**
+   * Deletes all values that are still owned.
+   */
+  void reclaimAll()
+  {
+    while (!owned_.empty())
+    {
+      const auto value = owned_.back();
+      owned_.pop_back();
+      value.deleter(value.ptr, *this);
+    }
+  }
+
+  /**
+   * @return Total size of AST nodes deleted by reclaiming values.
+   */
+  size_t numBytesReclaimed() const
+  {
+    return numBytesReclaimed_;
+  }
+
+private:
+  // Values of failed trials can be garbage, so value is never dereferenced unless owned.
+  void forget(const void* key)
+  {
+    const auto itr = find(key);
+    if (itr == owned_.rend())
+      return;
+    const auto value = *itr;
+    owned_.erase(std::next(itr).base());
+    if (mode_ == Mode::kReclaim)
+      value.deleter(value.ptr, *this);
+  }
+
+  struct Value
+  {
+    void* ptr;
+    void (*deleter)(void* ptr, ParseValueOwner& owner);
+  };
+
+  // Like the parse stack, values are mostly consumed in the reverse order of their creation.
+  std::vector<Value>::reverse_iterator find(const void* key)
+  {
+    return std::find_if(owned_.rbegin(), owned_.rend(), [key](const Value& value) { return value.ptr == key; });
+  }
+
+  template <typename T>
+  static void deleteAs(void* ptr, ParseValueOwner& owner)
+  {
+    owner.deleteValue(static_cast<T*>(ptr));
+  }
+
+  template <typename T>
+  void deleteValue(T* value)
+  {
+    const auto numBytesDeleted = CppAstNode::numBytesDeletedByThisThread();
+    destroy(value);
+    numBytesReclaimed_ += CppAstNode::numBytesDeletedByThisThread() - numBytesDeleted;
+  }
+
+  template <typename T>
+  static void destroy(T* value)
+  {
+    delete value;
+  }
+
+  // Elements of this list are owned by the list, just like when CppConstructor owns the list.
+  static void destroy(CppMemInitList* memInitList)
+  {
+    for (auto& memInit : *memInitList)
+      delete memInit.second;
+    delete memInitList;
+  }
+
+private:
+  std::vector<Value> owned_;
+  Mode               mode_              = Mode::kReclaim;
+  size_t             numBytesReclaimed_ = 0;
+};
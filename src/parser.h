@@ -27,14 +27,110 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
 
 #include "cppast.h"
+#include "cppparser.h"
+#include "identifier-classifier.h"
+
+class CppObjFactory;
 
 using ErrorHandler =
   std::function<void(const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext)>;
 
-void setErrorHandler(ErrorHandler errorHandler);
-void resetErrorHandler();
+void defaultErrorHandler(const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext);
+
+/**
+ * Everything that can be configured in CppParser.
+ * Lexer and parser only read it, so one config can be shared by concurrent parses.
+ */
+struct ParserConfig
+{
+  // Names to help parse when preprocessors are used
+  std::set<std::string>      macroNames;
+  std::set<std::string>      knownApiDecorNames;
+  std::map<std::string, int> definedNames;
+  std::set<std::string>      undefinedNames;
+  std::set<std::string>      ignorableMacroNames;
+  std::map<std::string, int> renamedKeywords;
+
+  // Names above that lexer looks identifiers up in, it must be rebuilt whenever they change.
+  IdentifierClassifier identifierClassifier;
+
+  bool parseEnumBodyAsBlob     = false;
+  bool parseFunctionBodyAsBlob = false;
+  bool retainSourceBuffer      = false;
+  bool shareVarTypes           = false;
+  bool ignoreComments          = false;
+
+  ErrorHandler errorHandler = defaultErrorHandler;
+};
 
-CppCompoundPtr parseStream(char* stm, size_t stmSize);
+/**
+ * Statistics of the parses done by one CppParser, parses can update it concurrently.
+ */
+struct ParseStats
+{
+  /// Size of AST nodes that were left on parse stack by failed parses and so were deleted by parser.
+  std::atomic<size_t> numBytesReclaimed {0};
+  /// Number of trial parses started to resolve conflicts of grammar.
+  std::atomic<size_t> numTrialParses {0};
+  /// Number of tokens that were read again after backtracking.
+  std::atomic<size_t> numTokensReplayed {0};
+  /// Bytes of parser stacks copied to save parser state for trial parses and to restore it.
+  std::atomic<size_t> numBytesCopiedForTrials {0};
+};
+
+struct yyparsecontext;
+
+/**
+ * Parser stacks and lexical queue, they are kept from one parse to the next so that parsing many files
+ * does not allocate them every time. Can be used by one parse at a time.
+ */
+class ParseStacks
+{
+public:
+  ParseStacks();
+  ~ParseStacks();
+
+  ParseStacks(const ParseStacks&) = delete;
+  ParseStacks& operator=(const ParseStacks&) = delete;
+
+  yyparsecontext* context() const
+  {
+    return ctx_.get();
+  }
+
+private:
+  std::unique_ptr<yyparsecontext> ctx_;
+};
+
+/**
+ * @param textRefersToStm If true then verbatim text in AST, like blobs, refers to \a stm instead of copying it.
+ * So, \a stm must then outlive the returned AST.
+ * @param stats If not null then statistics of this parse are added to it.
+ * @param stacks If not null then the parse uses these stacks instead of allocating its own.
+ */
+CppCompoundPtr parseStream(char*                stm,
+                           size_t               stmSize,
+                           const ParserConfig&  config,
+                           const CppObjFactory& objFactory,
+                           bool                 textRefersToStm = false,
+                           ParseStats*          stats           = nullptr,
+                           ParseStacks*         stacks          = nullptr);
+
+/**
+ * Runs only the lexer over \a stm, which must end with 2 null chars like that for parseStream().
+ */
+std::vector<CppLexToken> tokenizeStream(char* stm, size_t stmSize, const ParserConfig& config);
+
+/**
+ * Replaces types of variables in \a ast, including function parameters, by their shared canonical instances.
+ */
+void shareVarTypes(CppCompound* ast);
@@ -25,6 +25,8 @@
 
 #include "cpptoken.h"
 #include "cppvarinit.h"
+#include "line-index.h"
+#include "parser.h"
 #include "parser.tab.h"
 
 #include <functional>
@@ -81,13 +83,23 @@ struct CodeEnablementInfo
 using CodeEnablementInfoStack = std::vector<CodeEnablementInfo>;
 using BracketDepthStack       = std::vector<int>;
 
+/**
+ * State of the lexer for one parse, flex makes it available to actions as yyextra.
+ */
 struct LexerData
 {
+  const ParserConfig* mConfig = nullptr;
+
+  //@{ Where the value and position of each token is handed to the parser
+  YYSTYPE* mTokenValue    = nullptr;
+  char**   mTokenPosition = nullptr;
+  //@}
+
   int mLexLog = 0;
-  int mLineNo = 1;
 
   const char* mInputBuffer     = nullptr;
   size_t      mInputBufferSize = 0;
+  LineIndex   mLineIndex;
 
   const char* mOldYytext = nullptr;
 
@@ -115,6 +127,8 @@ struct LexerData
    test/e2e/test_input/comment_test.h
    */
   bool mTokenizeComment = true;
+  /// Comments are then skipped as a whole, and neither mTokenizeComment nor mBracketDepthStack is maintained.
+  bool mIgnoreComments = false;
 
   /**
    * We need to keep track of where we are inside the nest of brackets for knowing when we can tokenize comments.
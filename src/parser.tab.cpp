@@ -0,0 +1,15984 @@
+#line 8 "btyaccpa.ske"
+
+/*
+** @(#)btyaccpar, based on byacc 1.8 (Berkeley)
+** Reentrant variant: all parser state lives in struct yyparsecontext.
+*/
+#define YYBTYACC 1
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef int Yshort;
+
+static int yyttable[] = {
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,   84,    0,    0,    0,   79,   81,    0,
+   87,   88,   77,   75,   86,   76,  145,   78,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  152,   91,
+    0,   85,    0,  131,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   89,    0,   90,   80,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  153,   82,  154,   83,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    1,    2,    3,    4,
+    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+   15,   16,   17,   18,   19,   20,   21,   22,   23,   24,
+   25,   26,   27,   28,   29,   30,   31,   32,   33,   34,
+   35,   36,   37,   38,   39,   40,   41,   42,   43,   44,
+   45,   46,   47,   48,   49,   50,   51,   52,   53,   54,
+   55,   56,   57,   58,   59,   60,   61,   62,   63,   64,
+   65,   66,   67,   68,   69,   70,   71,   72,   73,   74,
+   92,   93,   94,   95,   96,   97,   98,   99,  100,  101,
+  102,  103,  104,  105,  106,  107,  108,  109,  110,  111,
+  112,  113,  114,  115,  116,  117,  118,  119,  120,  121,
+  122,  123,  124,  125,  126,  127,  128,  129,  130,  132,
+  133,  134,  135,  136,  137,  138,  139,  140,  141,  142,
+  143,  144,  146,  147,  148,  149,  150,  151,
+};
+#line 38 "/root/repo/src/parser.y"
+#include "cpptoken.h"
+#include "cppast.h"
+#include "cppvarinit.h"
+#include "parser.tab.h"
+#include "parser.h"
+#include "parser.l.h"
+#include "cppobjfactory.h"
+#include "obj-factory-helper.h"
+#include "parse-value-owner.h"
+#include "utils.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <stack>
+
+/*////////////////////////////////////////////////////////////////////////*/
+
+int GetKeywordId(const std::string& keyword) {
+  static const std::map<std::string, int> keywordToIdMap =
+  {
+      {"virtual",   tknVirtual},
+      {"final",     tknFinal},
+      {"override",  tknOverride},
+      {"const",     tknConst},
+      {"noexcept",  tknNoExcept}
+  };
+
+  auto itr = keywordToIdMap.find(keyword);
+  return (itr != keywordToIdMap.end()) ? itr->second : -1;
+}
+
+/* Makes atom of an expression without an intermediate std::string.*/
+static CppExprAtom exprAtom(const CppToken& token)
+{
+  return CppExprAtom(token.sz, token.len);
+}
+
+static void addEnumItem(CppEnumItemList* itemList, const CppNtEnumItem& item)
+{
+  if (item.name.sz)
+    itemList->emplace_back((std::string) item.name, static_cast<CppExpr*>(item.val));
+  else
+    itemList->emplace_back(item.val);
+}
+
+static void addTemplateParam(CppTemplateParamList* paramList, const CppNtTemplateParam& param)
+{
+  if (param.paramType == nullptr)
+    paramList->emplace_back((std::string) param.paramName);
+  else if (param.paramType->objType_ == CppVarType::kObjectType)
+    paramList->emplace_back(static_cast<CppVarType*>(param.paramType), (std::string) param.paramName);
+  else
+    paramList->emplace_back(static_cast<CppFunctionPointer*>(param.paramType), (std::string) param.paramName);
+  if (param.defaultArg)
+    paramList->back().defaultArg(param.defaultArg);
+}
+
+#ifndef NDEBUG
+#  define YYDEBUG 1
+#else 
+#  define YYDEBUG 0
+#endif /*#ifndef NDEBUG*/
+
+#define YYERROR_DETAILED
+
+#define YYDELETEPOSN(x, y)
+#define YYDELETEVAL(x, y)
+
+#ifndef TRUE /* Need this to fix BtYacc compilation error.*/
+#  define TRUE true
+#endif
+
+#define ZZLOG               \
+  {                         \
+  if (yyparam->parseLog)                 \
+    printf("ZZLOG @line#%d, parsing stream line#%d\n", __LINE__, yyparam->lexer.mLineIndex.lineNumber(*yyparam->lexer.mTokenPosition)); \
+}
+
+#define ZZVALID   {         \
+  if (yyparam->parseLog)                 \
+    printf("ZZVALID: ");    \
+  ZZLOG;                    \
+  if (!yyparam->disableYyValid)     \
+    YYVALID;                \
+  }
+
+#define ZZERROR             \
+  do {                      \
+    if (yyparam->parseLog)               \
+      printf("ZZERROR: ");  \
+    ZZLOG;                  \
+    YYERROR;                \
+  } while(0)
+
+#define ZZVALID_DISABLE     \
+  ++yyparam->disableYyValid;
+
+#define ZZVALID_ENABLE      \
+  --yyparam->disableYyValid;
+
+/**
+* A stack to know where (i.e. how deep inside class defnition) the current parsing activity is taking place.
+*/
+using CppCompoundStack = std::stack<CppToken>;
+
+enum class ParseStatus {
+  NotAvailable,
+  Success,
+  Failure
+};
+
+static void configureLexer(LexerData& lexer, const ParserConfig& config)
+{
+  lexer.mConfig          = &config;
+  lexer.mIgnoreComments  = config.ignoreComments;
+  lexer.mTokenizeComment = !config.ignoreComments;
+}
+
+/**
+* State of one parse, reachable from actions as yyparam.
+* Nothing here is shared between parses and so different threads can parse at the same time.
+*/
+struct ParserState
+{
+  ParserState(const ParserConfig& parserConfig, const CppObjFactory& parserObjFactory)
+    : config(parserConfig)
+    , objFactory(parserObjFactory)
+  {
+    configureLexer(lexer, config);
+  }
+
+  const ParserConfig&  config;
+  const CppObjFactory& objFactory;
+
+  LexerData lexer;
+  void*     scanner = nullptr;
+
+  int parseLog       = 0;
+  int disableYyValid = 0;
+
+  /**
+  * A program unit is the entire parse tree of a source/header file
+  */
+  CppCompound* progUnit = nullptr;
+
+  /* FuncdeclHack:*/
+  /* Following gets parsed as variable with initialization:*/
+  /* Type Identifier(Type * Id);*/
+  /* `Type * Id` gets parsed as expression involving multiplication and so `Identifier`*/
+  /*  followed by expression in brackets becomes a call to constructor of `Type`.*/
+  /* Actually there is an ambiguity in the grammer which compilers solve by using context.*/
+  /* For purpose of this parser we cannot collect all required context to solve this ambiguity.*/
+  /* So, we use a hack:*/
+  /* We define a production rule for this case and flag it as error. But before flagging error*/
+  /* we save the position of operator '*' (or '&', or "&&") and then we check for location of*/
+  /* the same operator in other expression production rule before accepting that as valid expression.*/
+  /* For us we always want to parse it as function declaration rather than call to constructor by passing an expression,*/
+  /* and so the hack is expected to serve us well.*/
+  const char* paramModPos = nullptr;
+
+  /* TemplateParamHack:*/
+  /* Template parameter gets parsed as vardecl which then gets reduced as templateparam without name as used in forward declaration.*/
+  /* We don't want that, so to avoid such templateparam getting reduced as vardecl we apply some hack.*/
+  const char* templateParamStart = nullptr;
+  bool        inTemplateSpec     = false;
+
+  CppCompoundStack          compoundStack;
+  CppAccessType             curAccessType = CppAccessType::kUnknown;
+  std::stack<CppAccessType> accessTypeStack;
+
+  ParseStatus parseStatus = ParseStatus::NotAvailable;
+
+  ParseValueOwner stackValues;
+
+  /* When true verbatim text in AST refers to input buffer instead of owning a copy.*/
+  /* Text having CRLF line ends is still copied, so that it is the same as that of source with LF line ends.*/
+  bool textRefersToInput = false;
+
+  CppSourceText sourceText(const CppToken& token) const
+  {
+    if (textRefersToInput && !token.hasCarriageReturn())
+      return CppSourceText::referTo(std::string_view(token.sz, token.len));
+    return token.toString();
+  }
+};
+
+#define YYPOSN char*
+#define YYPARSE_PARAM_TYPE ParserState*
+#define YYLEX yylex(yyparam->scanner)
+
+/* yydestruct() is not given the parser state, so it reaches owner of stack values of current parse through this.*/
+static thread_local ParseValueOwner* gStackValueOwner = nullptr;
+
+static void trackStackValues(const Yshort* rhsStates, YYSTYPE* rhsValues, int numRhs, int rule, YYSTYPE* lhsValue);
+
+/* Position reduction hook is called only for non-trial reductions, so it is where ownership of values changes.*/
+#define YYREDUCEPOSNFUNC(pos, psp, vsp, len, depth, ch, posn, val) \
+  trackStackValues(yyps->ssp + 1 - (len), vsp, len, yyn, &(val))
+#define YYREDUCEPOSNFUNCARG yyps->val
+
+extern int yylex(void* yyscanner);
+
+/* Yacc generated code causes warnings that need suppression.*/
+/* This pragma should be at the end.*/
+#if defined(__clang__) || defined(__GNUC__)
+# pragma GCC diagnostic ignored "-Wwrite-strings"
+#endif
+
+#include "parser.tab.h"
+
+#line 271 "parser.tab.c"
+#ifdef YYPOSN
+#define YYDESTRUCT(T,S,V,P) yydestruct(T,S,V,P)
+#else
+#define YYDESTRUCT(T,S,V,P) yydestruct(T,S,V)
+#endif
+void YYDESTRUCT(int trial, int sym, YYSTYPE *val, YYPOSN *pos) {
+    switch(sym) {
+    case 176: /* stmt */
+    case 284: /* preprocessor */
+      if (!trial) {
+#line 442 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppObj); }
+#line 284 "parser.tab.c"
+      }
+      break;
+    case 179: /* enumdefn */
+    case 180: /* enumfwddecl */
+    case 181: /* enumdefnstmt */
+      if (!trial) {
+#line 442 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppEnum); }
+#line 293 "parser.tab.c"
+      }
+      break;
+    case 185: /* vartype */
+      if (!trial) {
+#line 442 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppVarType); }
+#line 300 "parser.tab.c"
+      }
+      break;
+    case 186: /* vardecl */
+    case 187: /* varinit */
+    case 188: /* vardeclstmt */
+      if (!trial) {
+#line 442 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppVarObj); }
+#line 309 "parser.tab.c"
+      }
+      break;
+    case 183: /* enumitemlist */
+      if (!trial) {
+#line 443 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->enumItemList); }
+#line 316 "parser.tab.c"
+      }
+      break;
+    case 200: /* typedefname */
+    case 201: /* typedefnamestmt */
+      if (!trial) {
+#line 443 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->typedefName); }
+#line 324 "parser.tab.c"
+      }
+      break;
+    case 202: /* typedeflist */
+    case 203: /* typedefliststmt */
+      if (!trial) {
+#line 443 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->typedefList); }
+#line 332 "parser.tab.c"
+      }
+      break;
+    case 206: /* usingdecl */
+      if (!trial) {
+#line 443 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->usingDecl); }
+#line 339 "parser.tab.c"
+      }
+      break;
+    case 204: /* usingnamespacedecl */
+      if (!trial) {
+#line 444 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->usingNamespaceDecl); }
+#line 346 "parser.tab.c"
+      }
+      break;
+    case 205: /* namespacealias */
+      if (!trial) {
+#line 444 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->namespaceAlias); }
+#line 353 "parser.tab.c"
+      }
+      break;
+    case 207: /* stmtlist */
+    case 208: /* optstmtlist */
+    case 156: /* progunit */
+    case 209: /* classdefn */
+    case 210: /* namespacedefn */
+    case 211: /* classdefnstmt */
+    case 212: /* externcblock */
+    case 213: /* block */
+    case 320: /* $$32 */
+      if (!trial) {
+    case 319: /* $$31 */
+    case 321: /* $$33 */
+#line 444 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppCompundObj); }
+#line 370 "parser.tab.c"
+      }
+      break;
+    case 214: /* templatespecifier */
+    case 215: /* templateparamlist */
+      if (!trial) {
+    case 322: /* $$34 */
+#line 445 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->templateParamList); }
+#line 379 "parser.tab.c"
+      }
+      break;
+    case 217: /* doccomment */
+      if (!trial) {
+#line 445 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->docCommentObj); }
+#line 386 "parser.tab.c"
+      }
+      break;
+    case 184: /* fwddecl */
+      if (!trial) {
+#line 446 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->fwdDeclObj); }
+#line 393 "parser.tab.c"
+      }
+      break;
+    case 196: /* vardecllist */
+    case 197: /* vardeclliststmt */
+      if (!trial) {
+#line 446 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppVarObjList); }
+#line 401 "parser.tab.c"
+      }
+      break;
+    case 218: /* expr */
+    case 219: /* exprlist */
+    case 220: /* exprorlist */
+    case 221: /* funcargs */
+    case 222: /* exprstmt */
+    case 223: /* optexpr */
+    case 225: /* captureallbyref */
+    case 226: /* captureallbyval */
+    case 227: /* objcarg */
+    case 228: /* objcarglist */
+      if (!trial) {
+    case 224: /* lambdacapture */
+#line 447 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppExprObj); }
+#line 418 "parser.tab.c"
+      }
+      break;
+    case 229: /* lambda */
+      if (!trial) {
+#line 447 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppLambda); }
+#line 425 "parser.tab.c"
+      }
+      break;
+    case 241: /* funcpointerdecl */
+    case 242: /* funcptrtypedef */
+    case 243: /* funcptrortype */
+    case 244: /* funcobj */
+      if (!trial) {
+    case 239: /* functionpointer */
+    case 240: /* functionptrtype */
+#line 447 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppFuncPointerObj); }
+#line 437 "parser.tab.c"
+      }
+      break;
+    case 246: /* funcdecl */
+    case 247: /* funcdeclstmt */
+    case 248: /* funcdefn */
+      if (!trial) {
+#line 447 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppFuncObj); }
+#line 446 "parser.tab.c"
+      }
+      break;
+    case 191: /* param */
+      if (!trial) {
+#line 448 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->varOrFuncPtr); }
+#line 453 "parser.tab.c"
+      }
+      break;
+    case 198: /* paramlist */
+    case 199: /* lambdaparams */
+      if (!trial) {
+#line 448 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->paramList); }
+#line 461 "parser.tab.c"
+      }
+      break;
+    case 249: /* ctordecl */
+    case 250: /* ctordeclstmt */
+    case 251: /* ctordefn */
+      if (!trial) {
+    case 312: /* $$25 */
+    case 313: /* $$26 */
+    case 314: /* $$27 */
+#line 448 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppCtorObj); }
+#line 473 "parser.tab.c"
+      }
+      break;
+    case 252: /* dtordecl */
+    case 253: /* dtordeclstmt */
+    case 254: /* dtordefn */
+      if (!trial) {
+    case 315: /* $$28 */
+    case 316: /* $$29 */
+    case 317: /* $$30 */
+#line 448 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppDtorObj); }
+#line 485 "parser.tab.c"
+      }
+      break;
+    case 255: /* typeconverter */
+    case 256: /* typeconverterstmt */
+      if (!trial) {
+#line 449 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppTypeConverter); }
+#line 493 "parser.tab.c"
+      }
+      break;
+    case 266: /* optinheritlist */
+      if (!trial) {
+#line 449 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->inheritList); }
+#line 500 "parser.tab.c"
+      }
+      break;
+    case 270: /* identifierlist */
+      if (!trial) {
+#line 449 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->identifierList); }
+#line 507 "parser.tab.c"
+      }
+      break;
+    case 195: /* asmblock */
+      if (!trial) {
+#line 450 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->asmBlock); }
+#line 514 "parser.tab.c"
+      }
+      break;
+    case 271: /* functhrowspec */
+    case 272: /* optfuncthrowspec */
+      if (!trial) {
+#line 450 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->funcThrowSpec); }
+#line 522 "parser.tab.c"
+      }
+      break;
+    case 273: /* attribspecifier */
+      if (!trial) {
+#line 450 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->attribSpecifier); }
+#line 529 "parser.tab.c"
+      }
+      break;
+    case 230: /* ifblock */
+      if (!trial) {
+#line 451 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->ifBlock); }
+#line 536 "parser.tab.c"
+      }
+      break;
+    case 231: /* whileblock */
+      if (!trial) {
+#line 451 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->whileBlock); }
+#line 543 "parser.tab.c"
+      }
+      break;
+    case 232: /* dowhileblock */
+      if (!trial) {
+#line 451 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->doWhileBlock); }
+#line 550 "parser.tab.c"
+      }
+      break;
+    case 274: /* attribspecifiers */
+    case 275: /* optattribspecifiers */
+      if (!trial) {
+#line 451 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->attribSpecifiers); }
+#line 558 "parser.tab.c"
+      }
+      break;
+    case 233: /* forblock */
+      if (!trial) {
+#line 452 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->forBlock); }
+#line 565 "parser.tab.c"
+      }
+      break;
+    case 234: /* forrangeblock */
+      if (!trial) {
+#line 452 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->forRangeBlock); }
+#line 572 "parser.tab.c"
+      }
+      break;
+    case 235: /* switchstmt */
+      if (!trial) {
+#line 452 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->switchBlock); }
+#line 579 "parser.tab.c"
+      }
+      break;
+    case 236: /* caselist */
+      if (!trial) {
+#line 452 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->switchBody); }
+#line 586 "parser.tab.c"
+      }
+      break;
+    case 237: /* tryblock */
+      if (!trial) {
+#line 453 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->tryBlock); }
+#line 593 "parser.tab.c"
+      }
+      break;
+    case 238: /* catchblock */
+      if (!trial) {
+#line 453 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->catchBlock); }
+#line 600 "parser.tab.c"
+      }
+      break;
+    case 276: /* define */
+      if (!trial) {
+#line 453 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->hashDefine); }
+#line 607 "parser.tab.c"
+      }
+      break;
+    case 277: /* undef */
+      if (!trial) {
+#line 453 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->hashUndef); }
+#line 614 "parser.tab.c"
+      }
+      break;
+    case 278: /* include */
+      if (!trial) {
+#line 454 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->hashInclude); }
+#line 621 "parser.tab.c"
+      }
+      break;
+    case 279: /* import */
+      if (!trial) {
+#line 454 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->hashImport); }
+#line 628 "parser.tab.c"
+      }
+      break;
+    case 280: /* hashif */
+      if (!trial) {
+#line 454 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->hashIf); }
+#line 635 "parser.tab.c"
+      }
+      break;
+    case 281: /* hasherror */
+      if (!trial) {
+#line 454 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->hashError); }
+#line 642 "parser.tab.c"
+      }
+      break;
+    case 257: /* meminitlist */
+      if (!trial) {
+#line 455 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->memInitList); }
+#line 649 "parser.tab.c"
+      }
+      break;
+    case 282: /* hashwarning */
+      if (!trial) {
+#line 455 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->hashWarning); }
+#line 656 "parser.tab.c"
+      }
+      break;
+    case 283: /* pragma */
+      if (!trial) {
+#line 455 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->hashPragma); }
+#line 663 "parser.tab.c"
+      }
+      break;
+    case 285: /* blob */
+      if (!trial) {
+#line 455 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->blob); }
+#line 670 "parser.tab.c"
+      }
+      break;
+    case 286: /* label */
+      if (!trial) {
+#line 455 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->label); }
+#line 677 "parser.tab.c"
+      }
+      break;
+    case 189: /* varassign */
+    case 190: /* optvarassign */
+      if (!trial) {
+#line 456 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->cppVarAssign.assignValue_); }
+#line 685 "parser.tab.c"
+      }
+      break;
+    case 258: /* meminit */
+      if (!trial) {
+#line 457 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->memInit.init); }
+#line 692 "parser.tab.c"
+      }
+      break;
+    case 245: /* funcdecldata */
+      if (!trial) {
+#line 458 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->funcDeclData.paramList); }
+#line 699 "parser.tab.c"
+      }
+      break;
+    case 182: /* enumitem */
+      if (!trial) {
+#line 459 "/root/repo/src/parser.y"
+	{ if (!trial) gStackValueOwner->onValue(val->enumItem.val); }
+#line 706 "parser.tab.c"
+      }
+      break;
+    case 216: /* templateparam */
+      if (!trial) {
+#line 460 "/root/repo/src/parser.y"
+	{ if (!trial) { gStackValueOwner->onValue(val->templateParam.paramType); gStackValueOwner->onValue(val->templateParam.defaultArg); } }
+#line 713 "parser.tab.c"
+      }
+      break;
+    default:
+        break;
+    }
+}
+#line 720 "parser.tab.c"
+static int yylhs[] = {                                        -1,
+    0,   52,   52,   51,   51,   51,   20,   20,   20,   20,
+   20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+   20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+   20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+   20,   20,   20,   20,   20,   20,  130,  128,  128,  128,
+  128,  128,  128,  128,  128,   39,  131,   19,  132,   19,
+  133,   19,   79,   80,   80,   80,   80,   80,   57,   57,
+   74,   74,   74,   75,   75,   76,   77,   77,   77,   78,
+   81,   81,   82,   67,   67,   67,  120,  120,  120,  120,
+  120,  120,  121,  122,  122,  123,  123,  124,  124,  124,
+  124,  124,  124,  124,  125,  125,  126,  126,  127,   61,
+   17,   17,   17,   17,  134,    5,  135,    5,  136,    5,
+  137,    5,  138,    5,  139,    5,  140,    5,  141,    5,
+    7,    7,    7,    7,    7,    7,    8,    8,    8,    8,
+    8,    8,    8,    8,    8,    8,    8,    8,    8,  142,
+   15,  143,   15,  144,   15,  145,   16,  146,   12,  147,
+   11,   10,   10,    6,    6,   26,   26,   26,   26,   26,
+   26,  129,   27,   27,   27,   27,   23,   23,   23,   23,
+   23,   23,   23,   25,   24,   24,   24,   86,   45,   47,
+   46,   44,   50,   50,   50,   50,   50,   50,   49,   48,
+   41,   41,   32,   32,   32,   32,   32,   40,   40,   40,
+   40,   40,   40,   31,   31,   31,   31,   31,   31,   31,
+   31,   31,   33,   33,   33,   34,   34,   30,   30,   30,
+   30,   30,   30,   30,   30,   29,   29,   29,   29,   29,
+   29,   29,   29,   29,   29,   29,   29,   29,   29,    9,
+    9,    9,    9,    9,   21,   21,   21,   22,   22,   22,
+   22,   22,   22,   22,   22,  105,  105,  105,  104,  104,
+  104,  104,   99,   99,   99,   99,   99,   99,  100,  100,
+   91,   92,   73,   73,   43,   43,   87,   87,   87,   87,
+   87,   87,   87,   83,   84,   88,   85,   89,   89,   90,
+   90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+   90,   36,   14,   14,   14,   14,   18,   13,   13,   13,
+   13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+   13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+   13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+   13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+   13,   13,   13,   13,   13,   42,   42,   42,   35,   35,
+   35,   35,   35,   35,   35,   35,  149,   37,  150,   37,
+  151,   37,  152,   37,  153,   38,  154,   38,  155,   38,
+  107,  107,  107,  107,  107,  107,  108,  108,  106,  106,
+  106,  106,  106,  106,  106,  106,  106,  106,  106,  116,
+  116,  115,  114,  114,  114,   94,   95,  156,   95,  157,
+   95,  158,   95,   95,   95,   93,   93,   93,   93,   93,
+   93,   93,   93,  101,  101,  101,  101,  102,  102,  102,
+  102,   97,   98,  159,   98,  160,   98,  161,   98,   98,
+   98,   96,   96,   96,   96,   96,   96,   96,   96,  148,
+  148,  162,  162,   55,  117,  119,  119,  118,  118,  163,
+   53,  164,   53,   53,  165,   54,  109,  109,  110,  110,
+  110,  110,  110,  112,  112,  112,  112,  111,  111,   28,
+   28,   28,   28,   28,  103,  103,  103,  166,   58,   59,
+   59,   59,   60,   60,   60,   60,   60,   60,   60,   60,
+   60,   60,   60,   60,   60,   60,   60,    2,    2,    3,
+    3,    3,    3,    4,    4,    4,  113,  113,  113,   56,
+    1,    1,   62,   62,   62,   62,   62,   62,   62,   62,
+   62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+   62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+   62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+   62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+   62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+   62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+   62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+   62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+   62,   71,   72,   72,   63,   63,   63,   64,   64,   64,
+   65,   65,   69,   70,   68,   68,   68,   66,
+};
+static int yylen[] = {                                         2,
+    1,    0,    1,    1,    2,    2,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    2,    2,    1,    1,    1,    1,    2,    1,    1,    1,
+    1,    1,    1,    1,    1,    1,    0,    2,    0,    4,
+    0,    5,    7,    0,    5,    4,    2,    2,    3,    2,
+    5,    5,    3,    5,    5,    6,    9,    9,    9,    7,
+    3,    2,    6,    0,    1,    1,    4,    3,    4,    4,
+    4,    4,    3,    3,    3,    3,    3,    3,    3,    3,
+    3,    2,    3,    2,    2,    3,    2,    3,    3,    1,
+    1,    1,    2,    2,    0,    2,    0,    4,    0,    2,
+    0,    2,    0,    2,    0,    3,    0,    2,    0,    2,
+    1,    1,    1,    1,    1,    2,    1,    2,    3,    1,
+    1,    1,    2,    2,    1,    2,    2,    2,    4,    0,
+    5,    0,    7,    0,    9,    0,    3,    0,    2,    0,
+    2,    0,    1,    0,    1,    1,    3,    1,    1,    1,
+    1,    1,    0,    2,    3,    2,    5,    8,    6,    6,
+    9,    7,    8,    2,    5,    6,    4,    3,    2,    2,
+    2,    2,    5,    5,    5,    5,    2,    3,    5,    4,
+    2,    3,    2,    2,    2,    2,    2,    6,    6,    8,
+    7,    5,    7,    5,    6,    6,    5,    5,    4,    3,
+    2,    2,    2,    3,    3,    0,    1,    2,    3,    1,
+    4,    3,    3,    2,    2,    3,    2,    3,    4,    4,
+    3,    1,    1,    2,    1,    2,    2,    2,    4,    1,
+    1,    4,    4,    5,    0,    1,    2,    1,    1,    1,
+    1,    2,    2,    2,    2,    1,    1,    1,    1,    1,
+    1,    1,    5,    7,    2,    2,    2,    2,    2,    2,
+    2,    2,    5,    7,    0,    3,   12,   11,   10,    9,
+    9,    2,    2,    1,    1,    5,    2,    4,    5,    3,
+    2,    3,    4,    5,    2,    2,    2,    2,    3,    3,
+    2,    5,    1,    1,    2,    1,    2,    2,    2,    2,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    2,    2,    2,    2,    3,    3,    2,    4,    2,    4,
+    2,    3,    3,    3,    4,    0,    1,    3,    1,    3,
+    1,    1,    1,    2,    4,    3,    0,    1,    0,    2,
+    0,    2,    0,    2,    0,    2,    0,    4,    0,    5,
+    1,    1,    1,    1,    1,    1,    0,    1,    1,    1,
+    1,    1,    2,    2,    2,    2,    2,    3,    1,    0,
+    1,    4,    0,    1,    3,    2,    3,    0,   10,    0,
+   12,    0,   13,    2,    2,    4,    2,    2,    3,    3,
+    2,    2,    2,    0,    2,    2,    3,    4,    3,    4,
+    3,    2,    2,    0,    8,    0,   10,    0,   11,    2,
+    2,    5,    2,    2,    2,    3,    3,    3,    2,    0,
+    1,    0,    1,    2,    5,    0,    1,    1,    2,    0,
+   11,    0,    8,    2,    0,    6,    0,    1,    0,    4,
+    5,    4,    5,    0,    1,    1,    1,    0,    1,    3,
+    4,    2,    3,    2,    1,    1,    1,    0,    5,    0,
+    1,    3,    2,    4,    2,    4,    2,    4,    1,    3,
+    1,    3,    3,    3,    3,    3,    3,    0,    1,    1,
+    4,    4,    4,    1,    2,    4,    2,    2,    2,    2,
+    1,    2,    1,    1,    1,    2,    1,    3,    4,    3,
+    4,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+    2,    2,    3,    3,    3,    3,    3,    3,    3,    3,
+    3,    3,    3,    5,    3,    3,    3,    3,    3,    3,
+    3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+    3,    3,    3,    3,    4,    3,    3,    4,    4,    4,
+    3,    4,    4,    6,    4,    4,    7,    7,    7,    7,
+    3,    3,    2,    5,    6,    2,    4,    2,    1,    2,
+    1,    4,    4,    5,    5,    2,    1,    2,    2,    4,
+    4,    3,    1,    2,    3,    3,    2,    1,    1,    2,
+    0,    1,    1,    1,    1,    1,    1,    2,
+};
+static int yydefred[] = {                                      0,
+  158,  160,  531,  534,    0,   57,    0,    0,    0,  131,
+  134,  133,  132,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  111,  112,    0,    0,    0,  145,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,   43,    0,    0,  269,
+    0,  142,  123,  316,   56,  172,    0,  266,  267,  393,
+  392,  394,    0,  270,  271,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  140,    0,
+  119,    0,    0,    0,  121,  129,    0,    0,    4,    0,
+   10,    9,   15,    0,    0,    0,    7,   44,    0,    8,
+    0,   11,    0,   12,   38,   39,   37,    0,    0,    0,
+   14,   13,   31,   34,    0,    0,    0,   17,  617,    0,
+   19,   20,   21,   22,   35,    0,    0,  242,   23,   32,
+    0,    0,   24,   25,    0,   26,   27,    0,   28,   29,
+    0,   30,    0,    0,    0,    0,    0,  468,    0,   48,
+   49,   50,   51,   52,   53,   54,   55,   33,   45,   46,
+  159,  161,  619,   58,    0,    0,    0,  141,    0,  268,
+    0,    0,  395,    0,    0,    0,    0,  115,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  391,    0,
+    0,    0,    0,    0,    0,    0,    0,  519,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  147,    0,    0,    0,    0,    0,    0,    0,  498,    0,
+    0,  146,    0,    0,    0,    0,  315,  136,    0,  530,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  331,  332,  333,  334,  335,
+  336,  337,  338,  339,  340,  341,  342,  343,  344,  345,
+  346,  347,  348,  349,  350,  351,  353,  354,  329,  330,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  352,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  536,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  634,    0,
+    0,  632,  635,    0,  636,  637,    0,    0,    0,    0,
+    0,    0,    0,  222,    0,  230,    0,    0,  124,  618,
+    0,  496,  497,    0,    0,  494,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  102,    0,
+  104,    0,    0,    0,    0,    0,  608,  542,    0,    0,
+    0,    0,    0,  532,    0,    0,    0,  205,    0,    0,
+    0,    0,    0,    0,    0,    0,  525,    0,    0,    0,
+  125,    0,    0,    0,    0,    0,  261,  259,  260,  258,
+    0,  237,    0,    0,  120,    0,    0,   47,  116,    0,
+    0,  122,  130,  113,  114,    0,   41,  128,  184,    0,
+    0,    0,    0,    0,    0,    0,  228,  301,    0,    0,
+    0,  203,    0,    0,  221,  204,    0,  201,  189,  190,
+    5,    0,    0,    0,    6,  464,    0,    0,    0,    0,
+    0,    0,  492,    0,  197,    0,    0,    0,  425,    0,
+  450,    0,    0,   70,  616,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  550,  552,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  638,    0,    0,    0,    0,    0,   82,  297,  409,    0,
+  399,  400,  401,  402,    0,    0,    0,  281,  282,  311,
+    0,  416,  432,    0,    0,  431,    0,  442,  443,    0,
+  459,  279,  276,  280,    0,    0,    0,    0,    0,    0,
+    0,    0,  207,  206,    0,    0,    0,    0,    0,  424,
+    0,  451,    0,    0,    0,    0,  469,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  248,  251,    0,
+    0,  188,    0,    0,    0,    0,  198,    0,    0,    0,
+    0,    0,  173,    0,    0,    0,    0,    0,    0,  148,
+    0,    0,    0,  238,    0,  241,  475,    0,    0,  157,
+    0,    0,    0,    0,    0,    0,   81,    0,    0,    0,
+  364,  355,  356,    0,    0,    0,    0,  495,    0,  474,
+    0,    0,    0,    0,    0,  630,    0,    0,    0,    0,
+  601,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  623,    0,    0,    0,  602,    0,    0,
+    0,  493,    0,  109,    0,    0,    0,   93,   94,   95,
+   96,   97,   98,   99,  101,  100,  103,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   69,    0,  538,    0,  540,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  363,
+  126,    0,    0,  381,  385,    0,    0,  378,    0,    0,
+  369,  367,    0,    0,    0,    0,    0,    0,    0,  265,
+  263,  264,  262,  257,    0,  418,    0,    0,    0,    0,
+   59,    0,    0,    0,    0,  302,    0,  229,  300,    0,
+  220,    0,    0,  232,    0,    0,    0,    0,  527,  528,
+  529,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  586,  587,    0,  317,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  591,    0,    0,    0,
+    0,  584,    0,   73,    0,  403,    0,  404,  405,  406,
+  407,    0,  309,  310,  429,  430,    0,  435,  436,    0,
+  417,    0,  457,  458,    0,    0,  490,    0,    0,  202,
+    0,    0,    0,    0,  236,  526,    0,    0,    0,    0,
+    0,  200,    0,    0,    0,    0,    0,  187,    0,  173,
+    0,  173,    0,    0,  362,    0,    0,    0,  239,  240,
+    0,    0,    0,    0,    0,    0,  501,    0,  149,    0,
+    0,    0,    0,    0,    0,    0,  612,  613,  358,  360,
+    0,  461,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  620,  621,    0,  624,    0,
+    0,    0,    0,   90,   91,   89,   92,   87,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  539,  541,    0,  522,  523,  521,    0,  118,    0,    0,
+  380,  382,  386,  150,    0,    0,  384,    0,    0,    0,
+  426,  374,  595,    0,  444,    0,    0,    0,  365,  593,
+   60,   61,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  219,  224,  231,  225,    0,    0,  589,  592,
+  590,    0,  585,  588,    0,  408,    0,    0,    0,    0,
+  437,  491,    0,  485,  486,  487,  489,    0,    0,    0,
+  463,    0,    0,    0,    0,  163,  173,  193,    0,  196,
+  194,  195,    0,  173,    0,    0,    0,    0,    0,  177,
+    0,    0,  174,  168,  169,  171,  185,    0,    0,    0,
+  199,    0,    0,    0,    0,    0,    0,  499,    0,    0,
+    0,    0,    0,    0,    0,  614,  615,  273,  452,  465,
+    0,    0,    0,  283,    0,   72,   71,    0,    0,    0,
+    0,   75,   74,    0,    0,    0,    0,  420,    0,  151,
+  387,    0,    0,    0,    0,  376,    0,  368,    0,    0,
+    0,   62,    0,    0,  253,  252,    0,    0,  218,    0,
+    0,  214,  217,    0,  227,    0,    0,    0,    0,    0,
+  412,  439,    0,  441,    0,  478,    0,    0,    0,    0,
+    0,  472,    0,    0,    0,    0,    0,    0,    0,    0,
+  186,  179,  173,  180,  175,    0,    0,  476,    0,  517,
+  516,    0,  515,  514,  513,    0,    0,  502,    0,    0,
+    0,    0,    0,    0,  286,    0,    0,    0,    0,    0,
+   76,    0,    0,    0,  446,    0,    0,  388,  389,    0,
+    0,  375,    0,    0,    0,  422,  254,    0,    0,    0,
+  215,  216,    0,  594,    0,    0,  438,  440,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  209,  208,
+    0,    0,  173,  182,    0,    0,    0,    0,    0,  597,
+  598,  599,  600,  284,   80,    0,    0,    0,    0,    0,
+    0,   63,    0,  274,    0,    0,  312,  390,    0,  153,
+    0,    0,  448,    0,    0,    0,    0,    0,   83,    0,
+    0,    0,    0,    0,    0,    0,    0,  183,  296,    0,
+  178,    0,    0,    0,    0,    0,    0,    0,    0,  445,
+  411,    0,    0,    0,    0,    0,    0,  470,  473,    0,
+    0,  210,  181,   78,   79,   77,    0,    0,    0,    0,
+  155,    0,    0,    0,  291,  290,    0,    0,    0,    0,
+    0,  447,    0,  419,    0,    0,    0,    0,    0,    0,
+    0,  449,    0,  288,  471,    0,  421,    0,    0,  423,
+};
+static int yydgoto[] = {                                      74,
+   75,  725,  174,  175,  240,  217,   79,  208,  417,  200,
+   81,  178,   83,   84,   85,   86,   87,  494,  179,   89,
+  392,  393,  180,   91,   92,  993,  833,   93,   94,   95,
+   96,   97,  425, 1066,  702,  694,  695,  696,   98,   99,
+  100,  703,  881,  101,  102,  103,  104,  105,  106,  107,
+  108,  360,  184,  111,  112,  113,  114,  289,  846,  847,
+  116,  117,  306,  312,  313,  118,  666,  314,  315,  316,
+  634,  635,  119,  120,  121,  122,  123,  124,  125, 1123,
+  126,  497,  326,  128,  129,  130,  290,  826,  418,  132,
+  133,  134,  135,  136,  137,  138,  139,  140,  141,  142,
+  515,  798,  187,  291,  189,  505,  292,  147, 1077,  809,
+  968,  969,  435,  958,  516, 1222,  148,  149,  528,  150,
+  151,  152,  153,  154,  155,  156,  157,  158,  159,  160,
+  164,  931, 1052,  399,  908,  395,  402,  329,  691,  408,
+  403, 1040, 1190, 1241,  590,  161,  162,  863,  698,  911,
+  912,  917,  913, 1128, 1188,  926, 1126, 1194, 1049, 1185,
+ 1223,  972, 1248, 1154,  841,  589,
+};
+static int yysindex[] = {                                  22950,
+    0,    0,    0,    0,    0,    0,    0,    0, 2360,    0,
+    0,    0,    0,  455,    0,    0,    0,    0, 2250, 2963,
+ 3037,  121,    0,    0, 2816,    0, -115,    0, -250,  -69,
+  -34,  107, -115,  593,   45,23475,22494,22494,  196,22494,
+22494,22494,22494,22494,17532,18845,    0,22585,22677,    0,
+    0,    0,    0,    0,    0,    0,  320,    0,    0,    0,
+    0,    0,    0,    0,    0, 3443,  525,  594,  611,22950,
+  628,  593,22950,    0,    0,16160,  651,  585,    0,  380,
+    0,  662,    0,  707,    0,    0,    0,    0,    0,  184,
+    0,    0,    0, 7258, 3086,  730,    0,    0,   29,    0,
+  767,    0,  780,    0,    0,    0,    0,23041, 1045,  462,
+    0,    0,    0,    0,15767,    0,11224,    0,    0,    0,
+    0,    0,    0,    0,    0,  574,    0,    0,    0,    0,
+  308, 1549,    0,    0,   52,    0,    0, 1695,    0,    0,
+  631,    0, 3284,13381,    0,  -96,13381,    0, 6425,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  620,  582, 1763,    0, 2250,    0,
+  818,    0,    0,14581,    0,    0,  111,    0,    0,  111,
+ 1210,   17,  817,  111,14581,    0,  625,14581,    0,    0,
+ 2250, 2250,  250,  858,  625,14088,  320,    0,    0,  829,
+  902, 2250,  674, 2973,24116,10873,    0,    0,  941,  668,
+    0, 2250,  116, 2250,  116,  654,  884,  915,    0,  654,
+    0,    0,    0,22494,  976,    0,    0,    0,22950,    0,
+ -115,14581,14581,14581,14581,  574,22494,18939,19030,    0,
+ 9228,  980,17972,  320, 1763,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  993,  835,    0,    0, 9368,  131, 2704,  308,
+14581,14581,  -19,  -19,    0,  -19,  -19,    0,  -19,    0,
+  -19,  -19,19487,   84,    0,    0,  998,22494,    0,18939,
+15082,    0,    0,  955,    0,    0,17532,  725,  -19,18939,
+  -19,15374, 2871,    0,15374,    0,    0,15374,    0,    0,
+    0,    0,    0, 4302,   11,    0, 2147, 3284,  781,    0,
+    0,  320,  320,  317,  336,  795,  320,  407,    0,  815,
+    0,18097, 4126,18097,  743,22494,    0,    0,    0, 1134,
+11224,    0,   56,    0,14581,  320,  851,    0,13784,    0,
+    0,    0,    0,    0,    0,16553,    0, 1776,    0, 3054,
+    0,17972,11769,19581,14088,    0,    0,    0,    0,    0,
+  797,    0,  831,  725,    0,  -78,17972,    0,    0,17972,
+19581,    0,    0,    0,    0,19764,    0,    0,    0,  282,
+    0,  101,10873,    0, 3565,  851,    0,    0,22494,19213,
+19855,    0,22494,19581,    0,    0,  380,    0,    0,    0,
+    0, 1154, 1170, 1179,    0,    0,  282, 2250,    0,16553,
+  851,    0,    0,    0,    0,    0,    0,    0,    0, 1864,
+    0,    0,16553,    0,    0,22494,22494,22494,22494,22494,
+22494,22494,22494,22494,22494,22494,22494,22494,22494,22494,
+22494,22494,22494,    0,    0, 6948,10873,22494,19949,22494,
+22494,22494,22494,22494,22494,22494,22494,22494,19581,20132,
+    0,22494, 8968,22494,22950, 1153,    0,    0,    0,  985,
+    0,    0,    0,    0,    0, 1237, -235,    0,    0,    0,
+ -210,    0,    0, -140, 1334,    0, -169,    0,    0,    0,
+    0,    0,    0,    0, 1162,  608, 1162, 1226,    0,13381,
+    0,    0,    0,    0,  636, 7662,16553,    0,    0,    0,
+    0,    0,    0, 2775, 1254,  111,    0,  201,  625,  625,
+  320,    0,    0,22494,  133,    0, 2250,    0,    0,  612,
+  654,    0, 1162,    0,  214,  573,    0,14581,  320, 1140,
+  875,   41,    0,14088, 1220,    0, 1013, 2973,14088,    0,
+11769,14581,  116,    0,  116,    0,    0, 2250,16946,    0,
+12433,22494,  -27,    2,   63,  117,    0,17972,  187,12836,
+    0,    0,    0, 1262, 1266,    0, -158,    0, 1047,    0,
+    0,  972,    0,    0,    0,    0,  625,22494,22494,22494,
+    0,15082,    0, 1099, 1099,22768,22494,22494,22494,17532,
+18939, 1321,13239,    0,  296, 1405,13642,    0,22494, 8066,
+15374,    0, 2250,    0,    0,    0, 1163,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 1410,14439,19487,
+ 2926, 1399,  696,13642, 1420, 1411, 1445,14842, 1450,25909,
+    0,20223,    0, 1388,    0, 1481, 3078,13784,    0,13784,
+13784,    0,    0, 1493,  450, 1503,23475,    0,    0,    0,
+    0, 5513,  133,    0,    0,  -16,27673,    0,  853, 2871,
+    0,    0,   94,11769,  308, 1426,    0,    0, 1924,    0,
+    0,    0,    0,    0,  320,    0,   -8,27723,   22, 1521,
+    0,25944,  560,  320,   14,    0,  745,    0,    0,27275,
+    0, 1032, 1530,    0,25999,17607, 1458,  320,    0,    0,
+    0, 3078, 9228, 9228, 9228, 9228, 9228, 9228, 9228, 9228,
+ 1091, 9228, 9228, 1736, 1736, 2429, 2429, 1748, 5633, 3382,
+10873,    0,    0, 2429,    0, 2429,  434,  434,  241,  241,
+  241, 2716, 3900, 3025, 9228, 1551,    0,26150,26238,10873,
+10873,    0,    0,    0,14581,    0, 1261,    0,    0,    0,
+    0, 2250,    0,    0,    0,    0,  449,    0,    0, 2250,
+    0,    0,    0,    0,  979, 2250,    0,    0,  753,    0,
+  625,10873,  380,  380,    0,    0,  320, 1467, 1545,26293,
+    0,    0,  588,  111,    0, 1569,  640,    0,14088,    0,
+14088,    0,  284, 1017,    0,14581,  765,  133,    0,    0,
+22950, 1082,  674, 3037,  770,   90,    0, 1584,    0,26328,
+ 1606, 1622, 1623, 1627,  302,26390,    0,    0,    0,    0,
+  625,    0, 1589, 1609,  -19, 9228, 9228, 1614,    0,  -19,
+  -19,  -19,    0,15082,22494,    0,    0, 1321,    0,11769,
+ 1516,22494,  -19,    0,    0,    0,    0,    0,22950,22950,
+13642,    0,22494,19581,19581,19581,22950,22950,22494, 1585,
+    0,    0,14581,    0,    0,    0,  245,    0,  -58, 1680,
+    0,    0,    0,    0,17532,22494,    0,22494,20406,11769,
+    0,    0,    0,  282,    0, 1691, 1452,17532,    0,    0,
+    0,    0,  320,  320, 1701, 1703,  320,  952,   48,  320,
+  601,  320,    0,    0,    0,    0,   91,    0,    0,    0,
+    0,22494,    0,    0,  661,    0,  654,  959,19304,19396,
+    0,    0, 1582,    0,    0,    0,    0, 2025, 1408,    0,
+    0, 1643,  779,  320,  320,    0,    0,    0, 1721,    0,
+    0,    0,14088,    0, 1067,  393, 1129,  484,    0,    0,
+ 1709, 1722,    0,    0,    0,    0,    0,  133, 1633, 1441,
+    0, 1726,    0, 1731,    0,22494, 1739,    0,16946,22494,
+22494,22494,22494,22494,22494,    0,    0,    0,    0,    0,
+27275, 1349,14581,    0,  -19,    0,    0, 9629, 1745, 1751,
+ 1777,    0,    0,26445,    0, -158,  320,    0,11769,    0,
+    0,17972,27778, 2035,27275,    0,26534,    0, 1782,11769,
+  429,    0, 1799, 1800,    0,    0, 1806, 1010,    0,  320,
+  320,    0,    0,19581,    0, 1790, 1812, 9228, 1813, 2250,
+    0,    0, 1821,    0, 1753,    0, 1226,14088,14088, 2025,
+ 1408,    0,  320, 1205, 2961,   91,  567,11769, 1181,  602,
+    0,    0,    0,    0,    0,22494, 1523,    0,14581,    0,
+    0,14581,    0,    0,    0,27275,22494,    0,27723,  -19,
+26684,26742,26827,26862,    0,  763,22950,19581,19581,19581,
+    0,    0,  802, 1849,    0, 1857, 1470,    0,    0,22494,
+    0,    0, 1868, 1495,  320,    0,    0, 1865, 1871,  320,
+    0,    0,22494,    0, -115,  654,    0,    0,  753,  874,
+  874,14088,14088,22950, 1876, 1033,22494,22494,    0,    0,
+  320, 1536,    0,    0,  650,27275,  133,  133,27723,    0,
+    0,    0,    0,    0,    0, 1881, 1886, 1887,    0,22494,
+ 1892,    0,    0,    0, 1875,11769,    0,    0, 2564,    0,
+ -115, 1677,    0, 1912,11769,11769, 1948,27275,    0, 1880,
+  874,  874, 1760, 1968,  320,26981,27275,    0,    0,  653,
+    0,22950,22950,22950,27155,23041, 1983, 1555,    0,    0,
+    0, 1980, 2014,11769, 1610, 1639, 2018,    0,    0,11769,
+ 2065,    0,    0,    0,    0,    0,23041, 1045, -115, 1677,
+    0, 1334, 2066, 1659,    0,    0,11769,22950, 1671, 2075,
+ 1045,    0, 1980,    0, -115, 1677, 1805, 1874,    0,11769,
+ 1334,    0, 1980,    0,    0, 1932,    0, 1334,    0,    0,
+};
+static int yyrindex[] = {                                     60,
+    0,    0,    0,    0, 8753,    0,23688,    0,    0,    0,
+    0,    0,    0, 2002,  901, 8215,10581, 4685, 2004,    0,
+    0,    0,    0,    0,    0,10358,19113,    0,    0,    0,
+    0,    0,    0,23788,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 2031,    0,    0,    0,    0,
+  -59,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0, 2925,    0,    0,    0,    0,    0,    0,    0,
+    0,23877, 2316,    0, 9063,    0,14974,24600,    0,  119,
+    0,24517, 9157,    0,    0,    0, 4355, 6623,    0, 8470,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   86, 2128, 8874,
+    0,    0,    0,    0,    0, 3729,    0,    0,    0, 5818,
+    0,    0,    0,    0,    0, 4787, 3047,    0,    0,    0,
+18229,    0,    0,    0, 1395,    0,    0,    0,    0,    0,
+    0,    0, 1494,    0,   30,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,23954, 7447, 1600,    0, 6733,25104,
+    0, 2080, 2086,25188,    0,  658, 1437,    0,    0,    0,
+    0,    0,    0, 1182,    0,    0,    0,    0, 7541,    0,
+11366,    0,    0,    0,    0,    0,10762,10668,    0,    0,
+    0,    0, 5976,    0, 5976, 2051,    0, 1213,    0,    0,
+ 7851,    0, 7945,    0,    0, 7043,    0,    0, 1974,    0,
+    0,    0,    0,    0,    0,    0,    0, 2031,    0, -200,
+20497,    0,    0,    0, 2002,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0, 9467, 9561, 1839,    0,    0,25600,
+    0,    0,11559,11868,    0,11962,12271, 9870,12365,25792,
+12674,12768,    0,    0,22859, 9964,    0, 2082,    0, 2031,
+ 2087,    0,    0,    0,    0,    0,    0,14277,13077,    0,
+13171,    0,    0,    0,    0,    0, 1039,    0,    0,    0,
+10634,    0,    0,    0,    0,    0,    0,    0,    0, 4902,
+ 5250,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0, 2120,    0,    0,    0,    0,    0, 5541,    0,
+ 2064,    0,    0,    0,    0,    0, 7752,    0,    0,    0,
+ 1250, 1626, 1293, 1465,   30,    0,    0,    0, 6166,    0,
+    0,  156, 1971, 2088,    0,24690,    0,    0,    0,    0,
+    0,    0,10264,11062,    0,    0,  156,    0,    0,  156,
+ 2144,    0,    0,    0,    0,    0,    0,    0,    0,25268,
+ 4478, 3048,    0, 1338,    0, 1927,    0,    0,    0,    0,
+    0,    0,    0, 2088,    0,    0, 1954,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,25352,    0,  -59,    0,
+ 7752, 7348,    0, 2493,    0, 2502, 1657, 2155,    0,    0,
+    0, 2104,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2144,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,25516,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0, 1712,
+    0,    0,    0,    0,    0,    0, 1611, 1888,    0,    0,
+ 2602,    0,    0,    0,    0,    0,    0, 2124, 2161,    0,
+ 2162,    0, 2215,    0,    0, 5976,    0,    0,  -26, 1960,
+ 2002,22401, 7043,    0,    0, 1590,    0,    0,    0,    0,
+ 2965,    0, 3225, 3151,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,11156,    0,    0,    0,    0,
+ 1971,    0, 5976,    0, 5976,    0,    0,    0,  173,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  228,   -2,    0,    0,    0,
+24347, 2182, 6007, 6390,    0,    0, 3048,    0,    0,    0,
+    0,    0,15174,17207,18730,    0,    0,    0,    0, 2144,
+    0,25851,    0,    0,    0, 1678,    0,    0,    0,    0,
+    0,    0,    0,    0, 5360, 5708, 6275,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,   74,  125,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2273,    0,
+    0, 2498, 2418,    0,    0,    0,    0, 8255,24217,    0,
+    0,  179,  185,    0,    0,    0, 2184,    0, 1976, 1988,
+    0,    0,    0,    0, 2755,    0,24936, 7137,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 2184,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0, 2658,
+    0, 2186,    0,    0,    0, 2387,    0,    0,    0,    0,
+    0,    0,20599,20781,20882,20976,21077,21226,21327,21421,
+15866,21522,21671,17045,17139,16259,16353,15960,18287,18412,
+    0,    0,    0,16652,    0,16746,15473,15567,14371,14680,
+14774,17847,17438,17722,21772,    0,    0,    0,    0,    0,
+    0,    0,21866,    0,    0,    0,    0,    0,    0,    0,
+    0, 2001,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2108,    0,
+ 3048,    0, 1954, 1954,    0,    0, 2002,    0,    0,    0,
+ 8255,    0,    0,  590,  659,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 1815,    0,    0,
+ 1974,    0, 2718,   40,  195,    0,    0,  200,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,13480,21967,22116,    0,23207, 4602,
+20314,23159,    0,    0,    0,    0,    0,    0,    0, 1971,
+    0,    0,13574,    0,    0,    0,    0,    0,    0,    0,
+    0,  128,    0, 2120, 2120, 2120,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  156,    0,    0,    0,    0,    0,
+    0,    0,    0,25436,    0,    0,    0,  156,    0,    0,
+    0,    0,    0, 2195,    0,    0, 2195,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 1638,11465,    0,    0,
+    0,    0,    0,    0, 2195,    0, 2032,    0,    0,    0,
+    0,    0, 1632,    0,    0,    0,    0,15280,15673,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   85,    0,
+  693, 1046,    0,    0,    0,    0,    0, 1840,  490,    0,
+    0,  206, 1087,  219, 3866,    0,  225,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  432,    0,    0,    0,13883,    0,    0,  645,    0,    0,
+    0,    0,    0,    0,  648,   -2,    0,    0, 1971,    0,
+    0,  156, 2184,10434, 2050,    0,    0,    0,    0, 1971,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  752,    0,22217,    0,    0,
+    0,    0,    0,    0,    0,    0, 1888,    0,    0,15280,
+15673,    0, 2195,    0, 1049, 1049,    0, 1971,    0,    0,
+    0,    0,    0,    0,    0,    0,  819,    0,    0,    0,
+    0,    0,    0,    0,    0, 2200,    0,    0,  233,13977,
+    0,    0,    0,    0,    0,    0,    0, 2210, 2210, 2210,
+    0,  648,    0,    0,    0,    0,    0,    0,    0,    0,
+23347,    0,    0,    0,    0,    0,    0,    0,    0, 2195,
+    0,    0,    0,    0,    0, 2070,    0,    0, 2108, 1936,
+ 2099,    0,    0, 1974,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 1221,  242,  264,  272,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2132,    0,
+    0,    0,  775,    0,    0, 1971,    0,    0,10434,    0,
+    0, 1877,    0,    0, 1971, 1971,    0, 1136,    0,    0,
+ 2112, 2199,    0,    0, 2195,    0, 1157,    0,    0,    0,
+    0,    0,    0,    0,    0, 1438,    0,    0,23578,    0,
+    0, 1395,    0, 1971,    0,    0,    0,    0,    0, 1971,
+    0,    0,    0,    0,    0,    0, 1438, 1702,    0, 1877,
+    0,    0,    0,    0,    0,    0, 1971, 1974,    0,    0,
+ 1873,    0, 1395,    0,    0, 1877,    0,    0, 2242, 1971,
+    0,    0, 1395,    0,    0,    0,    0,    0, 2403,    0,
+};
+static int yycindex[] = {                                  24837,
+    0,    0,    0,    0, 2006,    0, 2227,27850,    0,    0,
+    0,    0,    0, 2019,10075, 2903, 2509, 3246,    0,    0,
+    0,    0,    0,    0,    0, 2855,    0,    0,    0,    0,
+    0,    0,    0, 2011,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+27880,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0, 8564,    0,    0,    0,    0,    0,    0,27971,
+    0, 5163,14178,    0, 2016,    0, 1144,  727,    0, 3193,
+    0, -177, 1959,    0,    0,    0,  748,25018,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,12172,    0,    0,
+    0,    0,    0,    0,    0, 1384,    0,    0,    0, 1940,
+    0,    0,    0,    0,    0,    0, 2239,    0,    0,    0,
+  271,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0, 1103,    0,28001,28095,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  494,    0,    0,    0,
+    0,28125,    0,    0,   64, 1343, 8168,    0, 2259,    0,
+    0,    0,    0,    0,    0, 2255, 2228,    0,    0,28216,
+    0,    0,    0,    0, 2061,    0,    0,    0, 1528,    0,
+    0,    0,    0,    0,    0,    0, 1533,  940,    0,    0,
+    0,    0, 1092,    0, 2096,    0,    0,    0,    0,    0,
+ 1650,    0, 1757,    0,    0, 2026,    0,    0,28246,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0, 8349,
+  428,    0,    0,    0, 2073,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0, 2236, 2246,  496,    0,    0,  322,
+    0,    0,  694,  866,    0,  932, 1128, 2302, 1135, 2303,
+ 1138, 1224,    0,    0,27190, 2314,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 1856, 1294, 2266,
+ 1298,    0,    0,    0,    0,    0,  -28,    0,    0,    0,
+ 2077,    0,    0,    0,    0,    0,    0, 3260,    0, 2136,
+ 2141,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,28340,    0,    0,    0,    0,    0,19672,    0,
+ 2339,   96,    0,    0,    0,    0,   -5,    0,    0,17329,
+   15,  113,  635, 2055,28370,    0,    0,    0, 2368,    0,
+    0,    0,    0,    0,    0, 1119,    0,    0,    0,    0,
+    0,    0,   49,  323,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  461, 2369,    0, 2378,    0,  731,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,28461,    0,
+  822,  301,    0,  721,    0, 6854,   65,  240,    0,    0,
+    0, 2098,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,28491,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  660,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  669,
+    0,    0,    0,    0, 3267,    0,    0,    0,28585,    0,
+ 1416, 3141,    0,    0,    0,    0,    0,   66,  554,    0,
+ 2332,    0, 2100,    0,    0, 2304,    0,    0,    0,    0,
+    0, 2315, 2142,    0,    0, 2526,    0,    0,    0,    0,
+    0,    0,    0,  744,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  178,    0,    0,    0,    0,
+    0,    0, 2532,    0, 2625,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 2409, 2412,    0,    0,    0,
+  559,    0,18537,18662, 8659,    0, 2414,    0,    0,    0,
+    0, 2372,  926, 6540, 9771,    0,    0,    0,    0,    0,
+ 2376,    0,    0,    0,    0,    0, 2445,    0,    0,    0,
+    0,    0,    0,    0, 2211, 2231, 2450,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  122,    0,
+    0,  151,  870,    0,    0,    0,    0, 1957, 2207,    0,
+    0,  613,    0,    0,    0,    0, 2164,    0,    0,    0,
+    0,    0,    0,    0,   21,    0, 2039, 2201,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 2169,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  764,    0,    0,    0,    0,
+    0,    0, 1397, 1435, 1444, 1514, 1562, 1618, 1646, 1666,
+ 1698, 1784, 1863, 1915, 2044, 2046, 2158, 2214, 2335, 2350,
+    0,    0,    0, 2357,    0, 2367, 2389, 2394, 2427, 2444,
+ 2522, 2529, 2540, 2621, 2632,    0,    0,    0,    0,    0,
+    0,    0,27310,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0, 2243,    0,    0,    0,    0,    0,10169,    0,    0,
+ 2461,    0,    0,    0,    0,    0,    0,    0, 2381,    0,
+ 2045,    0, 2466, 2442, 2452,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+28615,    0,  -10,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0, 2646, 2666, 2690,    0,12030,27345,
+27483,27638, 2473, 2422,    0,    0,    0,    0,    0,    0,
+    0,    0, 2735,    0,    0,    0,    0,    0,28706,28736,
+    0, 2475,    0,    0,    0,    0,28830,28860,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  103,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,11680,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 1212,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2456,    0,
+    0,    0,   62,    0,   75,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0, 2751,    0,    0, 1095,    0,    0,
+    0,    0,    0,    0,  978, 2478,    0,    0,    0,    0,
+    0,    0, 2221, 2791,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 2808,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 2467,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0, 2817,
+    0,    0,    0,    0,    0,    0,28951,    0,    0,    0,
+    0, 1222,    0,    0,    0,    0,    0,    0,    0,    0,
+20040,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,28981,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2123,    0,
+    0,    0, 1247,    0,    0,    0,    0,    0, 2848,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,29075,29105,29196,    0,12575,    0,    0,22311,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,12978,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,29226,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 4257,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 5048,    0,
+};
+static int yygindex[] = {                                      0,
+  903,   37, 3041,  936,    1,    0, 2510,  917, -322, -544,
+    0, 2459,   47,   34,   27,    0, 3085,    0,  188,  -70,
+  165,  -86, 1512,    0,    0, 1571, -775,  624, 2060,  134,
+  405,  -65,   38,  341, -663,    0, -243, 1719,    0,   32,
+    0, -576,    0,    0,    0,    0,    0,    0,    0, 2425,
+    0,   46,  551,    0,    0,    0,  326, 1203,    0, 1559,
+ 2702, 3879,  -23,  -14,  939,    0, 1783,    0,    0,    0,
+ 1923,    0,    0,    0,    0,    0,    0,    0,    0, 1442,
+    0, 2334, 1112, 2005,    0,    0, 1335,    0,  -12, 1491,
+    0,    0,   26,    0, -103,  -32,    0, -101,   44,    0,
+  321, 1781,  735, 1735,  399, -136, 2600,    0,    0, 1500,
+ -104,  354,    0,    0, -109, -591, -117, -118, -362,    0,
+    0,    0,    0,    0,    0,    0,    0, -592, -496,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, -606,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0, 1443,    0,    0,    0,    0,
+};
+#define YYTABLESIZE 29573
+static int yytable[] = {                                     355,
+   78,  520,  210,  410,  837,  864,  818,  229,  176,  193,
+  368,  449,  617,  451,  199,  207,  213,  799,  215,  216,
+  220,  223,  510,  437,  527,  226,  493,  915,  521,  366,
+  307,  547, 1455, 2905, 1617,  928,  176,  431,  460,  183,
+  922,  617,  540,  373,  542,  109,  221,  715,  209,  362,
+  197,  176,  212,  214,  986,  937,  988,  357,  363,    2,
+  792, 2301,  137,  176, 2301,  928,  396, 1037,  527,  642,
+   78,  227,  427,   78,  423, 1655,  367,  232,  533,  534,
+  176,  796,  450,  162,  243,    3, 1805,  428,  298,  933,
+ 1802,  802,  728,  410,  416,  793,  518,  437,  831,  674,
+  162,  372,  617, 1065,    7, 3078,  743,  421,   78,  514,
+  512,  792,  511,  541,   85,  441,    1,    2, 3090,  374,
+  795,    6, 2023,  617,  618, 1851, 1973,  209,  176,  794,
+ 1064,  137,   85, 1009,  921, 3086,  192,  920,  724, 1608,
+  448,  182, 3050,  176,  176,  176,  441,  176,  389,  176,
+  746,  419,  388,  389,  796,  391,  617,  388,  452,  255,
+  224,  803,  806,  832,   23,   86,   24,  199,  627,  553,
+  607,  539,  617, 1661,  176,  862,  535,  176,    1,  525,
+  675,  561, 1860,   86,  323,  176,  627,   88,  176,  543,
+  176,  566,  220,  577,   53,  804,  176,   56,    1,  377,
+  806, 1087,  199,  551,  226,  176,  207,  365, 1090,  176,
+    3, 1982,  583,  424,  585,  362,  500,  510,  221, 2036,
+ 1611,  389,  255,  563,  363,  388,  617,  857,  379,   78,
+  518,  569,  176,  176,  176,  176,  520,  728,  511,  209,
+  995,  816,  409,  509,  396,  199,  198,  202,  444,  505,
+  227,  206,  210,  811,  518,  518, 1048,   88,  233,  518,
+   88,  510,  503,  521,  379,  259,  213,  558,  507,  259,
+    1,    2,  818, 1452,  518,    6,  510,  532, 1614,  615,
+  544,  197,  790, 1853, 1036,  506,  493,  176,  616, 1071,
+  192,  176,  176,  234,  579,   88,  558, 1866, 1002, 1004,
+ 1860,  851,  307, 1022,    1,  580,  476,  504,  567,  534,
+  792,  792,  914,  520,  792,  508, 1652, 1165,  444,  712,
+  927,  564,  176,  711,  220,  176,  666,  989,  176,  665,
+  852,  796,  518,  391,  176,  615,  996,  510,  176,  242,
+  521,  617, 1016,  683,  616,    2,    2,    2,   53,  540,
+  929,  542,  230,  506,  298,  800,  803,  558,  236,  437,
+ 1416,  792, 1853,    7, 1413,  176, 1848, 1970,  162,  367,
+ 1799,    3,    3,    3,  643,  176,  367,  584,  558,  586,
+  688,  255, 1170,  176,  663,  707, 1104, 1210,  877, 1054,
+ 3074,  853, 1057,  995,  679,  995,  995, 1071,  145,  513,
+  726,  682,  729, 3082,  520,  733,  527,  373,  990,  547,
+ 1069,  558,  452,  207, 1658,  416,   88,  389, 1008,  543,
+  541,  388,  255, 1857,  784,  558,  690,  558,  510, 1124,
+ 1074,  521,  387,  449,  235,  451,  989,  387,  193,  176,
+  367,  454,  390,  382,  527,  854,  209,  390,  209,    3,
+    3,  255, 1979,  441,  255,  324,  295,  509,  444,  364,
+ 1664, 2030, 1127,  519,  368,  372,  524, 1155,  145, 1863,
+  484,  145, 2033, 1134,  375,  482,  207,  207,  539,  493,
+  483,  558,  638,  374,  377,  323,  661,  323,  959,  996,
+  905,  996,  996,  207,  995,   78,  543,  995, 1985,  389,
+ 1807,  500,  444,  388,  450,  387,  145,  255,  558,  762,
+  763, 1162,  196,  379,  797,  390,  700, 1092, 1158, 1853,
+  436, 1853,  259,  511,  622,  805,  782,  989,  509,  176,
+  176,  561,  790,  557,  505, 1166,  207,  441, 1155,  558,
+    1, 1857,  375,  375,  381,    6,  520,  503,  298,  259,
+  110,  545,    1,  507, 1135,  362,  454,  821,  714,  259,
+  561,  510,  448,   23,  352,   24,  476,  477,  176,  209,
+  506,  960,  995,  521,  176,  649,    1,  382,  688,  176,
+  452,  176,  176,  790,  743,  817,  569, 1863,  842,  176,
+  996,  738,  504,  996,  651, 1197,  558, 1975, 2045,  792,
+  508,  933, 1077,  710, 1080,  800,  803,  650, 1094, 1218,
+  989, 1988,  298,  713, 1982,  873, 1058,  995, 1225, 1226,
+  110,   56,  924,  110,  690,   44,  652,  145,  746,  243,
+   42,  822,   66,  353,   41,   39,  892,   40, 1061,  501,
+  207,  176, 1060,  805, 1410,  989,  978, 1244, 1253,    1,
+  354,  727, 2294, 1249,    6,  504,  800,  803,  110,   23,
+ 1231,   24,  323,    1, 1263,  446,  807,  356,  996,  655,
+ 1257, 1041,   23,  209,   24,  298, 1975,  821,  367,  427,
+  367,  367,   88, 1266, 1041,    1,  336,  176,  622,  522,
+  378, 1161,  176,  989,  810, 1673,  989,  983,  242,  561,
+  617,  387,  233,  372,  176,  682,  679,  384,  364,  176,
+  815,  390,    2,  996,  700,  230,    6,    7,  237,  398,
+ 1872,  374, 1146,  543,  452,  938, 1164,  195,  910, 1887,
+   56,  192,  557, 1182,  143,  446,  166,  437,  443,  427,
+    1,   66,  821,  381, 1807,    6,  401,  839,  230,  840,
+  132, 1149, 1152,  229,  895, 1807,  658,  662,  667,  476,
+  477,  948,  984,   23,  675,   24,  682,  233,  675,  298,
+ 1816,  298,   64,  375, 1211,  519,  382, 1233, 1830,  110,
+  207,  207,  724,  387, 1185,  176,  939,  701,  426,   53,
+  731,  298,  957,  390,  949,  212,  970,  338, 1129,  729,
+  797, 1964,  617, 2318,  143,  999,  963,  143,  920,  617,
+  212, 1827,  207,  953,  954,  298,    1,  166, 1026, 1027,
+ 1083,   56,    7,    1, 2315,  429, 1032, 1033,    6,  176,
+ 1006,  176,   66, 1975, 1958, 1975,  176,  700,  430,  610,
+  801,   78,  143,  213,  223,  209,   23,  973,   24,  143,
+    7,  549,  243, 1940, 2321, 1979,  557,    1,    1,  979,
+  427, 1617, 1097,    6, 1079, 1080,  519,  381,    1,    2,
+  665,  665,  665,    6,  496,  446,   25,  299,    3,  212,
+  176,   23,  558,   24,  243,  229, 1000,    7,  192,   78,
+   78,  579,  412,  145,   34,   35, 1667,   78,   78,   68,
+  382, 1985,  580,  176,   56, 1197,    1,  731,  554,    1,
+   23,    6,   24,  918,    6,   66,   80,    1,  568,  446,
+  176,  242,   48,   49,  177,  554, 1182,  603,  375,   23,
+ 2003,   24,   23,  324,   24,   77, 1670,  557,  141,   56,
+  141,  299,  141,  919, 1073, 1075,   53,  559,  381,  166,
+   66,  573,  287,  242,  166,  558, 1200,  336,   72,  574,
+  443,   80,  523,  143,  318, 2063, 1676,  177,  211, 1679,
+ 1682, 1212,  166, 1084,  166,  588, 1153,  974,  975,  335,
+  581,  382, 1685,  176, 1065,  701,   80,   56, 1173,   80,
+   56, 1875,  177,  582, 1878, 1881,  391,  830,   66, 1071,
+ 1890,   66, 1070, 1893, 1896,   77,  587, 1884,   77,  176,
+  669,   64,   64,  700, 1104,  592, 1899, 1176, 1179,  598,
+  992,  672, 1215,  176,   80, 1071,    1,  752,   88,  755,
+  166,  177,   23,  602,   24,    1,    2,  962,  621,  176,
+    6,  166,   23,   77,   24,  110, 1175,  636,  675,  733,
+  176, 1140,  644,  700,  679,  192,  390,  558,  821,  526,
+  177,  177,  177,  177,  558,  546,  653,  548,  338,  942,
+ 1146,  338,  943,  941, 1205,  997,   88,   88,  176,  176,
+  709,   23, 1221,   24,   88,   88,  657,  446,  176,  170,
+  177,  580,  226,  391,  665,  665,  665,  305,  299,  176,
+  299,  177,  176,  669,  177, 1824,  177,  226,  701,    1,
+    2,  127,  571,   53,    6,    7, 1071,   78,  824,  186,
+  299,  576, 1065, 1065,  115, 1091,  115,  484,  115,  192,
+ 1221, 1991,  482,  480, 2318,  481,  493,  483,   68,   68,
+ 1001, 1234, 1235, 1236,  299,   80, 1221,  558,  177,  177,
+  177,  177,  176,  176,   78, 2315,  821,  579,  579,   80,
+ 1188,  305,  713,  141,   77, 1180, 1181, 1227,  580,  580,
+  170, 2000,  700,  992, 1245,  992,  992, 1263,  382,  213,
+  141,  127,  141,  700,  127, 2321,  176,   53,  559, 1191,
+ 1194,  446,  785,  815,  213,  176,  176,  829,  828, 1203,
+  211, 2006,  115,  391, 2009, 2012, 1024,  177,  177, 2063,
+  185,  739,   78,   78,   78,  211,   78, 2015, 1230,  127,
+ 2063,  700,  141, 1107,  176, 1248, 1203,  740, 1266,  143,
+  176,  446,  141,   80, 1110, 1058,  741,   78,  177,  145,
+  115,  177,  645,  646,  177,  786,  381,  176,   78,  412,
+  335, 1093,  171,  325,  526, 1206, 1209, 3109,  671, 3112,
+  176, 1238,  557, 1278,  167,  337,    1,    2,   80,   80,
+   80,    6,  115,  381,  992,  115,  792,  992,  369,  382,
+  685,  177, 1251,  808,  701,  177,  192,  145,  145,    1,
+    2,  177,  177, 1258,    6,  145,  145,  814,  692,  177,
+  579,  708,  170, 1163,   88,  862,  382,  170,  306,  192,
+  115,  580,  603,  692, 1281,  579,  692,  115,  305,  700,
+  305, 1078,  706, 1081,  701,  170,  580,  170,  700,  700,
+  432,  433,  434, 1428,  131,  115,  732, 1446,  836,  720,
+  127,   88,  131,  115,   53,  167,  185,  185,  537,  185,
+  579,  453,  992,  940,  859,  177,  177,  700,  860,  132,
+  806,  580,  737,  700,  809,  557,  115,   53,  115,  177,
+  115, 1077,  306, 1080,  219, 1113,  381,  800,  875,  812,
+  700,  115,   25,  170, 1431,  131, 1116,  185, 1449, 1115,
+  185,  110,  920,  700,  170,  251,  251,  992,  251,   88,
+   88,   88, 1795,   88,  131,  663,  666,  131,  115,  382,
+  370,   80,  579, 1795,  115,  453,  476,  477,  115,  432,
+  433,  434, 1218,  580,   88, 1159, 1160,  776,  251, 1236,
+   77,  115, 1254, 1152,  887,   88, 2333,  818,  434,  110,
+  110, 1174,  131,  701,  880,  177,  177,  110,  110,  131,
+  889, 1221, 1224,  177,  701, 1943,  229,  894, 1239, 1242,
+  251, 1257, 1260,  620,  579,  115,    1,    2, 3053,  896,
+ 1199,    6,    7, 3056, 2348,  580,  115,  167,  131,  131,
+  466,  131,  167, 2363,  177,  897,  192, 2336, 1156,  899,
+  834, 3059,  701, 3062,  466,  708,  115,  177,  177,  381,
+  167, 3148,  167, 3151,  558,  177,  781,  115,  556,  115,
+ 1187,   90,  902,  920,   80,  145, 1220,  434, 1269,  131,
+  612,  956,  131,  277,  641, 2351, 3301,  325, 3304,  306,
+  641,  306,  382,  904, 2366, 1192,  337,  466,  920,  337,
+  115,  327, 1242,  906,   53,  559,   80, 1272, 1275, 3065,
+  923,  466,  145, 2378,  185,  185,  185,  177,  167,  466,
+ 3068,  930,    2,  131, 1252, 1098,  371, 1254,  776,  167,
+  944,  369,  453, 1261,  453,  143, 1209,  185,  681,  920,
+ 1262,   90,  946, 1268,   90,  185, 1267,  277, 1419,  977,
+  701,  950, 1437, 1270,  177, 1240,  177,  177,  920,  701,
+  701, 2393,  831,  287, 2381,  447,  127,  508,  391,  507,
+  145,  145,  145,   23,  145,   24,  466, 1422, 1425,   90,
+  177, 1440, 1443,  143,  143,  708, 1068,  982,  701, 1018,
+  292,  143,  143,  292,  701,  145,  538, 1071,  229,  255,
+  255,  641,  681,  255, 1010, 1012,  145,  292,  292, 1019,
+ 1245,  701, 2396,  920,  467,  537,  556, 2408,  255,  131,
+  255, 1013, 1014,  775,  701,  778, 1015,  110,  467,  433,
+ 1074,  229, 1925, 1928,  434,  477,  434, 1931, 1934, 1246,
+  292,  226,  920,  433,  433, 2423,  131,  131,  131,  477,
+  255, 2324, 1937,  518,  518,  226,  226,  115,  518, 1256,
+  848,  177,  920,  131,  110, 2438, 1020, 1035, 2411,  131,
+ 1940, 1259,  292,  518,  920,  307,  466,  705,  466, 1039,
+ 2327, 2330,  255,    2,    2,    2,  432,  433,  434, 2339,
+ 1050,  185,  185,  467,  144, 1051, 2426, 2453, 2354,  537,
+   90, 1055,  188, 1056,  277,  985,  277,  987,  433,  967,
+ 1946, 1949,  177,  518,  477,  517, 2441,   80, 2342, 2345,
+ 1088,  406,  110,  110,  110, 1082,  110, 2357, 2360, 1096,
+  455,  518,  484,  466,  556,  466,   77,  482,  480,  307,
+  481,  493,  483,  185,  484,  188, 1099,  110, 2456,  482,
+  480, 1102,  481,  493,  483,   23,  177,   24,  110, 1107,
+  285,    2,    2, 1118,  144,   80,   80,  144, 2369, 1119,
+  144, 1095,  371,   80,   80,  447, 1104,  229,  538,  177,
+  196, 1133, 1098, 2468,   77,   77,   66, 1071,   23,  131,
+   24,  692,   77,   77,  455, 1120,  177, 2372, 2375, 1137,
+ 1138, 1023,  144,  641,  692, 1264, 1139, 1143,  920,  188,
+  506,  143, 1144, 1145,  788, 1101, 2384,  789,  790,  447,
+ 1074, 1147,  255,  131,  370,  557,  538,  467,  467,  292,
+  791,  292,  467,  303, 2471,  303,  381, 1148,  144,  144,
+  681,  188,  681,  681, 1229, 2387, 2390,  467,  143, 1184,
+  467,  292,  467, 1416,  499,  733, 1186, 1413,  304, 1089,
+  304,  255, 2483,  255, 1195,  433,  185,  433, 1191,  382,
+ 1196,  477, 2399,  477, 1217,  705, 1204, 1076,  292,  188,
+  410, 1212,  188,  131,  517,  177, 1213, 1214,  255,  327,
+  371,  479,  255, 1118,  410,  255,  307,  303,  307,  177,
+ 2414, 2402, 2405,  538, 1118,  467,  143,  143,  143, 1216,
+  143, 1224,  127, 2486, 2498,  177,  499,  285,  692,  285,
+ 2429,  389,  304,  144,  501,  388,  177,  502,  503, 2417,
+ 2420,  143, 1269,  455,   23,  920,   24, 1118,  506,  482,
+  504,   66,  143,   66,  250,  250,  229,  250, 1227, 2432,
+ 2435,  455, 2444,  455, 1150, 1151,  506,   65, 1265,  410,
+  127,  127, 1228,  285,  177, 2501,   90, 1230,  127,  127,
+  479,  366,  556,  455,  366,  177,  372,  250,  177,  372,
+    2, 2447, 2450, 1239,    6,    7,  501,  447,  371,  502,
+  503,  371,    1,   80,    3,  550,  684,  514,  705,  192,
+ 1122,  413,  504,  115,  413,  432,  433,  434,  464,  250,
+  335, 1125,   77, 1243,  469,  470,  471, 1247,  482,  188,
+  464,  476,  477,  478,  479,   66,   66,  181, 1201, 1202,
+   80,  484,  414,  476,  477,  414,  482,  480, 2459,  481,
+  493,  483,  185, 2513, 1128, 2528,  188,  188,  188,   77,
+  370,  115,  115,  370,  303,  288,  303,   53,    2,  115,
+  115,  338,  177,  188,  304, 1250, 1255, 2462, 2465,  144,
+  415,  177,  177,  415, 1260,  717,  303,  188,  719,  304,
+  848,  304,  185,  631,  162,  499,  164,    1,   80,   80,
+   80,  447,   80,  353, 2516, 1077, 2531, 1080,  192, 1404,
+  177,  304,  480,   23,  191,   24,  177,   77,   77,   77,
+ 1407,   77,   65,   80,   65,  483,  410, 2474,  410,  432,
+  433,  434,  278,  177,   80,  506,  361,  479,  371,  479,
+  538,  447,   77,  165,  633,  131,  177, 1410,   84,  628,
+    1,    2,  308,   77,  631,    6, 2477, 2480,  628,   10,
+   11,   12,   13,  202,  168,  501,  203, 2543,  502,  503,
+  192,   21,   22,  531,  181,  536,  181,  169,   26, 2489,
+  255,  504,  631,  428,  705,  482,  518,  482,   28,  427,
+  454,  480,  460,  131,  131,  314,  278,  383,  127,  144,
+  462,  131,  131,  555,  483,  162,   65,   65, 2492, 2495,
+ 2283,  185,  481,  512,  181,  387,  308,  531, 2546,  565,
+   84, 2286,  185, 2558,  705,  390,   67,   52,   53,    2,
+    2,    2,  102,  188,  144,  127,  105,  260,  263,  266,
+  269,  272,  275,  275,  660,  132,  278,  281,  284,  287,
+  290,  293,  289,  296, 2289,  289,  749,  299,  302,  305,
+  185,  593,  594,  595,  596,  308,  784,  787, 1083,  289,
+  289, 2872,  599, 2872, 2561,  311,  314,  317,  320,  323,
+  964,  965,  966, 1086,  326,  188,  428,  132,  815,  115,
+ 1131,  481, 2305,  127,  127,  127, 1161,  127, 2894,  132,
+  428,  428,  289, 2308,  329,  332, 1164,  275, 2504, 2286,
+ 2519, 1232, 1251,  131,  341,  344,  347,  464,  127,  350,
+  611,  565,   90,  469,  470,  471,  115, 1401, 1434,  127,
+  476,  477,  478, 1131,  289, 2872, 1074, 2507, 2510, 2522,
+ 2525,  217, 2289,  705, 2573, 1077,  304, 1080,  480, 1113,
+  480,  640, 1386,  278,  705,  278, 1688,  536,  185, 2588,
+ 1116,  483, 2003,  483, 1458,  428, 2603,  185,  185, 1461,
+   90,   90, 3289,  308, 3292,  308, 2618, 1793,   90,   90,
+ 1811,  181,  181,  181,  115,  115,  115, 1813,  115,  608,
+  332,  333,  705,  609,  288, 2576,  185,  233, 2633, 1869,
+  233, 2021,  185, 2648,  181,  536, 1131, 2023,  188,  115,
+ 2591,  693,  699,  287,  233,  233,  287, 2606, 2038,  185,
+  115,  131, 2534, 2042, 2018, 2042,  693, 2621,   82,  693,
+  287,  287,  185,  163, 2061,  484, 2663,  194, 2259, 2265,
+  482,  480,  201,  481,  493,  483,  454,  218,  481, 2636,
+  481, 2537, 2540, 2678, 2651, 2262, 3295, 3298,  131, 2268,
+ 2292,  334, 2299,  287,  275, 2312,  275, 2299,  640,  640,
+ 2900,  300, 2042, 2891, 2872, 2897,    1,    2, 2549,  233,
+ 2903,    6,  536, 3026, 3029,  330, 3071, 2666, 3047, 2042,
+  705,  289, 2872,  289, 2872,  287,  192, 3130,   82,  705,
+  705,   82,  234,  234, 2681,  228,  234, 2552, 2555,  445,
+  454,  427,  474,  289, 2872,  474,  131,  131,  131, 2299,
+  131,  234,  428,  234,  428,  427,  427,  879,  705, 1095,
+  474, 2693,  474, 1179,  705, 1619,   82, 1108, 2708,  597,
+  289,  131,  825,  442, 2872,  144, 1149, 2872, 2872, 2723,
+  961,  705,  131, 1077,   53, 1080, 2027, 1404,  181,  181,
+ 2872, 1200,  474, 1991,  705,    0,  640,    0, 1407,  146,
+  484,    2,    2,    2,  442,  482,  480,  190,  481,  493,
+  483, 1994, 2696, 1997,  188,  234,    1,    2,    0, 2711,
+  427,    6,    0,  144,  144,  552,    0,  823,   90, 2564,
+ 2726,  144,  144, 2000,    0,  191,  192,    0,    0,    0,
+  699,  838,  247,    0, 2579,  247,    0,    0,  845,    0,
+  328, 2594,    0,  570,  188,  572,    0,  855, 2567, 2570,
+ 2738, 2609,  247, 2006,    0,   90, 2009, 2012,    0,  146,
+    0, 2753,  146, 2582, 2585,  376, 1029, 1030, 1031, 2015,
+ 2597, 2600,  287, 2624,  287, 2918,    0,   82, 2639,  304,
+ 2612, 2615,  247,    0,   53,    0,    0,  454,  223,  454,
+  640,  223,  601,  552,  287, 2933, 2271,  146, 2274, 2277,
+ 2280, 2741, 2627, 2630,  453,  223,  223, 2642, 2645,    0,
+    0, 2654, 2756,   90,   90,   90,    0,   90,  231, 2948,
+    0,  287,    0,    0,  231,    0, 2921,  640, 2669,  536,
+  640,  464,    0,    0,  190,  453,  907,    0,   90,  471,
+ 2657, 2660,  484,  486,  476,  477, 2936,  482,  480,   90,
+  481,  493,  483,  699,    0,  223,  223, 2672, 2675,  632,
+  223,  227,    0,  188, 3041,  495,    0,  427,  162,  427,
+ 2951,  394, 1619, 1619,  188,  223,    0, 1623, 1619,    0,
+ 3103, 1619, 1619, 1619, 1619, 1619, 1619,    0, 1619,    0,
+  647,  648, 1619, 1619, 1619,  654,  656,    0,  495, 1619,
+ 1619, 1077,  294, 1080,  420, 1113, 2684,  231,  813,    0,
+ 1619,    0,  188, 2699,  676, 3044, 1116,    0,  146, 1619,
+ 2513,    0,  423,  231, 2714,  419,  686,    0,  689,  231,
+  495, 3106,  231,  223,  955, 2687, 2690, 3124,    0,    0,
+    0,  144, 2702, 2705,  716,    0, 3142, 1638, 1619, 1619,
+ 1641, 1645,    0, 2717, 2720,  421,    0,  247,  247,  247,
+  247,  247,  247, 1649,  247,    0,  464,  294,  394,  247,
+  247, 2516,  469,  470,  471,  247,  247, 2513,  144,  476,
+  477,  478, 1219,    0,    0,  998,  194,  424, 3127,    0,
+ 1176, 1177, 1178,    0, 1077,  247, 1080, 3145, 1113,    0,
+  420,  442,    0,    0,  394, 2729,  394,    0,    0, 1116,
+  188,  328,    0,    0,  328,    0, 2744,  328,  423,  188,
+  188,  419,  231,    0,  247,  247,    0,    0, 2516,  699,
+ 2909,    0,    0,    0, 2732, 2735,  144,  144,  144,    0,
+  144,    0,  190,   82,    0, 2747, 2750,    0,  188,    0,
+ 2924,  421,  907,    0,  188,  420,    0,    0,  680, 2912,
+ 2915,  144,    0,    0,  693,  376,  608,  332,  333,  699,
+  609,  188,  144,  893, 2939,    0,  419,  693,  394, 2927,
+ 2930,    0,    0,  424,  188,  442,    0,  495,    0,  495,
+ 1064,    0,    0,    0,  250,  250,    0,    0,  250,  819,
+    0,  295,  295, 2942, 2945,  395,  421,  295, 1158,  394,
+    0,  419,  250,  250,    0,  250,    0,  827,  464, 3032,
+    0,  295,  467,  468,  469,  470,  471,    0,  328,  376,
+   76,  476,  477,  478,  479, 3094,  162,    0,  424,  295,
+  395, 1157,  453,    0,  198,  250,  198,  198, 3035, 3038,
+    0,  484,  486,    0,    0,    0,  482,  480,  845,  481,
+  493,  483,    1,    2, 3097, 3100,    0,    6,    0,    0,
+  632,    0, 1116,  424,  704, 2504,  230,  250,    0,    0,
+    0,  322,  192,  878,  146,  394,    0,    0,  699,    0,
+    0,  693, 3115,    0,  230,  888,    0,  230,    0,  699,
+   76, 3133,    0,   76, 2507, 2510,   76,    0,  485,  205,
+  245,  248,  251,  254,    0,  420,    0,    0,  394,  303,
+  303, 3118, 3121,    0,  415,    0,  453,  230,    0,  257,
+ 3136, 3139, 2504,  423,  422,  225,  419,  699,   76,    0,
+   53,  231,    0,    0,    0,  440,  303,  359, 1167,  198,
+  202, 1168,    0,    0,  206,  210,    0,    0,    0,  230,
+    0, 2507, 2510,  925,    0,    0,  421,    0,    0,  213,
+ 1955,  935,  936,  198,  530,  530,  440,  395,  395,    0,
+  235,  235,    0,    0,  235,    0,  947,  217, 1964, 1961,
+  689, 1952,    0,    0,    0,    0,    0,  198,  424,  235,
+    0,  235,    0,  395,    0,    0,  231,    0,    0,    1,
+    2,  560,    0,    0,    6,    0,    0,  198,  395,    1,
+    2, 1958,  733,    0,    6,  198,    0,  220,    0,  192,
+  328,    0,  231,    0,    0,  699,    0,  394,    0,  192,
+    0,    0,    0,    0,  699,  699,  395,  395,    0,    0,
+    0,    0,    0, 1967,  395,  395,  395,  395,  395,   76,
+  395,  395,    0,  235,    0,  976,  205,  680,    0,  680,
+  680,    0,  704,  699,  394,  198,  394,    0,    0,  699,
+  219,  991,    0,    1,    2,    0,    0,   53,    6,   82,
+    0, 1003, 1005, 1007,  518,  518,  699,   53,    0,  518,
+    1,    2,    0,  192,    0,    6,    0,    0,    0,  699,
+    0,    0,  303,  303,  518,    0,    0,  163,    0,    0,
+  192,  222,  632,    0,    1,    2,    0,  464,    0,    6,
+    0,  467,  468,  469,  470,  471,    0,   82,   82,    0,
+  476,  477,  478,  479,  192,   82,   82,  687,    0,    0,
+    0,    0,  322,    0,    0,  322,    0, 1038,  322,    0,
+    0,   53,    0,    0,    0,    0,    0,    0,  198,    0,
+    0,  903,  518,    0,    0,    0,    0,  303,   53,    0,
+    0, 1053,  976,  394,  303,  976,    0,  935, 1059, 1062,
+ 1063,  303,    0,    0,  303,  704,    0,    0,    0,  678,
+    0,    0,   53,  976,    0,  530,  440,    0,  484,  486,
+    0,    0,    0,  482,  480,    0,  481,  493,  483,    0,
+    0,    0, 1085, 1086,    0,    0,    0,  660,    0,    0,
+  146,    0,    0,  303,  991,    0,  991,  991,    0,  686,
+  689,    0,  198,    0,  692,    0,    0,    0,  695,  698,
+  701,  704,  707,  710,    0,  713,    0,    0,  303,  716,
+  719,  722,    0,    0,    0,  485,  725,  728,    0,  322,
+  440,  466,  466,    0,    0,  303,  466,  731,  146,  146,
+    0,    0,    0,  440,    0, 1125,  146,  146,    0,    0,
+    0,  466,  230,  233,  303,  487,    0,  236,  303, 1136,
+  971,    0,    0,    0,  394,  394,  132,  806, 1141, 1142,
+    0,  809,  239, 1902, 1905,    0,  737,  740, 1908,    0,
+    0,    0,    0,    0,  994,   76,  812,    0,    0,    0,
+    0,  976,    0, 1911,    0,  991,    7,    0,  991,   10,
+   11,   12,   13,  202,  168,    0,  203,    0,    0,  466,
+    0,   21,   22,    0,    0,    0,    0,  169,   26,    0,
+  530,  560,    0,  303,    0,   82,  812,  440,   28,    0,
+  242,  704,  231,    0,    0,    0,    0,    0,    0,  198,
+  198,    0,    0, 1193,  818,    0,    0,    0,  976,    0,
+    0, 1914,    0,    0,  727,    0,    0,    0,    0,    0,
+    0,    0,   82,    0,    0,    0, 1042,   52,    0, 1208,
+    0,  704,    0,  991,    0,    0,    0,    0,    0, 1042,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  198,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  198,    0,    0,
+    0,    0,    0,  976,    0,    0,    0,    0,  991,    0,
+   82,   82,   82,    0,   82,    0,    0,    0,    0,    0,
+  812,  322,    0,    0,    0,    0,    0,  994,    0,  994,
+  994,    0,    0,    0,  464,   82,    0,    0,  467,  468,
+  469,  470,  471,  472,    0,    0,   82,  476,  477,  478,
+  479,    0,    0,    0,  303,  303,  146,    0,  678,    0,
+  678,  678,    0,    0,    0,    0,    0,    0,   16,    0,
+    0,    0,  198,    0,  339,  340,  341,    0,    0,  560,
+  704,    0,    0,    0,  660,    0,    0,    0,    0,    0,
+    0,  704,    0,  146,    0,    0,    0,    0,    0,    0,
+    0,   16,    0,  934,    0,    0,   16,    0,   16,    0,
+   16,   16,    0,   16,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   16,  994,  704,
+    0,  994,  342,  343,  344,  345,  346,  347,  348,  349,
+  350,  351,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  146,  146,  146,    0,  146,    0,  231,    0,   16,
+    0,    1,    2,    0,    0,    0,    6,    0,    0,    0,
+   10,   11,   12,   13,  202,  168,  146,  203,    0,    0,
+    0,  192,   21,   22,    0,    0,  231,  146,  204,   26,
+  971,  198,    0,   16,   16,    0,    0,    0,    0,   28,
+    0,    0,    0,  198,    0,    0,  994,    0,  205,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   76,    0,  198,    0,    0,    0,  704,    0,    0,
+    0,    0,  231,    0,    0,    0,  704,  704,   52,   53,
+  414,  934,    0,  115,    0,  115,    0,  115,    0,    0,
+    0,  994,  241,    0,    0,  293,  294,    0,  296,  297,
+  299,  301,  302,  305,  311,  704,  319,  321,    0,   76,
+   76,  704,    0,    0,    0,    0,  484,   76,   76,    0,
+  231,  482,  480,  231,  481,  493,  483,    0,  704,    0,
+  305,  361,    0,    0,    0,    0,  231,    0,    0,    0,
+    0,  704,  231,    0,    0,    0,    0,    0,    0,  231,
+    0,    0,    0,    0,    0,    0,    0,    0,  660,  660,
+  660,    0,    0,    0,    0,   16,   16,   16,   16,   16,
+   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+    0,   16,   16,   16,   16,   16,   16,   16,    0,    0,
+    0,    0,   16,   16,   16,   16,   16,   16,    0,    0,
+    0,    0,    0,   16,   16,   16,   16,   16,   16,    0,
+   16,   16,   16,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  303,  303,    0,    0,    0,    0,    0,
+    0,    0,   16,   16,    0,    0,    0,    0,   16,   16,
+   16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+   16,   16,   16,   16,   16,   16,  198,   16,    0,    0,
+    0,    0,   16,    0,    0,   16,    0,    0,   16,   16,
+   16,   16,   16,   16,   16,    0,    0,    0,    0,    0,
+    0,    0,  591,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  301,  311,  305,    0, 1122,
+    0,  600,  115,  115,    0,    0,    0,  115,    0,    0,
+    0,  115,  115,  115,  115,  115,  115,    0,  115,    0,
+    0,    0,  115,  115,  115,  115,    0,  115,  303,  115,
+  115,    0,    0,    0,    0,    0,    0,   76,   44,    0,
+  115,    0,    0,   42,    0,   45,    0,   41,   39,    0,
+   40,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  305,    0,    0,    0,    0,  299,  115,  622,  633,
+    0,    0,    0,  115,   76,  637,    0,  115,  311,  115,
+  115,    0,  660,  660,  660,    0, 1122, 1183,    0,    0,
+    0,    0,  464,    0,    0,    0,  467,  468,  469,  470,
+  471,    0,    0,    0,    0,  476,  477,  478,  479,    0,
+  659,  664,  668,    0,  670,    0,    0,  305,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  239,    0,
+    0,  237,   76,   76,   76,    0,   76,    0,    0,    0,
+  697,    0,  305, 1183,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  718,    0,   76,  718,  305,
+    0,    0,    0,    0,  722,    0,    0,    0,   76,    0,
+    0,    0,    0,    0,    0,    0, 3447,  730,  305,  735,
+    0,  736,  305,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 3447,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  743,  744,  745,  746,  747,  748,
+  749,  750,  751,  752,  753,  754,  755,  756,  757,  758,
+  759,  760,    0,    0,  110,    0,  764,  766,  767,  768,
+  769,  770,  771,  772,  773,  774,  775,  305,  778,    0,
+  779,    0,  783,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    3,    4,    5,  110,    0,    0,
+    0,  110,  110,    0,  110,  110,  110,  110,  110,  110,
+  110,  110,    0,    0,    0,   23,    0,   24,    0,    0,
+    0,    0,  110,  110,    0,  110,    0,  110,    0,    0,
+    0,   29,   30,   31,   32,    0,    0,   34,   35,  205,
+    0,    0,  820,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  110,    0,  110,  110,   37,
+   38,    0,    0,    0,    0,   48,   49,    0,    0,    0,
+    0,   54,    0,    0,   57,    0,    0,    0,    0,    0,
+  850,    0,    0,    0,    0,    0,  856,  110,  110,  110,
+  110,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   72,    0,    0,    0,    0,  865,  866,  867,    0,
+  633,    0,  293,  294,  767,  870,  871,  872,  305,  874,
+    0,    0,    0, 3447, 3447,    0,    0,  883, 3447, 3447,
+    0,    0, 3447, 3447, 3447, 3447, 3447, 3447,    0, 3447,
+    0,    0,    0, 3447, 3447, 3447,    0,    0,  891,    0,
+ 3447, 3447,    0,    0,    0,    0,    0,    0,    0,    0,
+  867, 3447,    0,    0,    0,    0,    0,    0,    1,    2,
+ 3447,    0,    0,    6,    0,    0,    0,   10,   11,   12,
+   13,  202,  168,    0,  331,  332,  333,    0,   20,   21,
+   22,    0,    0,    0,    0,  169,   26,    0, 3447, 3447,
+ 3447, 3447, 3447,    0,    0,    0,   28,    0,    0,    0,
+    0,    0,    0,    0, 3447,    0,    0,    0,    0,    0,
+    0,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+  110,  110,  110,  110,  110,  110,    0,  110,  110,  110,
+  110,  110,  110,  110,  554,   52,   53,    0,  110,  110,
+  110,  110,  110,  110,    0,  554,  334,    0,    0,  110,
+  110,  110,  110,  110,  110,    0,  110,  110,  110,  110,
+  110,  110,  110,  110,  110,  110,  110,  110,    0,  110,
+  110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+  110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+  110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+  110,  110,    0,  110,    0,    0,    0,    0,  110,    0,
+    0,  110,    0,    0,  110,  110,  110,  110,  110,  110,
+  110,    0,    0,    0,  554,    0,    0,  554,  497,    0,
+    0,    0,    0,    0,  248,  248,    0,    0,    0,  248,
+  248,    0,  497,  248,  248,  248,  248,  248,  248,    0,
+  248,    0,  633, 1021,  248,  248,  248,    0,    0,    0,
+ 1025,    0,  248,    0,    0,    0,    0,    0,    0,    0,
+    0, 1028,  664,  664,  664,  497,    0, 1034,    0,    0,
+    0,  248,    0,    0,    0,    0,   36,    0,    0,    0,
+    0,    0,    0, 1043, 1044,    0, 1045, 1047,    0,    0,
+    0,    0,    0,    0,    0,    0,  718,  497,    0,    0,
+  248,  248,  248,  248,    0,    0,    0,    0,    0,   36,
+    0,    0,    0,    0,   36,    0,   36,    0,   36,   36,
+ 1068,   36,    0,    0,    0,    0,    0,  305,  305,    0,
+    0,    0,    0,    0,    0,   36,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  554,  554,
+  554,  554,  554,  554,    0,    0,    0,  554,  554,  554,
+  554,  554,  554,    0,  554,    0,    0,   36,  554,  554,
+  554,    0,    0,    0, 1106,  554,  554,    0, 1109, 1110,
+ 1111, 1112, 1113, 1114,    0,    0,    0,  554,  554,  554,
+  554,  105,    0,  554,  554,  554,    0,    0,    0,   36,
+    0,   36,   36,    0,    0,    0,    0,    0,    0,    0,
+  718,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  554,  554,    0,  105,  554,  554,  554,    0,  105,
+  554,  105,  305,  105,  105,  105,  105,  497,    0,    0,
+  497,  497,  497,  497,  497,  497,    0,  497,    0,    0,
+  105,    0,  497,  497,  497,    0,  497,  554,  497,  497,
+    0,    0,    0,    0, 1166,    0,    0,    0,    0,  497,
+    0,    0,    0,    0,    0, 1169,    0,    0,    0,    0,
+    0,    0,  105,    0,    0,    0,  664,  664,  664,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 1189,  766,
+    0,    0,    0,    0,    0,    0,    0,    0,  497,    0,
+    0, 1198,    0,    0,  105,    0,  105,  105,    0,    0,
+    0,    0,    0,    0,    0, 1206, 1207,    0,    0,    0,
+    0,    0,    0,   36,   36,   36,   36,   36,   36,   36,
+   36,   36,   36,   36,   36,   36,   36,   36, 1215,   36,
+   36,   36,   36,   36,   36,   36,   36,    0,   36,    0,
+   36,   36,   36,   36,   36,   36,    0,    0,    0,    0,
+    0,   36,   36,   36,   36,   36,   36, 3450,   36,   36,
+   36,    0,    0,    0,    0,    0,    0,  766,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 3450,    0,
+   36,   36,    0,    0,    0,    0,   36,   36,   36,   36,
+   36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+   36,   36,   36,   36,    0,   36,    0,    0,    0,    0,
+   36,    0,    0,   36,    0,    0,   36,   36,   36,   36,
+   36,   36,   36,    0,    0,    0,    0,    0,  105,  105,
+    0,  105,  105,  105,  105,  105,  105,  105,  105,  105,
+  105,  105,  105,    0,  105,  105,  105,  105,  105,  105,
+  105,  105,    0,  105,    0,  105,  105,  105,  105,  105,
+  105,    0,    0,    0,    0,    0,  105,  105,  105,  105,
+  105,  105,  636,  105,  105,  105,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  105,  105,    0,    0,    0,
+    0,  105,  105,  105,  105,  105,  105,  105,  105,  105,
+  105,  105,  105,  105,  105,  105,  105,  105,  105,  107,
+  105,    0,    0,  639,    0,  105,    0,    0,  105,    0,
+    0,  105,  105,  105,  105,  105,  105,  105,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  107,    0,    0,  654,    0,  107,    0,  107,
+    0,  107,  107,  107,  107,    0,    0,    0,    0,    0,
+    0,    0,    0,    0, 3450, 3450,    0,    0,  107, 3450,
+ 3450,    0,    0, 3450, 3450, 3450, 3450, 3450, 3450,    0,
+ 3450,    0,    0,    0, 3450, 3450, 3450,    0,    0,    0,
+    0, 3450, 3450,    0,    0,    0,    0,    0,    0,    0,
+  107,    0, 3450,    0,    0,    0,    0,    0,    0,    0,
+    0, 3450,    0,    0,    0,    0,    0,    0,    0,  106,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  107,    0,  107,  107,    0,    0,    0, 3450,
+ 3450, 3450, 3450, 3450,    0,    0,    0,    0,    0,    0,
+    0,    0,  106,    0,    0, 3450,    0,  106,    0,  106,
+    0,  106,  106,  106,  106,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  106,  555,
+  558,  561,  564,  567,  570,    0,    0,    0,  573,  576,
+  579,  582,  585,  588,    0,  591,    0,    0,    0,  594,
+  597,  600,  603,    0,  606,    0,    0,  609,    0,    0,
+  106,    0,    0,    0,    0,    0,    0,  612,  615,  618,
+  621,  624,    0,    0,    0,    0,  627,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  106,    0,  106,  106,  630,  633,    0,    0,
+    0,    0,    0,    0,    0,    0,  642,  645,  648,    0,
+    0,  651,    0,    0,    0,    0,  107,  107,    0,  107,
+  107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
+  107,    0,  107,  107,  107,  107,  107,  107,  107,  107,
+    0,  107,    0,  107,  107,  107,  107,  107,  107,    0,
+    0,    0,    0,    0,  107,  107,  107,  107,  107,  107,
+  389,  107,  107,  107,  388,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  107,  107,    0,    0,    0,    0,  107,
+  107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
+  107,  107,  107,  107,  107,  107,  107,    0,  107,  110,
+    0,    0,    0,  107,    0,    0,  107,    0,    0,  107,
+  107,  107,  107,  107,  107,  107,  106,  106,    0,  106,
+  106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
+  106,    0,  106,  106,  106,  106,  106,  106,  106,  106,
+    0,  106,    0,  106,  106,  106,  106,  106,  106,    0,
+    0,    0,    0,    0,  106,  106,  106,  106,  106,  106,
+    0,  106,  106,  106,    0,  110,    0,    0,    0,  484,
+  486,    0,    0,    0,  482,  480,    0,  481,  493,  483,
+    0,    0,    0,  106,  106,    0,    0,    0,    0,  106,
+  106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
+  106,  106,  106,  106,  106,  106,  106,  108,  106,    0,
+    0,    0,    0,  106,    0,    0,  106,    0,    0,  106,
+  106,  106,  106,  106,  106,  106,  485,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  108,    0,    0,    0,    0,  108,    0,  108,    0,  108,
+  108,  108,  108,    0,    0,    0,  487,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  108,    0,    0,    1,
+    2,    0,    0,    0,    6,    7,    0,    0,   10,   11,
+   12,   13,  202,  168,    0,  203,    0,    0,    0,  192,
+   21,   22,   23,    0,   24,    0,  385,   26,  108,    0,
+    0,    0,    0,  110,  110,  110,    0,    0,    0,    0,
+    0,    0,    0,    0,  110,  110,  110,   18,    0,    0,
+    0,    0,    0,    0,    0,    0,  110,  110,  110,  110,
+  108,    0,  108,  108,  387,    0,    0,    0,    0,    0,
+  110,    0,    0,    0,  390,    0,   52,   53,    0,    0,
+   18,    0,    0,    0,    0,   18,    0,   18,    0,   18,
+   18,    0,   18,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  110,  110,    0,    0,   18,  110,  110,    0,
+  110,  110,  110,  110,  110,  110,  110,  110,    0,  110,
+    0,    0,    0,    0,  110,    0,    0,    0,    0,    0,
+  110,  110,  110,  110,    0,    0,    0,    0,   18,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   18,    0,   18,   18,    0,  464,    0,    0,    0,  467,
+  468,  469,  470,  471,    0,    0,    0,    0,  476,  477,
+  478,  479,    0,    0,  108,  108,    0,  108,  108,  108,
+  108,  108,  108,  108,  108,  108,  108,  108,  108,    0,
+  108,  108,  108,  108,  108,  108,  108,  108,    0,  108,
+    0,  108,  108,  108,  108,  108,  108,    0,    0,    0,
+    0,    0,  108,  108,  108,  108,  108,  108,    0,  108,
+  108,  108,    0,    0,    0,  255,  255,    0,    0,  255,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  108,  108,    0,  255,    0,  255,  108,  108,  108,
+  108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+  108,  108,  108,  108,  108,    0,  108,    0,    0,    0,
+    0,  108,    0,    0,  108,  113,  255,  108,  108,  108,
+  108,  108,  108,  108,   18,   18,   18,   18,   18,   18,
+   18,   18,   18,   18,   18,   18,   18,   18,   18,    0,
+   18,   18,   18,   18,   18,   18,   18,   18,  255,   18,
+    0,   18,   18,   18,   18,   18,   18,    0,    0,    0,
+    0,    0,   18,   18,   18,   18,   18,   18,    0,   18,
+   18,   18,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   18,   18,    0,    0,    0,    0,   18,   18,   18,
+   18,   18,   18,   18,   18,   18,   18,   18,   18,   18,
+   18,   18,   18,   18,   18,   42,   18,    0,    0,    0,
+    0,   18,    0,    0,    0,    0,    0,   18,   18,   18,
+   18,   18,   18,   18,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   42,    0,
+    0,    0,    0,   42,    0,    0,    0,   42,   42,    0,
+   42,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   42,    0,    0,    0,    0,    0,
+    0,    0,  255,  255,    0,    0,    0,  255,  255,    0,
+    0,  255,  255,  255,  255,  255,  255,    0,  255,    0,
+    0,    0,  255,  255,  255,    0,   42,    0,    0,    0,
+  255,    0,    0,    0,    0,    0,    0,    0,    0,  113,
+  113,  113,    0,    0,   88,    0,    0,  255,    0,  255,
+  113,  113,  113,    0,    0,    0,    0,    0,   42,    0,
+   42,   42,  113,  113,  113,  113,    0,    0,    0,    0,
+    0,    0,    0,    0,  255,    0,  113,   88,  255,  255,
+  255,  255,   88,    0,   88,    0,   88,   88,   88,   88,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,   88,    0,    0,    0,    0,  113,  113,
+    0,    0,    0,  113,  113,    0,  113,  113,  113,  113,
+  113,  113,  113,  113,    0,  113,    0,    0,    0,    0,
+  113,    0,    0,    0,    0,   88,  113,  113,  113,  113,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   88,    0,   88,
+   88,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   42,   42,   42,   42,   42,   42,   42,   42,
+   42,   42,   42,   42,   42,   42,   42,    0,   42,   42,
+   42,   42,   42,   42,   42,   42,    0,   42,  114,   42,
+   42,   42,   42,   42,   42,    0,    0,    0,    0,    0,
+   42,   42,   42,   42,   42,   42,    0,   42,   42,   42,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   42,
+   42,    0,    0,    0,    0,   42,   42,   42,   42,   42,
+   42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+   42,   42,   42,    0,   42,  171,    0,    0,    0,   42,
+    0,    0,   42,    0,    0,   42,   42,   42,   42,   42,
+   42,   42,   88,    0,    0,    0,   88,   88,   88,   88,
+   88,   88,   88,   88,   88,   88,    0,   88,   88,   88,
+   88,   88,   88,   88,   88,    0,   88,    0,   88,   88,
+   88,   88,   88,   88,    0,    0,    0,    0,    0,   88,
+   88,   88,   88,   88,   88,    0,   88,   88,   88, 2142,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   88,   88,
+    0,    0,    0,    0,   88,   88,   88,   88,   88,   88,
+   88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+   88,   88,   40,   88,    0,    0,    0,    0,   88,    0,
+ 2145,   88,    0,    0,   88,   88,   88,   88,   88,   88,
+   88,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  114,  114,  114,   40,    0,    0,    0,  127,
+    0,    0, 2160,  114,  114,  114,  127,    0,  127,  127,
+    0,    0,    0,    0,    0,  114,  114,  114,  114,    0,
+    0,    1,    2,  127,    0,  127,    6,    0,    0,  114,
+   10,   11,   12,   13,  202,  168,    0,  203,    0,    0,
+    0,  192,   21,   22,    0,    0,    0,    0,  169,   26,
+    0,    0,    0,    0,    0,    0,  127,    0,    0,   28,
+    0,  114,  114,    0,    0,    0,  114,  114,    0,  114,
+  114,  114,  114,  114,  114,  114,  114,    0,  114,    0,
+    0,    0,    0,  114,    0,    0,  127,    0,   40,  114,
+  114,  114,  114,    0,    0,    0,    0,    0,   52,   53,
+    0,    0,    0,    0,    0,  127,    0,    0,    0,  127,
+  127,    0,    0,  127,  127,  127,  127,  127,  127,  127,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  127,  127,    0,  127,    0,  127, 2067, 2070, 2073, 2076,
+ 2079, 2082,    0,    0,    0, 2085, 2088, 2091, 2094, 2097,
+ 2100,    0, 2103,    0,    0,    0, 2106, 2109, 2112,    0,
+    0,    0,    0,  127, 2115,  127,  127,    0,    0,    0,
+    0,    0,    0,    0, 2118, 2121, 2124, 2127, 2130,    0,
+    0,    0,    0, 2133,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  127,  127,  127,  127,    0,
+    0,    0,    0, 2136, 2139,    0,    0,    0,    0,    0,
+    0,    0,    0, 2148, 2151, 2154,    0,    0, 2157,    0,
+    0,   40,   40,   40,    0,    0,   40,   40,    0,    0,
+    0, 1842,    0, 1832,    0, 1839,   40,   40,   40,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   40,   40,
+   40,   40,    0,    0,    0,    0,    0,    0,   40,   40,
+   40,   40,   40,    0,   40,   40,    0,  127,  127,  127,
+  127,  127,  127,  127,  127,  127,    0,  127,  127,  127,
+  127,  127,  127,  127,  127,  127,    0,    0,  127,  127,
+  127,  127,   40,   40,    0,    0,    0,    0,    0,   40,
+   40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+    0,   40,    0,    0,    0,    0,   40,    0,    0,   40,
+    0,    0,   40,   40,   40,   40,   40,   40,   40,  127,
+  127,  127,  127,  127,  127,  127,    0,    0,  127,  127,
+  127,  127,  127,  127,    0,  127,    0,    0,    0,  127,
+  127,  127,  127,    0,  127,    0,  127,  127,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  127,  127,  127,
+  127,  127,    0,    0,  127,  127,  127,  127,  127,  127,
+  127,  127,  127,  127,  127,  127,    0,  127,  127,  127,
+  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+  127,  127,  127,  127,  127,  127,  127,  127,  127,    0,
+  127,  127,    0,  761,    0,  138,    0,    0,    0,  138,
+  138,  127,  138,  138,  138,  138,  138,  138,  138,  138,
+    0,    0,    0,    0,    0,    0,    0,    0,  127,    0,
+  138,  138,    0,  138,    0,  138,    0,    0,    0,    0,
+ 1832, 1832,    0,    0,    0, 1832, 1832,    0,    0, 1832,
+ 1832, 1832, 1832, 1832, 1832,    0, 1832,    0,    0,    0,
+ 1832, 1832, 1832,  138,    0,  138,  138, 1832, 1832,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 1832,    0,
+    0,    0,    0,    0,    0,    0,    0, 1832,    0,    0,
+    0,    0,    0,    0,    0,  138,  138,  138,  138,  139,
+    0,    0,    0,  139,  139, 1836,  139,  139,  139,  139,
+  139,  139,  139,  139,    0, 1845, 1832, 1832, 1832, 1832,
+    0,    0,    0,    0,  139,  139,    0,  139,    0,  139,
+    0,    0,    0,    0,    1,    2,    0,    0,    0,    6,
+    0,    0,    0,   10,   11,   12,   13,  202,  168,    0,
+  203,    0,    0,    0,  192,   21,   22,  139,    0,  139,
+  139,  204,   26,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   28,    0,    0,    0,    0,    0,    0,    0,
+    0,  205,    0,    0,    0,    0,    0,    0,    0,  139,
+  139,  139,  139,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   52,   53,   54,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  412,    0,  138,
+  138,  138,  138,  138,  138,  138,    0,    0,  138,  138,
+  138,  138,  138,  138,    0,  138,    0,    0,    0,  138,
+  138,  138,  138,    0,  138,    0,  138,  138,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  138,  138,
+  138,  138,    0,    0,  138,  138,  138,  138,  138,  138,
+  138,  138,  138,  138,  138,  138,    0,  138,  138,  138,
+  138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+  138,  138,  138,  138,  138,  138,  138,  138,  138,    0,
+  138,  138,    0,    0,    0,  115,    0,  115,    0,  115,
+    0,  138,    0,  139,  139,  139,  139,  139,  139,  139,
+    0,    0,  139,  139,  139,  139,  139,  139,  138,  139,
+    0,    0,    0,  139,  139,  139,  139,    0,  139,    0,
+  139,  139,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  139,  139,  139,  139,    0,    0,  139,  139,
+  139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+    0,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+  139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+  139,  139,  139,    0,  139,  139,    0,    0,    0,  137,
+    0,    0,    0,  137,  137,  139,  137,  137,  137,  137,
+  137,  137,  137,  137,    0,    0,    0,    0,    0,    0,
+    0,    0,  139,    0,  137,  137,    0,  137,    0,  137,
+    0,    0,    0,    0,    1,    2,    0,    0,    0,    6,
+    7,    0,    0,   10,   11,   12,   13,  202,  168,    0,
+  203,    0,    0,    0,  192,   21,   22,  137,    0,  137,
+  137,  204,   26,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  411,    0,    0,    0,    0,    0,    0,    0,
+    0,  205,    0,    0,    0,    0,    0,    0,    0,  137,
+  137,  137,  137,  143,    0,    0,    0,  143,  143,    0,
+  143,  143,  143,  143,  143,  143,  143,  143,    0,    0,
+  413,   52,   53,  414,    0,    0,    0,    0,  143,  143,
+    0,  143,    0,  143,  115,  115,    0,    0,    0,  115,
+  115,    0,    0,  115,  115,  115,  115,  115,  115,    0,
+  115,    0,    0,    0,  115,  115,  115,  115,    0,  115,
+    0,  143,  115,  143,  143,    0,    0,    0,    0,    0,
+    0,    0,  115,    0,    0,    0,    0,    0,    0,    0,
+    0,  115,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  143,  143,  143,  143,    0,    0,  115,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  115,
+  115,  115,  115,  115,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  811,    0,  137,  137,  137,  137,  137,  137,  137,
+    0,    0,  137,  137,  137,  137,  137,  137,    0,  137,
+    0,    0,    0,  137,  137,  137,  137,    0,  137,    0,
+    0,  137,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  137,  137,  137,  137,    0,    0,  137,  137,
+  137,  137,  137,  137,  137,  137,  137,  137,  137,  137,
+    0,  137,  137,  137,  137,  137,  137,  137,  137,  137,
+  137,  137,  137,  137,    0,  137,  137,  137,  137,  137,
+  137,  137,  137,    0,  137,  137,    0,    0,    0,  137,
+    0,    0,    0,  137,    0,  137,    0,  143,  143,  143,
+  143,  143,  143,  143,    0,    0,  143,  143,  143,  143,
+  143,  143,  137,  143,    0,    0,    0,  143,  143,  143,
+  143,    0,  143,    0,    0,  143,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  143,  143,  143,  143,
+    0,    0,  143,  143,  143,  143,  143,  143,  143,  143,
+  143,  143,  143,  143,    0,  143,  143,  143,  143,  143,
+  143,  143,  143,  143,  143,  143,  143,  143,    0,  143,
+  143,  143,  143,  143,  143,  143,  143,    0,  143,  143,
+    0,    0,    0,  156,    0,    0,    0,  156,  156,  143,
+  156,  156,  156,  156,  156,  156,  156,  156,    0,    0,
+    0,    0,    0,    0,    0,    0,  143,    0,  156,  156,
+    0,  156,    0,  156,    0,    0,    0,    0,    1,    2,
+    0,    0,    0,    6,    7,    0,    0,   10,   11,   12,
+   13,  202,  168,    0,  203,    0,    0,    0,  192,   21,
+   22,  156,    0,  156,  156,  204,   26,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  411,    0,    0,    0,
+    0,    0,    0,    0,    0,  205,    0,    0,    0,    0,
+    0,    0,    0,  156,  156,  156,  156,  144,    0,    0,
+    0,  144,  144,    0,  144,  144,  144,  144,  144,  144,
+  144,  144,    0,    0,  413,   52,   53,   54,    0,    0,
+    0,    0,  144,  144,    0,  144,    0,  144,  137,  137,
+    0,    0,    0,  137,  137,    0,    0,  137,  137,  137,
+  137,  137,  137,    0,  137,    0,    0,    0,  137,  137,
+  137,  137,    0,  137,    0,  144,  137,  144,  144,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  137,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  144,  144,  144,
+  144,    0,    0,  137,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  137,  137,  137,  137,  137,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  617,    0,  156,  156,  156,
+  156,  156,  156,  156,    0,    0,  156,  156,  156,  156,
+  156,  156,    0,  156,    0,    0,    0,  156,  156,  156,
+  156,    0,  156,    0,    0,  156,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  156,  156,  156,  156,
+    0,    0,  156,  156,  156,  156,  156,  156,  156,  156,
+  156,  156,  156,  156,    0,  156,  156,  156,  156,  156,
+  156,  156,  156,  156,  156,  156,  156,  156,    0,  156,
+  156,  156,  156,  156,  156,  156,  156,    0,  156,  156,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  156,
+    0,  144,  144,  144,  144,  144,  144,  144,    0,    0,
+  144,  144,  144,  144,  144,  144,  156,  144,    0,    0,
+    0,  144,  144,  144,  144,    0,  144,    0,    0,  144,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  144,  144,  144,  144,    0,    0,  144,  144,  144,  144,
+  144,  144,  144,  144,  144,  144,  144,  144,  495,  144,
+  144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+  144,  144,  495,  144,  144,  144,  144,  144,  144,  144,
+  144,    0,  144,  144,    0,    0,    0,  117,    0,    0,
+    0,  117,  117,  144,  117,  117,  117,  117,  117,  117,
+  117,  117,    0,    0,    0,  495,    0,    0,    0,    0,
+  144,    0,  117,  117,    0,  117,    0,  117,    0,    0,
+    0,    0,    1,    2,    0,    0,    0,    6,    7,    0,
+    0,   10,   11,   12,   13,  202,  168,  495,  203,    0,
+    0,    0,  192,   21,   22,  117,    0,  117,  117,  204,
+   26,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  411,    0,    0,    0,    0,    0,    0,    0,    0,  205,
+    0,    0,    0,    0,    0,    0,    0,  117,  117,  117,
+  117,  675,    0,    0,    0,  675,  675,    0,  675,  675,
+  675,  675,  675,  675,  675,  675,    0,    0,  413,   52,
+   53,   54,    0,    0,    0,    0,  675,  675,    0,  675,
+    0,  675,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  686,  689,    0,    0,    0,  692,
+    0,    0,    0,  695,  698,  701,  704,  707,  710,  675,
+  713,  675,  675,    0,  716,  719,  722, 1077,    0, 1080,
+    0,  725,  728,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  731,    0,    0,    0,    0,    0,    0,    0,
+    0, 1142,  675,  675,  675,    0,    0,    0,    0,    0,
+  495,  495,  495,  495,  495,  495,    0,  495,    0,    0,
+    0,    0,  495,  495,  495,    0,  495,    0,  495,  495,
+    0,  737,  740,    0,    0,    0,    0,    0,    0,  245,
+    0,  117,  117,  117,  117,  117,  117,  117,    0,    0,
+  117,  117,  117,  117,  117,  117,    0,  117,    0,    0,
+    0,  117,  117,  117,  117,    0,  117,    0,    0,  117,
+    0,    0,    0,    0,    0,    0,    0,    0,  495,    0,
+  117,  117,  117,  117,    0,    0,  117,  117,  117,  117,
+  117,  117,  117,  117,  117,  117,  117,  117,    0,  117,
+  117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+  117,  117,    0,  117,  117,  117,  117,  117,  117,  117,
+  117,    0,  117,  117,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  117,    0,  675,  675,  675,  675,  675,
+  675,    0,    0,    0,  675,  675,  675,  675,  675,  675,
+  117,  675,    0,    0,    0,  675,  675,  675,  675,    0,
+  675,    0, 1134,  675,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  672,  675,  675,  675,  675,    0,    0,
+  675,  675,  675,  675,  675,  675,  675,  675,  675,  675,
+  675,  675,    0,  675,  675,  675,  675,  675,  675,  675,
+  675,  675,  675,  675,  675,  675, 1138,  675,  675,  675,
+    0,    0,  675,  675,  675,    0,  675,  675,    0,    0,
+    0, 2053,    0,    0,    0, 2053, 2053,  675, 2053, 2053,
+ 2053, 2053, 2057, 2053, 2053, 2053,    0,    0,    0,    0,
+    0,    0,    0,    0,  675,    0, 2053, 2053,    0, 2053,
+    0, 2053,    0,    0,    0,    0,  245,  245,    0,    0,
+    0,  245,  245,    0,    0,  245,  245,  245,  245,  245,
+  245,    0,  245,    0,    0,    0,  245,  245,  245, 2053,
+    0, 2053, 2053,  245,  245,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  245,    0,    0,    0,    0,    0,
+    0,    0,    0,  245,    0,    0,    0,    0,    0,    0,
+    0, 2053, 2053, 2053, 2053,  535,    0,    0,    0,  535,
+  535,    0,  535,  535,  535,  535,  535,  535,  535,  535,
+    0,    0,  245,  245,  245,  245,    0,    0,    0,    0,
+  535,  535,    0,  535,    0,  535,    0,    0,    0,    0,
+  492,  495,    0,    0,    0,  498,    0,    0,    0,  501,
+  504,  507,  510,  513,  516,    0,  519,  522,  525,    0,
+  528,  531,  534,  535,    0,  535,  535,  537,  540,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  543,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  535,  535,  535,  535,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  546,  549,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  552,    0,
+    0,    0,    0,  243,    0, 2053, 2053, 2053, 2053, 2053,
+ 2053,    0,    0,    0, 2053, 2053, 2053, 2053, 2053, 2053,
+    0, 2053,    0,    0,    0, 2053, 2053, 2053, 2053,    0,
+ 2053,    0, 2053, 2053,    0,    0,    0,    0,    0,    0,
+    0,    0,    0, 2053, 2053, 2053, 2053, 2053,    0,    0,
+ 2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
+ 2053, 2053,    0, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
+ 2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
+    0,    0, 2053, 2053, 2053,    0, 2053, 2053,    0,    0,
+    0,    0,    0,    0,    0,    0,    0, 2053,    0,  780,
+  535,  535,  535,  535,  535,    0,    0,    0,  535,  535,
+  535,  535,  535,  535, 2053,  535,    0,    0,    0,  535,
+  535,  535,  535,    0,  535,    0,  535,  535,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  535,  535,  535,
+  535,  535,    0,    0,  535,  535,  535,  535,  535,  535,
+  535,  535,  535,  535,  535,  535,    0,  535,  535,  535,
+  535,  535,  535,  535,  535,  535,  535,  535,  535,  535,
+  535,  535,  535,  535,    0,    0,  535,  535,  535,    0,
+  535,  535,    0,  781,    0,  533,    0,    0,    0,  533,
+  533,  535,  533,  533,  533,  533,  533,  533,  533,  533,
+    0,    0,    0,    0,    0,    0,    0,    0,  535,    0,
+  533,  533,    0,  533,    0,  533,    0,    0,    0,    0,
+  243,  243,    0,    0,    0,  243,  243,    0,    0,  243,
+  243,  243,  243,  243,  243,    0,  243,    0,    0,    0,
+  243,  243,  243,  533,    0,  533,  533,  243,  243,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  243,    0,
+    0,    0,    0,    0,    0,    0,    0,  243,    0,    0,
+    0,    0,    0,    0,    0,  533,  533,  533,  533,  313,
+    0,    0,    0,  313,  313,    0,  313,  313,  313,  313,
+  313,  313,  313,  313,    0,    0,  243,  243,  243,  243,
+    0,    0,    0,    0,  313,  313,    0,  313,    0,  313,
+    0,    0,    0,    0,    1,    2,    0,    0,    0,    6,
+    0,    0,    0,   10,   11,   12,   13,  202,  168,    0,
+  203,    0,    0,    0,  192,   21,   22,  313,    0,  313,
+  313,  204,   26,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   28,    0,  484,  486,    0,    0,    0,  482,
+  480,  205,  481,  493,  483,    0,    0,    0,    0,  313,
+  313,  313,  313,    0,    0,    0,    0,    0,  488,    0,
+  492,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   52,   53,   54,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  533,
+  533,  485,  533,  533,  533,    0,    0,    0,  533,  533,
+  533,  533,  533,  533,    0,  533,    0,    0,    0,  533,
+  533,  533,  533,    0,  533,    0,  533,  533,    0,    0,
+    0,  487,    0,    0,    0,    0,    0,  533,  533,  533,
+  533,  533,    0,    0,  533,  533,  533,  533,  533,  533,
+  533,  533,  533,  533,  533,  533,    0,  533,  533,  533,
+  533,  533,  533,  533,  533,  533,  533,  533,  533,  533,
+  533,  533,  533,  533,    0,    0,  533,  533,  533,    0,
+  533,  533,    0,    0,    0,  389,    0,    0,    0,  606,
+    0,  533,    0,  313,  313,  313,  313,  313,  313,    0,
+    0,    0,  313,  313,  313,  313,  313,  313,  533,  313,
+    0,    0,    0,  313,  313,  313,  313,    0,  313,    0,
+  313,  313,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  313,  313,  313,  313,  313,    0,    0,  313,  313,
+  313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+    0,  313,  313,  313,  313,  313,  313,  313,  313,  313,
+  313,  313,  313,  313,    0,  313,  313,  313,    0,    0,
+  313,  313,  313,    0,  313,  313,    0,    0,    0,  357,
+    0,    0,    0,  357,  357,  313,  357,  357,  357,  357,
+  357,  357,  357,  357,    0,    0,    0,    0,    0,    0,
+    0,    0,  313,    0,  357,  357,    0,  357,    0,  357,
+    0,    0,  456,  457,  458,  459,  460,  461,  462,  463,
+  464,    0,  465,  466,  467,  468,  469,  470,  471,  472,
+  473,    0,    0,  476,  477,  478,  479,    0,    0,  357,
+  357,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  357,
+  357,  357,  357,  359,    0,    0,    0,  359,  359,    0,
+  359,  359,  359,  359,  359,  359,  359,  359,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  359,  359,
+    0,  359,    0,  359,    1,    2,    0,    0,    0,    6,
+    0,    0,    0,   10,   11,   12,   13,  202,  168,    0,
+  203,    0,    0,    0,  192,   21,   22,   23,    0,   24,
+    0,  385,   26,  359,  359,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  484,  486,    0,    0, 1117,
+  482,  480,    0,  481,  493,  483,    0,    0,    0,    0,
+    0,    0,    0,  359,  359,  359,  359,    0,    0,  387,
+    0,  492,    0,    0,    0,    0,    0,    0,    0,  390,
+    0,   52,   53,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  485,  357,  357,  357,  357,  357,  357,    0,
+    0,    0,  357,  357,  357,  357,  357,  357,    0,  357,
+    0,    0,    0,  357,  357,  357,  357,    0,  357,    0,
+  357,  357,  487,    0,    0,    0,    0,    0,    0,    0,
+    0,  357,  357,  357,  357,  357,    0,    0,  357,  357,
+  357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+    0,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+  357,  357,  357,  357,  357,  357,  357,  357,    0,    0,
+  357,  357,  357,    0,  357,  357,    0,    0,    0,    0,
+ 2238,    0,    0,    0,    0,  357,    0,  359,  359,  359,
+  359,  359,  359,    0,    0,    0,  359,  359,  359,  359,
+  359,  359,  357,  359,    0,    0,    0,  359,  359,  359,
+  359,    0,  359,    0,  359,  359,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  359,  359,  359,  359,  359,
+    0, 2241,  359,  359,  359,  359,  359,  359,  359,  359,
+  359,  359,  359,  359,    0,  359,  359,  359,  359,  359,
+  359,  359,  359,  359,  359,  359,  359,  359,  359,  359,
+  359,  359,    0, 2256,  359,  359,  359,    0,  359,  359,
+    0,    0,  548,    0,    0,    0,  548,  548,    0,  359,
+  548,  548,  548,  548,  548,  548,  548,    0,    0,    0,
+    0,    0,    0,  455,    0,    0,  359,  548,  548,    0,
+  548,    0,  548,  456,  457,  458,  459,  460,  461,  462,
+  463,  464,    0,  465,  466,  467,  468,  469,  470,  471,
+  472,  473,  474,  475,  476,  477,  478,  479,    0,    0,
+  548,    0,  548,  548,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  548,  548,  548,  548,  629,    0,    0,    0,
+  629,  629,    0,  629,  629,  629,  629,    0,  629,  629,
+  629,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  629,  629,    0,  629,    0,  629, 2163, 2166, 2169,
+ 2172, 2175, 2178,    0,    0,    0, 2181, 2184, 2187, 2190,
+ 2193, 2196,    0, 2199,    0,    0,    0, 2202, 2205, 2208,
+    0,    0,    0,    0,  629, 2211,  629,  629,    0,    0,
+    0,    0,    0,    0,    0, 2214, 2217, 2220, 2223, 2226,
+    0,    0,    0,    0, 2229,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  629,  629,  629,  629,
+    0,    0,    0,    0, 2232, 2235,    0,    0,    0,    0,
+    0,    0,    0,    0, 2244, 2247, 2250,    0,    0, 2253,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  548,  548,  548,  548,
+  548,  548,    0,    0,    0,  548,  548,  548,  548,  548,
+  548,    0,  548,    0,    0,    0,  548,  548,  548,  548,
+    0,  548,    0,  548,  548,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  548,  548,  548,  548,  548,    0,
+    0,  548,  548,  548,  548,  548,  548,  548,  548,  548,
+  548,  548,  548,    0,  548,  548,  548,  548,  548,  548,
+  548,  548,  548,  548,  548,  548,  548,  548,  548,  548,
+  548,    0,    0,  548,  548,  548,    0,  548,  548,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  548,    0,
+  629,  629,  629,  629,  629,  629,    0,    0,    0,  629,
+  629,  629,  629,  629,  629,  548,  629,    0,    0,    0,
+  629,  629,  629,  629,    0,  629,    0,  629,  629,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  629,  629,
+  629,  629,  629,    0,    0,  629,  629,  629,  629,  629,
+  629,  629,  629,  629,  629,  629,  629,    0,  629,  629,
+  629,  629,  629,  629,  629,  629,  629,  629,  629,  629,
+  629,  629,  629,  629,  629,    0,  256,  629,  629,  629,
+  256,  629,  629,  256,  256,    0,  256,  256,  256,  256,
+  256,    0,  629,    0,    0,    0,    0,    0,    0,    0,
+    0,  256,  256,    0,  256,    0,  256,    0,    0,  629,
+    0,  135,  138,    0,    0,    0,  141,    0,    0,    0,
+  144,  147,  150,  153,  156,  159,    0,  162,    0,    0,
+    0,  165,  168,  171,  256,    0,  256,  256,  174,  177,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  180,
+    0,    0,    0,    0,    0,    0,    0,    0,  183,    0,
+    0,    0,    0,    0,    0,    0,  256,  256,  256,  256,
+  135,    0,    0,    0,  135,  135,    0,  135,  135,  135,
+  135,  135,  135,  135,  135,    0,    0,  186,  189,  192,
+  195,    0,    0,    0,    0,  135,  135,    0,  135,    0,
+  135,    0,    0,    0,    0, 2875, 2875,    0,    0,    0,
+ 2875,    0,    0,    0, 2875, 2875, 2875, 2875, 2875, 2875,
+    0, 2875,    0,    0,    0, 2875, 2875, 2875,  135,    0,
+  135,  135, 2875, 2875, 2879, 2882, 2885,    0,    0,    0,
+    0,    0,    0, 2875,    0,    0,    0,    0,    0,    0,
+    0,  578,    0,    0,    0,    0,    0,  578,    0,    0,
+  135,  135,  135,  135,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  578,    0,  578,    0,    0,    0,
+    0,    0, 2875, 2875,    0,    0,    0,    0,    0,    0,
+ 2888,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  256,  256,  256,  256,  256,  256,  256,  578,    0,  256,
+  256,  256,  256,  256,  256,    0,  256,    0,    0,    0,
+  256,  256,  256,  256,    0,  256,    0,  256,  256,    0,
+    0,    0,    0,    0,    0,    0,    0,  578,  256,  256,
+  256,  256,  256,    0,    0,  256,  256,  256,  256,  256,
+  256,  256,  256,  256,  256,  256,  256,    0,  256,  256,
+  256,  256,  256,  256,  256,    0,  256,  256,  256,  256,
+  256,  256,  256,  256,  256,    0,  256,  256,  256,  256,
+    0,  256,  256,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  256,    0,  135,  135,  135,  135,  135,  135,
+  135,    0,    0,    0,  496,    0,    0,  135,  135,  256,
+  135,    0,    0,    0,  135,  135,  135,  135,  496,  135,
+    0,  135,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  135,  135,  135,  135,  135,    0,    0,  135,
+  135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+  135,  496,  135,  135,  135,  135,  135,  135,  135,  135,
+  135,  135,  135,  135,  135,  135,  135,  135,  135,  135,
+  135,  135,  135,  135,    0,  135,  135,    0,    0,    0,
+  314,    0,    0,  496,  314,  314,  135,  314,  314,  314,
+  314,  314,  314,  314,  314,    0,    0,    0,    0,    0,
+    0,    0,    0,  135,    0,  314,  314,    0,  314,    0,
+  314,    0,    0,    0,    0,    0,    0,    0,  578,  578,
+  578,  578,  578,  578,  578,  578,    0,    0,  578,  578,
+  578,  578,    0,    0,    0,  578,  578,    0,  314,    0,
+  314,  314,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  314,  314,  314,  314,  137,    0,    0,    0,  137,  137,
+    0,  137,  137,  137,  137,  137,  137,  137,  137,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  137,
+  137,    0,  137,    0,  137,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  496,  496,  496,  496,
+  496,  496,  137,  496,  137,  137,    0,    0,  496,  496,
+  496,    0,  496,    0,  496,  496,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  496,    0,    0,    0,    0,
+    0,    0,    0,    0,  137,  137,  137,  137,    0,    0,
+  495,  495,    0,    0,    0,  495,  495,    0,    0,  495,
+  495,  495,  495,  495,  495,    0,  495,    0,    0,    0,
+  495,  495,  495,    0,  496,    0,    0,  495,  495,    0,
+    0,    0,    0,    0,  314,  314,  314,  314,  314,  314,
+    0,    0,    0,  314,  314,  314,  314,  314,  314,    0,
+  314,    0,    0,    0,  314,  314,  314,  314,    0,  314,
+    0,    0,  314,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  314,  314,  314,  314,  495,  495,  314,
+  314,  314,  314,  314,  314,  314,  314,  314,  314,  314,
+  314,    0,  314,  314,  314,  314,  314,  314,  314,  314,
+  314,  314,  314,  314,  314,  314,  314,  314,  314,    0,
+    0,  314,  314,  314,    0,  314,  314,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  314,    0,  137,  137,
+  137,  137,  137,  137,    0,    0,    0,  137,  137,  137,
+  137,  137,  137,  314,  137,    0,    0,    0,  137,  137,
+  137,  137,    0,  137,    0,    0,  137,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  137,  137,  137,
+  137,    0,    0,  137,  137,  137,  137,  137,  137,  137,
+  137,  137,  137,  137,  137,    0,  137,  137,  137,  137,
+  137,  137,  137,  137,  137,  137,  137,  137,  137,    0,
+  137,  137,  137,    0,  255,  137,  137,  137,  255,  137,
+  137,  255,  255,    0,  255,  255,  255,  255,  255,    0,
+  137,    0,    0,    0,    0,    0,    0,    0,    0,  255,
+  255,    0,  255,    0,  255,    0,    0,  137,    0,    1,
+    2,    0,    0,    0,    6,    0,    0,    0,   10,   11,
+   12,   13,  202,  168,    0,  203,    0,    0,    0,  192,
+   21,   22,  255,    0,  255,  255,  204,   26,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   28,    0,    0,
+    0,    0,    0,    0,    0,    0,  205,    0,    0,    0,
+    0,    0,    0,    0,  255,  255,  255,  255,  361,    0,
+    0,    0,  361,  361,    0,  361,  361,    0,  361,  361,
+  361,  361,  361,    0,    0,    0,   52,   53,   54,    0,
+    0,    0,    0,  361,  361,    0,  361,    0,  361,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  361,    0,  361,  361,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  484,  486,    0,  489,    0,  482,  480,    0,  481,  493,
+  483,    0,    0,    0,    0,    0,    0,    0,  361,  361,
+  361,  361,  491,    0,  488,    0,  492,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  490,    0,    0,  485,  255,  255,
+  255,  255,  255,  255,  255,    0,    0,  255,  255,  255,
+  255,  255,  255,    0,  255,    0,    0,    0,  255,  255,
+  255,    0,    0,    0,    0,  255,  255,  487,    0,    0,
+    0,    0,    0,    0,    0,    0,  255,  255,  255,  255,
+  255,    0,    0,  255,  255,  255,  255,  255,  255,  255,
+  255,  255,  255,  255,  255,    0,  255,  255,  255,  255,
+  255,  255,  255,    0,  255,  255,  255,  255,  255,  255,
+  255,  255,  255,    0,  255,  255,  255,  255,    0,  255,
+  255,    0,    0,  115,    0,  115,    0,  115,    0,    0,
+  255,    0,  361,  361,  361,  361,  361,  361,    0,    0,
+    0,  361,  361,  361,  361,  361,  361,  255,  361,    0,
+    0,    0,  361,  361,  361,  361,    0,  361,    0,    0,
+  361,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  361,  361,  361,  361,    0,    0,  361,  361,  361,
+  361,  361,  361,  361,  361,  361,  361,  361,  361,    0,
+  361,  361,  361,  361,  361,  361,  361,  361,  361,  361,
+  361,  361,  361,  361,  361,  361,  361,    0,  163,  361,
+  361,  361,    0,  361,  361,    0,    0,  137,    0,    0,
+    0,  137,  137,    0,  361,  137,  137,  137,  137,  137,
+  137,  137,    0,    0,    0,    0,    0,    0,  455,    0,
+    0,  361,  137,  137,    0,  137,    0,  137,  456,  457,
+  458,  459,  460,  461,  462,  463,  464,    0,  465,  466,
+  467,  468,  469,  470,  471,  472,  473,  474,  475,  476,
+  477,  478,  479,    0,    0,  137,    0,  137,  137,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  137,  137,  137,
+  137,  549,    0,    0,    0,  549,  549,    0,    0,  549,
+  549,  549,  549,  549,    0,  549,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  549,  549,    0,  549,
+    0,  549,  115,  115,    0,    0,    0,  115,  115,    0,
+    0,  115,  115,  115,  115,  115,  115,    0,  115,    0,
+    0,    0,  115,  115,  115,  115,    0,  115,    0,  115,
+  115,  549,  549,    0,    0,    0,    0,    0,    0,    0,
+  115,    0,    0,    0,    0,    0,    0,    0,    0,  115,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  549,  549,  549,  549,    0,    0,  115,    0,    0,
+    0,    0,    0,  115,    0,    0,    0,  115,  115,  115,
+  115,  115,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  137,  137,  137,  137,  137,  137,    0,    0,    0,
+  137,  137,  137,  137,  137,  137,    0,  137,    0,    0,
+    0,  137,  137,  137,  137,    0,  137,    0,    0,  137,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  137,  137,  137,  137,    0,    0,  137,  137,  137,  137,
+  137,  137,  137,  137,  137,  137,  137,  137,    0,  137,
+  137,  137,  137,  137,  137,  137,  137,  137,  137,  137,
+  137,  137,    0,  137,  137,  137,    0,    0,  137,  137,
+  137,    0,  137,  137,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  137,    0,  549,  549,  549,  549,  549,
+  549,    0,    0,    0,  549,  549,  549,  549,  549,  549,
+  137,  549,    0,    0,    0,  549,  549,  549,  549,    0,
+  549,    0,  549,  549,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  549,  549,  549,  549,    0,  171,
+  549,  549,  549,  549,  549,  549,  549,  549,  549,  549,
+  549,  549,    0,  549,  549,  549,  549,  549,  549,  549,
+  549,  549,    0,    0,    0,  549,  549,  549,  549,  549,
+    0,    0,  549,  549,  549,    0,  549,  549,    0,    0,
+  551,    0,    0,    0,  551,  551,    0,  549,  551,  551,
+  551,  551,  551,    0,  551,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  549,  551,  551,    0,  551,    0,
+  551,    0,    0,    0,    0,    0, 2875, 2875,    0,    0,
+    0, 2875,    0,    0,    0, 2875, 2875, 2875, 2875, 2875,
+ 2875,    0, 2875,    0,    0,    0, 2875, 2875, 2875,    0,
+  551,  551,    0, 2875, 2875, 2879, 2882, 2885,    0,    0,
+    0,    0,    0,    0, 2875,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  551,  551,  551,  551,  543,    0,    0,    0,  543,  543,
+    0,    0,  543,  543,  543,  543,  543,    0,  543,    0,
+    0,    0,    0, 2875, 2875,    0,    0,    0,    0,  543,
+  543, 2888,  543,    0,  543,    1,    2,    0,    0,    0,
+    6,    7,  166,    0,   10,   11,   12,   13,  245,  168,
+    0,   16,   17,   18,    0,   20,   21,   22,   23,    0,
+   24,    0,  169,   26,  543,  543,    0,  170,    0,    0,
+    0,    0,    0,   28,    0,    0, 2953, 2953,    0, 2953,
+    0, 2953, 2953,    0, 2953, 2953, 2953,    0,    0,    0,
+    0,    0,    0,    0,  543,  543,  543,  543,    0,    0,
+ 2953,    0, 2953,    0,    0,    0,    0,    0,    0,    0,
+   50,  529,   52,   53,    0,    0,    0,    0,   58,   59,
+   60,   61,   62,  173,   64,   65,    0,    0,    0,    0,
+ 2953,    0, 2953, 2953,  551,  551,  551,  551,  551,  551,
+    0,    0,    0,  551,  551,  551,  551,  551,  551,    0,
+  551,    0,    0,    0,  551,  551,  551,  551,    0,  551,
+    0,  551,  551, 2953,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  551,  551,  551,  551,    0,    0,  551,
+  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+  551,    0,  551,  551,  551,  551,  551,  551,  551,  551,
+  551,    0,    0,    0,  551,  551,  551,  551,  551,    0,
+    0,  551,  551,  551,    0,  551,  551,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  551,    0,  543,  543,
+  543,  543,  543,  543,    0,    0,    0,  543,  543,  543,
+  543,  543,  543,  551,  543,    0,    0,    0,  543,  543,
+  543,  543,    0,  543,    0,  543,  543,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  543,  543,  543,
+  543,    0,   63,  543,  543,  543,  543,  543,  543,  543,
+  543,  543,  543,  543,  543,    0,  543,  543,  543,  543,
+  543,  543,  543,  543,  543,    0,  102,    0,  543,  543,
+  543,  543,  543,    0,    0,  543,  543,  543,    0,  543,
+  543,    0,    0,  546,    0,    0,    0,  546,  546,    0,
+  543,  546,  546,  546,  546,  546,    0,  546,    0,    0,
+    0,    0,    0,    0, 2953,    0,    0,  543,  546,  546,
+    0,  546,    0,  546, 2953, 2953, 2953, 2953, 2953, 2953,
+ 2953, 2953, 2953,    0, 2953, 2953, 2953, 2953, 2953, 2953,
+ 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953, 2953,    0,
+    0,    0,    0,  546,  546,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  546,  546,  546,  546,  547,    0,    0,
+    0,  547,  547,    0,    0,  547,  547,  547,  547,  547,
+    0,  547,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  547,  547,    0,  547,    0,  547,    0,    3,
+    0,    0,    0,    6,    9,   12,    0,   15,   18,   21,
+   24,   27,   30,    0,   33,   36,   39,    0,   42,   45,
+   48,  769,    0,  772,    0,   51,   54,  547,  547,    0,
+   57,    0,    0,    0,    0,    0,   60,    0,    0,  484,
+  486,    0,  489,  849,  482,  480,    0,  481,  493,  483,
+    0,    0,    0,    0,    0,    0,    0,  547,  547,  547,
+  547,    0,    0,  488,    0,  492,    0,    0,    0,    0,
+    0,    0,    0,   66,   69,   72,   75,    0,    0,    0,
+    0,   78,   81,   84,   87,   90,   93,   96,   99,    0,
+    0,    0,    0,  490,    0,    0,  485,  546,  546,  546,
+  546,  546,  546,    0,    0,    0,  546,  546,  546,  546,
+  546,  546,    0,  546,    0,    0,    0,  546,  546,  546,
+  546,    0,  546,    0,  546,  546,  487,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  546,  546,  546,  546,
+    0,    0,  546,  546,  546,  546,  546,  546,  546,  546,
+  546,  546,  546,  546,    0,  546,  546,  546,  546,  546,
+  546,  546,  546,  546,    0,    0,    0,  546,  546,  546,
+  546,  546,    0,    0,  546,  546,  546,    0,  546,  546,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  546,
+    0,  547,  547,  547,  547,  547,  547,    0,    0,    0,
+  547,  547,  547,  547,  547,  547,  546,  547,    0,    0,
+    0,  547,  547,  547,  547,    0,  547,    0,  547,  547,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  547,  547,  547,  547,    0,   63,  547,  547,  547,  547,
+  547,  547,  547,  547,  547,  547,  547,  547,    0,  547,
+  547,  547,  547,  547,  547,  547,  547,  547,    0,    0,
+    0,  547,  547,  547,  547,  547,    0,    0,  547,  547,
+  547,    0,  547,  547,    0,    0,  544,    0,    0,    0,
+  544,  544,    0,  547,  544,  544,  544,  544,  544,    0,
+  544,    0,    0,    0,    0,    0,    0,  455,    0,    0,
+  547,  544,  544,    0,  544,    0,  544,  456,  457,  458,
+  459,  460,  461,  462,  463,  464,    0,  465,  466,  467,
+  468,  469,  470,  471,  472,  473,  474,  475,  476,  477,
+  478,  479,    0,    0,    0,    0,  544,  544,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  544,  544,  544,  544,
+  545,    0,    0,    0,  545,  545,    0,    0,  545,  545,
+  545,  545,  545,    0,  545,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  545,  545,    0,  545,    0,
+  545,    0,    3,    0,    0,    0,    6,    9,   12,    0,
+   15,   18,   21,   24,   27,   30,    0,   33,   36,   39,
+    0,   42,   45,   48, 3307,    0, 3310,    0,   51,   54,
+  545,  545,    0,   57,    0,    0,    0,    0,    0,   60,
+    0,    0,  484,  486,    0,  489,  858,  482,  480,    0,
+  481,  493,  483,    0,    0,    0,    0,    0,    0,    0,
+  545,  545,  545,  545,    0,    0,  488,    0,  492,    0,
+    0,    0,    0,    0,    0,    0,   66,   69,   72,   75,
+    0,    0,    0,    0,   78,   81,   84,   87,   90,   93,
+   96,   99,    0,    0,    0,    0,  490,    0,    0,  485,
+  544,  544,  544,  544,  544,  544,    0,    0,    0,  544,
+  544,  544,  544,  544,  544,    0,  544,    0,    0,    0,
+  544,  544,  544,  544,    0,  544,    0,  544,  544,  487,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  544,
+  544,  544,  544,    0,    0,  544,  544,  544,  544,  544,
+  544,  544,  544,  544,  544,  544,  544,    0,  544,  544,
+  544,  544,  544,  544,  544,  544,  544,    0,    0,    0,
+  544,  544,  544,  544,  544,    0,    0,  544,  544,  544,
+    0,  544,  544,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  544,    0,  545,  545,  545,  545,  545,  545,
+    0,    0,    0,  545,  545,  545,  545,  545,  545,  544,
+  545,    0,    0,    0,  545,  545,  545,  545,    0,  545,
+    0,  545,  545,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  545,  545,  545,  545,    0,   63,  545,
+  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,
+  545,    0,  545,  545,  545,  545,  545,  545,  545,  545,
+  545,    0,    0,    0,  545,  545,  545,  545,  545,    0,
+    0,  545,  545,  545,    0,  545,  545,    0,    0,  603,
+    0,    0,    0,  603,  603,    0,  545,  603,  603,  603,
+  603,  603,    0,  603,    0,    0,    0,    0,    0,    0,
+  455,    0,    0,  545,  603,  603,    0,  603,    0,  603,
+  456,  457,  458,  459,  460,  461,  462,  463,  464,    0,
+  465,  466,  467,  468,  469,  470,  471,  472,  473,  474,
+  475,  476,  477,  478,  479,    0,    0,    0,    0,  603,
+  603,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  603,
+  603,  603,  603,  606,    0,    0,    0,  606,  606,    0,
+    0,  606,  606,  606,  606,  606,    0,  606,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  606,  606,
+    0,  606,    0,  606,    0,    3,    0,    0,    0,    6,
+    9,   12,    0,   15,   18,   21,   24,   27,   30,    0,
+   33,   36,   39,    0,   42,   45,   48, 3307,    0, 3310,
+    0,   51,   54,  606,  606,    0,   57,    0,    0,    0,
+    0,    0,   60,    0,    0,  484,  486,    0,  489,    0,
+  482,  480,    0,  481,  493,  483,    0,    0,    0,    0,
+    0,    0,    0,  606,  606,  606,  606,    0,    0,  488,
+    0,  492,    0,    0,    0,    0,    0,    0,    0,   66,
+   69,   72,   75,    0,    0,    0,    0,   78,   81,   84,
+   87,   90,   93,   96,   99,    0,    0,    0,    0,  490,
+    0,  876,  485,  603,  603,  603,  603,  603,  603,    0,
+    0,    0,  603,  603,  603,  603,  603,  603,    0,  603,
+    0,    0,    0,  603,  603,  603,  603,    0,  603,    0,
+  603,  603,  487,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  603,  603,  603,  603,    0,    0,  603,  603,
+  603,  603,  603,  603,  603,  603,  603,  603,  603,  603,
+    0,  603,  603,  603,  603,  603,  603,  603,  603,  603,
+    0,    0,    0,  603,  603,  603,  603,  603,    0,    0,
+  603,  603,  603,    0,  603,  603,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  603,    0,  606,  606,  606,
+  606,  606,  606,    0,    0,    0,  606,  606,  606,  606,
+  606,  606,  603,  606,    0,    0,    0,  606,  606,  606,
+  606,    0,  606,    0,  606,  606,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  606,  606,  606,  606,
+    0,  171,  606,  606,  606,  606,  606,  606,  606,  606,
+  606,  606,  606,  606,    0,  606,  606,  606,  606,  606,
+  606,  606,  606,  606,    0,    0,    0,  606,  606,  606,
+  606,  606,    0,    0,  606,  606,  606,    0,  606,  606,
+    0,    0,  596,    0,    0,    0,  596,  596,    0,  606,
+  596,  596,  596,  596,  596,    0,  596,    0,    0,    0,
+    0,    0,    0,  455,    0,    0,  606,  596,  596,    0,
+  596,    0,  596,  456,  457,  458,  459,  460,  461,  462,
+  463,  464,    0,  465,  466,  467,  468,  469,  470,  471,
+  472,  473,  474,  475,  476,  477,  478,  479,    0,    0,
+    0,    0,  596,  596,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  596,  596,  596,  596,  607,    0,    0,    0,
+  607,  607,    0,    0,  607,  607,  607,  607,  607,    0,
+  607,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  607,  607,    0,  607,    0,  607,    1,    2,    0,
+    0,    0,    6,    7,  166,    0,   10,   11,   12,   13,
+  245,  168,    0,   16,   17,   18,    0,   20,   21,   22,
+    0,    0,    0,    0,  169,   26,  607,  607,    0,  170,
+    0,    0,    0,    0,    0,   28,    0,    0,  484,  486,
+    0,  489,    0,  482,  480,  619,  481,  493,  483,    0,
+    0,    0,    0,    0,    0,    0,  607,  607,  607,  607,
+    0,    0,  488,    0,  492,    0,    0,    0,    0,    0,
+    0,    0,   50,  529,   52,   53,    0,    0,    0,    0,
+   58,   59,   60,   61,   62,  173,   64,   65,    0,    0,
+    0,    0,  490,    0,    0,  485,  596,  596,  596,  596,
+  596,  596,    0,    0,    0,  596,  596,  596,  596,  596,
+  596,    0,  596,    0,    0,    0,  596,  596,  596,  596,
+    0,  596,    0,  596,  596,  487,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  596,  596,  596,  596,    0,
+    0,  596,  596,  596,  596,  596,  596,  596,  596,  596,
+  596,  596,  596,    0,  596,  596,  596,  596,  596,  596,
+  596,  596,  596,    0,    0,    0,  596,  596,  596,  596,
+  596,    0,    0,  596,  596,  596,    0,  596,  596,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  596,    0,
+  607,  607,  607,  607,  607,  607,    0,    0,    0,  607,
+  607,  607,  607,  607,  607,  596,  607,    0,    0,    0,
+  607,  607,  607,  607,    0,  607,    0,  607,  607,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  607,
+  607,  607,  607,    0,  171,  607,  607,  607,  607,  607,
+  607,  607,  607,  607,  607,  607,  607,    0,  607,  607,
+  607,  607,  607,  607,  607,  607,  607,    0,    0,    0,
+  607,  607,  607,  607,  607,    0,    0,  607,  607,  607,
+    0,  607,  607,    0,    0,  604,    0,    0,    0,  604,
+  604,    0,  607,  604,  604,  604,  604,  604,    0,  604,
+    0,    0,    0,    0,    0,    0,  455,    0,    0,  607,
+  604,  604,    0,  604,    0,  604,  456,  457,  458,  459,
+  460,  461,  462,  463,  464,    0,  465,  466,  467,  468,
+  469,  470,  471,  472,  473,  474,  475,  476,  477,  478,
+  479,    0,    0,    0,    0,  604,  604,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  604,  604,  604,  604,  605,
+    0,    0,    0,  605,  605,    0,    0,  605,  605,  605,
+  605,  605,    0,  605,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  605,  605,    0,  605,    0,  605,
+    1,    2,    0,    0,    0,    6,    7,  166,    0,   10,
+   11,   12,   13,  245,   15,    0,   16,   17,   18,    0,
+   20,   21,   22,    0,    0,    0,    0,  169,   26,  605,
+  605,    0,  170,    0,    0,    0,    0,    0,   28,    0,
+    0,    0,    0,    0,    0,    0,    0,  365,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  605,
+  605,  605,  605,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   50,  439,   52,   53,    0,
+    0,    0,    0,   58,   59,   60,   61,   62,  173,   64,
+   65,    0,    0,    0,    0,    0,    0,    0,    0,  604,
+  604,  604,  604,  604,  604,    0,    0,    0,  604,  604,
+  604,  604,  604,  604,    0,  604,    0,    0,    0,  604,
+  604,  604,  604,    0,  604,    0,  604,  604,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  604,  604,
+  604,  604,    0,    0,  604,  604,  604,  604,  604,  604,
+  604,  604,  604,  604,  604,  604,    0,  604,  604,  604,
+  604,  604,  604,  604,  604,  604,    0,    0,    0,  604,
+  604,  604,  604,  604,    0,    0,  604,  604,  604,    0,
+  604,  604,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  604,    0,  605,  605,  605,  605,  605,  605,    0,
+    0,    0,  605,  605,  605,  605,  605,  605,  604,  605,
+    0,    0,    0,  605,  605,  605,  605,    0,  605,    0,
+  605,  605,    0,    0,    0,    0,    0,    0,   63,    0,
+    0,    0,  605,  605,  605,  605,    0,    0,  605,  605,
+  605,  605,  605,  605,  605,  605,  605,  605,  605,  605,
+    0,  605,  605,  605,  605,  605,  605,  605,  605,  605,
+    0,    0,  657,  605,  605,  605,  605,  605,    0,  255,
+  605,  605,  605,  255,  605,  605,    0,  255,    0,  255,
+  255,  255,  255,  255,    0,  605,    0,    0,    0,    0,
+    0,    0,    0,    0,  255,  255,    0,  255,    0,  255,
+    0,    0,  605,    0,    1,    2,    0,    0,    0,    6,
+    0,    0,    0,   10,   11,   12,   13,  202,  168,    0,
+  203,    0,    0,    0,  192,   21,   22,  255,    0,  255,
+  255,  169,   26,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   28,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  255,
+  255,  255,  255,  555,    0,    0,    0,  555,  555,    0,
+    0,  555,  555,  555,  555,  555,    0,  555,    0,    0,
+    0,   52,   53,    0,    0,    0,    0,    0,  555,  555,
+    0,  555,    0,  555,    0,    3,    0,    0,    0,    6,
+    9,   12,    0,   15,   18,   21,   24,   27,   30,    0,
+   33,   36,   39,    0,   42,   45,   48,    0,    0,    0,
+    0,   51,   54,  555,  555,    0,   57,    0,    0,    0,
+    0,    0,   60,    0,    0,  484,  486,    0,  489,  890,
+  482,  480,    0,  481,  493,  483,    0,    0,    0,    0,
+    0,    0,    0,  555,  555,  555,  555,    0,    0,  488,
+    0,  492,    0,    0,    0,    0,    0,    0,    0,   66,
+   69,   72,   75,    0,    0,    0,    0,   78,   81,   84,
+   87,   90,   93,   96,   99,    0,    0,    0,    0,  490,
+    0,    0,  485,  255,  255,  255,  255,  255,  255,    0,
+    0,    0,  255,  255,  255,  255,  255,  255,    0,  255,
+    0,    0,    0,  255,  255,  255,    0,    0,    0,    0,
+    0,  255,  487,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  255,  255,  255,  255,    0,    0,  255,  255,
+  255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
+    0,  255,  255,  255,  255,  255,  255,  255,    0,  255,
+  255,  255,  255,  255,  255,  255,  255,  255,    0,    0,
+  255,  255,  255,    0,  255,  255,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  255,    0,  555,  555,  555,
+  555,  555,  555,    0,    0,    0,  555,  555,  555,  555,
+  555,  555,  255,  555,    0,    0,    0,  555,  555,  555,
+  555,    0,  555,    0,  555,  555,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  555,  555,  555,  555,
+    0,  171,  555,  555,  555,  555,  555,  555,  555,  555,
+  555,  555,  555,  555,    0,  555,  555,  555,  555,  555,
+  555,  555,  555,  555,    0,    0,    0,    0,  555,  555,
+  555,  555,    0,    0,  555,  555,  555,    0,  555,  555,
+    0,    0,  556,    0,    0,    0,  556,  556,    0,  555,
+  556,  556,  556,  556,  556,    0,  556,    0,    0,    0,
+    0,    0,    0,  455,    0,    0,  555,  556,  556,    0,
+  556,    0,  556,  456,  457,  458,  459,  460,  461,  462,
+  463,  464,    0,  465,  466,  467,  468,  469,  470,  471,
+  472,  473,  474,  475,  476,  477,  478,  479,    0,    0,
+    0,    0,  556,  556,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  556,  556,  556,  556,  557,    0,    0,    0,
+  557,  557,    0,    0,  557,  557,  557,  557,  557,    0,
+  557,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  557,  557,    0,  557,    0,  557,    1,    2,    0,
+    0,    0,    6,    7,  166,    0,   10,   11,   12,   13,
+  245,  168,    0,   16,   17,   18,    0,   20,   21,   22,
+    0,    0,    0,    0,  169,   26,  557,  557,    0,  170,
+    0,    0,    0,    0,    0,   28,    0,    0,  484,  486,
+    0,  489,  898,  482,  480,    0,  481,  493,  483,    0,
+    0,    0,    0,    0,    0,    0,  557,  557,  557,  557,
+    0,    0,  488,    0,  492,    0,    0,    0,    0,    0,
+    0,    0,   50,  172,   52,   53,    0,    0,    0,    0,
+   58,   59,   60,   61,   62,  173,   64,   65,    0,    0,
+    0,    0,  490,    0,    0,  485,  556,  556,  556,  556,
+  556,  556,    0,    0,    0,  556,  556,  556,  556,  556,
+  556,    0,  556,    0,    0,    0,  556,  556,  556,  556,
+    0,  556,    0,  556,  556,  487,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  556,  556,  556,  556,    0,
+    0,  556,  556,  556,  556,  556,  556,  556,  556,  556,
+  556,  556,  556,    0,  556,  556,  556,  556,  556,  556,
+  556,  556,  556,    0,    0,    0,    0,  556,  556,  556,
+  556,    0,    0,  556,  556,  556,    0,  556,  556,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  556,    0,
+  557,  557,  557,  557,  557,  557,    0,    0,    0,  557,
+  557,  557,  557,  557,  557,  556,  557,    0,    0,    0,
+  557,  557,  557,  557,    0,  557,    0,  557,  557,    0,
+    0,    0,    0,    0,  520,    0,    0,    0,    0,  557,
+  557,  557,  557,    0,    0,  557,  557,  557,  557,  557,
+  557,  557,  557,  557,  557,  557,  557,    0,  557,  557,
+  557,  557,  557,  557,  557,  557,  557,    0,    0,  520,
+    0,  557,  557,  557,  557,    0,    0,  557,  557,  557,
+    0,  557,  557,    0,   44,    0,    0,    0,  484,  629,
+    0,  630,  557,  628,  626,  619,  627,  493,  483,    0,
+    0,    0,    0,    0,    0,    0,  455,    0,    0,  557,
+    0,    0,  488,    0,  492,    0,  456,  457,  458,  459,
+  460,  461,  462,  463,  464,    0,  465,  466,  467,  468,
+  469,  470,  471,  472,  473,  474,  475,  476,  477,  478,
+  479,    0,  631,    0,    0,  485,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  239,  487,  616,  237,    0,    0,
+  616,  616,    0,    0,    0,  616,  616,  616,  616,  616,
+  616,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  520,  520,    0,    0,  616,    0,  616,  520,    0,  520,
+  520,  520,  520,  520,  520,    0,  520,  520,  520,    0,
+  520,  520,  520,    0,    0,    0,    0,  520,  520,    0,
+    0,    0,  520,    0,  616,    0,  616,  616,  520,    0,
+    0,    0,    0,    0,    0,    0,    0,  520,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  616,  616,    0,  616,
+    0,    0,    0,    0,    0,  520,  520,  520,  520,    0,
+    0,    0,    0,  520,  520,  520,  520,  520,  520,  520,
+  520,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    1,    2,
+    3,    4,    5,    6,    0,    0,    0,   10,   11,   12,
+   13,  202,  168,    0,  203,    0,    0,    0,  192,   21,
+   22,    0,    0,    0,    0,   25,   26,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  623,   29,   30,   31,
+   32,    0,    0,   34,   35,  205,  456,  457,  458,  459,
+  460,  461,  462,  463,  464,    0,  465,  466,  467,  468,
+  469,  470,  471,  472,  473,  624,  625,  476,  477,  478,
+  479,   48,   49,    0,    0,   52,   53,   54,    0,    0,
+   57,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  616,  616,  616,  616,  616,  616,    0,    0,    0,  616,
+  616,  616,  616,  616,  616,    0,  616,   72,    0,    0,
+  616,  616,  616,    0,    0,    0,    0,    0,  616,    0,
+    0,    0,    0,    0,  171,    0,    0,    0,    0,  616,
+  616,  616,  616,    0,    0,  616,  616,  616,  616,  616,
+  616,  616,  616,  616,  616,  616,  616,    0,  616,  616,
+  616,  616,  616,  616,  616,  616,  616,  616,  616,  616,
+  616,  616,  616,  616,  616,  553,    0,  616,  616,  616,
+  553,    0,  616,  553,    0,  553,  553,  553,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  553,  553,    0,  553,    0,  553,  484,  484,    0,  616,
+    0,  484,    0,    0,    0,  484,  484,  484,  484,  484,
+  484,    0,  484,    0,    0,    0,  484,  484,  484,    0,
+    0,    0,    0,  484,  484,  553,  553,    0,    0,    0,
+    0,    0,    0,    0,  484,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  553,  553,  553,  553,  554,
+    0,    0,    0,    0,  554,    0,    0,  554,    0,  554,
+  554,  554,    0,  484,  484,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  554,  554,    0,  554,    0,  554,
+    1,    2,    0,    0,    0,    6,    7,  166,    0,   10,
+   11,   12,   13,  245,   15,    0,   16,   17,   18,    0,
+   20,   21,   22,    0,    0,    0,    0,  169,   26,  554,
+  554,    0,  170,    0,    0,    0,    0,    0,   28,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  554,
+  554,  554,  554,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   50,  439,   52,   53,    0,
+    0,    0,    0,   58,   59,   60,   61,   62,  173,   64,
+   65,    0,    0,    0,    0,    0,    0,    0,    0,  553,
+  553,  553,  553,  553,  553,    0,    0,    0,  553,  553,
+  553,  553,  553,  553,    0,  553,    0,    0,    0,  553,
+  553,  553,  553,    0,  553,    0,  553,  553,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  553,  553,
+  553,  553,    0,    0,  553,  553,  553,  553,  553,  553,
+  553,  553,  553,  553,  553,  553,    0,  553,  553,  553,
+  553,  553,  553,  553,  553,  553,    0,    0,    0,    0,
+  553,  553,  553,  553,    0,    0,  553,  553,  553,    0,
+  553,  553,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  553,    0,  554,  554,  554,  554,  554,  554,    0,
+    0,    0,  554,  554,  554,  554,  554,  554,  553,  554,
+    0,    0,    0,  554,  554,  554,  554,    0,  554,    0,
+  554,  554,    0,    0,    0,    0,    0,  171,    0,    0,
+    0,    0,  554,  554,  554,  554,    0,    0,  554,  554,
+  554,  554,  554,  554,  554,  554,  554,  554,  554,  554,
+    0,  554,  554,  554,  554,  554,  554,  554,  554,  554,
+    0,    0,  366,    0,  554,  554,  554,  554,  573,    0,
+  554,  554,  554,  573,  554,  554,  573,    0,    0,  573,
+    0,    0,    0,    0,    0,  554,    0,    0,    0,    0,
+    0,    0,    0,  573,  573,    0,  573,    0,  573,  488,
+  488,    0,  554,    0,  488,    0,    0,    0,  488,  488,
+  488,  488,  488,  488,    0,  488,    0,    0,    0,  488,
+  488,  488,    0,    0,    0,    0,  488,  488,  573,  573,
+    0,    0,    0,    0,    0,    0,    0,  488,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  573,  573,
+  573,  573,  581,    0,    0,    0,    0,  581,    0,    0,
+  581,    0,    0,  581,    0,    0,  488,  488,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  581,  581,    0,
+  581,    0,  581,    1,    2,    0,    0,    0,    6,    7,
+  166,  438,   10,   11,   12,   13,  245,   15,    0,   16,
+   17,   18,    0,   20,   21,   22,    0,    0,    0,    0,
+  169,   26,  581,  581,    0,  170,    0,    0,    0,    0,
+    0,   28,    0,    0,    0,    0,    0,    0,    0,    0,
+  365,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  581,  581,  581,  581,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   50,  439,
+   52,   53,    0,    0,    0,    0,   58,   59,   60,   61,
+   62,   63,   64,   65,    0,    0,    0,    0,    0,    0,
+    0,    0,  573,  573,  573,  573,  573,  573,    0,    0,
+    0,  573,  573,  573,  573,  573,  573,    0,  573,    0,
+    0,    0,  573,  573,  573,  573,    0,  573,    0,  573,
+  573,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  573,  573,  573,  573,    0,    0,  573,  573,  573,
+  573,  573,  573,  573,  573,  573,  573,  573,  573,    0,
+  573,  573,  573,  573,  573,  573,  573,  573,  573,    0,
+    0,    0,    0,  573,  573,  573,  573,    0,    0,  573,
+  573,  573,    0,  573,  573,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  573,    0,  581,  581,  581,  581,
+  581,  581,    0,    0,    0,  581,  581,  581,  581,  581,
+  581,  573,  581,    0,    0,    0,  581,  581,  581,  581,
+    0,  581,    0,  581,  581,    0,    0,    0,    0,    0,
+  171,    0,    0,    0,    0,  581,  581,  581,  581,    0,
+    0,  581,  581,  581,  581,  581,  581,  581,  581,  581,
+  581,  581,    0,    0,  581,  581,  581,  581,  581,  581,
+  581,  581,  581,    0,    0,  366,    0,  581,  581,  581,
+  581,  579,    0,  581,  581,  581,  579,  581,  581,  579,
+    0,    0,  579,    0,    0,    0,    0,    0,  581,    0,
+    0,    0,    0,    0,    0,    0,  579,  579,    0,  579,
+    0,  579,    0,    0,    0,  581,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  579,  579,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  579,  579,  579,  579,  580,    0,    0,    0,    0,
+  580,    0,    0,  580,    0,    0,  580,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  580,  580,    0,  580,    0,  580,    1,    2,    0,    0,
+    0,    6,    7,  166,    0,   10,   11,   12,   13,  245,
+   15,    0,   16,   17,   18,    0,   20,   21,   22,    0,
+    0,    0,    0,  169,   26,  580,  580,    0,  170,    0,
+    0,    0,    0,    0,   28,    0,    0,    0,    0,    0,
+    0,    0,    0,  365,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  580,  580,  580,  580,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   50,   51,   52,   53,    0,    0,    0,    0,   58,
+   59,   60,   61,   62,  173,   64,   65,    0,    0,    0,
+    0,    0,    0,    0,    0,  579,  579,  579,  579,  579,
+  579,    0,    0,    0,  579,  579,  579,  579,  579,  579,
+    0,  579,    0,    0,    0,  579,  579,  579,  579,    0,
+  579,    0,  579,  579,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  579,  579,  579,  579,    0,    0,
+  579,  579,  579,  579,  579,  579,  579,  579,  579,  579,
+  579,    0,    0,  579,  579,  579,  579,  579,  579,    0,
+  579,  579,    0,    0,    0,    0,  579,  579,  579,  579,
+    0,    0,  579,  579,  579,    0,  579,  579,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  579,    0,  580,
+  580,  580,  580,  580,  580,    0,    0,    0,  580,  580,
+  580,  580,  580,  580,  579,  580,    0,    0,    0,  580,
+  580,  580,  580,    0,  580,    0,  580,  580,    0,    0,
+    0,    0,    0,  171,    0,    0,    0,    0,  580,  580,
+  580,  580,    0,    0,  580,  580,  580,  580,  580,  580,
+  580,  580,  580,  580,  580,    0,    0,  580,  580,  580,
+  580,  580,  580,    0,  580,  580,    0,    0,  366,    0,
+  580,  580,  580,  580,  562,    0,  580,  580,  580,  562,
+  580,  580,  562,    0,    0,  562,    0,    0,    0,    0,
+    0,  580,    0,    0,    0,    0,    0,    0,    0,  562,
+  562,    0,  562,    0,  562,    0,    0,    0,  580,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  562,  562,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  562,  562,  562,  562,  563,    0,
+    0,    0,    0,  563,    0,    0,  563,    0,    0,  563,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  563,  563,    0,  563,    0,  563,    1,
+    2,    0,    0,    0,    6,    7,  166,    0,   10,   11,
+   12,   13,  245,   15,    0,   16,   17,   18,    0,   20,
+   21,   22,    0,    0,    0,    0,  169,   26,  563,  563,
+    0,  170,    0,    0,    0,    0,    0,   28,    0,    0,
+    0,    0,    0,    0,    0,    0,  365,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  563,  563,
+  563,  563,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   50,  439,   52,   53,    0,    0,
+    0,    0,   58,   59,   60,   61,   62,  173,   64,   65,
+    0,    0,    0,    0,    0,    0,    0,    0,  562,  562,
+  562,  562,  562,  562,    0,    0,    0,  562,  562,  562,
+  562,  562,  562,    0,  562,    0,    0,    0,  562,  562,
+  562,  562,    0,  562,    0,  562,  562,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  562,  562,  562,
+  562,    0,    0,  562,  562,  562,  562,  562,  562,  562,
+  562,  562,  562,  562,    0,    0,  562,  562,  562,  562,
+  562,  562,    0,  562,  562,    0,    0,    0,    0,  562,
+  562,  562,  562,    0,    0,  562,  562,  562,    0,  562,
+  562,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  562,    0,  563,  563,  563,  563,  563,  563,    0,    0,
+    0,  563,  563,  563,  563,  563,  563,  562,  563,    0,
+    0,    0,  563,  563,  563,  563,    0,  563,    0,  563,
+  563,    0,    0,    0,    0,    0,  171,    0,    0,    0,
+    0,  563,  563,  563,  563,    0,    0,  563,  563,  563,
+  563,  563,  563,  563,  563,  563,  563,  563,    0,    0,
+  563,  563,  563,  563,  563,  563,    0,  563,  563,    0,
+    0,    0,    0,  563,  563,  563,  563,  577,    0,  563,
+  563,  563,  577,  563,  563,  577,    0,    0,  577,    0,
+    0,    0,    0,    0,  563,    0,    0,    0,    0,    0,
+    0,    0,  577,  577,    0,  577,    0,  577,    0,    0,
+    0,  563,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  577,  577,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  577,  577,  577,
+  577,  578,    0,    0,    0,    0,  578,    0,    0,  578,
+    0,    0,  578,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  578,  578,    0,  578,
+    0,  578,    1,    2,    0,    0,    0,    6,    7,  166,
+    0,   10,   11,   12,   13,  245,  168,    0,  843,   17,
+   18,    0,   20,  844,   22,    0,    0,    0,    0,  169,
+   26,  578,  578,    0,  170,    0,    0,    0,    0,  550,
+   28,    0,    0,  550,  550,    0,    0,    0,  550,  550,
+  550,  550,  550,  550,    0,    0,    0,    0,    0,    0,
+    0,  578,  578,  578,  578,    0,    0,  550,    0,  550,
+    0,    0,    0,    0,    0,    0,    0,   50,  172,   52,
+   53,    0,    0,    0,    0,   58,   59,   60,   61,   62,
+  173,   64,   65,    0,    0,    0,    0,    0,    0,  550,
+  550,  577,  577,  577,  577,  577,  577,    0,    0,    0,
+  577,  577,  577,  577,  577,  577,    0,  577,    0,    0,
+    0,  577,  577,  577,  577,    0,  577,    0,  577,  577,
+  550,    0,  550,    0,    0,    0,    0,    0,    0,    0,
+  577,  577,  577,  577,    0,    0,  577,  577,  577,  577,
+  577,  577,  577,  577,  577,  577,  577,    0,    0,  577,
+  577,  577,  577,    0,    0,    0,  577,  577, 1630,    0,
+    0,    0,    0,    0,  577,  577,    0,    0,  577,  577,
+  577,    0,  577,  577,    0,    0, 1634, 1634,    0, 1627,
+    0,    0,    0,  577,    0,  578,  578,  578,  578,  578,
+  578,    0,    0,    0,  578,  578,  578,  578,  578,  578,
+  577,  578,    0,    0,    0,  578,  578,  578,  578, 1634,
+  578,    0,  578,  578,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  578,  578,  578,  578,    0,    0,
+  578,  578,  578,  578,  578,  578,  578,  578,  578,  578,
+  578, 1634,    0,  578,  578,  578,  578,    0,    0,    0,
+  578,  578,    0,    0,    0,    0,    0,    0,  578,  578,
+  558,    0,  578,  578,  578,  558,  578,  578,  558,    0,
+    0,  558,    0,    0,    0,    0,    0,  578,    0,    0,
+    0,    0,    0,    0,    0,  558,  558,    0,  558,    0,
+  558,    0,    0,    0,  578,    0,    0,    0,  550,  550,
+    0,  550,  550,  550,  550,  550,  550,  550,  550,  550,
+    0,  550,  550,  550,  550,  550,  550,  550,  550,  550,
+  558,  558,  550,  550,  550,  550,  550,  550,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  558,  558,  558,  558,   44,    0,    0,    0,    0,   42,
+    0,   45,  550,   41,   39,    0,   40,    0,    0,    0,
+    0,    0,    0,    0,    0, 1619, 1619,    0,    0,    0,
+ 1623, 1619,    0,    0, 1619, 1619, 1619, 1619, 1619, 1619,
+    0, 1619,    0,    0,    0, 1619, 1619, 1619,    0,    0,
+    0,    0, 1619, 1619,    0,    0,    0,    0,    0,    0,
+    0,    0,   46, 1619,    0,    0,    0,    0,    0,    0,
+    0,    0, 1619,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  484,  486,    0,    0,    0,  482,  480,
+    0,  481,  493,  483,  239,    0,    0,  237,    0,    0,
+ 1638, 1619, 1619, 1641, 1645,    0,    0,    0,    0,  492,
+    0,    0,    0,    0,    0,    0, 1649,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  558,  558,  558,  558,  558,  558,
+  485,    0,    0,  558,  558,  558,  558,  558,  558,    0,
+  558,    0,    0,    0,  558,  558,  558,  558,    0,  558,
+    0,  558,  558,    0,    0,    0,    0,    0,    0,    0,
+  487,    0,    0,  558,  558,  558,  558,    0,    0,  558,
+  558,  558,  558,  558,  558,  558,  558,  558,  558,  558,
+    0,    0,  558,  558,  559,    0,    0,    0,    0,  558,
+  558,    0,  559,    0,    0,  559,    0,  558,  558,    0,
+    0,  558,  558,  558,    0,  558,  558,    0,    0,  559,
+  559,    0,  559,    0,  559,    0,  558,    0,    1,    2,
+    3,    4,    5,    6,    7,  166,    0,   10,   11,   12,
+   13,  245,  168,  558,   16,   17,   18,    0,   20,   21,
+   22,   23,    0,   24,  559,   25,   26,    0,    0,    0,
+  170,    0,    0,    0,    0,    0,   28,   29,   30,   31,
+   32,    0,    0,   34,   35,  205,    0,    0,    0,    0,
+    0,    0,    0,    0,  559,  559,  559,  559,    0,    0,
+    0,    0,    0,    0,    0,   37,   38,    0,    0,    0,
+    0,   48,   49,   50,  172,   52,   53,   54,    0,    0,
+   57,   58,   59,   60,   61,   62,  173,   64,   65,  560,
+    0,    0,    0,    0,    0,    0,    0,  560,    0,    0,
+  560,    0,    0,    0,    0,    0,    0,   72,    0,    0,
+    0,  455,    0,    0,  560,  560,    0,  560,    0,  560,
+    0,  456,  457,  458,  459,  460,  461,  462,  463,  464,
+    0,  465,  466,  467,  468,  469,  470,  471,  472,  473,
+  474,  475,  476,  477,  478,  479,    0,    0,    0,  560,
+  560,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  560,
+  560,  560,  560,    0,    0,    0,    0,    0,  559,  559,
+  559,  559,  559,  559,    0,    0,    0,  559,  559,  559,
+  559,  559,  559,    0,  559,    0,    0,    0,  559,  559,
+  559,  559,    0,  559,   44,  559,  559,    0,    0,   42,
+    0,   45,    0,   41,   39,    0,   40,  559,  559,  559,
+  559,    0,    0,  559,  559,  559,  559,  559,  559,  559,
+  559,  559,  559,  559,    0,    0,  559,  559,    0,    0,
+    0,    0,    0,  559,  559,    0,    0,    0,    0,    0,
+    0,  559,  559,    0,    0,  559,  559,  559,    0,  559,
+  559,    0,   46,    0,    0,    0,    0,    0,    0,    0,
+  559,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  559,    0,    0,
+    0,    0,    0,    0,  239,    0,    0,  237,    0,    0,
+    0,    0,    0,  560,  560,  560,  560,  560,  560,    0,
+    0,    0,  560,  560,  560,  560,  560,  560,    0,  560,
+    0,    0,    0,  560,  560,  560,  560,    0,  560,   44,
+  560,  560,    0,    0,   42,    0,   45,    0,   41,   39,
+    0,   40,  560,  560,  560,  560,    0,    0,  560,  560,
+  560,  560,  560,  560,  560,  560,  560,  560,  560,    0,
+    0,  560,  560,    0,    0,    0,    0,    0,  560,  560,
+    0,    0,    0,    0,    0,    0,  560,  560,    0,    0,
+  560,  560,  560,    0,  560,  560,    0,   46,    0,    0,
+    0,    0,    0,    0,    0,  560,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  560,    0,    0,    0,    0,    0,    0,  239,
+    0,    0,  237,    0,    0,    0,    0,    0,    1,    2,
+    3,    4,    5,    6,    7,  166,    0,   10,   11,   12,
+   13,  245,  168,    0,   16,   17,   18,    0,   20,   21,
+   22,    0,    0,    0,    0,   25,   26,    0,    0,    0,
+  170,    0,    0,    0,    0,    0,   28,   29,   30,   31,
+   32,    0,    0,   34,   35,  205,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  294,  294,    0,    0,
+    0,    0,    0,    0,    0,   37,   38,    0,    0,    0,
+    0,   48,   49,   50,  172,   52,   53,   54,    0,    0,
+   57,   58,   59,   60,   61,   62,  173,   64,   65,  582,
+    0,    0,    0,    0,    0,    0,    0,  582,    0,    0,
+  582,    0,    0,    0,    0,    0,    0,   72,    0,    0,
+    0,    0,    0,    0,  582,  582,    0,  582,    0,  582,
+    0,  294,    0,    1,    2,    3,    4,    5,    6,    7,
+  166,    0,   10,   11,   12,   13,  245,  168,    0,   16,
+   17,   18,    0,   20,   21,   22,    0,    0,    0,  582,
+   25,   26,    0,    0,    0,  170,    0,    0,    0,    0,
+    0,   28,   29,   30,   31,   32,    0,    0,   34,   35,
+  205,    0,    0,    0,    0,    0,    0,    0,    0,  582,
+    0,  582,  582,    0,    0,    0,    0,    0,    0,    0,
+   37,   38,    0,    0,    0,    0,   48,   49,   50,  529,
+   52,   53,   54,    0,    0,   57,   58,   59,   60,   61,
+   62,  173,   64,   65,  583,    0,    0,    0,    0,    0,
+    0,    0,  583,    0,    0,  583,    0,    0,    0,    0,
+    0,    0,   72,    0,    0,    0,    0,    0,    0,  583,
+  583,    0,  583,    0,  583,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  295,  295,    0,    0,    0,
+    0,  295,    0,    0,  295,  295,  295,  295,  295,  295,
+    0,  295,    0,    0,  583,  295,  295,  295,    0,    0,
+    0,    0,  295,  295,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  295,    0,    0,    0,    0,    0,    0,
+    0,    0,  295,    0,  583,    0,  583,  583,    0,    0,
+    0,    0,    0,  582,  582,  582,  582,  582,  582,    0,
+    0,    0,  582,  582,  582,  582,  582,  582,    0,  582,
+    0,  295,  295,  582,  582,  582,  582,    0,  582, 2047,
+  582,  582,    0,    0, 2047,    0, 2047,    0, 2047, 2047,
+    0, 2047,  582,  582,  582,  582,    0,    0,  582,  582,
+  582,  582,  582,  582,  582,  582,  582,  582,  582,    0,
+    0,  582,  582,    0,    0,    0,    0,    0,  582,  582,
+    0,    0,    0,    0,    0,    0,  582,  582,    0,    0,
+  582,  582,  582,    0,  582,  582,    0, 2047,    0,    0,
+    0,    0,    0,    0,    0,  582,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  582,    0,    0,    0,    0,    0,    0, 2047,
+    0, 2047, 2047,    0,    0,    0,    0,    0,  583,  583,
+  583,  583,  583,  583,    0,    0,    0,  583,  583,  583,
+  583,  583,  583,    0,  583,    0,    0,    0,  583,  583,
+  583,  583,    0,  583, 2050,  583,  583,    0,    0, 2050,
+    0, 2050,    0, 2050, 2050,    0, 2050,  583,  583,  583,
+  583,    0,    0,  583,  583,  583,  583,  583,  583,  583,
+  583,  583,  583,  583,    0,    0,  583,  583,    0,    0,
+    0,    0,    0,    0,  583,    0,    0,    0,    0,    0,
+    0,  583,  583,    0,    0,  583,  583,  583,    0,  583,
+  583,    0, 2050,    0,    0,    0,    0,    0,    0,    0,
+  583,    0,  552,    0,    0,    0,  552,  552,    0,    0,
+    0,  552,  552,  552,  552,  552,  552,  583,    0,    0,
+    0,    0,    0,    0, 2050,    0, 2050, 2050,    0,    0,
+  552,    0,  552, 2047, 2047, 2047, 2047, 2047, 2047,    0,
+    0,    0, 2047, 2047, 2047, 2047, 2047, 2047,    0, 2047,
+    0,    0,    0, 2047, 2047, 2047, 2047,    0, 2047,    0,
+ 2047, 2047,  552,  552,    0,    0,    0,    0,    0,    0,
+    0, 2047, 2047, 2047, 2047, 2047,    0,    0, 2047, 2047,
+ 2047,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  552,    0,  552,    0,    0,    0,    0,
+ 2047, 2047,    0,    0,    0,    0, 2047, 2047,    0,    0,
+ 2047, 2047, 2047,    0,    0, 2047,    0,   44,    0,    0,
+    0,    0,  308,    0,   45,    0,   41,   39,    0,   40,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+ 2047, 2047, 2047,    0,    0,  309,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 2050, 2050,
+ 2050, 2050, 2050, 2050,    0,    0,    0, 2050, 2050, 2050,
+ 2050, 2050, 2050,    0, 2050,  310,    0,    0, 2050, 2050,
+ 2050, 2050,    0, 2050,    0, 2050, 2050,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 2050, 2050, 2050, 2050,
+ 2050,    0,    0, 2050, 2050, 2050,    0,  239,    0,    0,
+  237,   44,    0,    0,    0,    0,  308,    0,   45,    0,
+   41,   39,    0,   40,    0, 2050, 2050,    0,    0,    0,
+    0, 2050, 2050,    0,    0, 2050, 2050, 2050,    0,  309,
+ 2050,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 2050, 2050, 2050,    0,  238,
+    0,  552,  552,    0,  552,  552,  552,  552,  552,  552,
+  552,  552,  552,    0,  552,  552,  552,  552,  552,  552,
+  552,  552,  552,    0,    0,  552,  552,  552,  552,  552,
+  552,  239,   44,    0,  237,    0,    0,   42,    0,   45,
+    0,   41,   39,    0,   40,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  552,    0,    0,    0,    0,
+    0,    1,    2,    3,    4,    5,    6,    0,    0,    0,
+   10,   11,   12,   13,  202,  168,    0,  203,    0,    0,
+  238,  192,   21,   22,   23,    0,   24,    0,   25,   26,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   28,
+   29,   30,   31,   32,    0,    0,   34,   35,  205,    0,
+    0,    0,  239,    0,  358,  237,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   37,   38,
+    0,    0,    0,    0,   48,   49,    0,    0,   52,   53,
+   54,    0,    0,   57,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    1,    2,    3,    4,    5,
+    6,    0,    0,  268,   10,   11,   12,   13,  202,  168,
+   72,  203,    0,    0,    0,  192,   21,   22,   23,    0,
+   24,    0,   25,   26,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,   28,   29,   30,   31,   32,  268,    0,
+   34,   35,  205,    0,    0,   44,    0,    0,    0,    0,
+   42,    0,   45,  731,   41,   39,    0,   40,    0,    0,
+    0,    0,   37,   38,    0,    0,    0,    0,   48,   49,
+    0,    0,   52,   53,   54,    0,    0,   57,    0,    0,
+    0,    0,    0,    0,    0,    0,    1,    2,    3,    4,
+    5,    6,    0,    0,    0,   10,   11,   12,   13,  202,
+  168,    0,  203,  238,   72,    0,  192,   21,   22,   23,
+    0,   24,    0,   25,   26,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   28,   29,   30,   31,   32,    0,
+    0,   34,   35,  205,    0,  239,   44,    0,  237,    0,
+    0,   42,    0,   45, 1072,   41,   39,    0,   40,    0,
+    0,    0,    0,   37,   38,    0,    0,    0,    0,   48,
+   49,    0,    0,   52,   53,   54,    0,    0,   57,  268,
+  268,    0,    0,    0,  268,  268,  268,    0,  268,  268,
+  268,  268,  268,  268,    0,  268,  268,  268,    0,  268,
+  268,  268,    0,    0,  238,   72,  268,  268,    0,    0,
+    0,  268,    0,    0,    0,    0,    0,  268,    0,    0,
+    0,    0,    0,    0,    0,    0,  268,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  239,    0,   44,  237,
+    0,    0,    0,   42,    0,   45,    0,   41,   39,    0,
+   40,    0,    0,    0,  268,  268,  268,  268,    0,    0,
+    0,    0,  268,  268,  268,  268,  268,  268,  268,  268,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
+    2,    3,    4,    5,    6,    0,    0,    0,   10,   11,
+   12,   13,  202,  168,    0,  203,  238,    0,    0,  192,
+   21,   22,   23,    0,   24,    0,   25,   26,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   28,   29,   30,
+   31,   32,    0,    0,   34,   35,  205,    0,  239,   44,
+ 1074,  237,    0,    0,   42,    0,   45,    0,   41,   39,
+    0,   40,    0,    0,    0,    0,   37,   38,    0,    0,
+    0,    0,   48,   49,    0,    0,   52,   53,   54,    0,
+    0,   57,    0,    0,    0,    0,    0,    0,    0,    0,
+    1,    2,    3,    4,    5,    6,    0,    0,    0,   10,
+   11,   12,   13,  202,  168,    0,  203,  238,   72,    0,
+  192,   21,   22,   23,    0,   24,    0,   25,   26,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   28,   29,
+   30,   31,   32,    0,    0,   34,   35,  205,    0,  239,
+    0,    0,  237,   44,    0,    0,    0,    0,   42,    0,
+   45,    0,   41,   39,    0,   40,    0,   37,   38,    0,
+    0,    0,    0,   48,   49,    0,    0,   52,   53,   54,
+    0,    0,   57,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    1,    2,    3,    4,    5,    6,    0,    0,
+    0,   10,   11,   12,   13,  202,  168,    0,  203,   72,
+    0,  238,  192,   21,   22,   23,    0,   24,    0,   25,
+   26,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+   28,   29,   30,   31,   32,    0,    0,   34,   35,  205,
+    0,    0,    0,  239, 1575,    0,  237,    0,    0, 1569,
+    0, 1578,    0, 1566, 1560,    0, 1563,    0,    0,   37,
+   38,    0,    0,    0,    0,   48,   49,    0,    0,   52,
+   53,   54,    0,    0,   57,    0,    0,    0,    0,    0,
+    0,    0,    0,    1,    2,    3,    4,    5,    6,    0,
+    0,    0,   10,   11,   12,   13,  202,  168,    0,  203,
+    0,   72, 1581,  192,   21,   22,  613,    0,  614,    0,
+   25,   26,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   28,   29,   30,   31,   32,    0,    0,   34,   35,
+  205,    0,    0,    0, 1605,    0,   44, 1572,    0,    0,
+    0,   42,    0,   45,  721,   41,   39,    0,   40,    0,
+   37,   38,    0,    0,    0,    0,   48,   49,    0,    0,
+   52,   53,   54,    0,    0,   57,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    1,    2,    3,
+    4,    5,    6,    0,    0,    0,   10,   11,   12,   13,
+  202,  168,   72,  203,  238,    0,    0,  192,   21,   22,
+   23,    0,   24,    0,   25,   26,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,   28,   29,   30,   31,   32,
+    0,    0,   34,   35,  205,    0,  239,   44,    0,  237,
+    0,    0,   42,    0,   45,    0,   41,   39,    0,   40,
+    0,    0,    0,    0,   37,   38,    0,    0,    0,    0,
+   48,   49,    0,    0,   52,   53,   54,    0,    0,   57,
+    0,    0,    0,    0,    0,    0,    0,    0, 1470, 1473,
+ 1476, 1479, 1482, 1485,    0,    0,    0, 1488, 1491, 1494,
+ 1497, 1500, 1503,    0, 1506,  238,   72,  734, 1509, 1512,
+ 1515, 1518,    0, 1521,    0, 1524, 1527,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 1530, 1533, 1536, 1539,
+ 1542,    0,    0, 1545, 1548, 1551,    0,  239,    0,    0,
+  237,   44,    0,    0,    0,    0,   42,    0,   45,    0,
+   41,   39,    0,   40,    0, 1554, 1557,    0,    0,    0,
+    0, 1584, 1587,    0,    0, 1590, 1593, 1596,    0,    0,
+ 1599,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1,    2,    3,    4,    5,    6,    0,    0,    0,   10,
+   11,   12,   13,  202,  168,    0,  203, 1602,    0,  238,
+  192,   21,   22,    0,    0,    0,    0,   25,   26,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   28,   29,
+   30,   31,   32,    0,    0,   34,   35,  205,    0,    0,
+    0,  239, 3256,    0,  237,    0,    0, 3250,    0, 3259,
+    0, 3247, 3241,    0, 3244,    0,    0,   37,   38,    0,
+    0,    0,    0,   48,   49,    0,    0,   52,   53,   54,
+    0,    0,   57,    0,    0,    0,    0,    0,    0,    0,
+    0,    1,    2,    3,    4,    5,    6,    0,    0,    0,
+   10,   11,   12,   13,  202,  168,    0,  203,    0,   72,
+ 3262,  192,   21,   22,    0,    0,    0,    0,   25,   26,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   28,
+   29,   30,   31,   32,    0,    0,   34,   35,  205,    0,
+    0,    0, 3286,    0,   44, 3253,    0,    0,    0,   42,
+    0,   45,    0,   41,   39,    0,   40,    0,   37,   38,
+    0,    0,    0,    0,   48,   49,    0,    0,   52,   53,
+   54,    0,    0,   57,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    1,    2,    3,    4,    5,
+    6,    0,    0,    0,   10,   11,   12,   13,  202,  168,
+   72,  203,  238,    0,  777,  192,   21,   22,    0,    0,
+    0,    0,   25,   26,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,   28,   29,   30,   31,   32,    0,    0,
+   34,   35,  205,    0,  239,   44,    0,  237,    0,    0,
+   42,    0,   45,    0,   41,   39,    0,   40,    0,    0,
+    0,    0,   37,   38,    0,    0,    0,  765,   48,   49,
+    0,    0,   52,   53,   54,    0,    0,   57,    0,    0,
+    0,    0,    0,    0,    0,    0, 3154, 3157, 3160, 3163,
+ 3166, 3169,    0,    0,    0, 3172, 3175, 3178, 3181, 3184,
+ 3187,    0, 3190,  238,   72,    0, 3193, 3196, 3199,    0,
+    0,    0,    0, 3202, 3205,    0,    0,    0,    0,    0,
+    0,    0,    0,    0, 3208, 3211, 3214, 3217, 3220,    0,
+    0, 3223, 3226, 3229,    0,  239,  555,  901,  237,    0,
+    0,    0,    0,    0,    0,    0,    0,  555,    0,    0,
+    0,    0,    0, 3232, 3235,    0,    0,    0, 3238, 3265,
+ 3268,    0,    0, 3271, 3274, 3277,    0,    0, 3280,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    1,    2,
+    3,    4,    5,    6,    0,    0,    0,   10,   11,   12,
+   13,  202,  168,    0,  203, 3283,    0,    0,  192,   21,
+   22,    0,    0,    0,    0,   25,   26,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,   28,   29,   30,   31,
+   32,    0,    0,   34,   35,  205,  555,    0,   44,  555,
+    0,    0,    0,   42,    0,   45,    0,   41,   39,    0,
+   40,    0,    0,    0,    0,   37,   38,    0,    0,    0,
+    0,   48,   49,    0,    0,   52,   53,   54,    0,    0,
+   57,    0,    0,    0,    0,    0,    0,    0,    0,    1,
+    2,    3,    4,    5,    6,    0,    0,    0,   10,   11,
+   12,   13,  202,  168,    0,  203,  238,   72, 1046,  192,
+   21,   22,    0,    0,    0,    0,   25,   26,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   28,   29,   30,
+   31,   32,    0,    0,   34,   35,  205,    0,  239,  610,
+    0,  237,    0,    0,    0,    0,    0,  610,    0,    0,
+  610,    0,    0,    0,    0,    0,   37,   38,    0,    0,
+    0,    0,   48,   49,  610,  610,   52,   53,   54,    0,
+    0,   57,    0,    0,    0,    0,    0,    0,    0,    0,
+  555,  555,  555,  555,  555,  555,    0,    0,    0,  555,
+  555,  555,  555,  555,  555,    0,  555,    0,   72,  610,
+  555,  555,  555,    0,    0,    0,    0,  555,  555,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  555,
+  555,  555,  555,    0,    0,  555,  555,  555,    0,  610,
+    0,  610,  610,    0,    0,    0,    0,    0,    0,    0,
+    0,  565,    0,    0,    0,    0,    0,    0,    0,  565,
+    0,    0,  565,  555,  555,    0,    0,  555,  555,  555,
+    0,    0,  555,    0,    0,    0,  565,  565,    0,    0,
+    0,    0,    1,    2,    3,    4,    5,    6,    0,    0,
+    0,   10,   11,   12,   13,  202,  168,    0,  203,  555,
+    0,    0,  192,   21,   22,    0,    0,    0,    0,   25,
+   26,  565,    0,    0,    0,    0,    0,    0,    0,    0,
+   28,   29,   30,   31,   32,    0,    0,   34,   35,  205,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  565,    0,  565,  565,    0,    0,    0,    0,   37,
+   38,    0,    0,    0,    0,   48,   49,    0,    0,   52,
+   53,   54,    0,    0,   57,    0,    0,    0,    0,    0,
+    0,    0,    0,  610,  610,  610,  610,  610,  610,    0,
+    0,    0,  610,  610,  610,  610,  610,  610,    0,  610,
+    0,   72,    0,  610,  610,  610,  610,    0,  610,    0,
+  610,  610,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  610,  610,  610,  610,    0,    0,  610,  610,
+  610,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  566,    0,    0,    0,    0,    0,    0,
+    0,  566,    0,    0,  566,    0,  610,  610,    0,    0,
+  610,  610,  610,    0,  610,  610,    0,    0,  566,  566,
+    0,    0,    0,    0,    0,  610,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  565,  565,  565,  565,  565,
+  565,    0,  610,    0,  565,  565,  565,  565,  565,  565,
+    0,  565,    0,  566,    0,  565,  565,  565,  565,    0,
+  565,    0,  565,  565,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  565,  565,  565,  565,    0,    0,
+  565,  565,  565,  566,    0,  566,  566,    0,    0,    0,
+    0,    0,    0,    0,  567,    0,    0,    0,    0,    0,
+    0,    0,  567,    0,    0,  567,    0,    0,  565,  565,
+    0,    0,  565,  565,  565,    0,  565,  565,    0,  567,
+  567,    0,    0,    0,    0,    0,    0,  565,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  565,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  567,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  567,    0,  567,  567,  568,    0,
+    0,    0,    0,    0,    0,    0,  568,    0,    0,  568,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  568,  568,    0,    0,  566,  566,  566,
+  566,  566,  566,    0,    0,    0,  566,  566,  566,  566,
+  566,  566,    0,  566,    0,    0,    0,  566,  566,  566,
+  566,    0,  566,    0,  566,  566,    0,    0,  568,    0,
+    0,    0,    0,    0,    0,    0,  566,  566,  566,  566,
+    0,    0,  566,  566,  566,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  568,    0,
+  568,  568,    0,    0,    0,    0,    0,    0,    0,  569,
+  566,  566,    0,    0,  566,  566,  566,  569,  566,  566,
+  569,    0,    0,    0,    0,    0,    0,    0,    0,  566,
+    0,    0,    0,    0,  569,  569,    0,    0,  567,  567,
+  567,  567,  567,  567,    0,    0,  566,  567,  567,  567,
+  567,  567,  567,    0,  567,    0,    0,    0,  567,  567,
+  567,  567,    0,  567,    0,  567,  567,    0,    0,  569,
+    0,    0,    0,    0,    0,    0,    0,  567,  567,  567,
+  567,    0,    0,  567,  567,  567,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  569,
+    0,  569,  569,    0,    0,    0,    0,    0,    0,    0,
+    0,  567,  567,    0,    0,  567,  567,  567,    0,  567,
+  567,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  567,    0,  568,  568,  568,  568,  568,  568,    0,    0,
+    0,  568,  568,  568,  568,  568,  568,  567,  568,    0,
+    0,    0,  568,  568,  568,  568,    0,  568,  570,  568,
+  568,    0,    0,    0,    0,    0,  570,    0,    0,  570,
+    0,  568,  568,  568,  568,    0,    0,  568,  568,  568,
+    0,    0,    0,  570,  570,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  568,  568,    0,    0,  568,
+  568,  568,    0,  568,  568,    0,    0,    0,  570,    0,
+    0,    0,    0,    0,  568,    0,    0,    0,    0,    0,
+    0,    0,    0,  569,  569,  569,  569,  569,  569,    0,
+    0,  568,  569,  569,  569,  569,  569,  569,  570,  569,
+  570,  570,    0,  569,  569,  569,  569,    0,  569,  571,
+  569,  569,    0,    0,    0,    0,    0,  571,    0,    0,
+  571,    0,  569,  569,  569,  569,    0,    0,  569,  569,
+  569,    0,    0,    0,  571,  571,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  569,  569,    0,    0,
+  569,  569,  569,    0,  569,  569,    0,    0,    0,  571,
+    0,    0,    0,    0,    0,  569,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  569,    0,    0,    0,    0,    0,    0,  571,
+    0,  571,  571,  572,    0,    0,    0,    0,    0,    0,
+    0,  572,    0,    0,  572,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  572,  572,
+    0,    0,  570,  570,  570,  570,  570,  570,    0,    0,
+    0,  570,  570,  570,  570,  570,  570,    0,  570,    0,
+    0,    0,  570,  570,  570,  570,    0,  570,    0,  570,
+  570,    0,    0,  572,    0,    0,    0,    0,    0,    0,
+    0,  570,  570,  570,  570,    0,    0,  570,  570,  570,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  572,    0,  572,  572,    0,    0,    0,
+    0,    0,    0,    0,  575,  570,  570,    0,    0,  570,
+  570,  570,  575,  570,  570,  575,    0,    0,    0,    0,
+    0,    0,    0,    0,  570,    0,    0,    0,    0,  575,
+  575,    0,    0,  571,  571,  571,  571,  571,  571,    0,
+    0,  570,  571,  571,  571,  571,  571,  571,    0,  571,
+    0,    0,    0,  571,  571,  571,  571,    0,  571,    0,
+  571,  571,    0,    0,  575,    0,    0,    0,    0,    0,
+    0,    0,  571,  571,  571,  571,    0,    0,  571,  571,
+  571,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  575,    0,  575,  575,    0,    0,
+    0,    0,    0,    0,    0,    0,  571,  571,    0,    0,
+  571,  571,  571,    0,  571,  571,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  571,    0,  572,  572,  572,
+  572,  572,  572,    0,    0,    0,  572,  572,  572,  572,
+  572,  572,  571,  572,    0,    0,    0,  572,  572,  572,
+  572,    0,  572,  576,  572,  572,    0,    0,    0,    0,
+    0,  576,    0,    0,  576,    0,  572,  572,  572,  572,
+    0,    0,  572,  572,  572,    0,    0,    0,  576,  576,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  572,  572,    0,    0,  572,  572,  572,    0,  572,  572,
+    0,    0,    0,  576,    0,    0,    0,    0,    0,  572,
+    0,    0,    0,    0,    0,    0,    0,    0,  575,  575,
+  575,  575,  575,  575,    0,    0,  572,  575,  575,  575,
+  575,  575,  575,  576,  575,  576,  576,    0,  575,  575,
+  575,  575,    0,  575,  561,  575,  575,    0,    0,    0,
+    0,    0,  561,    0,    0,  561,    0,  575,  575,  575,
+  575,    0,    0,  575,  575,  575,    0,    0,    0,  561,
+  561,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  575,  575,    0,    0,  575,  575,  575,    0,  575,
+  575,    0,    0,    0,  561,    0,    0,    0,    0,    0,
+  575,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  575,    0,    0,
+    0,    0,    0,    0,  561,    0,  561,  561,  574,    0,
+    0,    0,    0,    0,    0,    0,  574,    0,    0,  574,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  574,  574,    0,    0,  576,  576,  576,
+  576,  576,  576,    0,    0,    0,  576,  576,  576,  576,
+  576,  576,    0,  576,    0,    0,    0,  576,  576,  576,
+  576,    0,  576,    0,  576,  576,    0,    0,  574,    0,
+    0,    0,    0,    0,    0,    0,  576,  576,  576,  576,
+    0,    0,  576,  576,  576,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  574,    0,
+  574,  574,    0,    0,    0,    0,    0,    0,    0,  625,
+  576,  576,    0,    0,  576,  576,  576,  625,  576,  576,
+  625,    0,    0,    0,    0,    0,    0,    0,    0,  576,
+    0,    0,    0,    0,  625,  625,    0,    0,  561,  561,
+  561,  561,  561,  561,    0,    0,  576,  561,  561,  561,
+  561,  561,  561,    0,  561,    0,    0,    0,  561,  561,
+  561,  561,    0,  561,    0,  561,  561,    0,    0,  625,
+    0,    0,    0,    0,    0,    0,    0,  561,  561,  561,
+  561,    0,    0,  561,  561,  561,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  625,
+    0,  625,  625,    0,    0,    0,    0,    0,    0,    0,
+    0,  561,  561,    0,    0,  561,  561,  561,    0,  561,
+  561,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  561,    0,  574,  574,  574,  574,  574,  574,    0,    0,
+    0,  574,  574,  574,  574,  574,  574,  561,  574,    0,
+    0,    0,  574,  574,  574,  574,    0,  574,  626,  574,
+  574,    0,    0,    0,    0,    0,  626,    0,    0,  626,
+    0,  574,  574,  574,  574,    0,    0,  574,  574,  574,
+    0,    0,    0,  626,  626,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  574,  574,    0,    0,  574,
+  574,  574,    0,  574,  574,    0,    0,    0,  626,    0,
+    0,    0,    0,    0,  574,    0,    0,    0,    0,    0,
+    0,    0,    0,  625,  625,  625,  625,  625,  625,    0,
+    0,  574,  625,  625,  625,  625,  625,  625,  626,  625,
+  626,  626,    0,  625,  625,  625,  625,    0,  625,  564,
+  625,  625,    0,    0,    0,    0,    0,  564,    0,    0,
+  564,    0,  625,  625,  625,  625,    0,    0,  625,  625,
+  625,    0,    0,    0,  564,  564,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  625,  625,    0,    0,
+  625,  625,  625,    0,  625,  625,    0,    0,    0,  564,
+    0,    0,    0,    0,    0,  625,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  625,    0,    0,    0,    0,    0,    0,  564,
+    0,  564,  564, 3415,    0,    0,    0,    0, 3409,    0,
+ 3418,    0, 3406, 3400,    0, 3403,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  626,  626,  626,  626,  626,  626,    0,    0,
+    0,  626,  626,  626,  626,  626,  626,    0,  626,    0,
+    0,    0,  626,  626,  626,  626,    0,  626,    0,  626,
+  626, 3421,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  626,  626,  626,  626,    0,    0,  626,  626,  626,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0, 3445,    0,    0, 3412,    0,  115,    0,
+  115,  115,  115,    0,  115,  626,  626,    0,    0,  626,
+  626,  626,    0,  626,  626,    0,    0,    0,    0,  115,
+    0,  115,    0,    0,  626,    0,    0,    0,    0,    0,
+    0,    0,    0,  564,  564,  564,  564,  564,  564,    0,
+    0,  626,  564,  564,  564,  564,  564,  564,    0,  564,
+    0,  115,    0,  564,  564,  564,  564,    0,  564,    0,
+  564,  564,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  564,  564,  564,  564,    0,    0,  564,  564,
+  564,    0,    0,    0,    0,    0,   44,    0,    0,    0,
+    0,   42,    0,   45,    0,   41,   39,    0,   40,    0,
+    0,    0,    0,    0,    0,    0,  564,  564,    0,    0,
+  564,  564,  564,    0,  564,  564,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  564,    0, 3313, 3316, 3319,
+ 3322, 3325, 3328,    0,    0,    0, 3331, 3334, 3337, 3340,
+ 3343, 3346,  564, 3349,  238,    0,    0, 3352, 3355, 3358,
+    0,    0,    0,    0, 3361, 3364,    0,    0,    0,    0,
+    0,    0,    0,    0,    0, 3367, 3370, 3373, 3376, 3379,
+    0,    0, 3382, 3385, 3388,    0,  239,   44,    0,  237,
+    0,    0,   42,    0,  317,    0,   41,   39,    0,   40,
+    0,    0,    0,    0, 3391, 3394,    0,    0,    0, 3397,
+ 3424, 3427,    0,    0, 3430, 3433, 3436,    0,    0, 3439,
+    0,    0,    0,    0,    0,    0,    0,  115,  115,    0,
+    0,    0,  115,  115,    0,    0,  115,  115,  115,  115,
+  115,  115,    0,  115,    0,  238, 3442,  115,  115,  115,
+  115,    0,  115,    0,  115,  115,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  115,    0,    0,    0,    0,
+    0,    0,  115,    0,  115,    0,    0,  239,    0,   44,
+  237,    0,    0,    0,   42,    0,   45,    0,   41,   39,
+    0,   40,  115,    0,    0,    0,    0,    0,  115,  115,
+    0,    0,  115,  115,  115,  115,  115,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1,    2,    3,    4,    5,    6,    0,    0,    0,   10,
+   11,   12,   13,  202,  168,    0,  203,  320,    0,    0,
+  192,   21,   22,    0,    0,    0,    0,   25,   26,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   28,   29,
+   30,   31,   32,    0,    0,   34,   35,  205,    0,  239,
+   44,    0,  237,    0,    0,   42,    0,   45,    0,   41,
+   39,    0,   40,    0,    0,    0,    0,   37,   38,    0,
+    0,    0,    0,   48,   49,    0,    0,   52,   53,   54,
+    0,    0,   57,    0,    0,    0,    0,    0,    0,    0,
+    0,    1,    2,    3,    4,    5,    6,    0,    0,    0,
+   10,   11,   12,   13,  202,  168,    0,  203,  238,   72,
+    0,  192,   21,   22,    0,    0,    0,    0,   25,   26,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,   28,
+   29,   30,   31,   32,    0,    0,   34,   35,  205,    0,
+  239,  628,    0,  237,    0,    0,    0,    0,    0,  628,
+    0,    0,    0,    0,    0,    0,    0,    0,   37,   38,
+    0,    0,    0,    0,   48,   49,  628,  628,   52,   53,
+   54,    0,    0,   57,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    1,    2,    3,    4,    5,    6,    0,
+    0,    0,   10,   11,   12,   13,  202,  168,    0,  203,
+   72,  628,    0,  192,   21,   22,    0,    0,    0,    0,
+   25,   26,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   28,   29,   30,   31,   32,    0,    0,   34,   35,
+  205,  628,   44,  628,  628,    0,    0,   42,    0,   45,
+    0,   41,   39,    0,   40,    0,    0,    0,    0,    0,
+   37,   38,    0,    0,    0,    0,   48,   49,   47,    0,
+   52,   53,   54,    0,    0,   57,    0,    0,    0,    0,
+    0,    0,    0,    0,    1,    2,    3,    4,  869,    6,
+    0,    0,    0,   10,   11,   12,   13,  202,  168,    0,
+  203,    0,   72,    0,  192,   21,   22,    0,    0,    0,
+    0,   25,   26,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   28,   29,   30,   31,   32,    0,    0,   34,
+   35,  205,   73,   44,    0,   43,    0,    0,   42,    0,
+   45,    0,   41,   39,    0,   40,    0,    0,    0,    0,
+    0,   37,   38,    0,    0,    0,    0,   48,   49,   47,
+    0,   52,   53,   54,    0,    0,   57,    0,    0,    0,
+    0,    0,    0,    0,    0,  628,  628,  628,  628,  628,
+  628,    0,    0,    0,  628,  628,  628,  628,  628,  628,
+    0,  628,    0,   72,    0,  628,  628,  628,  628,    0,
+  628,    0,  628,  628,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  628,  628,  628,  628,    0,    0,
+  628,  628,  628,   73,    0,    0,   43,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  628,  628,
+    0,  558,  628,  628,  628,    0,  628,  628,    0,    0,
+    0,    0,  558,    0,    0,    0,    0,  628,    3,    4,
+    5,    0,    0,    0,    9,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  628,   19,    0,    0,    0,   23,
+    0,   24,    0,    0,    0,    0,    0,    0,    0,  535,
+    0,    0,    0,    0,    0,   29,   30,   31,   32,   33,
+  535,   34,   35,   36,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,   37,   38,    0,    0,    0,    0,   48,
+   49,  558,    0,    0,  558,   54,   55,   56,   57,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,   66,    3,
+    4,    5,    0,   67,    0,    9,    0,    0,    0,   68,
+   69,   70,   71,    0,    0,   72,   19,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  535,
+    0,    0,  535,    0,    0,    0,   29,   30,   31,   32,
+   33,    0,   34,   35,   36,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,   37,   38,    0,    0,    0,    0,
+   48,   49,    0,    0,    0,    0,   54,   55,   56,   57,
+    0,    0,    0,  152,    0,    0,    0,  152,    0,   66,
+  152,    0,  152,  152,   67,    0,    0,    0,    0,    0,
+   68,   69,   70,   71,  152,  152,   72,  152,    0,  152,
+    0,    0,    0,    0,    0,  558,  558,  558,  558,  558,
+  558,    0,    0,    0,  558,  558,  558,  558,  558,  558,
+    0,  558,    0,    0,    0,  558,  558,  558,    0,  152,
+  152,    0,  558,  558,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  558,  558,  558,  558,    0,    0,
+  558,  558,  558,    0,  535,  535,  535,  535,  535,    0,
+  152,  152,  535,  535,  535,  535,  535,  535,    0,  535,
+    0,    0,    0,  535,  535,  535,    0,    0,  558,  558,
+  535,  535,  558,  558,  558,    0,    0,  558,    0,    0,
+    0,    0,  535,  535,  535,  535,    0,  280,  535,  535,
+  535,  275,  277,    0,  283,    0,  273,  271,  282,  272,
+    0,  274,    0,    0,  558,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  281,  535,  535,    0,    0,
+  535,  535,  535,    0,    0,  535,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  284,    0,    0,  276,    0,
+    0,    0,  535,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  278,    0,
+  279,    0,    0,    0,    0,    0,    0,    0,    0,  152,
+    0,    0,    0,    0,  154,    0,    0,    0,  154,    0,
+    0,  154,    0,  154,  154,    0,  152,    0,  152,    0,
+    0,    0,    0,    0,    0,  154,  154,    0,  154,    0,
+  154,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+    0,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+  154,  154,  152,  152,  152,    0,    0,    0,  152,  152,
+    0,    0,    0,    0,  152,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  152,    0,    0,    0,    0,
+    0,  154,  154,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  524,  524,
+    0,    1,    2,  244,    0,    0,    6,    7,  166,    0,
+   10,   11,   12,   13,  245,  168,    0,   16,   17,   18,
+    0,   20,   21,   22,    0,    0,    0,    0,  169,   26,
+    0,    0,    0,  170,    0,    0,    0,    0,    0,   28,
+    0,    0,    0,    0,    0,    0,    0,    0,  524,  246,
+  247,  248,  249,  250,  251,  252,  253,  254,  255,  256,
+  257,  258,  259,  260,  261,  262,  263,  264,  265,  266,
+  267,  268,  269,  270,  285,  286,   50,  172,   52,   53,
+  524,    0,    0,  524,   58,   59,   60,   61,   62,  173,
+   64,   65,    0,    0,  611,    0,    0,    0,  611,    0,
+    0,  611,    0,  611,  611,    0,    0,    0,    0,    0,
+  154,    0,    0,    0,    0,  611,  611,    0,  611,    0,
+  611,    0,    0,    0,    0,    0,    0,  154,    0,  154,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  611,  611,  154,  154,  154,  154,  154,  154,  154,  154,
+  154,    0,  154,  154,  154,  154,  154,  154,  154,  154,
+  154,    0,    0,  154,  154,  154,    0,    0,    0,  154,
+  154,  611,  611,  609,    0,  154,    0,  609,    0,    0,
+  609,    0,  609,  609,    0,    0,  154,    0,    0,    0,
+    0,    0,    0,    0,  609,  609,    0,  609,    0,  609,
+    0,    0,    0,    0,  524,  524,    0,    0,    0,  524,
+  524,  524,    0,  524,  524,  524,  524,  524,  524,    0,
+  524,  524,  524,    0,  524,  524,  524,    0,    0,  609,
+  609,  524,  524,    0,    0,    0,  524,    0,    0,    0,
+    0,    0,  524,    0,    0,    0,    0,    0,    0,    0,
+    0,  524,    0,    0,  520,  520,    0,    0,    0,    0,
+  609,  609,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  524,
+  524,  524,  524,  524,    0,    0,    0,  524,  524,  524,
+  524,  524,  524,  524,  524,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  520,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  611,    0,  611,
+    0,    0,    0,    0,    0,    0,  520,    0,    0,  520,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  611,  611,  611,  611,  611,  611,  611,  611,
+  611,    0,  611,  611,  611,  611,  611,  611,  611,  611,
+  611,    0,    0,  611,  611,  611,  611,    0,    0,    0,
+    0,    0,    0,    0,    0,  611,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  611,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  280,    0,
+    0,    0,  275,  277,    0,  283,    0,  273,  271,  282,
+  272,    0,  274,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  281,    0,    0,    0,
+    0,  609,  609,  609,  609,  609,  609,  609,  609,  609,
+    0,  609,  609,  609,  609,  609,  609,  609,  609,  609,
+    0,    0,  609,  609,  609,  609,  575,    0,    0,  276,
+  520,  520,    0,    0,  609,  520,    0,  520,    0,  520,
+  520,  520,  520,  520,  520,  609,  520,  520,  520,    0,
+  520,  520,  520,    0,    0,    0,    0,  520,  520,  278,
+    0,  279,  520,    0,    0,    0,    0,    0,  520,    0,
+    0,    0,    0,  115,  115,    0,  115,  520,  115,  115,
+  115,  115,  115,  115,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  115,    0,  115,    0,  115,
+    0,    0,    0,    0,    0,  520,  520,  520,  520,  520,
+    0,    0,    0,  520,  520,  520,  520,  520,  520,  520,
+  520,    0,    0,    0,    0,    0,    0,  115,    0,    0,
+  115,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  115,
+  115,  115,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    1,    2,  244,    0,    0,    6,    0,    0,
+    0,   10,   11,   12,   13,  202,  168,  247,  203,    0,
+  247,    0,  192,   21,   22,    0,    0,    0,    0,  169,
+   26,    0,    0,    0,    0,  247,    0,  247,    0,    0,
+   28,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  246,  247,  248,  249,  250,  251,  252,  253,  254,  255,
+  256,  257,  258,  259,  260,  261,  262,  263,  264,  265,
+  266,  267,  268,  269,  270,  285,  286,    0,    0,   52,
+   53,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  247,
+    0,    0,    0,  115,  115,    0,    0,    0,  115,  115,
+    0,    0,  115,  115,  115,  115,  115,  115,    0,  115,
+    0,    0,    0,  115,  115,  115,  115,    0,  115,    0,
+    0,  115,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  115,    0,    0,    0,    0,    0,    0,    0,    0,
+  115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+    0,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+  115,  115,  115,  115,  115,  115,    0,    0,  115,  115,
+  115,  115,  115,  115,  115,    0,  115,    0,  115,  115,
+  115,  115,  115,  115,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  115,    0,  115,    0,  115,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  247,  247,    0,    0,  115,  247,  247,
+  115,    0,  247,  247,  247,  247,  247,  247,    0,  247,
+    0,    0,    0,  247,  247,  247,  247,    0,  247,    0,
+  247,  247,    0,    0,    0,    0,  537,    0,    0,  115,
+  115,  115,  537,  537,  537,  537,  537,    0,  247,    0,
+  247,    0,    0,    0,    0,    0,    0,    0,  537,    0,
+  537,    0,  537,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  247,    0,    0,    0,  247,
+  247,  247,  247,    0,    0,    0,    0,    0,    0,    0,
+  537,    0,    0,  537,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  537,  537,    0,    0,  148,    0,  148,
+  148,  148,    0,  148,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  148,    0,
+  148,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  115,  115,    0,    0,    0,  115,  115,
+  148,    0,  115,  115,  115,  115,  115,  115,    0,  115,
+    0,    0,    0,  115,  115,  115,  115,    0,  115,    0,
+    0,  115,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  115,  148,    0,    0,    0,    0,    0,    0,    0,
+  115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+    0,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+  115,  115,  115,  115,    0,  115,    0,    0,  115,  115,
+  115,  115,  115,    0,    0,    0,  137,  137,    0,    0,
+    0,  137,  137,    0,    0,  137,  137,  137,  137,  137,
+  137,    0,  137,    0,    0,    0,  137,  137,  137,  137,
+    0,  137,    0,    0,  137,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  137,  537,  537,  537,  537,  537,  537,
+  537,  537,  537,    0,  537,  537,  537,  537,  537,  537,
+  537,    0,  537,  537,  537,  537,  537,   63,  537,    0,
+    0,  137,  137,  137,  137,  137,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  148,  148,    0,    0,
+    0,  148,  148,    0,    0,  148,  148,  148,  148,  148,
+  148,    0,  148,    0,    0,    0,  148,  148,  148,  148,
+    0,  148,    0,  137,  148,  137,  137,  137,    0,  137,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  148,    0,  148,  137,    0,  137,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  148,    0,    0,    0,    0,    0,  148,  148,    0,
+    0,  148,  148,  148,  148,  148,  137,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  757,    0,  761,  137,  757,
+  757,    0,  757,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  765,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    3,    0,    0,    0,    6,    9,
+   12,    0,   15,   18,   21,   24,   27,   30,  757,   33,
+   36,   39,    0,   42,   45,   48,    0,    0,    0,    0,
+   51,   54,    0,    0,    0,   57,    0,    0,    0,    0,
+    0,   60,    0,    0,    0,    0,    0,    0,    0,    0,
+  757,    0,  757,  245,  245,    0,    0,  245,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  245,    0,  245,    0,    0,    0,   66,   69,
+   72,   75,    0,    0,    0,    0,   78,   81,   84,   87,
+   90,   93,   96,   99,    0,    0,    0,    0,    0,    0,
+    0,    0,  137,  137,  245,    0,    0,  137,  137,    0,
+    0,  137,  137,  137,  137,  137,  137,    0,  137,    0,
+    0,    0,  137,  137,  137,  137,    0,  137,    0,  138,
+  137,    0,    0,    0,    0,    0,  245,  243,  243,    0,
+    0,  243,    0,    0,    0,    0,    0,  137,    0,  137,
+    0,    0,    0,    0,    0,    0,  243,    0,  243,    0,
+    0,    0,    0,    0,    0,    0,    0,  137,    0,    0,
+    0,    0,    0,    0,  137,    0,    0,  137,  137,  137,
+  137,  137,    0,    0,  757,  757,    0,    0,  243,  757,
+  757,    0,    0,  757,  757,  757,  757,  757,  757,    0,
+  757,    0,    0,    0,  757,  757,  757,  757,    0,  757,
+    0,  757,  757,    0,    0,    0,    0,  246,  246,    0,
+  243,  246,  757,    0,    0,    0,    0,    0,    0,    0,
+    0,  757,    0,    0,    0,    0,  246,    0,  246,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  757,  757,    0,    0,    0,    0,    0,    0,  757,
+  757,  757,  757,  757,    0,    0,    0,    0,  246,    0,
+  245,  245,    0,    0,    0,  245,  245,    0,    0,  245,
+  245,  245,  245,  245,  245,    0,  245,    0,    0,    0,
+  245,  245,  245,  245,    0,  245,    0,  245,  245,    0,
+  246,  244,  244,    0,    0,  244,    0,    0,  245,    0,
+    0,    0,    0,    0,    0,  245,    0,  245,    0,    0,
+  244,    0,  244,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  245,    0,    0,    0,  245,  245,  245,  245,
+    0,    0,  244,    0,  243,  243,    0,    0,    0,  243,
+  243,    0,    0,  243,  243,  243,  243,  243,  243,    0,
+  243,    0,    0,    0,  243,  243,  243,  243,    0,  243,
+    0,  243,  243,    0,  244,  249,  249,    0,    0,  249,
+    0,    0,  243,    0,    0,    0,    0,    0,    0,  243,
+    0,  243,    0,    0,  249,    0,  249,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  243,    0,    0,    0,
+  243,  243,  243,  243,  246,  246,  249,    0,    0,  246,
+  246,    0,    0,  246,  246,  246,  246,  246,  246,    0,
+  246,    0,    0,    0,  246,  246,  246,  246,    0,  246,
+    0,  246,  246,    0,    0,  293,  293,    0,  249,  293,
+    0,    0,  246,    0,    0,    0,    0,    0,    0,  246,
+    0,  246,    0,  293,  293,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  246,    0,    0,    0,
+  246,  246,  246,  246,    0,    0,  293,    0,  244,  244,
+    0,    0,    0,  244,  244,    0,    0,  244,  244,  244,
+  244,  244,  244,    0,  244,    0,    0,    0,  244,  244,
+  244,  244,    0,  244,    0,  244,  244,    0,  293,  295,
+  295,    0,    0,  295,    0,    0,  244,    0,    0,    0,
+    0,    0,    0,  244,    0,  244,    0,    0,  295,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  244,    0,    0,    0,  244,  244,  244,  244,    0,    0,
+    0,    0,  249,  249,    0,    0,    0,  249,  249,    0,
+    0,  249,  249,  249,  249,  249,  249,    0,  249,    0,
+    0,    0,  249,  249,  249,  249,    0,  249,    0,  249,
+  249,    0,  295,    0,    0,    0,    0,    0,    0,    0,
+  249,    0,    0,    0,    0,    0,    0,  249,    0,  249,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  249,    0,    0,    0,  249,  249,
+  249,  249,  293,  293,    0,    0,    0,  293,  293,    0,
+    0,  293,  293,  293,  293,  293,  293,    0,  293,    0,
+    0,    0,  293,  293,  293,  293,    0,  293,    0,  293,
+  293,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  293,    0,    0,    0,    0,    0,    0,  293,    0,  293,
+    0,    0,    0,    0,    0,    0,    0,    0,  115,  115,
+    0,    0,    0,  115,  115,  115,  115,  115,  115,    0,
+    0,    0,    0,    0,  293,    0,    0,    0,  293,  293,
+  115,    0,  115,    0,  115,    0,  295,  295,    0,    0,
+    0,    0,  295,    0,    0,  295,  295,  295,  295,  295,
+  295,    0,  295,    0,    0,    0,  295,  295,  295,  295,
+    0,  295,  115,  295,  295,  115,    0,  115,  115,    0,
+  115,    0,  115,  115,  295,  115,  115,  115,    0,    0,
+    0,  295,    0,  295,    0,    0,    0,    0,    0,    0,
+    0,  115,    0,  115,  115,  115,  115,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  295,    0,
+    0,    0,  295,  295,    0,    0,    0,    0,    0,    0,
+    0,  115,    0,  115,  115,  484,  486,    0,  489,  900,
+  482,  480,    0,  481,  493,  483,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  488,
+    0,  492,    0,  115,  115,    0,    0,    0,    0,    0,
+  484,  486,    0,  489,  932,  482,  480,    0,  481,  493,
+  483,    0,    0,    0,    0,    0,    0,    0,    0,  490,
+    0,    0,  485,    0,  488,    0,  492,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  487,    0,  490,  484,  486,  485,  489,    0,
+  482,  480,    0,  481,  493,  483,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  488,
+    0,  492,    0,    0,    0,    0,    0,  487,    0,    0,
+    0,    0,    0,    0,    0,  115,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  115,    0,    0,  490,
+    0,  945,  485,    0,    0,    0,  115,  115,  115,  115,
+  115,  115,  115,  115,  115,    0,  115,  115,  115,  115,
+  115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+  115,    0,  487,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  115,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  115,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  115,  115,  115,  115,  115,
+  115,  115,  115,  115,    0,  115,  115,  115,  115,  115,
+  115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+    0,    0,    0,    0,    0,    0,  484,  486,    0,  489,
+    0,  482,  480,    0,  481,  493,  483,    0,    0,    0,
+    0,    0,    0,  455,    0,    0,    0,    0,    0,    0,
+  488,    0,  492,  456,  457,  458,  459,  460,  461,  462,
+  463,  464,    0,  465,  466,  467,  468,  469,  470,  471,
+  472,  473,  474,  475,  476,  477,  478,  479,  455,    0,
+  490,    0,  951,  485,    0,    0,    0,    0,  456,  457,
+  458,  459,  460,  461,  462,  463,  464,    0,  465,  466,
+  467,  468,  469,  470,  471,  472,  473,  474,  475,  476,
+  477,  478,  479,  487,  484,  486,    0,  489,    0,  482,
+  480,    0,  481,  493,  483,    0,    0,    0,    0,    0,
+    0,    0,    0,  455,    0,  952,    0,    0,  488,    0,
+  492,    0,    0,  456,  457,  458,  459,  460,  461,  462,
+  463,  464,    0,  465,  466,  467,  468,  469,  470,  471,
+  472,  473,  474,  475,  476,  477,  478,  479,  490,  484,
+  486,  485,  489,    0,  482,  480,    0,  481,  493,  483,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,  488,    0,  492,    0,    0,    0,    0,
+    0,  487,    0,    0,  484,  486,    0,  489, 1011,  482,
+  480,    0,  481,  493,  483,    0,    0,    0,    0,    0,
+    0,    0,    0,  490,    0,  868,  485,    0,  488,    0,
+  492,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  487,    0,  490,    0,
+    0,  485,    0,    0,    0,    0,  484,  486,    0,  489,
+ 1017,  482,  480,    0,  481,  493,  483,    0,    0,    0,
+    0,    0,    0,    0,  455,    0,    0,    0,    0,    0,
+  488,  487,  492,    0,  456,  457,  458,  459,  460,  461,
+  462,  463,  464,    0,  465,  466,  467,  468,  469,  470,
+  471,  472,  473,  474,  475,  476,  477,  478,  479,    0,
+  490,  484,  486,  485,  489, 1121,  482,  480,    0,  481,
+  493,  483,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  488,    0,  492,    0,    0,
+    0,    0,    0,  487,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  455,    0,    0,  490,    0,    0,  485,    0,
+    0,    0,  456,  457,  458,  459,  460,  461,  462,  463,
+  464,    0,  465,  466,  467,  468,  469,  470,  471,  472,
+  473,  474,  475,  476,  477,  478,  479,    0,  487,    0,
+  484,  486,    0,  489,    0,  482,  480,    0,  481,  493,
+  483,    0,    0,    0,    0,    0,    0,  455,    0,    0,
+    0,    0,    0,    0,  488,    0,  492,  456,  457,  458,
+  459,  460,  461,  462,  463,  464,    0,  465,  466,  467,
+  468,  469,  470,  471,  472,  473,  474,  475,  476,  477,
+  478,  479,  455,    0,  490,    0, 1132,  485,    0,    0,
+    0,    0,  456,  457,  458,  459,  460,  461,  462,  463,
+  464,    0,  465,  466,  467,  468,  469,  470,  471,  472,
+  473,  474,  475,  476,  477,  478,  479,  487,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  455,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  456,  457,  458,  459,  460,  461,
+  462,  463,  464,    0,  465,  466,  467,  468,  469,  470,
+  471,  472,  473,  474,  475,  476,  477,  478,  479,    0,
+  484,  486,    0,  489, 1170,  482,  480,    0,  481,  493,
+  483,    0,    0,    0,    0,    0,    0,    0,    0,  455,
+    0,    0,    0,    0,  488,    0,  492,    0,    0,  456,
+  457,  458,  459,  460,  461,  462,  463,  464,    0,  465,
+  466,  467,  468,  469,  470,  471,  472,  473,  474,  475,
+  476,  477,  478,  479,  490,    0,    0,  485,  484,  486,
+    0,  489, 1171,  482,  480,    0,  481,  493,  483,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  488,    0,  492,    0,    0,  487,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  455,    0,
+    0,    0,  490,    0,    0,  485,    0,    0,  456,  457,
+  458,  459,  460,  461,  462,  463,  464,    0,  465,  466,
+  467,  468,  469,  470,  471,  472,  473,  474,  475,  476,
+  477,  478,  479,  484,  486,  487,  489, 1172,  482,  480,
+    0,  481,  493,  483,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  488,    0,  492,
+    0,    0,    0,    0,    0,    0,    0,    0,  484,  486,
+    0,  489, 1173,  482,  480,    0,  481,  493,  483,    0,
+    0,    0,    0,    0,    0,    0,    0,  490,    0,    0,
+  485,    0,  488,    0,  492,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+  487,    0,  490,    0,    0,  485,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  455,    0,
+    0,    0,    0,    0,    0,  487,    0,    0,  456,  457,
+  458,  459,  460,  461,  462,  463,  464,    0,  465,  466,
+  467,  468,  469,  470,  471,  472,  473,  474,  475,  476,
+  477,  478,  479,    0,    0,    0,    0,  484,  486,    0,
+  489,    0,  482,  480,    0,  481,  493,  483,    0,    0,
+    0,    0,    0,    0,    0,    0,  455,    0,    0,    0,
+    0,  488,    0,  492,    0,    0,  456,  457,  458,  459,
+  460,  461,  462,  463,  464,    0,  465,  466,  467,  468,
+  469,  470,  471,  472,  473,  474,  475,  476,  477,  478,
+  479,  490,    0, 1232,  485,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,  487,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  455,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  456,  457,  458,  459,  460,  461,  462,  463,  464,
+    0,  465,  466,  467,  468,  469,  470,  471,  472,  473,
+  474,  475,  476,  477,  478,  479,  455,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,  456,  457,  458,  459,
+  460,  461,  462,  463,  464,    0,  465,  466,  467,  468,
+  469,  470,  471,  472,  473,  474,  475,  476,  477,  478,
+  479,  484,  486,    0,  489,    0,  482,  480,    0,  481,
+  493,  483,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0, 1237,    0,    0,  488,    0,  492,    0,    0,
+    0,    0,    0,    0,    0,    0, 1371, 1377,    0, 1389,
+    0, 1365, 1359, 1386, 1362, 1398, 1368,    0,    0,    0,
+    0,    0,    0,    0,    0,  490,    0,    0,  485,    0,
+ 1383,    0, 1395,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  455,    0,    0,  487,    0,
+ 1392,    0,    0, 1374,    0,  456,  457,  458,  459,  460,
+  461,  462,  463,  464,    0,  465,  466,  467,  468,  469,
+  470,  471,  472,  473,  474,  475,  476,  477,  478,  479,
+    0,  484,  486, 1380,  489,    0,  482,  480,    0,  481,
+  493,  483,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,  488,    0,  492,    0,    0,
+    0,    0,    0,    0,    0,    0, 2846, 2852,    0, 2861,
+    0, 2840, 2834,    0, 2837, 2870, 2843,    0,    0,    0,
+    0,    0,    0,    0,    0,  490,    0,    0,  485,    0,
+ 2858,    0, 2867,    0,    0,    0,    0,    0,    0,    0,
+    0, 2960, 2960,    0, 2972,    0, 2960, 2960,    0, 2960,
+    0, 2960,    0,    0,    0,    0,    0,    0,  487,    0,
+ 2864,    0,    0, 2849,    0, 2960,    0, 2960,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0, 2855,    0, 2976,    0, 2960, 2960,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  455,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  456,
+  457,  458,  459,  460,  461,  462,  463,  464, 2960,  465,
+  466,  467,  468,  469,  470,  471,  472,  473,  474,  475,
+  476,  477,  478,  479, 1284,    0,    0,    0,    0,    0,
+    0,    0,    0,    0, 1287, 1290, 1293, 1296, 1299, 1302,
+ 1305, 1308, 1311,    0, 1314, 1317, 1320, 1323, 1326, 1329,
+ 1332, 1335, 1338, 1341, 1344, 1347, 1350, 1353, 1356, 2983,
+ 2983,    0, 2995,    0, 2983, 2983,    0, 2983,    0, 2983,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0, 2983,    0, 2983,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  455,
+    0,    0,    0, 2999,    0, 2983, 2983,    0,    0,  456,
+  457,  458,  459,  460,  461,  462,  463,  464,    0,  465,
+  466,  467,  468,  469,  470,  471,  472,  473,  474,  475,
+  476,  477,  478,  479, 2759,    0, 2983,    0,    0,    0,
+    0,    0,    0,    0, 2762, 2765, 2768, 2771, 2774, 2777,
+ 2780, 2783, 2786,    0, 2789, 2792, 2795, 2798, 2801, 2804,
+ 2807, 2810, 2813, 2816, 2819, 2822, 2825, 2828, 2831, 2957,
+    0,    0,    0,    0,    0,    0,    0,    0,    0, 2960,
+ 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960,    0, 2960,
+ 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2964, 2968,
+    0, 2960, 2960, 2960, 3006, 3006,    0, 3018,    0, 3006,
+ 3006,    0, 3006,    0, 3006,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0, 3006,    0,
+ 3006,    0,    0,    0,    0,    0,    0,    0,    0,  484,
+  486,    0,  489,    0,  482,  480,    0,  481,  493,  483,
+    0,    0,    0,    0,    0,    0,    0,    0, 3022,    0,
+ 3006, 3006,    0,  488,    0,  492,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,  484,
+  486, 3006,  489,  490,  482,  480,  485,  481,  493,  483,
+    0,    0,    0,    0,    0,    0,    0, 2980,    0,    0,
+    0,    0,    0,  488,    0,  492,    0, 2983, 2983, 2983,
+ 2983, 2983, 2983, 2983, 2983, 2983,  487, 2983, 2983, 2983,
+ 2983, 2983, 2983, 2983, 2983, 2983, 2987, 2991,    0, 2983,
+ 2983, 2983,    0,  490,  484,  486,  485,  489,    0,  482,
+  480,    0,  481,  493,  483,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  488,    0,
+  492,    0,    0,    0,    0,    0,  487,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,  490,    0,
+    0,  485,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  487,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0, 3003,    0,    0,    0,    0,    0,    0,    0,
+  123,    0, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006,
+ 3006,    0, 3006, 3006, 3006, 3006, 3006, 3006, 3006, 3006,
+ 3006, 3010, 3014,    0, 3006, 3006, 3006,  455,    0,    0,
+  440,    0,    0,    0,    0,    0,    0,  456,  457,  458,
+  459,  460,  461,  462,  463,  464,    0,  465,  466,  467,
+  916,  469,  470,  471,  472,  473,  474,  475,  476,  477,
+  478,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  455,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,  456,  457,  458,
+  459,  460,  461,  462,  463,  464,    0,  465,  466,  467,
+  468,  469,  470,  471,  472,  473,  474,  475,  476,  477,
+  478,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   63,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  455,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  456,  457,  458,  459,  460,  461,  462,  463,
+  464,  905,  465,  466,  467, 1130,  469,  470,  471,  472,
+  473,  474,  475,  476,  477,  478,    0,    3,    0,    0,
+    0,    6,    9,  108,    0,   15,   18,   21,   24,  111,
+  114,    0,   33,   36,   39,    0,   42,   45,   48,    0,
+    0,    0,    0,  117,   54,    0,  356,  360,  120,    0,
+    0,  364,  368,  372,   60,  376,  380,  384,  388,  392,
+  396,    0,  400,  404,  408,    0,  412,  416,  420,    0,
+    0,    0,    0,  424,  428,    0,    0,    0,  432,    0,
+    0,    0,    0,    0,  436,    0,    0,    0,    0,    0,
+    0,   66,  126,   72,   75, 1020,    0,    0,    0,   78,
+   81,   84,   87,   90,  129,   96,   99,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,  444,  448,  452,  456, 1061,    0,    0,    0,  460,
+  464,  468,  472,  476,  480,  484,  488,    0,    3,    0,
+    0,    0,    6,    9,   12,    0,   15,   18,   21,   24,
+   27,   30,    0,   33,   36,   39,    0,   42,   45,   48,
+    0,    0,    0,    0,   51,   54,    0,  821,  825,   57,
+    0,    0,  829,  833,  837,   60,  841,  845,  849,  853,
+  857,  861,    0,  865,  869,  873,    0,  877,  881,  885,
+    0,    0,    0,    0,  889,  893,    0,    0,    0,  897,
+    0,    0,    0,    0,    0,  901,    0,    0,    0,    0,
+    0,    0,   66,   69,   72,   75, 1020,    0,    0,    0,
+   78,   81,   84,   87,   90,   93,   96,   99,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,  909,  913,  917,  921,   63,    0,    0,    0,
+  925,  929,  933,  937,  941,  945,  949,  953,    0,    0,
+    0,  957,  960,    0,    0,    0,  963,  966,  969,    0,
+  972,  975,  978,  981,  984,  987,    0,  990,  993,  996,
+    0,  999, 1002, 1005,    0,    0,    0,    0, 1008, 1011,
+    0, 1061, 1061, 1014,    0,    0, 1061, 1061, 1061, 1017,
+ 1061, 1061, 1061, 1061, 1061, 1061,    0, 1061, 1061, 1061,
+    0, 1061, 1061, 1061,    0,    0,    0,    0, 1061, 1061,
+    0,    0,    0, 1061,    0,    0,    0,    0,    0, 1061,
+    0,    0,    0,    0,    0,    0, 1023, 1026, 1029, 1032,
+   63,    0,    0,    0, 1035, 1038, 1041, 1044, 1047, 1050,
+ 1053, 1056,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0, 1061, 1061, 1061, 1061,
+ 1754,    0,    0,    0, 1061, 1061, 1061, 1061, 1061, 1061,
+ 1061, 1061,  957,  960,    0,    0,    0,  963,  966,  969,
+    0,  972,  975,  978,  981,  984, 1089,    0,  990,  993,
+  996,    0,  999, 1002, 1005,    0,    0,    0,    0, 1008,
+ 1011,    0,    0,    3, 1014,    0,    0,    6,    9,   12,
+ 1017,   15,   18,   21,   24,   27,   30,    0,   33,   36,
+   39,    0,   42,   45,   48,    0,    0,    0,    0,   51,
+   54,    0,    0,    0,   57,    0,    0,    0,    0,    0,
+   60,    0,    0,    0,    0,    0,    0, 1023, 1092, 1029,
+ 1032,  440,    0,    0,    0, 1035, 1038, 1041, 1044, 1047,
+ 1050, 1053, 1056,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   66,   69,   72,
+   75,   63,    0,    0,    0,   78,   81,   84,   87,   90,
+   93,   96,   99,    0,    0,    0,    0,    3,    0,    0,
+    0,    6,    9,  108,    0,   15,   18,   21,   24, 1464,
+  114,    0,   33,   36,   39,    0,   42,   45,   48,    0,
+    0,    0,    0,   51,   54,    0, 1691, 1694,  120,    0,
+    0, 1697, 1700, 1703,   60, 1706, 1709, 1712, 1715, 1718,
+ 1721,    0, 1724, 1727, 1730,    0, 1733, 1736, 1739,    0,
+    0,    0,    0, 1742, 1745,    0,    0,    0, 1748,    0,
+    0,    0,    0,    0, 1751,    0,    0,    0,    0,    0,
+    0,   66, 1467,   72,   75,  440,    0,    0,    0,   78,
+   81,   84,   87,   90,  129,   96,   99,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0, 1757, 1760, 1763, 1766,   63,    0,    0,    0, 1769,
+ 1772, 1775, 1778, 1781, 1784, 1787, 1790,  356,  360,    0,
+    0,    0,  364,  368,  372,    0,  376,  380,  384,  388,
+  392,  396,    0,  400,  404,  408,    0,  412,  416,  420,
+    0,    0,    0,    0,  424,  428,    0,    0,    3,  432,
+    0,    0,    6,    9,   12,  436,   15,   18,   21,   24,
+   27,   30,    0,   33,   36,   39,    0,   42,   45,   48,
+    0,    0,    0,    0,   51,   54,    0,    0,    0,   57,
+    0,    0,    0,    0,    0,   60,    0,    0,    0,    0,
+    0,    0,  444, 1820,  452,  456,   63,    0,    0,    0,
+  460,  464,  468,  472,  476,  480,  484,  488,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   66,   69,   72,   75,   63,    0,    0,    0,
+   78,   81,   84,   87,   90,   93,   96,   99,    0,    0,
+    0,  356,  360,    0,    0,    0,  364,  368,  372,    0,
+  376,  380,  384,  388,  392, 1917,    0,  400,  404,  408,
+    0,  412,  416,  420,    0,    0,    0,    0,  424,  428,
+    0,    0,    3,  432,    0,    0,    6,    9,   12,  436,
+   15,   18,   21,   24,   27,   30,    0,   33,   36,   39,
+    0,   42,   45,   48,    0,    0,    0,    0,   51,   54,
+    0,    0,    0,   57,    0,    0,    0,    0,    0,   60,
+    0,    0,    0,    0,    0,    0,  444, 1921,  452,  456,
+   63,    0,    0,    0,  460,  464,  468,  472,  476,  480,
+  484,  488,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,   66,   69,   72,   75,
+   63,    0,    0,    0,   78,   81,   84,   87,   90,   93,
+   96,   99,    0,    3,    0,    0,    0,    6,    9,   12,
+    0,   15,   18,   21,   24,   27,   30,    0,   33,   36,
+   39,    0,   42,   45,   48,    0,    0,    0,    0,   51,
+   54,    0,    0,    3,   57,    0,    0,    6,    9,   12,
+   60,   15,   18,   21,   24,   27,   30,    0,   33,   36,
+   39,    0,   42,   45,   48,    0,    0,    0,    0,   51,
+   54,    0,    0,    0,   57,    0,    0,    0,    0,    0,
+   60,    0,    0,    0,    0,    0,    0,   66,   69,   72,
+   75,   63,    0,    0,    0,   78,   81,   84,   87,   90,
+   93,   96,   99,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   66,   69,   72,
+   75,   63,    0,    0,    0,   78,   81,   84,   87,   90,
+   93,   96,   99,    0,    0,    0,    0,    3,    0,    0,
+    0,    6,    9,   12,    0,   15,   18,   21,   24,   27,
+   30,    0,   33,   36,   39,    0,   42,   45,   48,    0,
+    0,    0,    0,   51,   54,    0,    0,    3,   57,    0,
+    0,    6,    9,   12,   60,   15,   18,   21,   24,   27,
+   30,    0,   33,   36,   39,    0,   42,   45,   48,    0,
+    0,    0,    0,   51,   54,    0,    0,    0,   57,    0,
+    0,    0,    0,    0,   60,    0,    0,    0,    0,    0,
+    0,   66,   69,   72,   75,   63,    0,    0,    0,   78,
+   81,   84,   87,   90,   93,   96,   99,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,   66,   69,   72,   75,   63,    0,    0,    0,   78,
+   81,   84,   87,   90,   93,   96,   99,    0,    3,    0,
+    0,    0,    6,    9,   12,    0,   15,   18,   21,   24,
+   27,   30,    0,   33,   36,   39,    0,   42,   45,   48,
+    0,    0,    0,    0,   51,   54,    0,    0,    3,   57,
+    0,    0,    6,    9,   12,   60,   15,   18,   21,   24,
+   27,   30,    0,   33,   36,   39,    0,   42,   45,   48,
+    0,    0,    0,    0,   51,   54,    0,    0,    0,   57,
+    0,    0,    0,    0,    0,   60,    0,    0,    0,    0,
+    0,    0,   66,   69,   72,   75,   63,    0,    0,    0,
+   78,   81,   84,   87,   90,   93,   96,   99,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,   66,   69,   72,   75,   63,    0,    0,    0,
+   78,   81,   84,   87,   90,   93,   96,   99,    0,    0,
+    0,    0,    3,    0,    0,    0,    6,    9,   12,    0,
+   15,   18,   21,   24,   27,   30,    0,   33,   36,   39,
+    0,   42,   45,   48,    0,    0,    0,    0,   51,   54,
+    0,    0,    3,   57,    0,    0,    6,    9,   12,   60,
+   15,   18,   21,   24,   27,   30,    0,   33,   36,   39,
+    0,   42,   45,   48,    0,    0,    0,    0,   51,   54,
+    0,    0,    0,   57,    0,    0,    0,    0,    0,   60,
+    0,    0,    0,    0,    0,    0,   66,   69,   72,   75,
+    0,    0,    0,    0,   78,   81,   84,   87,   90,   93,
+   96,   99,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,   66,   69,   72,   75,
+    0,    0,    0,    0,   78,   81,   84,   87,   90,   93,
+   96,   99,    0,    3,    0,    0,    0,    6,    9,   12,
+    0,   15,   18,   21,   24,   27,   30,    0,   33,   36,
+   39,    0,   42,   45,   48,    0,    0,    0,    0,   51,
+   54,    0,    0,    3,   57,    0,    0,    6,    9,   12,
+   60,   15,   18,   21,   24,   27,   30,    0,   33,   36,
+   39,    0,   42,   45,   48,    0,    0,    0,    0,   51,
+   54,    0,    0,    0,   57,    0,    0,    0,    0,    0,
+   60,    0,    0,    0,    0,    0,    0,   66,   69,   72,
+   75,    0,    0,    0,    0,   78,   81,   84,   87,   90,
+   93,   96,   99,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,   66,   69,   72,
+   75,    0,    0,    0,    0,   78,   81,   84,   87,   90,
+   93,   96,   99,
+};
+static int yycheck[] = {                                      70,
+    0,  138,   15,   90,  581,  612,  551,  123,    8,    9,
+   76,  115,   40,  115,   14,   15,   16,  514,   18,   19,
+   20,   21,  132,  110,  143,   25,   46,   44,  138,  126,
+   45,  149,   61,   44,   40,   44,   36,  108,   41,    8,
+  704,   40,  146,   76,  146,    0,   20,  126,   15,   73,
+   14,   51,   16,   17,  830,   42,  832,   72,   73,    0,
+   40,   41,  263,   63,   44,   44,  126,  126,  187,   59,
+   70,   25,   44,   73,   58,   61,   76,  328,  144,  145,
+   80,   61,  115,   44,   40,    0,   38,   59,   42,   42,
+   42,  261,  415,  180,   94,  331,  123,  184,   58,   44,
+   61,   76,   40,   40,  263,   44,  284,   91,  108,   58,
+   59,   91,   61,  146,   41,  115,  257,  258,   44,   76,
+  331,  262,   61,   40,   41,   61,   61,   94,   44,  365,
+   40,  332,   59,   44,   41,   61,  277,   44,   38,   44,
+  115,    8,   40,  143,  144,  145,  146,  147,   38,  149,
+  328,   61,   42,   38,  365,  126,   40,   42,  115,   41,
+   40,  331,  525,  123,  280,   41,  282,  167,   41,  169,
+   40,  146,   40,   61,  174,  334,  145,  177,  257,  143,
+  125,  181,   61,   59,   51,  185,   59,    0,  188,  146,
+  190,  191,  192,  206,  335,  365,  196,  338,  257,   44,
+  563,  977,  202,  167,  204,  205,  206,  304,  984,  125,
+  125,   61,  212,  123,  214,  239,   44,  327,  192,   42,
+  125,   38,   44,  187,  239,   42,   40,   41,   44,  229,
+  257,  195,  232,  233,  234,  235,  373,  560,   44,  206,
+  833,   41,   59,   44,  304,  245,  257,  258,  115,   44,
+  204,  262,  263,   40,  257,  258,  920,   70,  328,  262,
+   73,  371,   44,  373,   77,   38,  277,  295,   44,   42,
+  257,  258,  817,  302,  277,  262,   44,  144,  284,  303,
+  147,  245,  262,   44,   40,   44,   46,  287,  303,  295,
+  277,  291,  292,  328,  284,  108,  295,   58,  843,  844,
+   61,  329,  317,  880,  257,  295,  326,   44,   59,  375,
+   40,   41,  329,  450,   44,   44,  302, 1093,  185,   38,
+  329,  188,  322,   42,  335,  325,  263,   44,  328,  353,
+  329,   61,  335,  304,  334,  359,  833,  447,  338,  295,
+  450,   40,   41,  376,  359,  286,  287,  288,  335,  453,
+  329,  453,   27,  302,  308,  335,  336,  295,   33,  446,
+   38,   91,  123,  263,   42,  365,  302,  302,  329,  369,
+  322,  286,  287,  288,  338,  375,  376,  213,  295,  215,
+  380,  263,   61,  383,  353,  385,  284, 1163,   93,  934,
+  329,  329,  937,  986,  369,  988,  989,  295,    0,  348,
+  413,  376,  415,  329,  541,  420,  525,  440,  125,  527,
+  955,  295,  369,  413,  302,  415,  229,   38,  329,  376,
+  453,   42,  304,  302,  495,  295,  380,  295,  538, 1036,
+  328,  541,  322,  537,  328,  537,   44,  322,  438,  439,
+  440,  116,  332,  328,  563,  329,  413,  332,  415,  364,
+  365,  333,  302,  453,  336,   51,  261,  132,  325,  259,
+  348,  284, 1039,  138,  530,  440,  141,   40,   70,  348,
+   37,   73,  295, 1050,   76,   42,  476,  477,  453,   46,
+   47,  295,  318,  440,  329,  352,  353,  354,   40,  986,
+   41,  988,  989,  493, 1087,  495,  453, 1090,  348,   38,
+   40,  329,  369,   42,  537,  322,  108,  329,  295,  476,
+  477, 1088,   58,  329,  514,  332,  383,  125,   91,  280,
+   59,  282,  295,  329,   93,  525,  493,   44,  329,  529,
+  530,  531,  262,  284,  329,   40,  536,  537, 1083,  295,
+  257,  302,  144,  145,  295,  262,  683,  329,   59,  322,
+    0,  147,  257,  329,  126,  328,  231,  557,  394,  332,
+  560,  329,  537,  280,   40,  282,  326,  327,  568,  536,
+  329,  123, 1165,  683,  574,  259,  257,  328,  578,  579,
+  537,  581,  582,  262,  284,  549,  550,  348,  588,  589,
+ 1087,  427,  329, 1090,  259, 1140,  295,   44,   40,  329,
+  329,   42,  280,  322,  282,  335,  336,  291,  125, 1186,
+   44,   58,  123,  332,   61,  630,  123, 1210, 1195, 1196,
+   70,  338,  709,   73,  578,   33,  291,  229,  328,   40,
+   38,   59,  349,   40,   42,   43,  660,   45,   38,  332,
+  640,  641,   42,  643,  322,   44,   59, 1224, 1240,  257,
+   40,   40,   40, 1230,  262,  348,  335,  336,  108,  280,
+ 1205,  282,  529,  257, 1256,  115,   59,   40, 1165,  263,
+ 1247,  915,  280,  640,  282,  629,  123,  677,  678,   44,
+  680,  681,  495, 1260,  928,  257,   63,  687,  257,   59,
+   40,  125,  692,   44,   59,   61,   44,   58,   40,  699,
+   40,  322,   58,  678,  704,  680,  681,  123,  259,  709,
+  546,  332,  258, 1210,  581,   58,  262,  263,  126,   58,
+   61,  678,  295,  680,  681,  725,  125,  273,  692,   61,
+  338,  277,  284,   40,    0,  185,   44,  824,  115,   44,
+  257,  349,  742,  295,  284,  262,   40,  583,   91,  585,
+  257,  324,  325,  123,   59,  295,  352,  353,  354,  326,
+  327,  761,  123,  280,   38,  282,   40,  123,   42,  280,
+   40,  282,  125,  375,  125,  450,  328,  125,   58,  229,
+  780,  781,   38,  322,   91,  785,   42,  383,   59,  335,
+  295,  302,  792,  332,  761,   44,   44,   63, 1042,  812,
+  800,   58,   40,   40,   70,   41,  806,   73,   44,   40,
+   59,   91,  812,  780,  781,  326,  257,  125,  889,  890,
+   42,  338,  263,  257,   61,   59,  897,  898,  262,  829,
+   61,  831,  349,  280,   91,  282,  836,  704,   59,  289,
+  515,  841,  108,  843,  844,  812,  280,  811,  282,  115,
+  263,  270,  263,  295,   91,  302,  284,  257,  257,  823,
+   44,   40,  999,  262,  969,  970,  541,  295,  257,  258,
+  894,  895,  896,  262,  301,  325,  284,   59,  259,  843,
+  880,  280,  295,  282,  295,  123,  841,  263,  277,  889,
+  890,  284,   40,  495,  302,  303,  262,  897,  898,  125,
+  328,  348,  295,  903,  338,   40,  257,  295,   91,  257,
+  280,  262,  282,   61,  262,  349,    0,  257,   61,  369,
+  920,  263,  330,  331,    8,   91,  125,   93,  530,  280,
+   61,  282,  280,  529,  282,    0,  302,  284,   38,  338,
+   40,  123,   42,   91,  959,  960,  335,  336,  295,  257,
+  349,  123,   36,  295,  262,  295,   91,  334,  366,   58,
+  337,   45,  332,  229,   48,   40,  332,   51,  295,  335,
+  336,   40,  280,  973,  282,   61, 1081,  813,  814,   63,
+   40,  328,  348,  983,  947,  581,   70,  338,  295,   73,
+  338,  332,   76,  326,  335,  336,   80,  123,  349,   41,
+  332,  349,   44,  335,  336,   70,  123,  348,   73, 1009,
+  284,  364,  365,  880,  284,   40,  348,  324,  325,   40,
+  833,  295,   91, 1023,  108,  295,  257,  280,  841,  282,
+  338,  115,  280,   41,  282,  257,  258,   59,   41, 1039,
+  262,  349,  280,  108,  282,  495, 1117,   93,  322, 1064,
+ 1050,   42,  272,  920,  328,  277,  332,  295, 1058,  143,
+  144,  145,  146,  147,  295,  149,  272,  165,  334,   38,
+ 1070,  337,   41,   42,   42,   59,  889,  890, 1078, 1079,
+  284,  280, 1192,  282,  897,  898,  272,  537, 1088,   44,
+  174,  295,   44,  177, 1118, 1119, 1120,   59,  280, 1099,
+  282,  185, 1102,  361,  188,  284,  190,   59,  704,  257,
+  258,    0,  196,  335,  262,  263,  295, 1117,  568,    8,
+  302,  205, 1085, 1086,   38,   59,   40,   37,   42,  277,
+ 1240,  262,   42,   43,   40,   45,   46,   47,  364,  365,
+   59, 1212, 1213, 1214,  326,  229, 1256,  295,  232,  233,
+  234,  235, 1152, 1153, 1154,   61, 1156,  284,  284,  243,
+  295,  123,  332,  263,  229,  364,  365,   40,  295,  295,
+  125,  302, 1039,  986,   40,  988,  989,   40,  328,   44,
+  280,   70,  282, 1050,   73,   91, 1186,  335,  336,  324,
+  325,  641,   40,   91,   59, 1195, 1196,   58,   59, 1154,
+   44,  332,    0,  287,  335,  336,  881,  291,  292,  284,
+    8,   58, 1212, 1213, 1214,   59, 1216,  348,   91,  108,
+  295, 1088,  322,  284, 1224,   91,  295,   58,   91,  495,
+ 1230,  681,  332,  317,  295,  284,   58, 1237,  322,  841,
+   59,  325,  340,  341,  328,  261,  295, 1247, 1248,   40,
+  334,  123,   91,   51,  338,  324,  325,  280,  125,  282,
+ 1260, 1216,  284,   40,   44,   63,  257,  258,  352,  353,
+  354,  262,   70,  295, 1087,   73,   40, 1090,   76,  328,
+  378,  365, 1237,   58,  880,  369,  277,  889,  890,  257,
+  258,  375,  376, 1248,  262,  897,  898,   44,  382,  383,
+  284,  385,  257,  123, 1117,  334,  328,  262,   59,  277,
+  108,  295,   93,  397,   91,  284,  400,  115,  280, 1186,
+  282,  968,  384,  970,  920,  280,  295,  282, 1195, 1196,
+  286,  287,  288,   40,    0,  123,  420,   40,  326,  401,
+  229, 1154,    8,  257,  335,  125,  144,  145,  146,  147,
+  284,   59, 1165,  322,   93,  439,  440, 1224,   93,  257,
+  258,  295,  424, 1230,  262,  284,  280,  335,  282,  453,
+  284,  280,  123,  282,  328,  284,  295,   44,   58,  277,
+ 1247,  295,  284,  338,   91,   51,  295,  185,   91,   41,
+  188,  841,   44, 1260,  349,   58,   59, 1210,   61, 1212,
+ 1213, 1214,  284, 1216,   70,  262,  263,   73,  322,  328,
+   76,  495,  284,  295,  328,  123,  326,  327,  332,  286,
+  287,  288,  295,  295, 1237, 1085, 1086,  489,   91,  295,
+  495,  229,  295, 1080,  272, 1248,   40,  335,   44,  889,
+  890, 1116,  108, 1039,   40,  529,  530,  897,  898,  115,
+   41,  324,  325,  537, 1050,   40,  123,   59,  324,  325,
+  123,  324,  325,   44,  284,  284,  257,  258,  257,   59,
+ 1145,  262,  263,  262,   40,  295,  295,  257,  144,  145,
+   44,  147,  262,   40,  568,   41,  277,   91,  284,   40,
+  574,  280, 1088,  282,   58,  579,  284,  581,  582,  295,
+  280,  280,  282,  282,  295,  589,  123,  295,  174,  328,
+   41,    0,  125,   44,  598, 1117, 1191,  123,  295,  185,
+   40,  261,  188,   59,  322,   91,  280,  325,  282,  280,
+  328,  282,  328,   41,   91,   41,  334,   44,   44,  337,
+  328,   51, 1222,   41,  335,  336,  630,  324,  325,  338,
+  125,   58, 1154,   40,  352,  353,  354,  641,  338,  123,
+  349,   41,  125,  229, 1239,  125,   76, 1242,  630,  349,
+   41,  369,  280, 1253,  282,  841,   41,  375,  376,   44,
+ 1255,   70,  125, 1263,   73,  383, 1261,  123,  295,  123,
+ 1186,   41,  295, 1268,  678,   41,  680,  681,   44, 1195,
+ 1196,   40,   58,  687,   91,  115,  495,   59,  692,   61,
+ 1212, 1213, 1214,  280, 1216,  282,  123,  324,  325,  108,
+  704,  324,  325,  889,  890,  709,  284,   59, 1224,   41,
+   41,  897,  898,   44, 1230, 1237,  146,  295,  123,   40,
+   41,  439,  440,   44,   61,   40, 1248,   58,   59,   41,
+   41, 1247,   91,   44,   44,  453,  322,   40,   59,  325,
+   61,   40,   40,  280, 1260,  282,   40, 1117,   58,   44,
+  328,  123,  257,  258,  280,   44,  282,  262,  263,   41,
+   91,   44,   44,   58,   59,   40,  352,  353,  354,   58,
+   91,  295,  277,  257,  258,   58,   59,  495,  262,   41,
+  589,  785,   44,  369, 1154,   40,   93,  123,   91,  375,
+  295,   41,  123,  277,   44,   59,  280,  383,  282,   40,
+  324,  325,  123,  286,  287,  288,  286,  287,  288,  295,
+   40,  529,  530,  123,    0,  284,   91,   40,  295,  537,
+  229,   41,    8,   41,  280,  829,  282,  831,  123,  342,
+  335,  336,  836,   59,  123,   61,   91,  841,  324,  325,
+   40,   40, 1212, 1213, 1214,  123, 1216,  324,  325,   61,
+   59,  335,   37,  280,  440,  282,  841,   42,   43,  123,
+   45,   46,   47,  581,   37,   51,   61, 1237,   91,   42,
+   43,   61,   45,   46,   47,  280,  880,  282, 1248,   61,
+  123,  364,  365,   59,   70,  889,  890,   73,  295,   59,
+   76,  284,  322,  897,  898,  325,  284,  123,  328,  903,
+   58,   40,  295,   40,  889,  890,  125,  295,  280,  495,
+  282,  915,  897,  898,  123,   59,  920,  324,  325,   41,
+   41,  326,  108,  641,  928,   41,   41,   58,   44,  115,
+  302, 1117,   41,   41,  332,  328,  295,  335,  336,  369,
+  328,   41,  263,  529,  530,  284,  376,  257,  258,  280,
+  348,  282,  262,   59,   91,   61,  295,  125,  144,  145,
+  678,  147,  680,  681,  125,  324,  325,  277, 1154,   41,
+  280,  302,  282,   38,  262,   40,   40,   42,   59,  983,
+   61,  302,   40,  304,   40,  280,  704,  282,   41,  328,
+   40,  280,  295,  282,   40,  581,   41,  336,  329,  185,
+   44,   41,  188,  589,   61, 1009,   41,   41,  329,  439,
+  440,   44,  333,  284,   58,  336,  280,  123,  282, 1023,
+  295,  324,  325,  453,  295,  335, 1212, 1213, 1214,   58,
+ 1216,   40,  841,   91,   40, 1039,  262,  280, 1042,  282,
+  295,   38,  123,  229,  332,   42, 1050,  335,  336,  324,
+  325, 1237,   41,  262,  280,   44,  282,  328,  302,   44,
+  348,  280, 1248,  282,   58,   59,  123,   61,   41,  324,
+  325,  280,  295,  282, 1078, 1079,  302,  125,  125,  123,
+  889,  890,  123,  326, 1088,   91,  495,   40,  897,  898,
+  123,   41,  678,  302,   44, 1099,   41,   91, 1102,   44,
+  258,  324,  325,   41,  262,  263,  332,  537,   41,  335,
+  336,   44,  257, 1117,  259,  273,  261,   58,  704,  277,
+  284,   41,  348,  841,   44,  286,  287,  288,  313,  123,
+   40,  295, 1117,   40,  319,  320,  321,   40,  123,  325,
+  313,  326,  327,  328,  329,  364,  365,    8, 1152, 1153,
+ 1154,   37,   41,  326,  327,   44,   42,   43,  295,   45,
+   46,   47,  880,   40,  328,   40,  352,  353,  354, 1154,
+   41,  889,  890,   44,  280,   36,  282,  335,  125,  897,
+  898,   91, 1186,  369,   45,   41,   41,  324,  325,  375,
+   41, 1195, 1196,   44,   40,  397,  302,  383,  400,  280,
+ 1009,  282,  920,   93,  123,  262,  123,    0, 1212, 1213,
+ 1214,  641, 1216,  123,   91,  280,   91,  282,   59,  284,
+ 1224,  302,   44,  280,   59,  282, 1230, 1212, 1213, 1214,
+  295, 1216,  280, 1237,  282,   44,  280,  295,  282,  286,
+  287,  288,   59, 1247, 1248,  302,  328,  280,  678,  282,
+  680,  681, 1237,  123,   93,  841, 1260,  322,   59,   93,
+  257,  258,   59, 1248,   41,  262,  324,  325,  125,  266,
+  267,  268,  269,  270,  271,  332,  273,   40,  335,  336,
+  277,  278,  279,  144,  145,  146,  147,  284,  285,  295,
+  257,  348,  125,   59,  880,  280,  257,  282,  295,   59,
+   59,  123,   41,  889,  890,   40,  123,   44, 1117,  495,
+  123,  897,  898,  174,  123,   41,  364,  365,  324,  325,
+  284, 1039,   44,   44,  185,  322,  123,  188,   91,  190,
+   41,  295, 1050,   40,  920,  332,  125,  334,  335,  286,
+  287,  288,  257,  529,  530, 1154,   40,  257,  258,  259,
+  260,  261,  262,   59,  259,  257,  266,  267,  268,  269,
+  270,  271,   41,  273,  328,   44,  328,  277,  278,  279,
+ 1088,  232,  233,  234,  235,  285,  357,   59,   40,   58,
+   59,   59,  243,   61,   91,  295,  296,  297,  298,  299,
+  286,  287,  288,   59,  304,  581,   44,  257,   91, 1117,
+  295,  123,  284, 1212, 1213, 1214,   91, 1216,  284,  257,
+   58,   59,   91,  295,  324,  325,   91,  123,  295,  295,
+  295,   40,   40, 1009,  334,  335,  336,  313, 1237,  339,
+  291,  292,  841,  319,  320,  321, 1154,   44,   93, 1248,
+  326,  327,  328,  329,  123,  123,  328,  324,  325,  324,
+  325,  295,  328, 1039,   40,  280,  317,  282,  280,  284,
+  282,  322,   44,  280, 1050,  282,  332,  328, 1186,   40,
+  295,  280,   61,  282,  259,  123,   40, 1195, 1196,  259,
+  889,  890,  280,  280,  282,  282,   40,   40,  897,  898,
+   42,  352,  353,  354, 1212, 1213, 1214,   40, 1216,  273,
+  274,  275, 1088,  277,  365,   91, 1224,   41,   40,  332,
+   44,  332, 1230,   40,  375,  376,  295,  123,  704, 1237,
+   91,  382,  383,   41,   58,   59,   44,   91,   40, 1247,
+ 1248, 1117,  295,   42,  123,   42,  397,   91,    0,  400,
+   58,   59, 1260,    5,   93,   37,   40,    9,   93,  259,
+   42,   43,   14,   45,   46,   47,   59,   19,  280,   91,
+  282,  324,  325,   40,   91,   41,  364,  365, 1154,  259,
+  284,  345,  329,   91,  280,  295,  282,  329,  439,  440,
+   59,   43,   42,  123,  262,   40,  257,  258,  295,  123,
+   59,  262,  453,   41,   93,   57,   61,   91,   44,   42,
+ 1186,  280,  280,  282,  282,  123,  277,   61,   70, 1195,
+ 1196,   73,   40,   41,   91,   26,   44,  324,  325,  115,
+  123,   44,   41,  302,  302,   44, 1212, 1213, 1214,  329,
+ 1216,   59,  280,   61,  282,   58,   59,  635, 1224,  989,
+   59,   40,   61, 1122, 1230,   40,  108, 1009,   40,  236,
+  329, 1237,  568,  115,  332,  841, 1077,  335,  336,   40,
+  800, 1247, 1248,  280,  335,  282,   61,  284,  529,  530,
+  348, 1149,   91,  262, 1260,   -1,  537,   -1,  295,    0,
+   37,  286,  287,  288,  146,   42,   43,    8,   45,   46,
+   47,  280,   91,  282,  880,  123,  257,  258,   -1,   91,
+  123,  262,   -1,  889,  890,  167,   -1,  568, 1117,  295,
+   91,  897,  898,  302,   -1,  276,  277,   -1,   -1,   -1,
+  581,  582,   41,   -1,  295,   44,   -1,   -1,  589,   -1,
+   51,  295,   -1,  195,  920,  197,   -1,  598,  324,  325,
+   40,  295,   61,  332,   -1, 1154,  335,  336,   -1,   70,
+   -1,   40,   73,  324,  325,   76,  894,  895,  896,  348,
+  324,  325,  280,  295,  282,   40,   -1,  229,  295,  630,
+  324,  325,   91,   -1,  335,   -1,   -1,  280,   41,  282,
+  641,   44,  244,  245,  302,   40,  257,  108,  259,  260,
+  261,   91,  324,  325,  115,   58,   59,  324,  325,   -1,
+   -1,  295,   91, 1212, 1213, 1214,   -1, 1216,   27,   40,
+   -1,  329,   -1,   -1,   33,   -1,   91,  678,  295,  680,
+  681,  313,   -1,   -1,  145,  146,  687,   -1, 1237,  321,
+  324,  325,   37,   38,  326,  327,   91,   42,   43, 1248,
+   45,   46,   47,  704,   -1,  257,  258,  324,  325,  311,
+  262,  263,   -1, 1039,   40,   58,   -1,  280,   61,  282,
+   91,   80,  257,  258, 1050,  277,   -1,  262,  263,   -1,
+   40,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+  342,  343,  277,  278,  279,  347,  348,   -1,   91,  284,
+  285,  280,   58,  282,   40,  284,  295,  116,   44,   -1,
+  295,   -1, 1088,  295,  366,   91,  295,   -1,  229,  304,
+   40,   -1,   58,  132,  295,   61,  378,   -1,  380,  138,
+  123,   91,  141,  335,  785,  324,  325,   40,   -1,   -1,
+   -1, 1117,  324,  325,  396,   -1,   40,  332,  333,  334,
+  335,  336,   -1,  324,  325,   91,   -1,  266,  267,  268,
+  269,  270,  271,  348,  273,   -1,  313,  123,  177,  278,
+  279,   91,  319,  320,  321,  284,  285,   40, 1154,  326,
+  327,  328,  329,   -1,   -1,  836,  438,  123,   91,   -1,
+ 1118, 1119, 1120,   -1,  280,  304,  282,   91,  284,   -1,
+   40,  453,   -1,   -1,  213,  295,  215,   -1,   -1,  295,
+ 1186,  322,   -1,   -1,  325,   -1,  295,  328,   58, 1195,
+ 1196,   61,  231,   -1,  333,  334,   -1,   -1,   91,  880,
+  295,   -1,   -1,   -1,  324,  325, 1212, 1213, 1214,   -1,
+ 1216,   -1,  353,  495,   -1,  324,  325,   -1, 1224,   -1,
+  295,   91,  903,   -1, 1230,   40,   -1,   -1,  369,  324,
+  325, 1237,   -1,   -1,  915,  376,  273,  274,  275,  920,
+  277, 1247, 1248,   58,  295,   -1,   61,  928,  287,  324,
+  325,   -1,   -1,  123, 1260,  537,   -1,  280,   -1,  282,
+   40,   -1,   -1,   -1,   40,   41,   -1,   -1,   44,  551,
+   -1,  257,  258,  324,  325,   91,   91,  263,   58,  318,
+   -1,   61,   58,   59,   -1,   61,   -1,  569,  313,  295,
+   -1,  277,  317,  318,  319,  320,  321,   -1,  439,  440,
+    0,  326,  327,  328,  329,  295,  329,   -1,  123,  295,
+  126,   91,  453,   -1,   14,   91,   16,   17,  324,  325,
+   -1,   37,   38,   -1,   -1,   -1,   42,   43, 1009,   45,
+   46,   47,  257,  258,  324,  325,   -1,  262,   -1,   -1,
+  622,   -1, 1023,  123,  383,  295,   40,  123,   -1,   -1,
+   -1,   51,  277,  635,  495,  394,   -1,   -1, 1039,   -1,
+   -1, 1042,  295,   -1,   58,  647,   -1,   61,   -1, 1050,
+   70,  295,   -1,   73,  324,  325,   76,   -1,   94,  304,
+  266,  267,  268,  269,   -1,   40,   -1,   -1,  427,   45,
+   46,  324,  325,   -1,   94,   -1,  537,   91,   -1,  285,
+  324,  325,  295,   58,   59,  330,   61, 1088,  108,   -1,
+  335,  450,   -1,   -1,   -1,  115,   72,   73, 1099,  257,
+  258, 1102,   -1,   -1,  262,  263,   -1,   -1,   -1,  123,
+   -1,  324,  325,  715,   -1,   -1,   91,   -1,   -1,  277,
+   40,  723,  724,  143,  144,  145,  146,  263,  264,   -1,
+   40,   41,   -1,   -1,   44,   -1,  738,  295,   58,   59,
+  742,   61,   -1,   -1,   -1,   -1,   -1,  167,  123,   59,
+   -1,   61,   -1,  289,   -1,   -1,  515,   -1,   -1,  257,
+  258,  181,   -1,   -1,  262,   -1,   -1,  187,  304,  257,
+  258,   91,   40,   -1,  262,  195,   -1,  335,   -1,  277,
+  641,   -1,  541,   -1,   -1, 1186,   -1,  546,   -1,  277,
+   -1,   -1,   -1,   -1, 1195, 1196,  332,  333,   -1,   -1,
+   -1,   -1,   -1,  123,  340,  341,  342,  343,  344,  229,
+  346,  347,   -1,  123,   -1,  817,  304,  678,   -1,  680,
+  681,   -1,  581, 1224,  583,  245,  585,   -1,   -1, 1230,
+  328,  833,   -1,  257,  258,   -1,   -1,  335,  262,  841,
+   -1,  843,  844,  845,  257,  258, 1247,  335,   -1,  262,
+  257,  258,   -1,  277,   -1,  262,   -1,   -1,   -1, 1260,
+   -1,   -1,  238,  239,  277,   -1,   -1,  869,   -1,   -1,
+  277,  295,  874,   -1,  257,  258,   -1,  313,   -1,  262,
+   -1,  317,  318,  319,  320,  321,   -1,  889,  890,   -1,
+  326,  327,  328,  329,  277,  897,  898,  304,   -1,   -1,
+   -1,   -1,  322,   -1,   -1,  325,   -1,  909,  328,   -1,
+   -1,  335,   -1,   -1,   -1,   -1,   -1,   -1,  338,   -1,
+   -1,  304,  335,   -1,   -1,   -1,   -1,  303,  335,   -1,
+   -1,  933,  934,  692,  310,  937,   -1,  939,  940,  941,
+  942,  317,   -1,   -1,  320,  704,   -1,   -1,   -1,  369,
+   -1,   -1,  335,  955,   -1,  375,  376,   -1,   37,   38,
+   -1,   -1,   -1,   42,   43,   -1,   45,   46,   47,   -1,
+   -1,   -1,  974,  975,   -1,   -1,   -1,  353,   -1,   -1,
+  841,   -1,   -1,  359,  986,   -1,  988,  989,   -1,  257,
+  258,   -1,  412,   -1,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,  384,  277,
+  278,  279,   -1,   -1,   -1,   94,  284,  285,   -1,  439,
+  440,  257,  258,   -1,   -1,  401,  262,  295,  889,  890,
+   -1,   -1,   -1,  453,   -1, 1037,  897,  898,   -1,   -1,
+   -1,  277,  257,  258,  420,  124,   -1,  262,  424, 1051,
+  809,   -1,   -1,   -1,  813,  814,  257,  258, 1060, 1061,
+   -1,  262,  277,  257,  258,   -1,  334,  335,  262,   -1,
+   -1,   -1,   -1,   -1,  833,  495,  277,   -1,   -1,   -1,
+   -1, 1083,   -1,  277,   -1, 1087,  263,   -1, 1090,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,  335,
+   -1,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+  530,  531,   -1,  489,   -1, 1117,  536,  537,  295,   -1,
+  335,  880,  881,   -1,   -1,   -1,   -1,   -1,   -1,  549,
+  550,   -1,   -1, 1135,  335,   -1,   -1,   -1, 1140,   -1,
+   -1,  335,   -1,   -1,   40,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1, 1154,   -1,   -1,   -1,  915,  334,   -1, 1161,
+   -1,  920,   -1, 1165,   -1,   -1,   -1,   -1,   -1,  928,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  607,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  617,   -1,   -1,
+   -1,   -1,   -1, 1205,   -1,   -1,   -1,   -1, 1210,   -1,
+ 1212, 1213, 1214,   -1, 1216,   -1,   -1,   -1,   -1,   -1,
+  640,  641,   -1,   -1,   -1,   -1,   -1,  986,   -1,  988,
+  989,   -1,   -1,   -1,  313, 1237,   -1,   -1,  317,  318,
+  319,  320,  321,  322,   -1,   -1, 1248,  326,  327,  328,
+  329,   -1,   -1,   -1,  630,  631, 1117,   -1,  678,   -1,
+  680,  681,   -1,   -1,   -1,   -1,   -1,   -1,    0,   -1,
+   -1,   -1,  692,   -1,  292,  293,  294,   -1,   -1,  699,
+ 1039,   -1,   -1,   -1,  660,   -1,   -1,   -1,   -1,   -1,
+   -1, 1050,   -1, 1154,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   33,   -1,  723,   -1,   -1,   38,   -1,   40,   -1,
+   42,   43,   -1,   45,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   59, 1087, 1088,
+   -1, 1090,  350,  351,  352,  353,  354,  355,  356,  357,
+  358,  359,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1, 1212, 1213, 1214,   -1, 1216,   -1, 1116,   -1,   91,
+   -1,  257,  258,   -1,   -1,   -1,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271, 1237,  273,   -1,   -1,
+   -1,  277,  278,  279,   -1,   -1, 1145, 1248,  284,  285,
+ 1149,  811,   -1,  125,  126,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,  823,   -1,   -1, 1165,   -1,  304,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  841,   -1,  843,   -1,   -1,   -1, 1186,   -1,   -1,
+   -1,   -1, 1191,   -1,   -1,   -1, 1195, 1196,  334,  335,
+  336,  861,   -1,   38,   -1,   40,   -1,   42,   -1,   -1,
+   -1, 1210,   34,   -1,   -1,   37,   38,   -1,   40,   41,
+   42,   43,   44,   45,   46, 1224,   48,   49,   -1,  889,
+  890, 1230,   -1,   -1,   -1,   -1,   37,  897,  898,   -1,
+ 1239,   42,   43, 1242,   45,   46,   47,   -1, 1247,   -1,
+   72,   73,   -1,   -1,   -1,   -1, 1255,   -1,   -1,   -1,
+   -1, 1260, 1261,   -1,   -1,   -1,   -1,   -1,   -1, 1268,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  894,  895,
+  896,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,  263,  264,  265,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,  276,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,  286,  287,  288,  289,   -1,   -1,
+   -1,   -1,   -1,  295,  296,  297,  298,  299,  300,   -1,
+  302,  303,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  959,  960,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,  330,  331,
+  332,  333,  334,  335,  336,  337,  338,  339,  340,  341,
+  342,  343,  344,  345,  346,  347, 1036,  349,   -1,   -1,
+   -1,   -1,  354,   -1,   -1,  357,   -1,   -1,  360,  361,
+  362,  363,  364,  365,  366,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  224,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  237,  238,  239,   -1, 1035,
+   -1,  243,  257,  258,   -1,   -1,   -1,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282, 1064,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   -1, 1117,   33,   -1,
+  295,   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,
+   45,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  303,   -1,   -1,   -1,   -1,  308,  322,  310,  311,
+   -1,   -1,   -1,  328, 1154,  317,   -1,  332,  320,  334,
+  335,   -1, 1118, 1119, 1120,   -1, 1122, 1123,   -1,   -1,
+   -1,   -1,  313,   -1,   -1,   -1,  317,  318,  319,  320,
+  321,   -1,   -1,   -1,   -1,  326,  327,  328,  329,   -1,
+  352,  353,  354,   -1,  356,   -1,   -1,  359,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,
+   -1,  126, 1212, 1213, 1214,   -1, 1216,   -1,   -1,   -1,
+  382,   -1,  384, 1179,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  397,   -1, 1237,  400,  401,
+   -1,   -1,   -1,   -1,  406,   -1,   -1,   -1, 1248,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   40,  419,  420,  421,
+   -1,  423,  424,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   61,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  456,  457,  458,  459,  460,  461,
+  462,  463,  464,  465,  466,  467,  468,  469,  470,  471,
+  472,  473,   -1,   -1,    0,   -1,  478,  479,  480,  481,
+  482,  483,  484,  485,  486,  487,  488,  489,  490,   -1,
+  492,   -1,  494,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  259,  260,  261,   33,   -1,   -1,
+   -1,   37,   38,   -1,   40,   41,   42,   43,   44,   45,
+   46,   47,   -1,   -1,   -1,  280,   -1,  282,   -1,   -1,
+   -1,   -1,   58,   59,   -1,   61,   -1,   63,   -1,   -1,
+   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,  304,
+   -1,   -1,  554,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   91,   -1,   93,   94,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,   -1,
+   -1,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,
+  592,   -1,   -1,   -1,   -1,   -1,  598,  123,  124,  125,
+  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  366,   -1,   -1,   -1,   -1,  618,  619,  620,   -1,
+  622,   -1,  624,  625,  626,  627,  628,  629,  630,  631,
+   -1,   -1,   -1,  257,  258,   -1,   -1,  639,  262,  263,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,   -1,   -1,  660,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  672,  295,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  304,   -1,   -1,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,  274,  275,   -1,  277,  278,
+  279,   -1,   -1,   -1,   -1,  284,  285,   -1,  332,  333,
+  334,  335,  336,   -1,   -1,   -1,  295,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  348,   -1,   -1,   -1,   -1,   -1,
+   -1,  257,  258,  259,  260,  261,  262,  263,  264,  265,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+  276,  277,  278,  279,   33,  334,  335,   -1,  284,  285,
+  286,  287,  288,  289,   -1,   44,  345,   -1,   -1,  295,
+  296,  297,  298,  299,  300,   -1,  302,  303,  304,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,   -1,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,  328,  329,  330,  331,  332,  333,  334,  335,
+  336,  337,  338,  339,  340,  341,  342,  343,  344,  345,
+  346,  347,   -1,  349,   -1,   -1,   -1,   -1,  354,   -1,
+   -1,  357,   -1,   -1,  360,  361,  362,  363,  364,  365,
+  366,   -1,   -1,   -1,  123,   -1,   -1,  126,   44,   -1,
+   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,
+  263,   -1,   58,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,  874,  875,  277,  278,  279,   -1,   -1,   -1,
+  882,   -1,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  893,  894,  895,  896,   91,   -1,  899,   -1,   -1,
+   -1,  304,   -1,   -1,   -1,   -1,    0,   -1,   -1,   -1,
+   -1,   -1,   -1,  915,  916,   -1,  918,  919,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  928,  123,   -1,   -1,
+  333,  334,  335,  336,   -1,   -1,   -1,   -1,   -1,   33,
+   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,
+  952,   45,   -1,   -1,   -1,   -1,   -1,  959,  960,   -1,
+   -1,   -1,   -1,   -1,   -1,   59,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   91,  277,  278,
+  279,   -1,   -1,   -1, 1006,  284,  285,   -1, 1010, 1011,
+ 1012, 1013, 1014, 1015,   -1,   -1,   -1,  296,  297,  298,
+  299,    0,   -1,  302,  303,  304,   -1,   -1,   -1,  123,
+   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+ 1042,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   33,  334,  335,  336,   -1,   38,
+  339,   40, 1064,   42,   43,   44,   45,  263,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   59,   -1,  278,  279,  280,   -1,  282,  366,  284,  285,
+   -1,   -1,   -1,   -1, 1096,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   -1,   -1, 1107,   -1,   -1,   -1,   -1,
+   -1,   -1,   91,   -1,   -1,   -1, 1118, 1119, 1120,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1, 1130, 1131,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  334,   -1,
+   -1, 1143,   -1,   -1,  123,   -1,  125,  126,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1, 1157, 1158,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,  263,
+  264,  265,  266,  267,  268,  269,  270,  271, 1180,  273,
+  274,  275,  276,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,  300,   40,  302,  303,
+  304,   -1,   -1,   -1,   -1,   -1,   -1, 1219,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   61,   -1,
+  324,  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,
+  334,  335,  336,  337,  338,  339,  340,  341,  342,  343,
+  344,  345,  346,  347,   -1,  349,   -1,   -1,   -1,   -1,
+  354,   -1,   -1,  357,   -1,   -1,  360,  361,  362,  363,
+  364,  365,  366,   -1,   -1,   -1,   -1,   -1,  257,  258,
+   -1,  260,  261,  262,  263,  264,  265,  266,  267,  268,
+  269,  270,  271,   -1,  273,  274,  275,  276,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,  286,  287,  288,
+  289,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,  300,   40,  302,  303,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,
+   -1,  330,  331,  332,  333,  334,  335,  336,  337,  338,
+  339,  340,  341,  342,  343,  344,  345,  346,  347,    0,
+  349,   -1,   -1,   91,   -1,  354,   -1,   -1,  357,   -1,
+   -1,  360,  361,  362,  363,  364,  365,  366,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,  123,   -1,   38,   -1,   40,
+   -1,   42,   43,   44,   45,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   59,  262,
+  263,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,   -1,   -1,   -1,
+   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   91,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,   -1,  125,  126,   -1,   -1,   -1,  332,
+  333,  334,  335,  336,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   33,   -1,   -1,  348,   -1,   38,   -1,   40,
+   -1,   42,   43,   44,   45,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   59,  257,
+  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   -1,   -1,  285,   -1,   -1,
+   91,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,
+  298,  299,   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,   -1,  125,  126,  324,  325,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  334,  335,  336,   -1,
+   -1,  339,   -1,   -1,   -1,   -1,  257,  258,   -1,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,  300,
+   38,  302,  303,  304,   42,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,   -1,  349,   59,
+   -1,   -1,   -1,  354,   -1,   -1,  357,   -1,   -1,  360,
+  361,  362,  363,  364,  365,  366,  257,  258,   -1,  260,
+  261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,  276,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  286,  287,  288,  289,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,  300,
+   -1,  302,  303,  304,   -1,  125,   -1,   -1,   -1,   37,
+   38,   -1,   -1,   -1,   42,   43,   -1,   45,   46,   47,
+   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,  330,
+  331,  332,  333,  334,  335,  336,  337,  338,  339,  340,
+  341,  342,  343,  344,  345,  346,  347,    0,  349,   -1,
+   -1,   -1,   -1,  354,   -1,   -1,  357,   -1,   -1,  360,
+  361,  362,  363,  364,  365,  366,   94,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   33,   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,
+   43,   44,   45,   -1,   -1,   -1,  124,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   59,   -1,   -1,  257,
+  258,   -1,   -1,   -1,  262,  263,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   91,   -1,
+   -1,   -1,   -1,  263,  264,  265,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  274,  275,  276,    0,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  286,  287,  288,  289,
+  123,   -1,  125,  126,  322,   -1,   -1,   -1,   -1,   -1,
+  300,   -1,   -1,   -1,  332,   -1,  334,  335,   -1,   -1,
+   33,   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,
+   43,   -1,   45,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,   -1,   -1,   59,  337,  338,   -1,
+  340,  341,  342,  343,  344,  345,  346,  347,   -1,  349,
+   -1,   -1,   -1,   -1,  354,   -1,   -1,   -1,   -1,   -1,
+  360,  361,  362,  363,   -1,   -1,   -1,   -1,   91,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  123,   -1,  125,  126,   -1,  313,   -1,   -1,   -1,  317,
+  318,  319,  320,  321,   -1,   -1,   -1,   -1,  326,  327,
+  328,  329,   -1,   -1,  257,  258,   -1,  260,  261,  262,
+  263,  264,  265,  266,  267,  268,  269,  270,  271,   -1,
+  273,  274,  275,  276,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,
+   -1,   -1,  295,  296,  297,  298,  299,  300,   -1,  302,
+  303,  304,   -1,   -1,   -1,   40,   41,   -1,   -1,   44,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  324,  325,   -1,   59,   -1,   61,  330,  331,  332,
+  333,  334,  335,  336,  337,  338,  339,  340,  341,  342,
+  343,  344,  345,  346,  347,   -1,  349,   -1,   -1,   -1,
+   -1,  354,   -1,   -1,  357,   59,   91,  360,  361,  362,
+  363,  364,  365,  366,  257,  258,  259,  260,  261,  262,
+  263,  264,  265,  266,  267,  268,  269,  270,  271,   -1,
+  273,  274,  275,  276,  277,  278,  279,  280,  123,  282,
+   -1,  284,  285,  286,  287,  288,  289,   -1,   -1,   -1,
+   -1,   -1,  295,  296,  297,  298,  299,  300,   -1,  302,
+  303,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  324,  325,   -1,   -1,   -1,   -1,  330,  331,  332,
+  333,  334,  335,  336,  337,  338,  339,  340,  341,  342,
+  343,  344,  345,  346,  347,    0,  349,   -1,   -1,   -1,
+   -1,  354,   -1,   -1,   -1,   -1,   -1,  360,  361,  362,
+  363,  364,  365,  366,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,   -1,
+   -1,   -1,   -1,   38,   -1,   -1,   -1,   42,   43,   -1,
+   45,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   59,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,   -1,   -1,   -1,  262,  263,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   -1,  277,  278,  279,   -1,   91,   -1,   -1,   -1,
+  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  263,
+  264,  265,   -1,   -1,    0,   -1,   -1,  302,   -1,  304,
+  274,  275,  276,   -1,   -1,   -1,   -1,   -1,  123,   -1,
+  125,  126,  286,  287,  288,  289,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  329,   -1,  300,   33,  333,  334,
+  335,  336,   38,   -1,   40,   -1,   42,   43,   44,   45,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   59,   -1,   -1,   -1,   -1,  332,  333,
+   -1,   -1,   -1,  337,  338,   -1,  340,  341,  342,  343,
+  344,  345,  346,  347,   -1,  349,   -1,   -1,   -1,   -1,
+  354,   -1,   -1,   -1,   -1,   91,  360,  361,  362,  363,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,  125,
+  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,  259,  260,  261,  262,  263,  264,
+  265,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,  276,  277,  278,  279,  280,   -1,  282,   59,  284,
+  285,  286,  287,  288,  289,   -1,   -1,   -1,   -1,   -1,
+  295,  296,  297,  298,  299,  300,   -1,  302,  303,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,  334,
+  335,  336,  337,  338,  339,  340,  341,  342,  343,  344,
+  345,  346,  347,   -1,  349,   91,   -1,   -1,   -1,  354,
+   -1,   -1,  357,   -1,   -1,  360,  361,  362,  363,  364,
+  365,  366,  258,   -1,   -1,   -1,  262,  263,  264,  265,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+  276,  277,  278,  279,  280,   -1,  282,   -1,  284,  285,
+  286,  287,  288,  289,   -1,   -1,   -1,   -1,   -1,  295,
+  296,  297,  298,  299,  300,   -1,  302,  303,  304,   40,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  324,  325,
+   -1,   -1,   -1,   -1,  330,  331,  332,  333,  334,  335,
+  336,  337,  338,  339,  340,  341,  342,  343,  344,  345,
+  346,  347,    0,  349,   -1,   -1,   -1,   -1,  354,   -1,
+   91,  357,   -1,   -1,  360,  361,  362,  363,  364,  365,
+  366,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  263,  264,  265,   33,   -1,   -1,   -1,   37,
+   -1,   -1,  123,  274,  275,  276,   44,   -1,   46,   47,
+   -1,   -1,   -1,   -1,   -1,  286,  287,  288,  289,   -1,
+   -1,  257,  258,   61,   -1,   63,  262,   -1,   -1,  300,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   94,   -1,   -1,  295,
+   -1,  332,  333,   -1,   -1,   -1,  337,  338,   -1,  340,
+  341,  342,  343,  344,  345,  346,  347,   -1,  349,   -1,
+   -1,   -1,   -1,  354,   -1,   -1,  124,   -1,  126,  360,
+  361,  362,  363,   -1,   -1,   -1,   -1,   -1,  334,  335,
+   -1,   -1,   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,
+   38,   -1,   -1,   41,   42,   43,   44,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   58,   59,   -1,   61,   -1,   63,  257,  258,  259,  260,
+  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,   91,  285,   93,   94,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,
+   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,   -1,
+   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  334,  335,  336,   -1,   -1,  339,   -1,
+   -1,  259,  260,  261,   -1,   -1,  264,  265,   -1,   -1,
+   -1,   38,   -1,   40,   -1,   42,  274,  275,  276,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  286,  287,
+  288,  289,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,
+  298,  299,  300,   -1,  302,  303,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,   -1,   -1,  326,  327,
+  328,  329,  330,  331,   -1,   -1,   -1,   -1,   -1,  337,
+  338,  339,  340,  341,  342,  343,  344,  345,  346,  347,
+   -1,  349,   -1,   -1,   -1,   -1,  354,   -1,   -1,  357,
+   -1,   -1,  360,  361,  362,  363,  364,  365,  366,  257,
+  258,  259,  260,  261,  262,  263,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,
+  298,  299,   -1,   -1,  302,  303,  304,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  329,  330,  331,  332,  333,  334,  335,  336,   -1,
+  338,  339,   -1,  126,   -1,   33,   -1,   -1,   -1,   37,
+   38,  349,   40,   41,   42,   43,   44,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  366,   -1,
+   58,   59,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,   91,   -1,   93,   94,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  304,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,   33,
+   -1,   -1,   -1,   37,   38,  322,   40,   41,   42,   43,
+   44,   45,   46,   47,   -1,  332,  333,  334,  335,  336,
+   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,   63,
+   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,   91,   -1,   93,
+   94,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+  124,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  334,  335,  336,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   40,   -1,  257,
+  258,  259,  260,  261,  262,  263,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,
+  298,  299,   -1,   -1,  302,  303,  304,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  329,  330,  331,  332,  333,  334,  335,  336,   -1,
+  338,  339,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,
+   -1,  349,   -1,  257,  258,  259,  260,  261,  262,  263,
+   -1,   -1,  266,  267,  268,  269,  270,  271,  366,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+  324,  325,  326,  327,  328,  329,  330,  331,  332,  333,
+  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,   33,
+   -1,   -1,   -1,   37,   38,  349,   40,   41,   42,   43,
+   44,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  366,   -1,   58,   59,   -1,   61,   -1,   63,
+   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,
+  263,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,   91,   -1,   93,
+   94,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+  124,  125,  126,   33,   -1,   -1,   -1,   37,   38,   -1,
+   40,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+  333,  334,  335,  336,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,  257,  258,   -1,   -1,   -1,  262,
+  263,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,   91,  285,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,  322,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,
+  333,  334,  335,  336,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   40,   -1,  257,  258,  259,  260,  261,  262,  263,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+   -1,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+  324,  325,  326,  327,   -1,  329,  330,  331,  332,  333,
+  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,   38,
+   -1,   -1,   -1,   42,   -1,  349,   -1,  257,  258,  259,
+  260,  261,  262,  263,   -1,   -1,  266,  267,  268,  269,
+  270,  271,  366,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,   -1,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+   -1,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,   -1,  329,
+  330,  331,  332,  333,  334,  335,  336,   -1,  338,  339,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,  349,
+   40,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  366,   -1,   58,   59,
+   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,  257,  258,
+   -1,   -1,   -1,  262,  263,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,   91,   -1,   93,   94,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   33,   -1,   -1,
+   -1,   37,   38,   -1,   40,   41,   42,   43,   44,   45,
+   46,   47,   -1,   -1,  333,  334,  335,  336,   -1,   -1,
+   -1,   -1,   58,   59,   -1,   61,   -1,   63,  257,  258,
+   -1,   -1,   -1,  262,  263,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,   91,  285,   93,   94,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,  125,
+  126,   -1,   -1,  322,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  332,  333,  334,  335,  336,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   40,   -1,  257,  258,  259,
+  260,  261,  262,  263,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,   -1,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+   -1,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,   -1,  329,
+  330,  331,  332,  333,  334,  335,  336,   -1,  338,  339,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  349,
+   -1,  257,  258,  259,  260,  261,  262,  263,   -1,   -1,
+  266,  267,  268,  269,  270,  271,  366,  273,   -1,   -1,
+   -1,  277,  278,  279,  280,   -1,  282,   -1,   -1,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  296,  297,  298,  299,   -1,   -1,  302,  303,  304,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,   44,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,   58,  329,  330,  331,  332,  333,  334,  335,
+  336,   -1,  338,  339,   -1,   -1,   -1,   33,   -1,   -1,
+   -1,   37,   38,  349,   40,   41,   42,   43,   44,   45,
+   46,   47,   -1,   -1,   -1,   91,   -1,   -1,   -1,   -1,
+  366,   -1,   58,   59,   -1,   61,   -1,   63,   -1,   -1,
+   -1,   -1,  257,  258,   -1,   -1,   -1,  262,  263,   -1,
+   -1,  266,  267,  268,  269,  270,  271,  123,  273,   -1,
+   -1,   -1,  277,  278,  279,   91,   -1,   93,   94,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,  125,
+  126,   33,   -1,   -1,   -1,   37,   38,   -1,   40,   41,
+   42,   43,   44,   45,   46,   47,   -1,   -1,  333,  334,
+  335,  336,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,
+   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,   91,
+  273,   93,   94,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,   -1,  278,  279,  280,   -1,  282,   -1,  284,  285,
+   -1,  334,  335,   -1,   -1,   -1,   -1,   -1,   -1,   40,
+   -1,  257,  258,  259,  260,  261,  262,  263,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,  277,  278,  279,  280,   -1,  282,   -1,   -1,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  334,   -1,
+  296,  297,  298,  299,   -1,   -1,  302,  303,  304,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,   -1,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,   -1,  329,  330,  331,  332,  333,  334,  335,
+  336,   -1,  338,  339,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  349,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+  366,  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,   -1,
+  302,  303,  304,  305,  306,  307,  308,  309,  310,  311,
+  312,  313,   -1,  315,  316,  317,  318,  319,  320,  321,
+  322,  323,  324,  325,  326,  327,  328,  329,  330,  331,
+   -1,   -1,  334,  335,  336,   -1,  338,  339,   -1,   -1,
+   -1,   33,   -1,   -1,   -1,   37,   38,  349,   40,   41,
+   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  366,   -1,   58,   59,   -1,   61,
+   -1,   63,   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,
+   -1,  262,  263,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,   91,
+   -1,   93,   94,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,  124,  125,  126,   33,   -1,   -1,   -1,   37,
+   38,   -1,   40,   41,   42,   43,   44,   45,   46,   47,
+   -1,   -1,  333,  334,  335,  336,   -1,   -1,   -1,   -1,
+   58,   59,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,
+  257,  258,   -1,   -1,   -1,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   91,   -1,   93,   94,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  334,  335,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  345,   -1,
+   -1,   -1,   -1,   40,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,   -1,
+  302,  303,  304,  305,  306,  307,  308,  309,  310,  311,
+  312,  313,   -1,  315,  316,  317,  318,  319,  320,  321,
+  322,  323,  324,  325,  326,  327,  328,  329,  330,  331,
+   -1,   -1,  334,  335,  336,   -1,  338,  339,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  349,   -1,   42,
+  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,  366,  273,   -1,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,
+  298,  299,   -1,   -1,  302,  303,  304,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  329,  330,  331,   -1,   -1,  334,  335,  336,   -1,
+  338,  339,   -1,  126,   -1,   33,   -1,   -1,   -1,   37,
+   38,  349,   40,   41,   42,   43,   44,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  366,   -1,
+   58,   59,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,   91,   -1,   93,   94,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  304,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,   33,
+   -1,   -1,   -1,   37,   38,   -1,   40,   41,   42,   43,
+   44,   45,   46,   47,   -1,   -1,  333,  334,  335,  336,
+   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,   63,
+   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,   91,   -1,   93,
+   94,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   37,   38,   -1,   -1,   -1,   42,
+   43,  304,   45,   46,   47,   -1,   -1,   -1,   -1,  123,
+  124,  125,  126,   -1,   -1,   -1,   -1,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  334,  335,  336,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,
+  258,   94,  260,  261,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,
+   -1,  124,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,
+  298,  299,   -1,   -1,  302,  303,  304,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  329,  330,  331,   -1,   -1,  334,  335,  336,   -1,
+  338,  339,   -1,   -1,   -1,   38,   -1,   -1,   -1,   42,
+   -1,  349,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,  366,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+  324,  325,  326,  327,   -1,  329,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,   33,
+   -1,   -1,   -1,   37,   38,  349,   40,   41,   42,   43,
+   44,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  366,   -1,   58,   59,   -1,   61,   -1,   63,
+   -1,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,   -1,   -1,  326,  327,  328,  329,   -1,   -1,   93,
+   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+  124,  125,  126,   33,   -1,   -1,   -1,   37,   38,   -1,
+   40,   41,   42,   43,   44,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,  257,  258,   -1,   -1,   -1,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   37,   38,   -1,   -1,   41,
+   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,  322,
+   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,
+   -1,  334,  335,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   94,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,  124,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+  324,  325,  326,  327,  328,  329,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,   -1,
+   40,   -1,   -1,   -1,   -1,  349,   -1,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,  366,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+   -1,   91,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+  330,  331,   -1,  123,  334,  335,  336,   -1,  338,  339,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,  349,
+   41,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,  366,   58,   59,   -1,
+   61,   -1,   63,  305,  306,  307,  308,  309,  310,  311,
+  312,  313,   -1,  315,  316,  317,  318,  319,  320,  321,
+  322,  323,  324,  325,  326,  327,  328,  329,   -1,   -1,
+   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   33,   -1,   -1,   -1,
+   37,   38,   -1,   40,   41,   42,   43,   -1,   45,   46,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   58,   59,   -1,   61,   -1,   63,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,   91,  285,   93,   94,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,
+   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  334,  335,  336,   -1,   -1,  339,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,  330,
+  331,   -1,   -1,  334,  335,  336,   -1,  338,  339,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  349,   -1,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,  366,  273,   -1,   -1,   -1,
+  277,  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,
+  297,  298,  299,   -1,   -1,  302,  303,  304,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+  327,  328,  329,  330,  331,   -1,   33,  334,  335,  336,
+   37,  338,  339,   40,   41,   -1,   43,   44,   45,   46,
+   47,   -1,  349,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   58,   59,   -1,   61,   -1,   63,   -1,   -1,  366,
+   -1,  257,  258,   -1,   -1,   -1,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,  277,  278,  279,   91,   -1,   93,   94,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  304,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,
+   33,   -1,   -1,   -1,   37,   38,   -1,   40,   41,   42,
+   43,   44,   45,   46,   47,   -1,   -1,  333,  334,  335,
+  336,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   -1,   -1,  277,  278,  279,   91,   -1,
+   93,   94,  284,  285,  286,  287,  288,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   38,   -1,   -1,   -1,   -1,   -1,   44,   -1,   -1,
+  123,  124,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   61,   -1,   63,   -1,   -1,   -1,
+   -1,   -1,  334,  335,   -1,   -1,   -1,   -1,   -1,   -1,
+  342,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,  259,  260,  261,  262,  263,   94,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  124,  295,  296,
+  297,  298,  299,   -1,   -1,  302,  303,  304,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,   -1,  323,  324,  325,  326,
+  327,  328,  329,  330,  331,   -1,  333,  334,  335,  336,
+   -1,  338,  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  349,   -1,  257,  258,  259,  260,  261,  262,
+  263,   -1,   -1,   -1,   44,   -1,   -1,  270,  271,  366,
+  273,   -1,   -1,   -1,  277,  278,  279,  280,   58,  282,
+   -1,  284,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,  296,  297,  298,  299,   -1,   -1,  302,
+  303,  304,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   91,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,  324,  325,  326,  327,  328,  329,  330,  331,  332,
+  333,  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,
+   33,   -1,   -1,  123,   37,   38,  349,   40,   41,   42,
+   43,   44,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  366,   -1,   58,   59,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,
+  307,  308,  309,  310,  311,  312,   -1,   -1,  315,  316,
+  317,  318,   -1,   -1,   -1,  322,  323,   -1,   91,   -1,
+   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  123,  124,  125,  126,   33,   -1,   -1,   -1,   37,   38,
+   -1,   40,   41,   42,   43,   44,   45,   46,   47,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,
+   59,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   91,  273,   93,   94,   -1,   -1,  278,  279,
+  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,   -1,  334,   -1,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,   -1,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  296,  297,  298,  299,  334,  335,  302,
+  303,  304,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,  324,  325,  326,  327,  328,  329,  330,  331,   -1,
+   -1,  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  349,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,  366,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,   -1,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,  322,  323,  324,  325,  326,  327,   -1,
+  329,  330,  331,   -1,   33,  334,  335,  336,   37,  338,
+  339,   40,   41,   -1,   43,   44,   45,   46,   47,   -1,
+  349,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,
+   59,   -1,   61,   -1,   63,   -1,   -1,  366,   -1,  257,
+  258,   -1,   -1,   -1,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,   91,   -1,   93,   94,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,  124,  125,  126,   33,   -1,
+   -1,   -1,   37,   38,   -1,   40,   41,   -1,   43,   44,
+   45,   46,   47,   -1,   -1,   -1,  334,  335,  336,   -1,
+   -1,   -1,   -1,   58,   59,   -1,   61,   -1,   63,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   91,   -1,   93,   94,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   37,   38,   -1,   40,   -1,   42,   43,   -1,   45,   46,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,
+  125,  126,   59,   -1,   61,   -1,   63,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   91,   -1,   -1,   94,  257,  258,
+  259,  260,  261,  262,  263,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,   -1,   -1,   -1,   -1,  284,  285,  124,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,   -1,  323,  324,  325,  326,  327,  328,
+  329,  330,  331,   -1,  333,  334,  335,  336,   -1,  338,
+  339,   -1,   -1,   38,   -1,   40,   -1,   42,   -1,   -1,
+  349,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,  366,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,   -1,
+  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,  304,
+  305,  306,  307,  308,  309,  310,  311,  312,  313,   -1,
+  315,  316,  317,  318,  319,  320,  321,  322,  323,  324,
+  325,  326,  327,  328,  329,  330,  331,   -1,  123,  334,
+  335,  336,   -1,  338,  339,   -1,   -1,   33,   -1,   -1,
+   -1,   37,   38,   -1,  349,   41,   42,   43,   44,   45,
+   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,  366,   58,   59,   -1,   61,   -1,   63,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+  327,  328,  329,   -1,   -1,   91,   -1,   93,   94,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,  125,
+  126,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,   41,
+   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,
+   -1,   63,  257,  258,   -1,   -1,   -1,  262,  263,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,  124,  125,  126,   -1,   -1,  322,   -1,   -1,
+   -1,   -1,   -1,  328,   -1,   -1,   -1,  332,  333,  334,
+  335,  336,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,  277,  278,  279,  280,   -1,  282,   -1,   -1,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  296,  297,  298,  299,   -1,   -1,  302,  303,  304,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,   -1,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,   -1,  329,  330,  331,   -1,   -1,  334,  335,
+  336,   -1,  338,  339,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  349,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+  366,  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  296,  297,  298,  299,   -1,   91,
+  302,  303,  304,  305,  306,  307,  308,  309,  310,  311,
+  312,  313,   -1,  315,  316,  317,  318,  319,  320,  321,
+  322,  323,   -1,   -1,   -1,  327,  328,  329,  330,  331,
+   -1,   -1,  334,  335,  336,   -1,  338,  339,   -1,   -1,
+   33,   -1,   -1,   -1,   37,   38,   -1,  349,   41,   42,
+   43,   44,   45,   -1,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  366,   58,   59,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,
+   -1,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,   -1,
+   93,   94,   -1,  284,  285,  286,  287,  288,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  123,  124,  125,  126,   33,   -1,   -1,   -1,   37,   38,
+   -1,   -1,   41,   42,   43,   44,   45,   -1,   47,   -1,
+   -1,   -1,   -1,  334,  335,   -1,   -1,   -1,   -1,   58,
+   59,  342,   61,   -1,   63,  257,  258,   -1,   -1,   -1,
+  262,  263,  264,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,  274,  275,   -1,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,   93,   94,   -1,  289,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,   37,   38,   -1,   40,
+   -1,   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  332,  333,  334,  335,   -1,   -1,   -1,   -1,  340,  341,
+  342,  343,  344,  345,  346,  347,   -1,   -1,   -1,   -1,
+   91,   -1,   93,   94,  257,  258,  259,  260,  261,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,  124,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  296,  297,  298,  299,   -1,   -1,  302,
+  303,  304,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,   -1,   -1,   -1,  327,  328,  329,  330,  331,   -1,
+   -1,  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  349,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,  366,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,
+  299,   -1,   91,  302,  303,  304,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,  322,  323,   -1,  257,   -1,  327,  328,
+  329,  330,  331,   -1,   -1,  334,  335,  336,   -1,  338,
+  339,   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,
+  349,   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,  366,   58,   59,
+   -1,   61,   -1,   63,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,   -1,
+   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   33,   -1,   -1,
+   -1,   37,   38,   -1,   -1,   41,   42,   43,   44,   45,
+   -1,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   58,   59,   -1,   61,   -1,   63,  257,  258,
+   -1,   -1,   -1,  262,  263,  264,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,  274,  275,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   93,   94,   -1,
+  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   37,
+   38,   -1,   40,   41,   42,   43,   -1,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,  125,
+  126,   -1,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  332,  333,  334,  335,   -1,   -1,   -1,
+   -1,  340,  341,  342,  343,  344,  345,  346,  347,   -1,
+   -1,   -1,   -1,   91,   -1,   -1,   94,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,  124,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+   -1,   -1,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,
+  330,  331,   -1,   -1,  334,  335,  336,   -1,  338,  339,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  349,
+   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,  366,  273,   -1,   -1,
+   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  296,  297,  298,  299,   -1,   91,  302,  303,  304,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,   -1,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,   -1,   -1,
+   -1,  327,  328,  329,  330,  331,   -1,   -1,  334,  335,
+  336,   -1,  338,  339,   -1,   -1,   33,   -1,   -1,   -1,
+   37,   38,   -1,  349,   41,   42,   43,   44,   45,   -1,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+  366,   58,   59,   -1,   61,   -1,   63,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  329,   -1,   -1,   -1,   -1,   93,   94,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,
+   33,   -1,   -1,   -1,   37,   38,   -1,   -1,   41,   42,
+   43,   44,   45,   -1,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,
+   63,  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,  285,
+   93,   94,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   37,   38,   -1,   40,   41,   42,   43,   -1,
+   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  123,  124,  125,  126,   -1,   -1,   61,   -1,   63,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,
+   -1,   -1,   -1,   -1,  340,  341,  342,  343,  344,  345,
+  346,  347,   -1,   -1,   -1,   -1,   91,   -1,   -1,   94,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,  280,   -1,  282,   -1,  284,  285,  124,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,
+  297,  298,  299,   -1,   -1,  302,  303,  304,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,   -1,   -1,   -1,
+  327,  328,  329,  330,  331,   -1,   -1,  334,  335,  336,
+   -1,  338,  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  349,   -1,  257,  258,  259,  260,  261,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,  366,
+  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  296,  297,  298,  299,   -1,   91,  302,
+  303,  304,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,   -1,   -1,   -1,  327,  328,  329,  330,  331,   -1,
+   -1,  334,  335,  336,   -1,  338,  339,   -1,   -1,   33,
+   -1,   -1,   -1,   37,   38,   -1,  349,   41,   42,   43,
+   44,   45,   -1,   47,   -1,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,  366,   58,   59,   -1,   61,   -1,   63,
+  305,  306,  307,  308,  309,  310,  311,  312,  313,   -1,
+  315,  316,  317,  318,  319,  320,  321,  322,  323,  324,
+  325,  326,  327,  328,  329,   -1,   -1,   -1,   -1,   93,
+   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+  124,  125,  126,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,  257,  258,   -1,   -1,   -1,  262,
+  263,  264,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,  274,  275,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,   93,   94,   -1,  289,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   37,   38,   -1,   40,   -1,
+   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   61,
+   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,
+  333,  334,  335,   -1,   -1,   -1,   -1,  340,  341,  342,
+  343,  344,  345,  346,  347,   -1,   -1,   -1,   -1,   91,
+   -1,   93,   94,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,  124,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+   -1,   -1,   -1,  327,  328,  329,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  349,   -1,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,  366,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+   -1,   91,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,
+  330,  331,   -1,   -1,  334,  335,  336,   -1,  338,  339,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,  349,
+   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,  366,   58,   59,   -1,
+   61,   -1,   63,  305,  306,  307,  308,  309,  310,  311,
+  312,  313,   -1,  315,  316,  317,  318,  319,  320,  321,
+  322,  323,  324,  325,  326,  327,  328,  329,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   33,   -1,   -1,   -1,
+   37,   38,   -1,   -1,   41,   42,   43,   44,   45,   -1,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   58,   59,   -1,   61,   -1,   63,  257,  258,   -1,
+   -1,   -1,  262,  263,  264,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   93,   94,   -1,  289,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   37,   38,
+   -1,   40,   -1,   42,   43,   44,   45,   46,   47,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,
+   -1,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   -1,   -1,   -1,   -1,
+  340,  341,  342,  343,  344,  345,  346,  347,   -1,   -1,
+   -1,   -1,   91,   -1,   -1,   94,  257,  258,  259,  260,
+  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  124,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,   -1,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,  327,  328,  329,  330,
+  331,   -1,   -1,  334,  335,  336,   -1,  338,  339,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  349,   -1,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,  366,  273,   -1,   -1,   -1,
+  277,  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,
+  297,  298,  299,   -1,   91,  302,  303,  304,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,   -1,   -1,   -1,
+  327,  328,  329,  330,  331,   -1,   -1,  334,  335,  336,
+   -1,  338,  339,   -1,   -1,   33,   -1,   -1,   -1,   37,
+   38,   -1,  349,   41,   42,   43,   44,   45,   -1,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,  366,
+   58,   59,   -1,   61,   -1,   63,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,  322,  323,  324,  325,  326,  327,  328,
+  329,   -1,   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,   33,
+   -1,   -1,   -1,   37,   38,   -1,   -1,   41,   42,   43,
+   44,   45,   -1,   47,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,   63,
+  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   93,
+   94,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  304,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+  124,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   -1,
+   -1,   -1,   -1,  340,  341,  342,  343,  344,  345,  346,
+  347,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,
+  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,
+  298,  299,   -1,   -1,  302,  303,  304,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,   -1,   -1,   -1,  327,
+  328,  329,  330,  331,   -1,   -1,  334,  335,  336,   -1,
+  338,  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  349,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,  366,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   91,   -1,
+   -1,   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+   -1,   -1,  125,  327,  328,  329,  330,  331,   -1,   33,
+  334,  335,  336,   37,  338,  339,   -1,   41,   -1,   43,
+   44,   45,   46,   47,   -1,  349,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,   63,
+   -1,   -1,  366,   -1,  257,  258,   -1,   -1,   -1,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,   91,   -1,   93,
+   94,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+  124,  125,  126,   33,   -1,   -1,   -1,   37,   38,   -1,
+   -1,   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,
+   -1,  334,  335,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   61,   -1,   63,  257,  258,   -1,   -1,   -1,  262,
+  263,  264,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,  274,  275,   -1,  277,  278,  279,   -1,   -1,   -1,
+   -1,  284,  285,   93,   94,   -1,  289,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   37,   38,   -1,   40,   41,
+   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,   61,
+   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,
+  333,  334,  335,   -1,   -1,   -1,   -1,  340,  341,  342,
+  343,  344,  345,  346,  347,   -1,   -1,   -1,   -1,   91,
+   -1,   -1,   94,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,
+   -1,  285,  124,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,   -1,  323,
+  324,  325,  326,  327,  328,  329,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  349,   -1,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,  366,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+   -1,   91,  302,  303,  304,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,   -1,   -1,   -1,   -1,  328,  329,
+  330,  331,   -1,   -1,  334,  335,  336,   -1,  338,  339,
+   -1,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,  349,
+   41,   42,   43,   44,   45,   -1,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,  366,   58,   59,   -1,
+   61,   -1,   63,  305,  306,  307,  308,  309,  310,  311,
+  312,  313,   -1,  315,  316,  317,  318,  319,  320,  321,
+  322,  323,  324,  325,  326,  327,  328,  329,   -1,   -1,
+   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   33,   -1,   -1,   -1,
+   37,   38,   -1,   -1,   41,   42,   43,   44,   45,   -1,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   58,   59,   -1,   61,   -1,   63,  257,  258,   -1,
+   -1,   -1,  262,  263,  264,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   93,   94,   -1,  289,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   37,   38,
+   -1,   40,   41,   42,   43,   -1,   45,   46,   47,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,
+   -1,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   -1,   -1,   -1,   -1,
+  340,  341,  342,  343,  344,  345,  346,  347,   -1,   -1,
+   -1,   -1,   91,   -1,   -1,   94,  257,  258,  259,  260,
+  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,  124,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,   -1,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,   -1,   -1,  328,  329,  330,
+  331,   -1,   -1,  334,  335,  336,   -1,  338,  339,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  349,   -1,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,  366,  273,   -1,   -1,   -1,
+  277,  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   91,   -1,   -1,   -1,   -1,  296,
+  297,  298,  299,   -1,   -1,  302,  303,  304,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,   -1,   -1,  126,
+   -1,  328,  329,  330,  331,   -1,   -1,  334,  335,  336,
+   -1,  338,  339,   -1,   33,   -1,   -1,   -1,   37,   38,
+   -1,   40,  349,   42,   43,   44,   45,   46,   47,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,  366,
+   -1,   -1,   61,   -1,   63,   -1,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,  322,  323,  324,  325,  326,  327,  328,
+  329,   -1,   91,   -1,   -1,   94,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,  124,   33,  126,   -1,   -1,
+   37,   38,   -1,   -1,   -1,   42,   43,   44,   45,   46,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,   -1,   -1,   61,   -1,   63,  264,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+   -1,   -1,  289,   -1,   91,   -1,   93,   94,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  304,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,   -1,  126,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   -1,
+   -1,   -1,   -1,  340,  341,  342,  343,  344,  345,  346,
+  347,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,  322,  323,  324,  325,  326,  327,  328,
+  329,  330,  331,   -1,   -1,  334,  335,  336,   -1,   -1,
+  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  366,   -1,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,   -1,  285,   -1,
+   -1,   -1,   -1,   -1,   91,   -1,   -1,   -1,   -1,  296,
+  297,  298,  299,   -1,   -1,  302,  303,  304,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+  327,  328,  329,  330,  331,   33,   -1,  334,  335,  336,
+   38,   -1,  339,   41,   -1,   43,   44,   45,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   58,   59,   -1,   61,   -1,   63,  257,  258,   -1,  366,
+   -1,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   93,   94,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,   33,
+   -1,   -1,   -1,   -1,   38,   -1,   -1,   41,   -1,   43,
+   44,   45,   -1,  334,  335,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,   63,
+  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   93,
+   94,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+  124,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,   -1,
+   -1,   -1,   -1,  340,  341,  342,  343,  344,  345,  346,
+  347,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,
+  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,
+  298,  299,   -1,   -1,  302,  303,  304,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,   -1,   -1,   -1,   -1,
+  328,  329,  330,  331,   -1,   -1,  334,  335,  336,   -1,
+  338,  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  349,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,  366,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,
+   -1,   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+   -1,   -1,  126,   -1,  328,  329,  330,  331,   33,   -1,
+  334,  335,  336,   38,  338,  339,   41,   -1,   -1,   44,
+   -1,   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   58,   59,   -1,   61,   -1,   63,  257,
+  258,   -1,  366,   -1,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,
+  278,  279,   -1,   -1,   -1,   -1,  284,  285,   93,   94,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,
+  125,  126,   33,   -1,   -1,   -1,   -1,   38,   -1,   -1,
+   41,   -1,   -1,   44,   -1,   -1,  334,  335,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,
+   61,   -1,   63,  257,  258,   -1,   -1,   -1,  262,  263,
+  264,  265,  266,  267,  268,  269,  270,  271,   -1,  273,
+  274,  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,
+  284,  285,   93,   94,   -1,  289,   -1,   -1,   -1,   -1,
+   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  123,  124,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,
+  334,  335,   -1,   -1,   -1,   -1,  340,  341,  342,  343,
+  344,  345,  346,  347,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,  304,
+  305,  306,  307,  308,  309,  310,  311,  312,  313,   -1,
+  315,  316,  317,  318,  319,  320,  321,  322,  323,   -1,
+   -1,   -1,   -1,  328,  329,  330,  331,   -1,   -1,  334,
+  335,  336,   -1,  338,  339,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  349,   -1,  257,  258,  259,  260,
+  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,  366,  273,   -1,   -1,   -1,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   91,   -1,   -1,   -1,   -1,  296,  297,  298,  299,   -1,
+   -1,  302,  303,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,   -1,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,  126,   -1,  328,  329,  330,
+  331,   33,   -1,  334,  335,  336,   38,  338,  339,   41,
+   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,  349,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,
+   -1,   63,   -1,   -1,   -1,  366,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,  124,  125,  126,   33,   -1,   -1,   -1,   -1,
+   38,   -1,   -1,   41,   -1,   -1,   44,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   58,   59,   -1,   61,   -1,   63,  257,  258,   -1,   -1,
+   -1,  262,  263,  264,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   93,   94,   -1,  289,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  123,  124,  125,  126,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  332,  333,  334,  335,   -1,   -1,   -1,   -1,  340,
+  341,  342,  343,  344,  345,  346,  347,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  296,  297,  298,  299,   -1,   -1,
+  302,  303,  304,  305,  306,  307,  308,  309,  310,  311,
+  312,   -1,   -1,  315,  316,  317,  318,  319,  320,   -1,
+  322,  323,   -1,   -1,   -1,   -1,  328,  329,  330,  331,
+   -1,   -1,  334,  335,  336,   -1,  338,  339,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  349,   -1,  257,
+  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,  366,  273,   -1,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   91,   -1,   -1,   -1,   -1,  296,  297,
+  298,  299,   -1,   -1,  302,  303,  304,  305,  306,  307,
+  308,  309,  310,  311,  312,   -1,   -1,  315,  316,  317,
+  318,  319,  320,   -1,  322,  323,   -1,   -1,  126,   -1,
+  328,  329,  330,  331,   33,   -1,  334,  335,  336,   38,
+  338,  339,   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,
+   -1,  349,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,
+   59,   -1,   61,   -1,   63,   -1,   -1,   -1,  366,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   93,   94,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,  124,  125,  126,   33,   -1,
+   -1,   -1,   -1,   38,   -1,   -1,   41,   -1,   -1,   44,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   58,   59,   -1,   61,   -1,   63,  257,
+  258,   -1,   -1,   -1,  262,  263,  264,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,  274,  275,   -1,  277,
+  278,  279,   -1,   -1,   -1,   -1,  284,  285,   93,   94,
+   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,
+  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  332,  333,  334,  335,   -1,   -1,
+   -1,   -1,  340,  341,  342,  343,  344,  345,  346,  347,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,  305,  306,  307,  308,
+  309,  310,  311,  312,   -1,   -1,  315,  316,  317,  318,
+  319,  320,   -1,  322,  323,   -1,   -1,   -1,   -1,  328,
+  329,  330,  331,   -1,   -1,  334,  335,  336,   -1,  338,
+  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  349,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,  366,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,   -1,
+   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,  304,
+  305,  306,  307,  308,  309,  310,  311,  312,   -1,   -1,
+  315,  316,  317,  318,  319,  320,   -1,  322,  323,   -1,
+   -1,   -1,   -1,  328,  329,  330,  331,   33,   -1,  334,
+  335,  336,   38,  338,  339,   41,   -1,   -1,   44,   -1,
+   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   58,   59,   -1,   61,   -1,   63,   -1,   -1,
+   -1,  366,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   93,   94,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,  124,  125,
+  126,   33,   -1,   -1,   -1,   -1,   38,   -1,   -1,   41,
+   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,
+   -1,   63,  257,  258,   -1,   -1,   -1,  262,  263,  264,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   93,   94,   -1,  289,   -1,   -1,   -1,   -1,   33,
+  295,   -1,   -1,   37,   38,   -1,   -1,   -1,   42,   43,
+   44,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,  124,  125,  126,   -1,   -1,   61,   -1,   63,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   -1,   -1,   -1,   -1,  340,  341,  342,  343,  344,
+  345,  346,  347,   -1,   -1,   -1,   -1,   -1,   -1,   93,
+   94,  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,  285,
+  124,   -1,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  296,  297,  298,  299,   -1,   -1,  302,  303,  304,  305,
+  306,  307,  308,  309,  310,  311,  312,   -1,   -1,  315,
+  316,  317,  318,   -1,   -1,   -1,  322,  323,   40,   -1,
+   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,  335,
+  336,   -1,  338,  339,   -1,   -1,   58,   59,   -1,   61,
+   -1,   -1,   -1,  349,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+  366,  273,   -1,   -1,   -1,  277,  278,  279,  280,   91,
+  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  296,  297,  298,  299,   -1,   -1,
+  302,  303,  304,  305,  306,  307,  308,  309,  310,  311,
+  312,  123,   -1,  315,  316,  317,  318,   -1,   -1,   -1,
+  322,  323,   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,
+   33,   -1,  334,  335,  336,   38,  338,  339,   41,   -1,
+   -1,   44,   -1,   -1,   -1,   -1,   -1,  349,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,
+   63,   -1,   -1,   -1,  366,   -1,   -1,   -1,  302,  303,
+   -1,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+   93,   94,  326,  327,  328,  329,  330,  331,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  123,  124,  125,  126,   33,   -1,   -1,   -1,   -1,   38,
+   -1,   40,  366,   42,   43,   -1,   45,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,
+  262,  263,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   -1,   -1,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   91,  295,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   37,   38,   -1,   -1,   -1,   42,   43,
+   -1,   45,   46,   47,  123,   -1,   -1,  126,   -1,   -1,
+  332,  333,  334,  335,  336,   -1,   -1,   -1,   -1,   63,
+   -1,   -1,   -1,   -1,   -1,   -1,  348,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,
+   94,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  124,   -1,   -1,  296,  297,  298,  299,   -1,   -1,  302,
+  303,  304,  305,  306,  307,  308,  309,  310,  311,  312,
+   -1,   -1,  315,  316,   33,   -1,   -1,   -1,   -1,  322,
+  323,   -1,   41,   -1,   -1,   44,   -1,  330,  331,   -1,
+   -1,  334,  335,  336,   -1,  338,  339,   -1,   -1,   58,
+   59,   -1,   61,   -1,   63,   -1,  349,   -1,  257,  258,
+  259,  260,  261,  262,  263,  264,   -1,  266,  267,  268,
+  269,  270,  271,  366,  273,  274,  275,   -1,  277,  278,
+  279,  280,   -1,  282,   93,  284,  285,   -1,   -1,   -1,
+  289,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,  124,  125,  126,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,
+   -1,  330,  331,  332,  333,  334,  335,  336,   -1,   -1,
+  339,  340,  341,  342,  343,  344,  345,  346,  347,   33,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   41,   -1,   -1,
+   44,   -1,   -1,   -1,   -1,   -1,   -1,  366,   -1,   -1,
+   -1,  295,   -1,   -1,   58,   59,   -1,   61,   -1,   63,
+   -1,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+  324,  325,  326,  327,  328,  329,   -1,   -1,   -1,   93,
+   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+  124,  125,  126,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   33,  284,  285,   -1,   -1,   38,
+   -1,   40,   -1,   42,   43,   -1,   45,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,  305,  306,  307,  308,
+  309,  310,  311,  312,   -1,   -1,  315,  316,   -1,   -1,
+   -1,   -1,   -1,  322,  323,   -1,   -1,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,  338,
+  339,   -1,   91,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  349,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  366,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,   -1,   -1,  126,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   33,
+  284,  285,   -1,   -1,   38,   -1,   40,   -1,   42,   43,
+   -1,   45,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,   -1,
+   -1,  315,  316,   -1,   -1,   -1,   -1,   -1,  322,  323,
+   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,  338,  339,   -1,   91,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  366,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,   -1,  126,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,  263,  264,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,  274,  275,   -1,  277,  278,
+  279,   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,
+  289,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,
+   -1,  330,  331,  332,  333,  334,  335,  336,   -1,   -1,
+  339,  340,  341,  342,  343,  344,  345,  346,  347,   33,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   41,   -1,   -1,
+   44,   -1,   -1,   -1,   -1,   -1,   -1,  366,   -1,   -1,
+   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,   63,
+   -1,  123,   -1,  257,  258,  259,  260,  261,  262,  263,
+  264,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+  274,  275,   -1,  277,  278,  279,   -1,   -1,   -1,   93,
+  284,  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  324,  325,   -1,   -1,   -1,   -1,  330,  331,  332,  333,
+  334,  335,  336,   -1,   -1,  339,  340,  341,  342,  343,
+  344,  345,  346,  347,   33,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,
+   -1,   -1,  366,   -1,   -1,   -1,   -1,   -1,   -1,   58,
+   59,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,
+   -1,  263,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   -1,   93,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  304,   -1,  123,   -1,  125,  126,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,  333,  334,  277,  278,  279,  280,   -1,  282,   33,
+  284,  285,   -1,   -1,   38,   -1,   40,   -1,   42,   43,
+   -1,   45,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,   -1,
+   -1,  315,  316,   -1,   -1,   -1,   -1,   -1,  322,  323,
+   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,  338,  339,   -1,   91,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  366,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   33,  284,  285,   -1,   -1,   38,
+   -1,   40,   -1,   42,   43,   -1,   45,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,  305,  306,  307,  308,
+  309,  310,  311,  312,   -1,   -1,  315,  316,   -1,   -1,
+   -1,   -1,   -1,   -1,  323,   -1,   -1,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,  338,
+  339,   -1,   91,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  349,   -1,   33,   -1,   -1,   -1,   37,   38,   -1,   -1,
+   -1,   42,   43,   44,   45,   46,   47,  366,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,   -1,  125,  126,   -1,   -1,
+   61,   -1,   63,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   93,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  124,   -1,  126,   -1,   -1,   -1,   -1,
+  324,  325,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,   -1,  339,   -1,   33,   -1,   -1,
+   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,   45,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  364,  365,  366,   -1,   -1,   61,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   91,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,   -1,  123,   -1,   -1,
+  126,   33,   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,
+   42,   43,   -1,   45,   -1,  324,  325,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,   61,
+  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  364,  365,  366,   -1,   91,
+   -1,  302,  303,   -1,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,   -1,   -1,  326,  327,  328,  329,  330,
+  331,  123,   33,   -1,  126,   -1,   -1,   38,   -1,   40,
+   -1,   42,   43,   -1,   45,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  366,   -1,   -1,   -1,   -1,
+   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,
+   91,  277,  278,  279,  280,   -1,  282,   -1,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+  296,  297,  298,  299,   -1,   -1,  302,  303,  304,   -1,
+   -1,   -1,  123,   -1,  125,  126,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  324,  325,
+   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,  335,
+  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   91,  266,  267,  268,  269,  270,  271,
+  366,  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,  296,  297,  298,  299,  126,   -1,
+  302,  303,  304,   -1,   -1,   33,   -1,   -1,   -1,   -1,
+   38,   -1,   40,   41,   42,   43,   -1,   45,   -1,   -1,
+   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,  330,  331,
+   -1,   -1,  334,  335,  336,   -1,   -1,  339,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   91,  366,   -1,  277,  278,  279,  280,
+   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,
+   -1,  302,  303,  304,   -1,  123,   33,   -1,  126,   -1,
+   -1,   38,   -1,   40,   41,   42,   43,   -1,   45,   -1,
+   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,  330,
+  331,   -1,   -1,  334,  335,  336,   -1,   -1,  339,  257,
+  258,   -1,   -1,   -1,  262,  263,  264,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,  274,  275,   -1,  277,
+  278,  279,   -1,   -1,   91,  366,  284,  285,   -1,   -1,
+   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  304,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,   33,  126,
+   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,
+   45,   -1,   -1,   -1,  332,  333,  334,  335,   -1,   -1,
+   -1,   -1,  340,  341,  342,  343,  344,  345,  346,  347,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,
+  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   91,   -1,   -1,  277,
+  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,
+  298,  299,   -1,   -1,  302,  303,  304,   -1,  123,   33,
+  125,  126,   -1,   -1,   38,   -1,   40,   -1,   42,   43,
+   -1,   45,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,
+   -1,   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,
+   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   91,  366,   -1,
+  277,  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,
+  297,  298,  299,   -1,   -1,  302,  303,  304,   -1,  123,
+   -1,   -1,  126,   33,   -1,   -1,   -1,   -1,   38,   -1,
+   40,   -1,   42,   43,   -1,   45,   -1,  324,  325,   -1,
+   -1,   -1,   -1,  330,  331,   -1,   -1,  334,  335,  336,
+   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,  366,
+   -1,   91,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  295,  296,  297,  298,  299,   -1,   -1,  302,  303,  304,
+   -1,   -1,   -1,  123,   33,   -1,  126,   -1,   -1,   38,
+   -1,   40,   -1,   42,   43,   -1,   45,   -1,   -1,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,
+  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,  366,   91,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,   -1,   -1,   -1,  123,   -1,   33,  126,   -1,   -1,
+   -1,   38,   -1,   40,   41,   42,   43,   -1,   45,   -1,
+  324,  325,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,  366,  273,   91,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+   -1,   -1,  302,  303,  304,   -1,  123,   33,   -1,  126,
+   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,   45,
+   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,
+  330,  331,   -1,   -1,  334,  335,  336,   -1,   -1,  339,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   91,  366,   93,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,   -1,  123,   -1,   -1,
+  126,   33,   -1,   -1,   -1,   -1,   38,   -1,   40,   -1,
+   42,   43,   -1,   45,   -1,  324,  325,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,   -1,
+  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,  366,   -1,   91,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,
+  297,  298,  299,   -1,   -1,  302,  303,  304,   -1,   -1,
+   -1,  123,   33,   -1,  126,   -1,   -1,   38,   -1,   40,
+   -1,   42,   43,   -1,   45,   -1,   -1,  324,  325,   -1,
+   -1,   -1,   -1,  330,  331,   -1,   -1,  334,  335,  336,
+   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   -1,  366,
+   91,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+  296,  297,  298,  299,   -1,   -1,  302,  303,  304,   -1,
+   -1,   -1,  123,   -1,   33,  126,   -1,   -1,   -1,   38,
+   -1,   40,   -1,   42,   43,   -1,   45,   -1,  324,  325,
+   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,  335,
+  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+  366,  273,   91,   -1,   93,  277,  278,  279,   -1,   -1,
+   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,   -1,
+  302,  303,  304,   -1,  123,   33,   -1,  126,   -1,   -1,
+   38,   -1,   40,   -1,   42,   43,   -1,   45,   -1,   -1,
+   -1,   -1,  324,  325,   -1,   -1,   -1,  329,  330,  331,
+   -1,   -1,  334,  335,  336,   -1,   -1,  339,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,
+  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   91,  366,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,   -1,
+   -1,  302,  303,  304,   -1,  123,   33,  125,  126,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   44,   -1,   -1,
+   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,  329,  330,
+  331,   -1,   -1,  334,  335,  336,   -1,   -1,  339,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,  366,   -1,   -1,  277,  278,
+  279,   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,  123,   -1,   33,  126,
+   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,
+   45,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,   -1,
+  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,
+  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,  267,
+  268,  269,  270,  271,   -1,  273,   91,  366,   93,  277,
+  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,  297,
+  298,  299,   -1,   -1,  302,  303,  304,   -1,  123,   33,
+   -1,  126,   -1,   -1,   -1,   -1,   -1,   41,   -1,   -1,
+   44,   -1,   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,
+   -1,   -1,  330,  331,   58,   59,  334,  335,  336,   -1,
+   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,  366,   93,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,
+  297,  298,  299,   -1,   -1,  302,  303,  304,   -1,  123,
+   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   33,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   41,
+   -1,   -1,   44,  330,  331,   -1,   -1,  334,  335,  336,
+   -1,   -1,  339,   -1,   -1,   -1,   58,   59,   -1,   -1,
+   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,  366,
+   -1,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   93,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  295,  296,  297,  298,  299,   -1,   -1,  302,  303,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  123,   -1,  125,  126,   -1,   -1,   -1,   -1,  324,
+  325,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,
+  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,  366,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   33,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   41,   -1,   -1,   44,   -1,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,  338,  339,   -1,   -1,   58,   59,
+   -1,   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,   -1,  366,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   93,   -1,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  296,  297,  298,  299,   -1,   -1,
+  302,  303,  304,  123,   -1,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   33,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   41,   -1,   -1,   44,   -1,   -1,  330,  331,
+   -1,   -1,  334,  335,  336,   -1,  338,  339,   -1,   58,
+   59,   -1,   -1,   -1,   -1,   -1,   -1,  349,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  366,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   93,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,   -1,  125,  126,   33,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   41,   -1,   -1,   44,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   58,   59,   -1,   -1,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,   -1,   -1,   93,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+   -1,   -1,  302,  303,  304,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,
+  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,
+  330,  331,   -1,   -1,  334,  335,  336,   41,  338,  339,
+   44,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  349,
+   -1,   -1,   -1,   -1,   58,   59,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,  366,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,   93,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,  338,
+  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  349,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,  366,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   33,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   41,   -1,   -1,   44,
+   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,  304,
+   -1,   -1,   -1,   58,   59,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,
+  335,  336,   -1,  338,  339,   -1,   -1,   -1,   93,   -1,
+   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,  366,  266,  267,  268,  269,  270,  271,  123,  273,
+  125,  126,   -1,  277,  278,  279,  280,   -1,  282,   33,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   41,   -1,   -1,
+   44,   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,   -1,   -1,   -1,   58,   59,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,   93,
+   -1,   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  366,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   33,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   41,   -1,   -1,   44,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   58,   59,
+   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   -1,   -1,   93,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,   -1,  125,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   33,  330,  331,   -1,   -1,  334,
+  335,  336,   41,  338,  339,   44,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,   -1,   58,
+   59,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,  366,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   -1,   -1,   93,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,   -1,  125,  126,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  349,   -1,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,  366,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   33,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   41,   -1,   -1,   44,   -1,  296,  297,  298,  299,
+   -1,   -1,  302,  303,  304,   -1,   -1,   -1,   58,   59,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  330,  331,   -1,   -1,  334,  335,  336,   -1,  338,  339,
+   -1,   -1,   -1,   93,   -1,   -1,   -1,   -1,   -1,  349,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,  366,  266,  267,  268,
+  269,  270,  271,  123,  273,  125,  126,   -1,  277,  278,
+  279,  280,   -1,  282,   33,  284,  285,   -1,   -1,   -1,
+   -1,   -1,   41,   -1,   -1,   44,   -1,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,   -1,   -1,   -1,   58,
+   59,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,  338,
+  339,   -1,   -1,   -1,   93,   -1,   -1,   -1,   -1,   -1,
+  349,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  366,   -1,   -1,
+   -1,   -1,   -1,   -1,  123,   -1,  125,  126,   33,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   41,   -1,   -1,   44,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   58,   59,   -1,   -1,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,   -1,   -1,   93,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,
+   -1,   -1,  302,  303,  304,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,
+  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,
+  330,  331,   -1,   -1,  334,  335,  336,   41,  338,  339,
+   44,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  349,
+   -1,   -1,   -1,   -1,   58,   59,   -1,   -1,  257,  258,
+  259,  260,  261,  262,   -1,   -1,  366,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   -1,   -1,   93,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  296,  297,  298,
+  299,   -1,   -1,  302,  303,  304,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  330,  331,   -1,   -1,  334,  335,  336,   -1,  338,
+  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  349,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,  366,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   33,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   41,   -1,   -1,   44,
+   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,  304,
+   -1,   -1,   -1,   58,   59,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,  334,
+  335,  336,   -1,  338,  339,   -1,   -1,   -1,   93,   -1,
+   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,  366,  266,  267,  268,  269,  270,  271,  123,  273,
+  125,  126,   -1,  277,  278,  279,  280,   -1,  282,   33,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   41,   -1,   -1,
+   44,   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,   -1,   -1,   -1,   58,   59,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,   93,
+   -1,   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  366,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,  125,  126,   33,   -1,   -1,   -1,   -1,   38,   -1,
+   40,   -1,   42,   43,   -1,   45,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   91,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  123,   -1,   -1,  126,   -1,   38,   -1,
+   40,   41,   42,   -1,   44,  330,  331,   -1,   -1,  334,
+  335,  336,   -1,  338,  339,   -1,   -1,   -1,   -1,   59,
+   -1,   61,   -1,   -1,  349,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,  366,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   91,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,   -1,   -1,   -1,   -1,   -1,   33,   -1,   -1,   -1,
+   -1,   38,   -1,   40,   -1,   42,   43,   -1,   45,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,  338,  339,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  349,   -1,  257,  258,  259,
+  260,  261,  262,   -1,   -1,   -1,  266,  267,  268,  269,
+  270,  271,  366,  273,   91,   -1,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,  296,  297,  298,  299,
+   -1,   -1,  302,  303,  304,   -1,  123,   33,   -1,  126,
+   -1,   -1,   38,   -1,   40,   -1,   42,   43,   -1,   45,
+   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,  329,
+  330,  331,   -1,   -1,  334,  335,  336,   -1,   -1,  339,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,
+   -1,   -1,  262,  263,   -1,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,   -1,   91,  366,  277,  278,  279,
+  280,   -1,  282,   -1,  284,  285,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,  302,   -1,  304,   -1,   -1,  123,   -1,   33,
+  126,   -1,   -1,   -1,   38,   -1,   40,   -1,   42,   43,
+   -1,   45,  322,   -1,   -1,   -1,   -1,   -1,  328,  329,
+   -1,   -1,  332,  333,  334,  335,  336,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   91,   -1,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,  296,
+  297,  298,  299,   -1,   -1,  302,  303,  304,   -1,  123,
+   33,   -1,  126,   -1,   -1,   38,   -1,   40,   -1,   42,
+   43,   -1,   45,   -1,   -1,   -1,   -1,  324,  325,   -1,
+   -1,   -1,   -1,  330,  331,   -1,   -1,  334,  335,  336,
+   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  257,  258,  259,  260,  261,  262,   -1,   -1,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,   91,  366,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+  296,  297,  298,  299,   -1,   -1,  302,  303,  304,   -1,
+  123,   33,   -1,  126,   -1,   -1,   -1,   -1,   -1,   41,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  324,  325,
+   -1,   -1,   -1,   -1,  330,  331,   58,   59,  334,  335,
+  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,   -1,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+  366,   93,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  295,  296,  297,  298,  299,   -1,   -1,  302,  303,
+  304,  123,   33,  125,  126,   -1,   -1,   38,   -1,   40,
+   -1,   42,   43,   -1,   45,   -1,   -1,   -1,   -1,   -1,
+  324,  325,   -1,   -1,   -1,   -1,  330,  331,   59,   -1,
+  334,  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,  262,
+   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,  366,   -1,  277,  278,  279,   -1,   -1,   -1,
+   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,  296,  297,  298,  299,   -1,   -1,  302,
+  303,  304,  123,   33,   -1,  126,   -1,   -1,   38,   -1,
+   40,   -1,   42,   43,   -1,   45,   -1,   -1,   -1,   -1,
+   -1,  324,  325,   -1,   -1,   -1,   -1,  330,  331,   59,
+   -1,  334,  335,  336,   -1,   -1,  339,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,  366,   -1,  277,  278,  279,  280,   -1,
+  282,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  296,  297,  298,  299,   -1,   -1,
+  302,  303,  304,  123,   -1,   -1,  126,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  330,  331,
+   -1,   33,  334,  335,  336,   -1,  338,  339,   -1,   -1,
+   -1,   -1,   44,   -1,   -1,   -1,   -1,  349,  259,  260,
+  261,   -1,   -1,   -1,  265,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  366,  276,   -1,   -1,   -1,  280,
+   -1,  282,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,
+   -1,   -1,   -1,   -1,   -1,  296,  297,  298,  299,  300,
+   44,  302,  303,  304,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,  330,
+  331,  123,   -1,   -1,  126,  336,  337,  338,  339,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  349,  259,
+  260,  261,   -1,  354,   -1,  265,   -1,   -1,   -1,  360,
+  361,  362,  363,   -1,   -1,  366,  276,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,   -1,  126,   -1,   -1,   -1,  296,  297,  298,  299,
+  300,   -1,  302,  303,  304,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  324,  325,   -1,   -1,   -1,   -1,
+  330,  331,   -1,   -1,   -1,   -1,  336,  337,  338,  339,
+   -1,   -1,   -1,   37,   -1,   -1,   -1,   41,   -1,  349,
+   44,   -1,   46,   47,  354,   -1,   -1,   -1,   -1,   -1,
+  360,  361,  362,  363,   58,   59,  366,   61,   -1,   63,
+   -1,   -1,   -1,   -1,   -1,  257,  258,  259,  260,  261,
+  262,   -1,   -1,   -1,  266,  267,  268,  269,  270,  271,
+   -1,  273,   -1,   -1,   -1,  277,  278,  279,   -1,   93,
+   94,   -1,  284,  285,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  296,  297,  298,  299,   -1,   -1,
+  302,  303,  304,   -1,  258,  259,  260,  261,  262,   -1,
+  124,  125,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,   -1,   -1,  330,  331,
+  284,  285,  334,  335,  336,   -1,   -1,  339,   -1,   -1,
+   -1,   -1,  296,  297,  298,  299,   -1,   33,  302,  303,
+  304,   37,   38,   -1,   40,   -1,   42,   43,   44,   45,
+   -1,   47,   -1,   -1,  366,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   61,  330,  331,   -1,   -1,
+  334,  335,  336,   -1,   -1,  339,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,   94,   -1,
+   -1,   -1,  366,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  124,   -1,
+  126,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  263,
+   -1,   -1,   -1,   -1,   37,   -1,   -1,   -1,   41,   -1,
+   -1,   44,   -1,   46,   47,   -1,  280,   -1,  282,   -1,
+   -1,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+   93,   94,  326,  327,  328,   -1,   -1,   -1,  332,  333,
+   -1,   -1,   -1,   -1,  338,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,   -1,
+   -1,  124,  125,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   41,   42,
+   -1,  257,  258,  259,   -1,   -1,  262,  263,  264,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   91,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,  314,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,  328,  329,  330,  331,  332,  333,  334,  335,
+  123,   -1,   -1,  126,  340,  341,  342,  343,  344,  345,
+  346,  347,   -1,   -1,   37,   -1,   -1,   -1,   41,   -1,
+   -1,   44,   -1,   46,   47,   -1,   -1,   -1,   -1,   -1,
+  263,   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,  280,   -1,  282,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   93,   94,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,   -1,   -1,  326,  327,  328,   -1,   -1,   -1,  332,
+  333,  124,  125,   37,   -1,  338,   -1,   41,   -1,   -1,
+   44,   -1,   46,   47,   -1,   -1,  349,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   58,   59,   -1,   61,   -1,   63,
+   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,
+  263,  264,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,  274,  275,   -1,  277,  278,  279,   -1,   -1,   93,
+   94,  284,  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  304,   -1,   -1,   41,   42,   -1,   -1,   -1,   -1,
+  124,  125,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,
+  333,  334,  335,  336,   -1,   -1,   -1,  340,  341,  342,
+  343,  344,  345,  346,  347,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   91,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  280,   -1,  282,
+   -1,   -1,   -1,   -1,   -1,   -1,  123,   -1,   -1,  126,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,   -1,   -1,  326,  327,  328,  329,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  338,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  349,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   33,   -1,
+   -1,   -1,   37,   38,   -1,   40,   -1,   42,   43,   44,
+   45,   -1,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   61,   -1,   -1,   -1,
+   -1,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+   -1,   -1,  326,  327,  328,  329,   91,   -1,   -1,   94,
+  257,  258,   -1,   -1,  338,  262,   -1,  264,   -1,  266,
+  267,  268,  269,  270,  271,  349,  273,  274,  275,   -1,
+  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,  124,
+   -1,  126,  289,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   37,   38,   -1,   40,  304,   42,   43,
+   44,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   59,   -1,   61,   -1,   63,
+   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,  336,
+   -1,   -1,   -1,  340,  341,  342,  343,  344,  345,  346,
+  347,   -1,   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,
+   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+  124,  125,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,  259,   -1,   -1,  262,   -1,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   41,  273,   -1,
+   44,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,   -1,   -1,   -1,   59,   -1,   61,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  305,  306,  307,  308,  309,  310,  311,  312,  313,  314,
+  315,  316,  317,  318,  319,  320,  321,  322,  323,  324,
+  325,  326,  327,  328,  329,  330,  331,   -1,   -1,  334,
+  335,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  123,
+   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,  263,
+   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+   -1,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+  324,  325,  326,  327,  328,  329,   -1,   -1,  332,  333,
+  334,  335,  336,   37,   38,   -1,   40,   -1,   42,   43,
+   44,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   59,   -1,   61,   -1,   63,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,   -1,   -1,   91,  262,  263,
+   94,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+  284,  285,   -1,   -1,   -1,   -1,   37,   -1,   -1,  123,
+  124,  125,   43,   44,   45,   46,   47,   -1,  302,   -1,
+  304,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   59,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  329,   -1,   -1,   -1,  333,
+  334,  335,  336,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   91,   -1,   -1,   94,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  124,  125,   -1,   -1,   38,   -1,   40,
+   41,   42,   -1,   44,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   59,   -1,
+   61,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,  263,
+   91,   -1,  266,  267,  268,  269,  270,  271,   -1,  273,
+   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,
+   -1,  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  295,  123,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  304,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+  324,  325,  326,  327,   -1,  329,   -1,   -1,  332,  333,
+  334,  335,  336,   -1,   -1,   -1,  257,  258,   -1,   -1,
+   -1,  262,  263,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,
+   -1,  282,   -1,   -1,  285,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  304,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,   -1,  323,  324,  325,  326,  327,   91,  329,   -1,
+   -1,  332,  333,  334,  335,  336,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  257,  258,   -1,   -1,
+   -1,  262,  263,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,
+   -1,  282,   -1,   38,  285,   40,   41,   42,   -1,   44,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  302,   -1,  304,   59,   -1,   61,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  322,   -1,   -1,   -1,   -1,   -1,  328,  329,   -1,
+   -1,  332,  333,  334,  335,  336,   91,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   38,   -1,   40,  123,   42,
+   43,   -1,   45,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   59,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  257,  258,   -1,   -1,   -1,  262,  263,
+  264,   -1,  266,  267,  268,  269,  270,  271,   91,  273,
+  274,  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,
+  284,  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,
+   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  123,   -1,  125,   40,   41,   -1,   -1,   44,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   59,   -1,   61,   -1,   -1,   -1,  332,  333,
+  334,  335,   -1,   -1,   -1,   -1,  340,  341,  342,  343,
+  344,  345,  346,  347,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  257,  258,   91,   -1,   -1,  262,  263,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   -1,   -1,   -1,   -1,   -1,  123,   40,   41,   -1,
+   -1,   44,   -1,   -1,   -1,   -1,   -1,  302,   -1,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   59,   -1,   61,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  322,   -1,   -1,
+   -1,   -1,   -1,   -1,  329,   -1,   -1,  332,  333,  334,
+  335,  336,   -1,   -1,  257,  258,   -1,   -1,   91,  262,
+  263,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,   -1,   -1,   -1,   -1,   40,   41,   -1,
+  123,   44,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  304,   -1,   -1,   -1,   -1,   59,   -1,   61,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  324,  325,   -1,   -1,   -1,   -1,   -1,   -1,  332,
+  333,  334,  335,  336,   -1,   -1,   -1,   -1,   91,   -1,
+  257,  258,   -1,   -1,   -1,  262,  263,   -1,   -1,  266,
+  267,  268,  269,  270,  271,   -1,  273,   -1,   -1,   -1,
+  277,  278,  279,  280,   -1,  282,   -1,  284,  285,   -1,
+  123,   40,   41,   -1,   -1,   44,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,  302,   -1,  304,   -1,   -1,
+   59,   -1,   61,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  329,   -1,   -1,   -1,  333,  334,  335,  336,
+   -1,   -1,   91,   -1,  257,  258,   -1,   -1,   -1,  262,
+  263,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,   -1,  123,   40,   41,   -1,   -1,   44,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,  302,
+   -1,  304,   -1,   -1,   59,   -1,   61,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  329,   -1,   -1,   -1,
+  333,  334,  335,  336,  257,  258,   91,   -1,   -1,  262,
+  263,   -1,   -1,  266,  267,  268,  269,  270,  271,   -1,
+  273,   -1,   -1,   -1,  277,  278,  279,  280,   -1,  282,
+   -1,  284,  285,   -1,   -1,   40,   41,   -1,  123,   44,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,  302,
+   -1,  304,   -1,   58,   59,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  329,   -1,   -1,   -1,
+  333,  334,  335,  336,   -1,   -1,   91,   -1,  257,  258,
+   -1,   -1,   -1,  262,  263,   -1,   -1,  266,  267,  268,
+  269,  270,  271,   -1,  273,   -1,   -1,   -1,  277,  278,
+  279,  280,   -1,  282,   -1,  284,  285,   -1,  123,   40,
+   41,   -1,   -1,   44,   -1,   -1,  295,   -1,   -1,   -1,
+   -1,   -1,   -1,  302,   -1,  304,   -1,   -1,   59,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  329,   -1,   -1,   -1,  333,  334,  335,  336,   -1,   -1,
+   -1,   -1,  257,  258,   -1,   -1,   -1,  262,  263,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   -1,  123,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,  302,   -1,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  329,   -1,   -1,   -1,  333,  334,
+  335,  336,  257,  258,   -1,   -1,   -1,  262,  263,   -1,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,   -1,
+   -1,   -1,  277,  278,  279,  280,   -1,  282,   -1,  284,
+  285,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,  302,   -1,  304,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   37,   38,
+   -1,   -1,   -1,   42,   43,   44,   45,   46,   47,   -1,
+   -1,   -1,   -1,   -1,  329,   -1,   -1,   -1,  333,  334,
+   59,   -1,   61,   -1,   63,   -1,  257,  258,   -1,   -1,
+   -1,   -1,  263,   -1,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,   -1,   -1,   -1,  277,  278,  279,  280,
+   -1,  282,   91,  284,  285,   94,   -1,   37,   38,   -1,
+   40,   -1,   42,   43,  295,   45,   46,   47,   -1,   -1,
+   -1,  302,   -1,  304,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   61,   -1,   63,  123,  124,  125,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  329,   -1,
+   -1,   -1,  333,  334,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   93,   94,   37,   38,   -1,   40,   41,
+   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   61,
+   -1,   63,   -1,  123,  124,   -1,   -1,   -1,   -1,   -1,
+   37,   38,   -1,   40,   41,   42,   43,   -1,   45,   46,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   91,
+   -1,   -1,   94,   -1,   61,   -1,   63,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  124,   -1,   91,   37,   38,   94,   40,   -1,
+   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   61,
+   -1,   63,   -1,   -1,   -1,   -1,   -1,  124,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  284,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   91,
+   -1,   93,   94,   -1,   -1,   -1,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,  322,  323,  324,  325,  326,  327,  328,
+  329,   -1,  124,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  284,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+   -1,   -1,   -1,   -1,   -1,   -1,   37,   38,   -1,   40,
+   -1,   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,
+   61,   -1,   63,  305,  306,  307,  308,  309,  310,  311,
+  312,  313,   -1,  315,  316,  317,  318,  319,  320,  321,
+  322,  323,  324,  325,  326,  327,  328,  329,  295,   -1,
+   91,   -1,   93,   94,   -1,   -1,   -1,   -1,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+  327,  328,  329,  124,   37,   38,   -1,   40,   -1,   42,
+   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  295,   -1,   58,   -1,   -1,   61,   -1,
+   63,   -1,   -1,  305,  306,  307,  308,  309,  310,  311,
+  312,  313,   -1,  315,  316,  317,  318,  319,  320,  321,
+  322,  323,  324,  325,  326,  327,  328,  329,   91,   37,
+   38,   94,   40,   -1,   42,   43,   -1,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,
+   -1,  124,   -1,   -1,   37,   38,   -1,   40,   41,   42,
+   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   91,   -1,   93,   94,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  124,   -1,   91,   -1,
+   -1,   94,   -1,   -1,   -1,   -1,   37,   38,   -1,   40,
+   41,   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   61,  124,   63,   -1,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,   -1,
+   91,   37,   38,   94,   40,   41,   42,   43,   -1,   45,
+   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   61,   -1,   63,   -1,   -1,
+   -1,   -1,   -1,  124,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   91,   -1,   -1,   94,   -1,
+   -1,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,  324,  325,  326,  327,  328,  329,   -1,  124,   -1,
+   37,   38,   -1,   40,   -1,   42,   43,   -1,   45,   46,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+   -1,   -1,   -1,   -1,   61,   -1,   63,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,  329,  295,   -1,   91,   -1,   93,   94,   -1,   -1,
+   -1,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,  324,  325,  326,  327,  328,  329,  124,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,   -1,
+   37,   38,   -1,   40,   41,   42,   43,   -1,   45,   46,
+   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   -1,   61,   -1,   63,   -1,   -1,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,   -1,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,  328,  329,   91,   -1,   -1,   94,   37,   38,
+   -1,   40,   41,   42,   43,   -1,   45,   46,   47,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   61,   -1,   63,   -1,   -1,  124,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   91,   -1,   -1,   94,   -1,   -1,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+  327,  328,  329,   37,   38,  124,   40,   41,   42,   43,
+   -1,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   61,   -1,   63,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   37,   38,
+   -1,   40,   41,   42,   43,   -1,   45,   46,   47,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,
+   94,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+  124,   -1,   91,   -1,   -1,   94,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,
+   -1,   -1,   -1,   -1,   -1,  124,   -1,   -1,  305,  306,
+  307,  308,  309,  310,  311,  312,  313,   -1,  315,  316,
+  317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+  327,  328,  329,   -1,   -1,   -1,   -1,   37,   38,   -1,
+   40,   -1,   42,   43,   -1,   45,   46,   47,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,
+   -1,   61,   -1,   63,   -1,   -1,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,  322,  323,  324,  325,  326,  327,  328,
+  329,   91,   -1,   93,   94,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  124,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+   -1,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+  324,  325,  326,  327,  328,  329,  295,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,  307,  308,
+  309,  310,  311,  312,  313,   -1,  315,  316,  317,  318,
+  319,  320,  321,  322,  323,  324,  325,  326,  327,  328,
+  329,   37,   38,   -1,   40,   -1,   42,   43,   -1,   45,
+   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   58,   -1,   -1,   61,   -1,   63,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   37,   38,   -1,   40,
+   -1,   42,   43,   44,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,   94,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,  124,   -1,
+   91,   -1,   -1,   94,   -1,  305,  306,  307,  308,  309,
+  310,  311,  312,  313,   -1,  315,  316,  317,  318,  319,
+  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
+   -1,   37,   38,  124,   40,   -1,   42,   43,   -1,   45,
+   46,   47,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   61,   -1,   63,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   37,   38,   -1,   40,
+   -1,   42,   43,   -1,   45,   46,   47,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   91,   -1,   -1,   94,   -1,
+   61,   -1,   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   37,   38,   -1,   40,   -1,   42,   43,   -1,   45,
+   -1,   47,   -1,   -1,   -1,   -1,   -1,   -1,  124,   -1,
+   91,   -1,   -1,   94,   -1,   61,   -1,   63,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,  124,   -1,   91,   -1,   93,   94,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,  124,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,  328,  329,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,   37,
+   38,   -1,   40,   -1,   42,   43,   -1,   45,   -1,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   91,   -1,   93,   94,   -1,   -1,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,   -1,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+  326,  327,  328,  329,  295,   -1,  124,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,  305,  306,  307,  308,  309,  310,
+  311,  312,  313,   -1,  315,  316,  317,  318,  319,  320,
+  321,  322,  323,  324,  325,  326,  327,  328,  329,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,
+  306,  307,  308,  309,  310,  311,  312,  313,   -1,  315,
+  316,  317,  318,  319,  320,  321,  322,  323,  324,  325,
+   -1,  327,  328,  329,   37,   38,   -1,   40,   -1,   42,
+   43,   -1,   45,   -1,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   37,
+   38,   -1,   40,   -1,   42,   43,   -1,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   91,   -1,
+   93,   94,   -1,   61,   -1,   63,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   37,
+   38,  124,   40,   91,   42,   43,   94,   45,   46,   47,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+   -1,   -1,   -1,   61,   -1,   63,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,  124,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,   -1,  327,
+  328,  329,   -1,   91,   37,   38,   94,   40,   -1,   42,
+   43,   -1,   45,   46,   47,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   61,   -1,
+   63,   -1,   -1,   -1,   -1,   -1,  124,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   91,   -1,
+   -1,   94,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  124,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   91,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   -1,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,  324,  325,   -1,  327,  328,  329,  295,   -1,   -1,
+   91,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  305,  306,  307,
+  308,  309,  310,  311,  312,  313,   -1,  315,  316,  317,
+  318,  319,  320,  321,  322,  323,  324,  325,  326,  327,
+  328,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   91,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  305,  306,  307,  308,  309,  310,  311,  312,
+  313,   91,  315,  316,  317,  318,  319,  320,  321,  322,
+  323,  324,  325,  326,  327,  328,  257,  258,   -1,   -1,
+   -1,  262,  263,  264,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,  257,  258,  289,   -1,
+   -1,  262,  263,  264,  295,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,  340,
+  341,  342,  343,  344,  345,  346,  347,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,  340,
+  341,  342,  343,  344,  345,  346,  347,  257,  258,   -1,
+   -1,   -1,  262,  263,  264,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,  257,  258,  289,
+   -1,   -1,  262,  263,  264,  295,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+  340,  341,  342,  343,  344,  345,  346,  347,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+  340,  341,  342,  343,  344,  345,  346,  347,   -1,   -1,
+   -1,  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,  257,  258,  289,   -1,   -1,  262,  263,  264,  295,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,
+   91,   -1,   -1,   -1,  340,  341,  342,  343,  344,  345,
+  346,  347,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,
+   91,   -1,   -1,   -1,  340,  341,  342,  343,  344,  345,
+  346,  347,  257,  258,   -1,   -1,   -1,  262,  263,  264,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,  257,  258,  289,   -1,   -1,  262,  263,  264,
+  295,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   91,   -1,   -1,   -1,  340,  341,  342,  343,  344,
+  345,  346,  347,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   91,   -1,   -1,   -1,  340,  341,  342,  343,  344,
+  345,  346,  347,   -1,   -1,   -1,  257,  258,   -1,   -1,
+   -1,  262,  263,  264,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,  257,  258,  289,   -1,
+   -1,  262,  263,  264,  295,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,  340,
+  341,  342,  343,  344,  345,  346,  347,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,  340,
+  341,  342,  343,  344,  345,  346,  347,  257,  258,   -1,
+   -1,   -1,  262,  263,  264,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,  257,  258,  289,
+   -1,   -1,  262,  263,  264,  295,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+  340,  341,  342,  343,  344,  345,  346,  347,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+  340,  341,  342,  343,  344,  345,  346,  347,   -1,   -1,
+   -1,  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,  257,  258,  289,   -1,   -1,  262,  263,  264,  295,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,
+   91,   -1,   -1,   -1,  340,  341,  342,  343,  344,  345,
+  346,  347,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,
+   91,   -1,   -1,   -1,  340,  341,  342,  343,  344,  345,
+  346,  347,  257,  258,   -1,   -1,   -1,  262,  263,  264,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,  257,  258,  289,   -1,   -1,  262,  263,  264,
+  295,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   91,   -1,   -1,   -1,  340,  341,  342,  343,  344,
+  345,  346,  347,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   91,   -1,   -1,   -1,  340,  341,  342,  343,  344,
+  345,  346,  347,   -1,   -1,   -1,  257,  258,   -1,   -1,
+   -1,  262,  263,  264,   -1,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,  257,  258,  289,   -1,
+   -1,  262,  263,  264,  295,  266,  267,  268,  269,  270,
+  271,   -1,  273,  274,  275,   -1,  277,  278,  279,   -1,
+   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,   -1,
+   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,   -1,
+   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,  340,
+  341,  342,  343,  344,  345,  346,  347,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,  340,
+  341,  342,  343,  344,  345,  346,  347,  257,  258,   -1,
+   -1,   -1,  262,  263,  264,   -1,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,  257,  258,  289,
+   -1,   -1,  262,  263,  264,  295,  266,  267,  268,  269,
+  270,  271,   -1,  273,  274,  275,   -1,  277,  278,  279,
+   -1,   -1,   -1,   -1,  284,  285,   -1,   -1,   -1,  289,
+   -1,   -1,   -1,   -1,   -1,  295,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+  340,  341,  342,  343,  344,  345,  346,  347,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,  332,  333,  334,  335,   91,   -1,   -1,   -1,
+  340,  341,  342,  343,  344,  345,  346,  347,   -1,   -1,
+   -1,  257,  258,   -1,   -1,   -1,  262,  263,  264,   -1,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,  257,  258,  289,   -1,   -1,  262,  263,  264,  295,
+  266,  267,  268,  269,  270,  271,   -1,  273,  274,  275,
+   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,  285,
+   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,  295,
+   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,
+   -1,   -1,   -1,   -1,  340,  341,  342,  343,  344,  345,
+  346,  347,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,  335,
+   -1,   -1,   -1,   -1,  340,  341,  342,  343,  344,  345,
+  346,  347,  257,  258,   -1,   -1,   -1,  262,  263,  264,
+   -1,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,  257,  258,  289,   -1,   -1,  262,  263,  264,
+  295,  266,  267,  268,  269,  270,  271,   -1,  273,  274,
+  275,   -1,  277,  278,  279,   -1,   -1,   -1,   -1,  284,
+  285,   -1,   -1,   -1,  289,   -1,   -1,   -1,   -1,   -1,
+  295,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   -1,   -1,   -1,   -1,  340,  341,  342,  343,  344,
+  345,  346,  347,   -1,   -1,   -1,   -1,   -1,   -1,   -1,
+   -1,   -1,   -1,   -1,   -1,   -1,   -1,  332,  333,  334,
+  335,   -1,   -1,   -1,   -1,  340,  341,  342,  343,  344,
+  345,  346,  347,
+};
+static int yyctable[] = {                                      1,
+  397,   -1,    2,  397,   -1,    6,  397,   -1,    7,  397,
+   -1,    8,  397,   -1,   10,  397,   -1,   11,  397,   -1,
+   12,  397,   -1,   13,  397,   -1,   14,  397,   -1,   15,
+  397,   -1,   16,  397,   -1,   17,  397,   -1,   18,  397,
+   -1,   20,  397,   -1,   21,  397,   -1,   22,  397,   -1,
+   25,  397,   -1,   26,  397,   -1,   27,  397,   -1,   28,
+  397,   -1,   46,  397,   -1,   50,  397,   -1,   51,  397,
+   -1,   52,  397,   -1,   53,  397,   -1,   58,  397,   -1,
+   59,  397,   -1,   60,  397,   -1,   61,  397,   -1,   62,
+  397,   -1,   63,  397,   -1,   64,  397,   -1,   65,  397,
+   -1,    1,  535,   -1,  165,  524,   -1,  166,  397,   -1,
+  167,  397,   -1,  168,  397,   -1,  169,  397,   -1,  170,
+  397,   -1,  171,  397,   -1,  172,  397,   -1,  173,  397,
+   -1,    1,  518,   -1,    1,  141,   -1,    2,  141,   -1,
+    6,  141,   -1,   10,  141,   -1,   11,  141,   -1,   12,
+  141,   -1,   13,  141,   -1,  202,  141,   -1,  168,  141,
+   -1,  203,  141,   -1,  192,  141,   -1,   21,  141,   -1,
+   22,  141,   -1,  204,  141,   -1,   26,  141,   -1,   28,
+  141,   -1,  205,  141,   -1,  206,  141,   -1,   52,  141,
+   -1,   53,  141,   -1,   54,  141,   -1,    1,  495,  518,
+   -1,    2,  495,  518,   -1,    6,  495,  518,   -1,    7,
+  495,   -1,  192,  495,  518,   -1,  211,  495,   -1,   53,
+  495,  518,   -1,  496,  518,   -1,    7,  496,   -1,    1,
+  497,   -1,    2,  497,   -1,    6,  497,   -1,  192,  497,
+   -1,   53,  497,   -1,   10,  135,   -1,   11,  135,   -1,
+   12,  135,   -1,   13,  135,   -1,   26,  135,   -1,    1,
+  611,   -1,    2,  611,   -1,    3,  611,   -1,    4,  611,
+   -1,    5,  611,   -1,    6,  611,   -1,   10,  611,   -1,
+   11,  611,   -1,   12,  611,   -1,   13,  611,   -1,  202,
+  611,   -1,  168,  611,   -1,  203,  611,   -1,  192,  611,
+   -1,   21,  611,   -1,   22,  611,   -1,   26,  611,   -1,
+   28,  611,   -1,   29,  611,   -1,   30,  611,   -1,   31,
+  611,   -1,   32,  611,   -1,  205,  611,   -1,   37,  611,
+   -1,   38,  611,   -1,   45,  611,   -1,  238,  611,   -1,
+   52,  611,   -1,   53,  611,   -1,   54,  611,   -1,   57,
+  611,   -1,  239,  611,   -1,    1,  272,  396,   -1,    2,
+  272,  396,   -1,    6,  272,  396,   -1,    7,  272,  396,
+   -1,  166,  272,  396,   -1,   10,  272,  396,   -1,   11,
+  272,  396,   -1,   12,  272,  396,   -1,   13,  272,  396,
+   -1,  245,  272,  396,   -1,   15,  272,  396,   -1,   16,
+  272,  396,   -1,   17,  272,  396,   -1,   18,  272,  396,
+   -1,   20,  272,  396,   -1,   21,  272,  396,   -1,   22,
+  272,  396,   -1,  169,  272,  396,   -1,   26,  272,  396,
+   -1,  170,  272,  396,   -1,   28,  272,  396,   -1,  171,
+  272,  396,   -1,   50,  272,  396,   -1,   51,  272,  396,
+   -1,   52,  272,  396,   -1,   53,  272,  396,   -1,   58,
+  272,  396,   -1,   59,  272,  396,   -1,   60,  272,  396,
+   -1,   61,  272,  396,   -1,   62,  272,  396,   -1,  173,
+  272,  396,   -1,   64,  272,  396,   -1,   65,  272,  396,
+   -1,    1,  395,   -1,    2,  395,   -1,    6,  395,   -1,
+   10,  395,   -1,   11,  395,   -1,   12,  395,   -1,   13,
+  395,   -1,  202,  395,   -1,  168,  395,   -1,  331,  395,
+   -1,  332,  395,   -1,  333,  395,   -1,   20,  395,   -1,
+   21,  395,   -1,   22,  395,   -1,  169,  395,   -1,   26,
+  395,   -1,   28,  395,   -1,   52,  395,   -1,   53,  395,
+   -1,  334,  395,   -1,    1,  609,   -1,    2,  609,   -1,
+    3,  609,   -1,    4,  609,   -1,    5,  609,   -1,    6,
+  609,   -1,   10,  609,   -1,   11,  609,   -1,   12,  609,
+   -1,   13,  609,   -1,  202,  609,   -1,  168,  609,   -1,
+  203,  609,   -1,  192,  609,   -1,   21,  609,   -1,   22,
+  609,   -1,   23,  609,   -1,   24,  609,   -1,   26,  609,
+   -1,   28,  609,   -1,   29,  609,   -1,   30,  609,   -1,
+   31,  609,   -1,   32,  609,   -1,  205,  609,   -1,   37,
+  609,   -1,   38,  609,   -1,   45,  609,   -1,  238,  609,
+   -1,   52,  609,   -1,   53,  609,   -1,   54,  609,   -1,
+   57,  609,   -1,  239,  609,   -1,  358,    2,   -1,  364,
+  533,   -1,    6,  520,   -1,  377,  520,   -1,  380,  137,
+   -1,  381,  137,  537,   -1,  137,  537,   -1,  382,  537,
+   -1,  383,  137,  537,   -1,    1,  255,   -1,    2,  255,
+   -1,    6,  255,   -1,   10,  255,   -1,   11,  255,   -1,
+   12,  255,   -1,   13,  255,   -1,  202,  255,   -1,  168,
+  255,   -1,  203,  255,   -1,  192,  255,   -1,   21,  255,
+   -1,   22,  255,   -1,  385,  255,   -1,   26,  255,   -1,
+  386,  255,   -1,  255,  314,   -1,   52,  255,   -1,   53,
+  255,   -1,  396,  115,   -1,  397,  115,   -1,  400,  313,
+   -1,  404,  110,   -1,  405,  110,   -1,   40,  127,   -1,
+  406,   40,  127,   -1,  407,   40,  127,   -1,   23,    3,
+   -1,   24,    3,   -1,   23,   16,   -1,   24,   16,   -1,
+  229,   16,   -1,  495,   18,   -1,  498,  230,   -1,  499,
+  295,   -1,  294,  295,   -1,  500,  294,  295,   -1,  502,
+  295,   -1,  503,  295,   -1,    2,  518,   -1,    6,  518,
+   -1,  192,  518,   -1,  171,  518,   -1,   53,  518,   -1,
+    1,  391,  397,   -1,    2,  391,  397,   -1,    6,  391,
+  397,   -1,    7,  391,  397,   -1,  166,  391,  397,   -1,
+   10,  391,  397,   -1,   11,  391,  397,   -1,   12,  391,
+  397,   -1,   13,  391,  397,   -1,  245,  391,  397,   -1,
+  168,  391,  397,   -1,   16,  391,  397,   -1,   17,  391,
+  397,   -1,   18,  391,  397,   -1,   20,  391,  397,   -1,
+   21,  391,  397,   -1,   22,  391,  397,   -1,  169,  391,
+  397,   -1,   26,  391,  397,   -1,  170,  391,  397,   -1,
+   28,  391,  397,   -1,  171,  391,  397,   -1,   50,  391,
+  397,   -1,  529,  391,  397,   -1,   52,  391,  397,   -1,
+   53,  391,  397,   -1,   58,  391,  397,   -1,   59,  391,
+  397,   -1,   60,  391,  397,   -1,   61,  391,  397,   -1,
+   62,  391,  397,   -1,  173,  391,  397,   -1,   64,  391,
+  397,   -1,   65,  391,  397,   -1,    1,  398,   -1,    2,
+  398,   -1,    6,  398,   -1,    7,  398,   -1,  166,  398,
+   -1,   10,  398,   -1,   11,  398,   -1,   12,  398,   -1,
+   13,  398,   -1,  245,  398,   -1,   15,  398,   -1,   16,
+  398,   -1,   17,  398,   -1,   18,  398,   -1,   20,  398,
+   -1,   21,  398,   -1,   22,  398,   -1,  169,  398,   -1,
+   26,  398,   -1,  170,  398,   -1,   28,  398,   -1,  171,
+  398,   -1,   50,  398,   -1,  439,  398,   -1,   52,  398,
+   -1,   53,  398,   -1,   58,  398,   -1,   59,  398,   -1,
+   60,  398,   -1,   61,  398,   -1,   62,  398,   -1,  173,
+  398,   -1,   64,  398,   -1,   65,  398,   -1,  162,  518,
+   -1,  272,  396,   -1,  378,  520,   -1,  557,  137,   -1,
+  381,  137,   -1,  382,  137,   -1,   23,  255,   -1,   24,
+  255,   -1,  406,  127,   -1,  562,  230,   -1,  168,  398,
+   -1,  172,  398,   -1,  557,  143,   -1,  381,  143,   -1,
+  382,  143,   -1,  578,  137,   -1,  579,  314,   -1,  580,
+  314,   -1,  557,  255,   -1,  381,  255,   -1,  121,  156,
+   -1,  557,  144,   -1,  381,  144,   -1,  382,  144,   -1,
+  381,  138,   -1,  578,  137,  537,   -1,  382,  137,  537,
+   -1,  384,  137,  537,   -1,  455,  610,   -1,  474,  610,
+   -1,  475,  610,   -1,  489,  610,   -1,  490,  610,   -1,
+  604,  357,   -1,  605,  359,   -1,  255,  361,   -1,  500,
+  295,   -1,  455,  549,   -1,  474,  549,   -1,  475,  549,
+   -1,  489,  549,   -1,  490,  549,   -1,  455,  551,   -1,
+  474,  551,   -1,  475,  551,   -1,  489,  551,   -1,  490,
+  551,   -1,  455,  543,   -1,  474,  543,   -1,  475,  543,
+   -1,  489,  543,   -1,  490,  543,   -1,  455,  546,   -1,
+  474,  546,   -1,  475,  546,   -1,  489,  546,   -1,  490,
+  546,   -1,  313,  548,   -1,  455,  547,   -1,  474,  547,
+   -1,  475,  547,   -1,  489,  547,   -1,  490,  547,   -1,
+  612,  115,   -1,  455,  544,   -1,  474,  544,   -1,  475,
+  544,   -1,  489,  544,   -1,  490,  544,   -1,  455,  545,
+   -1,  474,  545,   -1,  475,  545,   -1,  489,  545,   -1,
+  490,  545,   -1,  455,  628,   -1,  456,  628,   -1,  457,
+  628,   -1,  458,  628,   -1,  459,  628,   -1,  460,  628,
+   -1,  461,  628,   -1,  462,  628,   -1,  463,  628,   -1,
+  464,  628,   -1,  465,  628,   -1,  466,  628,   -1,  467,
+  628,   -1,  468,  628,   -1,  469,  628,   -1,  470,  628,
+   -1,  471,  628,   -1,  472,  628,   -1,  473,  628,   -1,
+  474,  628,   -1,  475,  628,   -1,  476,  628,   -1,  477,
+  628,   -1,  478,  628,   -1,  479,  628,   -1,  480,  628,
+   -1,  481,  628,   -1,  482,  628,   -1,  483,  628,   -1,
+  484,  628,   -1,  485,  628,   -1,  486,  628,   -1,  487,
+  628,   -1,  488,  628,   -1,  619,  628,   -1,  489,  628,
+   -1,  490,  628,   -1,  492,  628,   -1,  493,  628,   -1,
+  620,  629,   -1,  579,  255,   -1,  580,  255,   -1,  387,
+  255,   -1,  388,  255,   -1,  389,  255,   -1,  455,  603,
+   -1,  474,  603,   -1,  475,  603,   -1,  489,  603,   -1,
+  490,  603,   -1,  639,  631,   -1,  455,  606,   -1,  474,
+  606,   -1,  475,  606,   -1,  489,  606,   -1,  490,  606,
+   -1,  506,  305,   -1,  507,  305,   -1,    3,  105,   -1,
+    3,  107,   -1,  245,  397,   -1,  529,  397,   -1,    1,
+  110,   -1,    2,  110,   -1,    3,  110,   -1,    4,  110,
+   -1,    5,  110,   -1,    6,  110,   -1,   10,  110,   -1,
+   11,  110,   -1,   12,  110,   -1,   13,  110,   -1,  202,
+  110,   -1,  168,  110,   -1,  203,  110,   -1,  192,  110,
+   -1,   21,  110,   -1,   22,  110,   -1,  613,  110,   -1,
+  614,  110,   -1,   25,  110,   -1,   26,  110,   -1,   28,
+  110,   -1,   29,  110,   -1,   30,  110,   -1,   31,  110,
+   -1,   32,  110,   -1,   34,  110,   -1,   35,  110,   -1,
+  205,  110,   -1,   37,  110,   -1,   38,  110,   -1,   39,
+  110,   -1,   40,  110,   -1,   41,  110,   -1,   42,  110,
+   -1,  237,  110,   -1,   44,  110,   -1,   45,  110,   -1,
+  238,  110,   -1,   48,  110,   -1,   49,  110,   -1,   52,
+  110,   -1,   53,  110,   -1,   54,  110,   -1,   57,  110,
+   -1,   72,  110,   -1,  239,  110,   -1,  672,  629,   -1,
+  673,  629,   -1,  677,  137,   -1,  383,  137,   -1,  292,
+  295,   -1,  499,  292,  295,   -1,  500,  292,  294,   -1,
+  292,  294,  295,   -1,  292,  294,   -1,  501,  292,   -1,
+  502,  292,  295,   -1,  503,  292,  295,   -1,  504,  292,
+   -1,  506,  306,   -1,  507,  306,   -1,  506,  433,   -1,
+  511,  433,   -1,  513,  433,   -1,  499,  453,   -1,  506,
+  453,   -1,  517,  453,   -1,  501,  453,   -1,  502,  453,
+   -1,  503,  453,   -1,  504,  453,   -1,  523,  277,   -1,
+    1,  391,   -1,    2,  391,   -1,    6,  391,   -1,    7,
+  391,   -1,  166,  391,   -1,   10,  391,   -1,   11,  391,
+   -1,   12,  391,   -1,   13,  391,   -1,  245,  391,   -1,
+  168,  391,   -1,   16,  391,   -1,   17,  391,   -1,   18,
+  391,   -1,   20,  391,   -1,   21,  391,   -1,   22,  391,
+   -1,  169,  391,   -1,   26,  391,   -1,  170,  391,   -1,
+   28,  391,   -1,  171,  391,   -1,   50,  391,   -1,  529,
+  391,   -1,   52,  391,   -1,   53,  391,   -1,   58,  391,
+   -1,   59,  391,   -1,   60,  391,   -1,   61,  391,   -1,
+   62,  391,   -1,  173,  391,   -1,   64,  391,   -1,   65,
+  391,   -1,  406,   42,   -1,  145,  148,   -1,  710,  256,
+   -1,  711,  256,   -1,  712,  256,   -1,  145,  248,   -1,
+  723,  518,   -1,  251,  316,   -1,  137,  250,   -1,  439,
+  272,  396,   -1,  742,  137,   -1,  421,  234,   -1,  423,
+  234,   -1,  243,  474,   -1,  387,  474,   -1,  388,  474,
+   -1,  389,  474,   -1,  390,  474,   -1,  506,  307,   -1,
+  507,  307,   -1,  428,  434,   -1,  506,  428,   -1,  511,
+  428,   -1,  513,  428,   -1,  514,  428,   -1,  523,  278,
+   -1,  787,  293,   -1,  788,  293,   -1,  789,  293,   -1,
+  790,  293,   -1,  791,  293,   -1,  787,  455,   -1,  788,
+  455,   -1,  789,  455,   -1,  790,  455,   -1,  791,  455,
+   -1,    1,  466,   -1,    2,  466,   -1,    6,  466,   -1,
+  192,  466,   -1,   53,  466,   -1,  168,  272,  396,   -1,
+  529,  272,  396,   -1,    1,  247,   -1,    2,  247,   -1,
+    6,  247,   -1,    7,  247,   -1,  192,  247,   -1,  558,
+  247,   -1,  412,  247,   -1,   53,  247,   -1,  559,  247,
+   -1,  419,  235,   -1,  420,  235,   -1,  421,  235,   -1,
+  422,  235,   -1,  423,  235,   -1,  424,  235,   -1,  506,
+  308,   -1,  507,  308,   -1,  427,  434,   -1,  506,  427,
+   -1,  511,  427,   -1,  513,  427,   -1,  514,  427,   -1,
+  499,  454,   -1,   23,  454,   -1,   24,  454,   -1,  506,
+  454,   -1,  517,  454,   -1,  501,  454,   -1,  502,  454,
+   -1,  503,  454,   -1,  504,  454,   -1,  229,  454,   -1,
+  523,  275,   -1,  115,  163,   -1,  500,  292,   -1,  579,
+  361,   -1,  580,  361,   -1,  835,  361,   -1,  259,  362,
+   -1,  861,  518,   -1,  617,  247,   -1,  111,  113,   -1,
+  112,  114,   -1,  627,  629,   -1,  620,  627,  629,   -1,
+  868,  628,   -1,  145,  616,   -1,    1,  550,   -1,    2,
+  550,   -1,    3,  550,   -1,    4,  550,   -1,    5,  550,
+   -1,    6,  550,   -1,   10,  550,   -1,   11,  550,   -1,
+   12,  550,   -1,   13,  550,   -1,  202,  550,   -1,  168,
+  550,   -1,  203,  550,   -1,  192,  550,   -1,   21,  550,
+   -1,   22,  550,   -1,   26,  550,   -1,   28,  550,   -1,
+   29,  550,   -1,   30,  550,   -1,   31,  550,   -1,   32,
+  550,   -1,  205,  550,   -1,   37,  550,   -1,   38,  550,
+   -1,   45,  550,   -1,  238,  550,   -1,   52,  550,   -1,
+   53,  550,   -1,   54,  550,   -1,   57,  550,   -1,  239,
+  550,   -1,    1,  552,   -1,    2,  552,   -1,    3,  552,
+   -1,    4,  552,   -1,    5,  552,   -1,    6,  552,   -1,
+   10,  552,   -1,   11,  552,   -1,   12,  552,   -1,   13,
+  552,   -1,  202,  552,   -1,  168,  552,   -1,  203,  552,
+   -1,  192,  552,   -1,   21,  552,   -1,   22,  552,   -1,
+   26,  552,   -1,   28,  552,   -1,   29,  552,   -1,   30,
+  552,   -1,   31,  552,   -1,   32,  552,   -1,  205,  552,
+   -1,   37,  552,   -1,   38,  552,   -1,   45,  552,   -1,
+  238,  552,   -1,   52,  552,   -1,   53,  552,   -1,   54,
+  552,   -1,   57,  552,   -1,  239,  552,   -1,  777,  631,
+   -1,  882,  628,   -1,  364,  106,   -1,  364,  108,   -1,
+    1,   88,   -1,  884,   88,   -1,  885,   88,   -1,  886,
+   88,   -1,  578,  117,   -1,  381,  117,   -1,  382,  117,
+   -1,  909,  115,   -1,  255,  314,  518,   -1,  479,  383,
+   -1,  294,  295,  373,   -1,  137,   -1,  381,  137,  138,
+   -1,  580,  139,   -1,  488,  233,   -1,  489,  233,   -1,
+  490,  233,   -1,  455,  565,   -1,  474,  565,   -1,  475,
+  565,   -1,  489,  565,   -1,  490,  565,   -1,  455,  566,
+   -1,  474,  566,   -1,  475,  566,   -1,  489,  566,   -1,
+  490,  566,   -1,  455,  567,   -1,  474,  567,   -1,  475,
+  567,   -1,  489,  567,   -1,  490,  567,   -1,  455,  568,
+   -1,  474,  568,   -1,  475,  568,   -1,  489,  568,   -1,
+  490,  568,   -1,  455,  569,   -1,  474,  569,   -1,  475,
+  569,   -1,  489,  569,   -1,  490,  569,   -1,  455,  570,
+   -1,  474,  570,   -1,  475,  570,   -1,  489,  570,   -1,
+  490,  570,   -1,  455,  571,   -1,  474,  571,   -1,  475,
+  571,   -1,  489,  571,   -1,  490,  571,   -1,  455,  572,
+   -1,  474,  572,   -1,  475,  572,   -1,  489,  572,   -1,
+  490,  572,   -1,  455,  573,   -1,  474,  573,   -1,  475,
+  573,   -1,  489,  573,   -1,  490,  573,   -1,  455,  575,
+   -1,  474,  575,   -1,  475,  575,   -1,  489,  575,   -1,
+  490,  575,   -1,  455,  576,   -1,  474,  576,   -1,  475,
+  576,   -1,  489,  576,   -1,  490,  576,   -1,  455,  577,
+   -1,  474,  577,   -1,  475,  577,   -1,  489,  577,   -1,
+  490,  577,   -1,  455,  578,   -1,  474,  578,   -1,  475,
+  578,   -1,  489,  578,   -1,  490,  578,   -1,  455,  579,
+   -1,  474,  579,   -1,  475,  579,   -1,  489,  579,   -1,
+  490,  579,   -1,  455,  580,   -1,  474,  580,   -1,  475,
+  580,   -1,  489,  580,   -1,  490,  580,   -1,  455,  581,
+   -1,  474,  581,   -1,  475,  581,   -1,  489,  581,   -1,
+  490,  581,   -1,  455,  582,   -1,  474,  582,   -1,  475,
+  582,   -1,  489,  582,   -1,  490,  582,   -1,  455,  583,
+   -1,  474,  583,   -1,  475,  583,   -1,  489,  583,   -1,
+  490,  583,   -1,  455,  562,   -1,  474,  562,   -1,  475,
+  562,   -1,  489,  562,   -1,  490,  562,   -1,  455,  563,
+   -1,  474,  563,   -1,  475,  563,   -1,  489,  563,   -1,
+  490,  563,   -1,  455,  553,   -1,  474,  553,   -1,  475,
+  553,   -1,  489,  553,   -1,  490,  553,   -1,  455,  554,
+   -1,  474,  554,   -1,  475,  554,   -1,  489,  554,   -1,
+  490,  554,   -1,  455,  555,   -1,  474,  555,   -1,  475,
+  555,   -1,  489,  555,   -1,  490,  555,   -1,  455,  556,
+   -1,  474,  556,   -1,  475,  556,   -1,  489,  556,   -1,
+  490,  556,   -1,  455,  557,   -1,  474,  557,   -1,  475,
+  557,   -1,  489,  557,   -1,  490,  557,   -1,  455,  560,
+   -1,  474,  560,   -1,  475,  560,   -1,  489,  560,   -1,
+  490,  560,   -1,  455,  558,   -1,  474,  558,   -1,  475,
+  558,   -1,  489,  558,   -1,  490,  558,   -1,  455,  559,
+   -1,  474,  559,   -1,  475,  559,   -1,  489,  559,   -1,
+  490,  559,   -1,  455,  561,   -1,  474,  561,   -1,  475,
+  561,   -1,  489,  561,   -1,  490,  561,   -1,  455,  574,
+   -1,  456,  574,   -1,  457,  574,   -1,  458,  574,   -1,
+  459,  574,   -1,  460,  574,   -1,  461,  574,   -1,  462,
+  574,   -1,  463,  574,   -1,  464,  574,   -1,  465,  574,
+   -1,  466,  574,   -1,  467,  574,   -1,  468,  574,   -1,
+  469,  574,   -1,  470,  574,   -1,  471,  574,   -1,  472,
+  574,   -1,  473,  574,   -1,  474,  574,   -1,  475,  574,
+   -1,  476,  574,   -1,  477,  574,   -1,  478,  574,   -1,
+  479,  574,   -1,  480,  574,   -1,  481,  574,   -1,  482,
+  574,   -1,  483,  574,   -1,  484,  574,   -1,  485,  574,
+   -1,  486,  574,   -1,  487,  574,   -1,  488,  574,   -1,
+  489,  574,   -1,  490,  574,   -1,  492,  574,   -1,  493,
+  574,   -1,  403,  456,   -1,  484,  488,   -1,  964,  488,
+   -1,  965,  488,   -1,  966,  488,   -1,  967,  484,   -1,
+  832,  163,   -1,  557,  117,   -1,  617,  518,   -1,  980,
+  243,   -1,  981,  242,   -1,  162,  495,   -1,  455,  596,
+   -1,  474,  596,   -1,  475,  596,   -1,  489,  596,   -1,
+  490,  596,   -1,  455,  625,   -1,  474,  625,   -1,  475,
+  625,   -1,  489,  625,   -1,  490,  625,   -1,  455,  626,
+   -1,  474,  626,   -1,  475,  626,   -1,  489,  626,   -1,
+  490,  626,   -1,  535,  536,   -1,  455,  543,  554,   -1,
+  543,  554,   -1,  474,  543,  554,   -1,  475,  543,  554,
+   -1,  489,  543,  554,   -1,  490,  543,  554,   -1,  455,
+  546,  555,   -1,  546,  555,   -1,  474,  546,  555,   -1,
+  475,  546,  555,   -1,  489,  546,  555,   -1,  490,  546,
+  555,   -1,  455,  547,  558,   -1,  547,  558,   -1,  474,
+  547,  558,   -1,  475,  547,  558,   -1,  489,  547,  558,
+   -1,  490,  547,  558,   -1,  621,  632,   -1,  951,  628,
+   -1,  455,  607,   -1,  474,  607,   -1,  475,  607,   -1,
+  489,  607,   -1,  490,  607,   -1,  620,  627,   -1, 1067,
+  137,   -1,    1,  176,   -1,    6,  176,   -1,   23,  176,
+   -1,   24,  176,   -1,   56,  176,   -1,   66,  176,   -1,
+  500,  298,   -1, 1100,  115,  163,   -1, 1101,  115,  163,
+   -1, 1103,  115,  163,   -1, 1104,  115,  163,   -1, 1105,
+  115,  163,   -1,  455,  604,   -1,  474,  604,   -1,  475,
+  604,   -1,  489,  604,   -1,  490,  604,   -1,   23,   64,
+   -1,   24,   64,   -1,  455,  564,   -1,  474,  564,   -1,
+  475,  564,   -1,  489,  564,   -1,  490,  564,   -1,  787,
+  299,   -1,  455,  605,   -1,  474,  605,   -1,  475,  605,
+   -1,  489,  605,   -1,  490,  605,   -1,  613,   64,   -1,
+  614,   64,   -1,    1,  152,   -1,    2,  152,   -1,    3,
+  152,   -1,    4,  152,   -1,    5,  152,   -1,    6,  152,
+   -1,   10,  152,   -1,   11,  152,   -1,   12,  152,   -1,
+   13,  152,   -1,  202,  152,   -1,  168,  152,   -1,  203,
+  152,   -1,  192,  152,   -1,   21,  152,   -1,   22,  152,
+   -1,   25,  152,   -1,   26,  152,   -1,   28,  152,   -1,
+   29,  152,   -1,   30,  152,   -1,   31,  152,   -1,   32,
+  152,   -1,   34,  152,   -1,   35,  152,   -1,  205,  152,
+   -1,   37,  152,   -1,   38,  152,   -1,  765,  152,   -1,
+   39,  152,   -1,   40,  152,   -1,   41,  152,   -1,   42,
+  152,   -1,  237,  152,   -1,   44,  152,   -1,   45,  152,
+   -1,  238,  152,   -1,   48,  152,   -1,   49,  152,   -1,
+   52,  152,   -1,   53,  152,   -1,   54,  152,   -1,   57,
+  152,   -1,   72,  152,   -1,  239,  152,   -1,   23,   67,
+   -1,   24,   67,   -1, 1180,   67,   -1, 1181,   67,   -1,
+  404,   68,   -1,  405,   68,   -1,   23,    2,   -1,   24,
+    2,   -1,    1,  154,   -1,    2,  154,   -1,    3,  154,
+   -1,    4,  154,   -1,    5,  154,   -1,    6,  154,   -1,
+   10,  154,   -1,   11,  154,   -1,   12,  154,   -1,   13,
+  154,   -1,  202,  154,   -1,  168,  154,   -1,  203,  154,
+   -1,  192,  154,   -1,   21,  154,   -1,   22,  154,   -1,
+   25,  154,   -1,   26,  154,   -1,   28,  154,   -1,   29,
+  154,   -1,   30,  154,   -1,   31,  154,   -1,   32,  154,
+   -1,   34,  154,   -1,   35,  154,   -1,  205,  154,   -1,
+   37,  154,   -1,   38,  154,   -1,  765,  154,   -1,   39,
+  154,   -1,   40,  154,   -1,   41,  154,   -1,   42,  154,
+   -1,  237,  154,   -1,   44,  154,   -1,   45,  154,   -1,
+  238,  154,   -1,   48,  154,   -1,   49,  154,   -1,   52,
+  154,   -1,   53,  154,   -1,   54,  154,   -1,   57,  154,
+   -1,   72,  154,   -1,  239,  154,   -1,  289,  290,   -1,
+  287,  288,   -1,
+};
+#ifdef YYDESTRUCT
+static int yyastable[] = {                                      0,
+    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,
+   12,   13,   14,   15,   16,   18,   19,   20,   21,   22,
+   23,   24,   25,   27,   29,   30,   34,   40,   41,   42,
+   43,   44,   45,   47,   48,   49,   69,   70,   75,   76,
+   77,   81,   83,   84,   87,   89,   91,   92,   93,   94,
+   95,   96,   97,   98,   99,  100,  101,  102,  103,  104,
+  105,  106,  107,  108,  109,  111,  116,  122,  123,  124,
+  125,  128,  153,  156,  157,  159,  160,  161,  163,  164,
+  167,  168,  169,  170,  171,  172,  173,  175,  176,  179,
+  180,  181,  184,  185,  186,  187,  188,  195,  196,  197,
+  200,  201,  202,  203,  204,  205,  206,  207,  208,  209,
+  210,  211,  212,  213,  214,  217,  218,  222,  229,  230,
+  231,  232,  233,  234,  235,  237,  239,  240,  241,  242,
+  243,  246,  247,  248,  249,  250,  251,  252,  253,  254,
+  255,  256,  259,  260,  261,  263,  264,  273,  274,  276,
+  277,  278,  279,  280,  281,  282,  283,  284,  285,  286,
+  302,  303,  168,  287,   87,    9,   15,   16,   29,   34,
+   89,   95,  107,  159,  160,  161,  164,  168,  175,  179,
+  185,  186,  196,  209,  214,  239,  259,  260,  261,  263,
+   21,   22,  161,  168,   18,  152,  158,  159,  161,  166,
+  168,   15,   18,   29,   49,   95,  161,  164,  170,  245,
+   40,  158,  161,  158,  161,  161,  162,  168,   73,  161,
+  171,   40,  161,   87,   92,  161,  169,  163,  153,  213,
+  217,   73,   73,   73,   73,  213,   83,   89,  153,  161,
+  218,   40,   87,    4,   15,   50,   51,   52,   53,   54,
+   55,   56,   57,   58,   59,   60,   61,   62,   63,   64,
+   65,   66,   67,   68,   69,   70,   71,   72,   73,   74,
+   75,   76,   77,   78,   79,   80,   81,   82,   83,   84,
+   85,   86,   87,   89,   92,   93,  164,  185,  214,  243,
+  260,  263,  218,  218,    6,  218,  218,  169,  218,  168,
+  218,  218,  173,  185,  218,  219,  220,   81,   85,   89,
+  218,  220,  221,  224,  225,  226,   87,  164,  218,   89,
+  218,  159,  186,  187,  214,  239,  246,  263,  294,  168,
+   18,   19,   20,  107,  164,  184,  214,  259,   37,   38,
+   39,  112,  113,  114,  115,  116,  117,  118,  119,  120,
+  121,   87,   87,   87,  176,   87,  220,  154,  173,  208,
+  218,  219,  220,    4,   49,   83,  161,  188,  214,  243,
+  246,  249,  252,  255,  261,  263,    8,   87,  175,   29,
+   40,   73,   87,  153,   29,   40,   67,   77,   81,   94,
+  164,  177,  178,  217,  292,   29,   73,  152,  290,   73,
+   87,  293,  297,   25,   27,   87,   91,  296,   91,  178,
+   40,   87,   95,   98,  159,  161,  165,  245,   85,   87,
+   89,   91,  152,  153,  189,   91,   86,   91,   91,   91,
+  176,   31,   32,   33,  269,   91,  178,   10,   95,  159,
+  161,  168,  184,  186,  206,  209,  246,  249,  251,  252,
+  254,  255,  263,  213,   40,   50,   51,   52,   53,   54,
+   55,   56,   57,   58,   60,   61,   62,   63,   64,   65,
+   66,   67,   68,   69,   70,   71,   72,   73,   74,   75,
+   76,   77,   78,   79,   80,   81,   82,   85,   87,   89,
+   91,  131,  145,  174,  119,   46,  238,   91,    7,   85,
+   94,   97,   98,  110,  262,   47,   85,   91,  213,  271,
+   85,   91,  110,  152,  257,  271,   85,   91,  213,  262,
+  271,   91,   94,  213,  158,  164,  274,  275,   95,  159,
+  185,  186,  188,  188,  196,  185,  214,  246,  249,  251,
+  252,  254,  255,  186,  187,  164,  273,  157,   15,   18,
+  158,  168,  161,   89,  185,  243,   29,   40,   98,  159,
+  161,   91,  158,  186,  185,  161,   91,   85,  158,  168,
+  164,  168,  153,  152,   89,  164,  245,   29,   29,   40,
+   87,   71,  161,  177,  161,  177,  153,   85,  322,  301,
+  218,   87,  185,  185,  185,  185,  238,   87,  185,  218,
+  168,   88,   90,   89,   89,   77,   87,   18,   22,  209,
+  185,   87,   25,   27,  219,  220,   87,   88,   86,   86,
+   88,  218,   40,   69,   70,   75,   76,   77,   81,   87,
+   89,  168,  218,  227,  228,   90,  218,  177,   90,  185,
+  214,   91,  158,   17,  157,  157,  168,  168,    4,   36,
+    4,   36,   17,  168,    8,  168,   17,  187,  218,  173,
+  186,  187,  196,  218,  219,  223,  187,  218,  123,  218,
+  154,   86,  154,   86,  154,  168,   29,  159,  249,  263,
+  214,  249,  252,    6,  157,  168,   49,  161,  168,  169,
+  295,  164,  185,  192,  193,  194,  218,  305,  185,  186,
+  187,  191,  198,  217,  243,  221,  161,  164,   29,   67,
+   77,   81,   94,  177,   83,  168,  194,  218,  194,  221,
+   88,  218,   77,   81,  158,  245,   87,  165,  245,  218,
+   88,  164,  220,   90,  218,  218,  221,  177,  152,  152,
+  152,   29,  218,  218,  218,  218,  218,  218,  218,  218,
+  218,  218,  218,  218,  218,  218,  218,  218,  218,  218,
+   83,  170,  170,  218,   74,  218,  218,  218,  218,  218,
+  218,  218,  218,  218,  218,  221,   90,  218,  218,   77,
+   83,  170,  218,  176,   87,    6,   85,   94,   97,   98,
+  110,   87,   93,  127,   93,  127,  161,  258,  285,   86,
+  213,    6,   93,  127,  161,  275,   91,  152,  266,   91,
+   87,  159,   86,   86,  177,   88,  158,  166,  168,  218,
+  161,   91,  185,  209,  240,  244,  168,   91,  152,  153,
+  152,  153,  183,  164,   77,   71,  198,  185,  177,  177,
+  321,  161,   18,   23,  185,  215,  216,  239,   88,  218,
+   74,   74,   74,   74,  185,  218,   88,   88,   90,   90,
+   77,   96,  304,  304,  218,  218,  218,   90,    6,  218,
+  218,  218,  220,  218,  152,   90,   90,  168,  227,   87,
+  199,   88,  218,    4,    5,    6,   17,  168,   88,   88,
+  218,  219,  152,   91,   91,   91,   88,   88,   87,   88,
+  154,  154,   49,   88,   88,   88,  185,  291,   29,  158,
+  306,  307,  309,   74,   86,   63,  308,   85,   89,   86,
+   88,  191,  154,  178,  168,  312,   74,   86,   74,   88,
+  288,   88,   77,  159,  168,  168,   77,  161,   77,   67,
+   77,   81,   88,   88,   90,  154,  168,  161,  170,   88,
+   90,  152,  170,  170,  185,    6,  161,  270,   87,  153,
+  258,   91,  161,   31,   32,   33,  104,  267,  268,   86,
+  217,  318,  158,  177,  177,  168,  153,   91,  158,   91,
+   91,   91,  152,  153,  164,  183,  164,  183,   86,  154,
+  168,  175,  182,  217,  284,  285,   91,  185,   88,  208,
+   91,  166,  168,  166,  168,   85,  168,   74,   86,   85,
+   88,   87,   87,   87,   87,   88,   88,   88,   88,   90,
+  218,  198,   71,  213,  218,  176,  176,  218,  223,  223,
+  223,  176,  176,  218,  153,   87,   83,  168,   87,  298,
+  193,  217,  218,  218,  218,   90,  218,  191,  315,   87,
+   29,  289,  168,  166,   88,   88,  166,   29,  168,   77,
+   81,  168,  168,   87,  189,  190,   87,  218,  166,   86,
+   88,   88,  220,  154,  220,   98,  265,  268,  267,  267,
+  268,  153,   77,  161,  168,  168,  183,   87,  164,  183,
+   91,  154,  153,  154,  182,   85,  262,  154,   85,   74,
+   86,   85,   74,   85,   86,  218,   85,  216,  218,  218,
+  218,  218,  218,  218,   88,  185,   88,   91,   91,   91,
+   88,  173,  236,  304,  168,  313,  198,  310,  193,   63,
+   74,   90,   87,  198,   83,  168,   88,   88,   88,   77,
+  168,  168,  152,   88,   88,  161,   88,  154,  266,  164,
+  164,  268,  267,  320,  166,   29,   89,  152,  190,  190,
+  154,  198,  153,  154,  183,  218,  185,  185,  218,   88,
+   88,   88,   88,  213,  176,  223,  223,  223,  236,  126,
+  127,  154,  173,   88,  316,   87,   88,  311,  218,  299,
+   88,   88,  168,  314,   87,   87,  166,  218,  213,  318,
+  164,  164,  208,   88,   77,  218,  218,  168,   88,  183,
+  154,   88,   88,   88,  218,  152,   87,  198,   74,  213,
+  271,  272,  317,   87,  198,  198,   88,  153,  154,   87,
+  166,   90,  154,  176,  176,  176,  152,  208,   88,   88,
+  300,  257,   87,  198,   88,   88,   87,  319,  198,   88,
+  208,  213,  272,  213,   88,   88,  198,  208,   88,   87,
+  257,  213,  272,   88,  154,  198,  213,  257,   88,  213,
+};
+#endif /* YYDESTRUCT */
+#define YYFINAL 74
+#ifndef YYDEBUG
+#define YYDEBUG 0
+#endif
+#define YYMAXTOKEN 387
+#if YYDEBUG
+static const char *yyname[] = {
+"end-of-file",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+"'!'",0,0,0,"'%'","'&'",0,"'('","')'","'*'","'+'","','","'-'","'.'","'/'",0,0,0,
+0,0,0,0,0,0,0,"':'","';'",0,"'='",0,"'?'",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,"'['",0,"']'","'^'",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,"'{'","'|'","'}'","'~'",0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,"tknName","tknID",
+"tknStrLit","tknCharLit","tknNumber","tknMacro","tknApiDecor","tknTypedef",
+"tknUsing","tknInteger","tknChar","tknDouble","tknFloat","tknEnum","tknAuto",
+"tknPreProDef","tknClass","tknStruct","tknUnion","tknNamespace","tknTemplate",
+"tknTypename","tknDecltype","tknFreeStandingBlockComment","tknSideBlockComment",
+"tknFreeStandingLineComment","tknSideLineComment","tknScopeResOp",
+"tknNumSignSpec","tknPublic","tknProtected","tknPrivate","tknExternC",
+"tknUnRecogPrePro","tknStdHdrInclude","tknPragma","tknHashError",
+"tknHashWarning","tknEllipsis","tknConstCast","tknStaticCast","tknDynamicCast",
+"tknReinterpretCast","tknTry","tknCatch","tknThrow","tknSizeOf","tknOperator",
+"tknPlusEq","tknMinusEq","tknMulEq","tknDivEq","tknPerEq","tknXorEq","tknAndEq",
+"tknOrEq","tknLShift","tknRShift","tknLShiftEq","tknRShiftEq","tknCmpEq",
+"tknNotEq","tknLessEq","tknGreaterEq","tkn3WayCmp","tknAnd","tknOr","tknInc",
+"tknDec","tknArrow","tknArrowStar","tknLT","tknGT","tknNew","tknDelete",
+"tknConst","tknConstExpr","tknVoid","tknOverride","tknFinal","tknAsm","tknBlob",
+"tknGoto","tknStatic","tknExtern","tknVirtual","tknInline","tknExplicit",
+"tknFriend","tknVolatile","tknMutable","tknNoExcept","tknPreProHash",
+"tknDefine","tknUndef","tknInclude","tknImport","tknIf","tknIfDef","tknIfNDef",
+"tknElse","tknElIf","tknEndIf","tknFor","tknWhile","tknDo","tknSwitch",
+"tknCase","tknDefault","tknReturn","tknBlankLine","COMMA","TERNARYCOND",
+"RSHIFT","PREINCR","PREDECR","UNARYMINUS","CSTYLECAST","DEREF","ADDRESSOF",
+"POSTINCR","POSTDECR","FUNCTIONALCAST","FUNCCALL","SUBSCRIPT","GLOBAL",
+"TEMPLATE","PTRDECL","REFDECL","CTORDECL","DTORDECL",
+};
+static const char *yyrule[] = {
+"$accept : progunit",
+"progunit : optstmtlist",
+"optstmtlist :",
+"optstmtlist : stmtlist",
+"stmtlist : stmt",
+"stmtlist : stmtlist stmt",
+"stmtlist : optstmtlist changeprotlevel",
+"stmt : vardeclstmt",
+"stmt : vardeclliststmt",
+"stmt : enumdefnstmt",
+"stmt : enumfwddecl",
+"stmt : typedefnamestmt",
+"stmt : typedefliststmt",
+"stmt : classdefnstmt",
+"stmt : namespacedefn",
+"stmt : fwddecl",
+"stmt : doccomment",
+"stmt : exprstmt",
+"stmt : ifblock",
+"stmt : whileblock",
+"stmt : dowhileblock",
+"stmt : forblock",
+"stmt : forrangeblock",
+"stmt : funcpointerdecl",
+"stmt : funcdeclstmt",
+"stmt : funcdefn",
+"stmt : ctordeclstmt",
+"stmt : ctordefn",
+"stmt : dtordeclstmt",
+"stmt : dtordefn",
+"stmt : typeconverterstmt",
+"stmt : externcblock",
+"stmt : funcptrtypedef",
+"stmt : preprocessor",
+"stmt : block",
+"stmt : switchstmt",
+"stmt : tryblock",
+"stmt : usingdecl",
+"stmt : usingnamespacedecl",
+"stmt : namespacealias",
+"stmt : macrocall",
+"stmt : macrocall ';'",
+"stmt : apidecortokensq macrocall",
+"stmt : ';'",
+"stmt : asmblock",
+"stmt : blob",
+"stmt : label",
+"label : name ':'",
+"preprocessor : define",
+"preprocessor : undef",
+"preprocessor : include",
+"preprocessor : import",
+"preprocessor : hashif",
+"preprocessor : hasherror",
+"preprocessor : hashwarning",
+"preprocessor : pragma",
+"asmblock : tknAsm",
+"$$1 :",
+"macrocall : tknMacro $$1",
+"$$2 :",
+"macrocall : macrocall '(' ')' $$2",
+"$$3 :",
+"macrocall : macrocall '(' expr ')' $$3",
+"switchstmt : tknSwitch '(' expr ')' '{' caselist '}'",
+"caselist :",
+"caselist : caselist tknCase expr ':' optstmtlist",
+"caselist : caselist tknDefault ':' optstmtlist",
+"caselist : doccommentstr caselist",
+"caselist : caselist doccommentstr",
+"block : '{' optstmtlist '}'",
+"block : doccomment block",
+"ifblock : tknIf '(' expr ')' stmt",
+"ifblock : tknIf '(' varinit ')' stmt",
+"ifblock : ifblock tknElse stmt",
+"whileblock : tknWhile '(' expr ')' stmt",
+"whileblock : tknWhile '(' varinit ')' stmt",
+"dowhileblock : tknDo stmt tknWhile '(' expr ')'",
+"forblock : tknFor '(' optexpr ';' optexpr ';' optexpr ')' stmt",
+"forblock : tknFor '(' varinit ';' optexpr ';' optexpr ')' stmt",
+"forblock : tknFor '(' vardecllist ';' optexpr ';' optexpr ')' stmt",
+"forrangeblock : tknFor '(' vardecl ':' expr ')' stmt",
+"tryblock : tknTry block catchblock",
+"tryblock : tryblock catchblock",
+"catchblock : tknCatch '(' vartype optname ')' block",
+"optexpr :",
+"optexpr : expr",
+"optexpr : exprlist",
+"define : tknPreProHash tknDefine name name",
+"define : tknPreProHash tknDefine name",
+"define : tknPreProHash tknDefine name tknNumber",
+"define : tknPreProHash tknDefine name tknStrLit",
+"define : tknPreProHash tknDefine name tknCharLit",
+"define : tknPreProHash tknDefine name tknPreProDef",
+"undef : tknPreProHash tknUndef name",
+"include : tknPreProHash tknInclude tknStrLit",
+"include : tknPreProHash tknInclude tknStdHdrInclude",
+"import : tknPreProHash tknImport tknStrLit",
+"import : tknPreProHash tknImport tknStdHdrInclude",
+"hashif : tknPreProHash tknIf tknPreProDef",
+"hashif : tknPreProHash tknIfDef name",
+"hashif : tknPreProHash tknIfNDef name",
+"hashif : tknPreProHash tknIfNDef tknApiDecor",
+"hashif : tknPreProHash tknElse",
+"hashif : tknPreProHash tknElIf tknPreProDef",
+"hashif : tknPreProHash tknEndIf",
+"hasherror : tknPreProHash tknHashError",
+"hasherror : tknPreProHash tknHashError strlit",
+"hashwarning : tknPreProHash tknHashWarning",
+"hashwarning : tknPreProHash tknHashWarning strlit",
+"pragma : tknPreProHash tknPragma tknPreProDef",
+"doccomment : doccommentstr",
+"doccommentstr : tknFreeStandingBlockComment",
+"doccommentstr : tknFreeStandingLineComment",
+"doccommentstr : doccommentstr tknFreeStandingBlockComment",
+"doccommentstr : doccommentstr tknFreeStandingLineComment",
+"$$4 :",
+"identifier : name $$4",
+"$$5 :",
+"identifier : identifier tknScopeResOp identifier $$5",
+"$$6 :",
+"identifier : id $$6",
+"$$7 :",
+"identifier : templidentifier $$7",
+"$$8 :",
+"identifier : tknOverride $$8",
+"$$9 :",
+"identifier : identifier tknEllipsis $$9",
+"$$10 :",
+"identifier : macrocall $$10",
+"$$11 :",
+"identifier : templqualifiedid $$11",
+"numbertype : tknInteger",
+"numbertype : tknFloat",
+"numbertype : tknDouble",
+"numbertype : tknChar",
+"numbertype : tknNumSignSpec",
+"numbertype : tknNumSignSpec numbertype",
+"typeidentifier : identifier",
+"typeidentifier : tknScopeResOp identifier",
+"typeidentifier : typeidentifier tknScopeResOp typeidentifier",
+"typeidentifier : numbertype",
+"typeidentifier : tknAuto",
+"typeidentifier : tknVoid",
+"typeidentifier : tknEnum identifier",
+"typeidentifier : tknTypename identifier",
+"typeidentifier : tknEllipsis",
+"typeidentifier : tknTypename tknEllipsis",
+"typeidentifier : tknClass tknEllipsis",
+"typeidentifier : typeidentifier tknEllipsis",
+"typeidentifier : tknDecltype '(' expr ')'",
+"$$12 :",
+"templidentifier : identifier tknLT templatearglist tknGT $$12",
+"$$13 :",
+"templidentifier : identifier tknLT expr tknNotEq expr tknGT $$13",
+"$$14 :",
+"templidentifier : identifier tknLT templatearglist ',' expr tknNotEq expr tknGT $$14",
+"$$15 :",
+"templqualifiedid : tknTemplate templidentifier $$15",
+"$$16 :",
+"name : tknName $$16",
+"$$17 :",
+"id : tknID $$17",
+"optname :",
+"optname : name",
+"optidentifier :",
+"optidentifier : identifier",
+"enumitem : name",
+"enumitem : name '=' expr",
+"enumitem : doccomment",
+"enumitem : preprocessor",
+"enumitem : macrocall",
+"enumitem : blob",
+"blob : tknBlob",
+"enumitemlist :",
+"enumitemlist : enumitemlist enumitem",
+"enumitemlist : enumitemlist ',' enumitem",
+"enumitemlist : enumitemlist ','",
+"enumdefn : tknEnum optname '{' enumitemlist '}'",
+"enumdefn : tknEnum optapidecor name ':' typeidentifier '{' enumitemlist '}'",
+"enumdefn : tknEnum ':' typeidentifier '{' enumitemlist '}'",
+"enumdefn : tknEnum optapidecor name '{' enumitemlist '}'",
+"enumdefn : tknEnum tknClass optapidecor name ':' typeidentifier '{' enumitemlist '}'",
+"enumdefn : tknEnum tknClass optapidecor name '{' enumitemlist '}'",
+"enumdefn : tknTypedef tknEnum optapidecor optname '{' enumitemlist '}' name",
+"enumdefnstmt : enumdefn ';'",
+"enumfwddecl : tknEnum name ':' typeidentifier ';'",
+"enumfwddecl : tknEnum tknClass name ':' typeidentifier ';'",
+"enumfwddecl : tknEnum tknClass name ';'",
+"funcptrtypedef : tknTypedef functionpointer ';'",
+"typedefnamestmt : typedefname ';'",
+"typedefliststmt : typedeflist ';'",
+"typedeflist : tknTypedef vardecllist",
+"typedefname : tknTypedef vardecl",
+"usingdecl : tknUsing name '=' vartype ';'",
+"usingdecl : tknUsing name '=' functionptrtype ';'",
+"usingdecl : tknUsing name '=' funcobj ';'",
+"usingdecl : tknUsing name '=' classdefn ';'",
+"usingdecl : templatespecifier usingdecl",
+"usingdecl : tknUsing identifier ';'",
+"namespacealias : tknNamespace name '=' identifier ';'",
+"usingnamespacedecl : tknUsing tknNamespace identifier ';'",
+"vardeclliststmt : vardecllist ';'",
+"vardeclliststmt : exptype vardecllist ';'",
+"vardeclstmt : vardecl ';'",
+"vardeclstmt : varinit ';'",
+"vardeclstmt : apidecor vardeclstmt",
+"vardeclstmt : exptype vardeclstmt",
+"vardeclstmt : varattrib vardeclstmt",
+"vardecllist : optfunctype varinit ',' opttypemodifier name optvarassign",
+"vardecllist : optfunctype vardecl ',' opttypemodifier name optvarassign",
+"vardecllist : optfunctype vardecl ',' opttypemodifier name '[' expr ']'",
+"vardecllist : optfunctype vardecl ',' opttypemodifier name ':' expr",
+"vardecllist : vardecllist ',' opttypemodifier name optvarassign",
+"vardecllist : vardecllist ',' opttypemodifier name optvarassign ':' expr",
+"varinit : vardecl '(' typeidentifier '*' name",
+"varinit : vardecl '(' typeidentifier '*' '*' name",
+"varinit : vardecl '(' typeidentifier '*' '&' name",
+"varinit : vardecl '(' typeidentifier '&' name",
+"varinit : vardecl '(' typeidentifier tknAnd name",
+"varinit : vardecl '(' typeidentifier ')'",
+"varinit : vardecl '(' ')'",
+"varinit : vardecl varassign",
+"varinit : tknConstExpr varinit",
+"varassign : '=' expr",
+"varassign : '(' exprorlist ')'",
+"varassign : '{' funcargs '}'",
+"optvarassign :",
+"optvarassign : varassign",
+"vardecl : vartype varidentifier",
+"vardecl : vartype apidecor varidentifier",
+"vardecl : functionpointer",
+"vardecl : vardecl '[' expr ']'",
+"vardecl : vardecl '[' ']'",
+"vardecl : vardecl ':' expr",
+"vardecl : templatespecifier vardecl",
+"vardecl : varattrib vardecl",
+"vartype : attribspecifiers typeidentifier opttypemodifier",
+"vartype : typeidentifier opttypemodifier",
+"vartype : tknClass identifier opttypemodifier",
+"vartype : tknClass optapidecor identifier opttypemodifier",
+"vartype : tknStruct optapidecor identifier opttypemodifier",
+"vartype : tknUnion identifier opttypemodifier",
+"vartype : functionptrtype",
+"vartype : classdefn",
+"vartype : classdefn typemodifier",
+"vartype : enumdefn",
+"vartype : enumdefn typemodifier",
+"vartype : varattrib vartype",
+"vartype : vartype tknEllipsis",
+"vartype : typeidentifier typeidentifier tknScopeResOp typemodifier",
+"varidentifier : identifier",
+"varidentifier : tknFinal",
+"varidentifier : '(' '&' name ')'",
+"varidentifier : '(' '*' name ')'",
+"varidentifier : '(' '*' '*' name ')'",
+"opttypemodifier :",
+"opttypemodifier : typemodifier",
+"opttypemodifier : doccomment opttypemodifier",
+"typemodifier : tknConst",
+"typemodifier : '*'",
+"typemodifier : '&'",
+"typemodifier : tknAnd",
+"typemodifier : typemodifier tknConst",
+"typemodifier : typemodifier '*'",
+"typemodifier : typemodifier '&'",
+"typemodifier : typemodifier tknAnd",
+"exptype : tknStatic",
+"exptype : tknExtern",
+"exptype : tknExternC",
+"varattrib : tknConst",
+"varattrib : tknVolatile",
+"varattrib : tknMutable",
+"varattrib : tknConstExpr",
+"typeconverter : tknOperator vartype '(' optvoid ')'",
+"typeconverter : identifier tknScopeResOp tknOperator vartype '(' optvoid ')'",
+"typeconverter : functype typeconverter",
+"typeconverter : typeconverter tknConst",
+"typeconverter : apidecor typeconverter",
+"typeconverter : templatespecifier typeconverter",
+"typeconverterstmt : typeconverter ';'",
+"typeconverterstmt : typeconverter block",
+"funcdeclstmt : funcdecl ';'",
+"funcdefn : funcdecl block",
+"lambda : '[' lambdacapture ']' lambdaparams block",
+"lambda : '[' lambdacapture ']' lambdaparams tknArrow vartype block",
+"lambdaparams :",
+"lambdaparams : '(' paramlist ')'",
+"funcptrortype : functype vartype '(' optapidecor identifier tknScopeResOp '*' optname ')' '(' paramlist ')'",
+"funcptrortype : vartype '(' optapidecor identifier tknScopeResOp '*' optname ')' '(' paramlist ')'",
+"funcptrortype : functype vartype '(' optapidecor '*' optname ')' '(' paramlist ')'",
+"funcptrortype : vartype '(' optapidecor '*' optname ')' '(' paramlist ')'",
+"funcptrortype : vartype '(' '*' apidecor optname ')' '(' paramlist ')'",
+"funcptrortype : apidecor funcptrortype",
+"funcptrortype : funcptrortype optfuncattrib",
+"functionpointer : funcptrortype",
+"functionptrtype : funcptrortype",
+"funcobj : vartype optapidecor '(' paramlist ')'",
+"funcpointerdecl : functionpointer ';'",
+"funcdecldata : funcname '(' paramlist ')'",
+"funcdecldata : funcname '(' paramlist ')' optfuncattrib",
+"funcdecl : vartype apidecor funcdecldata",
+"funcdecl : vartype funcdecldata",
+"funcdecl : vartype tknConstExpr funcdecldata",
+"funcdecl : tknAuto funcdecldata tknArrow vartype",
+"funcdecl : tknAuto tknConstExpr funcdecldata tknArrow vartype",
+"funcdecl : tknConstExpr funcdecl",
+"funcdecl : apidecor funcdecl",
+"funcdecl : templatespecifier funcdecl",
+"funcdecl : functype funcdecl",
+"funcdecl : funcdecl '=' tknDelete",
+"funcdecl : funcdecl '=' tknDefault",
+"funcdecl : funcdecl functhrowspec",
+"funcobjstr : typeidentifier optapidecor '(' paramlist ')'",
+"funcname : operfuncname",
+"funcname : typeidentifier",
+"funcname : tknScopeResOp operfuncname",
+"funcname : tknFinal",
+"rshift : tknGT tknGT",
+"operfuncname : tknOperator '+'",
+"operfuncname : tknOperator '-'",
+"operfuncname : tknOperator '*'",
+"operfuncname : tknOperator '/'",
+"operfuncname : tknOperator '%'",
+"operfuncname : tknOperator '^'",
+"operfuncname : tknOperator '&'",
+"operfuncname : tknOperator '|'",
+"operfuncname : tknOperator '~'",
+"operfuncname : tknOperator '!'",
+"operfuncname : tknOperator '='",
+"operfuncname : tknOperator tknLT",
+"operfuncname : tknOperator tknGT",
+"operfuncname : tknOperator tknPlusEq",
+"operfuncname : tknOperator tknMinusEq",
+"operfuncname : tknOperator tknMulEq",
+"operfuncname : tknOperator tknDivEq",
+"operfuncname : tknOperator tknPerEq",
+"operfuncname : tknOperator tknXorEq",
+"operfuncname : tknOperator tknAndEq",
+"operfuncname : tknOperator tknOrEq",
+"operfuncname : tknOperator tknLShift",
+"operfuncname : tknOperator tknRShift",
+"operfuncname : tknOperator tknLShiftEq",
+"operfuncname : tknOperator tknRShiftEq",
+"operfuncname : tknOperator tknCmpEq",
+"operfuncname : tknOperator tknNotEq",
+"operfuncname : tknOperator tknLessEq",
+"operfuncname : tknOperator tknGreaterEq",
+"operfuncname : tknOperator tkn3WayCmp",
+"operfuncname : tknOperator tknAnd",
+"operfuncname : tknOperator tknOr",
+"operfuncname : tknOperator tknInc",
+"operfuncname : tknOperator tknDec",
+"operfuncname : tknOperator ','",
+"operfuncname : tknOperator tknArrow",
+"operfuncname : tknOperator tknArrowStar",
+"operfuncname : tknOperator '(' ')'",
+"operfuncname : tknOperator '[' ']'",
+"operfuncname : tknOperator tknNew",
+"operfuncname : tknOperator tknNew '[' ']'",
+"operfuncname : tknOperator tknDelete",
+"operfuncname : tknOperator tknDelete '[' ']'",
+"operfuncname : tknOperator typeidentifier",
+"operfuncname : tknOperator typeidentifier '*'",
+"operfuncname : identifier tknScopeResOp operfuncname",
+"operfuncname : tknOperator tknStrLit name",
+"operfuncname : operfuncname tknLT templatearglist tknGT",
+"paramlist :",
+"paramlist : param",
+"paramlist : paramlist ',' param",
+"param : varinit",
+"param : vartype '=' expr",
+"param : vardecl",
+"param : vartype",
+"param : funcptrortype",
+"param : doccomment param",
+"param : vartype '[' expr ']'",
+"param : vartype '[' ']'",
+"$$18 :",
+"templatearg : $$18",
+"$$19 :",
+"templatearg : vartype $$19",
+"$$20 :",
+"templatearg : funcobjstr $$20",
+"$$21 :",
+"templatearg : expr $$21",
+"$$22 :",
+"templatearglist : templatearg $$22",
+"$$23 :",
+"templatearglist : templatearglist ',' templatearg $$23",
+"$$24 :",
+"templatearglist : templatearglist ',' doccomment templatearg $$24",
+"functype : exptype",
+"functype : tknInline",
+"functype : tknVirtual",
+"functype : tknExplicit",
+"functype : tknFriend",
+"functype : tknConstExpr",
+"optfunctype :",
+"optfunctype : functype",
+"optfuncattrib : tknConst",
+"optfuncattrib : tknOverride",
+"optfuncattrib : tknFinal",
+"optfuncattrib : tknNoExcept",
+"optfuncattrib : '=' tknNumber",
+"optfuncattrib : optfuncattrib tknConst",
+"optfuncattrib : optfuncattrib tknOverride",
+"optfuncattrib : optfuncattrib tknFinal",
+"optfuncattrib : optfuncattrib tknNoExcept",
+"optfuncattrib : optfuncattrib '=' tknNumber",
+"optfuncattrib : tknMacro",
+"optfuncthrowspec :",
+"optfuncthrowspec : functhrowspec",
+"functhrowspec : tknThrow '(' identifierlist ')'",
+"identifierlist :",
+"identifierlist : identifier",
+"identifierlist : identifierlist ',' identifier",
+"ctordeclstmt : ctordecl ';'",
+"ctordefn : ctordecl meminitlist block",
+"$$25 :",
+"ctordefn : name tknScopeResOp name $$25 '(' paramlist ')' optfuncthrowspec meminitlist block",
+"$$26 :",
+"ctordefn : identifier tknScopeResOp name tknScopeResOp name $$26 '(' paramlist ')' optfuncthrowspec meminitlist block",
+"$$27 :",
+"ctordefn : name tknLT templatearglist tknGT tknScopeResOp name $$27 '(' paramlist ')' optfuncthrowspec meminitlist block",
+"ctordefn : functype ctordefn",
+"ctordefn : templatespecifier ctordefn",
+"ctordecl : identifier '(' paramlist ')'",
+"ctordecl : functype ctordecl",
+"ctordecl : templatespecifier ctordecl",
+"ctordecl : ctordecl '=' tknDelete",
+"ctordecl : ctordecl '=' tknDefault",
+"ctordecl : ctordecl functhrowspec",
+"ctordecl : ctordecl tknNoExcept",
+"ctordecl : apidecor ctordecl",
+"meminitlist :",
+"meminitlist : ':' meminit",
+"meminitlist : ':' blob",
+"meminitlist : meminitlist ',' meminit",
+"meminit : identifier '(' exprorlist ')'",
+"meminit : identifier '(' ')'",
+"meminit : identifier '{' exprorlist '}'",
+"meminit : identifier '{' '}'",
+"dtordeclstmt : dtordecl ';'",
+"dtordefn : dtordecl block",
+"$$28 :",
+"dtordefn : name tknScopeResOp '~' name $$28 '(' ')' block",
+"$$29 :",
+"dtordefn : identifier tknScopeResOp name tknScopeResOp '~' name $$29 '(' ')' block",
+"$$30 :",
+"dtordefn : name tknLT templatearglist tknGT tknScopeResOp '~' name $$30 '(' ')' block",
+"dtordefn : templatespecifier dtordefn",
+"dtordefn : functype dtordefn",
+"dtordecl : '~' name '(' optvoid ')'",
+"dtordecl : apidecor dtordecl",
+"dtordecl : functype dtordecl",
+"dtordecl : dtordecl optfuncattrib",
+"dtordecl : dtordecl '=' tknNumber",
+"dtordecl : dtordecl '=' tknDelete",
+"dtordecl : dtordecl '=' tknDefault",
+"dtordecl : dtordecl functhrowspec",
+"optvoid :",
+"optvoid : tknVoid",
+"optcomment :",
+"optcomment : doccomment",
+"classdefnstmt : classdefn ';'",
+"attribspecifier : '[' '[' expr ']' ']'",
+"optattribspecifiers :",
+"optattribspecifiers : attribspecifiers",
+"attribspecifiers : attribspecifier",
+"attribspecifiers : attribspecifiers attribspecifier",
+"$$31 :",
+"classdefn : classspecifier optapidecor optattribspecifiers identifier optfinal optinheritlist optcomment '{' $$31 optstmtlist '}'",
+"$$32 :",
+"classdefn : classspecifier optattribspecifiers optinheritlist optcomment '{' $$32 optstmtlist '}'",
+"classdefn : templatespecifier classdefn",
+"$$33 :",
+"namespacedefn : tknNamespace optidentifier '{' $$33 optstmtlist '}'",
+"optfinal :",
+"optfinal : tknFinal",
+"optinheritlist :",
+"optinheritlist : ':' protlevel optinherittype typeidentifier",
+"optinheritlist : optinheritlist ',' protlevel optinherittype typeidentifier",
+"optinheritlist : ':' optinherittype protlevel typeidentifier",
+"optinheritlist : optinheritlist ',' optinherittype protlevel typeidentifier",
+"protlevel :",
+"protlevel : tknPublic",
+"protlevel : tknProtected",
+"protlevel : tknPrivate",
+"optinherittype :",
+"optinherittype : tknVirtual",
+"fwddecl : classspecifier typeidentifier ';'",
+"fwddecl : classspecifier optapidecor identifier ';'",
+"fwddecl : templatespecifier fwddecl",
+"fwddecl : tknFriend typeidentifier ';'",
+"fwddecl : tknFriend fwddecl",
+"classspecifier : tknClass",
+"classspecifier : tknStruct",
+"classspecifier : tknUnion",
+"$$34 :",
+"templatespecifier : tknTemplate tknLT $$34 templateparamlist tknGT",
+"templateparamlist :",
+"templateparamlist : templateparam",
+"templateparamlist : templateparamlist ',' templateparam",
+"templateparam : tknTypename optname",
+"templateparam : tknTypename optname '=' vartype",
+"templateparam : tknClass optname",
+"templateparam : tknClass optname '=' vartype",
+"templateparam : vartype name",
+"templateparam : vartype name '=' expr",
+"templateparam : functionpointer",
+"templateparam : functionpointer '=' expr",
+"templateparam : vartype",
+"templateparam : vartype '=' expr",
+"templateparam : tknTypename name ','",
+"templateparam : tknTypename name '='",
+"templateparam : tknTypename name tknGT",
+"templateparam : tknClass name ','",
+"templateparam : tknClass name tknGT",
+"optapidecor :",
+"optapidecor : apidecor",
+"apidecor : apidecortokensq",
+"apidecor : apidecortokensq '(' name ')'",
+"apidecor : apidecortokensq '(' tknNumber ')'",
+"apidecor : apidecortokensq '(' strlit ')'",
+"apidecortokensq : tknApiDecor",
+"apidecortokensq : apidecortokensq tknApiDecor",
+"apidecortokensq : tknApiDecor '(' strlit ')'",
+"changeprotlevel : tknPublic ':'",
+"changeprotlevel : tknProtected ':'",
+"changeprotlevel : tknPrivate ':'",
+"externcblock : tknExternC block",
+"strlit : tknStrLit",
+"strlit : strlit tknStrLit",
+"expr : strlit",
+"expr : tknCharLit",
+"expr : tknNumber",
+"expr : '+' tknNumber",
+"expr : identifier",
+"expr : '{' exprlist '}'",
+"expr : '{' exprlist ',' '}'",
+"expr : '{' exprorlist '}'",
+"expr : '{' exprorlist ',' '}'",
+"expr : '{' '}'",
+"expr : '-' expr",
+"expr : '~' expr",
+"expr : '!' expr",
+"expr : '*' expr",
+"expr : '&' expr",
+"expr : '&' operfuncname",
+"expr : tknInc expr",
+"expr : expr tknInc",
+"expr : tknDec expr",
+"expr : expr tknDec",
+"expr : expr '+' expr",
+"expr : expr '-' expr",
+"expr : expr '*' expr",
+"expr : expr '/' expr",
+"expr : expr '%' expr",
+"expr : expr '&' expr",
+"expr : expr '|' expr",
+"expr : expr '^' expr",
+"expr : expr '=' expr",
+"expr : expr tknLT expr",
+"expr : expr tknGT expr",
+"expr : expr '?' expr ':' expr",
+"expr : expr tknPlusEq expr",
+"expr : expr tknMinusEq expr",
+"expr : expr tknMulEq expr",
+"expr : expr tknDivEq expr",
+"expr : expr tknPerEq expr",
+"expr : expr tknXorEq expr",
+"expr : expr tknAndEq expr",
+"expr : expr tknOrEq expr",
+"expr : expr tknLShift expr",
+"expr : expr rshift expr",
+"expr : expr tknLShiftEq expr",
+"expr : expr tknRShiftEq expr",
+"expr : expr tknCmpEq expr",
+"expr : expr tknNotEq expr",
+"expr : expr tknLessEq expr",
+"expr : expr tknGreaterEq expr",
+"expr : expr tkn3WayCmp expr",
+"expr : expr tknAnd expr",
+"expr : expr tknOr expr",
+"expr : expr '.' funcname",
+"expr : expr '.' '*' funcname",
+"expr : expr tknArrow funcname",
+"expr : expr tknArrowStar funcname",
+"expr : expr '.' '~' funcname",
+"expr : expr tknArrow '~' funcname",
+"expr : expr '[' expr ']'",
+"expr : expr '[' ']'",
+"expr : expr '(' funcargs ')'",
+"expr : funcname '(' funcargs ')'",
+"expr : expr tknArrow '~' identifier '(' ')'",
+"expr : identifier '{' funcargs '}'",
+"expr : '(' vartype ')' expr",
+"expr : tknConstCast tknLT vartype tknGT '(' expr ')'",
+"expr : tknStaticCast tknLT vartype tknGT '(' expr ')'",
+"expr : tknDynamicCast tknLT vartype tknGT '(' expr ')'",
+"expr : tknReinterpretCast tknLT vartype tknGT '(' expr ')'",
+"expr : '(' exprorlist ')'",
+"expr : tknNew typeidentifier opttypemodifier",
+"expr : tknNew expr",
+"expr : tknNew '(' expr ')' expr",
+"expr : tknScopeResOp tknNew '(' expr ')' expr",
+"expr : tknDelete expr",
+"expr : tknDelete '[' ']' expr",
+"expr : tknReturn exprorlist",
+"expr : tknReturn",
+"expr : tknThrow expr",
+"expr : tknThrow",
+"expr : tknSizeOf '(' vartype ')'",
+"expr : tknSizeOf '(' expr ')'",
+"expr : tknSizeOf tknEllipsis '(' vartype ')'",
+"expr : tknSizeOf tknEllipsis '(' expr ')'",
+"expr : expr tknEllipsis",
+"expr : lambda",
+"expr : tknGoto name",
+"expr : tknNumber name",
+"expr : '[' expr expr ']'",
+"expr : '[' expr objcarglist ']'",
+"objcarg : name ':' expr",
+"objcarglist : objcarg",
+"objcarglist : objcarglist objcarg",
+"exprlist : expr ',' expr",
+"exprlist : exprlist ',' expr",
+"exprlist : doccommentstr exprlist",
+"exprorlist : expr",
+"exprorlist : exprlist",
+"exprorlist : doccommentstr exprorlist",
+"funcargs :",
+"funcargs : exprorlist",
+"captureallbyref : '&'",
+"captureallbyval : '='",
+"lambdacapture : funcargs",
+"lambdacapture : captureallbyref",
+"lambdacapture : captureallbyval",
+"exprstmt : expr ';'",
+};
+#endif
+#line 53 "btyaccpa.ske"
+
+/*
+** YYPOSN is user-defined text position type.
+*/
+#ifdef YYPOSN
+#ifdef YYREDUCEPOSNFUNC
+#define YYCALLREDUCEPOSN(e)   \
+	if(reduce_posn) {     \
+	  YYREDUCEPOSNFUNC(yyps->pos, &(yyps->psp)[1-yym], &(yyps->vsp)[1-yym], \
+			   yym, yyps->psp - yyps->ps, yychar, yyposn, e);       \
+	  reduce_posn = 0;    \
+	}
+
+#ifndef YYCALLREDUCEPOSNARG
+#define YYCALLREDUCEPOSNARG yyps->val
+#endif
+
+
+#define YYPOSNARG(n) ((yyps->psp)[1-yym+(n)-1])
+#define YYPOSNOUT    (yyps->pos)
+#endif /* YYREDUCEPOSNFUNC */
+#endif /* YYPOSN */
+
+/* If delete function is not defined by the user, do not deletions. */
+#ifndef YYDELETEVAL
+#define YYDELETEVAL(v, x) 
+#endif
+
+/* If delete function is not defined by the user, do not deletions. */
+#ifndef YYDELETEPOSN
+#define YYDELETEPOSN(v, x) 
+#endif
+
+#define yyclearin (yychar=(-1))
+
+#define yyerrok (yyps->errflag=0)
+
+/*
+** Initial size of the lexical queue. Queue and stacks double in size when full,
+** so deep nesting costs amortized constant time per token.
+*/
+#ifndef YYSTACKGROWTH
+#define YYSTACKGROWTH 16
+#endif
+
+#ifndef YYDEFSTACKSIZE
+#define YYDEFSTACKSIZE 12
+#endif
+
+extern void yyerror(const char *, ...);
+
+/*
+** YYPARSE_PARAM_TYPE is the type of user data carried by the parser context.
+** Actions and YYLEX can reach it as yyparam.
+*/
+#ifndef YYPARSE_PARAM_TYPE
+#define YYPARSE_PARAM_TYPE void *
+#endif
+
+#define YYABORT  goto yyabort
+#define YYACCEPT goto yyaccept
+#define YYERROR  goto yyerrlab
+#define YYERROR_QUIET  goto yyerrquiet
+#define YYVALID         do { if (yyps->save)          goto yyvalid; } while(0)
+#define YYVALID_NESTED  do { if (yyps->save && \
+                                 yyps->save->save==0) goto yyvalid; } while(0)
+
+struct yyparsestate {
+  struct yyparsestate *save;        /* Previously saved parser state */
+  int           state;
+  int           errflag;
+  Yshort       *ss;          /* state stack base */
+  Yshort       *ssp;         /* state stack pointer */
+  YYSTYPE      *vs;          /* values stack base */
+  YYSTYPE      *vsp;         /* value stack pointer */
+  YYSTYPE       val;         /* value as returned by actions */
+#ifdef YYPOSN
+  YYPOSN       *ps;          /* position stack base */
+  YYPOSN       *psp;         /* position stack pointer */
+  YYPOSN        pos;         /* position as returned by universal action */
+#endif /* YYPOSN */
+  ptrdiff_t     lexeme;      /* index of the conflict lexeme in the lexical queue */
+  size_t        stacksize;   /* current maximum stack size */
+  Yshort        ctry;        /* index in yyctable[] for this conflict */
+  ptrdiff_t     depth;       /* index of the top entry of a saved state */
+  ptrdiff_t     from;        /* error state copies entries from here, those below are of the outermost saved state */
+  size_t        trail;       /* length of the trail when the state was saved */
+  ptrdiff_t     outer;       /* untouched index of the enclosing trial when the state was saved */
+};
+
+/*
+** Saved states do not copy the stacks. Instead an entry is copied to the trail
+** just before it is overwritten, and backtracking copies the entries back from it.
+** So, starting a trial is cheap and only entries that a trial pops get copied.
+*/
+struct yytrailentry {
+  ptrdiff_t     index;       /* index of the entry in stacks */
+  Yshort        state;
+  YYSTYPE       val;
+#ifdef YYPOSN
+  YYPOSN        pos;
+#endif /* YYPOSN */
+};
+
+/*
+** Everything a parse needs besides the tables. There are no globals, so any
+** number of parses can run concurrently as long as each one has its own context.
+*/
+struct yyparsecontext {
+#ifdef YYDEBUG
+  int           debug;
+#endif
+  int           nerrs;
+
+  /* These value/posn are taken from the lexer */
+  YYSTYPE       lval;
+#ifdef YYPOSN
+  YYPOSN        posn;
+#endif /* YYPOSN */
+
+  /* These value/posn of the root non-terminal are returned to the caller */
+  YYSTYPE       retlval;
+#ifdef YYPOSN
+  YYPOSN        retposn;
+#endif /* YYPOSN */
+
+  /* Current parser state */
+  struct yyparsestate *ps;
+
+  /* path!=NULL: do the full parse, starting at *path parser state. */
+  struct yyparsestate *path;
+
+  /* Base of the lexical value queue */
+  YYSTYPE      *lvals;
+
+  /* Current posistion at lexical value queue */
+  YYSTYPE      *lvp;
+
+  /* End position of lexical value queue */
+  YYSTYPE      *lve;
+
+  /* The last allocated position at the lexical value queue */
+  YYSTYPE      *lvlim;
+
+#ifdef YYPOSN
+  /* Base of the lexical position queue */
+  YYPOSN       *lpsns;
+
+  /* Current posistion at lexical position queue */
+  YYPOSN       *lpp;
+
+  /* End position of lexical position queue */
+  YYPOSN       *lpe;
+
+  /* The last allocated position at the lexical position queue */
+  YYPOSN       *lplim;
+#endif /* YYPOSN */
+
+  /* Current position at lexical token queue */
+  Yshort       *lexp;
+
+  Yshort       *lexemes;
+
+  /* Parser states with their stacks, kept for reuse by later conflicts and parses */
+  struct yyparsestate *freestates;
+
+  /* Overwritten entries of the stacks that saved states still need */
+  struct yytrailentry *trail;
+  size_t        ntrail;
+  size_t        trailsize;
+
+  /* Entries below this index are untouched since the innermost saved state */
+  ptrdiff_t     untouched;
+
+  /* Entries below this index are untouched since the outermost saved state */
+  ptrdiff_t     lowwritten;
+
+  /* Statistics of the last parse */
+  long          ntrials;     /* trial parses started */
+  long          nreplayed;   /* tokens read again from the lexical queue after backtracking */
+  size_t        ncopied;     /* bytes of stack entries copied to save and restore parser states */
+
+  /* User data, not used by the parser itself */
+  YYPARSE_PARAM_TYPE param;
+};
+
+/*
+** Old global names, all of them resolve through the context of the current parse.
+*/
+#ifdef YYDEBUG
+#define yydebug   (yyctx->debug)
+#endif
+#define yynerrs   (yyctx->nerrs)
+#define yylval    (yyctx->lval)
+#define yyretlval (yyctx->retlval)
+#ifdef YYPOSN
+#define yyposn    (yyctx->posn)
+#define yyretposn (yyctx->retposn)
+#endif /* YYPOSN */
+#define yyps      (yyctx->ps)
+#define yypath    (yyctx->path)
+#define yylvals   (yyctx->lvals)
+#define yylvp     (yyctx->lvp)
+#define yylve     (yyctx->lve)
+#define yylvlim   (yyctx->lvlim)
+#ifdef YYPOSN
+#define yylpsns   (yyctx->lpsns)
+#define yylpp     (yyctx->lpp)
+#define yylpe     (yyctx->lpe)
+#define yylplim   (yyctx->lplim)
+#endif /* YYPOSN */
+#define yylexp    (yyctx->lexp)
+#define yylexemes (yyctx->lexemes)
+
+/*
+** For use in generated program
+*/
+#define yytrial (yyps->save)
+#define yyvsp   (yyps->vsp)
+#define yyval   (yyps->val)
+#define yypsp   (yyps->psp)
+#define yypos   (yyps->pos)
+#define yydepth (yyps->ssp - yyps->ss)
+#define yyparam (yyctx->param)
+
+
+/*
+** Local prototypes.
+** YYLEX is how the next token is read, user may define it to pass yyparam to the lexer.
+*/
+int yyparse(struct yyparsecontext *yyctx);
+#ifndef YYLEX
+#define YYLEX yylex()
+int yylex(void);
+#endif
+
+static void YYSCopy(YYSTYPE *to, YYSTYPE *from, ptrdiff_t size) {
+  ptrdiff_t i;
+  for (i = size-1; i >= 0; i--)
+    to[i] = from[i];
+}
+
+#ifdef YYPOSN
+static void YYPCopy(YYPOSN *to, YYPOSN *from, int size) {
+  int i;                             
+  for (i = size-1; i >= 0; i--)
+    to[i] = from[i];
+}
+#endif /* YYPOSN */
+
+static int yyexpand(struct yyparsecontext *yyctx) {
+  ptrdiff_t p = yylvp-yylvals;
+  ptrdiff_t os = yylvlim-yylvals;
+  ptrdiff_t s = os * 2;
+#ifdef __cplusplus
+  Yshort  *tl = yylexemes; 
+  yylexemes = new Yshort[s];
+  memcpy(yylexemes, tl, os*sizeof(Yshort));
+  delete[] tl;
+  YYSTYPE *tv = yylvals;
+  yylvals = new YYSTYPE[s];
+  YYSCopy(yylvals, tv, os);
+  delete[] tv;
+#ifdef YYPOSN
+  YYPOSN  *tp = yylpsns;
+  yylpsns = new YYPOSN[s];
+  YYPCopy(yylpsns, tp, os);
+  delete[] tp;
+#endif /* YYPOSN */
+#else
+  yylexemes = realloc(yylexemes, sizeof(Yshort) * s);
+  yylvals = realloc(yylvals, sizeof(YYSTYPE) * s);
+#ifdef YYPOSN
+  yylpsns = realloc(yylpsns, sizeof(YYPOSN) * s);
+#endif /* YYPOSN */
+#endif
+  yylexp = yylexemes + p;
+  yylvp = yylve = yylvals + p;
+  yylvlim = yylvals + s;
+#ifdef YYPOSN
+  yylpp = yylpe = yylpsns + p;
+  yylplim = yylpsns + s;
+#endif /* YYPOSN */
+  return 0;
+}
+
+static int YYLex1(struct yyparsecontext *yyctx) {
+  if(yylvp<yylve) {
+    ++yyctx->nreplayed;
+    yylval = *yylvp++;
+#ifdef YYPOSN
+    yyposn = *yylpp++;
+#endif /* YYPOSN */
+    return *yylexp++;
+  } else {
+    if(yyps->save) {
+      if(yylvp==yylvlim) {
+	yyexpand(yyctx);
+      }
+      *yylexp = YYLEX;
+      *yylvp++ = yylval;
+      yylve++;
+#ifdef YYPOSN
+      *yylpp++ = yyposn;
+      yylpe++;
+#endif /* YYPOSN */
+      return *yylexp++;
+    } else {
+      return YYLEX;
+    }
+  }
+}
+
+static void YYMoreStack(struct yyparsestate *st) {
+  ptrdiff_t p = st->ssp - st->ss;
+#ifdef __cplusplus
+  Yshort  *tss = st->ss;
+  st->ss = new Yshort [st->stacksize * 2];   
+  memcpy(st->ss, tss, st->stacksize * sizeof(Yshort));  
+  delete[] tss;
+  YYSTYPE *tvs = st->vs;
+  st->vs = new YYSTYPE[st->stacksize * 2];  
+  YYSCopy(st->vs, tvs, st->stacksize);                  
+  delete[] tvs;
+#ifdef YYPOSN
+  YYPOSN  *tps = st->ps;
+  st->ps = new YYPOSN [st->stacksize * 2];  
+  YYPCopy(st->ps, tps, st->stacksize);                  
+  delete[] tps;
+#endif /* YYPOSN */
+  st->stacksize *= 2;                           
+#else
+  st->stacksize *= 2;                           
+  st->ss = realloc(st->ss, sizeof(Yshort ) * st->stacksize);   
+  st->vs = realloc(st->vs, sizeof(YYSTYPE) * st->stacksize);  
+#ifdef YYPOSN
+  st->ps = realloc(st->ps, sizeof(YYPOSN ) * st->stacksize);  
+#endif /* YYPOSN */
+#endif
+  st->ssp = st->ss + p;                                   
+  st->vsp = st->vs + p;                                   
+#ifdef YYPOSN
+  st->psp = st->ps + p;                                   
+#endif /* YYPOSN */
+}
+
+static void YYAllocStacks(struct yyparsestate *p, size_t size) {
+#ifdef __cplusplus
+  p->ss = new Yshort [size + 4];
+  p->vs = new YYSTYPE[size + 4];
+#ifdef YYPOSN
+  p->ps = new YYPOSN [size + 4];
+#endif /* YYPOSN */
+#else
+  p->ss = malloc(sizeof(Yshort ) * (size + 4));
+  p->vs = malloc(sizeof(YYSTYPE) * (size + 4));
+#ifdef YYPOSN
+  p->ps = malloc(sizeof(YYPOSN ) * (size + 4));
+#endif /* YYPOSN */
+#endif
+  p->stacksize = size+4;
+#ifndef YYSTYPE_CONSTRUCTOR
+  memset(&p->vs[0], 0, (size+4)*sizeof(YYSTYPE));
+#endif
+#ifdef YYPOSN
+#ifndef YYPOSN_CONSTRUCTOR
+  memset(&p->ps[0], 0, (size+4)*sizeof(YYPOSN));
+#endif
+#endif /* YYPOSN */
+}
+
+static void YYFreeStacks(struct yyparsestate *p) {
+#ifdef __cplusplus
+  delete[] p->ss;
+  delete[] p->vs;
+#ifdef YYPOSN
+  delete[] p->ps;
+#endif /* YYPOSN */
+#else
+  free(p->ss);
+  free(p->vs);
+#ifdef YYPOSN
+  free(p->ps);
+#endif /* YYPOSN */
+#endif
+}
+
+/*
+** Returns a state whose stacks can hold at least size entries.
+** States are taken from the free list, only a state whose stacks are too small is reallocated.
+*/
+static struct yyparsestate *YYNewState(struct yyparsecontext *yyctx, size_t size) {
+  struct yyparsestate *p = yyctx->freestates;
+  if (p) {
+    yyctx->freestates = p->save;
+    if (p->stacksize >= size + 4)
+      return p;
+    YYFreeStacks(p);
+  } else {
+#ifdef __cplusplus
+    p = new yyparsestate;
+#else
+    p = malloc(sizeof(struct yyparsestate));
+#endif
+  }
+  YYAllocStacks(p, size);
+  return p;
+}
+
+static void YYFreeState(struct yyparsecontext *yyctx, struct yyparsestate *p) {
+  p->save = yyctx->freestates;
+  yyctx->freestates = p;
+}
+
+#ifdef YYPOSN
+#define YYENTRYSIZE (sizeof(Yshort) + sizeof(YYSTYPE) + sizeof(YYPOSN))
+#else
+#define YYENTRYSIZE (sizeof(Yshort) + sizeof(YYSTYPE))
+#endif /* YYPOSN */
+
+/* Copies entries from index top till the untouched one to the trail, they are about to be overwritten */
+static void YYTrail(struct yyparsecontext *yyctx, ptrdiff_t top) {
+  size_t n = yyctx->untouched - top;
+  ptrdiff_t i;
+  if (yyctx->ntrail + n > yyctx->trailsize) {
+    size_t s = yyctx->trailsize ? yyctx->trailsize * 2 : YYSTACKGROWTH;
+    if (s < yyctx->ntrail + n)
+      s = yyctx->ntrail + n;
+#ifdef __cplusplus
+    struct yytrailentry *tt = yyctx->trail;
+    yyctx->trail = new yytrailentry[s];
+    for (i = 0; i < (ptrdiff_t)yyctx->ntrail; i++)
+      yyctx->trail[i] = tt[i];
+    delete[] tt;
+#else
+    yyctx->trail = realloc(yyctx->trail, sizeof(struct yytrailentry) * s);
+#endif
+    yyctx->trailsize = s;
+  }
+  for (i = top; i < yyctx->untouched; i++) {
+    struct yytrailentry *e = &yyctx->trail[yyctx->ntrail++];
+    e->index = i;
+    e->state = yyps->ss[i];
+    e->val   = yyps->vs[i];
+#ifdef YYPOSN
+    e->pos   = yyps->ps[i];
+#endif /* YYPOSN */
+  }
+  yyctx->ncopied += n * YYENTRYSIZE;
+  yyctx->untouched = top;
+  if (yyctx->lowwritten > top)
+    yyctx->lowwritten = top;
+}
+
+/* Called before a push, the entry it overwrites may still be needed by a saved state */
+#define YYTRAILTOP() \
+  if (yyps->ssp + 1 - yyps->ss < yyctx->untouched) \
+    YYTrail(yyctx, yyps->ssp + 1 - yyps->ss)
+
+/* Starts a trial, the returned state is to be pushed on the chain of saved states */
+static struct yyparsestate *YYSaveState(struct yyparsecontext *yyctx) {
+  struct yyparsestate *p = YYNewState(yyctx, 0);
+  p->depth = yyps->ssp - yyps->ss;
+  p->trail = yyctx->ntrail;
+  p->outer = yyctx->untouched;
+  if (!yyps->save)
+    yyctx->lowwritten = p->depth + 1;
+  if (yyctx->untouched < p->depth + 1)
+    yyctx->untouched = p->depth + 1;
+  return p;
+}
+
+/* Makes the stacks same as when saved state p was saved, by undoing what the trail has since then */
+static void YYRestoreState(struct yyparsecontext *yyctx, struct yyparsestate *p) {
+  yyctx->ncopied += (yyctx->ntrail - p->trail) * YYENTRYSIZE;
+  while (yyctx->ntrail > p->trail) {
+    struct yytrailentry *e = &yyctx->trail[--yyctx->ntrail];
+    yyps->ss[e->index] = e->state;
+    yyps->vs[e->index] = e->val;
+#ifdef YYPOSN
+    yyps->ps[e->index] = e->pos;
+#endif /* YYPOSN */
+  }
+  yyps->ssp = yyps->ss + p->depth;
+  yyps->vsp = yyps->vs + p->depth;
+#ifdef YYPOSN
+  yyps->psp = yyps->ps + p->depth;
+#endif /* YYPOSN */
+  yyctx->untouched = (p->outer > p->depth + 1) ? p->outer : p->depth + 1;
+}
+
+/*
+** Saves the error state. It is restored only after backtracking to the outermost saved state,
+** so only the entries that differ from that state are copied.
+*/
+static struct yyparsestate *YYSaveErrorState(struct yyparsecontext *yyctx) {
+  ptrdiff_t depth = yyps->ssp - yyps->ss;
+  ptrdiff_t from = (yyctx->lowwritten < depth + 1) ? yyctx->lowwritten : depth + 1;
+  struct yyparsestate *p = YYNewState(yyctx, depth);
+  p->depth = depth;
+  p->from  = from;
+  memcpy(p->ss + from, yyps->ss + from, (depth + 1 - from) * sizeof(Yshort));
+  YYSCopy(p->vs + from, yyps->vs + from, depth + 1 - from);
+#ifdef YYPOSN
+  YYPCopy(p->ps + from, yyps->ps + from, depth + 1 - from);
+#endif /* YYPOSN */
+  yyctx->ncopied += (depth + 1 - from) * YYENTRYSIZE;
+  return p;
+}
+
+static void YYRestoreErrorState(struct yyparsecontext *yyctx, struct yyparsestate *p) {
+  ptrdiff_t from = p->from;
+  memcpy(yyps->ss + from, p->ss + from, (p->depth + 1 - from) * sizeof(Yshort));
+  YYSCopy(yyps->vs + from, p->vs + from, p->depth + 1 - from);
+#ifdef YYPOSN
+  YYPCopy(yyps->ps + from, p->ps + from, p->depth + 1 - from);
+#endif /* YYPOSN */
+  yyctx->ncopied += (p->depth + 1 - from) * YYENTRYSIZE;
+  yyps->ssp = yyps->ss + p->depth;
+  yyps->vsp = yyps->vs + p->depth;
+#ifdef YYPOSN
+  yyps->psp = yyps->ps + p->depth;
+#endif /* YYPOSN */
+}
+
+/*
+** Prepares a context for yyparse(). A context can be used for any number of
+** parses, one at a time, and must be released with yyparse_destroy().
+** Stacks and lexical queue are kept between parses, so reusing a context saves their allocation.
+*/
+void yyparse_init(struct yyparsecontext *yyctx, YYPARSE_PARAM_TYPE param) {
+#ifdef YYDEBUG
+  yydebug = 0;
+#endif
+  yynerrs = 0;
+  yyps = 0;
+  yypath = 0;
+  yylvals = yylvp = yylve = yylvlim = 0;
+#ifdef YYPOSN
+  yylpsns = yylpp = yylpe = yylplim = 0;
+#endif /* YYPOSN */
+  yylexp = yylexemes = 0;
+  yyctx->freestates = 0;
+  yyctx->trail = 0;
+  yyctx->ntrail = yyctx->trailsize = 0;
+  yyctx->untouched = yyctx->lowwritten = 0;
+  yyctx->ntrials = yyctx->nreplayed = 0;
+  yyctx->ncopied = 0;
+  yyparam = param;
+}
+
+void yyparse_destroy(struct yyparsecontext *yyctx) {
+#ifdef __cplusplus
+  delete[] yylexemes;
+  delete[] yylvals;
+#ifdef YYPOSN
+  delete[] yylpsns;
+#endif /* YYPOSN */
+#else
+  free(yylexemes);
+  free(yylvals);
+#ifdef YYPOSN
+  free(yylpsns);
+#endif /* YYPOSN */
+#endif
+  yylvals = yylvp = yylve = yylvlim = 0;
+#ifdef YYPOSN
+  yylpsns = yylpp = yylpe = yylplim = 0;
+#endif /* YYPOSN */
+  yylexp = yylexemes = 0;
+#ifdef __cplusplus
+  delete[] yyctx->trail;
+#else
+  free(yyctx->trail);
+#endif
+  yyctx->trail = 0;
+  yyctx->ntrail = yyctx->trailsize = 0;
+  while (yyctx->freestates) {
+    struct yyparsestate *p = yyctx->freestates;
+    yyctx->freestates = p->save;
+    YYFreeStacks(p);
+#ifdef __cplusplus
+    delete p;
+#else
+    free(p);
+#endif
+  }
+}
+
+#line 2107 "/root/repo/src/parser.y"
+
+
+//////////////////////////////////////////////////////////////////////////
+
+// clang-format on
+
+extern const char* contextNameFromState(int ctx);
+
+void defaultErrorHandler(const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext)
+{
+  constexpr size_t bufsize = 1024;
+  char spacechars[bufsize] = {0};
+  for(size_t i = 0; i < errorStartPos; ++i)
+    spacechars[i] = (errLineText[i] == '\t') ? '\t' : ' ';
+  char errmsg[bufsize];
+  const auto* errText = errLineText+errorStartPos;
+  const auto* strLexerContext = contextNameFromState(lexerContext);
+
+  std::sprintf(errmsg, "Error: Unexpected '%.*s', while in context=%.*s(%d), found at line#%ld\n"
+    "%.*s\n"   // Line that contains the error.
+    "%.*s^\n",  // A ^ below the beginning of unexpected token.
+    static_cast<int>(strlen(errText)), errText,
+    static_cast<int>(strlen(strLexerContext)), strLexerContext, lexerContext, lineNum,
+    static_cast<int>(strlen(errLineText)), errLineText,
+    static_cast<int>(strlen(spacechars)), spacechars);
+
+  printf("%s", errmsg);
+}
+
+/**
+ * yyparser() invokes this function when it encounters unexpected token.
+ */
+void yyerror_detailed  (  yyparsecontext* yyctx,
+              char*,
+              int,
+              YYSTYPE&,
+              YYPOSN& errt_posn
+            )
+{
+  extern int getLexerContext(void* yyscanner);
+
+  const char* lineStart = errt_posn;
+  const char* buffStart = yyparam->lexer.mInputBuffer;
+  while(lineStart > buffStart)
+  {
+    if(lineStart[-1] == '\n' || lineStart[-1] == '\r')
+      break;
+    --lineStart;
+  }
+  const char* lineEnd = errt_posn;
+  while(*lineEnd && (*lineEnd != '\r') && (*lineEnd != '\n'))
+    ++lineEnd;
+  // Line is copied because input must not be modified, e.g. when it is memory mapped.
+  const std::string errLine(lineStart, lineEnd);
+  yyparam->parseStatus = ParseStatus::Failure;
+  const auto lineNo = yyparam->lexer.mLineIndex.lineNumber(errt_posn);
+  yyparam->config.errorHandler(errLine.c_str(), lineNo, errt_posn - lineStart, getLexerContext(yyparam->scanner));
+}
+
+enum {
+  kNoLog    = 0x000,
+  kLexLog   = 0x001,
+  kParseLog = 0x002,
+  kYaccLog  = 0x004
+};
+
+static void trackStackValues(const Yshort* rhsStates, YYSTYPE* rhsValues, int numRhs, int rule, YYSTYPE* lhsValue)
+{
+  gStackValueOwner->mode(ParseValueOwner::Mode::kRelease);
+  for (int i = 0; i < numRhs; ++i)
+    yydestruct(0, yyastable[rhsStates[i]], rhsValues + i, nullptr);
+
+  // Empty rule, like a mid-rule action, that does not set $$ leaves there a copy of the value below it on stack.
+  const bool lhsIsNew = (numRhs > 0) || (std::memcmp(lhsValue, rhsValues - 1, sizeof(YYSTYPE)) != 0);
+  if (lhsIsNew)
+  {
+    // Nonterminals are numbered from the start symbol, which is what YYFINAL is reached by.
+    gStackValueOwner->mode(ParseValueOwner::Mode::kTake);
+    yydestruct(0, yylhs[rule] + yyastable[YYFINAL], lhsValue, nullptr);
+  }
+
+  gStackValueOwner->mode(ParseValueOwner::Mode::kReclaim);
+}
+
+static void setupEnv(yyparsecontext* yyctx)
+{
+#if YYDEBUG
+  const char* yys = getenv("ZZDEBUG");
+  if (yys) {
+    const int yyn = *yys - '0';
+
+    yyparam->parseLog     = ((yyn & kParseLog) ? 1 : 0);
+    yyparam->lexer.mLexLog = ((yyn & kLexLog)   ? 1 : 0);
+    yydebug               = ((yyn & kYaccLog)  ? 1 : 0);
+  }
+#endif
+}
+
+ParseStacks::ParseStacks()
+  : ctx_(new yyparsecontext)
+{
+  yyparse_init(ctx_.get(), nullptr);
+}
+
+ParseStacks::~ParseStacks()
+{
+  yyparse_destroy(ctx_.get());
+}
+
+CppCompoundPtr parseStream(char*                stm,
+                           size_t               stmSize,
+                           const ParserConfig&  config,
+                           const CppObjFactory& objFactory,
+                           bool                 textRefersToStm,
+                           ParseStats*          stats,
+                           ParseStacks*         stacks)
+{
+  void* setupScanBuffer(LexerData* lexerData, char* buf, size_t bufsize);
+  void cleanupScanBuffer(void* yyscanner);
+
+  std::unique_ptr<ParseStacks> ownStacks;
+  if (!stacks)
+  {
+    ownStacks.reset(new ParseStacks);
+    stacks = ownStacks.get();
+  }
+
+  ParserState state(config, objFactory);
+  state.textRefersToInput = textRefersToStm;
+  yyparsecontext& ctx = *stacks->context();
+  ctx.param           = &state;
+  state.scanner = setupScanBuffer(&state.lexer, stm, stmSize);
+  state.lexer.mTokenValue    = &ctx.lval;
+  state.lexer.mTokenPosition = &ctx.posn;
+  setupEnv(&ctx);
+  auto* outerStackValueOwner = std::exchange(gStackValueOwner, &state.stackValues);
+  yyparse(&ctx);
+  gStackValueOwner = outerStackValueOwner;
+  cleanupScanBuffer(state.scanner);
+  ctx.param = nullptr;
+
+  // Whatever is still owned was on stack when the parse ended and is not part of progUnit.
+  state.stackValues.mode(ParseValueOwner::Mode::kRelease);
+  state.stackValues.onValue(state.progUnit);
+  state.stackValues.reclaimAll();
+  if (stats)
+  {
+    stats->numBytesReclaimed       += state.stackValues.numBytesReclaimed();
+    stats->numTrialParses          += ctx.ntrials;
+    stats->numTokensReplayed       += ctx.nreplayed;
+    stats->numBytesCopiedForTrials += ctx.ncopied;
+  }
+  if (config.shareVarTypes && state.progUnit)
+    shareVarTypes(state.progUnit);
+
+  // TODO: Make better error  handling
+  /* if (state.parseStatus == ParseStatus::Failure)
+    throw std::runtime_error("Parsing error"); */
+
+  return CppCompoundPtr(state.progUnit);
+}
+
+std::vector<CppLexToken> tokenizeStream(char* stm, size_t stmSize, const ParserConfig& config)
+{
+  void* setupScanBuffer(LexerData* lexerData, char* buf, size_t bufsize);
+  void cleanupScanBuffer(void* yyscanner);
+
+  LexerData lexer;
+  configureLexer(lexer, config);
+  YYSTYPE tokenValue;
+  char*   tokenPosition = nullptr;
+  lexer.mTokenValue     = &tokenValue;
+  lexer.mTokenPosition  = &tokenPosition;
+
+  std::vector<CppLexToken> tokens;
+  auto*                    scanner = setupScanBuffer(&lexer, stm, stmSize);
+  while (const auto kind = yylex(scanner))
+  {
+    tokens.push_back(CppLexToken {kind,
+                                  static_cast<uint32_t>(tokenPosition - stm),
+                                  static_cast<uint32_t>(tokenValue.str.len)});
+  }
+  cleanupScanBuffer(scanner);
+
+  return tokens;
+}
+#line 9264 "parser.tab.c"
+#line 643 "btyaccpa.ske"
+
+/*
+** Parser function
+*/
+int yyparse(struct yyparsecontext *yyctx) {
+  int yym, yyn, yystate, yychar, yynewerrflag;
+  struct yyparsestate *yyerrctx = NULL;
+#ifdef YYREDUCEPOSNFUNC
+  int reduce_posn;
+#endif /* YYREDUCEPOSNFUNC */
+
+#if YYDEBUG
+  const char *yys;
+  
+  if ((yys = getenv("YYDEBUG"))) {
+    yyn = *yys;
+    if (yyn >= '0' && yyn <= '9')
+      yydebug = yyn - '0'; 
+  }
+#endif
+  
+  yym = 0;
+  yyn = 0;
+  yyps = YYNewState(yyctx, YYDEFSTACKSIZE);
+  yyps->save = 0;
+  yyctx->ntrail = 0;
+  yyctx->untouched = 0;
+  yyctx->ntrials = yyctx->nreplayed = 0;
+  yyctx->ncopied = 0;
+  yynerrs = 0;
+  yyps->errflag = 0;
+  yychar = (-1);
+
+  /* Lexical queue is kept from the previous parse with this context */
+  yylvp = yylve = yylvals;
+#ifdef YYPOSN
+  yylpp = yylpe = yylpsns;
+#endif /* YYPOSN */
+  yylexp = yylexemes;
+  
+  yyps->ssp = yyps->ss;
+  yyps->vsp = yyps->vs;
+#ifdef YYPOSN
+  yyps->psp = yyps->ps;
+#endif /* YYPOSN */
+  *(yyps->ssp) = yystate = 0;
+  
+
+  /*
+  ** Main parsing loop
+  */
+ yyloop:
+  if ((yyn = yydefred[yystate])) {
+    goto yyreduce;
+  }
+
+  /*
+  ** Read one token
+  */
+  if (yychar < 0) {
+    if ((yychar = YYLex1(yyctx)) < 0) yychar = 0;
+#if YYDEBUG
+    if (yydebug) {
+      yys = 0;
+      if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+      if (!yys) yys = "illegal-symbol";
+      printf("yydebug[%d,%d]: state %d, reading %d (%s)", 
+	     (int)yydepth, yytrial!=0, yystate, yychar, yys);
+#ifdef YYDBPR
+      printf("<");
+      YYDBPR(yylval);
+      printf(">");
+#endif
+      printf("\n"); 
+    }
+#endif
+  }
+
+  /*
+  ** Do we have a conflict?
+  */
+  if ((yyn = yycindex[yystate]) &&
+      (yyn += yychar) >= 0 &&
+      yyn <= YYTABLESIZE &&
+      yycheck[yyn] == yychar) {
+    int ctry;
+
+    if (yypath) {
+#if YYDEBUG
+      if (yydebug) {
+        printf("yydebug[%d,%d]: CONFLICT in state %d: following successful "
+	       "trial parse\n", (int)yydepth, yytrial!=0, yystate);
+      }
+#endif
+      /* Switch to the next conflict context */
+      struct yyparsestate *save = yypath;
+      yypath = save->save;
+      ctry = save->ctry;
+      if (save->state != yystate) 
+        goto yyabort;
+      YYFreeState(yyctx, save); 
+
+    } else {
+
+#if YYDEBUG
+      if (yydebug) {
+        printf("yydebug[%d,%d]: CONFLICT in state %d. ", 
+	       (int)yydepth, yytrial!=0, yystate);
+        if(yyps->save) {
+          printf("ALREADY in conflict. Continue trial parse.");
+        } else {
+          printf("Start trial parse.");
+        }
+        printf("\n");
+      }
+#endif
+      struct yyparsestate *save = YYSaveState(yyctx);
+      save->save    = yyps->save;
+      save->state   = yystate;
+      save->errflag = yyps->errflag;
+      ++yyctx->ntrials;
+      ctry = yytable[yyn];
+      if (yyctable[ctry] == -1) {
+#if YYDEBUG
+        if (yydebug && yychar >= 0)
+          printf("yydebug[%d]: backtracking 1 token\n", 
+		 yytrial!=0);
+#endif
+        ctry++; 
+      }
+      save->ctry = ctry;
+      if (!yyps->save) {
+        /* If this is a first conflict in the stack, start saving lexemes */
+        if (!yylexemes) {
+#ifdef __cplusplus
+          yylexemes = new Yshort[YYSTACKGROWTH];
+          yylvals = new YYSTYPE[YYSTACKGROWTH];
+#ifdef YYPOSN
+          yylpsns = new YYPOSN[YYSTACKGROWTH];
+#endif /* YYPOSN */
+#else
+          yylexemes = malloc(sizeof(Yshort) * YYSTACKGROWTH);
+          yylvals = malloc(sizeof(YYSTYPE) * YYSTACKGROWTH);
+#ifdef YYPOSN
+          yylpsns = malloc(sizeof(YYPOSN) * YYSTACKGROWTH);
+#endif /* YYPOSN */
+#endif
+          yylvlim = yylvals + YYSTACKGROWTH; 
+#ifdef YYPOSN
+          yylplim = yylpsns + YYSTACKGROWTH; 
+#endif /* YYPOSN */
+        }
+        if (yylvp == yylve) {
+          yylvp = yylve = yylvals;
+#ifdef YYPOSN
+	  yylpp = yylpe = yylpsns;
+#endif /* YYPOSN */
+          yylexp = yylexemes;
+          if (yychar >= 0) {
+            *yylve++ = yylval;
+#ifdef YYPOSN
+            *yylpe++ = yyposn;
+#endif /* YYPOSN */
+            *yylexp = yychar;
+            yychar = -1; 
+          } 
+        } 
+      }
+      if (yychar >= 0) {
+        yylvp--;
+#ifdef YYPOSN
+	yylpp--;
+#endif /* YYPOSN */
+	yylexp--;
+        yychar = -1; 
+      }
+      save->lexeme = yylvp - yylvals;
+      yyps->save = save; 
+    }
+    if (yytable[yyn] == ctry) {
+#if YYDEBUG
+      if (yydebug)
+        printf("yydebug[%d,%d]: state %d, shifting to state %d\n",
+               (int)yydepth, yytrial!=0, yystate, yyctable[ctry]);
+#endif
+      if (yychar < 0) {
+        yylvp++;
+#ifdef YYPOSN
+	yylpp++;
+#endif /* YYPOSN */
+	yylexp++;
+      }
+      yychar = -1;
+      if (yyps->errflag > 0) --yyps->errflag;
+      yystate = yyctable[ctry];
+      goto yyshift; 
+    } else {
+      yyn = yyctable[ctry];
+      goto yyreduce; 
+    } 
+  }
+
+  /*
+  ** Is action a shift?
+  */
+  if ((yyn = yysindex[yystate]) &&
+      (yyn += yychar) >= 0 &&
+      yyn <= YYTABLESIZE &&
+      yycheck[yyn] == yychar) {
+#if YYDEBUG
+    if (yydebug)
+      printf("yydebug[%d,%d]: state %d, shifting to state %d\n",
+             (int)yydepth, yytrial!=0, yystate, yytable[yyn]);
+#endif
+    yychar = (-1);
+    if (yyps->errflag > 0)  --yyps->errflag;
+    yystate = yytable[yyn];
+  yyshift:
+    if (yyps->ssp >= yyps->ss + yyps->stacksize - 1) {
+      YYMoreStack(yyps);
+    }
+    YYTRAILTOP();
+    *++(yyps->ssp) = yystate;
+    *++(yyps->vsp) = yylval;
+#ifdef YYPOSN
+    *++(yyps->psp) = yyposn;
+#endif /* YYPOSN */
+    goto yyloop;
+  }
+  if ((yyn = yyrindex[yystate]) &&
+      (yyn += yychar) >= 0 &&
+      yyn <= YYTABLESIZE &&
+      yycheck[yyn] == yychar) {
+    yyn = yytable[yyn];
+    goto yyreduce;
+  }
+  yym = 0;  /* no reduction to clean up after */
+
+  /*
+  ** Action: error
+  */
+  if (yyps->errflag) goto yyinrecovery;
+  else goto yyerrlab;	/* redundant goto to avoid 'unused label' warnings */
+yyerrlab:
+  /* explicit YYERROR from an action -- pop the rhs of the rule reduced
+   * before looking for error recovery */
+  yyps->ssp -= yym;
+  yystate = *(yyps->ssp);
+  yyps->vsp -= yym;
+#ifdef YYPOSN
+  yyps->psp -= yym;
+#endif /* YYPOSN */
+
+  yynewerrflag = 1;
+  goto yyerrhandler;
+  goto yyerrquiet; /* redundant goto to avoid 'unused label' warnings */
+yyerrquiet:
+  yynewerrflag = 0;
+yyerrhandler:
+  while (yyps->save) {
+    int ctry; 
+    struct yyparsestate *save = yyps->save;
+#if YYDEBUG
+    if (yydebug)
+      printf("yydebug[%d,%d]: ERROR in state %d, CONFLICT BACKTRACKING to "
+	     "state %d, %d tokens\n", (int)yydepth, yytrial!=0, yystate,
+	     yyps->save->state, (int)(yylvp - yylvals - yyps->save->lexeme));
+#endif
+    /* Memorize most forward-looking error state in case
+     * it's really an error. */
+    if(yyerrctx==NULL || yyerrctx->lexeme<yylvp-yylvals) {
+      /* Free old saved error context state */
+      if(yyerrctx) YYFreeState(yyctx, yyerrctx);
+      /* Create and fill out new saved error context state */
+      yyerrctx = YYSaveErrorState(yyctx);
+      yyerrctx->save = yyps->save;
+      yyerrctx->state = yystate;
+      yyerrctx->errflag = yyps->errflag;
+      yyerrctx->lexeme = yylvp - yylvals;
+    }
+    yychar = -1;
+    yylexp = yylexemes + save->lexeme;
+    yylvp = yylvals + save->lexeme;
+#ifdef YYPOSN
+    yylpp  = yylpsns + save->lexeme;
+#endif /* YYPOSN */
+    YYRestoreState(yyctx, save);
+    ctry = ++save->ctry;
+    yystate = save->state;
+    /* We tried shift, try reduce now */
+    if ((yyn = yyctable[ctry]) >= 0) {
+      goto yyreduce;
+    }
+    yyps->save = save->save;
+    yyctx->untouched = save->outer;
+    YYFreeState(yyctx, save);
+    /*
+    ** Nothing left on the stack -- error
+    */
+    if (!yyps->save) {
+#if YYDEBUG
+      if (yydebug) {
+        printf("yydebug[%d]: trial parse FAILED, entering ERROR mode\n", 
+	       yytrial!=0);
+      }
+#endif
+      /* Restore state as it was in the most forward-advanced error */
+      yylexp = yylexemes + yyerrctx->lexeme;
+      yychar = yylexp[-1];
+      yylvp = yylvals   + yyerrctx->lexeme;
+      yylval = yylvp[-1];
+#ifdef YYPOSN
+      yylpp  = yylpsns   + yyerrctx->lexeme;
+      yyposn = yylpp[-1];
+#endif /* YYPOSN */
+      YYRestoreErrorState(yyctx, yyerrctx);
+      yystate = yyerrctx->state;
+      YYFreeState(yyctx, yyerrctx);
+      yyerrctx = NULL;
+    }
+    yynewerrflag = 1; 
+  }
+  if (yynewerrflag) {
+#ifdef YYERROR_DETAILED
+    yyerror_detailed(yyctx, "syntax error", yychar, yylval, yyposn);
+#else
+    yyerror("syntax error");
+#endif
+  }
+  ++yynerrs;
+ yyinrecovery:
+  if (yyps->errflag < 3) {
+    yyps->errflag = 3;
+    for (;;) {
+      if ((yyn = yysindex[*(yyps->ssp)]) && 
+	  (yyn += YYERRCODE) >= 0 &&
+          yyn <= YYTABLESIZE && 
+	  yycheck[yyn] == YYERRCODE) {
+#if YYDEBUG
+        if (yydebug)
+          printf("yydebug[%d,%d]: state %d, ERROR recovery shifts to state "
+	         "%d\n", (int)yydepth, yytrial!=0, *(yyps->ssp), yytable[yyn]);
+#endif
+        yystate = yytable[yyn];
+        goto yyshift; 
+      } else {
+#if YYDEBUG
+        if (yydebug)
+          printf("yydebug[%d,%d]: ERROR recovery discards state %d\n",
+                 (int)yydepth, yytrial!=0, *(yyps->ssp));
+#endif
+        if (yyps->ssp <= yyps->ss) {
+	  goto yyabort;
+	}
+	if(!yytrial) {
+	  YYDELETEVAL(yyps->vsp[0],1);
+	  YYDELETEPOSN(yyps->psp[0],1);
+	}
+#ifdef YYDESTRUCT
+	YYDESTRUCT(yytrial!=0, yyastable[yyps->ssp[0]], yyps->vsp, yyps->psp);
+#endif /* YYDESTRUCT */
+        --(yyps->ssp);
+        --(yyps->vsp);
+#ifdef YYPOSN
+        --(yyps->psp);
+#endif /* YYPOSN */
+      }
+    }
+  } else {
+    if (yychar == 0) goto yyabort;
+#if YYDEBUG
+    if (yydebug) {
+      yys = 0;
+      if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+      if (!yys) yys = "illegal-symbol";
+      printf("yydebug[%d,%d]: state %d, ERROR recovery discards token %d "
+	     "(%s)\n", (int)yydepth, yytrial!=0, yystate, yychar, yys); 
+    }
+#endif
+    if(!yytrial) {
+      YYDELETEVAL(yylval,0);
+      YYDELETEPOSN(yyposn,0);
+    }
+#ifdef YYDESTRUCT
+    if (yychar > 0)
+      YYDESTRUCT(yytrial!=0, yychar, &yylval, &yyposn);
+#endif /* YYDESTRUCT */
+    yychar = (-1);
+    goto yyloop;
+  }
+
+  /*
+  ** Reduce the rule
+  */
+yyreduce:
+  yym = yylen[yyn];
+#if YYDEBUG
+  if (yydebug) {
+    printf("yydebug[%d,%d]: state %d, reducing by rule %d (%s)",
+           (int)yydepth, yytrial!=0, yystate, yyn, yyrule[yyn]);
+#ifdef YYDBPR
+    if (yym) {
+      int i;
+      printf("<");
+      for (i=yym; i>0; i--) {
+        if (i!=yym) printf(", ");
+        YYDBPR((yyps->vsp)[1-i]);
+      }
+      printf(">");
+    }
+#endif
+    printf("\n");
+  }
+#endif
+  if (yyps->ssp + 1 - yym >= yyps->ss + yyps->stacksize) {
+    YYMoreStack(yyps);
+  }
+
+  /* "$$ = $1" default action */
+  yyval = yyvsp[0];
+
+#ifdef YYPOSN
+  /* default reduced position is NULL -- no position at all.
+     no position will be assigned at trial time and if no position handling
+     is present */
+#ifndef YYPOSN_CONSTRUCTOR
+  memset(&yyps->pos, 0, sizeof(yyps->pos));
+#endif
+#ifdef YYREDUCEPOSNFUNC
+  reduce_posn = 1;
+#endif /* YYREDUCEPOSNFUNC */
+#endif /* YYPOSN */
+
+  switch (yyn) {
+
+case 1:
+#line 526 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9704 "parser.tab.c"
+  if (!yytrial)
+#line 526 "/root/repo/src/parser.y"
+{
+                    /* A file without any statement, e.g. one that has only comments which are ignored, is still a file.*/
+                    yyparam->progUnit = yyval.cppCompundObj = yyvsp[0].cppCompundObj ? yyvsp[0].cppCompundObj : newCompound(yyparam->objFactory, CppAccessType::kUnknown);
+                    yyparam->progUnit->compoundType(CppCompoundType::kCppFile);
+                  }
+#line 9712 "parser.tab.c"
+break;
+case 2:
+#line 533 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9717 "parser.tab.c"
+  if (!yytrial)
+#line 533 "/root/repo/src/parser.y"
+{
+                    yyval.cppCompundObj = nullptr;
+                  }
+#line 9723 "parser.tab.c"
+break;
+case 3:
+#line 536 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9728 "parser.tab.c"
+  if (!yytrial)
+#line 536 "/root/repo/src/parser.y"
+{
+                    yyval.cppCompundObj = yyvsp[0].cppCompundObj;
+                  }
+#line 9734 "parser.tab.c"
+break;
+case 4:
+#line 541 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9739 "parser.tab.c"
+  if (!yytrial)
+#line 541 "/root/repo/src/parser.y"
+{
+                    yyval.cppCompundObj = newCompound(yyparam->objFactory, yyparam->accessTypeStack.empty() ? yyparam->curAccessType : yyparam->accessTypeStack.top());
+                    if (yyvsp[0].cppObj)
+                    {
+                      yyval.cppCompundObj->addMember(yyvsp[0].cppObj);
+                    } /* Avoid 'comment-btyacc-constructs.sh' to act on this*/
+                  }
+#line 9749 "parser.tab.c"
+break;
+case 5:
+#line 548 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9754 "parser.tab.c"
+  if (!yytrial)
+#line 548 "/root/repo/src/parser.y"
+{
+                    yyval.cppCompundObj = (yyvsp[-1].cppCompundObj == 0) ? newCompound(yyparam->objFactory, yyparam->accessTypeStack.empty() ? yyparam->curAccessType : yyparam->accessTypeStack.top()) : yyvsp[-1].cppCompundObj;
+                    if (yyvsp[0].cppObj)
+                    {
+                      yyval.cppCompundObj->addMember(yyvsp[0].cppObj);
+                    } /* Avoid 'comment-btyacc-constructs.sh' to act on this*/
+                  }
+#line 9764 "parser.tab.c"
+break;
+case 6:
+#line 555 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9769 "parser.tab.c"
+  if (!yytrial)
+#line 555 "/root/repo/src/parser.y"
+{ yyval.cppCompundObj = yyvsp[-1].cppCompundObj; yyparam->curAccessType = yyvsp[0].objAccessType; }
+#line 9773 "parser.tab.c"
+break;
+case 7:
+#line 558 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9778 "parser.tab.c"
+  if (!yytrial)
+#line 558 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppVarObj; }
+#line 9782 "parser.tab.c"
+break;
+case 8:
+#line 559 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9787 "parser.tab.c"
+  if (!yytrial)
+#line 559 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppVarObjList; }
+#line 9791 "parser.tab.c"
+break;
+case 9:
+#line 560 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9796 "parser.tab.c"
+  if (!yytrial)
+#line 560 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppEnum; }
+#line 9800 "parser.tab.c"
+break;
+case 10:
+#line 561 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9805 "parser.tab.c"
+  if (!yytrial)
+#line 561 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppEnum; }
+#line 9809 "parser.tab.c"
+break;
+case 11:
+#line 562 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9814 "parser.tab.c"
+  if (!yytrial)
+#line 562 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].typedefName; }
+#line 9818 "parser.tab.c"
+break;
+case 12:
+#line 563 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9823 "parser.tab.c"
+  if (!yytrial)
+#line 563 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].typedefList; }
+#line 9827 "parser.tab.c"
+break;
+case 13:
+#line 564 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9832 "parser.tab.c"
+  if (!yytrial)
+#line 564 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppCompundObj; }
+#line 9836 "parser.tab.c"
+break;
+case 14:
+#line 565 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9841 "parser.tab.c"
+  if (!yytrial)
+#line 565 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppCompundObj; }
+#line 9845 "parser.tab.c"
+break;
+case 15:
+#line 566 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9850 "parser.tab.c"
+  if (!yytrial)
+#line 566 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].fwdDeclObj; }
+#line 9854 "parser.tab.c"
+break;
+case 16:
+#line 567 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9859 "parser.tab.c"
+  if (!yytrial)
+#line 567 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].docCommentObj; }
+#line 9863 "parser.tab.c"
+break;
+case 17:
+#line 568 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9868 "parser.tab.c"
+  if (!yytrial)
+#line 568 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppExprObj; }
+#line 9872 "parser.tab.c"
+break;
+case 18:
+#line 569 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9877 "parser.tab.c"
+  if (!yytrial)
+#line 569 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].ifBlock; }
+#line 9881 "parser.tab.c"
+break;
+case 19:
+#line 570 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9886 "parser.tab.c"
+  if (!yytrial)
+#line 570 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].whileBlock; }
+#line 9890 "parser.tab.c"
+break;
+case 20:
+#line 571 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9895 "parser.tab.c"
+  if (!yytrial)
+#line 571 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].doWhileBlock; }
+#line 9899 "parser.tab.c"
+break;
+case 21:
+#line 572 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9904 "parser.tab.c"
+  if (!yytrial)
+#line 572 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].forBlock; }
+#line 9908 "parser.tab.c"
+break;
+case 22:
+#line 573 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9913 "parser.tab.c"
+  if (!yytrial)
+#line 573 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].forRangeBlock; }
+#line 9917 "parser.tab.c"
+break;
+case 23:
+#line 574 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9922 "parser.tab.c"
+  if (!yytrial)
+#line 574 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppFuncPointerObj; }
+#line 9926 "parser.tab.c"
+break;
+case 24:
+#line 575 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9931 "parser.tab.c"
+  if (!yytrial)
+#line 575 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppFuncObj; }
+#line 9935 "parser.tab.c"
+break;
+case 25:
+#line 576 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9940 "parser.tab.c"
+  if (!yytrial)
+#line 576 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppFuncObj; }
+#line 9944 "parser.tab.c"
+break;
+case 26:
+#line 577 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9949 "parser.tab.c"
+  if (!yytrial)
+#line 577 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppCtorObj; }
+#line 9953 "parser.tab.c"
+break;
+case 27:
+#line 578 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9958 "parser.tab.c"
+  if (!yytrial)
+#line 578 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppCtorObj; }
+#line 9962 "parser.tab.c"
+break;
+case 28:
+#line 579 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9967 "parser.tab.c"
+  if (!yytrial)
+#line 579 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppDtorObj; }
+#line 9971 "parser.tab.c"
+break;
+case 29:
+#line 580 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9976 "parser.tab.c"
+  if (!yytrial)
+#line 580 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppDtorObj; }
+#line 9980 "parser.tab.c"
+break;
+case 30:
+#line 581 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9985 "parser.tab.c"
+  if (!yytrial)
+#line 581 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppTypeConverter; }
+#line 9989 "parser.tab.c"
+break;
+case 31:
+#line 582 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 9994 "parser.tab.c"
+  if (!yytrial)
+#line 582 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppCompundObj; }
+#line 9998 "parser.tab.c"
+break;
+case 32:
+#line 583 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10003 "parser.tab.c"
+  if (!yytrial)
+#line 583 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppFuncPointerObj; }
+#line 10007 "parser.tab.c"
+break;
+case 33:
+#line 584 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10012 "parser.tab.c"
+  if (!yytrial)
+#line 584 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppObj; }
+#line 10016 "parser.tab.c"
+break;
+case 34:
+#line 585 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10021 "parser.tab.c"
+  if (!yytrial)
+#line 585 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].cppCompundObj; }
+#line 10025 "parser.tab.c"
+break;
+case 35:
+#line 586 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10030 "parser.tab.c"
+  if (!yytrial)
+#line 586 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].switchBlock; }
+#line 10034 "parser.tab.c"
+break;
+case 36:
+#line 587 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10039 "parser.tab.c"
+  if (!yytrial)
+#line 587 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].tryBlock; }
+#line 10043 "parser.tab.c"
+break;
+case 37:
+#line 588 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10048 "parser.tab.c"
+  if (!yytrial)
+#line 588 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].usingDecl; }
+#line 10052 "parser.tab.c"
+break;
+case 38:
+#line 589 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10057 "parser.tab.c"
+  if (!yytrial)
+#line 589 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].usingNamespaceDecl; }
+#line 10061 "parser.tab.c"
+break;
+case 39:
+#line 590 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10066 "parser.tab.c"
+  if (!yytrial)
+#line 590 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].namespaceAlias; }
+#line 10070 "parser.tab.c"
+break;
+case 40:
+#line 591 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10075 "parser.tab.c"
+  if (!yytrial)
+#line 591 "/root/repo/src/parser.y"
+{ yyval.cppObj = newObj<CppMacroCall>(yyparam->objFactory, yyparam->sourceText(yyvsp[0].str), yyparam->curAccessType); }
+#line 10079 "parser.tab.c"
+break;
+case 41:
+#line 592 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10084 "parser.tab.c"
+  if (!yytrial)
+#line 592 "/root/repo/src/parser.y"
+{ yyval.cppObj = newObj<CppMacroCall>(yyparam->objFactory, yyparam->sourceText(mergeCppToken(yyvsp[-1].str, yyvsp[0].str)), yyparam->curAccessType); }
+#line 10088 "parser.tab.c"
+break;
+case 42:
+#line 593 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10093 "parser.tab.c"
+  if (!yytrial)
+#line 593 "/root/repo/src/parser.y"
+{ yyval.cppObj = newObj<CppMacroCall>(yyparam->objFactory, yyparam->sourceText(mergeCppToken(yyvsp[-1].str, yyvsp[0].str)), yyparam->curAccessType); }
+#line 10097 "parser.tab.c"
+break;
+case 43:
+#line 594 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10102 "parser.tab.c"
+  if (!yytrial)
+#line 594 "/root/repo/src/parser.y"
+{ yyval.cppObj = nullptr; }
+#line 10106 "parser.tab.c"
+break;
+case 44:
+#line 595 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10111 "parser.tab.c"
+  if (!yytrial)
+#line 595 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].asmBlock; }
+#line 10115 "parser.tab.c"
+break;
+case 45:
+#line 596 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10120 "parser.tab.c"
+  if (!yytrial)
+#line 596 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].blob; }
+#line 10124 "parser.tab.c"
+break;
+case 46:
+#line 597 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10129 "parser.tab.c"
+  if (!yytrial)
+#line 597 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].label; }
+#line 10133 "parser.tab.c"
+break;
+case 47:
+#line 600 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10138 "parser.tab.c"
+  if (!yytrial)
+#line 600 "/root/repo/src/parser.y"
+{ yyval.label = newObj<CppLabel>(yyparam->objFactory, yyvsp[-1].str); }
+#line 10142 "parser.tab.c"
+break;
+case 48:
+#line 603 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10147 "parser.tab.c"
+  if (!yytrial)
+#line 603 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].hashDefine; }
+#line 10151 "parser.tab.c"
+break;
+case 49:
+#line 604 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10156 "parser.tab.c"
+  if (!yytrial)
+#line 604 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].hashUndef; }
+#line 10160 "parser.tab.c"
+break;
+case 50:
+#line 605 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10165 "parser.tab.c"
+  if (!yytrial)
+#line 605 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].hashInclude; }
+#line 10169 "parser.tab.c"
+break;
+case 51:
+#line 606 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10174 "parser.tab.c"
+  if (!yytrial)
+#line 606 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].hashImport; }
+#line 10178 "parser.tab.c"
+break;
+case 52:
+#line 607 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10183 "parser.tab.c"
+  if (!yytrial)
+#line 607 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].hashIf; }
+#line 10187 "parser.tab.c"
+break;
+case 53:
+#line 608 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10192 "parser.tab.c"
+  if (!yytrial)
+#line 608 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].hashError; }
+#line 10196 "parser.tab.c"
+break;
+case 54:
+#line 609 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10201 "parser.tab.c"
+  if (!yytrial)
+#line 609 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].hashWarning; }
+#line 10205 "parser.tab.c"
+break;
+case 55:
+#line 610 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10210 "parser.tab.c"
+  if (!yytrial)
+#line 610 "/root/repo/src/parser.y"
+{ yyval.cppObj = yyvsp[0].hashPragma; }
+#line 10214 "parser.tab.c"
+break;
+case 56:
+#line 613 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10219 "parser.tab.c"
+  if (!yytrial)
+#line 613 "/root/repo/src/parser.y"
+{ yyval.asmBlock = newObj<CppAsmBlock>(yyparam->objFactory, yyparam->sourceText(yyvsp[0].str)); }
+#line 10223 "parser.tab.c"
+break;
+case 57:
+#line 616 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str;}
+#line 10228 "parser.tab.c"
+break;
+case 58:
+  if (!yytrial)
+#line 616 "/root/repo/src/parser.y"
+{}
+#line 10234 "parser.tab.c"
+break;
+case 59:
+#line 617 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = mergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 10239 "parser.tab.c"
+break;
+case 60:
+  if (!yytrial)
+#line 617 "/root/repo/src/parser.y"
+{}
+#line 10245 "parser.tab.c"
+break;
+case 61:
+#line 618 "/root/repo/src/parser.y"
+{
+                    ZZLOG;
+                    yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str);
+                  }
+#line 10253 "parser.tab.c"
+break;
+case 62:
+  if (!yytrial)
+#line 621 "/root/repo/src/parser.y"
+{
+                    delete yyvsp[-2].cppExprObj;
+                  }
+#line 10261 "parser.tab.c"
+break;
+case 63:
+#line 626 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10266 "parser.tab.c"
+  if (!yytrial)
+#line 626 "/root/repo/src/parser.y"
+{
+                    yyval.switchBlock = newObj<CppSwitchBlock>(yyparam->objFactory, yyvsp[-4].cppExprObj, yyvsp[-1].switchBody);
+                  }
+#line 10272 "parser.tab.c"
+break;
+case 64:
+#line 631 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10277 "parser.tab.c"
+  if (!yytrial)
+#line 631 "/root/repo/src/parser.y"
+{
+                    yyval.switchBody = new CppSwitchBody;
+                  }
+#line 10283 "parser.tab.c"
+break;
+case 65:
+#line 634 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10288 "parser.tab.c"
+  if (!yytrial)
+#line 634 "/root/repo/src/parser.y"
+{
+                    yyval.switchBody = yyvsp[-4].switchBody;
+                    yyval.switchBody->emplace_back(yyvsp[-2].cppExprObj, yyvsp[0].cppCompundObj);
+                  }
+#line 10295 "parser.tab.c"
+break;
+case 66:
+#line 638 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10300 "parser.tab.c"
+  if (!yytrial)
+#line 638 "/root/repo/src/parser.y"
+{
+                    yyval.switchBody = yyvsp[-3].switchBody;
+                    yyval.switchBody->emplace_back(nullptr, yyvsp[0].cppCompundObj);
+                  }
+#line 10307 "parser.tab.c"
+break;
+case 67:
+#line 642 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10312 "parser.tab.c"
+  if (!yytrial)
+#line 642 "/root/repo/src/parser.y"
+{ yyval.switchBody = yyvsp[0].switchBody; }
+#line 10316 "parser.tab.c"
+break;
+case 68:
+#line 643 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10321 "parser.tab.c"
+  if (!yytrial)
+#line 643 "/root/repo/src/parser.y"
+{ yyval.switchBody = yyvsp[-1].switchBody; }
+#line 10325 "parser.tab.c"
+break;
+case 69:
+#line 646 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10330 "parser.tab.c"
+  if (!yytrial)
+#line 646 "/root/repo/src/parser.y"
+{
+                    yyval.cppCompundObj = yyvsp[-1].cppCompundObj;
+                    if (yyval.cppCompundObj == nullptr)
+                      yyval.cppCompundObj = newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock);
+                    else
+                      yyval.cppCompundObj->compoundType(CppCompoundType::kBlock);
+                  }
+#line 10340 "parser.tab.c"
+break;
+case 70:
+#line 653 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10345 "parser.tab.c"
+  if (!yytrial)
+#line 653 "/root/repo/src/parser.y"
+{
+                    yyval.cppCompundObj = yyvsp[0].cppCompundObj;
+                    delete yyvsp[-1].docCommentObj;
+                  }
+#line 10352 "parser.tab.c"
+break;
+case 71:
+#line 659 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10357 "parser.tab.c"
+  if (!yytrial)
+#line 659 "/root/repo/src/parser.y"
+{
+                    yyval.ifBlock = newObj<CppIfBlock>(yyparam->objFactory, yyvsp[-2].cppExprObj, yyvsp[0].cppObj);
+                  }
+#line 10363 "parser.tab.c"
+break;
+case 72:
+#line 662 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10368 "parser.tab.c"
+  if (!yytrial)
+#line 662 "/root/repo/src/parser.y"
+{
+                    yyval.ifBlock = newObj<CppIfBlock>(yyparam->objFactory, yyvsp[-2].cppVarObj, yyvsp[0].cppObj);
+                  }
+#line 10374 "parser.tab.c"
+break;
+case 73:
+#line 665 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10379 "parser.tab.c"
+  if (!yytrial)
+#line 665 "/root/repo/src/parser.y"
+{
+                    yyval.ifBlock = yyvsp[-2].ifBlock;
+                    yyval.ifBlock->elsePart(yyvsp[0].cppObj);
+                  }
+#line 10386 "parser.tab.c"
+break;
+case 74:
+#line 671 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10391 "parser.tab.c"
+  if (!yytrial)
+#line 671 "/root/repo/src/parser.y"
+{
+                    yyval.whileBlock = newObj<CppWhileBlock>(yyparam->objFactory, yyvsp[-2].cppExprObj, yyvsp[0].cppObj);
+                  }
+#line 10397 "parser.tab.c"
+break;
+case 75:
+#line 674 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10402 "parser.tab.c"
+  if (!yytrial)
+#line 674 "/root/repo/src/parser.y"
+{
+                    yyval.whileBlock = newObj<CppWhileBlock>(yyparam->objFactory, yyvsp[-2].cppVarObj, yyvsp[0].cppObj);
+                  }
+#line 10408 "parser.tab.c"
+break;
+case 76:
+#line 679 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10413 "parser.tab.c"
+  if (!yytrial)
+#line 679 "/root/repo/src/parser.y"
+{
+                    yyval.doWhileBlock = newObj<CppDoWhileBlock>(yyparam->objFactory, yyvsp[-1].cppExprObj, yyvsp[-4].cppObj);
+                  }
+#line 10419 "parser.tab.c"
+break;
+case 77:
+#line 684 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10424 "parser.tab.c"
+  if (!yytrial)
+#line 684 "/root/repo/src/parser.y"
+{
+                    yyval.forBlock = newObj<CppForBlock>(yyparam->objFactory, yyvsp[-6].cppExprObj, yyvsp[-4].cppExprObj, yyvsp[-2].cppExprObj, yyvsp[0].cppObj);
+                  }
+#line 10430 "parser.tab.c"
+break;
+case 78:
+#line 687 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10435 "parser.tab.c"
+  if (!yytrial)
+#line 687 "/root/repo/src/parser.y"
+{
+                    yyval.forBlock = newObj<CppForBlock>(yyparam->objFactory, yyvsp[-6].cppVarObj, yyvsp[-4].cppExprObj, yyvsp[-2].cppExprObj, yyvsp[0].cppObj);
+                  }
+#line 10441 "parser.tab.c"
+break;
+case 79:
+#line 690 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10446 "parser.tab.c"
+  if (!yytrial)
+#line 690 "/root/repo/src/parser.y"
+{
+                    yyval.forBlock = newObj<CppForBlock>(yyparam->objFactory, yyvsp[-6].cppVarObjList, yyvsp[-4].cppExprObj, yyvsp[-2].cppExprObj, yyvsp[0].cppObj);
+                  }
+#line 10452 "parser.tab.c"
+break;
+case 80:
+#line 695 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10457 "parser.tab.c"
+  if (!yytrial)
+#line 695 "/root/repo/src/parser.y"
+{
+                    yyval.forRangeBlock = newObj<CppRangeForBlock>(yyparam->objFactory, yyvsp[-4].cppVarObj, yyvsp[-2].cppExprObj, yyvsp[0].cppObj);
+                  }
+#line 10463 "parser.tab.c"
+break;
+case 81:
+#line 700 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10468 "parser.tab.c"
+  if (!yytrial)
+#line 700 "/root/repo/src/parser.y"
+{
+                    yyval.tryBlock = newObj<CppTryBlock>(yyparam->objFactory, yyvsp[-1].cppCompundObj, yyvsp[0].catchBlock);
+                  }
+#line 10474 "parser.tab.c"
+break;
+case 82:
+#line 703 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10479 "parser.tab.c"
+  if (!yytrial)
+#line 703 "/root/repo/src/parser.y"
+{
+                    yyval.tryBlock = yyvsp[-1].tryBlock;
+                    yyval.tryBlock->addCatchBlock(yyvsp[0].catchBlock);
+                  }
+#line 10486 "parser.tab.c"
+break;
+case 83:
+#line 709 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10491 "parser.tab.c"
+  if (!yytrial)
+#line 709 "/root/repo/src/parser.y"
+{
+                    yyval.catchBlock = newObj<CppCatchBlock>(yyparam->objFactory, CppVarTypePtr(yyvsp[-3].cppVarType), yyvsp[-2].str, CppCompoundPtr(yyvsp[0].cppCompundObj));
+                  }
+#line 10497 "parser.tab.c"
+break;
+case 84:
+  if (!yytrial)
+#line 714 "/root/repo/src/parser.y"
+{
+                    yyval.cppExprObj = nullptr;
+                  }
+#line 10505 "parser.tab.c"
+break;
+case 85:
+#line 717 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10510 "parser.tab.c"
+  if (!yytrial)
+#line 717 "/root/repo/src/parser.y"
+{
+                    yyval.cppExprObj = yyvsp[0].cppExprObj;
+                  }
+#line 10516 "parser.tab.c"
+break;
+case 86:
+#line 720 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10521 "parser.tab.c"
+  if (!yytrial)
+#line 720 "/root/repo/src/parser.y"
+{
+                    yyval.cppExprObj = yyvsp[0].cppExprObj;
+                  }
+#line 10527 "parser.tab.c"
+break;
+case 87:
+#line 725 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10532 "parser.tab.c"
+  if (!yytrial)
+#line 725 "/root/repo/src/parser.y"
+{
+                    yyval.hashDefine = newObj<CppDefine>(yyparam->objFactory, CppDefine::kRename, yyvsp[-1].str, yyparam->sourceText(yyvsp[0].str));
+                  }
+#line 10538 "parser.tab.c"
+break;
+case 88:
+#line 728 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10543 "parser.tab.c"
+  if (!yytrial)
+#line 728 "/root/repo/src/parser.y"
+{
+                    yyval.hashDefine = newObj<CppDefine>(yyparam->objFactory, CppDefine::kRename, yyvsp[0].str);
+                  }
+#line 10549 "parser.tab.c"
+break;
+case 89:
+#line 731 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10554 "parser.tab.c"
+  if (!yytrial)
+#line 731 "/root/repo/src/parser.y"
+{
+                    yyval.hashDefine = newObj<CppDefine>(yyparam->objFactory, CppDefine::kConstNumDef, yyvsp[-1].str, yyparam->sourceText(yyvsp[0].str));
+                  }
+#line 10560 "parser.tab.c"
+break;
+case 90:
+#line 734 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10565 "parser.tab.c"
+  if (!yytrial)
+#line 734 "/root/repo/src/parser.y"
+{
+                    yyval.hashDefine = newObj<CppDefine>(yyparam->objFactory, CppDefine::kConstStrDef, yyvsp[-1].str, yyparam->sourceText(yyvsp[0].str));
+                  }
+#line 10571 "parser.tab.c"
+break;
+case 91:
+#line 737 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10576 "parser.tab.c"
+  if (!yytrial)
+#line 737 "/root/repo/src/parser.y"
+{
+                    yyval.hashDefine = newObj<CppDefine>(yyparam->objFactory, CppDefine::kConstCharDef, yyvsp[-1].str, yyparam->sourceText(yyvsp[0].str));
+                  }
+#line 10582 "parser.tab.c"
+break;
+case 92:
+#line 740 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10587 "parser.tab.c"
+  if (!yytrial)
+#line 740 "/root/repo/src/parser.y"
+{
+                    yyval.hashDefine = newObj<CppDefine>(yyparam->objFactory, CppDefine::kComplexMacro, yyvsp[-1].str, yyparam->sourceText(yyvsp[0].str));
+                  }
+#line 10593 "parser.tab.c"
+break;
+case 93:
+#line 745 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10598 "parser.tab.c"
+  if (!yytrial)
+#line 745 "/root/repo/src/parser.y"
+{ yyval.hashUndef = newObj<CppUndef>(yyparam->objFactory, yyvsp[0].str); }
+#line 10602 "parser.tab.c"
+break;
+case 94:
+#line 748 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10607 "parser.tab.c"
+  if (!yytrial)
+#line 748 "/root/repo/src/parser.y"
+{ yyval.hashInclude = newObj<CppInclude>(yyparam->objFactory, (std::string) yyvsp[0].str); }
+#line 10611 "parser.tab.c"
+break;
+case 95:
+#line 749 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10616 "parser.tab.c"
+  if (!yytrial)
+#line 749 "/root/repo/src/parser.y"
+{ yyval.hashInclude = newObj<CppInclude>(yyparam->objFactory, (std::string) yyvsp[0].str); }
+#line 10620 "parser.tab.c"
+break;
+case 96:
+#line 752 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10625 "parser.tab.c"
+  if (!yytrial)
+#line 752 "/root/repo/src/parser.y"
+{ yyval.hashImport = newObj<CppImport>(yyparam->objFactory, (std::string) yyvsp[0].str); }
+#line 10629 "parser.tab.c"
+break;
+case 97:
+#line 753 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10634 "parser.tab.c"
+  if (!yytrial)
+#line 753 "/root/repo/src/parser.y"
+{ yyval.hashImport = newObj<CppImport>(yyparam->objFactory, (std::string) yyvsp[0].str); }
+#line 10638 "parser.tab.c"
+break;
+case 98:
+#line 756 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10643 "parser.tab.c"
+  if (!yytrial)
+#line 756 "/root/repo/src/parser.y"
+{ yyval.hashIf = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kIf,      yyvsp[0].str); }
+#line 10647 "parser.tab.c"
+break;
+case 99:
+#line 757 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10652 "parser.tab.c"
+  if (!yytrial)
+#line 757 "/root/repo/src/parser.y"
+{ yyval.hashIf = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kIfDef,   yyvsp[0].str); }
+#line 10656 "parser.tab.c"
+break;
+case 100:
+#line 758 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10661 "parser.tab.c"
+  if (!yytrial)
+#line 758 "/root/repo/src/parser.y"
+{ yyval.hashIf = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kIfNDef,  yyvsp[0].str); }
+#line 10665 "parser.tab.c"
+break;
+case 101:
+#line 759 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10670 "parser.tab.c"
+  if (!yytrial)
+#line 759 "/root/repo/src/parser.y"
+{ yyval.hashIf = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kIfNDef,  yyvsp[0].str); }
+#line 10674 "parser.tab.c"
+break;
+case 102:
+#line 760 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10679 "parser.tab.c"
+  if (!yytrial)
+#line 760 "/root/repo/src/parser.y"
+{ yyval.hashIf = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kElse       ); }
+#line 10683 "parser.tab.c"
+break;
+case 103:
+#line 761 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10688 "parser.tab.c"
+  if (!yytrial)
+#line 761 "/root/repo/src/parser.y"
+{ yyval.hashIf = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kElIf,    yyvsp[0].str); }
+#line 10692 "parser.tab.c"
+break;
+case 104:
+#line 762 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10697 "parser.tab.c"
+  if (!yytrial)
+#line 762 "/root/repo/src/parser.y"
+{ yyval.hashIf = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kEndIf      ); }
+#line 10701 "parser.tab.c"
+break;
+case 105:
+#line 765 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10706 "parser.tab.c"
+  if (!yytrial)
+#line 765 "/root/repo/src/parser.y"
+{ yyval.hashError = newObj<CppHashError>(yyparam->objFactory, yyvsp[0].str); }
+#line 10710 "parser.tab.c"
+break;
+case 106:
+#line 766 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10715 "parser.tab.c"
+  if (!yytrial)
+#line 766 "/root/repo/src/parser.y"
+{ yyval.hashError = newObj<CppHashError>(yyparam->objFactory, mergeCppToken(yyvsp[-1].str, yyvsp[0].str)); }
+#line 10719 "parser.tab.c"
+break;
+case 107:
+#line 769 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10724 "parser.tab.c"
+  if (!yytrial)
+#line 769 "/root/repo/src/parser.y"
+{ yyval.hashWarning = newObj<CppHashWarning>(yyparam->objFactory, yyvsp[0].str); }
+#line 10728 "parser.tab.c"
+break;
+case 108:
+#line 770 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10733 "parser.tab.c"
+  if (!yytrial)
+#line 770 "/root/repo/src/parser.y"
+{ yyval.hashWarning = newObj<CppHashWarning>(yyparam->objFactory, mergeCppToken(yyvsp[-1].str, yyvsp[0].str)); }
+#line 10737 "parser.tab.c"
+break;
+case 109:
+#line 773 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10742 "parser.tab.c"
+  if (!yytrial)
+#line 773 "/root/repo/src/parser.y"
+{ yyval.hashPragma = newObj<CppPragma>(yyparam->objFactory, yyvsp[0].str); }
+#line 10746 "parser.tab.c"
+break;
+case 110:
+#line 776 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10751 "parser.tab.c"
+  if (!yytrial)
+#line 776 "/root/repo/src/parser.y"
+{ yyval.docCommentObj = newObj<CppDocComment>(yyparam->objFactory, (std::string) yyvsp[0].str, yyparam->curAccessType); }
+#line 10755 "parser.tab.c"
+break;
+case 111:
+#line 779 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10760 "parser.tab.c"
+  if (!yytrial)
+#line 779 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 10764 "parser.tab.c"
+break;
+case 112:
+#line 780 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10769 "parser.tab.c"
+  if (!yytrial)
+#line 780 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 10773 "parser.tab.c"
+break;
+case 113:
+#line 781 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10778 "parser.tab.c"
+  if (!yytrial)
+#line 781 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 10782 "parser.tab.c"
+break;
+case 114:
+#line 782 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10787 "parser.tab.c"
+  if (!yytrial)
+#line 782 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 10791 "parser.tab.c"
+break;
+case 115:
+#line 785 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 10796 "parser.tab.c"
+break;
+case 116:
+  if (!yytrial)
+#line 785 "/root/repo/src/parser.y"
+{}
+#line 10802 "parser.tab.c"
+break;
+case 117:
+#line 786 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = mergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 10807 "parser.tab.c"
+break;
+case 118:
+  if (!yytrial)
+#line 786 "/root/repo/src/parser.y"
+{}
+#line 10813 "parser.tab.c"
+break;
+case 119:
+#line 787 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 10818 "parser.tab.c"
+break;
+case 120:
+  if (!yytrial)
+#line 787 "/root/repo/src/parser.y"
+{}
+#line 10824 "parser.tab.c"
+break;
+case 121:
+#line 788 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 10829 "parser.tab.c"
+break;
+case 122:
+  if (!yytrial)
+#line 788 "/root/repo/src/parser.y"
+{}
+#line 10835 "parser.tab.c"
+break;
+case 123:
+#line 789 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str;}
+#line 10840 "parser.tab.c"
+break;
+case 124:
+  if (!yytrial)
+#line 789 "/root/repo/src/parser.y"
+{ /* override is not a reserved keyword */ }
+#line 10846 "parser.tab.c"
+break;
+case 125:
+#line 790 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 10851 "parser.tab.c"
+break;
+case 126:
+  if (!yytrial)
+#line 790 "/root/repo/src/parser.y"
+{}
+#line 10857 "parser.tab.c"
+break;
+case 127:
+#line 791 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 10862 "parser.tab.c"
+break;
+case 128:
+  if (!yytrial)
+#line 791 "/root/repo/src/parser.y"
+{}
+#line 10868 "parser.tab.c"
+break;
+case 129:
+#line 792 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 10873 "parser.tab.c"
+break;
+case 130:
+  if (!yytrial)
+#line 792 "/root/repo/src/parser.y"
+{}
+#line 10879 "parser.tab.c"
+break;
+case 131:
+#line 795 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10884 "parser.tab.c"
+  if (!yytrial)
+#line 795 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 10888 "parser.tab.c"
+break;
+case 132:
+#line 796 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10893 "parser.tab.c"
+  if (!yytrial)
+#line 796 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 10897 "parser.tab.c"
+break;
+case 133:
+#line 797 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10902 "parser.tab.c"
+  if (!yytrial)
+#line 797 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 10906 "parser.tab.c"
+break;
+case 134:
+#line 798 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10911 "parser.tab.c"
+  if (!yytrial)
+#line 798 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 10915 "parser.tab.c"
+break;
+case 135:
+#line 799 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10920 "parser.tab.c"
+  if (!yytrial)
+#line 799 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 10924 "parser.tab.c"
+break;
+case 136:
+#line 800 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10929 "parser.tab.c"
+  if (!yytrial)
+#line 800 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 10933 "parser.tab.c"
+break;
+case 137:
+#line 803 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10938 "parser.tab.c"
+  if (!yytrial)
+#line 803 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 10942 "parser.tab.c"
+break;
+case 138:
+#line 804 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10947 "parser.tab.c"
+  if (!yytrial)
+#line 804 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 10951 "parser.tab.c"
+break;
+case 139:
+#line 805 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10956 "parser.tab.c"
+  if (!yytrial)
+#line 805 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 10960 "parser.tab.c"
+break;
+case 140:
+#line 806 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10965 "parser.tab.c"
+  if (!yytrial)
+#line 806 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 10969 "parser.tab.c"
+break;
+case 141:
+#line 807 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10974 "parser.tab.c"
+  if (!yytrial)
+#line 807 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 10978 "parser.tab.c"
+break;
+case 142:
+#line 808 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10983 "parser.tab.c"
+  if (!yytrial)
+#line 808 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 10987 "parser.tab.c"
+break;
+case 143:
+#line 809 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 10992 "parser.tab.c"
+  if (!yytrial)
+#line 809 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 10996 "parser.tab.c"
+break;
+case 144:
+#line 810 "/root/repo/src/parser.y"
+{
+                    if (yyparam->templateParamStart == yyvsp[-1].str.sz)
+                      ZZERROR;
+                    else
+                      ZZLOG;
+                  }{ZZLOG;}
+#line 11006 "parser.tab.c"
+  if (!yytrial)
+#line 815 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 11010 "parser.tab.c"
+break;
+case 145:
+#line 816 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11015 "parser.tab.c"
+  if (!yytrial)
+#line 816 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 11019 "parser.tab.c"
+break;
+case 146:
+#line 817 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11024 "parser.tab.c"
+  if (!yytrial)
+#line 817 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 11028 "parser.tab.c"
+break;
+case 147:
+#line 818 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11033 "parser.tab.c"
+  if (!yytrial)
+#line 818 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 11037 "parser.tab.c"
+break;
+case 148:
+#line 819 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11042 "parser.tab.c"
+  if (!yytrial)
+#line 819 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 11046 "parser.tab.c"
+break;
+case 149:
+#line 820 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11051 "parser.tab.c"
+  if (!yytrial)
+#line 820 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str); delete yyvsp[-1].cppExprObj; }
+#line 11055 "parser.tab.c"
+break;
+case 150:
+#line 823 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 11060 "parser.tab.c"
+break;
+case 151:
+  if (!yytrial)
+#line 823 "/root/repo/src/parser.y"
+{}
+#line 11066 "parser.tab.c"
+break;
+case 152:
+#line 826 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = mergeCppToken(yyvsp[-5].str, yyvsp[0].str); }
+#line 11071 "parser.tab.c"
+break;
+case 153:
+  if (!yytrial)
+#line 826 "/root/repo/src/parser.y"
+{ delete yyvsp[-4].cppExprObj; delete yyvsp[-2].cppExprObj; }
+#line 11077 "parser.tab.c"
+break;
+case 154:
+#line 831 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = mergeCppToken(yyvsp[-7].str, yyvsp[0].str); }
+#line 11082 "parser.tab.c"
+break;
+case 155:
+  if (!yytrial)
+#line 831 "/root/repo/src/parser.y"
+{ delete yyvsp[-4].cppExprObj; delete yyvsp[-2].cppExprObj; }
+#line 11088 "parser.tab.c"
+break;
+case 156:
+#line 834 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 11093 "parser.tab.c"
+break;
+case 157:
+  if (!yytrial)
+#line 834 "/root/repo/src/parser.y"
+{}
+#line 11099 "parser.tab.c"
+break;
+case 158:
+#line 837 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str;}
+#line 11104 "parser.tab.c"
+break;
+case 159:
+  if (!yytrial)
+#line 837 "/root/repo/src/parser.y"
+{}
+#line 11110 "parser.tab.c"
+break;
+case 160:
+#line 840 "/root/repo/src/parser.y"
+{ZZLOG; yyval.str = yyvsp[0].str; }
+#line 11115 "parser.tab.c"
+break;
+case 161:
+  if (!yytrial)
+#line 840 "/root/repo/src/parser.y"
+{}
+#line 11121 "parser.tab.c"
+break;
+case 162:
+#line 843 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11126 "parser.tab.c"
+  if (!yytrial)
+#line 843 "/root/repo/src/parser.y"
+{ yyval.str = makeCppToken(nullptr, nullptr); }
+#line 11130 "parser.tab.c"
+break;
+case 163:
+#line 844 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11135 "parser.tab.c"
+  if (!yytrial)
+#line 844 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 11139 "parser.tab.c"
+break;
+case 164:
+#line 846 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11144 "parser.tab.c"
+  if (!yytrial)
+#line 846 "/root/repo/src/parser.y"
+{ yyval.str = makeCppToken(nullptr, nullptr); }
+#line 11148 "parser.tab.c"
+break;
+case 165:
+#line 847 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11153 "parser.tab.c"
+  if (!yytrial)
+#line 847 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 11157 "parser.tab.c"
+break;
+case 166:
+#line 850 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11162 "parser.tab.c"
+  if (!yytrial)
+#line 850 "/root/repo/src/parser.y"
+{ yyval.enumItem = CppNtEnumItem{yyvsp[0].str, nullptr};                         }
+#line 11166 "parser.tab.c"
+break;
+case 167:
+#line 851 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11171 "parser.tab.c"
+  if (!yytrial)
+#line 851 "/root/repo/src/parser.y"
+{ yyval.enumItem = CppNtEnumItem{yyvsp[-2].str, yyvsp[0].cppExprObj};                              }
+#line 11175 "parser.tab.c"
+break;
+case 168:
+#line 852 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11180 "parser.tab.c"
+  if (!yytrial)
+#line 852 "/root/repo/src/parser.y"
+{ yyval.enumItem = CppNtEnumItem{makeCppToken(nullptr, nullptr), yyvsp[0].docCommentObj}; }
+#line 11184 "parser.tab.c"
+break;
+case 169:
+#line 853 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11189 "parser.tab.c"
+  if (!yytrial)
+#line 853 "/root/repo/src/parser.y"
+{ yyval.enumItem = CppNtEnumItem{makeCppToken(nullptr, nullptr), yyvsp[0].cppObj}; }
+#line 11193 "parser.tab.c"
+break;
+case 170:
+#line 854 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11198 "parser.tab.c"
+  if (!yytrial)
+#line 854 "/root/repo/src/parser.y"
+{ yyval.enumItem = CppNtEnumItem{yyvsp[0].str, nullptr};                         }
+#line 11202 "parser.tab.c"
+break;
+case 171:
+#line 855 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11207 "parser.tab.c"
+  if (!yytrial)
+#line 855 "/root/repo/src/parser.y"
+{ yyval.enumItem = CppNtEnumItem{makeCppToken(nullptr, nullptr), yyvsp[0].blob}; }
+#line 11211 "parser.tab.c"
+break;
+case 172:
+#line 858 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11216 "parser.tab.c"
+  if (!yytrial)
+#line 858 "/root/repo/src/parser.y"
+{ yyval.blob = newObj<CppBlob>(yyparam->objFactory, yyparam->sourceText(yyvsp[0].str)); }
+#line 11220 "parser.tab.c"
+break;
+case 173:
+#line 861 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11225 "parser.tab.c"
+  if (!yytrial)
+#line 861 "/root/repo/src/parser.y"
+{ yyval.enumItemList = 0; }
+#line 11229 "parser.tab.c"
+break;
+case 174:
+#line 862 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11234 "parser.tab.c"
+  if (!yytrial)
+#line 862 "/root/repo/src/parser.y"
+{
+                    yyval.enumItemList = yyvsp[-1].enumItemList ? yyvsp[-1].enumItemList : new CppEnumItemList;
+                    addEnumItem(yyval.enumItemList, yyvsp[0].enumItem);
+                  }
+#line 11241 "parser.tab.c"
+break;
+case 175:
+#line 866 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11246 "parser.tab.c"
+  if (!yytrial)
+#line 866 "/root/repo/src/parser.y"
+{
+                    yyval.enumItemList = yyvsp[-2].enumItemList ? yyvsp[-2].enumItemList : new CppEnumItemList;
+                    addEnumItem(yyval.enumItemList, yyvsp[0].enumItem);
+                  }
+#line 11253 "parser.tab.c"
+break;
+case 176:
+#line 870 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11258 "parser.tab.c"
+  if (!yytrial)
+#line 870 "/root/repo/src/parser.y"
+{
+                    yyval.enumItemList = yyvsp[-1].enumItemList;
+                  }
+#line 11264 "parser.tab.c"
+break;
+case 177:
+#line 875 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11269 "parser.tab.c"
+  if (!yytrial)
+#line 875 "/root/repo/src/parser.y"
+{
+                    yyval.cppEnum = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-3].str, yyvsp[-1].enumItemList);
+                  }
+#line 11275 "parser.tab.c"
+break;
+case 178:
+#line 878 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11280 "parser.tab.c"
+  if (!yytrial)
+#line 878 "/root/repo/src/parser.y"
+{
+                    yyval.cppEnum = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-5].str, yyvsp[-1].enumItemList, false, yyvsp[-3].str);
+                  }
+#line 11286 "parser.tab.c"
+break;
+case 179:
+#line 881 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11291 "parser.tab.c"
+  if (!yytrial)
+#line 881 "/root/repo/src/parser.y"
+{
+                    yyval.cppEnum = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, "", yyvsp[-1].enumItemList, false, yyvsp[-3].str);
+                  }
+#line 11297 "parser.tab.c"
+break;
+case 180:
+#line 884 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11302 "parser.tab.c"
+  if (!yytrial)
+#line 884 "/root/repo/src/parser.y"
+{
+                    yyval.cppEnum = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-3].str, yyvsp[-1].enumItemList, false);
+                  }
+#line 11308 "parser.tab.c"
+break;
+case 181:
+#line 887 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11313 "parser.tab.c"
+  if (!yytrial)
+#line 887 "/root/repo/src/parser.y"
+{
+                    yyval.cppEnum = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-5].str, yyvsp[-1].enumItemList, true, yyvsp[-3].str);
+                  }
+#line 11319 "parser.tab.c"
+break;
+case 182:
+#line 890 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11324 "parser.tab.c"
+  if (!yytrial)
+#line 890 "/root/repo/src/parser.y"
+{
+                    yyval.cppEnum = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-3].str, yyvsp[-1].enumItemList, true);
+                  }
+#line 11330 "parser.tab.c"
+break;
+case 183:
+#line 893 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11335 "parser.tab.c"
+  if (!yytrial)
+#line 893 "/root/repo/src/parser.y"
+{
+                    yyval.cppEnum = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, yyvsp[0].str, yyvsp[-2].enumItemList);
+                  }
+#line 11341 "parser.tab.c"
+break;
+case 184:
+#line 898 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11346 "parser.tab.c"
+  if (!yytrial)
+#line 898 "/root/repo/src/parser.y"
+{ yyval.cppEnum = yyvsp[-1].cppEnum; }
+#line 11350 "parser.tab.c"
+break;
+case 185:
+#line 901 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11355 "parser.tab.c"
+  if (!yytrial)
+#line 901 "/root/repo/src/parser.y"
+{
+                    yyval.cppEnum = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-3].str, nullptr, false, yyvsp[-1].str);
+                  }
+#line 11361 "parser.tab.c"
+break;
+case 186:
+#line 904 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11366 "parser.tab.c"
+  if (!yytrial)
+#line 904 "/root/repo/src/parser.y"
+{
+                    yyval.cppEnum = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-3].str, nullptr, true, yyvsp[-1].str);
+                  }
+#line 11372 "parser.tab.c"
+break;
+case 187:
+#line 907 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11377 "parser.tab.c"
+  if (!yytrial)
+#line 907 "/root/repo/src/parser.y"
+{
+                    yyval.cppEnum = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-1].str, nullptr, true);
+                  }
+#line 11383 "parser.tab.c"
+break;
+case 188:
+#line 912 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11388 "parser.tab.c"
+  if (!yytrial)
+#line 912 "/root/repo/src/parser.y"
+{
+                    yyvsp[-1].cppFuncPointerObj->addAttr(kTypedef);
+                    yyval.cppFuncPointerObj = yyvsp[-1].cppFuncPointerObj;
+                  }
+#line 11395 "parser.tab.c"
+break;
+case 189:
+#line 917 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11400 "parser.tab.c"
+  if (!yytrial)
+#line 917 "/root/repo/src/parser.y"
+{ yyval.typedefName = yyvsp[-1].typedefName; }
+#line 11404 "parser.tab.c"
+break;
+case 190:
+#line 920 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11409 "parser.tab.c"
+  if (!yytrial)
+#line 920 "/root/repo/src/parser.y"
+{ yyval.typedefList = yyvsp[-1].typedefList; }
+#line 11413 "parser.tab.c"
+break;
+case 191:
+#line 923 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11418 "parser.tab.c"
+  if (!yytrial)
+#line 923 "/root/repo/src/parser.y"
+{ yyval.typedefList = newObj<CppTypedefList>(yyparam->objFactory, yyvsp[0].cppVarObjList); }
+#line 11422 "parser.tab.c"
+break;
+case 192:
+#line 926 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11427 "parser.tab.c"
+  if (!yytrial)
+#line 926 "/root/repo/src/parser.y"
+{ yyval.typedefName = newObj<CppTypedefName>(yyparam->objFactory, yyvsp[0].cppVarObj); }
+#line 11431 "parser.tab.c"
+break;
+case 193:
+#line 929 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11436 "parser.tab.c"
+  if (!yytrial)
+#line 929 "/root/repo/src/parser.y"
+{
+                    yyval.usingDecl = newObj<CppUsingDecl>(yyparam->objFactory, yyvsp[-3].str, yyvsp[-1].cppVarType);
+                  }
+#line 11442 "parser.tab.c"
+break;
+case 194:
+#line 932 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11447 "parser.tab.c"
+  if (!yytrial)
+#line 932 "/root/repo/src/parser.y"
+{
+                    yyval.usingDecl = newObj<CppUsingDecl>(yyparam->objFactory, yyvsp[-3].str, yyvsp[-1].cppFuncPointerObj);
+                  }
+#line 11453 "parser.tab.c"
+break;
+case 195:
+#line 935 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11458 "parser.tab.c"
+  if (!yytrial)
+#line 935 "/root/repo/src/parser.y"
+{
+                    yyval.usingDecl = newObj<CppUsingDecl>(yyparam->objFactory, yyvsp[-3].str, yyvsp[-1].cppFuncPointerObj);
+                  }
+#line 11464 "parser.tab.c"
+break;
+case 196:
+#line 938 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11469 "parser.tab.c"
+  if (!yytrial)
+#line 938 "/root/repo/src/parser.y"
+{
+                    yyval.usingDecl = newObj<CppUsingDecl>(yyparam->objFactory, yyvsp[-3].str, yyvsp[-1].cppCompundObj);
+                  }
+#line 11475 "parser.tab.c"
+break;
+case 197:
+#line 941 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11480 "parser.tab.c"
+  if (!yytrial)
+#line 941 "/root/repo/src/parser.y"
+{
+                    yyval.usingDecl = yyvsp[0].usingDecl;
+                    yyval.usingDecl->templateParamList(yyvsp[-1].templateParamList);
+                  }
+#line 11487 "parser.tab.c"
+break;
+case 198:
+#line 945 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11492 "parser.tab.c"
+  if (!yytrial)
+#line 945 "/root/repo/src/parser.y"
+{
+                    yyval.usingDecl = newObj<CppUsingDecl>(yyparam->objFactory, yyvsp[-1].str, yyparam->curAccessType);
+                  }
+#line 11498 "parser.tab.c"
+break;
+case 199:
+#line 951 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11503 "parser.tab.c"
+  if (!yytrial)
+#line 951 "/root/repo/src/parser.y"
+{
+                    yyval.namespaceAlias = newObj<CppNamespaceAlias>(yyparam->objFactory, yyvsp[-3].str, yyvsp[-1].str);
+                  }
+#line 11509 "parser.tab.c"
+break;
+case 200:
+#line 956 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11514 "parser.tab.c"
+  if (!yytrial)
+#line 956 "/root/repo/src/parser.y"
+{
+                    yyval.usingNamespaceDecl = newObj<CppUsingNamespaceDecl>(yyparam->objFactory, yyvsp[-1].str);
+                  }
+#line 11520 "parser.tab.c"
+break;
+case 201:
+#line 961 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11525 "parser.tab.c"
+  if (!yytrial)
+#line 961 "/root/repo/src/parser.y"
+{ yyval.cppVarObjList = yyvsp[-1].cppVarObjList; }
+#line 11529 "parser.tab.c"
+break;
+case 202:
+#line 962 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11534 "parser.tab.c"
+  if (!yytrial)
+#line 962 "/root/repo/src/parser.y"
+{ yyval.cppVarObjList = yyvsp[-1].cppVarObjList; }
+#line 11538 "parser.tab.c"
+break;
+case 203:
+#line 965 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11543 "parser.tab.c"
+  if (!yytrial)
+#line 965 "/root/repo/src/parser.y"
+{ yyval.cppVarObj = yyvsp[-1].cppVarObj; }
+#line 11547 "parser.tab.c"
+break;
+case 204:
+#line 966 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11552 "parser.tab.c"
+  if (!yytrial)
+#line 966 "/root/repo/src/parser.y"
+{ yyval.cppVarObj = yyvsp[-1].cppVarObj; }
+#line 11556 "parser.tab.c"
+break;
+case 205:
+#line 967 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11561 "parser.tab.c"
+  if (!yytrial)
+#line 967 "/root/repo/src/parser.y"
+{ yyval.cppVarObj = yyvsp[0].cppVarObj; yyval.cppVarObj->apidecor(yyvsp[-1].str); }
+#line 11565 "parser.tab.c"
+break;
+case 206:
+#line 968 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11570 "parser.tab.c"
+  if (!yytrial)
+#line 968 "/root/repo/src/parser.y"
+{ yyval.cppVarObj = yyvsp[0].cppVarObj; yyval.cppVarObj->addAttr(yyvsp[-1].attr); }
+#line 11574 "parser.tab.c"
+break;
+case 207:
+#line 969 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 11579 "parser.tab.c"
+  if (!yytrial)
+#line 969 "/root/repo/src/parser.y"
+{ yyval.cppVarObj = yyvsp[0].cppVarObj; yyval.cppVarObj->addAttr(yyvsp[-1].attr); }
+#line 11583 "parser.tab.c"
+break;
+case 208:
+#line 972 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11588 "parser.tab.c"
+  if (!yytrial)
+#line 972 "/root/repo/src/parser.y"
+{
+                    yyvsp[-4].cppVarObj->addAttr(yyvsp[-5].attr);
+                    yyval.cppVarObjList = newObj<CppVarList>(yyparam->objFactory, yyvsp[-4].cppVarObj, CppVarDeclInList(yyvsp[-2].typeModifier, CppVarDecl{yyvsp[-1].str, yyvsp[0].cppVarAssign.assignValue_, yyvsp[0].cppVarAssign.assignType_}));
+                  }
+#line 11595 "parser.tab.c"
+break;
+case 209:
+#line 976 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11600 "parser.tab.c"
+  if (!yytrial)
+#line 976 "/root/repo/src/parser.y"
+{
+                    yyvsp[-4].cppVarObj->addAttr(yyvsp[-5].attr);
+                    yyval.cppVarObjList = newObj<CppVarList>(yyparam->objFactory, yyvsp[-4].cppVarObj, CppVarDeclInList(yyvsp[-2].typeModifier, CppVarDecl{yyvsp[-1].str, yyvsp[0].cppVarAssign.assignValue_, yyvsp[0].cppVarAssign.assignType_}));
+                  }
+#line 11607 "parser.tab.c"
+break;
+case 210:
+#line 980 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11612 "parser.tab.c"
+  if (!yytrial)
+#line 980 "/root/repo/src/parser.y"
+{
+                    yyvsp[-6].cppVarObj->addAttr(yyvsp[-7].attr);
+                    CppVarDecl var2(yyvsp[-3].str);
+                    var2.addArraySize(yyvsp[-1].cppExprObj);
+                    yyval.cppVarObjList = newObj<CppVarList>(yyparam->objFactory, yyvsp[-6].cppVarObj, CppVarDeclInList(yyvsp[-4].typeModifier, std::move(var2)));
+                    /* TODO: Use optvarassign as well */
+                  }
+#line 11622 "parser.tab.c"
+break;
+case 211:
+#line 987 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11627 "parser.tab.c"
+  if (!yytrial)
+#line 987 "/root/repo/src/parser.y"
+{
+                    yyvsp[-5].cppVarObj->addAttr(yyvsp[-6].attr);
+                    yyval.cppVarObjList = newObj<CppVarList>(yyparam->objFactory, yyvsp[-5].cppVarObj, CppVarDeclInList(yyvsp[-3].typeModifier, CppVarDecl{yyvsp[-2].str}));
+                    delete yyvsp[0].cppExprObj;
+                    /* TODO: Use optvarassign as well */
+                  }
+#line 11636 "parser.tab.c"
+break;
+case 212:
+#line 993 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11641 "parser.tab.c"
+  if (!yytrial)
+#line 993 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObjList = yyvsp[-4].cppVarObjList;
+                    yyval.cppVarObjList->addVarDecl(CppVarDeclInList(yyvsp[-2].typeModifier, CppVarDecl{yyvsp[-1].str, yyvsp[0].cppVarAssign.assignValue_, yyvsp[0].cppVarAssign.assignType_}));
+                  }
+#line 11648 "parser.tab.c"
+break;
+case 213:
+#line 997 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11653 "parser.tab.c"
+  if (!yytrial)
+#line 997 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObjList = yyvsp[-6].cppVarObjList;
+                    yyval.cppVarObjList->addVarDecl(CppVarDeclInList(yyvsp[-4].typeModifier, CppVarDecl{yyvsp[-3].str}));
+                    delete yyvsp[-2].cppVarAssign.assignValue_;
+                    delete yyvsp[0].cppExprObj;
+                    /* TODO: Use optvarassign as well */
+                  }
+#line 11663 "parser.tab.c"
+break;
+case 214:
+#line 1006 "/root/repo/src/parser.y"
+{yyparam->paramModPos = yyvsp[-1].str.sz; ZZERROR;}
+#line 11668 "parser.tab.c"
+  if (!yytrial)
+#line 1006 "/root/repo/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 11672 "parser.tab.c"
+break;
+case 215:
+#line 1007 "/root/repo/src/parser.y"
+{yyparam->paramModPos = yyvsp[-2].str.sz; ZZERROR;}
+#line 11677 "parser.tab.c"
+  if (!yytrial)
+#line 1007 "/root/repo/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 11681 "parser.tab.c"
+break;
+case 216:
+#line 1008 "/root/repo/src/parser.y"
+{yyparam->paramModPos = yyvsp[-2].str.sz; ZZERROR;}
+#line 11686 "parser.tab.c"
+  if (!yytrial)
+#line 1008 "/root/repo/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 11690 "parser.tab.c"
+break;
+case 217:
+#line 1009 "/root/repo/src/parser.y"
+{yyparam->paramModPos = yyvsp[-1].str.sz; ZZERROR;}
+#line 11695 "parser.tab.c"
+  if (!yytrial)
+#line 1009 "/root/repo/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 11699 "parser.tab.c"
+break;
+case 218:
+#line 1010 "/root/repo/src/parser.y"
+{yyparam->paramModPos = yyvsp[-1].str.sz; ZZERROR;}
+#line 11704 "parser.tab.c"
+  if (!yytrial)
+#line 1010 "/root/repo/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 11708 "parser.tab.c"
+break;
+case 219:
+#line 1011 "/root/repo/src/parser.y"
+{yyparam->paramModPos = yyvsp[-1].str.sz; ZZERROR;}
+#line 11713 "parser.tab.c"
+  if (!yytrial)
+#line 1011 "/root/repo/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 11717 "parser.tab.c"
+break;
+case 220:
+#line 1012 "/root/repo/src/parser.y"
+{ZZERROR;}
+#line 11722 "parser.tab.c"
+  if (!yytrial)
+#line 1012 "/root/repo/src/parser.y"
+{ /*FuncDeclHack*/ yyval.cppVarObj = nullptr; }
+#line 11726 "parser.tab.c"
+break;
+case 221:
+#line 1013 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11731 "parser.tab.c"
+  if (!yytrial)
+#line 1013 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObj = yyvsp[-1].cppVarObj;
+                    yyval.cppVarObj->assign(yyvsp[0].cppVarAssign.assignValue_, yyvsp[0].cppVarAssign.assignType_);
+                  }
+#line 11738 "parser.tab.c"
+break;
+case 222:
+#line 1017 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11743 "parser.tab.c"
+  if (!yytrial)
+#line 1017 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObj = yyvsp[0].cppVarObj;
+                    yyval.cppVarObj->addAttr(kConstExpr);
+                  }
+#line 11750 "parser.tab.c"
+break;
+case 223:
+#line 1023 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11755 "parser.tab.c"
+  if (!yytrial)
+#line 1023 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarAssign = CppVarAssign{yyvsp[0].cppExprObj, AssignType::kUsingEqual};
+                  }
+#line 11761 "parser.tab.c"
+break;
+case 224:
+#line 1026 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11766 "parser.tab.c"
+  if (!yytrial)
+#line 1026 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarAssign = CppVarAssign{yyvsp[-1].cppExprObj, AssignType::kUsingBracket};
+                  }
+#line 11772 "parser.tab.c"
+break;
+case 225:
+#line 1029 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11777 "parser.tab.c"
+  if (!yytrial)
+#line 1029 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarAssign = CppVarAssign{yyvsp[-1].cppExprObj, AssignType::kUsingBraces};
+                  }
+#line 11783 "parser.tab.c"
+break;
+case 226:
+#line 1034 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11788 "parser.tab.c"
+  if (!yytrial)
+#line 1034 "/root/repo/src/parser.y"
+{ yyval.cppVarAssign = CppVarAssign{nullptr, AssignType::kNone}; }
+#line 11792 "parser.tab.c"
+break;
+case 227:
+#line 1035 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11797 "parser.tab.c"
+  if (!yytrial)
+#line 1035 "/root/repo/src/parser.y"
+{ yyval.cppVarAssign = yyvsp[0].cppVarAssign; }
+#line 11801 "parser.tab.c"
+break;
+case 228:
+#line 1038 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11806 "parser.tab.c"
+  if (!yytrial)
+#line 1038 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObj = newObj<CppVar>(yyparam->objFactory, yyvsp[-1].cppVarType, yyvsp[0].str.toString());
+                  }
+#line 11812 "parser.tab.c"
+break;
+case 229:
+#line 1041 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11817 "parser.tab.c"
+  if (!yytrial)
+#line 1041 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObj = newObj<CppVar>(yyparam->objFactory, yyvsp[-2].cppVarType, yyvsp[0].str.toString());
+                    yyval.cppVarObj->apidecor(yyvsp[-1].str);
+                  }
+#line 11824 "parser.tab.c"
+break;
+case 230:
+#line 1045 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11829 "parser.tab.c"
+  if (!yytrial)
+#line 1045 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObj = newObj<CppVar>(yyparam->objFactory, yyparam->curAccessType, yyvsp[0].cppFuncPointerObj, CppTypeModifier());
+                  }
+#line 11835 "parser.tab.c"
+break;
+case 231:
+#line 1048 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11840 "parser.tab.c"
+  if (!yytrial)
+#line 1048 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObj = yyvsp[-3].cppVarObj;
+                    yyval.cppVarObj->addArraySize(yyvsp[-1].cppExprObj);
+                  }
+#line 11847 "parser.tab.c"
+break;
+case 232:
+#line 1052 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11852 "parser.tab.c"
+  if (!yytrial)
+#line 1052 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObj = yyvsp[-2].cppVarObj;
+                    yyval.cppVarObj->addArraySize(nullptr);
+                  }
+#line 11859 "parser.tab.c"
+break;
+case 233:
+#line 1056 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11864 "parser.tab.c"
+  if (!yytrial)
+#line 1056 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObj = yyvsp[-2].cppVarObj;
+                    yyval.cppVarObj->bitField(yyvsp[0].cppExprObj);
+                  }
+#line 11871 "parser.tab.c"
+break;
+case 234:
+#line 1060 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11876 "parser.tab.c"
+  if (!yytrial)
+#line 1060 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObj = yyvsp[0].cppVarObj;
+                    yyval.cppVarObj->templateParamList(yyvsp[-1].templateParamList);
+                  }
+#line 11883 "parser.tab.c"
+break;
+case 235:
+#line 1064 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11888 "parser.tab.c"
+  if (!yytrial)
+#line 1064 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarObj = yyvsp[0].cppVarObj;
+                    yyval.cppVarObj->addAttr(yyvsp[-1].attr);
+                  }
+#line 11895 "parser.tab.c"
+break;
+case 236:
+#line 1070 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11900 "parser.tab.c"
+  if (!yytrial)
+#line 1070 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-1].str, yyvsp[0].typeModifier);
+                    yyval.cppVarType->attribSpecifierSequence(yyvsp[-2].attribSpecifiers);
+                  }
+#line 11907 "parser.tab.c"
+break;
+case 237:
+#line 1074 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11912 "parser.tab.c"
+  if (!yytrial)
+#line 1074 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-1].str, yyvsp[0].typeModifier);
+                  }
+#line 11918 "parser.tab.c"
+break;
+case 238:
+#line 1077 "/root/repo/src/parser.y"
+{
+                    if (yyparam->templateParamStart == yyvsp[-2].str.sz)
+                      ZZERROR;
+                    else
+                      ZZLOG;
+                  }
+#line 11928 "parser.tab.c"
+  if (!yytrial)
+#line 1082 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, mergeCppToken(yyvsp[-2].str, yyvsp[-1].str), yyvsp[0].typeModifier);
+                  }
+#line 11934 "parser.tab.c"
+break;
+case 239:
+#line 1085 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11939 "parser.tab.c"
+  if (!yytrial)
+#line 1085 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, mergeCppToken(yyvsp[-3].str, yyvsp[-1].str), yyvsp[0].typeModifier);
+                  }
+#line 11945 "parser.tab.c"
+break;
+case 240:
+#line 1088 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11950 "parser.tab.c"
+  if (!yytrial)
+#line 1088 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, mergeCppToken(yyvsp[-3].str, yyvsp[-1].str), yyvsp[0].typeModifier);
+                  }
+#line 11956 "parser.tab.c"
+break;
+case 241:
+#line 1091 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11961 "parser.tab.c"
+  if (!yytrial)
+#line 1091 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, mergeCppToken(yyvsp[-2].str, yyvsp[-1].str), yyvsp[0].typeModifier);
+                  }
+#line 11967 "parser.tab.c"
+break;
+case 242:
+#line 1094 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11972 "parser.tab.c"
+  if (!yytrial)
+#line 1094 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, yyvsp[0].cppFuncPointerObj, CppTypeModifier());
+                  }
+#line 11978 "parser.tab.c"
+break;
+case 243:
+#line 1097 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11983 "parser.tab.c"
+  if (!yytrial)
+#line 1097 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, yyvsp[0].cppCompundObj, CppTypeModifier());
+                  }
+#line 11989 "parser.tab.c"
+break;
+case 244:
+#line 1100 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 11994 "parser.tab.c"
+  if (!yytrial)
+#line 1100 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-1].cppCompundObj, yyvsp[0].typeModifier);
+                  }
+#line 12000 "parser.tab.c"
+break;
+case 245:
+#line 1103 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12005 "parser.tab.c"
+  if (!yytrial)
+#line 1103 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, yyvsp[0].cppEnum, CppTypeModifier());
+                  }
+#line 12011 "parser.tab.c"
+break;
+case 246:
+#line 1106 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12016 "parser.tab.c"
+  if (!yytrial)
+#line 1106 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-1].cppEnum, yyvsp[0].typeModifier);
+                  }
+#line 12022 "parser.tab.c"
+break;
+case 247:
+#line 1109 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12027 "parser.tab.c"
+  if (!yytrial)
+#line 1109 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = yyvsp[0].cppVarType;
+                    yyval.cppVarType->addAttr(yyvsp[-1].attr);
+                  }
+#line 12034 "parser.tab.c"
+break;
+case 248:
+#line 1113 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12039 "parser.tab.c"
+  if (!yytrial)
+#line 1113 "/root/repo/src/parser.y"
+{
+                    yyval.cppVarType = yyvsp[-1].cppVarType;
+                    yyval.cppVarType->paramPack_ = true;
+                  }
+#line 12046 "parser.tab.c"
+break;
+case 249:
+#line 1117 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12051 "parser.tab.c"
+  if (!yytrial)
+#line 1117 "/root/repo/src/parser.y"
+{
+                    /* reference to member declrations. E.g.:*/
+                    /* int GrCCStrokeGeometry::InstanceTallies::* InstanceType*/
+                    yyval.cppVarType = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, mergeCppToken(yyvsp[-3].str, yyvsp[-1].str), yyvsp[0].typeModifier);
+                  }
+#line 12059 "parser.tab.c"
+break;
+case 250:
+#line 1124 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12064 "parser.tab.c"
+  if (!yytrial)
+#line 1124 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12068 "parser.tab.c"
+break;
+case 251:
+#line 1125 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12073 "parser.tab.c"
+  if (!yytrial)
+#line 1125 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; /* final is not a reserved keyword */ }
+#line 12077 "parser.tab.c"
+break;
+case 252:
+#line 1126 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12082 "parser.tab.c"
+  if (!yytrial)
+#line 1126 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 12086 "parser.tab.c"
+break;
+case 253:
+#line 1127 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12091 "parser.tab.c"
+  if (!yytrial)
+#line 1127 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 12095 "parser.tab.c"
+break;
+case 254:
+#line 1128 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12100 "parser.tab.c"
+  if (!yytrial)
+#line 1128 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-4].str, yyvsp[0].str); }
+#line 12104 "parser.tab.c"
+break;
+case 255:
+#line 1131 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12109 "parser.tab.c"
+  if (!yytrial)
+#line 1131 "/root/repo/src/parser.y"
+{ yyval.typeModifier = CppTypeModifier(); }
+#line 12113 "parser.tab.c"
+break;
+case 256:
+  if (!yytrial)
+#line 1132 "/root/repo/src/parser.y"
+{ yyval.typeModifier = yyvsp[0].typeModifier; }
+#line 12119 "parser.tab.c"
+break;
+case 257:
+  if (!yytrial)
+#line 1133 "/root/repo/src/parser.y"
+{ yyval.typeModifier = yyvsp[0].typeModifier; delete yyvsp[-1].docCommentObj; }
+#line 12125 "parser.tab.c"
+break;
+case 258:
+#line 1136 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12130 "parser.tab.c"
+  if (!yytrial)
+#line 1136 "/root/repo/src/parser.y"
+{
+                    yyval.typeModifier = CppTypeModifier();
+                    yyval.typeModifier.constBits_ |= (1 << yyval.typeModifier.ptrLevel_);
+                  }
+#line 12137 "parser.tab.c"
+break;
+case 259:
+#line 1140 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12142 "parser.tab.c"
+  if (!yytrial)
+#line 1140 "/root/repo/src/parser.y"
+{
+                    yyval.typeModifier = CppTypeModifier();
+                    yyval.typeModifier.ptrLevel_++;
+                  }
+#line 12149 "parser.tab.c"
+break;
+case 260:
+#line 1144 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12154 "parser.tab.c"
+  if (!yytrial)
+#line 1144 "/root/repo/src/parser.y"
+{
+                    yyval.typeModifier = CppTypeModifier();
+                    yyval.typeModifier.refType_ = CppRefType::kByRef;
+                  }
+#line 12161 "parser.tab.c"
+break;
+case 261:
+#line 1148 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12166 "parser.tab.c"
+  if (!yytrial)
+#line 1148 "/root/repo/src/parser.y"
+{
+                    yyval.typeModifier = CppTypeModifier();
+                    yyval.typeModifier.refType_ = CppRefType::kRValRef;
+                  }
+#line 12173 "parser.tab.c"
+break;
+case 262:
+#line 1152 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12178 "parser.tab.c"
+  if (!yytrial)
+#line 1152 "/root/repo/src/parser.y"
+{
+                    yyval.typeModifier = yyvsp[-1].typeModifier;
+                    yyval.typeModifier.constBits_ |= (1 << yyval.typeModifier.ptrLevel_);
+                  }
+#line 12185 "parser.tab.c"
+break;
+case 263:
+#line 1156 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12190 "parser.tab.c"
+  if (!yytrial)
+#line 1156 "/root/repo/src/parser.y"
+{
+                    yyval.typeModifier = yyvsp[-1].typeModifier;
+                    yyval.typeModifier.ptrLevel_++;
+                  }
+#line 12197 "parser.tab.c"
+break;
+case 264:
+#line 1160 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12202 "parser.tab.c"
+  if (!yytrial)
+#line 1160 "/root/repo/src/parser.y"
+{
+                    yyval.typeModifier = yyvsp[-1].typeModifier;
+                    yyval.typeModifier.refType_ = CppRefType::kByRef;
+                  }
+#line 12209 "parser.tab.c"
+break;
+case 265:
+#line 1164 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12214 "parser.tab.c"
+  if (!yytrial)
+#line 1164 "/root/repo/src/parser.y"
+{
+                    yyval.typeModifier = yyvsp[-1].typeModifier;
+                    yyval.typeModifier.refType_ = CppRefType::kRValRef;
+                  }
+#line 12221 "parser.tab.c"
+break;
+case 266:
+#line 1171 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12226 "parser.tab.c"
+  if (!yytrial)
+#line 1171 "/root/repo/src/parser.y"
+{ yyval.attr = kStatic;  }
+#line 12230 "parser.tab.c"
+break;
+case 267:
+#line 1172 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12235 "parser.tab.c"
+  if (!yytrial)
+#line 1172 "/root/repo/src/parser.y"
+{ yyval.attr = kExtern;  }
+#line 12239 "parser.tab.c"
+break;
+case 268:
+#line 1173 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12244 "parser.tab.c"
+  if (!yytrial)
+#line 1173 "/root/repo/src/parser.y"
+{ yyval.attr = kExternC; }
+#line 12248 "parser.tab.c"
+break;
+case 269:
+#line 1176 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12253 "parser.tab.c"
+  if (!yytrial)
+#line 1176 "/root/repo/src/parser.y"
+{ yyval.attr = kConst;      }
+#line 12257 "parser.tab.c"
+break;
+case 270:
+#line 1177 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12262 "parser.tab.c"
+  if (!yytrial)
+#line 1177 "/root/repo/src/parser.y"
+{ yyval.attr = kVolatile;   }
+#line 12266 "parser.tab.c"
+break;
+case 271:
+#line 1178 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12271 "parser.tab.c"
+  if (!yytrial)
+#line 1178 "/root/repo/src/parser.y"
+{ yyval.attr = kMutable;    }
+#line 12275 "parser.tab.c"
+break;
+case 272:
+#line 1179 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12280 "parser.tab.c"
+  if (!yytrial)
+#line 1179 "/root/repo/src/parser.y"
+{ yyval.attr = kConstExpr;  }
+#line 12284 "parser.tab.c"
+break;
+case 273:
+#line 1182 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12289 "parser.tab.c"
+  if (!yytrial)
+#line 1182 "/root/repo/src/parser.y"
+{
+                    yyval.cppTypeConverter = newTypeConverter(yyparam->objFactory, yyvsp[-3].cppVarType, makeCppToken(yyvsp[-4].str.sz, yyvsp[-2].str.sz));
+                  }
+#line 12295 "parser.tab.c"
+break;
+case 274:
+#line 1185 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12300 "parser.tab.c"
+  if (!yytrial)
+#line 1185 "/root/repo/src/parser.y"
+{
+                    yyval.cppTypeConverter = newTypeConverter(yyparam->objFactory, yyvsp[-3].cppVarType, makeCppToken(yyvsp[-6].str.sz, yyvsp[-2].str.sz));
+                  }
+#line 12306 "parser.tab.c"
+break;
+case 275:
+#line 1188 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12311 "parser.tab.c"
+  if (!yytrial)
+#line 1188 "/root/repo/src/parser.y"
+{
+                    yyval.cppTypeConverter = yyvsp[0].cppTypeConverter;
+                    yyval.cppTypeConverter->addAttr(yyvsp[-1].attr);
+                  }
+#line 12318 "parser.tab.c"
+break;
+case 276:
+#line 1192 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12323 "parser.tab.c"
+  if (!yytrial)
+#line 1192 "/root/repo/src/parser.y"
+{
+                    yyval.cppTypeConverter = yyvsp[-1].cppTypeConverter;
+                    yyval.cppTypeConverter->addAttr(kConst);
+                  }
+#line 12330 "parser.tab.c"
+break;
+case 277:
+#line 1196 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12335 "parser.tab.c"
+  if (!yytrial)
+#line 1196 "/root/repo/src/parser.y"
+{
+                    yyval.cppTypeConverter = yyvsp[0].cppTypeConverter;
+                    yyval.cppTypeConverter->decor1(yyvsp[-1].str);
+                  }
+#line 12342 "parser.tab.c"
+break;
+case 278:
+#line 1200 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12347 "parser.tab.c"
+  if (!yytrial)
+#line 1200 "/root/repo/src/parser.y"
+{
+                    yyval.cppTypeConverter = yyvsp[0].cppTypeConverter;
+                    yyval.cppTypeConverter->templateParamList(yyvsp[-1].templateParamList);
+                  }
+#line 12354 "parser.tab.c"
+break;
+case 279:
+#line 1206 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12359 "parser.tab.c"
+  if (!yytrial)
+#line 1206 "/root/repo/src/parser.y"
+{
+                    yyval.cppTypeConverter = yyvsp[-1].cppTypeConverter;
+                  }
+#line 12365 "parser.tab.c"
+break;
+case 280:
+#line 1209 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12370 "parser.tab.c"
+  if (!yytrial)
+#line 1209 "/root/repo/src/parser.y"
+{
+                    yyval.cppTypeConverter = yyvsp[-1].cppTypeConverter;
+                    yyval.cppTypeConverter->defn(yyvsp[0].cppCompundObj);
+                  }
+#line 12377 "parser.tab.c"
+break;
+case 281:
+#line 1215 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12382 "parser.tab.c"
+  if (!yytrial)
+#line 1215 "/root/repo/src/parser.y"
+{ yyval.cppFuncObj = yyvsp[-1].cppFuncObj; }
+#line 12386 "parser.tab.c"
+break;
+case 282:
+#line 1218 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12391 "parser.tab.c"
+  if (!yytrial)
+#line 1218 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = yyvsp[-1].cppFuncObj;
+                    yyval.cppFuncObj->defn(yyvsp[0].cppCompundObj ? yyvsp[0].cppCompundObj : newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock));
+                  }
+#line 12398 "parser.tab.c"
+break;
+case 283:
+  if (!yytrial)
+#line 1224 "/root/repo/src/parser.y"
+{
+                    yyval.cppLambda = newObj<CppLambda>(yyparam->objFactory, yyvsp[-3].cppExprObj, yyvsp[-1].paramList, yyvsp[0].cppCompundObj);
+                  }
+#line 12406 "parser.tab.c"
+break;
+case 284:
+  if (!yytrial)
+#line 1227 "/root/repo/src/parser.y"
+{
+                    yyval.cppLambda = newObj<CppLambda>(yyparam->objFactory, yyvsp[-5].cppExprObj, yyvsp[-3].paramList, yyvsp[0].cppCompundObj, yyvsp[-1].cppVarType);
+                  }
+#line 12414 "parser.tab.c"
+break;
+case 285:
+#line 1232 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12419 "parser.tab.c"
+  if (!yytrial)
+#line 1232 "/root/repo/src/parser.y"
+{ yyval.paramList = nullptr; }
+#line 12423 "parser.tab.c"
+break;
+case 286:
+#line 1233 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12428 "parser.tab.c"
+  if (!yytrial)
+#line 1233 "/root/repo/src/parser.y"
+{ yyval.paramList = yyvsp[-1].paramList; }
+#line 12432 "parser.tab.c"
+break;
+case 287:
+#line 1236 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12437 "parser.tab.c"
+  if (!yytrial)
+#line 1236 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncPointerObj = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-4].str, yyvsp[-10].cppVarType, yyvsp[-1].paramList, yyvsp[-11].attr, mergeCppToken(yyvsp[-7].str, yyvsp[-6].str));
+                    yyval.cppFuncPointerObj->decor2(yyvsp[-8].str);
+                  }
+#line 12444 "parser.tab.c"
+break;
+case 288:
+#line 1240 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12449 "parser.tab.c"
+  if (!yytrial)
+#line 1240 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncPointerObj = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-4].str, yyvsp[-10].cppVarType, yyvsp[-1].paramList, 0, mergeCppToken(yyvsp[-7].str, yyvsp[-6].str));
+                    yyval.cppFuncPointerObj->decor2(yyvsp[-8].str);
+                  }
+#line 12456 "parser.tab.c"
+break;
+case 289:
+#line 1244 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12461 "parser.tab.c"
+  if (!yytrial)
+#line 1244 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncPointerObj = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-4].str, yyvsp[-8].cppVarType, yyvsp[-1].paramList, yyvsp[-9].attr);
+                    yyval.cppFuncPointerObj->decor2(yyvsp[-6].str);
+                  }
+#line 12468 "parser.tab.c"
+break;
+case 290:
+#line 1248 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12473 "parser.tab.c"
+  if (!yytrial)
+#line 1248 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncPointerObj = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-4].str, yyvsp[-8].cppVarType, yyvsp[-1].paramList, 0);
+                    yyval.cppFuncPointerObj->decor2(yyvsp[-6].str);
+                  }
+#line 12480 "parser.tab.c"
+break;
+case 291:
+#line 1252 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12485 "parser.tab.c"
+  if (!yytrial)
+#line 1252 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncPointerObj = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-4].str, yyvsp[-8].cppVarType, yyvsp[-1].paramList, 0);
+                    yyval.cppFuncPointerObj->decor2(yyvsp[-5].str);
+                  }
+#line 12492 "parser.tab.c"
+break;
+case 292:
+#line 1256 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12497 "parser.tab.c"
+  if (!yytrial)
+#line 1256 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncPointerObj = yyvsp[0].cppFuncPointerObj;
+                    yyval.cppFuncPointerObj->decor1(yyvsp[-1].str);
+                  }
+#line 12504 "parser.tab.c"
+break;
+case 293:
+#line 1260 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12509 "parser.tab.c"
+  if (!yytrial)
+#line 1260 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncPointerObj = yyvsp[-1].cppFuncPointerObj;
+                    yyval.cppFuncPointerObj->addAttr(yyvsp[0].attr);
+                  }
+#line 12516 "parser.tab.c"
+break;
+case 294:
+#line 1267 "/root/repo/src/parser.y"
+{
+                      if (yyvsp[0].cppFuncPointerObj->name_.empty() == true) {
+                        ZZERROR;
+                      }
+                    }
+#line 12525 "parser.tab.c"
+break;
+case 295:
+#line 1275 "/root/repo/src/parser.y"
+{
+                      if (yyvsp[0].cppFuncPointerObj->name_.empty() == false) {
+                        ZZERROR;
+                      }
+                    }
+#line 12534 "parser.tab.c"
+break;
+case 296:
+#line 1282 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12539 "parser.tab.c"
+  if (!yytrial)
+#line 1282 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncPointerObj = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, "", yyvsp[-4].cppVarType, yyvsp[-1].paramList, 0);
+                  }
+#line 12545 "parser.tab.c"
+break;
+case 297:
+#line 1287 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12550 "parser.tab.c"
+  if (!yytrial)
+#line 1287 "/root/repo/src/parser.y"
+{ yyval.cppFuncPointerObj = yyvsp[-1].cppFuncPointerObj;}
+#line 12554 "parser.tab.c"
+break;
+case 298:
+#line 1290 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12559 "parser.tab.c"
+  if (!yytrial)
+#line 1290 "/root/repo/src/parser.y"
+{
+                    yyval.funcDeclData = CppNtFuncDeclData{yyvsp[-3].str, yyvsp[-1].paramList, 0};
+                  }
+#line 12565 "parser.tab.c"
+break;
+case 299:
+#line 1293 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12570 "parser.tab.c"
+  if (!yytrial)
+#line 1293 "/root/repo/src/parser.y"
+{
+                    yyval.funcDeclData = CppNtFuncDeclData{yyvsp[-4].str, yyvsp[-2].paramList, yyvsp[0].attr};
+                  }
+#line 12576 "parser.tab.c"
+break;
+case 300:
+#line 1298 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12581 "parser.tab.c"
+  if (!yytrial)
+#line 1298 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = newFunction(yyparam->objFactory, yyparam->curAccessType, yyvsp[0].funcDeclData.funcName, yyvsp[-2].cppVarType, yyvsp[0].funcDeclData.paramList, yyvsp[0].funcDeclData.funcAttr);
+                    yyval.cppFuncObj->decor2(yyvsp[-1].str);
+                  }
+#line 12588 "parser.tab.c"
+break;
+case 301:
+#line 1302 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12593 "parser.tab.c"
+  if (!yytrial)
+#line 1302 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = newFunction(yyparam->objFactory, yyparam->curAccessType, yyvsp[0].funcDeclData.funcName, yyvsp[-1].cppVarType, yyvsp[0].funcDeclData.paramList, yyvsp[0].funcDeclData.funcAttr);
+                  }
+#line 12599 "parser.tab.c"
+break;
+case 302:
+#line 1305 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12604 "parser.tab.c"
+  if (!yytrial)
+#line 1305 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = newFunction(yyparam->objFactory, yyparam->curAccessType, yyvsp[0].funcDeclData.funcName, yyvsp[-2].cppVarType, yyvsp[0].funcDeclData.paramList, yyvsp[0].funcDeclData.funcAttr | kConstExpr);
+                  }
+#line 12610 "parser.tab.c"
+break;
+case 303:
+#line 1308 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12615 "parser.tab.c"
+  if (!yytrial)
+#line 1308 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = newFunction(yyparam->objFactory, yyparam->curAccessType, yyvsp[-2].funcDeclData.funcName, yyvsp[0].cppVarType, yyvsp[-2].funcDeclData.paramList, yyvsp[-2].funcDeclData.funcAttr | kTrailingRet);
+                  }
+#line 12621 "parser.tab.c"
+break;
+case 304:
+#line 1311 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 12626 "parser.tab.c"
+  if (!yytrial)
+#line 1311 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = newFunction(yyparam->objFactory, yyparam->curAccessType, yyvsp[-2].funcDeclData.funcName, yyvsp[0].cppVarType, yyvsp[-2].funcDeclData.paramList, yyvsp[-2].funcDeclData.funcAttr | kTrailingRet | kConstExpr);
+                  }
+#line 12632 "parser.tab.c"
+break;
+case 305:
+#line 1314 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12637 "parser.tab.c"
+  if (!yytrial)
+#line 1314 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = yyvsp[0].cppFuncObj;
+                    yyval.cppFuncObj->addAttr(kConstExpr);
+                  }
+#line 12644 "parser.tab.c"
+break;
+case 306:
+#line 1318 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12649 "parser.tab.c"
+  if (!yytrial)
+#line 1318 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = yyvsp[0].cppFuncObj;
+                    if (!yyval.cppFuncObj->decor1().empty())
+                      yyval.cppFuncObj->decor2(yyval.cppFuncObj->decor1());
+                    yyval.cppFuncObj->decor1(yyvsp[-1].str);
+                  }
+#line 12658 "parser.tab.c"
+break;
+case 307:
+#line 1324 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12663 "parser.tab.c"
+  if (!yytrial)
+#line 1324 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = yyvsp[0].cppFuncObj;
+                    yyval.cppFuncObj->templateParamList(yyvsp[-1].templateParamList);
+                  }
+#line 12670 "parser.tab.c"
+break;
+case 308:
+#line 1328 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12675 "parser.tab.c"
+  if (!yytrial)
+#line 1328 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = yyvsp[0].cppFuncObj;
+                    yyval.cppFuncObj->addAttr(yyvsp[-1].attr);
+                  }
+#line 12682 "parser.tab.c"
+break;
+case 309:
+#line 1332 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12687 "parser.tab.c"
+  if (!yytrial)
+#line 1332 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = yyvsp[-2].cppFuncObj;
+                    yyval.cppFuncObj->addAttr(kDelete);
+                  }
+#line 12694 "parser.tab.c"
+break;
+case 310:
+#line 1336 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12699 "parser.tab.c"
+  if (!yytrial)
+#line 1336 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = yyvsp[-2].cppFuncObj;
+                    yyval.cppFuncObj->addAttr(kDefault);
+                  }
+#line 12706 "parser.tab.c"
+break;
+case 311:
+#line 1340 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12711 "parser.tab.c"
+  if (!yytrial)
+#line 1340 "/root/repo/src/parser.y"
+{
+                    yyval.cppFuncObj = yyvsp[-1].cppFuncObj;
+                    yyval.cppFuncObj->throwSpec(yyvsp[0].funcThrowSpec);
+                  }
+#line 12718 "parser.tab.c"
+break;
+case 312:
+#line 1346 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12723 "parser.tab.c"
+  if (!yytrial)
+#line 1346 "/root/repo/src/parser.y"
+{
+                    delete yyvsp[-1].paramList;
+                    yyval.str = mergeCppToken(yyvsp[-4].str, yyvsp[0].str);
+                  }
+#line 12730 "parser.tab.c"
+break;
+case 313:
+#line 1352 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12735 "parser.tab.c"
+  if (!yytrial)
+#line 1352 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12739 "parser.tab.c"
+break;
+case 314:
+#line 1353 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12744 "parser.tab.c"
+  if (!yytrial)
+#line 1353 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12748 "parser.tab.c"
+break;
+case 315:
+#line 1354 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12753 "parser.tab.c"
+  if (!yytrial)
+#line 1354 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12757 "parser.tab.c"
+break;
+case 316:
+#line 1356 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12762 "parser.tab.c"
+  if (!yytrial)
+#line 1356 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 12766 "parser.tab.c"
+break;
+case 317:
+#line 1359 "/root/repo/src/parser.y"
+{ if (yyvsp[0].str.sz != (yyvsp[-1].str.sz + 1)) ZZERROR; }
+#line 12771 "parser.tab.c"
+  if (!yytrial)
+#line 1359 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12775 "parser.tab.c"
+break;
+case 318:
+#line 1362 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12780 "parser.tab.c"
+  if (!yytrial)
+#line 1362 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12784 "parser.tab.c"
+break;
+case 319:
+#line 1363 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12789 "parser.tab.c"
+  if (!yytrial)
+#line 1363 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12793 "parser.tab.c"
+break;
+case 320:
+#line 1364 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12798 "parser.tab.c"
+  if (!yytrial)
+#line 1364 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12802 "parser.tab.c"
+break;
+case 321:
+#line 1365 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12807 "parser.tab.c"
+  if (!yytrial)
+#line 1365 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12811 "parser.tab.c"
+break;
+case 322:
+#line 1366 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12816 "parser.tab.c"
+  if (!yytrial)
+#line 1366 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12820 "parser.tab.c"
+break;
+case 323:
+#line 1367 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12825 "parser.tab.c"
+  if (!yytrial)
+#line 1367 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12829 "parser.tab.c"
+break;
+case 324:
+#line 1368 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12834 "parser.tab.c"
+  if (!yytrial)
+#line 1368 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12838 "parser.tab.c"
+break;
+case 325:
+#line 1369 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12843 "parser.tab.c"
+  if (!yytrial)
+#line 1369 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12847 "parser.tab.c"
+break;
+case 326:
+#line 1370 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12852 "parser.tab.c"
+  if (!yytrial)
+#line 1370 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12856 "parser.tab.c"
+break;
+case 327:
+#line 1371 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12861 "parser.tab.c"
+  if (!yytrial)
+#line 1371 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12865 "parser.tab.c"
+break;
+case 328:
+#line 1372 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12870 "parser.tab.c"
+  if (!yytrial)
+#line 1372 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12874 "parser.tab.c"
+break;
+case 329:
+#line 1373 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12879 "parser.tab.c"
+  if (!yytrial)
+#line 1373 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12883 "parser.tab.c"
+break;
+case 330:
+#line 1374 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12888 "parser.tab.c"
+  if (!yytrial)
+#line 1374 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12892 "parser.tab.c"
+break;
+case 331:
+#line 1375 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12897 "parser.tab.c"
+  if (!yytrial)
+#line 1375 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12901 "parser.tab.c"
+break;
+case 332:
+#line 1376 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12906 "parser.tab.c"
+  if (!yytrial)
+#line 1376 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12910 "parser.tab.c"
+break;
+case 333:
+#line 1377 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12915 "parser.tab.c"
+  if (!yytrial)
+#line 1377 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12919 "parser.tab.c"
+break;
+case 334:
+#line 1378 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12924 "parser.tab.c"
+  if (!yytrial)
+#line 1378 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12928 "parser.tab.c"
+break;
+case 335:
+#line 1379 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12933 "parser.tab.c"
+  if (!yytrial)
+#line 1379 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12937 "parser.tab.c"
+break;
+case 336:
+#line 1380 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12942 "parser.tab.c"
+  if (!yytrial)
+#line 1380 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12946 "parser.tab.c"
+break;
+case 337:
+#line 1381 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12951 "parser.tab.c"
+  if (!yytrial)
+#line 1381 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12955 "parser.tab.c"
+break;
+case 338:
+#line 1382 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12960 "parser.tab.c"
+  if (!yytrial)
+#line 1382 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12964 "parser.tab.c"
+break;
+case 339:
+#line 1383 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12969 "parser.tab.c"
+  if (!yytrial)
+#line 1383 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12973 "parser.tab.c"
+break;
+case 340:
+#line 1384 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12978 "parser.tab.c"
+  if (!yytrial)
+#line 1384 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12982 "parser.tab.c"
+break;
+case 341:
+#line 1385 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12987 "parser.tab.c"
+  if (!yytrial)
+#line 1385 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 12991 "parser.tab.c"
+break;
+case 342:
+#line 1386 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 12996 "parser.tab.c"
+  if (!yytrial)
+#line 1386 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13000 "parser.tab.c"
+break;
+case 343:
+#line 1387 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13005 "parser.tab.c"
+  if (!yytrial)
+#line 1387 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13009 "parser.tab.c"
+break;
+case 344:
+#line 1388 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13014 "parser.tab.c"
+  if (!yytrial)
+#line 1388 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13018 "parser.tab.c"
+break;
+case 345:
+#line 1389 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13023 "parser.tab.c"
+  if (!yytrial)
+#line 1389 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13027 "parser.tab.c"
+break;
+case 346:
+#line 1390 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13032 "parser.tab.c"
+  if (!yytrial)
+#line 1390 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13036 "parser.tab.c"
+break;
+case 347:
+#line 1391 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13041 "parser.tab.c"
+  if (!yytrial)
+#line 1391 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13045 "parser.tab.c"
+break;
+case 348:
+#line 1392 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13050 "parser.tab.c"
+  if (!yytrial)
+#line 1392 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13054 "parser.tab.c"
+break;
+case 349:
+#line 1393 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13059 "parser.tab.c"
+  if (!yytrial)
+#line 1393 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13063 "parser.tab.c"
+break;
+case 350:
+#line 1394 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13068 "parser.tab.c"
+  if (!yytrial)
+#line 1394 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13072 "parser.tab.c"
+break;
+case 351:
+#line 1395 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13077 "parser.tab.c"
+  if (!yytrial)
+#line 1395 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13081 "parser.tab.c"
+break;
+case 352:
+#line 1396 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13086 "parser.tab.c"
+  if (!yytrial)
+#line 1396 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13090 "parser.tab.c"
+break;
+case 353:
+#line 1397 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13095 "parser.tab.c"
+  if (!yytrial)
+#line 1397 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13099 "parser.tab.c"
+break;
+case 354:
+#line 1398 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13104 "parser.tab.c"
+  if (!yytrial)
+#line 1398 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13108 "parser.tab.c"
+break;
+case 355:
+#line 1399 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13113 "parser.tab.c"
+  if (!yytrial)
+#line 1399 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 13117 "parser.tab.c"
+break;
+case 356:
+#line 1400 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13122 "parser.tab.c"
+  if (!yytrial)
+#line 1400 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 13126 "parser.tab.c"
+break;
+case 357:
+#line 1401 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13131 "parser.tab.c"
+  if (!yytrial)
+#line 1401 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13135 "parser.tab.c"
+break;
+case 358:
+#line 1402 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13140 "parser.tab.c"
+  if (!yytrial)
+#line 1402 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 13144 "parser.tab.c"
+break;
+case 359:
+#line 1403 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13149 "parser.tab.c"
+  if (!yytrial)
+#line 1403 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13153 "parser.tab.c"
+break;
+case 360:
+#line 1404 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13158 "parser.tab.c"
+  if (!yytrial)
+#line 1404 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 13162 "parser.tab.c"
+break;
+case 361:
+#line 1405 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13167 "parser.tab.c"
+  if (!yytrial)
+#line 1405 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 13171 "parser.tab.c"
+break;
+case 362:
+#line 1406 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13176 "parser.tab.c"
+  if (!yytrial)
+#line 1406 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 13180 "parser.tab.c"
+break;
+case 363:
+#line 1407 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13185 "parser.tab.c"
+  if (!yytrial)
+#line 1407 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 13189 "parser.tab.c"
+break;
+case 364:
+#line 1410 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13194 "parser.tab.c"
+  if (!yytrial)
+#line 1410 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-2].str, yyvsp[0].str); }
+#line 13198 "parser.tab.c"
+break;
+case 365:
+#line 1415 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13203 "parser.tab.c"
+  if (!yytrial)
+#line 1415 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 13207 "parser.tab.c"
+break;
+case 366:
+#line 1418 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13212 "parser.tab.c"
+  if (!yytrial)
+#line 1418 "/root/repo/src/parser.y"
+{ yyval.paramList = nullptr; }
+#line 13216 "parser.tab.c"
+break;
+case 367:
+  if (!yytrial)
+#line 1419 "/root/repo/src/parser.y"
+{
+                    yyval.paramList = new CppParamVector;
+                    yyval.paramList->emplace_back(yyvsp[0].varOrFuncPtr);
+                  }
+#line 13225 "parser.tab.c"
+break;
+case 368:
+#line 1423 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13230 "parser.tab.c"
+  if (!yytrial)
+#line 1423 "/root/repo/src/parser.y"
+{
+                    yyvsp[-2].paramList->emplace_back(yyvsp[0].varOrFuncPtr);
+                    yyval.paramList = yyvsp[-2].paramList;
+                  }
+#line 13237 "parser.tab.c"
+break;
+case 369:
+#line 1429 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13242 "parser.tab.c"
+  if (!yytrial)
+#line 1429 "/root/repo/src/parser.y"
+{ yyval.varOrFuncPtr = yyvsp[0].cppVarObj; yyvsp[0].cppVarObj->addAttr(kFuncParam);  }
+#line 13246 "parser.tab.c"
+break;
+case 370:
+#line 1430 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13251 "parser.tab.c"
+  if (!yytrial)
+#line 1430 "/root/repo/src/parser.y"
+{
+                    auto var = newObj<CppVar>(yyparam->objFactory, yyvsp[-2].cppVarType, std::string());
+                    var->addAttr(kFuncParam);
+                    var->assign(yyvsp[0].cppExprObj, AssignType::kUsingEqual);
+                    yyval.varOrFuncPtr = var;
+                  }
+#line 13260 "parser.tab.c"
+break;
+case 371:
+#line 1436 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13265 "parser.tab.c"
+  if (!yytrial)
+#line 1436 "/root/repo/src/parser.y"
+{ yyval.varOrFuncPtr = yyvsp[0].cppVarObj; yyvsp[0].cppVarObj->addAttr(kFuncParam);  }
+#line 13269 "parser.tab.c"
+break;
+case 372:
+#line 1437 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13274 "parser.tab.c"
+  if (!yytrial)
+#line 1437 "/root/repo/src/parser.y"
+{
+                    auto var = newObj<CppVar>(yyparam->objFactory, yyvsp[0].cppVarType, std::string());
+                    var->addAttr(kFuncParam);
+                    yyval.varOrFuncPtr = var;
+                  }
+#line 13282 "parser.tab.c"
+break;
+case 373:
+#line 1442 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13287 "parser.tab.c"
+  if (!yytrial)
+#line 1442 "/root/repo/src/parser.y"
+{ yyval.varOrFuncPtr = yyvsp[0].cppFuncPointerObj; yyvsp[0].cppFuncPointerObj->addAttr(kFuncParam);     }
+#line 13291 "parser.tab.c"
+break;
+case 374:
+#line 1443 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13296 "parser.tab.c"
+  if (!yytrial)
+#line 1443 "/root/repo/src/parser.y"
+{ yyval.varOrFuncPtr = yyvsp[0].varOrFuncPtr; delete yyvsp[-1].docCommentObj; }
+#line 13300 "parser.tab.c"
+break;
+case 375:
+#line 1444 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13305 "parser.tab.c"
+  if (!yytrial)
+#line 1444 "/root/repo/src/parser.y"
+{
+                    auto var = newObj<CppVar>(yyparam->objFactory, yyvsp[-3].cppVarType, std::string());
+                    var->addAttr(kFuncParam);
+                    var->addArraySize(yyvsp[-1].cppExprObj);
+                    yyval.varOrFuncPtr = var;
+                  }
+#line 13314 "parser.tab.c"
+break;
+case 376:
+#line 1450 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13319 "parser.tab.c"
+  if (!yytrial)
+#line 1450 "/root/repo/src/parser.y"
+{
+                    auto var = newObj<CppVar>(yyparam->objFactory, yyvsp[-2].cppVarType, std::string());
+                    var->addAttr(kFuncParam);
+                    var->addArraySize(nullptr);
+                    yyval.varOrFuncPtr = var;
+                  }
+#line 13328 "parser.tab.c"
+break;
+case 377:
+#line 1458 "/root/repo/src/parser.y"
+{ZZLOG; yyval.templateArg = nullptr;}
+#line 13333 "parser.tab.c"
+break;
+case 378:
+  if (!yytrial)
+#line 1458 "/root/repo/src/parser.y"
+{ /*$$ = makeCppToken(nullptr, nullptr);*/ }
+#line 13339 "parser.tab.c"
+break;
+case 379:
+#line 1459 "/root/repo/src/parser.y"
+{ZZLOG; yyval.templateArg = nullptr;}
+#line 13344 "parser.tab.c"
+break;
+case 380:
+  if (!yytrial)
+#line 1459 "/root/repo/src/parser.y"
+{ /*$$ = mergeCppToken($1, $2);*/ delete yyvsp[-1].cppVarType; }
+#line 13350 "parser.tab.c"
+break;
+case 381:
+#line 1460 "/root/repo/src/parser.y"
+{ZZLOG; yyval.templateArg = nullptr;}
+#line 13355 "parser.tab.c"
+break;
+case 382:
+  if (!yytrial)
+#line 1460 "/root/repo/src/parser.y"
+{ /*$$ = $1;*/ }
+#line 13361 "parser.tab.c"
+break;
+case 383:
+#line 1461 "/root/repo/src/parser.y"
+{ZZLOG; yyval.templateArg = nullptr;}
+#line 13366 "parser.tab.c"
+break;
+case 384:
+  if (!yytrial)
+#line 1461 "/root/repo/src/parser.y"
+{ delete yyvsp[-1].cppExprObj; }
+#line 13372 "parser.tab.c"
+break;
+case 385:
+#line 1464 "/root/repo/src/parser.y"
+{ZZLOG; yyval.templateArg = yyvsp[0].templateArg; }
+#line 13377 "parser.tab.c"
+break;
+case 386:
+  if (!yytrial)
+#line 1464 "/root/repo/src/parser.y"
+{}
+#line 13383 "parser.tab.c"
+break;
+case 387:
+#line 1465 "/root/repo/src/parser.y"
+{ZZLOG; yyval.templateArg = yyvsp[-2].templateArg;}
+#line 13388 "parser.tab.c"
+break;
+case 388:
+  if (!yytrial)
+#line 1465 "/root/repo/src/parser.y"
+{ /*$$ = mergeCppToken($1, $3);*/ }
+#line 13394 "parser.tab.c"
+break;
+case 389:
+#line 1466 "/root/repo/src/parser.y"
+{ZZLOG; yyval.templateArg = yyvsp[-3].templateArg;}
+#line 13399 "parser.tab.c"
+break;
+case 390:
+  if (!yytrial)
+#line 1466 "/root/repo/src/parser.y"
+{ delete yyvsp[-2].docCommentObj; }
+#line 13405 "parser.tab.c"
+break;
+case 391:
+#line 1469 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13410 "parser.tab.c"
+  if (!yytrial)
+#line 1469 "/root/repo/src/parser.y"
+{ yyval.attr = yyvsp[0].attr; }
+#line 13414 "parser.tab.c"
+break;
+case 392:
+#line 1470 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13419 "parser.tab.c"
+  if (!yytrial)
+#line 1470 "/root/repo/src/parser.y"
+{ yyval.attr = kInline;    }
+#line 13423 "parser.tab.c"
+break;
+case 393:
+#line 1471 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13428 "parser.tab.c"
+  if (!yytrial)
+#line 1471 "/root/repo/src/parser.y"
+{ yyval.attr = kVirtual;   }
+#line 13432 "parser.tab.c"
+break;
+case 394:
+#line 1472 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13437 "parser.tab.c"
+  if (!yytrial)
+#line 1472 "/root/repo/src/parser.y"
+{ yyval.attr = kExplicit;  }
+#line 13441 "parser.tab.c"
+break;
+case 395:
+#line 1473 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13446 "parser.tab.c"
+  if (!yytrial)
+#line 1473 "/root/repo/src/parser.y"
+{ yyval.attr = kFriend;    }
+#line 13450 "parser.tab.c"
+break;
+case 396:
+#line 1474 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13455 "parser.tab.c"
+  if (!yytrial)
+#line 1474 "/root/repo/src/parser.y"
+{ yyval.attr = kConstExpr; }
+#line 13459 "parser.tab.c"
+break;
+case 397:
+#line 1477 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13464 "parser.tab.c"
+  if (!yytrial)
+#line 1477 "/root/repo/src/parser.y"
+{ yyval.attr = 0;}
+#line 13468 "parser.tab.c"
+break;
+case 398:
+#line 1478 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13473 "parser.tab.c"
+  if (!yytrial)
+#line 1478 "/root/repo/src/parser.y"
+{ yyval.attr = yyvsp[0].attr;}
+#line 13477 "parser.tab.c"
+break;
+case 399:
+#line 1481 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13482 "parser.tab.c"
+  if (!yytrial)
+#line 1481 "/root/repo/src/parser.y"
+{ yyval.attr = kConst; }
+#line 13486 "parser.tab.c"
+break;
+case 400:
+#line 1482 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13491 "parser.tab.c"
+  if (!yytrial)
+#line 1482 "/root/repo/src/parser.y"
+{ yyval.attr = kOverride; }
+#line 13495 "parser.tab.c"
+break;
+case 401:
+#line 1483 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13500 "parser.tab.c"
+  if (!yytrial)
+#line 1483 "/root/repo/src/parser.y"
+{ yyval.attr = kFinal; }
+#line 13504 "parser.tab.c"
+break;
+case 402:
+#line 1484 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13509 "parser.tab.c"
+  if (!yytrial)
+#line 1484 "/root/repo/src/parser.y"
+{ yyval.attr = kNoExcept; }
+#line 13513 "parser.tab.c"
+break;
+case 403:
+#line 1485 "/root/repo/src/parser.y"
+{if(yyvsp[0].str.len != 1 || yyvsp[0].str.sz[0] != '0') YYABORT; else ZZVALID;}{ZZLOG;}
+#line 13518 "parser.tab.c"
+  if (!yytrial)
+#line 1486 "/root/repo/src/parser.y"
+{ yyval.attr = kPureVirtual; }
+#line 13522 "parser.tab.c"
+break;
+case 404:
+#line 1487 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13527 "parser.tab.c"
+  if (!yytrial)
+#line 1487 "/root/repo/src/parser.y"
+{ yyval.attr = yyvsp[-1].attr | kConst; }
+#line 13531 "parser.tab.c"
+break;
+case 405:
+#line 1488 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13536 "parser.tab.c"
+  if (!yytrial)
+#line 1488 "/root/repo/src/parser.y"
+{ yyval.attr = yyvsp[-1].attr | kOverride; }
+#line 13540 "parser.tab.c"
+break;
+case 406:
+#line 1489 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13545 "parser.tab.c"
+  if (!yytrial)
+#line 1489 "/root/repo/src/parser.y"
+{ yyval.attr = yyvsp[-1].attr | kFinal; }
+#line 13549 "parser.tab.c"
+break;
+case 407:
+#line 1490 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13554 "parser.tab.c"
+  if (!yytrial)
+#line 1490 "/root/repo/src/parser.y"
+{ yyval.attr = yyvsp[-1].attr | kNoExcept; }
+#line 13558 "parser.tab.c"
+break;
+case 408:
+#line 1491 "/root/repo/src/parser.y"
+{if(yyvsp[0].str.len != 1 || yyvsp[0].str.sz[0] != '0') YYABORT; else ZZVALID;}
+#line 13563 "parser.tab.c"
+  if (!yytrial)
+#line 1492 "/root/repo/src/parser.y"
+{ yyval.attr = yyvsp[-2].attr | kPureVirtual; }
+#line 13567 "parser.tab.c"
+break;
+case 409:
+#line 1493 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13572 "parser.tab.c"
+  if (!yytrial)
+#line 1493 "/root/repo/src/parser.y"
+{ yyval.attr = 0; }
+#line 13576 "parser.tab.c"
+break;
+case 410:
+#line 1496 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13581 "parser.tab.c"
+  if (!yytrial)
+#line 1496 "/root/repo/src/parser.y"
+{ yyval.funcThrowSpec = nullptr; }
+#line 13585 "parser.tab.c"
+break;
+case 411:
+#line 1497 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13590 "parser.tab.c"
+  if (!yytrial)
+#line 1497 "/root/repo/src/parser.y"
+{ yyval.funcThrowSpec = yyvsp[0].funcThrowSpec; }
+#line 13594 "parser.tab.c"
+break;
+case 412:
+#line 1500 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13599 "parser.tab.c"
+  if (!yytrial)
+#line 1500 "/root/repo/src/parser.y"
+{
+                    yyval.funcThrowSpec = yyvsp[-1].identifierList ? yyvsp[-1].identifierList : new CppFuncThrowSpec;
+                  }
+#line 13605 "parser.tab.c"
+break;
+case 413:
+#line 1505 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13610 "parser.tab.c"
+  if (!yytrial)
+#line 1505 "/root/repo/src/parser.y"
+{ yyval.identifierList = nullptr; }
+#line 13614 "parser.tab.c"
+break;
+case 414:
+#line 1506 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13619 "parser.tab.c"
+  if (!yytrial)
+#line 1506 "/root/repo/src/parser.y"
+{
+                    yyval.identifierList = new CppIdentifierList;
+                    yyval.identifierList->push_back(yyvsp[0].str);
+                  }
+#line 13626 "parser.tab.c"
+break;
+case 415:
+#line 1510 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13631 "parser.tab.c"
+  if (!yytrial)
+#line 1510 "/root/repo/src/parser.y"
+{
+                    yyval.identifierList = yyvsp[-2].identifierList;
+                    yyval.identifierList->push_back(yyvsp[0].str);
+                  }
+#line 13638 "parser.tab.c"
+break;
+case 416:
+#line 1516 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 13643 "parser.tab.c"
+  if (!yytrial)
+#line 1516 "/root/repo/src/parser.y"
+{ yyval.cppCtorObj = yyvsp[-1].cppCtorObj; }
+#line 13647 "parser.tab.c"
+break;
+case 417:
+#line 1519 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 13652 "parser.tab.c"
+  if (!yytrial)
+#line 1520 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = yyvsp[-2].cppCtorObj;
+                    yyval.cppCtorObj->memInits_  = yyvsp[-1].memInitList;
+                    yyval.cppCtorObj->defn(yyvsp[0].cppCompundObj);
+                  }
+#line 13660 "parser.tab.c"
+break;
+case 418:
+#line 1525 "/root/repo/src/parser.y"
+{if(yyvsp[-2].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 13665 "parser.tab.c"
+break;
+case 419:
+#line 1526 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 13670 "parser.tab.c"
+  if (!yytrial)
+#line 1527 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = newConstructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken(yyvsp[-9].str, yyvsp[-7].str), yyvsp[-4].paramList, yyvsp[-1].memInitList, 0);
+                    yyval.cppCtorObj->defn(yyvsp[0].cppCompundObj);
+                    yyval.cppCtorObj->throwSpec(yyvsp[-2].funcThrowSpec);
+                  }
+#line 13678 "parser.tab.c"
+break;
+case 420:
+#line 1532 "/root/repo/src/parser.y"
+{if(yyvsp[-2].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 13683 "parser.tab.c"
+break;
+case 421:
+#line 1533 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 13688 "parser.tab.c"
+  if (!yytrial)
+#line 1534 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = newConstructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken(yyvsp[-11].str, yyvsp[-7].str), yyvsp[-4].paramList, yyvsp[-1].memInitList, 0);
+                    yyval.cppCtorObj->defn(yyvsp[0].cppCompundObj);
+                    yyval.cppCtorObj->throwSpec(yyvsp[-2].funcThrowSpec);
+                  }
+#line 13696 "parser.tab.c"
+break;
+case 422:
+#line 1539 "/root/repo/src/parser.y"
+{if(yyvsp[-5].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 13701 "parser.tab.c"
+break;
+case 423:
+#line 1540 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 13706 "parser.tab.c"
+  if (!yytrial)
+#line 1541 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = newConstructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken(yyvsp[-12].str, yyvsp[-7].str), yyvsp[-4].paramList, yyvsp[-1].memInitList, 0);
+                    yyval.cppCtorObj->defn(yyvsp[0].cppCompundObj);
+                    yyval.cppCtorObj->throwSpec(yyvsp[-2].funcThrowSpec);
+                  }
+#line 13714 "parser.tab.c"
+break;
+case 424:
+#line 1546 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13719 "parser.tab.c"
+  if (!yytrial)
+#line 1546 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = yyvsp[0].cppCtorObj;
+                    yyval.cppCtorObj->addAttr(yyvsp[-1].attr);
+                  }
+#line 13726 "parser.tab.c"
+break;
+case 425:
+#line 1550 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13731 "parser.tab.c"
+  if (!yytrial)
+#line 1550 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = yyvsp[0].cppCtorObj;
+                    yyval.cppCtorObj->templateParamList(yyvsp[-1].templateParamList);
+                  }
+#line 13738 "parser.tab.c"
+break;
+case 426:
+#line 1557 "/root/repo/src/parser.y"
+{
+                    if(yyparam->compoundStack.empty())
+                      ZZERROR;
+                    if((yyparam->compoundStack.top() != yyvsp[-3].str) && (classNameFromIdentifier(yyparam->compoundStack.top()) != yyvsp[-3].str))
+                      ZZERROR;
+                    else
+                      ZZVALID;
+                  }
+#line 13750 "parser.tab.c"
+  if (!yytrial)
+#line 1565 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = newConstructor(yyparam->objFactory, yyparam->curAccessType, yyvsp[-3].str, yyvsp[-1].paramList, makeEmptyCppMemInitList(), 0);
+                  }
+#line 13756 "parser.tab.c"
+break;
+case 427:
+#line 1568 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13761 "parser.tab.c"
+  if (!yytrial)
+#line 1568 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = yyvsp[0].cppCtorObj;
+                    yyval.cppCtorObj->addAttr(yyvsp[-1].attr);
+                  }
+#line 13768 "parser.tab.c"
+break;
+case 428:
+#line 1572 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13773 "parser.tab.c"
+  if (!yytrial)
+#line 1572 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = yyvsp[0].cppCtorObj;
+                    yyval.cppCtorObj->templateParamList(yyvsp[-1].templateParamList);
+                  }
+#line 13780 "parser.tab.c"
+break;
+case 429:
+#line 1576 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13785 "parser.tab.c"
+  if (!yytrial)
+#line 1576 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = yyvsp[-2].cppCtorObj;
+                    yyval.cppCtorObj->addAttr(kDelete);
+                  }
+#line 13792 "parser.tab.c"
+break;
+case 430:
+#line 1580 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13797 "parser.tab.c"
+  if (!yytrial)
+#line 1580 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = yyvsp[-2].cppCtorObj;
+                    yyval.cppCtorObj->addAttr(kDefault);
+                  }
+#line 13804 "parser.tab.c"
+break;
+case 431:
+#line 1584 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13809 "parser.tab.c"
+  if (!yytrial)
+#line 1584 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = yyvsp[-1].cppCtorObj;
+                    yyval.cppCtorObj->throwSpec(yyvsp[0].funcThrowSpec);
+                  }
+#line 13816 "parser.tab.c"
+break;
+case 432:
+#line 1588 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13821 "parser.tab.c"
+  if (!yytrial)
+#line 1588 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = yyvsp[-1].cppCtorObj;
+                    yyval.cppCtorObj->addAttr(kNoExcept);
+                  }
+#line 13828 "parser.tab.c"
+break;
+case 433:
+#line 1592 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13833 "parser.tab.c"
+  if (!yytrial)
+#line 1592 "/root/repo/src/parser.y"
+{
+                    yyval.cppCtorObj = yyvsp[0].cppCtorObj;
+                    yyval.cppCtorObj->decor1(yyvsp[-1].str);
+                  }
+#line 13840 "parser.tab.c"
+break;
+case 434:
+#line 1598 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13845 "parser.tab.c"
+  if (!yytrial)
+#line 1598 "/root/repo/src/parser.y"
+{ yyval.memInitList = makeEmptyCppMemInitList(); }
+#line 13849 "parser.tab.c"
+break;
+case 435:
+#line 1599 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13854 "parser.tab.c"
+  if (!yytrial)
+#line 1599 "/root/repo/src/parser.y"
+{
+                    yyval.memInitList = makeCppMemInitList(new CppMemInitList);
+                    yyval.memInitList.memInitList->push_back(CppMemInit(yyvsp[0].memInit.mem, yyvsp[0].memInit.init));
+                  }
+#line 13861 "parser.tab.c"
+break;
+case 436:
+#line 1603 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13866 "parser.tab.c"
+  if (!yytrial)
+#line 1603 "/root/repo/src/parser.y"
+{ yyval.memInitList = makeCppMemInitList(yyvsp[0].blob); }
+#line 13870 "parser.tab.c"
+break;
+case 437:
+#line 1604 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13875 "parser.tab.c"
+  if (!yytrial)
+#line 1604 "/root/repo/src/parser.y"
+{
+                    yyval.memInitList = yyvsp[-2].memInitList;
+                    assert(yyval.memInitList.memInitListIsABlob_ == false);
+                    yyval.memInitList.memInitList->push_back(CppMemInit(yyvsp[0].memInit.mem, yyvsp[0].memInit.init));
+                  }
+#line 13883 "parser.tab.c"
+break;
+case 438:
+#line 1611 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13888 "parser.tab.c"
+  if (!yytrial)
+#line 1611 "/root/repo/src/parser.y"
+{ yyval.memInit = CppNtMemInit{yyvsp[-3].str, yyvsp[-1].cppExprObj}; }
+#line 13892 "parser.tab.c"
+break;
+case 439:
+#line 1612 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13897 "parser.tab.c"
+  if (!yytrial)
+#line 1612 "/root/repo/src/parser.y"
+{ yyval.memInit = CppNtMemInit{yyvsp[-2].str, nullptr}; }
+#line 13901 "parser.tab.c"
+break;
+case 440:
+#line 1613 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13906 "parser.tab.c"
+  if (!yytrial)
+#line 1613 "/root/repo/src/parser.y"
+{ yyval.memInit = CppNtMemInit{yyvsp[-3].str, yyvsp[-1].cppExprObj}; }
+#line 13910 "parser.tab.c"
+break;
+case 441:
+#line 1614 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13915 "parser.tab.c"
+  if (!yytrial)
+#line 1614 "/root/repo/src/parser.y"
+{ yyval.memInit = CppNtMemInit{yyvsp[-2].str, nullptr}; }
+#line 13919 "parser.tab.c"
+break;
+case 442:
+#line 1617 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 13924 "parser.tab.c"
+  if (!yytrial)
+#line 1617 "/root/repo/src/parser.y"
+{ yyval.cppDtorObj = yyvsp[-1].cppDtorObj; }
+#line 13928 "parser.tab.c"
+break;
+case 443:
+#line 1620 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 13933 "parser.tab.c"
+  if (!yytrial)
+#line 1621 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = yyvsp[-1].cppDtorObj;
+                    yyval.cppDtorObj->defn(yyvsp[0].cppCompundObj ? yyvsp[0].cppCompundObj : newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock));
+                  }
+#line 13940 "parser.tab.c"
+break;
+case 444:
+#line 1625 "/root/repo/src/parser.y"
+{if(yyvsp[-3].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 13945 "parser.tab.c"
+break;
+case 445:
+  if (!yytrial)
+#line 1627 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = newDestructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken(yyvsp[-7].str, yyvsp[-4].str), 0);
+                    yyval.cppDtorObj->defn(yyvsp[0].cppCompundObj ? yyvsp[0].cppCompundObj : newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock));
+                  }
+#line 13954 "parser.tab.c"
+break;
+case 446:
+#line 1631 "/root/repo/src/parser.y"
+{if(yyvsp[-3].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 13959 "parser.tab.c"
+break;
+case 447:
+  if (!yytrial)
+#line 1633 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = newDestructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken(yyvsp[-9].str, yyvsp[-4].str), 0);
+                    yyval.cppDtorObj->defn(yyvsp[0].cppCompundObj ? yyvsp[0].cppCompundObj : newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock));
+                  }
+#line 13968 "parser.tab.c"
+break;
+case 448:
+#line 1637 "/root/repo/src/parser.y"
+{if(yyvsp[-6].str != yyvsp[0].str) ZZERROR; else ZZVALID;}
+#line 13973 "parser.tab.c"
+break;
+case 449:
+  if (!yytrial)
+#line 1639 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = newDestructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken(yyvsp[-10].str, yyvsp[-4].str), 0);
+                    yyval.cppDtorObj->defn(yyvsp[0].cppCompundObj ? yyvsp[0].cppCompundObj : newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock));
+                  }
+#line 13982 "parser.tab.c"
+break;
+case 450:
+#line 1643 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13987 "parser.tab.c"
+  if (!yytrial)
+#line 1643 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = yyvsp[0].cppDtorObj;
+                    yyval.cppDtorObj->templateParamList(yyvsp[-1].templateParamList);
+                  }
+#line 13994 "parser.tab.c"
+break;
+case 451:
+#line 1647 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 13999 "parser.tab.c"
+  if (!yytrial)
+#line 1647 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = yyvsp[0].cppDtorObj;
+                    yyval.cppDtorObj->addAttr(yyvsp[-1].attr);
+                  }
+#line 14006 "parser.tab.c"
+break;
+case 452:
+#line 1653 "/root/repo/src/parser.y"
+{ZZLOG;}{
+                    if(yyparam->compoundStack.empty())
+                      ZZERROR;
+                    if(classNameFromIdentifier(yyparam->compoundStack.top()) != yyvsp[-3].str)
+                      ZZERROR;
+                    else
+                      ZZVALID;
+                  }
+#line 14018 "parser.tab.c"
+  if (!yytrial)
+#line 1662 "/root/repo/src/parser.y"
+{
+                    const char* tildaStartPos = yyvsp[-3].str.sz-1;
+                    while(*tildaStartPos != '~') --tildaStartPos;
+                    yyval.cppDtorObj = newDestructor(yyparam->objFactory, yyparam->curAccessType, makeCppToken(tildaStartPos, yyvsp[-3].str.sz+yyvsp[-3].str.len-tildaStartPos), 0);
+                  }
+#line 14026 "parser.tab.c"
+break;
+case 453:
+#line 1667 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14031 "parser.tab.c"
+  if (!yytrial)
+#line 1667 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = yyvsp[0].cppDtorObj;
+                    yyval.cppDtorObj->decor1(yyvsp[-1].str);
+                  }
+#line 14038 "parser.tab.c"
+break;
+case 454:
+#line 1671 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14043 "parser.tab.c"
+  if (!yytrial)
+#line 1671 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = yyvsp[0].cppDtorObj;
+                    yyval.cppDtorObj->addAttr(yyvsp[-1].attr);
+                  }
+#line 14050 "parser.tab.c"
+break;
+case 455:
+#line 1675 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14055 "parser.tab.c"
+  if (!yytrial)
+#line 1676 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = yyvsp[-1].cppDtorObj;
+                    yyval.cppDtorObj->addAttr(yyvsp[0].attr);
+                  }
+#line 14062 "parser.tab.c"
+break;
+case 456:
+#line 1680 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14067 "parser.tab.c"
+  if (!yytrial)
+#line 1681 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = yyvsp[-2].cppDtorObj;
+                    yyval.cppDtorObj->addAttr(kPureVirtual);
+                  }
+#line 14074 "parser.tab.c"
+break;
+case 457:
+#line 1685 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14079 "parser.tab.c"
+  if (!yytrial)
+#line 1685 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = yyvsp[-2].cppDtorObj;
+                    yyval.cppDtorObj->addAttr(kDelete);
+                  }
+#line 14086 "parser.tab.c"
+break;
+case 458:
+#line 1689 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14091 "parser.tab.c"
+  if (!yytrial)
+#line 1689 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = yyvsp[-2].cppDtorObj;
+                    yyval.cppDtorObj->addAttr(kDefault);
+                  }
+#line 14098 "parser.tab.c"
+break;
+case 459:
+#line 1693 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14103 "parser.tab.c"
+  if (!yytrial)
+#line 1693 "/root/repo/src/parser.y"
+{
+                    yyval.cppDtorObj = yyvsp[-1].cppDtorObj;
+                    yyval.cppDtorObj->throwSpec(yyvsp[0].funcThrowSpec);
+                  }
+#line 14110 "parser.tab.c"
+break;
+case 460:
+#line 1699 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14115 "parser.tab.c"
+break;
+case 461:
+#line 1700 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14120 "parser.tab.c"
+break;
+case 462:
+#line 1703 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14125 "parser.tab.c"
+  if (!yytrial)
+#line 1703 "/root/repo/src/parser.y"
+{
+                  }
+#line 14130 "parser.tab.c"
+break;
+case 463:
+#line 1705 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14135 "parser.tab.c"
+  if (!yytrial)
+#line 1705 "/root/repo/src/parser.y"
+{
+                  }
+#line 14140 "parser.tab.c"
+break;
+case 464:
+#line 1709 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14145 "parser.tab.c"
+  if (!yytrial)
+#line 1709 "/root/repo/src/parser.y"
+{ yyval.cppCompundObj = yyvsp[-1].cppCompundObj;}
+#line 14149 "parser.tab.c"
+break;
+case 465:
+  if (!yytrial)
+#line 1712 "/root/repo/src/parser.y"
+{
+                    yyval.attribSpecifier = yyvsp[-2].cppExprObj;
+                  }
+#line 14157 "parser.tab.c"
+break;
+case 466:
+  if (!yytrial)
+#line 1717 "/root/repo/src/parser.y"
+{ yyval.attribSpecifiers = nullptr; }
+#line 14163 "parser.tab.c"
+break;
+case 467:
+  if (!yytrial)
+#line 1718 "/root/repo/src/parser.y"
+{ yyval.attribSpecifiers = yyvsp[0].attribSpecifiers; }
+#line 14169 "parser.tab.c"
+break;
+case 468:
+  if (!yytrial)
+#line 1721 "/root/repo/src/parser.y"
+{
+                    yyval.attribSpecifiers = new AttribSpecifierArray;
+                    yyval.attribSpecifiers->emplace_back(yyvsp[0].attribSpecifier);
+                  }
+#line 14178 "parser.tab.c"
+break;
+case 469:
+  if (!yytrial)
+#line 1725 "/root/repo/src/parser.y"
+{
+                    yyval.attribSpecifiers = yyvsp[-1].attribSpecifiers;
+                    yyval.attribSpecifiers->emplace_back(yyvsp[0].attribSpecifier);
+                  }
+#line 14187 "parser.tab.c"
+break;
+case 470:
+#line 1732 "/root/repo/src/parser.y"
+{
+                    ZZVALID;
+                    yyparam->compoundStack.push(yyvsp[-4].str);
+                    yyparam->accessTypeStack.push(yyparam->curAccessType); yyparam->curAccessType = CppAccessType::kUnknown;
+                  }
+#line 14196 "parser.tab.c"
+break;
+case 471:
+#line 1738 "/root/repo/src/parser.y"
+{
+                    ZZVALID;
+                    yyparam->compoundStack.pop();
+                    yyparam->curAccessType = yyparam->accessTypeStack.top();
+                    yyparam->accessTypeStack.pop();
+                  }
+#line 14206 "parser.tab.c"
+  if (!yytrial)
+#line 1744 "/root/repo/src/parser.y"
+{
+                    yyval.cppCompundObj = yyvsp[-1].cppCompundObj ? yyvsp[-1].cppCompundObj : newCompound(yyparam->objFactory, yyparam->curAccessType);
+                    yyval.cppCompundObj->compoundType(yyvsp[-10].compoundType);
+                    yyval.cppCompundObj->apidecor(yyvsp[-9].str);
+                    yyval.cppCompundObj->attribSpecifierSequence(yyvsp[-8].attribSpecifiers);
+                    yyval.cppCompundObj->name(pruneClassName(yyvsp[-7].str));
+                    yyval.cppCompundObj->inheritanceList(yyvsp[-5].inheritList);
+                    yyval.cppCompundObj->addAttr(yyvsp[-6].attr);
+                  }
+#line 14218 "parser.tab.c"
+break;
+case 472:
+  if (!yytrial)
+#line 1754 "/root/repo/src/parser.y"
+{ yyparam->accessTypeStack.push(yyparam->curAccessType); yyparam->curAccessType = CppAccessType::kUnknown; }
+#line 14224 "parser.tab.c"
+break;
+case 473:
+#line 1756 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14229 "parser.tab.c"
+  if (!yytrial)
+#line 1757 "/root/repo/src/parser.y"
+{
+                    yyparam->curAccessType = yyparam->accessTypeStack.top();
+                    yyparam->accessTypeStack.pop();
+
+                    yyval.cppCompundObj = yyvsp[-1].cppCompundObj ? yyvsp[-1].cppCompundObj : newCompound(yyparam->objFactory, yyparam->curAccessType);
+                    yyval.cppCompundObj->compoundType(yyvsp[-7].compoundType);
+                    yyval.cppCompundObj->attribSpecifierSequence(yyvsp[-6].attribSpecifiers);
+                    yyval.cppCompundObj->inheritanceList(yyvsp[-5].inheritList);
+                  }
+#line 14241 "parser.tab.c"
+break;
+case 474:
+#line 1766 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14246 "parser.tab.c"
+  if (!yytrial)
+#line 1767 "/root/repo/src/parser.y"
+{
+                    yyval.cppCompundObj = yyvsp[0].cppCompundObj;
+                    yyval.cppCompundObj->templateParamList(yyvsp[-1].templateParamList);
+                  }
+#line 14253 "parser.tab.c"
+break;
+case 475:
+#line 1774 "/root/repo/src/parser.y"
+{
+                    ZZVALID;
+                    yyparam->compoundStack.push(classNameFromIdentifier(yyvsp[-1].str));
+                    yyparam->accessTypeStack.push(yyparam->curAccessType); yyparam->curAccessType = CppAccessType::kUnknown;
+                  }
+#line 14262 "parser.tab.c"
+break;
+case 476:
+#line 1780 "/root/repo/src/parser.y"
+{
+                    ZZVALID;
+                    yyparam->compoundStack.pop();
+                    yyparam->curAccessType = yyparam->accessTypeStack.top();
+                    yyparam->accessTypeStack.pop();
+                  }
+#line 14272 "parser.tab.c"
+  if (!yytrial)
+#line 1786 "/root/repo/src/parser.y"
+{
+                    yyval.cppCompundObj = yyvsp[-1].cppCompundObj ? yyvsp[-1].cppCompundObj : newCompound(yyparam->objFactory, yyparam->curAccessType);
+                    yyval.cppCompundObj->compoundType(CppCompoundType::kNamespace);
+                    yyval.cppCompundObj->name(yyvsp[-4].str);
+                  }
+#line 14280 "parser.tab.c"
+break;
+case 477:
+#line 1793 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14285 "parser.tab.c"
+  if (!yytrial)
+#line 1793 "/root/repo/src/parser.y"
+{ yyval.attr = 0; }
+#line 14289 "parser.tab.c"
+break;
+case 478:
+#line 1794 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14294 "parser.tab.c"
+  if (!yytrial)
+#line 1794 "/root/repo/src/parser.y"
+{ yyval.attr = kFinal; }
+#line 14298 "parser.tab.c"
+break;
+case 479:
+#line 1797 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14303 "parser.tab.c"
+  if (!yytrial)
+#line 1797 "/root/repo/src/parser.y"
+{ yyval.inheritList = 0; }
+#line 14307 "parser.tab.c"
+break;
+case 480:
+#line 1798 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14312 "parser.tab.c"
+  if (!yytrial)
+#line 1798 "/root/repo/src/parser.y"
+{
+                    yyval.inheritList = new CppInheritanceList; yyval.inheritList->push_back(CppInheritInfo((std::string) yyvsp[0].str, yyvsp[-2].objAccessType, yyvsp[-1].inheritType));
+                  }
+#line 14318 "parser.tab.c"
+break;
+case 481:
+#line 1801 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14323 "parser.tab.c"
+  if (!yytrial)
+#line 1801 "/root/repo/src/parser.y"
+{
+                    yyval.inheritList = yyvsp[-4].inheritList; yyval.inheritList->push_back(CppInheritInfo((std::string) yyvsp[0].str, yyvsp[-2].objAccessType, yyvsp[-1].inheritType));
+                  }
+#line 14329 "parser.tab.c"
+break;
+case 482:
+#line 1804 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14334 "parser.tab.c"
+  if (!yytrial)
+#line 1804 "/root/repo/src/parser.y"
+{
+                    yyval.inheritList = new CppInheritanceList; yyval.inheritList->push_back(CppInheritInfo((std::string) yyvsp[0].str, yyvsp[-1].objAccessType, yyvsp[-2].inheritType));
+                  }
+#line 14340 "parser.tab.c"
+break;
+case 483:
+#line 1807 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14345 "parser.tab.c"
+  if (!yytrial)
+#line 1807 "/root/repo/src/parser.y"
+{
+                    yyval.inheritList = yyvsp[-4].inheritList; yyval.inheritList->push_back(CppInheritInfo((std::string) yyvsp[0].str, yyvsp[-1].objAccessType, yyvsp[-2].inheritType));
+                  }
+#line 14351 "parser.tab.c"
+break;
+case 484:
+#line 1812 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14356 "parser.tab.c"
+  if (!yytrial)
+#line 1812 "/root/repo/src/parser.y"
+{ yyval.objAccessType = CppAccessType::kUnknown;    }
+#line 14360 "parser.tab.c"
+break;
+case 485:
+#line 1813 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14365 "parser.tab.c"
+  if (!yytrial)
+#line 1813 "/root/repo/src/parser.y"
+{ yyval.objAccessType = CppAccessType::kPublic;     }
+#line 14369 "parser.tab.c"
+break;
+case 486:
+#line 1814 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14374 "parser.tab.c"
+  if (!yytrial)
+#line 1814 "/root/repo/src/parser.y"
+{ yyval.objAccessType = CppAccessType::kProtected;  }
+#line 14378 "parser.tab.c"
+break;
+case 487:
+#line 1815 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14383 "parser.tab.c"
+  if (!yytrial)
+#line 1815 "/root/repo/src/parser.y"
+{ yyval.objAccessType = CppAccessType::kPrivate;    }
+#line 14387 "parser.tab.c"
+break;
+case 488:
+#line 1818 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14392 "parser.tab.c"
+  if (!yytrial)
+#line 1818 "/root/repo/src/parser.y"
+{ yyval.inheritType = false; }
+#line 14396 "parser.tab.c"
+break;
+case 489:
+#line 1819 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14401 "parser.tab.c"
+  if (!yytrial)
+#line 1819 "/root/repo/src/parser.y"
+{ yyval.inheritType = true; }
+#line 14405 "parser.tab.c"
+break;
+case 490:
+#line 1822 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14410 "parser.tab.c"
+  if (!yytrial)
+#line 1822 "/root/repo/src/parser.y"
+{ yyval.fwdDeclObj = newObj<CppFwdClsDecl>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-1].str, yyvsp[-2].compoundType); }
+#line 14414 "parser.tab.c"
+break;
+case 491:
+#line 1823 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14419 "parser.tab.c"
+  if (!yytrial)
+#line 1823 "/root/repo/src/parser.y"
+{ yyval.fwdDeclObj = newObj<CppFwdClsDecl>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-1].str, yyvsp[-2].str, yyvsp[-3].compoundType); }
+#line 14423 "parser.tab.c"
+break;
+case 492:
+#line 1824 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14428 "parser.tab.c"
+  if (!yytrial)
+#line 1824 "/root/repo/src/parser.y"
+{
+                    yyval.fwdDeclObj = yyvsp[0].fwdDeclObj;
+                    yyval.fwdDeclObj->templateParamList(yyvsp[-1].templateParamList);
+                  }
+#line 14435 "parser.tab.c"
+break;
+case 493:
+#line 1828 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14440 "parser.tab.c"
+  if (!yytrial)
+#line 1828 "/root/repo/src/parser.y"
+{ yyval.fwdDeclObj = newObj<CppFwdClsDecl>(yyparam->objFactory, yyparam->curAccessType, yyvsp[-1].str); yyval.fwdDeclObj->addAttr(kFriend); }
+#line 14444 "parser.tab.c"
+break;
+case 494:
+#line 1829 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14449 "parser.tab.c"
+  if (!yytrial)
+#line 1829 "/root/repo/src/parser.y"
+{ yyval.fwdDeclObj = yyvsp[0].fwdDeclObj; yyval.fwdDeclObj->addAttr(kFriend); }
+#line 14453 "parser.tab.c"
+break;
+case 495:
+#line 1832 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14458 "parser.tab.c"
+  if (!yytrial)
+#line 1832 "/root/repo/src/parser.y"
+{ yyval.compoundType = CppCompoundType::kClass;     }
+#line 14462 "parser.tab.c"
+break;
+case 496:
+#line 1833 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14467 "parser.tab.c"
+  if (!yytrial)
+#line 1833 "/root/repo/src/parser.y"
+{ yyval.compoundType = CppCompoundType::kStruct;    }
+#line 14471 "parser.tab.c"
+break;
+case 497:
+#line 1834 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14476 "parser.tab.c"
+  if (!yytrial)
+#line 1834 "/root/repo/src/parser.y"
+{ yyval.compoundType = CppCompoundType::kUnion;     }
+#line 14480 "parser.tab.c"
+break;
+case 498:
+#line 1837 "/root/repo/src/parser.y"
+{yyparam->inTemplateSpec = true;  ZZLOG;   }
+#line 14485 "parser.tab.c"
+break;
+case 499:
+#line 1838 "/root/repo/src/parser.y"
+{yyparam->inTemplateSpec = false; ZZVALID; }
+#line 14490 "parser.tab.c"
+  if (!yytrial)
+#line 1839 "/root/repo/src/parser.y"
+{
+                    yyval.templateParamList = yyvsp[-1].templateParamList;
+                  }
+#line 14496 "parser.tab.c"
+break;
+case 500:
+#line 1844 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14501 "parser.tab.c"
+  if (!yytrial)
+#line 1844 "/root/repo/src/parser.y"
+{
+                    yyval.templateParamList = new CppTemplateParamList;
+                  }
+#line 14507 "parser.tab.c"
+break;
+case 501:
+#line 1847 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14512 "parser.tab.c"
+  if (!yytrial)
+#line 1847 "/root/repo/src/parser.y"
+{
+                    yyval.templateParamList = new CppTemplateParamList;
+                    addTemplateParam(yyval.templateParamList, yyvsp[0].templateParam);
+                  }
+#line 14519 "parser.tab.c"
+break;
+case 502:
+#line 1851 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14524 "parser.tab.c"
+  if (!yytrial)
+#line 1851 "/root/repo/src/parser.y"
+{
+                    yyval.templateParamList = yyvsp[-2].templateParamList;
+                    addTemplateParam(yyval.templateParamList, yyvsp[0].templateParam);
+                  }
+#line 14531 "parser.tab.c"
+break;
+case 503:
+#line 1857 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14536 "parser.tab.c"
+  if (!yytrial)
+#line 1857 "/root/repo/src/parser.y"
+{
+                    yyval.templateParam = CppNtTemplateParam{nullptr, yyvsp[0].str, nullptr};
+                  }
+#line 14542 "parser.tab.c"
+break;
+case 504:
+#line 1860 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14547 "parser.tab.c"
+  if (!yytrial)
+#line 1860 "/root/repo/src/parser.y"
+{
+                    yyval.templateParam = CppNtTemplateParam{nullptr, yyvsp[-2].str, yyvsp[0].cppVarType};
+                  }
+#line 14553 "parser.tab.c"
+break;
+case 505:
+#line 1863 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14558 "parser.tab.c"
+  if (!yytrial)
+#line 1863 "/root/repo/src/parser.y"
+{
+                    yyval.templateParam = CppNtTemplateParam{nullptr, yyvsp[0].str, nullptr};
+                  }
+#line 14564 "parser.tab.c"
+break;
+case 506:
+#line 1866 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14569 "parser.tab.c"
+  if (!yytrial)
+#line 1866 "/root/repo/src/parser.y"
+{
+                    yyval.templateParam = CppNtTemplateParam{nullptr, yyvsp[-2].str, yyvsp[0].cppVarType};
+                  }
+#line 14575 "parser.tab.c"
+break;
+case 507:
+#line 1869 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14580 "parser.tab.c"
+  if (!yytrial)
+#line 1869 "/root/repo/src/parser.y"
+{
+                    yyval.templateParam = CppNtTemplateParam{yyvsp[-1].cppVarType, yyvsp[0].str, nullptr};
+                  }
+#line 14586 "parser.tab.c"
+break;
+case 508:
+#line 1872 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14591 "parser.tab.c"
+  if (!yytrial)
+#line 1872 "/root/repo/src/parser.y"
+{
+                    yyval.templateParam = CppNtTemplateParam{yyvsp[-3].cppVarType, yyvsp[-2].str, yyvsp[0].cppExprObj};
+                  }
+#line 14597 "parser.tab.c"
+break;
+case 509:
+#line 1875 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14602 "parser.tab.c"
+  if (!yytrial)
+#line 1875 "/root/repo/src/parser.y"
+{
+                    yyval.templateParam = CppNtTemplateParam{yyvsp[0].cppFuncPointerObj, makeCppToken(nullptr, nullptr), nullptr};
+                  }
+#line 14608 "parser.tab.c"
+break;
+case 510:
+#line 1878 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14613 "parser.tab.c"
+  if (!yytrial)
+#line 1878 "/root/repo/src/parser.y"
+{
+                    yyval.templateParam = CppNtTemplateParam{yyvsp[-2].cppFuncPointerObj, makeCppToken(nullptr, nullptr), yyvsp[0].cppExprObj};
+                  }
+#line 14619 "parser.tab.c"
+break;
+case 511:
+#line 1881 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14624 "parser.tab.c"
+  if (!yytrial)
+#line 1881 "/root/repo/src/parser.y"
+{ /* Can happen when forward declaring*/
+                    yyval.templateParam = CppNtTemplateParam{yyvsp[0].cppVarType, makeCppToken(nullptr, nullptr), nullptr};
+                  }
+#line 14630 "parser.tab.c"
+break;
+case 512:
+#line 1884 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14635 "parser.tab.c"
+  if (!yytrial)
+#line 1884 "/root/repo/src/parser.y"
+{ /* Can happen when forward declaring*/
+                    yyval.templateParam = CppNtTemplateParam{yyvsp[-2].cppVarType, makeCppToken(nullptr, nullptr), yyvsp[0].cppExprObj};
+                  }
+#line 14641 "parser.tab.c"
+break;
+case 513:
+#line 1888 "/root/repo/src/parser.y"
+{
+                    if (yyparam->inTemplateSpec)
+                      yyparam->templateParamStart = yyvsp[-2].str.sz;
+                    ZZERROR;
+                  }
+#line 14650 "parser.tab.c"
+  if (!yytrial)
+#line 1892 "/root/repo/src/parser.y"
+{ yyval.templateParam = CppNtTemplateParam{}; }
+#line 14654 "parser.tab.c"
+break;
+case 514:
+#line 1893 "/root/repo/src/parser.y"
+{
+                    if (yyparam->inTemplateSpec)
+                      yyparam->templateParamStart = yyvsp[-2].str.sz;
+                    ZZERROR;
+                  }
+#line 14663 "parser.tab.c"
+  if (!yytrial)
+#line 1897 "/root/repo/src/parser.y"
+{ yyval.templateParam = CppNtTemplateParam{}; }
+#line 14667 "parser.tab.c"
+break;
+case 515:
+#line 1898 "/root/repo/src/parser.y"
+{
+                    if (yyparam->inTemplateSpec)
+                      yyparam->templateParamStart = yyvsp[-2].str.sz;
+                    ZZERROR;
+                  }
+#line 14676 "parser.tab.c"
+  if (!yytrial)
+#line 1902 "/root/repo/src/parser.y"
+{ yyval.templateParam = CppNtTemplateParam{}; }
+#line 14680 "parser.tab.c"
+break;
+case 516:
+#line 1903 "/root/repo/src/parser.y"
+{
+                    if (yyparam->inTemplateSpec)
+                      yyparam->templateParamStart = yyvsp[-2].str.sz;
+                    ZZERROR;
+                  }
+#line 14689 "parser.tab.c"
+  if (!yytrial)
+#line 1907 "/root/repo/src/parser.y"
+{ yyval.templateParam = CppNtTemplateParam{}; }
+#line 14693 "parser.tab.c"
+break;
+case 517:
+#line 1908 "/root/repo/src/parser.y"
+{
+                    if (yyparam->inTemplateSpec)
+                      yyparam->templateParamStart = yyvsp[-2].str.sz;
+                    ZZERROR;
+                  }
+#line 14702 "parser.tab.c"
+  if (!yytrial)
+#line 1912 "/root/repo/src/parser.y"
+{ yyval.templateParam = CppNtTemplateParam{}; }
+#line 14706 "parser.tab.c"
+break;
+case 518:
+#line 1916 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14711 "parser.tab.c"
+  if (!yytrial)
+#line 1916 "/root/repo/src/parser.y"
+{ yyval.str = makeCppToken(nullptr, nullptr); }
+#line 14715 "parser.tab.c"
+break;
+case 519:
+#line 1917 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14720 "parser.tab.c"
+  if (!yytrial)
+#line 1917 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 14724 "parser.tab.c"
+break;
+case 520:
+#line 1920 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14729 "parser.tab.c"
+  if (!yytrial)
+#line 1920 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 14733 "parser.tab.c"
+break;
+case 521:
+#line 1921 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14738 "parser.tab.c"
+  if (!yytrial)
+#line 1921 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 14742 "parser.tab.c"
+break;
+case 522:
+#line 1922 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14747 "parser.tab.c"
+  if (!yytrial)
+#line 1922 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 14751 "parser.tab.c"
+break;
+case 523:
+#line 1923 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14756 "parser.tab.c"
+  if (!yytrial)
+#line 1923 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 14760 "parser.tab.c"
+break;
+case 524:
+#line 1926 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14765 "parser.tab.c"
+  if (!yytrial)
+#line 1926 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 14769 "parser.tab.c"
+break;
+case 525:
+#line 1927 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14774 "parser.tab.c"
+  if (!yytrial)
+#line 1927 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14778 "parser.tab.c"
+break;
+case 526:
+#line 1928 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14783 "parser.tab.c"
+  if (!yytrial)
+#line 1928 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-3].str, yyvsp[0].str); }
+#line 14787 "parser.tab.c"
+break;
+case 527:
+#line 1931 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14792 "parser.tab.c"
+  if (!yytrial)
+#line 1931 "/root/repo/src/parser.y"
+{ yyval.objAccessType = CppAccessType::kPublic;     }
+#line 14796 "parser.tab.c"
+break;
+case 528:
+#line 1932 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14801 "parser.tab.c"
+  if (!yytrial)
+#line 1932 "/root/repo/src/parser.y"
+{ yyval.objAccessType = CppAccessType::kProtected;  }
+#line 14805 "parser.tab.c"
+break;
+case 529:
+#line 1933 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14810 "parser.tab.c"
+  if (!yytrial)
+#line 1933 "/root/repo/src/parser.y"
+{ yyval.objAccessType = CppAccessType::kPrivate;    }
+#line 14814 "parser.tab.c"
+break;
+case 530:
+#line 1936 "/root/repo/src/parser.y"
+{ZZVALID;}
+#line 14819 "parser.tab.c"
+  if (!yytrial)
+#line 1936 "/root/repo/src/parser.y"
+{yyval.cppCompundObj = yyvsp[0].cppCompundObj; yyval.cppCompundObj->compoundType(CppCompoundType::kExternCBlock); }
+#line 14823 "parser.tab.c"
+break;
+case 531:
+#line 1939 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14828 "parser.tab.c"
+  if (!yytrial)
+#line 1939 "/root/repo/src/parser.y"
+{ yyval.str = yyvsp[0].str; }
+#line 14832 "parser.tab.c"
+break;
+case 532:
+#line 1940 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14837 "parser.tab.c"
+  if (!yytrial)
+#line 1940 "/root/repo/src/parser.y"
+{ yyval.str = mergeCppToken(yyvsp[-1].str, yyvsp[0].str); }
+#line 14841 "parser.tab.c"
+break;
+case 533:
+#line 1943 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14846 "parser.tab.c"
+  if (!yytrial)
+#line 1943 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, exprAtom(yyvsp[0].str), kNone);              }
+#line 14850 "parser.tab.c"
+break;
+case 534:
+#line 1944 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14855 "parser.tab.c"
+  if (!yytrial)
+#line 1944 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, exprAtom(yyvsp[0].str), kNone);              }
+#line 14859 "parser.tab.c"
+break;
+case 535:
+#line 1945 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14864 "parser.tab.c"
+  if (!yytrial)
+#line 1945 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, exprAtom(yyvsp[0].str), kNone);              }
+#line 14868 "parser.tab.c"
+break;
+case 536:
+#line 1946 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14873 "parser.tab.c"
+  if (!yytrial)
+#line 1946 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, exprAtom(yyvsp[0].str), kNone);              }
+#line 14877 "parser.tab.c"
+break;
+case 537:
+#line 1948 "/root/repo/src/parser.y"
+{
+                      if (yyvsp[0].str.sz == yyparam->paramModPos) {
+                        yyparam->paramModPos = nullptr;
+                        ZZERROR;
+                      } else {
+                        ZZLOG;
+                      }
+                    }{ZZLOG;}
+#line 14889 "parser.tab.c"
+  if (!yytrial)
+#line 1955 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, exprAtom(yyvsp[0].str), kNone);              }
+#line 14893 "parser.tab.c"
+break;
+case 538:
+#line 1956 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14898 "parser.tab.c"
+  if (!yytrial)
+#line 1956 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-1].cppExprObj, CppExpr::kInitializer);        }
+#line 14902 "parser.tab.c"
+break;
+case 539:
+#line 1957 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14907 "parser.tab.c"
+  if (!yytrial)
+#line 1957 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, CppExpr::kInitializer);        }
+#line 14911 "parser.tab.c"
+break;
+case 540:
+#line 1958 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14916 "parser.tab.c"
+  if (!yytrial)
+#line 1958 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-1].cppExprObj, CppExpr::kInitializer);        }
+#line 14920 "parser.tab.c"
+break;
+case 541:
+#line 1959 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14925 "parser.tab.c"
+  if (!yytrial)
+#line 1959 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, CppExpr::kInitializer);        }
+#line 14929 "parser.tab.c"
+break;
+case 542:
+#line 1960 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14934 "parser.tab.c"
+  if (!yytrial)
+#line 1960 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, (CppExpr*)nullptr, CppExpr::kInitializer);   }
+#line 14938 "parser.tab.c"
+break;
+case 543:
+#line 1961 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14943 "parser.tab.c"
+  if (!yytrial)
+#line 1961 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[0].cppExprObj, kUnaryMinus);                  }
+#line 14947 "parser.tab.c"
+break;
+case 544:
+#line 1962 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14952 "parser.tab.c"
+  if (!yytrial)
+#line 1962 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[0].cppExprObj, kBitToggle);                   }
+#line 14956 "parser.tab.c"
+break;
+case 545:
+#line 1963 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14961 "parser.tab.c"
+  if (!yytrial)
+#line 1963 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[0].cppExprObj, kLogNot);                      }
+#line 14965 "parser.tab.c"
+break;
+case 546:
+#line 1964 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14970 "parser.tab.c"
+  if (!yytrial)
+#line 1964 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[0].cppExprObj, kDerefer);                     }
+#line 14974 "parser.tab.c"
+break;
+case 547:
+#line 1965 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14979 "parser.tab.c"
+  if (!yytrial)
+#line 1965 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[0].cppExprObj, kRefer);                       }
+#line 14983 "parser.tab.c"
+break;
+case 548:
+#line 1966 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14988 "parser.tab.c"
+  if (!yytrial)
+#line 1966 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, exprAtom(yyvsp[0].str), kRefer);             }
+#line 14992 "parser.tab.c"
+break;
+case 549:
+#line 1967 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 14997 "parser.tab.c"
+  if (!yytrial)
+#line 1967 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[0].cppExprObj, kPreIncrement);                }
+#line 15001 "parser.tab.c"
+break;
+case 550:
+#line 1968 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15006 "parser.tab.c"
+  if (!yytrial)
+#line 1968 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-1].cppExprObj, kPostIncrement);               }
+#line 15010 "parser.tab.c"
+break;
+case 551:
+#line 1969 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15015 "parser.tab.c"
+  if (!yytrial)
+#line 1969 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[0].cppExprObj, kPreDecrement);                }
+#line 15019 "parser.tab.c"
+break;
+case 552:
+#line 1970 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15024 "parser.tab.c"
+  if (!yytrial)
+#line 1970 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-1].cppExprObj, kPostDecrement);               }
+#line 15028 "parser.tab.c"
+break;
+case 553:
+#line 1971 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15033 "parser.tab.c"
+  if (!yytrial)
+#line 1971 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kPlus, yyvsp[0].cppExprObj);                    }
+#line 15037 "parser.tab.c"
+break;
+case 554:
+#line 1972 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15042 "parser.tab.c"
+  if (!yytrial)
+#line 1972 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kMinus, yyvsp[0].cppExprObj);                   }
+#line 15046 "parser.tab.c"
+break;
+case 555:
+#line 1974 "/root/repo/src/parser.y"
+{
+                      if (yyvsp[-1].str.sz == yyparam->paramModPos) {
+                        yyparam->paramModPos = nullptr;
+                        ZZERROR;
+                      } else {
+                        ZZLOG;
+                      }
+                    }{ZZLOG;}
+#line 15058 "parser.tab.c"
+  if (!yytrial)
+#line 1981 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kMul, yyvsp[0].cppExprObj);                     }
+#line 15062 "parser.tab.c"
+break;
+case 556:
+#line 1982 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15067 "parser.tab.c"
+  if (!yytrial)
+#line 1982 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kDiv, yyvsp[0].cppExprObj);                     }
+#line 15071 "parser.tab.c"
+break;
+case 557:
+#line 1983 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15076 "parser.tab.c"
+  if (!yytrial)
+#line 1983 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kPercent, yyvsp[0].cppExprObj);                 }
+#line 15080 "parser.tab.c"
+break;
+case 558:
+#line 1985 "/root/repo/src/parser.y"
+{
+                      if (yyvsp[-1].str.sz == yyparam->paramModPos) {
+                        yyparam->paramModPos = nullptr;
+                        ZZERROR;
+                      } else {
+                        ZZLOG;
+                      }
+                    }{ZZLOG;}
+#line 15092 "parser.tab.c"
+  if (!yytrial)
+#line 1992 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kBitAnd, yyvsp[0].cppExprObj);                  }
+#line 15096 "parser.tab.c"
+break;
+case 559:
+#line 1993 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15101 "parser.tab.c"
+  if (!yytrial)
+#line 1993 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kBitOr, yyvsp[0].cppExprObj);                   }
+#line 15105 "parser.tab.c"
+break;
+case 560:
+#line 1994 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15110 "parser.tab.c"
+  if (!yytrial)
+#line 1994 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kXor, yyvsp[0].cppExprObj);                     }
+#line 15114 "parser.tab.c"
+break;
+case 561:
+#line 1995 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15119 "parser.tab.c"
+  if (!yytrial)
+#line 1995 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kEqual, yyvsp[0].cppExprObj);                   }
+#line 15123 "parser.tab.c"
+break;
+case 562:
+#line 1996 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15128 "parser.tab.c"
+  if (!yytrial)
+#line 1996 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kLess, yyvsp[0].cppExprObj);                    }
+#line 15132 "parser.tab.c"
+break;
+case 563:
+#line 1997 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15137 "parser.tab.c"
+  if (!yytrial)
+#line 1997 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kGreater, yyvsp[0].cppExprObj);                 }
+#line 15141 "parser.tab.c"
+break;
+case 564:
+#line 1998 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15146 "parser.tab.c"
+  if (!yytrial)
+#line 1998 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-4].cppExprObj, yyvsp[-2].cppExprObj, yyvsp[0].cppExprObj);                       }
+#line 15150 "parser.tab.c"
+break;
+case 565:
+#line 1999 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15155 "parser.tab.c"
+  if (!yytrial)
+#line 1999 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kPlusEqual, yyvsp[0].cppExprObj);               }
+#line 15159 "parser.tab.c"
+break;
+case 566:
+#line 2000 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15164 "parser.tab.c"
+  if (!yytrial)
+#line 2000 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kMinusEqual, yyvsp[0].cppExprObj);              }
+#line 15168 "parser.tab.c"
+break;
+case 567:
+#line 2001 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15173 "parser.tab.c"
+  if (!yytrial)
+#line 2001 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kMulEqual, yyvsp[0].cppExprObj);                }
+#line 15177 "parser.tab.c"
+break;
+case 568:
+#line 2002 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15182 "parser.tab.c"
+  if (!yytrial)
+#line 2002 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kDivEqual, yyvsp[0].cppExprObj);                }
+#line 15186 "parser.tab.c"
+break;
+case 569:
+#line 2003 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15191 "parser.tab.c"
+  if (!yytrial)
+#line 2003 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kPerEqual, yyvsp[0].cppExprObj);                }
+#line 15195 "parser.tab.c"
+break;
+case 570:
+#line 2004 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15200 "parser.tab.c"
+  if (!yytrial)
+#line 2004 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kXorEqual, yyvsp[0].cppExprObj);                }
+#line 15204 "parser.tab.c"
+break;
+case 571:
+#line 2005 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15209 "parser.tab.c"
+  if (!yytrial)
+#line 2005 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kAndEqual, yyvsp[0].cppExprObj);                }
+#line 15213 "parser.tab.c"
+break;
+case 572:
+#line 2006 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15218 "parser.tab.c"
+  if (!yytrial)
+#line 2006 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kOrEqual, yyvsp[0].cppExprObj);                 }
+#line 15222 "parser.tab.c"
+break;
+case 573:
+#line 2007 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15227 "parser.tab.c"
+  if (!yytrial)
+#line 2007 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kLeftShift, yyvsp[0].cppExprObj);               }
+#line 15231 "parser.tab.c"
+break;
+case 574:
+#line 2008 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15236 "parser.tab.c"
+  if (!yytrial)
+#line 2008 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kRightShift, yyvsp[0].cppExprObj);              }
+#line 15240 "parser.tab.c"
+break;
+case 575:
+#line 2009 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15245 "parser.tab.c"
+  if (!yytrial)
+#line 2009 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kLShiftEqual, yyvsp[0].cppExprObj);             }
+#line 15249 "parser.tab.c"
+break;
+case 576:
+#line 2010 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15254 "parser.tab.c"
+  if (!yytrial)
+#line 2010 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kRShiftEqual, yyvsp[0].cppExprObj);             }
+#line 15258 "parser.tab.c"
+break;
+case 577:
+#line 2011 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15263 "parser.tab.c"
+  if (!yytrial)
+#line 2011 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kCmpEqual, yyvsp[0].cppExprObj);                }
+#line 15267 "parser.tab.c"
+break;
+case 578:
+#line 2012 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15272 "parser.tab.c"
+  if (!yytrial)
+#line 2012 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kNotEqual, yyvsp[0].cppExprObj);                }
+#line 15276 "parser.tab.c"
+break;
+case 579:
+#line 2013 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15281 "parser.tab.c"
+  if (!yytrial)
+#line 2013 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kLessEqual, yyvsp[0].cppExprObj);               }
+#line 15285 "parser.tab.c"
+break;
+case 580:
+#line 2014 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15290 "parser.tab.c"
+  if (!yytrial)
+#line 2014 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kGreaterEqual, yyvsp[0].cppExprObj);            }
+#line 15294 "parser.tab.c"
+break;
+case 581:
+#line 2015 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15299 "parser.tab.c"
+  if (!yytrial)
+#line 2015 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, k3WayCmp, yyvsp[0].cppExprObj);                 }
+#line 15303 "parser.tab.c"
+break;
+case 582:
+#line 2017 "/root/repo/src/parser.y"
+{
+                      if (yyvsp[-1].str.sz == yyparam->paramModPos) {
+                        yyparam->paramModPos = nullptr;
+                        ZZERROR;
+                      } else {
+                        ZZLOG;
+                      }
+                    }{ZZLOG;}
+#line 15315 "parser.tab.c"
+  if (!yytrial)
+#line 2024 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kAnd, yyvsp[0].cppExprObj);                     }
+#line 15319 "parser.tab.c"
+break;
+case 583:
+#line 2025 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15324 "parser.tab.c"
+  if (!yytrial)
+#line 2025 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kOr, yyvsp[0].cppExprObj);                      }
+#line 15328 "parser.tab.c"
+break;
+case 584:
+#line 2026 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15333 "parser.tab.c"
+  if (!yytrial)
+#line 2026 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kDot, exprAtom(yyvsp[0].str));                        }
+#line 15337 "parser.tab.c"
+break;
+case 585:
+#line 2028 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15342 "parser.tab.c"
+  if (!yytrial)
+#line 2028 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-3].cppExprObj, kDot, exprAtom(mergeCppToken(yyvsp[-1].str, yyvsp[0].str)));                        }
+#line 15346 "parser.tab.c"
+break;
+case 586:
+#line 2029 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15351 "parser.tab.c"
+  if (!yytrial)
+#line 2029 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kArrow, exprAtom(yyvsp[0].str));         }
+#line 15355 "parser.tab.c"
+break;
+case 587:
+#line 2030 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15360 "parser.tab.c"
+  if (!yytrial)
+#line 2030 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kArrowStar, exprAtom(yyvsp[0].str));     }
+#line 15364 "parser.tab.c"
+break;
+case 588:
+#line 2031 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15369 "parser.tab.c"
+  if (!yytrial)
+#line 2031 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-3].cppExprObj, kDot, exprAtom(mergeCppToken(yyvsp[-1].str, yyvsp[0].str)));                        }
+#line 15373 "parser.tab.c"
+break;
+case 589:
+#line 2032 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15378 "parser.tab.c"
+  if (!yytrial)
+#line 2032 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-3].cppExprObj, kArrow, exprAtom(mergeCppToken(yyvsp[-1].str, yyvsp[0].str)));         }
+#line 15382 "parser.tab.c"
+break;
+case 590:
+#line 2033 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15387 "parser.tab.c"
+  if (!yytrial)
+#line 2033 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-3].cppExprObj, kArrayElem, yyvsp[-1].cppExprObj);               }
+#line 15391 "parser.tab.c"
+break;
+case 591:
+#line 2034 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15396 "parser.tab.c"
+  if (!yytrial)
+#line 2034 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kArrayElem);                   }
+#line 15400 "parser.tab.c"
+break;
+case 592:
+#line 2035 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15405 "parser.tab.c"
+  if (!yytrial)
+#line 2035 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-3].cppExprObj, kFunctionCall, yyvsp[-1].cppExprObj);            }
+#line 15409 "parser.tab.c"
+break;
+case 593:
+#line 2036 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15414 "parser.tab.c"
+  if (!yytrial)
+#line 2036 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, exprAtom(yyvsp[-3].str), kFunctionCall, yyvsp[-1].cppExprObj);               }
+#line 15418 "parser.tab.c"
+break;
+case 594:
+#line 2037 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15423 "parser.tab.c"
+  if (!yytrial)
+#line 2037 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, newObj<CppExpr>(yyparam->objFactory, yyvsp[-5].cppExprObj, kArrow, exprAtom(mergeCppToken(yyvsp[-3].str, yyvsp[-2].str))), kFunctionCall, (CppExpr*)nullptr); }
+#line 15427 "parser.tab.c"
+break;
+case 595:
+#line 2039 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15432 "parser.tab.c"
+  if (!yytrial)
+#line 2039 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, newObj<CppExpr>(yyparam->objFactory, exprAtom(yyvsp[-3].str), kNone), kUniformInitCall, yyvsp[-1].cppExprObj);                }
+#line 15436 "parser.tab.c"
+break;
+case 596:
+#line 2040 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15441 "parser.tab.c"
+  if (!yytrial)
+#line 2040 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppVarType, kCStyleCast, yyvsp[0].cppExprObj);              }
+#line 15445 "parser.tab.c"
+break;
+case 597:
+#line 2041 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15450 "parser.tab.c"
+  if (!yytrial)
+#line 2041 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-4].cppVarType, kConstCast, yyvsp[-1].cppExprObj);               }
+#line 15454 "parser.tab.c"
+break;
+case 598:
+#line 2042 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15459 "parser.tab.c"
+  if (!yytrial)
+#line 2042 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-4].cppVarType, kStaticCast, yyvsp[-1].cppExprObj);              }
+#line 15463 "parser.tab.c"
+break;
+case 599:
+#line 2043 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15468 "parser.tab.c"
+  if (!yytrial)
+#line 2043 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-4].cppVarType, kDynamicCast, yyvsp[-1].cppExprObj);             }
+#line 15472 "parser.tab.c"
+break;
+case 600:
+#line 2044 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15477 "parser.tab.c"
+  if (!yytrial)
+#line 2044 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-4].cppVarType, kReinterpretCast, yyvsp[-1].cppExprObj);         }
+#line 15481 "parser.tab.c"
+break;
+case 601:
+#line 2045 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15486 "parser.tab.c"
+  if (!yytrial)
+#line 2045 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[-1].cppExprObj; yyvsp[-1].cppExprObj->flags_ |= CppExpr::kBracketed;         }
+#line 15490 "parser.tab.c"
+break;
+case 602:
+#line 2046 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15495 "parser.tab.c"
+  if (!yytrial)
+#line 2046 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, exprAtom(yyvsp[-1].str), CppExpr::kNew);      }
+#line 15499 "parser.tab.c"
+break;
+case 603:
+#line 2047 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15504 "parser.tab.c"
+  if (!yytrial)
+#line 2047 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[0].cppExprObj, CppExpr::kNew);  }
+#line 15508 "parser.tab.c"
+break;
+case 604:
+#line 2048 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15513 "parser.tab.c"
+  if (!yytrial)
+#line 2048 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kPlacementNew, yyvsp[0].cppExprObj);            }
+#line 15517 "parser.tab.c"
+break;
+case 605:
+#line 2049 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15522 "parser.tab.c"
+  if (!yytrial)
+#line 2049 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kPlacementNew, yyvsp[0].cppExprObj);            }
+#line 15526 "parser.tab.c"
+break;
+case 606:
+#line 2050 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15531 "parser.tab.c"
+  if (!yytrial)
+#line 2050 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; yyvsp[0].cppExprObj->flags_ |= CppExpr::kDelete;            }
+#line 15535 "parser.tab.c"
+break;
+case 607:
+#line 2051 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15540 "parser.tab.c"
+  if (!yytrial)
+#line 2051 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; yyvsp[0].cppExprObj->flags_ |= CppExpr::kDeleteArray;       }
+#line 15544 "parser.tab.c"
+break;
+case 608:
+#line 2052 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15549 "parser.tab.c"
+  if (!yytrial)
+#line 2052 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; yyvsp[0].cppExprObj->flags_ |= CppExpr::kReturn;            }
+#line 15553 "parser.tab.c"
+break;
+case 609:
+#line 2053 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15558 "parser.tab.c"
+  if (!yytrial)
+#line 2053 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, CppExprAtom(), CppExpr::kReturn);  }
+#line 15562 "parser.tab.c"
+break;
+case 610:
+#line 2054 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15567 "parser.tab.c"
+  if (!yytrial)
+#line 2054 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; yyvsp[0].cppExprObj->flags_ |= CppExpr::kThrow;             }
+#line 15571 "parser.tab.c"
+break;
+case 611:
+#line 2055 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15576 "parser.tab.c"
+  if (!yytrial)
+#line 2055 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, CppExprAtom(), CppExpr::kThrow);   }
+#line 15580 "parser.tab.c"
+break;
+case 612:
+#line 2056 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15585 "parser.tab.c"
+  if (!yytrial)
+#line 2056 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-1].cppVarType, CppExpr::kSizeOf);             }
+#line 15589 "parser.tab.c"
+break;
+case 613:
+#line 2057 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15594 "parser.tab.c"
+  if (!yytrial)
+#line 2057 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-1].cppExprObj, CppExpr::kSizeOf);             }
+#line 15598 "parser.tab.c"
+break;
+case 614:
+#line 2058 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15603 "parser.tab.c"
+  if (!yytrial)
+#line 2058 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-1].cppVarType, CppExpr::kSizeOf | CppExpr::kVariadicPack);             }
+#line 15607 "parser.tab.c"
+break;
+case 615:
+#line 2059 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15612 "parser.tab.c"
+  if (!yytrial)
+#line 2059 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-1].cppExprObj, CppExpr::kSizeOf | CppExpr::kVariadicPack);             }
+#line 15616 "parser.tab.c"
+break;
+case 616:
+#line 2060 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15621 "parser.tab.c"
+  if (!yytrial)
+#line 2060 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[-1].cppExprObj; yyval.cppExprObj->flags_ |= CppExpr::kVariadicPack;      }
+#line 15625 "parser.tab.c"
+break;
+case 617:
+#line 2061 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15630 "parser.tab.c"
+  if (!yytrial)
+#line 2061 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[0].cppLambda);                               }
+#line 15634 "parser.tab.c"
+break;
+case 618:
+#line 2062 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15639 "parser.tab.c"
+  if (!yytrial)
+#line 2062 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, exprAtom(yyvsp[0].str), CppExpr::kGoto);                   }
+#line 15643 "parser.tab.c"
+break;
+case 619:
+#line 2065 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15648 "parser.tab.c"
+  if (!yytrial)
+#line 2065 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, exprAtom(yyvsp[-1].str), kNone);              }
+#line 15652 "parser.tab.c"
+break;
+case 620:
+#line 2068 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15657 "parser.tab.c"
+  if (!yytrial)
+#line 2068 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[-2].cppExprObj; delete yyvsp[-1].cppExprObj; }
+#line 15661 "parser.tab.c"
+break;
+case 621:
+#line 2069 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15666 "parser.tab.c"
+  if (!yytrial)
+#line 2069 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[-2].cppExprObj; delete yyvsp[-1].cppExprObj; }
+#line 15670 "parser.tab.c"
+break;
+case 622:
+  if (!yytrial)
+#line 2072 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; }
+#line 15676 "parser.tab.c"
+break;
+case 623:
+  if (!yytrial)
+#line 2075 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; }
+#line 15682 "parser.tab.c"
+break;
+case 624:
+  if (!yytrial)
+#line 2076 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[-1].cppExprObj; delete yyvsp[0].cppExprObj; }
+#line 15688 "parser.tab.c"
+break;
+case 625:
+#line 2079 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15693 "parser.tab.c"
+  if (!yytrial)
+#line 2079 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kComma, yyvsp[0].cppExprObj);                   }
+#line 15697 "parser.tab.c"
+break;
+case 626:
+#line 2080 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15702 "parser.tab.c"
+  if (!yytrial)
+#line 2080 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, yyvsp[-2].cppExprObj, kComma, yyvsp[0].cppExprObj);                   }
+#line 15706 "parser.tab.c"
+break;
+case 627:
+#line 2081 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15711 "parser.tab.c"
+  if (!yytrial)
+#line 2081 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; }
+#line 15715 "parser.tab.c"
+break;
+case 628:
+#line 2084 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15720 "parser.tab.c"
+  if (!yytrial)
+#line 2084 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; }
+#line 15724 "parser.tab.c"
+break;
+case 629:
+#line 2085 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15729 "parser.tab.c"
+  if (!yytrial)
+#line 2085 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; }
+#line 15733 "parser.tab.c"
+break;
+case 630:
+#line 2086 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15738 "parser.tab.c"
+  if (!yytrial)
+#line 2086 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj; }
+#line 15742 "parser.tab.c"
+break;
+case 631:
+#line 2089 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15747 "parser.tab.c"
+  if (!yytrial)
+#line 2089 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = nullptr; }
+#line 15751 "parser.tab.c"
+break;
+case 632:
+#line 2090 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15756 "parser.tab.c"
+  if (!yytrial)
+#line 2090 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[0].cppExprObj;      }
+#line 15760 "parser.tab.c"
+break;
+case 633:
+#line 2093 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15765 "parser.tab.c"
+  if (!yytrial)
+#line 2093 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, "", kRefer); }
+#line 15769 "parser.tab.c"
+break;
+case 634:
+#line 2096 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15774 "parser.tab.c"
+  if (!yytrial)
+#line 2096 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = newObj<CppExpr>(yyparam->objFactory, "", kEqual, ""); }
+#line 15778 "parser.tab.c"
+break;
+case 635:
+#line 2099 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15783 "parser.tab.c"
+break;
+case 636:
+#line 2100 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15788 "parser.tab.c"
+break;
+case 637:
+#line 2101 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15793 "parser.tab.c"
+break;
+case 638:
+#line 2104 "/root/repo/src/parser.y"
+{ZZLOG;}
+#line 15798 "parser.tab.c"
+  if (!yytrial)
+#line 2104 "/root/repo/src/parser.y"
+{ yyval.cppExprObj = yyvsp[-1].cppExprObj; }
+#line 15802 "parser.tab.c"
+break;
+#line 15804 "parser.tab.c"
+#line 1079 "btyaccpa.ske"
+
+  default:
+    break;
+  }
+
+#if YYDEBUG && defined(YYDBPR)
+  if (yydebug) {
+    printf("yydebug[%d]: after reduction, result is ", yytrial!=0);
+    YYDBPR(yyps->val);
+    printf("\n");
+  }
+#endif
+
+#ifdef YYPOSN
+  /* Perform user-defined position reduction */
+#ifdef YYREDUCEPOSNFUNC
+  if(!yytrial) {
+    YYCALLREDUCEPOSN(YYREDUCEPOSNFUNCARG);
+  }
+#endif
+#endif /* YYPOSN */
+
+  yyps->ssp -= yym;
+  yystate = *(yyps->ssp);
+  yyps->vsp -= yym;
+#ifdef YYPOSN
+  yyps->psp -= yym;
+#endif /* YYPOSN */
+
+  yym = yylhs[yyn];
+  if (yystate == 0 && yym == 0) {
+#if YYDEBUG
+    if (yydebug) {
+      printf("yydebug[%d,%d]: after reduction, shifting from state 0 to state "
+	     "%d\n", (int)yydepth, yytrial!=0, YYFINAL);
+    }
+#endif
+    yystate = YYFINAL;
+    YYTRAILTOP();
+    *++(yyps->ssp) = YYFINAL;
+    *++(yyps->vsp) = yyps->val;
+    yyretlval = yyps->val;  /* return value of root non-terminal to yylval */
+#ifdef YYPOSN
+    *++(yyps->psp) = yyps->pos;
+    yyretposn = yyps->pos;  /* return value of root position to yyposn */
+#endif /* YYPOSN */
+    if (yychar < 0) {
+      if ((yychar = YYLex1(yyctx)) < 0) {
+        yychar = 0;
+      }
+#if YYDEBUG
+      if (yydebug) {
+        yys = 0;
+        if (yychar <= YYMAXTOKEN) yys = yyname[yychar];
+        if (!yys) yys = "illegal-symbol";
+        printf("yydebug[%d,%d]: state %d, reading %d (%s)\n", 
+	       (int)yydepth, yytrial!=0, YYFINAL, yychar, yys); 
+      }
+#endif
+    }
+    if (yychar == 0) goto yyaccept;
+    goto yyloop;
+  }
+
+  if ((yyn = yygindex[yym]) && (yyn += yystate) >= 0 &&
+      yyn <= YYTABLESIZE && yycheck[yyn] == yystate) {
+    yystate = yytable[yyn];
+  } else {
+    yystate = yydgoto[yym];
+  }
+#if YYDEBUG
+  if (yydebug)
+    printf("yydebug[%d,%d]: after reduction, shifting from state %d to state "
+	   "%d\n", (int)yydepth, yytrial!=0, *(yyps->ssp), yystate);
+#endif
+  if (yyps->ssp >= yyps->ss + yyps->stacksize - 1) {
+    YYMoreStack(yyps);
+  }
+  YYTRAILTOP();
+  *++(yyps->ssp) = yystate;
+  *++(yyps->vsp) = yyps->val;
+#ifdef YYPOSN
+  *++(yyps->psp) = yyps->pos;
+#endif /* YYPOSN */
+  goto yyloop;
+
+
+  /*
+  ** Reduction declares that this path is valid.
+  ** Set yypath and do a full parse
+  */
+yyvalid:
+  if (yypath) {
+    goto yyabort;
+  }
+  while (yyps->save) {
+    struct yyparsestate *save = yyps->save;
+    yyps->save = save->save;
+    save->save = yypath;
+    yypath = save;
+  }
+#if YYDEBUG
+  if (yydebug)
+    printf("yydebug[%d,%d]: CONFLICT trial successful, backtracking to state "
+	   "%d, %d tokens\n", (int)yydepth, yytrial!=0, yypath->state,
+	   (int)(yylvp - yylvals - yypath->lexeme));
+#endif
+  if(yyerrctx) {
+    YYFreeState(yyctx, yyerrctx); yyerrctx = NULL;
+  }
+  yychar = -1;
+  yylexp = yylexemes + yypath->lexeme;
+  yylvp = yylvals + yypath->lexeme;
+#ifdef YYPOSN
+  yylpp = yylpsns + yypath->lexeme;
+#endif /* YYPOSN */
+  /* First state on the path is the outermost one, no trial is left after restoring it */
+  YYRestoreState(yyctx, yypath);
+  yyctx->untouched = yypath->outer;
+  yystate = yypath->state;
+  goto yyloop;
+
+yyabort:
+  if(yyerrctx) {
+    YYFreeState(yyctx, yyerrctx); yyerrctx = NULL;
+  }
+
+  {
+    YYSTYPE *pv;
+#ifdef YYPOSN
+    YYPOSN *pp = yyps->ps;
+#endif
+#ifdef YYDESTRUCT
+    Yshort *ps = yyps->ss;
+#endif
+    for(pv=yyps->vs; pv<yyps->vsp; pv++) {
+      YYDELETEVAL(*pv,2);
+#if defined(YYDESTRUCT)
+      YYDESTRUCT(yytrial!=0, yyastable[*ps++], pv, pp++);
+#endif /* YYDESTRUCT */
+    }
+#ifdef YYPOSN
+    for(pp=yyps->ps; pp<yyps->psp; pp++) {
+      YYDELETEPOSN(*pp,2);
+    }
+#endif /* YYPOSN */
+  }
+
+  /* Main state goes last to the free list, so the next parse starts with its big stacks */
+  while (yypath) {
+    struct yyparsestate *save = yypath;
+    yypath = save->save;
+    YYFreeState(yyctx, save); 
+  }
+  while (yyps) {
+    struct yyparsestate *save = yyps;
+    yyps = save->save;
+    YYFreeState(yyctx, save);
+  }
+  return (1);
+
+
+yyaccept:
+  if (yyps->save) goto yyvalid;
+  if(yyerrctx) {
+    YYFreeState(yyctx, yyerrctx); yyerrctx = NULL;
+  }
+  /* Main state goes last to the free list, so the next parse starts with its big stacks */
+  while (yypath) {
+    struct yyparsestate *save = yypath;
+    yypath = save->save;
+    YYFreeState(yyctx, save); 
+  }
+  while (yyps) {
+    struct yyparsestate *save = yyps;
+    yyps = save->save;
+    YYFreeState(yyctx, save);
+  }
+  return (0);
+}
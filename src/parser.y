@@ -39,12 +39,15 @@
 #include "cppast.h"
 #include "cppvarinit.h"
 #include "parser.tab.h"
+#include "parser.h"
 #include "parser.l.h"
 #include "cppobjfactory.h"
 #include "obj-factory-helper.h"
+#include "parse-value-owner.h"
 #include "utils.h"
 
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <map>
 #include <stack>
@@ -65,6 +68,32 @@ int GetKeywordId(const std::string& keyword) {
   return (itr != keywordToIdMap.end()) ? itr->second : -1;
 }
 
+// Makes atom of an expression without an intermediate std::string.
+static CppExprAtom exprAtom(const CppToken& token)
+{
+  return CppExprAtom(token.sz, token.len);
+}
+
+static void addEnumItem(CppEnumItemList* itemList, const CppNtEnumItem& item)
+{
+  if (item.name.sz)
+    itemList->emplace_back((std::string) item.name, static_cast<CppExpr*>(item.val));
+  else
+    itemList->emplace_back(item.val);
+}
+
+static void addTemplateParam(CppTemplateParamList* paramList, const CppNtTemplateParam& param)
+{
+  if (param.paramType == nullptr)
+    paramList->emplace_back((std::string) param.paramName);
+  else if (param.paramType->objType_ == CppVarType::kObjectType)
+    paramList->emplace_back(static_cast<CppVarType*>(param.paramType), (std::string) param.paramName);
+  else
+    paramList->emplace_back(static_cast<CppFunctionPointer*>(param.paramType), (std::string) param.paramName);
+  if (param.defaultArg)
+    paramList->back().defaultArg(param.defaultArg);
+}
+
 #ifndef NDEBUG
 #  define YYDEBUG 1
 #else 
@@ -80,80 +109,135 @@ int GetKeywordId(const std::string& keyword) {
 #  define TRUE true
 #endif
 
-static int gParseLog = 0;
-
 #define ZZLOG               \
   {                         \
-  if (gParseLog)                 \
-    printf("ZZLOG @line#%d, parsing stream line#%d\n", __LINE__, g.mLineNo); \
+  if (yyparam->parseLog)                 \
+    printf("ZZLOG @line#%d, parsing stream line#%d\n", __LINE__, yyparam->lexer.mLineIndex.lineNumber(*yyparam->lexer.mTokenPosition)); \
 }
 
-static int gDisableYyValid = 0;
-
 #define ZZVALID   {         \
-  if (gParseLog)                 \
+  if (yyparam->parseLog)                 \
     printf("ZZVALID: ");    \
   ZZLOG;                    \
-  if (!gDisableYyValid)     \
+  if (!yyparam->disableYyValid)     \
     YYVALID;                \
   }
 
 #define ZZERROR             \
   do {                      \
-    if (gParseLog)               \
+    if (yyparam->parseLog)               \
       printf("ZZERROR: ");  \
     ZZLOG;                  \
     YYERROR;                \
   } while(0)
 
 #define ZZVALID_DISABLE     \
-  ++gDisableYyValid;
+  ++yyparam->disableYyValid;
 
 #define ZZVALID_ENABLE      \
-  --gDisableYyValid;
-
-
-/** {Globals} */
-/**
- * A program unit is the entire parse tree of a source/header file
- */
-static CppCompound*  gProgUnit;
-
-// FuncdeclHack:
-// Following gets parsed as variable with initialization:
-// Type Identifier(Type * Id);
-// `Type * Id` gets parsed as expression involving multiplication and so `Identifier`
-//  followed by expression in brackets becomes a call to constructor of `Type`.
-// Actually there is an ambiguity in the grammer which compilers solve by using context.
-// For purpose of this parser we cannot collect all required context to solve this ambiguity.
-// So, we use a hack:
-// We define a production rule for this case and flag it as error. But before flagging error
-// we save the position of operator '*' (or '&', or "&&") and then we check for location of
-// the same operator in other expression production rule before accepting that as valid expression.
-// For us we always want to parse it as function declaration rather than call to constructor by passing an expression,
-// and so the hack is expected to serve us well.
-static const char* gParamModPos = nullptr;
-
-// TemplateParamHack:
-// Template parameter gets parsed as vardecl which then gets reduced as templateparam without name as used in forward declaration.
-// We don't want that, so to avoid such templateparam getting reduced as vardecl we apply some hack.
-static const char* gTemplateParamStart = nullptr;
-static bool gInTemplateSpec = false;
+  --yyparam->disableYyValid;
 
 /**
  * A stack to know where (i.e. how deep inside class defnition) the current parsing activity is taking place.
  */
 using CppCompoundStack = std::stack<CppToken>;
 
-static CppCompoundStack             gCompoundStack;
-static CppAccessType                gCurAccessType;
-static std::stack<CppAccessType>    gAccessTypeStack;
+enum class ParseStatus {
+  NotAvailable,
+  Success,
+  Failure
+};
+
+static void configureLexer(LexerData& lexer, const ParserConfig& config)
+{
+  lexer.mConfig          = &config;
+  lexer.mIgnoreComments  = config.ignoreComments;
+  lexer.mTokenizeComment = !config.ignoreComments;
+}
+
+/**
+ * State of one parse, reachable from actions as yyparam.
+ * Nothing here is shared between parses and so different threads can parse at the same time.
+ */
+struct ParserState
+{
+  ParserState(const ParserConfig& parserConfig, const CppObjFactory& parserObjFactory)
+    : config(parserConfig)
+    , objFactory(parserObjFactory)
+  {
+    configureLexer(lexer, config);
+  }
 
-/** {End of Globals} */
+  const ParserConfig&  config;
+  const CppObjFactory& objFactory;
+
+  LexerData lexer;
+  void*     scanner = nullptr;
+
+  int parseLog       = 0;
+  int disableYyValid = 0;
+
+  /**
+   * A program unit is the entire parse tree of a source/header file
+   */
+  CppCompound* progUnit = nullptr;
+
+  // FuncdeclHack:
+  // Following gets parsed as variable with initialization:
+  // Type Identifier(Type * Id);
+  // `Type * Id` gets parsed as expression involving multiplication and so `Identifier`
+  //  followed by expression in brackets becomes a call to constructor of `Type`.
+  // Actually there is an ambiguity in the grammer which compilers solve by using context.
+  // For purpose of this parser we cannot collect all required context to solve this ambiguity.
+  // So, we use a hack:
+  // We define a production rule for this case and flag it as error. But before flagging error
+  // we save the position of operator '*' (or '&', or "&&") and then we check for location of
+  // the same operator in other expression production rule before accepting that as valid expression.
+  // For us we always want to parse it as function declaration rather than call to constructor by passing an expression,
+  // and so the hack is expected to serve us well.
+  const char* paramModPos = nullptr;
+
+  // TemplateParamHack:
+  // Template parameter gets parsed as vardecl which then gets reduced as templateparam without name as used in forward declaration.
+  // We don't want that, so to avoid such templateparam getting reduced as vardecl we apply some hack.
+  const char* templateParamStart = nullptr;
+  bool        inTemplateSpec     = false;
+
+  CppCompoundStack          compoundStack;
+  CppAccessType             curAccessType = CppAccessType::kUnknown;
+  std::stack<CppAccessType> accessTypeStack;
+
+  ParseStatus parseStatus = ParseStatus::NotAvailable;
+
+  ParseValueOwner stackValues;
+
+  // When true verbatim text in AST refers to input buffer instead of owning a copy.
+  // Text having CRLF line ends is still copied, so that it is the same as that of source with LF line ends.
+  bool textRefersToInput = false;
+
+  CppSourceText sourceText(const CppToken& token) const
+  {
+    if (textRefersToInput && !token.hasCarriageReturn())
+      return CppSourceText::referTo(std::string_view(token.sz, token.len));
+    return token.toString();
+  }
+};
 
 #define YYPOSN char*
+#define YYPARSE_PARAM_TYPE ParserState*
+#define YYLEX yylex(yyparam->scanner)
 
-extern int yylex();
+// yydestruct() is not given the parser state, so it reaches owner of stack values of current parse through this.
+static thread_local ParseValueOwner* gStackValueOwner = nullptr;
+
+static void trackStackValues(const Yshort* rhsStates, YYSTYPE* rhsValues, int numRhs, int rule, YYSTYPE* lhsValue);
+
+// Position reduction hook is called only for non-trial reductions, so it is where ownership of values changes.
+#define YYREDUCEPOSNFUNC(pos, psp, vsp, len, depth, ch, posn, val) \
+  trackStackValues(yyps->ssp + 1 - (len), vsp, len, yyn, &(val))
+#define YYREDUCEPOSNFUNCARG yyps->val
+
+extern int yylex(void* yyscanner);
 
 // Yacc generated code causes warnings that need suppression.
 // This pragma should be at the end.
@@ -173,7 +257,7 @@ extern int yylex();
   CppVarType*             cppVarType;
   CppVar*                 cppVarObj;
   CppEnum*                cppEnum;
-  CppEnumItem*            enumItem;
+  CppNtEnumItem           enumItem;
   CppEnumItemList*        enumItemList;
   CppTypedefName*         typedefName;
   CppTypedefList*         typedefList;
@@ -181,7 +265,7 @@ extern int yylex();
   CppUsingNamespaceDecl*  usingNamespaceDecl;
   CppNamespaceAlias*      namespaceAlias;
   CppCompound*            cppCompundObj;
-  CppTemplateParam*       templateParam;
+  CppNtTemplateParam      templateParam;
   CppTemplateParamList*   templateParamList;
   CppDocComment*          docCommentObj;
   CppFwdClsDecl*          fwdDeclObj;
@@ -354,6 +438,27 @@ extern int yylex();
 
 %type  <label>              label
 
+// Values that a failed parse leaves on stack are owned by nothing else, see ParseValueOwner.
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <cppObj> <cppVarType> <cppVarObj> <cppEnum>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <enumItemList> <typedefName> <typedefList> <usingDecl>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <usingNamespaceDecl> <namespaceAlias> <cppCompundObj>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <templateParamList> <docCommentObj>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <fwdDeclObj> <cppVarObjList> <unRecogPreProObj>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <cppExprObj> <cppLambda> <cppFuncObj> <cppFuncPointerObj>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <varOrFuncPtr> <paramList> <cppCtorObj> <cppDtorObj>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <cppTypeConverter> <inheritList> <identifierList>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <funcThrowSpec> <asmBlock> <attribSpecifier>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <attribSpecifiers> <ifBlock> <whileBlock> <doWhileBlock>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <forBlock> <forRangeBlock> <switchBlock> <switchBody>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <tryBlock> <catchBlock> <hashDefine> <hashUndef>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <hashInclude> <hashImport> <hashIf> <hashError>
+%destructor { if (!trial) gStackValueOwner->onValue($$); } <hashWarning> <hashPragma> <blob> <label> <memInitList>
+%destructor { if (!trial) gStackValueOwner->onValue($$.assignValue_); } <cppVarAssign>
+%destructor { if (!trial) gStackValueOwner->onValue($$.init); } <memInit>
+%destructor { if (!trial) gStackValueOwner->onValue($$.paramList); } <funcDeclData>
+%destructor { if (!trial) gStackValueOwner->onValue($$.val); } <enumItem>
+%destructor { if (!trial) { gStackValueOwner->onValue($$.paramType); gStackValueOwner->onValue($$.defaultArg); } } <templateParam>
+
 // precedence as mentioned at https://en.cppreference.com/w/cpp/language/operator_precedence
 %left COMMA
 // &=, ^=, |=, <<=, >>=, *=, /=, %=, +=, -=, =, throw, a?b:c
@@ -419,9 +524,9 @@ CTORDECL and DTORDECL solve this problem by giving constructor and destructor de
 
 /* A program unit is a source file, be it header file or implementation file */
 progunit          : optstmtlist [ZZLOG;] {
-                    gProgUnit = $$ = $1;
-                    if (gProgUnit)
-                      gProgUnit->compoundType(CppCompoundType::kCppFile);
+                    // A file without any statement, e.g. one that has only comments which are ignored, is still a file.
+                    yyparam->progUnit = $$ = $1 ? $1 : newCompound(yyparam->objFactory, CppAccessType::kUnknown);
+                    yyparam->progUnit->compoundType(CppCompoundType::kCppFile);
                   }
                   ;
 
@@ -434,20 +539,20 @@ optstmtlist       : [ZZLOG;] {
                   ;
 
 stmtlist          : stmt [ZZLOG;] {
-                    $$ = newCompound(gAccessTypeStack.empty() ? gCurAccessType : gAccessTypeStack.top());
+                    $$ = newCompound(yyparam->objFactory, yyparam->accessTypeStack.empty() ? yyparam->curAccessType : yyparam->accessTypeStack.top());
                     if ($1)
                     {
                       $$->addMember($1);
                     } // Avoid 'comment-btyacc-constructs.sh' to act on this
                   }
                   | stmtlist stmt [ZZLOG;] {
-                    $$ = ($1 == 0) ? newCompound(gAccessTypeStack.empty() ? gCurAccessType : gAccessTypeStack.top()) : $1;
+                    $$ = ($1 == 0) ? newCompound(yyparam->objFactory, yyparam->accessTypeStack.empty() ? yyparam->curAccessType : yyparam->accessTypeStack.top()) : $1;
                     if ($2)
                     {
                       $$->addMember($2);
                     } // Avoid 'comment-btyacc-constructs.sh' to act on this
                   }
-                  | optstmtlist changeprotlevel [ZZLOG;] { $$ = $1; gCurAccessType = $2; } // Change of protection level is not a statement but this way it is easier to implement.
+                  | optstmtlist changeprotlevel [ZZLOG;] { $$ = $1; yyparam->curAccessType = $2; } // Change of protection level is not a statement but this way it is easier to implement.
                   ;
 
 stmt              : vardeclstmt         [ZZLOG;] { $$ = $1; }
@@ -483,16 +588,16 @@ stmt              : vardeclstmt         [ZZLOG;] { $$ = $1; }
                   | usingdecl           [ZZLOG;] { $$ = $1; }
                   | usingnamespacedecl  [ZZLOG;] { $$ = $1; }
                   | namespacealias      [ZZLOG;] { $$ = $1; }
-                  | macrocall           [ZZLOG;] { $$ = new CppMacroCall($1, gCurAccessType); }
-                  | macrocall ';'       [ZZLOG;] { $$ = new CppMacroCall(mergeCppToken($1, $2), gCurAccessType); }
-                  | apidecortokensq macrocall [ZZLOG;] { $$ = new CppMacroCall(mergeCppToken($1, $2), gCurAccessType); }
+                  | macrocall           [ZZLOG;] { $$ = newObj<CppMacroCall>(yyparam->objFactory, yyparam->sourceText($1), yyparam->curAccessType); }
+                  | macrocall ';'       [ZZLOG;] { $$ = newObj<CppMacroCall>(yyparam->objFactory, yyparam->sourceText(mergeCppToken($1, $2)), yyparam->curAccessType); }
+                  | apidecortokensq macrocall [ZZLOG;] { $$ = newObj<CppMacroCall>(yyparam->objFactory, yyparam->sourceText(mergeCppToken($1, $2)), yyparam->curAccessType); }
                   | ';'                 [ZZLOG;] { $$ = nullptr; }  /* blank statement */
                   | asmblock            [ZZLOG;] { $$ = $1; }
                   | blob                [ZZLOG;] { $$ = $1; }
                   | label               [ZZLOG;] { $$ = $1; }
                   ;
 
-label             : name ':'            [ZZLOG;] { $$ = new CppLabel($1); }
+label             : name ':'            [ZZLOG;] { $$ = newObj<CppLabel>(yyparam->objFactory, $1); }
                   ;
 
 preprocessor      : define              [ZZLOG;] { $$ = $1; }
@@ -505,7 +610,7 @@ preprocessor      : define              [ZZLOG;] { $$ = $1; }
                   | pragma              [ZZLOG;] { $$ = $1; }
                   ;
 
-asmblock          : tknAsm              [ZZLOG;] { $$ = new CppAsmBlock($1); }
+asmblock          : tknAsm              [ZZLOG;] { $$ = newObj<CppAsmBlock>(yyparam->objFactory, yyparam->sourceText($1)); }
                   ;
 
 macrocall         : tknMacro [ZZLOG; $$ = $1;] {}
@@ -513,12 +618,13 @@ macrocall         : tknMacro [ZZLOG; $$ = $1;] {}
                   | macrocall '(' expr ')' [
                     ZZLOG;
                     $$ = mergeCppToken($1, $4);
+                  ] {
                     delete $3;
-                  ] {}
+                  }
                   ;
 
 switchstmt        : tknSwitch '(' expr ')' '{' caselist '}' [ZZLOG;] {
-                    $$ = new CppSwitchBlock($3, $6);
+                    $$ = newObj<CppSwitchBlock>(yyparam->objFactory, $3, $6);
                   }
                   ;
 
@@ -540,20 +646,21 @@ caselist          : [ZZLOG;] {
 block             : '{' optstmtlist '}' [ZZLOG;] {
                     $$ = $2;
                     if ($$ == nullptr)
-                      $$ = newCompound(CppAccessType::kUnknown, CppCompoundType::kBlock);
+                      $$ = newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock);
                     else
                       $$->compoundType(CppCompoundType::kBlock);
                   }
                   | doccomment block [ZZLOG;] {
                     $$ = $2;
+                    delete $1;
                   }
                   ;
 
 ifblock           : tknIf '(' expr ')' stmt [ZZLOG;] {
-                    $$ = new CppIfBlock($3, $5);
+                    $$ = newObj<CppIfBlock>(yyparam->objFactory, $3, $5);
                   }
                   | tknIf '(' varinit ')' stmt [ZZLOG;] {
-                    $$ = new CppIfBlock($3, $5);
+                    $$ = newObj<CppIfBlock>(yyparam->objFactory, $3, $5);
                   }
                   | ifblock tknElse stmt [ZZLOG;] {
                     $$ = $1;
@@ -562,36 +669,36 @@ ifblock           : tknIf '(' expr ')' stmt [ZZLOG;] {
                   ;
 
 whileblock        : tknWhile '(' expr ')' stmt [ZZLOG;] {
-                    $$ = new CppWhileBlock($3, $5);
+                    $$ = newObj<CppWhileBlock>(yyparam->objFactory, $3, $5);
                   }
                   | tknWhile '(' varinit ')' stmt [ZZLOG;] {
-                    $$ = new CppWhileBlock($3, $5);
+                    $$ = newObj<CppWhileBlock>(yyparam->objFactory, $3, $5);
                   }
                   ;
 
 dowhileblock      : tknDo stmt tknWhile '(' expr ')' [ZZLOG;] {
-                    $$ = new CppDoWhileBlock($5, $2);
+                    $$ = newObj<CppDoWhileBlock>(yyparam->objFactory, $5, $2);
                   }
                   ;
 
 forblock          : tknFor '(' optexpr ';' optexpr ';' optexpr ')' stmt [ZZLOG;] {
-                    $$ = new CppForBlock($3, $5, $7, $9);
+                    $$ = newObj<CppForBlock>(yyparam->objFactory, $3, $5, $7, $9);
                   }
                   | tknFor '(' varinit ';' optexpr ';' optexpr ')' stmt [ZZLOG;] {
-                    $$ = new CppForBlock($3, $5, $7, $9);
+                    $$ = newObj<CppForBlock>(yyparam->objFactory, $3, $5, $7, $9);
                   }
                   | tknFor '(' vardecllist ';' optexpr ';' optexpr ')' stmt [ZZLOG;] {
-                    $$ = new CppForBlock($3, $5, $7, $9);
+                    $$ = newObj<CppForBlock>(yyparam->objFactory, $3, $5, $7, $9);
                   }
                   ;
 
 forrangeblock     : tknFor '(' vardecl ':' expr ')' stmt [ZZLOG;] {
-                    $$ = new CppRangeForBlock($3, $5, $7);
+                    $$ = newObj<CppRangeForBlock>(yyparam->objFactory, $3, $5, $7);
                   }
                   ;
 
 tryblock          : tknTry block catchblock [ZZLOG;] {
-                    $$ = new CppTryBlock($2, $3);
+                    $$ = newObj<CppTryBlock>(yyparam->objFactory, $2, $3);
                   }
                   | tryblock catchblock [ZZLOG;] {
                     $$ = $1;
@@ -600,7 +707,7 @@ tryblock          : tknTry block catchblock [ZZLOG;] {
                   ;
 
 catchblock        : tknCatch '(' vartype optname ')' block [ZZLOG;] {
-                    $$ = new CppCatchBlock{CppVarTypePtr($3), $4, CppCompoundPtr($6)};
+                    $$ = newObj<CppCatchBlock>(yyparam->objFactory, CppVarTypePtr($3), $4, CppCompoundPtr($6));
                   }
                   ;
 
@@ -616,57 +723,57 @@ optexpr           : {
                   ;
 
 define            : tknPreProHash tknDefine name name          [ZZLOG;] {
-                    $$ = new CppDefine(CppDefine::kRename, $3, $4);
+                    $$ = newObj<CppDefine>(yyparam->objFactory, CppDefine::kRename, $3, yyparam->sourceText($4));
                   }
                   | tknPreProHash tknDefine name               [ZZLOG;] {
-                    $$ = new CppDefine(CppDefine::kRename, $3);
+                    $$ = newObj<CppDefine>(yyparam->objFactory, CppDefine::kRename, $3);
                   }
                   | tknPreProHash tknDefine name tknNumber     [ZZLOG;] {
-                    $$ = new CppDefine(CppDefine::kConstNumDef, $3, $4);
+                    $$ = newObj<CppDefine>(yyparam->objFactory, CppDefine::kConstNumDef, $3, yyparam->sourceText($4));
                   }
                   | tknPreProHash tknDefine name tknStrLit     [ZZLOG;] {
-                    $$ = new CppDefine(CppDefine::kConstStrDef, $3, $4);
+                    $$ = newObj<CppDefine>(yyparam->objFactory, CppDefine::kConstStrDef, $3, yyparam->sourceText($4));
                   }
                   | tknPreProHash tknDefine name tknCharLit    [ZZLOG;] {
-                    $$ = new CppDefine(CppDefine::kConstCharDef, $3, $4);
+                    $$ = newObj<CppDefine>(yyparam->objFactory, CppDefine::kConstCharDef, $3, yyparam->sourceText($4));
                   }
                   | tknPreProHash tknDefine name tknPreProDef  [ZZLOG;] {
-                    $$ = new CppDefine(CppDefine::kComplexMacro, $3, $4);
+                    $$ = newObj<CppDefine>(yyparam->objFactory, CppDefine::kComplexMacro, $3, yyparam->sourceText($4));
                   }
                   ;
 
-undef             : tknPreProHash tknUndef name                 [ZZLOG;]  { $$ = new CppUndef($3); }
+undef             : tknPreProHash tknUndef name                 [ZZLOG;]  { $$ = newObj<CppUndef>(yyparam->objFactory, $3); }
                   ;
 
-include           : tknPreProHash tknInclude tknStrLit          [ZZLOG;]  { $$ = new CppInclude((std::string) $3); }
-                  | tknPreProHash tknInclude tknStdHdrInclude   [ZZLOG;]  { $$ = new CppInclude((std::string) $3); }
+include           : tknPreProHash tknInclude tknStrLit          [ZZLOG;]  { $$ = newObj<CppInclude>(yyparam->objFactory, (std::string) $3); }
+                  | tknPreProHash tknInclude tknStdHdrInclude   [ZZLOG;]  { $$ = newObj<CppInclude>(yyparam->objFactory, (std::string) $3); }
                   ;
 
-import            : tknPreProHash tknImport tknStrLit           [ZZLOG;]  { $$ = new CppImport((std::string) $3); }
-                  | tknPreProHash tknImport tknStdHdrInclude    [ZZLOG;]  { $$ = new CppImport((std::string) $3); }
+import            : tknPreProHash tknImport tknStrLit           [ZZLOG;]  { $$ = newObj<CppImport>(yyparam->objFactory, (std::string) $3); }
+                  | tknPreProHash tknImport tknStdHdrInclude    [ZZLOG;]  { $$ = newObj<CppImport>(yyparam->objFactory, (std::string) $3); }
                   ;
 
-hashif            : tknPreProHash tknIf tknPreProDef            [ZZLOG;]  { $$ = new CppHashIf(CppHashIf::kIf,      $3); }
-                  | tknPreProHash tknIfDef name                 [ZZLOG;]  { $$ = new CppHashIf(CppHashIf::kIfDef,   $3); }
-                  | tknPreProHash tknIfNDef name                [ZZLOG;]  { $$ = new CppHashIf(CppHashIf::kIfNDef,  $3); }
-                  | tknPreProHash tknIfNDef tknApiDecor         [ZZLOG;]  { $$ = new CppHashIf(CppHashIf::kIfNDef,  $3); }
-                  | tknPreProHash tknElse                       [ZZLOG;]  { $$ = new CppHashIf(CppHashIf::kElse       ); }
-                  | tknPreProHash tknElIf  tknPreProDef         [ZZLOG;]  { $$ = new CppHashIf(CppHashIf::kElIf,    $3); }
-                  | tknPreProHash tknEndIf                      [ZZLOG;]  { $$ = new CppHashIf(CppHashIf::kEndIf      ); }
+hashif            : tknPreProHash tknIf tknPreProDef            [ZZLOG;]  { $$ = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kIf,      $3); }
+                  | tknPreProHash tknIfDef name                 [ZZLOG;]  { $$ = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kIfDef,   $3); }
+                  | tknPreProHash tknIfNDef name                [ZZLOG;]  { $$ = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kIfNDef,  $3); }
+                  | tknPreProHash tknIfNDef tknApiDecor         [ZZLOG;]  { $$ = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kIfNDef,  $3); }
+                  | tknPreProHash tknElse                       [ZZLOG;]  { $$ = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kElse       ); }
+                  | tknPreProHash tknElIf  tknPreProDef         [ZZLOG;]  { $$ = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kElIf,    $3); }
+                  | tknPreProHash tknEndIf                      [ZZLOG;]  { $$ = newObj<CppHashIf>(yyparam->objFactory, CppHashIf::kEndIf      ); }
                   ;
 
-hasherror         : tknPreProHash tknHashError                  [ZZLOG;]  { $$ = new CppHashError($2); }
-                  | tknPreProHash tknHashError strlit           [ZZLOG;]  { $$ = new CppHashError(mergeCppToken($2, $3)); }
+hasherror         : tknPreProHash tknHashError                  [ZZLOG;]  { $$ = newObj<CppHashError>(yyparam->objFactory, $2); }
+                  | tknPreProHash tknHashError strlit           [ZZLOG;]  { $$ = newObj<CppHashError>(yyparam->objFactory, mergeCppToken($2, $3)); }
                   ;
 
-hashwarning       : tknPreProHash tknHashWarning                [ZZLOG;]  { $$ = new CppHashWarning($2); }
-                  | tknPreProHash tknHashWarning strlit         [ZZLOG;]  { $$ = new CppHashWarning(mergeCppToken($2, $3)); }
+hashwarning       : tknPreProHash tknHashWarning                [ZZLOG;]  { $$ = newObj<CppHashWarning>(yyparam->objFactory, $2); }
+                  | tknPreProHash tknHashWarning strlit         [ZZLOG;]  { $$ = newObj<CppHashWarning>(yyparam->objFactory, mergeCppToken($2, $3)); }
                   ;
 
-pragma            : tknPreProHash tknPragma tknPreProDef        [ZZLOG;]  { $$ = new CppPragma($3); }
+pragma            : tknPreProHash tknPragma tknPreProDef        [ZZLOG;]  { $$ = newObj<CppPragma>(yyparam->objFactory, $3); }
                   ;
 
-doccomment        : doccommentstr                               [ZZLOG;]  { $$ = new CppDocComment((std::string) $1, gCurAccessType); }
+doccomment        : doccommentstr                               [ZZLOG;]  { $$ = newObj<CppDocComment>(yyparam->objFactory, (std::string) $1, yyparam->curAccessType); }
                   ;
 
 doccommentstr     : tknFreeStandingBlockComment                          [ZZLOG;]  { $$ = $1; }
@@ -701,7 +808,7 @@ typeidentifier    : identifier                            [ZZLOG;] { $$ = $1; }
                   | tknVoid                               [ZZLOG;] { $$ = $1; }
                   | tknEnum  identifier                   [ZZLOG;] { $$ = mergeCppToken($1, $2); }
                   | tknTypename identifier  [
-                    if (gTemplateParamStart == $1.sz)
+                    if (yyparam->templateParamStart == $1.sz)
                       ZZERROR;
                     else
                       ZZLOG;
@@ -716,12 +823,12 @@ typeidentifier    : identifier                            [ZZLOG;] { $$ = $1; }
 templidentifier   : identifier tknLT templatearglist tknGT    [ZZLOG; $$ = mergeCppToken($1, $4); ] {}
 // The following rule is needed to parse an ambiguous input as template identifier,
 // see the test "vardecl-or-expr-ambiguity".
-                  | identifier tknLT expr tknNotEq expr tknGT [ZZLOG; $$ = mergeCppToken($1, $6); ] {}
+                  | identifier tknLT expr tknNotEq expr tknGT [ZZLOG; $$ = mergeCppToken($1, $6); ] { delete $3; delete $5; }
 // The following rule is needed to parse a template identifier which otherwise fails to parse
 // because of higher precedence of tknLT and tknGT,
 // see the test "C<Class, v != 0> x;".
                   | identifier tknLT templatearglist ',' expr tknNotEq expr tknGT
-                                                              [ZZLOG; $$ = mergeCppToken($1, $8); ] {}
+                                                              [ZZLOG; $$ = mergeCppToken($1, $8); ] { delete $5; delete $7; }
                   ;
 
 templqualifiedid  : tknTemplate templidentifier               [ZZLOG; $$ = mergeCppToken($1, $2); ] {}
@@ -740,25 +847,25 @@ optidentifier     :             [ZZLOG;] { $$ = makeCppToken(nullptr, nullptr);
                   | identifier  [ZZLOG;] { $$ = $1; }
                   ;
 
-enumitem          : name            [ZZLOG;]   { $$ = new CppEnumItem($1);     }
-                  | name '=' expr   [ZZLOG;]   { $$ = new CppEnumItem($1, $3); }
-                  | doccomment      [ZZLOG;]   { $$ = new CppEnumItem($1);     }
-                  | preprocessor    [ZZLOG;]   { $$ = new CppEnumItem($1);     }
-                  | macrocall       [ZZLOG;]   { $$ = new CppEnumItem($1);     }
-                  | blob            [ZZLOG;]   { $$ = new CppEnumItem($1);     }
+enumitem          : name            [ZZLOG;]   { $$ = CppNtEnumItem{$1, nullptr};                         }
+                  | name '=' expr   [ZZLOG;]   { $$ = CppNtEnumItem{$1, $3};                              }
+                  | doccomment      [ZZLOG;]   { $$ = CppNtEnumItem{makeCppToken(nullptr, nullptr), $1}; }
+                  | preprocessor    [ZZLOG;]   { $$ = CppNtEnumItem{makeCppToken(nullptr, nullptr), $1}; }
+                  | macrocall       [ZZLOG;]   { $$ = CppNtEnumItem{$1, nullptr};                         }
+                  | blob            [ZZLOG;]   { $$ = CppNtEnumItem{makeCppToken(nullptr, nullptr), $1}; }
                   ;
 
-blob              : tknBlob      [ZZLOG;]   { $$ = new CppBlob($1);         }
+blob              : tknBlob      [ZZLOG;]   { $$ = newObj<CppBlob>(yyparam->objFactory, yyparam->sourceText($1)); }
                   ;
 
 enumitemlist      :                           [ZZLOG;] { $$ = 0; }
                   | enumitemlist enumitem     [ZZLOG;] {
                     $$ = $1 ? $1 : new CppEnumItemList;
-                    $$->push_back($2);
+                    addEnumItem($$, $2);
                   }
                   | enumitemlist ',' enumitem [ZZLOG;] {
                     $$ = $1 ? $1 : new CppEnumItemList;
-                    $$->push_back($3);
+                    addEnumItem($$, $3);
                   }
                   | enumitemlist ','          [ZZLOG;] {
                     $$ = $1;
@@ -766,25 +873,25 @@ enumitemlist      :                           [ZZLOG;] { $$ = 0; }
                   ;
 
 enumdefn          : tknEnum optname '{' enumitemlist '}'                                        [ZZVALID;] {
-                    $$ = new CppEnum(gCurAccessType, $2, $4);
+                    $$ = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, $2, $4);
                   }
                   | tknEnum optapidecor name ':' typeidentifier '{' enumitemlist '}'            [ZZVALID;] {
-                    $$ = new CppEnum(gCurAccessType, $3, $7, false, $5);
+                    $$ = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, $3, $7, false, $5);
                   };
                   | tknEnum ':' typeidentifier '{' enumitemlist '}'                           [ZZVALID;] {
-                    $$ = new CppEnum(gCurAccessType, "", $5, false, $3);
+                    $$ = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, "", $5, false, $3);
                   };
                   | tknEnum optapidecor name '{' enumitemlist '}'                               [ZZVALID;] {
-                    $$ = new CppEnum(gCurAccessType, $3, $5, false);
+                    $$ = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, $3, $5, false);
                   };
                   | tknEnum tknClass optapidecor name ':' typeidentifier '{' enumitemlist '}'   [ZZVALID;] {
-                    $$ = new CppEnum(gCurAccessType, $4, $8, true, $6);
+                    $$ = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, $4, $8, true, $6);
                   }
                   | tknEnum tknClass optapidecor name '{' enumitemlist '}'                      [ZZVALID;] {
-                    $$ = new CppEnum(gCurAccessType, $4, $6, true);
+                    $$ = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, $4, $6, true);
                   }
                   | tknTypedef tknEnum optapidecor optname '{' enumitemlist '}' name              [ZZVALID;] {
-                    $$ = new CppEnum(gCurAccessType, $8, $6);
+                    $$ = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, $8, $6);
                   }
                   ;
 
@@ -792,13 +899,13 @@ enumdefnstmt      : enumdefn ';' [ZZLOG;] { $$ = $1; }
                   ;
 
 enumfwddecl       : tknEnum name ':' typeidentifier ';'                                 [ZZVALID;] {
-                    $$ = new CppEnum(gCurAccessType, $2, nullptr, false, $4);
+                    $$ = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, $2, nullptr, false, $4);
                   }
                   | tknEnum tknClass name ':' typeidentifier ';'                        [ZZVALID;] {
-                    $$ = new CppEnum(gCurAccessType, $3, nullptr, true, $5);
+                    $$ = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, $3, nullptr, true, $5);
                   }
                   | tknEnum tknClass name ';'                                           [ZZVALID;] {
-                    $$ = new CppEnum(gCurAccessType, $3, nullptr, true);
+                    $$ = newObj<CppEnum>(yyparam->objFactory, yyparam->curAccessType, $3, nullptr, true);
                   }
                   ;
 
@@ -813,41 +920,41 @@ typedefnamestmt   : typedefname ';'     [ZZVALID;] { $$ = $1; }
 typedefliststmt   : typedeflist ';'     [ZZVALID;] { $$ = $1; }
                   ;
 
-typedeflist       : tknTypedef vardecllist  [ZZLOG;] { $$ = new CppTypedefList($2); }
+typedeflist       : tknTypedef vardecllist  [ZZLOG;] { $$ = newObj<CppTypedefList>(yyparam->objFactory, $2); }
                   ;
 
-typedefname       : tknTypedef vardecl      [ZZLOG;] { $$ = new CppTypedefName($2); }
+typedefname       : tknTypedef vardecl      [ZZLOG;] { $$ = newObj<CppTypedefName>(yyparam->objFactory, $2); }
                   ;
 
 usingdecl         : tknUsing name '=' vartype ';'         [ZZLOG;] {
-                    $$ = new CppUsingDecl($2, $4);
+                    $$ = newObj<CppUsingDecl>(yyparam->objFactory, $2, $4);
                   }
                   | tknUsing name '=' functionptrtype ';' [ZZLOG;] {
-                    $$ = new CppUsingDecl($2, $4);
+                    $$ = newObj<CppUsingDecl>(yyparam->objFactory, $2, $4);
                   }
                   | tknUsing name '=' funcobj ';'         [ZZLOG;] {
-                    $$ = new CppUsingDecl($2, $4);
+                    $$ = newObj<CppUsingDecl>(yyparam->objFactory, $2, $4);
                   }
                   | tknUsing name '=' classdefn ';'       [ZZLOG;] {
-                    $$ = new CppUsingDecl($2, $4);
+                    $$ = newObj<CppUsingDecl>(yyparam->objFactory, $2, $4);
                   }
                   | templatespecifier usingdecl         [ZZLOG;] {
                     $$ = $2;
                     $$->templateParamList($1);
                   }
                   | tknUsing identifier ';'             [ZZLOG;] {
-                    $$ = new CppUsingDecl($2, gCurAccessType);
+                    $$ = newObj<CppUsingDecl>(yyparam->objFactory, $2, yyparam->curAccessType);
                   }
                   ;
                   ;
 
 namespacealias    : tknNamespace name '=' identifier ';'    [ZZLOG;] {
-                    $$ = new CppNamespaceAlias($2, $4);
+                    $$ = newObj<CppNamespaceAlias>(yyparam->objFactory, $2, $4);
                   }
                   ;
 
 usingnamespacedecl: tknUsing tknNamespace identifier ';'  [ZZLOG;] {
-                    $$ = new CppUsingNamespaceDecl($3);
+                    $$ = newObj<CppUsingNamespaceDecl>(yyparam->objFactory, $3);
                   }
                   ;
 
@@ -864,22 +971,23 @@ vardeclstmt       : vardecl ';'                   [ZZVALID;] { $$ = $1; }
 
 vardecllist       : optfunctype varinit ',' opttypemodifier name optvarassign [ZZLOG;] {
                     $2->addAttr($1);
-                    $$ = new CppVarList($2, CppVarDeclInList($4, CppVarDecl{$5, $6.assignValue_, $6.assignType_}));
+                    $$ = newObj<CppVarList>(yyparam->objFactory, $2, CppVarDeclInList($4, CppVarDecl{$5, $6.assignValue_, $6.assignType_}));
                   }
                   | optfunctype vardecl ',' opttypemodifier name optvarassign [ZZLOG;] {
                     $2->addAttr($1);
-                    $$ = new CppVarList($2, CppVarDeclInList($4, CppVarDecl{$5, $6.assignValue_, $6.assignType_}));
+                    $$ = newObj<CppVarList>(yyparam->objFactory, $2, CppVarDeclInList($4, CppVarDecl{$5, $6.assignValue_, $6.assignType_}));
                   }
                   | optfunctype vardecl ',' opttypemodifier name '[' expr ']' [ZZLOG;] {
                     $2->addAttr($1);
                     CppVarDecl var2($5);
                     var2.addArraySize($7);
-                    $$ = new CppVarList($2, CppVarDeclInList($4, std::move(var2)));
+                    $$ = newObj<CppVarList>(yyparam->objFactory, $2, CppVarDeclInList($4, std::move(var2)));
                     /* TODO: Use optvarassign as well */
                   }
                   | optfunctype vardecl ',' opttypemodifier name ':' expr [ZZLOG;] {
                     $2->addAttr($1);
-                    $$ = new CppVarList($2, CppVarDeclInList($4, CppVarDecl{$5}));
+                    $$ = newObj<CppVarList>(yyparam->objFactory, $2, CppVarDeclInList($4, CppVarDecl{$5}));
+                    delete $7;
                     /* TODO: Use optvarassign as well */
                   }
                   | vardecllist ',' opttypemodifier name optvarassign [ZZLOG;] {
@@ -889,16 +997,18 @@ vardecllist       : optfunctype varinit ',' opttypemodifier name optvarassign [Z
                   | vardecllist ',' opttypemodifier name optvarassign ':' expr [ZZLOG;] {
                     $$ = $1;
                     $$->addVarDecl(CppVarDeclInList($3, CppVarDecl{$4}));
+                    delete $5.assignValue_;
+                    delete $7;
                     /* TODO: Use optvarassign as well */
                   }
                   ;
 
-varinit           : vardecl '(' typeidentifier '*' name      [gParamModPos = $4.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
-                  | vardecl '(' typeidentifier '*' '*' name  [gParamModPos = $4.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
-                  | vardecl '(' typeidentifier '*' '&' name  [gParamModPos = $4.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
-                  | vardecl '(' typeidentifier '&' name      [gParamModPos = $4.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
-                  | vardecl '(' typeidentifier tknAnd name   [gParamModPos = $4.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
-                  | vardecl '(' typeidentifier ')'         [gParamModPos = $3.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
+varinit           : vardecl '(' typeidentifier '*' name      [yyparam->paramModPos = $4.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
+                  | vardecl '(' typeidentifier '*' '*' name  [yyparam->paramModPos = $4.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
+                  | vardecl '(' typeidentifier '*' '&' name  [yyparam->paramModPos = $4.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
+                  | vardecl '(' typeidentifier '&' name      [yyparam->paramModPos = $4.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
+                  | vardecl '(' typeidentifier tknAnd name   [yyparam->paramModPos = $4.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
+                  | vardecl '(' typeidentifier ')'         [yyparam->paramModPos = $3.sz; ZZERROR;] { /*FuncDeclHack*/ $$ = nullptr; }
                   | vardecl '(' ')'                        [ZZERROR;]                       { /*FuncDeclHack*/ $$ = nullptr; }
                   | vardecl varassign           [ZZLOG;] {
                     $$ = $1;
@@ -926,14 +1036,14 @@ optvarassign      :                     [ZZLOG;]  { $$ = CppVarAssign{nullptr, A
                   ;
 
 vardecl           : vartype varidentifier       [ZZLOG;]         {
-                    $$ = new CppVar($1, $2.toString());
+                    $$ = newObj<CppVar>(yyparam->objFactory, $1, $2.toString());
                   }
                   | vartype apidecor varidentifier       [ZZLOG;]         {
-                    $$ = new CppVar($1, $3.toString());
+                    $$ = newObj<CppVar>(yyparam->objFactory, $1, $3.toString());
                     $$->apidecor($2);
                   }
                   | functionpointer             [ZZLOG;] {
-                    $$ = new CppVar(gCurAccessType, $1, CppTypeModifier());
+                    $$ = newObj<CppVar>(yyparam->objFactory, yyparam->curAccessType, $1, CppTypeModifier());
                   }
                   | vardecl '[' expr ']'        [ZZLOG;] {
                     $$ = $1;
@@ -958,43 +1068,43 @@ vardecl           : vartype varidentifier       [ZZLOG;]         {
                   ;
 
 vartype           : attribspecifiers typeidentifier opttypemodifier    [ZZLOG;] {
-                    $$ = new CppVarType(gCurAccessType, $2, $3);
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, $2, $3);
                     $$->attribSpecifierSequence($1);
                   }
                   | typeidentifier opttypemodifier    [ZZLOG;] {
-                    $$ = new CppVarType(gCurAccessType, $1, $2);
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, $1, $2);
                   }
                   | tknClass identifier opttypemodifier [
-                    if (gTemplateParamStart == $1.sz)
+                    if (yyparam->templateParamStart == $1.sz)
                       ZZERROR;
                     else
                       ZZLOG;
                   ] {
-                    $$ = new CppVarType(gCurAccessType, mergeCppToken($1, $2), $3);
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, mergeCppToken($1, $2), $3);
                   }
                   | tknClass optapidecor identifier opttypemodifier                 [ZZLOG;] {
-                    $$ = new CppVarType(gCurAccessType, mergeCppToken($1, $3), $4);
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, mergeCppToken($1, $3), $4);
                   }
                   | tknStruct optapidecor identifier opttypemodifier                 [ZZLOG;] {
-                    $$ = new CppVarType(gCurAccessType, mergeCppToken($1, $3), $4);
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, mergeCppToken($1, $3), $4);
                   }
                   | tknUnion identifier opttypemodifier                  [ZZLOG;] {
-                    $$ = new CppVarType(gCurAccessType, mergeCppToken($1, $2), $3);
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, mergeCppToken($1, $2), $3);
                   }
                   | functionptrtype                   [ZZLOG;] {
-                    $$ = new CppVarType(gCurAccessType, $1, CppTypeModifier());
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, $1, CppTypeModifier());
                   }
                   | classdefn                         [ZZLOG;] {
-                    $$ = new CppVarType(gCurAccessType, $1, CppTypeModifier());
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, $1, CppTypeModifier());
                   }
                   | classdefn typemodifier            [ZZLOG;] {
-                    $$ = new CppVarType(gCurAccessType, $1, $2);
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, $1, $2);
                   }
                   | enumdefn                          [ZZLOG;] {
-                    $$ = new CppVarType(gCurAccessType, $1, CppTypeModifier());
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, $1, CppTypeModifier());
                   }
                   | enumdefn typemodifier             [ZZLOG;] {
-                    $$ = new CppVarType(gCurAccessType, $1, $2);
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, $1, $2);
                   }
                   | varattrib vartype                 [ZZLOG;] {
                     $$ = $2;
@@ -1007,7 +1117,7 @@ vartype           : attribspecifiers typeidentifier opttypemodifier    [ZZLOG;]
                   | typeidentifier typeidentifier tknScopeResOp typemodifier [ZZLOG;] {
                     // reference to member declrations. E.g.:
                     // int GrCCStrokeGeometry::InstanceTallies::* InstanceType
-                    $$ = new CppVarType(gCurAccessType, mergeCppToken($1, $3), $4);
+                    $$ = newObj<CppVarType>(yyparam->objFactory, yyparam->curAccessType, mergeCppToken($1, $3), $4);
                   }
                   ;
 
@@ -1020,7 +1130,7 @@ varidentifier     : identifier          [ZZLOG;]  { $$ = $1; }
 
 opttypemodifier   : [ZZLOG;] { $$ = CppTypeModifier(); }
                   | typemodifier { $$ = $1; }
-                  | doccomment opttypemodifier { $$ = $2; }
+                  | doccomment opttypemodifier { $$ = $2; delete $1; }
                   ;
 
 typemodifier      : tknConst                              [ZZLOG;] {
@@ -1070,10 +1180,10 @@ varattrib         : tknConst     [ZZLOG;] { $$ = kConst;      }
                   ;
 
 typeconverter     : tknOperator vartype '(' optvoid ')'                           [ZZLOG;] {
-                    $$ = newTypeConverter($2, makeCppToken($1.sz, $3.sz));
+                    $$ = newTypeConverter(yyparam->objFactory, $2, makeCppToken($1.sz, $3.sz));
                   }
                   | identifier tknScopeResOp tknOperator vartype '(' optvoid ')'  [ZZLOG;] {
-                    $$ = newTypeConverter($4, makeCppToken($1.sz, $5.sz));
+                    $$ = newTypeConverter(yyparam->objFactory, $4, makeCppToken($1.sz, $5.sz));
                   }
                   | functype typeconverter                                        [ZZLOG;] {
                     $$ = $2;
@@ -1107,15 +1217,15 @@ funcdeclstmt      : funcdecl ';' [ZZVALID;] { $$ = $1; }
 
 funcdefn          : funcdecl block [ZZVALID;] {
                     $$ = $1;
-                    $$->defn($2 ? $2 : newCompound(CppAccessType::kUnknown, CppCompoundType::kBlock));
+                    $$->defn($2 ? $2 : newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock));
                   }
                   ;
 
 lambda            : '[' lambdacapture ']' lambdaparams block {
-                    $$ = new CppLambda($2, $4, $5);
+                    $$ = newObj<CppLambda>(yyparam->objFactory, $2, $4, $5);
                   }
                   | '[' lambdacapture ']' lambdaparams tknArrow vartype block {
-                    $$ = new CppLambda($2, $4, $7, $6);
+                    $$ = newObj<CppLambda>(yyparam->objFactory, $2, $4, $7, $6);
                   }
                   ;
 
@@ -1124,23 +1234,23 @@ lambdaparams      :                   [ZZLOG;] { $$ = nullptr; }
                   ;
 
 funcptrortype     : functype vartype '(' optapidecor identifier tknScopeResOp '*' optname ')' '(' paramlist ')' [ZZVALID;] {
-                    $$ = new CppFunctionPointer(gCurAccessType, $8, $2, $11, $1, mergeCppToken($5, $6));
+                    $$ = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, $8, $2, $11, $1, mergeCppToken($5, $6));
                     $$->decor2($4);
                   }
                   | vartype '(' optapidecor identifier tknScopeResOp '*' optname ')' '(' paramlist ')'          [ZZVALID;] {
-                    $$ = new CppFunctionPointer(gCurAccessType, $7, $1, $10, 0, mergeCppToken($4, $5));
+                    $$ = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, $7, $1, $10, 0, mergeCppToken($4, $5));
                     $$->decor2($3);
                   }
                   | functype vartype '(' optapidecor '*' optname ')' '(' paramlist ')'                          [ZZVALID;] {
-                    $$ = new CppFunctionPointer(gCurAccessType, $6, $2, $9, $1);
+                    $$ = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, $6, $2, $9, $1);
                     $$->decor2($4);
                   }
                   | vartype '(' optapidecor '*' optname ')' '(' paramlist ')'                                   [ZZVALID;] {
-                    $$ = new CppFunctionPointer(gCurAccessType, $5, $1, $8, 0);
+                    $$ = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, $5, $1, $8, 0);
                     $$->decor2($3);
                   }
                   | vartype '(' '*'  apidecor optname ')' '(' paramlist ')'                                     [ZZVALID;] {
-                    $$ = new CppFunctionPointer(gCurAccessType, $5, $1, $8, 0);
+                    $$ = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, $5, $1, $8, 0);
                     $$->decor2($4);
                   }
                   | apidecor funcptrortype                                                                      [ZZVALID;] {
@@ -1170,7 +1280,7 @@ functionptrtype   : funcptrortype
                   ;
 
 funcobj           : vartype optapidecor '(' paramlist ')' [ZZLOG;] {
-                    $$ = new CppFunctionPointer(gCurAccessType, "", $1, $4, 0);
+                    $$ = newObj<CppFunctionPointer>(yyparam->objFactory, yyparam->curAccessType, "", $1, $4, 0);
                   }
                   ;
 
@@ -1186,20 +1296,20 @@ funcdecldata      : funcname '(' paramlist ')' [ZZLOG;] {
                   ;
 
 funcdecl          : vartype apidecor funcdecldata                                   [ZZVALID;] {
-                    $$ = newFunction(gCurAccessType, $3.funcName, $1, $3.paramList, $3.funcAttr);
+                    $$ = newFunction(yyparam->objFactory, yyparam->curAccessType, $3.funcName, $1, $3.paramList, $3.funcAttr);
                     $$->decor2($2);
                   }
                   | vartype funcdecldata                                            [ZZVALID;] {
-                    $$ = newFunction(gCurAccessType, $2.funcName, $1, $2.paramList, $2.funcAttr);
+                    $$ = newFunction(yyparam->objFactory, yyparam->curAccessType, $2.funcName, $1, $2.paramList, $2.funcAttr);
                   }
                   | vartype tknConstExpr funcdecldata                               [ZZVALID;] {
-                    $$ = newFunction(gCurAccessType, $3.funcName, $1, $3.paramList, $3.funcAttr | kConstExpr);
+                    $$ = newFunction(yyparam->objFactory, yyparam->curAccessType, $3.funcName, $1, $3.paramList, $3.funcAttr | kConstExpr);
                   }
                   | tknAuto funcdecldata tknArrow vartype                           [ZZVALID;] {
-                    $$ = newFunction(gCurAccessType, $2.funcName, $4, $2.paramList, $2.funcAttr | kTrailingRet);
+                    $$ = newFunction(yyparam->objFactory, yyparam->curAccessType, $2.funcName, $4, $2.paramList, $2.funcAttr | kTrailingRet);
                   }
                   | tknAuto tknConstExpr funcdecldata tknArrow vartype              [ZZVALID;] {
-                    $$ = newFunction(gCurAccessType, $3.funcName, $5, $3.paramList, $3.funcAttr | kTrailingRet | kConstExpr);
+                    $$ = newFunction(yyparam->objFactory, yyparam->curAccessType, $3.funcName, $5, $3.paramList, $3.funcAttr | kTrailingRet | kConstExpr);
                   }
                   | tknConstExpr funcdecl                                               [ZZLOG;] {
                     $$ = $2;
@@ -1318,27 +1428,27 @@ paramlist         :                     [ZZLOG;] { $$ = nullptr; }
 
 param             : varinit                        [ZZLOG;] { $$ = $1; $1->addAttr(kFuncParam);  }
                   | vartype '=' expr               [ZZLOG;] {
-                    auto var = new CppVar($1, std::string());
+                    auto var = newObj<CppVar>(yyparam->objFactory, $1, std::string());
                     var->addAttr(kFuncParam);
                     var->assign($3, AssignType::kUsingEqual);
                     $$ = var;
                   }
                   | vardecl                         [ZZLOG;] { $$ = $1; $1->addAttr(kFuncParam);  }
                   | vartype                         [ZZLOG;] {
-                    auto var = new CppVar($1, std::string());
+                    auto var = newObj<CppVar>(yyparam->objFactory, $1, std::string());
                     var->addAttr(kFuncParam);
                     $$ = var;
                   }
                   | funcptrortype                   [ZZLOG;] { $$ = $1; $1->addAttr(kFuncParam);     }
-                  | doccomment param                [ZZLOG;] { $$ = $2; }
+                  | doccomment param                [ZZLOG;] { $$ = $2; delete $1; }
                   | vartype '[' expr ']'            [ZZLOG;] {
-                    auto var = new CppVar($1, std::string());
+                    auto var = newObj<CppVar>(yyparam->objFactory, $1, std::string());
                     var->addAttr(kFuncParam);
                     var->addArraySize($3);
                     $$ = var;
                   }
                   | vartype '[' ']'                 [ZZLOG;] {
-                    auto var = new CppVar($1, std::string());
+                    auto var = newObj<CppVar>(yyparam->objFactory, $1, std::string());
                     var->addAttr(kFuncParam);
                     var->addArraySize(nullptr);
                     $$ = var;
@@ -1346,14 +1456,14 @@ param             : varinit                        [ZZLOG;] { $$ = $1; $1->addAt
                   ;
 
 templatearg       :                 [ZZLOG; $$ = nullptr;] { /*$$ = makeCppToken(nullptr, nullptr);*/ }
-                  | vartype         [ZZLOG; $$ = nullptr;] { /*$$ = mergeCppToken($1, $2);*/ }
+                  | vartype         [ZZLOG; $$ = nullptr;] { /*$$ = mergeCppToken($1, $2);*/ delete $1; }
                   | funcobjstr      [ZZLOG; $$ = nullptr;] { /*$$ = $1;*/ }
-                  | expr           [ZZLOG; $$ = nullptr;] {}
+                  | expr           [ZZLOG; $$ = nullptr;] { delete $1; }
                   ;
 
 templatearglist   : templatearg                      [ZZLOG; $$ = $1; ] {}
                   | templatearglist ',' templatearg   [ZZLOG; $$ = $1;] { /*$$ = mergeCppToken($1, $3);*/ }
-                  | templatearglist ',' doccomment templatearg   [ZZLOG; $$ = $1;] { /*$$ = mergeCppToken($1, $3);*/ }
+                  | templatearglist ',' doccomment templatearg   [ZZLOG; $$ = $1;] { delete $3; }
                   ;
 
 functype          : exptype        [ZZLOG;] { $$ = $1; }
@@ -1415,21 +1525,21 @@ ctordefn          : ctordecl meminitlist block  [ZZVALID;]
                   | name tknScopeResOp name [if($1 != $3) ZZERROR; else ZZVALID;]
                     '(' paramlist ')' optfuncthrowspec meminitlist block [ZZVALID;]
                   {
-                    $$ = newConstructor(gCurAccessType, mergeCppToken($1, $3), $6, $9, 0);
+                    $$ = newConstructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken($1, $3), $6, $9, 0);
                     $$->defn($10);
                     $$->throwSpec($8);
                   }
                   | identifier tknScopeResOp name tknScopeResOp name [if($3 != $5) ZZERROR; else ZZVALID;]
                     '(' paramlist ')' optfuncthrowspec meminitlist block [ZZVALID;]
                   {
-                    $$ = newConstructor(gCurAccessType, mergeCppToken($1, $5), $8, $11, 0);
+                    $$ = newConstructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken($1, $5), $8, $11, 0);
                     $$->defn($12);
                     $$->throwSpec($10);
                   }
                   | name tknLT templatearglist tknGT tknScopeResOp name [if($1 != $6) ZZERROR; else ZZVALID;]
                     '(' paramlist ')' optfuncthrowspec meminitlist block [ZZVALID;]
                   {
-                    $$ = newConstructor(gCurAccessType, mergeCppToken($1, $6), $9, $12, 0);
+                    $$ = newConstructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken($1, $6), $9, $12, 0);
                     $$->defn($13);
                     $$->throwSpec($11);
                   }
@@ -1445,15 +1555,15 @@ ctordefn          : ctordecl meminitlist block  [ZZVALID;]
 
 ctordecl          : identifier '(' paramlist ')' %prec CTORDECL
                   [
-                    if(gCompoundStack.empty())
+                    if(yyparam->compoundStack.empty())
                       ZZERROR;
-                    if((gCompoundStack.top() != $1) && (classNameFromIdentifier(gCompoundStack.top()) != $1))
+                    if((yyparam->compoundStack.top() != $1) && (classNameFromIdentifier(yyparam->compoundStack.top()) != $1))
                       ZZERROR;
                     else
                       ZZVALID;
                   ]
                   {
-                    $$ = newConstructor(gCurAccessType, $1, $3, makeEmptyCppMemInitList(), 0);
+                    $$ = newConstructor(yyparam->objFactory, yyparam->curAccessType, $1, $3, makeEmptyCppMemInitList(), 0);
                   }
                   | functype ctordecl          [ZZLOG;] {
                     $$ = $2;
@@ -1487,7 +1597,7 @@ ctordecl          : identifier '(' paramlist ')' %prec CTORDECL
 
 meminitlist       :                          [ZZLOG;] { $$ = makeEmptyCppMemInitList(); }
                   | ':' meminit              [ZZLOG;] {
-                    $$ = makeCppMemInitList(new std::list<CppMemInit>);
+                    $$ = makeCppMemInitList(new CppMemInitList);
                     $$.memInitList->push_back(CppMemInit($2.mem, $2.init));
                   }
                   | ':' blob                 [ZZLOG;] { $$ = makeCppMemInitList($2); }
@@ -1510,25 +1620,25 @@ dtordeclstmt      : dtordecl ';'    [ZZVALID;]     { $$ = $1; }
 dtordefn          : dtordecl block  [ZZVALID;]
                   {
                     $$ = $1;
-                    $$->defn($2 ? $2 : newCompound(CppAccessType::kUnknown, CppCompoundType::kBlock));
+                    $$->defn($2 ? $2 : newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock));
                   }
                   | name tknScopeResOp '~' name [if($1 != $4) ZZERROR; else ZZVALID;]
                     '(' ')' block
                   {
-                    $$ = newDestructor(gCurAccessType, mergeCppToken($1, $4), 0);
-                    $$->defn($8 ? $8 : newCompound(CppAccessType::kUnknown, CppCompoundType::kBlock));
+                    $$ = newDestructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken($1, $4), 0);
+                    $$->defn($8 ? $8 : newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock));
                   }
                   | identifier tknScopeResOp name tknScopeResOp '~' name [if($3 != $6) ZZERROR; else ZZVALID;]
                     '(' ')' block
                   {
-                    $$ = newDestructor(gCurAccessType, mergeCppToken($1, $6), 0);
-                    $$->defn($10 ? $10 : newCompound(CppAccessType::kUnknown, CppCompoundType::kBlock));
+                    $$ = newDestructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken($1, $6), 0);
+                    $$->defn($10 ? $10 : newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock));
                   }
                   | name tknLT templatearglist tknGT tknScopeResOp '~' name [if($1 != $7) ZZERROR; else ZZVALID;]
                     '(' ')' block
                   {
-                    $$ = newDestructor(gCurAccessType, mergeCppToken($1, $7), 0);
-                    $$->defn($11 ? $11 : newCompound(CppAccessType::kUnknown, CppCompoundType::kBlock));
+                    $$ = newDestructor(yyparam->objFactory, yyparam->curAccessType, mergeCppToken($1, $7), 0);
+                    $$->defn($11 ? $11 : newCompound(yyparam->objFactory, CppAccessType::kUnknown, CppCompoundType::kBlock));
                   }
                   | templatespecifier dtordefn  [ZZLOG;] {
                     $$ = $2;
@@ -1542,9 +1652,9 @@ dtordefn          : dtordecl block  [ZZVALID;]
 
 dtordecl          : '~' name '(' optvoid ')' %prec DTORDECL [ZZLOG;]
                   [
-                    if(gCompoundStack.empty())
+                    if(yyparam->compoundStack.empty())
                       ZZERROR;
-                    if(classNameFromIdentifier(gCompoundStack.top()) != $2)
+                    if(classNameFromIdentifier(yyparam->compoundStack.top()) != $2)
                       ZZERROR;
                     else
                       ZZVALID;
@@ -1552,7 +1662,7 @@ dtordecl          : '~' name '(' optvoid ')' %prec DTORDECL [ZZLOG;]
                   {
                     const char* tildaStartPos = $2.sz-1;
                     while(*tildaStartPos != '~') --tildaStartPos;
-                    $$ = newDestructor(gCurAccessType, makeCppToken(tildaStartPos, $2.sz+$2.len-tildaStartPos), 0);
+                    $$ = newDestructor(yyparam->objFactory, yyparam->curAccessType, makeCppToken(tildaStartPos, $2.sz+$2.len-tildaStartPos), 0);
                   }
                   | apidecor dtordecl         [ZZLOG;] {
                     $$ = $2;
@@ -1621,18 +1731,18 @@ attribspecifiers  : attribspecifier {
 classdefn         : classspecifier optapidecor optattribspecifiers identifier optfinal optinheritlist optcomment '{'
                   [
                     ZZVALID;
-                    gCompoundStack.push($4);
-                    gAccessTypeStack.push(gCurAccessType); gCurAccessType = CppAccessType::kUnknown;
+                    yyparam->compoundStack.push($4);
+                    yyparam->accessTypeStack.push(yyparam->curAccessType); yyparam->curAccessType = CppAccessType::kUnknown;
                   ]
                   optstmtlist '}'
                   [
                     ZZVALID;
-                    gCompoundStack.pop();
-                    gCurAccessType = gAccessTypeStack.top();
-                    gAccessTypeStack.pop();
+                    yyparam->compoundStack.pop();
+                    yyparam->curAccessType = yyparam->accessTypeStack.top();
+                    yyparam->accessTypeStack.pop();
                   ]
                   {
-                    $$ = $10 ? $10 : newCompound(gCurAccessType);
+                    $$ = $10 ? $10 : newCompound(yyparam->objFactory, yyparam->curAccessType);
                     $$->compoundType($1);
                     $$->apidecor($2);
                     $$->attribSpecifierSequence($3);
@@ -1641,14 +1751,14 @@ classdefn         : classspecifier optapidecor optattribspecifiers identifier op
                     $$->addAttr($5);
                   }
                   | classspecifier optattribspecifiers optinheritlist optcomment
-                    '{' { gAccessTypeStack.push(gCurAccessType); gCurAccessType = CppAccessType::kUnknown; }
+                    '{' { yyparam->accessTypeStack.push(yyparam->curAccessType); yyparam->curAccessType = CppAccessType::kUnknown; }
                       optstmtlist
                     '}' [ZZVALID;]
                   {
-                    gCurAccessType = gAccessTypeStack.top();
-                    gAccessTypeStack.pop();
+                    yyparam->curAccessType = yyparam->accessTypeStack.top();
+                    yyparam->accessTypeStack.pop();
 
-                    $$ = $7 ? $7 : newCompound(gCurAccessType);
+                    $$ = $7 ? $7 : newCompound(yyparam->objFactory, yyparam->curAccessType);
                     $$->compoundType($1);
                     $$->attribSpecifierSequence($2);
                     $$->inheritanceList($3);
@@ -1663,18 +1773,18 @@ classdefn         : classspecifier optapidecor optattribspecifiers identifier op
 namespacedefn     : tknNamespace optidentifier '{'
                   [
                     ZZVALID;
-                    gCompoundStack.push(classNameFromIdentifier($2));
-                    gAccessTypeStack.push(gCurAccessType); gCurAccessType = CppAccessType::kUnknown;
+                    yyparam->compoundStack.push(classNameFromIdentifier($2));
+                    yyparam->accessTypeStack.push(yyparam->curAccessType); yyparam->curAccessType = CppAccessType::kUnknown;
                   ]
                   optstmtlist '}'
                   [
                     ZZVALID;
-                    gCompoundStack.pop();
-                    gCurAccessType = gAccessTypeStack.top();
-                    gAccessTypeStack.pop();
+                    yyparam->compoundStack.pop();
+                    yyparam->curAccessType = yyparam->accessTypeStack.top();
+                    yyparam->accessTypeStack.pop();
                   ]
                   {
-                    $$ = $5 ? $5 : newCompound(gCurAccessType);
+                    $$ = $5 ? $5 : newCompound(yyparam->objFactory, yyparam->curAccessType);
                     $$->compoundType(CppCompoundType::kNamespace);
                     $$->name($2);
                   }
@@ -1709,13 +1819,13 @@ optinherittype    :             [ZZLOG;] { $$ = false; }
                   | tknVirtual  [ZZLOG;] { $$ = true; }
                   ;
 
-fwddecl           : classspecifier typeidentifier ';'              [ZZVALID;] { $$ = new CppFwdClsDecl(gCurAccessType, $2, $1); }
-                  | classspecifier optapidecor identifier ';'  [ZZVALID;] { $$ = new CppFwdClsDecl(gCurAccessType, $3, $2, $1); }
+fwddecl           : classspecifier typeidentifier ';'              [ZZVALID;] { $$ = newObj<CppFwdClsDecl>(yyparam->objFactory, yyparam->curAccessType, $2, $1); }
+                  | classspecifier optapidecor identifier ';'  [ZZVALID;] { $$ = newObj<CppFwdClsDecl>(yyparam->objFactory, yyparam->curAccessType, $3, $2, $1); }
                   | templatespecifier fwddecl [ZZLOG;] {
                     $$ = $2;
                     $$->templateParamList($1);
                   }
-                  | tknFriend typeidentifier ';'  [ZZVALID;] { $$ = new CppFwdClsDecl(gCurAccessType, $2); $$->addAttr(kFriend); }
+                  | tknFriend typeidentifier ';'  [ZZVALID;] { $$ = newObj<CppFwdClsDecl>(yyparam->objFactory, yyparam->curAccessType, $2); $$->addAttr(kFriend); }
                   | tknFriend fwddecl             [ZZVALID;] { $$ = $2; $$->addAttr(kFriend); }
                   ;
 
@@ -1724,8 +1834,8 @@ classspecifier    : tknClass      [ZZLOG;] { $$ = CppCompoundType::kClass;     }
                   | tknUnion      [ZZLOG;] { $$ = CppCompoundType::kUnion;     }
                   ;
 
-templatespecifier : tknTemplate tknLT       [gInTemplateSpec = true;  ZZLOG;   ]
-                    templateparamlist tknGT [gInTemplateSpec = false; ZZVALID; ]
+templatespecifier : tknTemplate tknLT       [yyparam->inTemplateSpec = true;  ZZLOG;   ]
+                    templateparamlist tknGT [yyparam->inTemplateSpec = false; ZZVALID; ]
                   {
                     $$ = $4;
                   }
@@ -1736,75 +1846,70 @@ templateparamlist :                                       [ZZLOG;] {
                   }
                   | templateparam                         [ZZLOG;] {
                     $$ = new CppTemplateParamList;
-                    $$->emplace_back($1);
+                    addTemplateParam($$, $1);
                   }
                   | templateparamlist ',' templateparam   [ZZLOG;] {
                     $$ = $1;
-                    $$->emplace_back($3);
+                    addTemplateParam($$, $3);
                   }
                   ;
 
 templateparam     : tknTypename optname             [ZZLOG;] {
-                    $$ = new CppTemplateParam($2);
+                    $$ = CppNtTemplateParam{nullptr, $2, nullptr};
                   }
                   | tknTypename optname '=' vartype [ZZLOG;] {
-                    $$ = new CppTemplateParam($2);
-                    $$->defaultArg($4);
+                    $$ = CppNtTemplateParam{nullptr, $2, $4};
                   }
                   | tknClass optname                [ZZLOG;] {
-                    $$ = new CppTemplateParam($2);
+                    $$ = CppNtTemplateParam{nullptr, $2, nullptr};
                   }
                   | tknClass optname '=' vartype    [ZZLOG;] {
-                    $$ = new CppTemplateParam($2);
-                    $$->defaultArg($4);
+                    $$ = CppNtTemplateParam{nullptr, $2, $4};
                   }
                   | vartype name                    [ZZLOG;] {
-                    $$ = new CppTemplateParam($1, $2);
+                    $$ = CppNtTemplateParam{$1, $2, nullptr};
                   }
                   | vartype name '=' expr  %prec TEMPLATE          [ZZLOG;] {
-                    $$ = new CppTemplateParam($1, $2);
-                    $$->defaultArg($4);
+                    $$ = CppNtTemplateParam{$1, $2, $4};
                   }
                   | functionpointer               [ZZLOG;] {
-                    $$ = new CppTemplateParam($1, std::string());
+                    $$ = CppNtTemplateParam{$1, makeCppToken(nullptr, nullptr), nullptr};
                   }
                   | functionpointer '=' expr  %prec TEMPLATE         [ZZLOG;] {
-                    $$ = new CppTemplateParam($1, std::string());
-                    $$->defaultArg($3);
+                    $$ = CppNtTemplateParam{$1, makeCppToken(nullptr, nullptr), $3};
                   }
                   | vartype                       [ZZLOG;] { // Can happen when forward declaring
-                    $$ = new CppTemplateParam($1, std::string());
+                    $$ = CppNtTemplateParam{$1, makeCppToken(nullptr, nullptr), nullptr};
                   }
                   | vartype '=' expr              [ZZLOG;] { // Can happen when forward declaring
-                    $$ = new CppTemplateParam($1, std::string());
-                    $$->defaultArg($3);
+                    $$ = CppNtTemplateParam{$1, makeCppToken(nullptr, nullptr), $3};
                   }
                   // <TemplateParamHack>
                   | tknTypename name ',' [
-                    if (gInTemplateSpec)
-                      gTemplateParamStart = $1.sz;
+                    if (yyparam->inTemplateSpec)
+                      yyparam->templateParamStart = $1.sz;
                     ZZERROR;
-                  ] { $$ = nullptr; }
+                  ] { $$ = CppNtTemplateParam{}; }
                   | tknTypename name '=' [
-                    if (gInTemplateSpec)
-                      gTemplateParamStart = $1.sz;
+                    if (yyparam->inTemplateSpec)
+                      yyparam->templateParamStart = $1.sz;
                     ZZERROR;
-                  ] { $$ = nullptr; }
+                  ] { $$ = CppNtTemplateParam{}; }
                   | tknTypename name tknGT [
-                    if (gInTemplateSpec)
-                      gTemplateParamStart = $1.sz;
+                    if (yyparam->inTemplateSpec)
+                      yyparam->templateParamStart = $1.sz;
                     ZZERROR;
-                  ] { $$ = nullptr; }
+                  ] { $$ = CppNtTemplateParam{}; }
                   | tknClass name ',' [
-                    if (gInTemplateSpec)
-                      gTemplateParamStart = $1.sz;
+                    if (yyparam->inTemplateSpec)
+                      yyparam->templateParamStart = $1.sz;
                     ZZERROR;
-                  ] { $$ = nullptr; }
+                  ] { $$ = CppNtTemplateParam{}; }
                   | tknClass name tknGT [
-                    if (gInTemplateSpec)
-                      gTemplateParamStart = $1.sz;
+                    if (yyparam->inTemplateSpec)
+                      yyparam->templateParamStart = $1.sz;
                     ZZERROR;
-                  ] { $$ = nullptr; }
+                  ] { $$ = CppNtTemplateParam{}; }
                   // </TemplateParamHack>
                   ;
 
@@ -1835,144 +1940,144 @@ strlit            : tknStrLit          [ZZLOG;] { $$ = $1; }
                   | strlit tknStrLit   [ZZLOG;] { $$ = mergeCppToken($1, $2); }
                   ;
 
-expr              : strlit                                                [ZZLOG;] { $$ = new CppExpr((std::string) $1, kNone);          }
-                  | tknCharLit                                            [ZZLOG;] { $$ = new CppExpr((std::string) $1, kNone);          }
-                  | tknNumber                                             [ZZLOG;] { $$ = new CppExpr((std::string) $1, kNone);          }
-                  | '+' tknNumber                                         [ZZLOG;] { $$ = new CppExpr((std::string) $2, kNone);          }
+expr              : strlit                                                [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, exprAtom($1), kNone);              }
+                  | tknCharLit                                            [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, exprAtom($1), kNone);              }
+                  | tknNumber                                             [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, exprAtom($1), kNone);              }
+                  | '+' tknNumber                                         [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, exprAtom($2), kNone);              }
                   | identifier
                     [
-                      if ($1.sz == gParamModPos) {
-                        gParamModPos = nullptr;
+                      if ($1.sz == yyparam->paramModPos) {
+                        yyparam->paramModPos = nullptr;
                         ZZERROR;
                       } else {
                         ZZLOG;
                       }
-                    ]                                                     [ZZLOG;] { $$ = new CppExpr((std::string) $1, kNone);          }
-                  | '{' exprlist '}'                                      [ZZLOG;] { $$ = new CppExpr($2, CppExpr::kInitializer);        }
-                  | '{' exprlist ',' '}'                                  [ZZLOG;] { $$ = new CppExpr($2, CppExpr::kInitializer);        }
-                  | '{' exprorlist '}'                                    [ZZLOG;] { $$ = new CppExpr($2, CppExpr::kInitializer);        }
-                  | '{' exprorlist ',' '}'                                [ZZLOG;] { $$ = new CppExpr($2, CppExpr::kInitializer);        }
-                  | '{' /*empty expr*/ '}'                                [ZZLOG;] { $$ = new CppExpr((CppExpr*)nullptr, CppExpr::kInitializer);   }
-                  | '-' expr %prec UNARYMINUS                             [ZZLOG;] { $$ = new CppExpr($2, kUnaryMinus);                  }
-                  | '~' expr                                              [ZZLOG;] { $$ = new CppExpr($2, kBitToggle);                   }
-                  | '!' expr                                              [ZZLOG;] { $$ = new CppExpr($2, kLogNot);                      }
-                  | '*' expr %prec DEREF                                  [ZZLOG;] { $$ = new CppExpr($2, kDerefer);                     }
-                  | '&' expr %prec ADDRESSOF                              [ZZLOG;] { $$ = new CppExpr($2, kRefer);                       }
-                  | '&' operfuncname %prec ADDRESSOF                          [ZZLOG;] { $$ = new CppExpr(CppExprAtom($2), kRefer);          }
-                  | tknInc expr  %prec PREINCR                            [ZZLOG;] { $$ = new CppExpr($2, kPreIncrement);                }
-                  | expr tknInc  %prec POSTINCR                           [ZZLOG;] { $$ = new CppExpr($1, kPostIncrement);               }
-                  | tknDec expr  %prec PREDECR                            [ZZLOG;] { $$ = new CppExpr($2, kPreDecrement);                }
-                  | expr tknDec  %prec POSTDECR                           [ZZLOG;] { $$ = new CppExpr($1, kPostDecrement);               }
-                  | expr '+' expr                                         [ZZLOG;] { $$ = new CppExpr($1, kPlus, $3);                    }
-                  | expr '-' expr                                         [ZZLOG;] { $$ = new CppExpr($1, kMinus, $3);                   }
+                    ]                                                     [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, exprAtom($1), kNone);              }
+                  | '{' exprlist '}'                                      [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, CppExpr::kInitializer);        }
+                  | '{' exprlist ',' '}'                                  [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, CppExpr::kInitializer);        }
+                  | '{' exprorlist '}'                                    [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, CppExpr::kInitializer);        }
+                  | '{' exprorlist ',' '}'                                [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, CppExpr::kInitializer);        }
+                  | '{' /*empty expr*/ '}'                                [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, (CppExpr*)nullptr, CppExpr::kInitializer);   }
+                  | '-' expr %prec UNARYMINUS                             [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, kUnaryMinus);                  }
+                  | '~' expr                                              [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, kBitToggle);                   }
+                  | '!' expr                                              [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, kLogNot);                      }
+                  | '*' expr %prec DEREF                                  [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, kDerefer);                     }
+                  | '&' expr %prec ADDRESSOF                              [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, kRefer);                       }
+                  | '&' operfuncname %prec ADDRESSOF                          [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, exprAtom($2), kRefer);             }
+                  | tknInc expr  %prec PREINCR                            [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, kPreIncrement);                }
+                  | expr tknInc  %prec POSTINCR                           [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kPostIncrement);               }
+                  | tknDec expr  %prec PREDECR                            [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, kPreDecrement);                }
+                  | expr tknDec  %prec POSTDECR                           [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kPostDecrement);               }
+                  | expr '+' expr                                         [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kPlus, $3);                    }
+                  | expr '-' expr                                         [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kMinus, $3);                   }
                   | expr '*' expr
                     [
-                      if ($2.sz == gParamModPos) {
-                        gParamModPos = nullptr;
+                      if ($2.sz == yyparam->paramModPos) {
+                        yyparam->paramModPos = nullptr;
                         ZZERROR;
                       } else {
                         ZZLOG;
                       }
-                    ]                                                     [ZZLOG;] { $$ = new CppExpr($1, kMul, $3);                     }
-                  | expr '/' expr                                         [ZZLOG;] { $$ = new CppExpr($1, kDiv, $3);                     }
-                  | expr '%' expr                                         [ZZLOG;] { $$ = new CppExpr($1, kPercent, $3);                 }
+                    ]                                                     [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kMul, $3);                     }
+                  | expr '/' expr                                         [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kDiv, $3);                     }
+                  | expr '%' expr                                         [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kPercent, $3);                 }
                   | expr '&' expr
                     [
-                      if ($2.sz == gParamModPos) {
-                        gParamModPos = nullptr;
+                      if ($2.sz == yyparam->paramModPos) {
+                        yyparam->paramModPos = nullptr;
                         ZZERROR;
                       } else {
                         ZZLOG;
                       }
-                    ]                                                     [ZZLOG;] { $$ = new CppExpr($1, kBitAnd, $3);                  }
-                  | expr '|' expr                                         [ZZLOG;] { $$ = new CppExpr($1, kBitOr, $3);                   }
-                  | expr '^' expr                                         [ZZLOG;] { $$ = new CppExpr($1, kXor, $3);                     }
-                  | expr '=' expr                                         [ZZLOG;] { $$ = new CppExpr($1, kEqual, $3);                   }
-                  | expr tknLT expr                                       [ZZLOG;] { $$ = new CppExpr($1, kLess, $3);                    }
-                  | expr tknGT expr                                       [ZZLOG;] { $$ = new CppExpr($1, kGreater, $3);                 }
-                  | expr '?' expr ':' expr %prec TERNARYCOND              [ZZLOG;] { $$ = new CppExpr($1, $3, $5);                       }
-                  | expr tknPlusEq expr                                   [ZZLOG;] { $$ = new CppExpr($1, kPlusEqual, $3);               }
-                  | expr tknMinusEq expr                                  [ZZLOG;] { $$ = new CppExpr($1, kMinusEqual, $3);              }
-                  | expr tknMulEq expr                                    [ZZLOG;] { $$ = new CppExpr($1, kMulEqual, $3);                }
-                  | expr tknDivEq expr                                    [ZZLOG;] { $$ = new CppExpr($1, kDivEqual, $3);                }
-                  | expr tknPerEq expr                                    [ZZLOG;] { $$ = new CppExpr($1, kPerEqual, $3);                }
-                  | expr tknXorEq expr                                    [ZZLOG;] { $$ = new CppExpr($1, kXorEqual, $3);                }
-                  | expr tknAndEq expr                                    [ZZLOG;] { $$ = new CppExpr($1, kAndEqual, $3);                }
-                  | expr tknOrEq expr                                     [ZZLOG;] { $$ = new CppExpr($1, kOrEqual, $3);                 }
-                  | expr tknLShift expr                                   [ZZLOG;] { $$ = new CppExpr($1, kLeftShift, $3);               }
-                  | expr rshift expr                                      [ZZLOG;] { $$ = new CppExpr($1, kRightShift, $3);              }
-                  | expr tknLShiftEq expr                                 [ZZLOG;] { $$ = new CppExpr($1, kLShiftEqual, $3);             }
-                  | expr tknRShiftEq expr                                 [ZZLOG;] { $$ = new CppExpr($1, kRShiftEqual, $3);             }
-                  | expr tknCmpEq expr                                    [ZZLOG;] { $$ = new CppExpr($1, kCmpEqual, $3);                }
-                  | expr tknNotEq expr                                    [ZZLOG;] { $$ = new CppExpr($1, kNotEqual, $3);                }
-                  | expr tknLessEq expr                                   [ZZLOG;] { $$ = new CppExpr($1, kLessEqual, $3);               }
-                  | expr tknGreaterEq expr                                [ZZLOG;] { $$ = new CppExpr($1, kGreaterEqual, $3);            }
-                  | expr tkn3WayCmp expr                                  [ZZLOG;] { $$ = new CppExpr($1, k3WayCmp, $3);                 }
+                    ]                                                     [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kBitAnd, $3);                  }
+                  | expr '|' expr                                         [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kBitOr, $3);                   }
+                  | expr '^' expr                                         [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kXor, $3);                     }
+                  | expr '=' expr                                         [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kEqual, $3);                   }
+                  | expr tknLT expr                                       [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kLess, $3);                    }
+                  | expr tknGT expr                                       [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kGreater, $3);                 }
+                  | expr '?' expr ':' expr %prec TERNARYCOND              [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, $3, $5);                       }
+                  | expr tknPlusEq expr                                   [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kPlusEqual, $3);               }
+                  | expr tknMinusEq expr                                  [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kMinusEqual, $3);              }
+                  | expr tknMulEq expr                                    [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kMulEqual, $3);                }
+                  | expr tknDivEq expr                                    [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kDivEqual, $3);                }
+                  | expr tknPerEq expr                                    [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kPerEqual, $3);                }
+                  | expr tknXorEq expr                                    [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kXorEqual, $3);                }
+                  | expr tknAndEq expr                                    [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kAndEqual, $3);                }
+                  | expr tknOrEq expr                                     [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kOrEqual, $3);                 }
+                  | expr tknLShift expr                                   [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kLeftShift, $3);               }
+                  | expr rshift expr                                      [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kRightShift, $3);              }
+                  | expr tknLShiftEq expr                                 [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kLShiftEqual, $3);             }
+                  | expr tknRShiftEq expr                                 [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kRShiftEqual, $3);             }
+                  | expr tknCmpEq expr                                    [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kCmpEqual, $3);                }
+                  | expr tknNotEq expr                                    [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kNotEqual, $3);                }
+                  | expr tknLessEq expr                                   [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kLessEqual, $3);               }
+                  | expr tknGreaterEq expr                                [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kGreaterEqual, $3);            }
+                  | expr tkn3WayCmp expr                                  [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, k3WayCmp, $3);                 }
                   | expr tknAnd expr
                     [
-                      if ($2.sz == gParamModPos) {
-                        gParamModPos = nullptr;
+                      if ($2.sz == yyparam->paramModPos) {
+                        yyparam->paramModPos = nullptr;
                         ZZERROR;
                       } else {
                         ZZLOG;
                       }
-                    ]                                                     [ZZLOG;] { $$ = new CppExpr($1, kAnd, $3);                     }
-                  | expr tknOr expr                                       [ZZLOG;] { $$ = new CppExpr($1, kOr, $3);                      }
-                  | expr '.' funcname                                     [ZZLOG;] { $$ = new CppExpr($1, kDot, CppExprAtom($3));                     }
+                    ]                                                     [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kAnd, $3);                     }
+                  | expr tknOr expr                                       [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kOr, $3);                      }
+                  | expr '.' funcname                                     [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kDot, exprAtom($3));                        }
                   // Member function pointer dereferencing
-                  | expr '.' '*' funcname                                 [ZZLOG;] { $$ = new CppExpr($1, kDot, CppExprAtom(mergeCppToken($3, $4)));                     }
-                  | expr tknArrow funcname                                [ZZLOG;] { $$ = new CppExpr($1, kArrow, CppExprAtom($3));      }
-                  | expr tknArrowStar funcname                            [ZZLOG;] { $$ = new CppExpr($1, kArrowStar, CppExprAtom($3));  }
-                  | expr '.' '~' funcname                                 [ZZLOG;] { $$ = new CppExpr($1, kDot, CppExprAtom(mergeCppToken($3, $4)));                     }
-                  | expr tknArrow '~' funcname                            [ZZLOG;] { $$ = new CppExpr($1, kArrow, CppExprAtom(mergeCppToken($3, $4)));      }
-                  | expr '[' expr ']' %prec SUBSCRIPT                     [ZZLOG;] { $$ = new CppExpr($1, kArrayElem, $3);               }
-                  | expr '[' ']' %prec SUBSCRIPT                          [ZZLOG;] { $$ = new CppExpr($1, kArrayElem);                   }
-                  | expr '(' funcargs ')' %prec FUNCCALL                  [ZZLOG;] { $$ = new CppExpr($1, kFunctionCall, $3);            }
-                  | funcname '(' funcargs ')' %prec FUNCCALL              [ZZLOG;] { $$ = new CppExpr(CppExprAtom($1), kFunctionCall, $3);            }
-                  | expr tknArrow '~' identifier '(' ')' %prec FUNCCALL   [ZZLOG;] { $$ = new CppExpr(new CppExpr($1, kArrow, CppExprAtom(mergeCppToken($3, $4))), kFunctionCall, (CppExpr*)nullptr); }
+                  | expr '.' '*' funcname                                 [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kDot, exprAtom(mergeCppToken($3, $4)));                        }
+                  | expr tknArrow funcname                                [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kArrow, exprAtom($3));         }
+                  | expr tknArrowStar funcname                            [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kArrowStar, exprAtom($3));     }
+                  | expr '.' '~' funcname                                 [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kDot, exprAtom(mergeCppToken($3, $4)));                        }
+                  | expr tknArrow '~' funcname                            [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kArrow, exprAtom(mergeCppToken($3, $4)));         }
+                  | expr '[' expr ']' %prec SUBSCRIPT                     [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kArrayElem, $3);               }
+                  | expr '[' ']' %prec SUBSCRIPT                          [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kArrayElem);                   }
+                  | expr '(' funcargs ')' %prec FUNCCALL                  [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kFunctionCall, $3);            }
+                  | funcname '(' funcargs ')' %prec FUNCCALL              [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, exprAtom($1), kFunctionCall, $3);               }
+                  | expr tknArrow '~' identifier '(' ')' %prec FUNCCALL   [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, newObj<CppExpr>(yyparam->objFactory, $1, kArrow, exprAtom(mergeCppToken($3, $4))), kFunctionCall, (CppExpr*)nullptr); }
                   /* TODO: Properly support uniform initialization */
-                  | identifier '{' funcargs '}' %prec FUNCCALL            [ZZLOG;] { $$ = new CppExpr(new CppExpr((std::string) $1, kNone), kUniformInitCall, $3);            }
-                  | '(' vartype ')' expr %prec CSTYLECAST                 [ZZLOG;] { $$ = new CppExpr($2, kCStyleCast, $4);              }
-                  | tknConstCast tknLT vartype tknGT '(' expr ')'         [ZZLOG;] { $$ = new CppExpr($3, kConstCast, $6);               }
-                  | tknStaticCast tknLT vartype tknGT '(' expr ')'        [ZZLOG;] { $$ = new CppExpr($3, kStaticCast, $6);              }
-                  | tknDynamicCast tknLT vartype tknGT '(' expr ')'       [ZZLOG;] { $$ = new CppExpr($3, kDynamicCast, $6);             }
-                  | tknReinterpretCast tknLT vartype tknGT '(' expr ')'   [ZZLOG;] { $$ = new CppExpr($3, kReinterpretCast, $6);         }
+                  | identifier '{' funcargs '}' %prec FUNCCALL            [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, newObj<CppExpr>(yyparam->objFactory, exprAtom($1), kNone), kUniformInitCall, $3);                }
+                  | '(' vartype ')' expr %prec CSTYLECAST                 [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, kCStyleCast, $4);              }
+                  | tknConstCast tknLT vartype tknGT '(' expr ')'         [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $3, kConstCast, $6);               }
+                  | tknStaticCast tknLT vartype tknGT '(' expr ')'        [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $3, kStaticCast, $6);              }
+                  | tknDynamicCast tknLT vartype tknGT '(' expr ')'       [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $3, kDynamicCast, $6);             }
+                  | tknReinterpretCast tknLT vartype tknGT '(' expr ')'   [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $3, kReinterpretCast, $6);         }
                   | '(' exprorlist ')'                                    [ZZLOG;] { $$ = $2; $2->flags_ |= CppExpr::kBracketed;         }
-                  | tknNew typeidentifier opttypemodifier                 [ZZLOG;] { $$ = new CppExpr((std::string) $2, CppExpr::kNew);  }
-                  | tknNew expr                                           [ZZLOG;] { $$ = new CppExpr($2, CppExpr::kNew);  }
-                  | tknNew '(' expr ')' expr %prec tknNew                 [ZZLOG;] { $$ = new CppExpr($3, kPlacementNew, $5);            }
-                  | tknScopeResOp tknNew '(' expr ')' expr %prec tknNew   [ZZLOG;] { $$ = new CppExpr($4, kPlacementNew, $6);            }
+                  | tknNew typeidentifier opttypemodifier                 [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, exprAtom($2), CppExpr::kNew);      }
+                  | tknNew expr                                           [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $2, CppExpr::kNew);  }
+                  | tknNew '(' expr ')' expr %prec tknNew                 [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $3, kPlacementNew, $5);            }
+                  | tknScopeResOp tknNew '(' expr ')' expr %prec tknNew   [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $4, kPlacementNew, $6);            }
                   | tknDelete  expr                                       [ZZLOG;] { $$ = $2; $2->flags_ |= CppExpr::kDelete;            }
                   | tknDelete  '[' ']' expr %prec tknDelete               [ZZLOG;] { $$ = $4; $4->flags_ |= CppExpr::kDeleteArray;       }
                   | tknReturn  exprorlist                                 [ZZLOG;] { $$ = $2; $2->flags_ |= CppExpr::kReturn;            }
-                  | tknReturn                                             [ZZLOG;] { $$ = new CppExpr(CppExprAtom(), CppExpr::kReturn);  }
+                  | tknReturn                                             [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, CppExprAtom(), CppExpr::kReturn);  }
                   | tknThrow  expr                                        [ZZLOG;] { $$ = $2; $2->flags_ |= CppExpr::kThrow;             }
-                  | tknThrow                                              [ZZLOG;] { $$ = new CppExpr(CppExprAtom(), CppExpr::kThrow);   }
-                  | tknSizeOf '(' vartype ')'                             [ZZLOG;] { $$ = new CppExpr($3, CppExpr::kSizeOf);             }
-                  | tknSizeOf '(' expr ')'                                [ZZLOG;] { $$ = new CppExpr($3, CppExpr::kSizeOf);             }
-                  | tknSizeOf tknEllipsis '(' vartype ')'                 [ZZLOG;] { $$ = new CppExpr($4, CppExpr::kSizeOf | CppExpr::kVariadicPack);             }
-                  | tknSizeOf tknEllipsis '(' expr ')'                    [ZZLOG;] { $$ = new CppExpr($4, CppExpr::kSizeOf | CppExpr::kVariadicPack);             }
+                  | tknThrow                                              [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, CppExprAtom(), CppExpr::kThrow);   }
+                  | tknSizeOf '(' vartype ')'                             [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $3, CppExpr::kSizeOf);             }
+                  | tknSizeOf '(' expr ')'                                [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $3, CppExpr::kSizeOf);             }
+                  | tknSizeOf tknEllipsis '(' vartype ')'                 [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $4, CppExpr::kSizeOf | CppExpr::kVariadicPack);             }
+                  | tknSizeOf tknEllipsis '(' expr ')'                    [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $4, CppExpr::kSizeOf | CppExpr::kVariadicPack);             }
                   | expr tknEllipsis                                      [ZZLOG;] { $$ = $1; $$->flags_ |= CppExpr::kVariadicPack;      }
-                  | lambda                                                [ZZLOG;] { $$ = new CppExpr($1);                               }
-                  | tknGoto name                                          [ZZLOG;] { $$ = new CppExpr((std::string) $2, CppExpr::kGoto);               }
+                  | lambda                                                [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1);                               }
+                  | tknGoto name                                          [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, exprAtom($2), CppExpr::kGoto);                   }
 
                   /* This is to parse implementation of string user literal, see https://en.cppreference.com/w/cpp/language/user_literal */
-                  | tknNumber name                                        [ZZLOG;] { $$ = new CppExpr((std::string) $1, kNone);          }
+                  | tknNumber name                                        [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, exprAtom($1), kNone);              }
                   /* Objective C expressions */
                   /* This will need improvements, as of now the aim is just to mainly parse C++ content. */
-                  | '[' expr expr ']'                                     [ZZLOG;] { $$ = $2;          }
-                  | '[' expr objcarglist ']'                              [ZZLOG;] { $$ = $2;          }
+                  | '[' expr expr ']'                                     [ZZLOG;] { $$ = $2; delete $3; }
+                  | '[' expr objcarglist ']'                              [ZZLOG;] { $$ = $2; delete $3; }
                   ;
 
 objcarg           : name ':' expr { $$ = $3; }
                   ;
 
 objcarglist       : objcarg { $$ = $1; }
-                  | objcarglist objcarg { $$ = $1; }
+                  | objcarglist objcarg { $$ = $1; delete $2; }
                   ;
 
-exprlist          : expr ',' expr %prec COMMA                             [ZZLOG;] { $$ = new CppExpr($1, kComma, $3);                   }
-                  | exprlist ',' expr %prec COMMA                         [ZZLOG;] { $$ = new CppExpr($1, kComma, $3);                   }
+exprlist          : expr ',' expr %prec COMMA                             [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kComma, $3);                   }
+                  | exprlist ',' expr %prec COMMA                         [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, $1, kComma, $3);                   }
                   | doccommentstr exprlist                                [ZZLOG;] { $$ = $2; }
                   ;
 
@@ -1985,10 +2090,10 @@ funcargs          :             [ZZLOG;] { $$ = nullptr; }
                   | exprorlist  [ZZLOG;] { $$ = $1;      }
                   ;
 
-captureallbyref   : '&'  [ZZLOG;] { $$ = new CppExpr("", kRefer); }
+captureallbyref   : '&'  [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, "", kRefer); }
                   ;
 
-captureallbyval   : '='  [ZZLOG;] { $$ = new CppExpr("", kEqual, ""); }
+captureallbyval   : '='  [ZZLOG;] { $$ = newObj<CppExpr>(yyparam->objFactory, "", kEqual, ""); }
                   ;
 
 lambdacapture     : funcargs           [ZZLOG;]
@@ -2005,20 +2110,8 @@ exprstmt          : expr ';'           [ZZLOG;] { $$ = $1; }
 
 // clang-format on
 
-#include "parser.h"
-
-extern LexerData g;
-
 extern const char* contextNameFromState(int ctx);
 
-enum class ParseStatus {
-  NotAvailable,
-  Success,
-  Failure
-};
-
-ParseStatus gParseStatus = ParseStatus::NotAvailable;
-
 void defaultErrorHandler(const char* errLineText, size_t lineNum, size_t errorStartPos, int lexerContext)
 {
   constexpr size_t bufsize = 1024;
@@ -2040,46 +2133,34 @@ void defaultErrorHandler(const char* errLineText, size_t lineNum, size_t errorSt
   printf("%s", errmsg);
 }
 
-ErrorHandler gErrorHandler = defaultErrorHandler;
-
 /**
  * yyparser() invokes this function when it encounters unexpected token.
  */
-void yyerror_detailed  (  char*,
+void yyerror_detailed  (  yyparsecontext* yyctx,
+              char*,
               int,
               YYSTYPE&,
               YYPOSN& errt_posn
             )
 {
-  extern int getLexerContext();
+  extern int getLexerContext(void* yyscanner);
 
   const char* lineStart = errt_posn;
-  const char* buffStart = g.mInputBuffer;
+  const char* buffStart = yyparam->lexer.mInputBuffer;
   while(lineStart > buffStart)
   {
     if(lineStart[-1] == '\n' || lineStart[-1] == '\r')
       break;
     --lineStart;
   }
-  char* lineEnd = errt_posn;
-  char endReplaceChar = 0;
-  while(*lineEnd)
-  {
-    if(*lineEnd == '\r' || *lineEnd == '\n')
-    {
-      endReplaceChar = *lineEnd;
-      *lineEnd = '\0'; // So that printing of lineStart does not print things beyond current line.
-    }
-    else
-    {
-      ++lineEnd;
-    }
-  }
-  gParseStatus = ParseStatus::Failure;
-  gErrorHandler(lineStart, g.mLineNo, errt_posn - lineStart, getLexerContext());
-  // Replace back the end char
-  if(endReplaceChar)
-    *lineEnd = endReplaceChar;
+  const char* lineEnd = errt_posn;
+  while(*lineEnd && (*lineEnd != '\r') && (*lineEnd != '\n'))
+    ++lineEnd;
+  // Line is copied because input must not be modified, e.g. when it is memory mapped.
+  const std::string errLine(lineStart, lineEnd);
+  yyparam->parseStatus = ParseStatus::Failure;
+  const auto lineNo = yyparam->lexer.mLineIndex.lineNumber(errt_posn);
+  yyparam->config.errorHandler(errLine.c_str(), lineNo, errt_posn - lineStart, getLexerContext(yyparam->scanner));
 }
 
 enum {
@@ -2089,55 +2170,123 @@ enum {
   kYaccLog  = 0x004
 };
 
-static void setupEnv()
+static void trackStackValues(const Yshort* rhsStates, YYSTYPE* rhsValues, int numRhs, int rule, YYSTYPE* lhsValue)
+{
+  gStackValueOwner->mode(ParseValueOwner::Mode::kRelease);
+  for (int i = 0; i < numRhs; ++i)
+    yydestruct(0, yyastable[rhsStates[i]], rhsValues + i, nullptr);
+
+  // Empty rule, like a mid-rule action, that does not set $$ leaves there a copy of the value below it on stack.
+  const bool lhsIsNew = (numRhs > 0) || (std::memcmp(lhsValue, rhsValues - 1, sizeof(YYSTYPE)) != 0);
+  if (lhsIsNew)
+  {
+    // Nonterminals are numbered from the start symbol, which is what YYFINAL is reached by.
+    gStackValueOwner->mode(ParseValueOwner::Mode::kTake);
+    yydestruct(0, yylhs[rule] + yyastable[YYFINAL], lhsValue, nullptr);
+  }
+
+  gStackValueOwner->mode(ParseValueOwner::Mode::kReclaim);
+}
+
+static void setupEnv(yyparsecontext* yyctx)
 {
 #if YYDEBUG
   const char* yys = getenv("ZZDEBUG");
   if (yys) {
     const int yyn = *yys - '0';
 
-    gParseLog = ((yyn & kParseLog) ? 1 : 0);
-    g.mLexLog = ((yyn & kLexLog)   ? 1 : 0);
-    yydebug   = ((yyn & kYaccLog)  ? 1 : 0);
+    yyparam->parseLog     = ((yyn & kParseLog) ? 1 : 0);
+    yyparam->lexer.mLexLog = ((yyn & kLexLog)   ? 1 : 0);
+    yydebug               = ((yyn & kYaccLog)  ? 1 : 0);
   }
 #endif
 }
 
-void setErrorHandler(ErrorHandler errorHandler)
+ParseStacks::ParseStacks()
+  : ctx_(new yyparsecontext)
 {
-  gErrorHandler = errorHandler;
+  yyparse_init(ctx_.get(), nullptr);
 }
 
-void resetErrorHandler()
+ParseStacks::~ParseStacks()
 {
-  gErrorHandler = defaultErrorHandler;
+  yyparse_destroy(ctx_.get());
 }
 
-CppCompoundPtr parseStream(char* stm, size_t stmSize)
+CppCompoundPtr parseStream(char*                stm,
+                           size_t               stmSize,
+                           const ParserConfig&  config,
+                           const CppObjFactory& objFactory,
+                           bool                 textRefersToStm,
+                           ParseStats*          stats,
+                           ParseStacks*         stacks)
 {
-  gProgUnit = nullptr;
-  gCurAccessType = CppAccessType::kUnknown;
-
-  void setupScanBuffer(char* buf, size_t bufsize);
-  void cleanupScanBuffer();
-  setupScanBuffer(stm, stmSize);
-  setupEnv();
-  gTemplateParamStart = nullptr;
-  gParamModPos = nullptr;
-  gInTemplateSpec = false;
-  gDisableYyValid = 0;
-  gParseStatus = ParseStatus::NotAvailable;
-  yyparse();
-  cleanupScanBuffer();
-  CppCompoundStack tmpStack;
-  gCompoundStack.swap(tmpStack);
-
-  CppCompoundPtr ret(gProgUnit);
-  gProgUnit = nullptr;
+  void* setupScanBuffer(LexerData* lexerData, char* buf, size_t bufsize);
+  void cleanupScanBuffer(void* yyscanner);
+
+  std::unique_ptr<ParseStacks> ownStacks;
+  if (!stacks)
+  {
+    ownStacks.reset(new ParseStacks);
+    stacks = ownStacks.get();
+  }
+
+  ParserState state(config, objFactory);
+  state.textRefersToInput = textRefersToStm;
+  yyparsecontext& ctx = *stacks->context();
+  ctx.param           = &state;
+  state.scanner = setupScanBuffer(&state.lexer, stm, stmSize);
+  state.lexer.mTokenValue    = &ctx.lval;
+  state.lexer.mTokenPosition = &ctx.posn;
+  setupEnv(&ctx);
+  auto* outerStackValueOwner = std::exchange(gStackValueOwner, &state.stackValues);
+  yyparse(&ctx);
+  gStackValueOwner = outerStackValueOwner;
+  cleanupScanBuffer(state.scanner);
+  ctx.param = nullptr;
+
+  // Whatever is still owned was on stack when the parse ended and is not part of progUnit.
+  state.stackValues.mode(ParseValueOwner::Mode::kRelease);
+  state.stackValues.onValue(state.progUnit);
+  state.stackValues.reclaimAll();
+  if (stats)
+  {
+    stats->numBytesReclaimed       += state.stackValues.numBytesReclaimed();
+    stats->numTrialParses          += ctx.ntrials;
+    stats->numTokensReplayed       += ctx.nreplayed;
+    stats->numBytesCopiedForTrials += ctx.ncopied;
+  }
+  if (config.shareVarTypes && state.progUnit)
+    shareVarTypes(state.progUnit);
 
   // TODO: Make better error  handling
-  /* if (gParseStatus == ParseStatus::Failure)
+  /* if (state.parseStatus == ParseStatus::Failure)
     throw std::runtime_error("Parsing error"); */
 
-  return ret;
+  return CppCompoundPtr(state.progUnit);
+}
+
+std::vector<CppLexToken> tokenizeStream(char* stm, size_t stmSize, const ParserConfig& config)
+{
+  void* setupScanBuffer(LexerData* lexerData, char* buf, size_t bufsize);
+  void cleanupScanBuffer(void* yyscanner);
+
+  LexerData lexer;
+  configureLexer(lexer, config);
+  YYSTYPE tokenValue;
+  char*   tokenPosition = nullptr;
+  lexer.mTokenValue     = &tokenValue;
+  lexer.mTokenPosition  = &tokenPosition;
+
+  std::vector<CppLexToken> tokens;
+  auto*                    scanner = setupScanBuffer(&lexer, stm, stmSize);
+  while (const auto kind = yylex(scanner))
+  {
+    tokens.push_back(CppLexToken {kind,
+                                  static_cast<uint32_t>(tokenPosition - stm),
+                                  static_cast<uint32_t>(tokenValue.str.len)});
+  }
+  cleanupScanBuffer(scanner);
+
+  return tokens;
 }
@@ -0,0 +1,745 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "top-level-splitter.h"
+#include "lexer-helper.h"
+#include "parser.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace {
+
+bool isIdStart(char c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_');
+}
+
+bool isDigit(char c)
+{
+  return (c >= '0') && (c <= '9');
+}
+
+bool isIdChar(char c)
+{
+  return isIdStart(c) || isDigit(c);
+}
+
+bool isSpace(char c)
+{
+  return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\f') || (c == '\v');
+}
+
+bool isRawStringPrefix(std::string_view token)
+{
+  return (token == "R") || (token == "LR") || (token == "uR") || (token == "UR") || (token == "u8R");
+}
+
+/**
+ * Cursor over one physical line of a preprocessor directive.
+ * It is used to match the conditional directives that lexer evaluates, the patterns are kept same as in parser.l.
+ */
+class DirectiveLine
+{
+public:
+  explicit DirectiveLine(std::string_view line)
+    : line_(line)
+  {
+    while (!line_.empty() && (line_.back() == '\r'))
+      line_.remove_suffix(1);
+  }
+
+  bool skipSpaces()
+  {
+    const auto start = pos_;
+    while ((pos_ < line_.size()) && ((line_[pos_] == ' ') || (line_[pos_] == '\t')))
+      ++pos_;
+    return pos_ != start;
+  }
+
+  bool consume(std::string_view text)
+  {
+    if (line_.substr(pos_, text.size()) != text)
+      return false;
+    pos_ += text.size();
+    return true;
+  }
+
+  bool consumeKeyword(std::string_view keyword)
+  {
+    const auto start = pos_;
+    if (consume(keyword) && !((pos_ < line_.size()) && isIdChar(line_[pos_])))
+      return true;
+    pos_ = start;
+    return false;
+  }
+
+  std::string consumeId()
+  {
+    const auto start = pos_;
+    if ((pos_ < line_.size()) && isIdStart(line_[pos_]))
+    {
+      while ((pos_ < line_.size()) && isIdChar(line_[pos_]))
+        ++pos_;
+    }
+    return std::string(line_.substr(start, pos_ - start));
+  }
+
+  std::string consumeNumber()
+  {
+    const auto start = pos_;
+    while ((pos_ < line_.size()) && (isIdChar(line_[pos_]) || (line_[pos_] == '.') || (line_[pos_] == '\'')))
+      ++pos_;
+    if ((start == pos_) || !isDigit(line_[start]))
+      return std::string();
+    return std::string(line_.substr(start, pos_ - start));
+  }
+
+  bool peek(char c) const
+  {
+    return (pos_ < line_.size()) && (line_[pos_] == c);
+  }
+
+  bool atEnd() const
+  {
+    return pos_ == line_.size();
+  }
+
+  /// Matches IgnorableTrailingContext of parser.l till the end of line.
+  bool atIgnorableTrailingContext()
+  {
+    skipSpaces();
+    return atEnd() || (line_.substr(pos_, 2) == "//");
+  }
+
+private:
+  std::string_view line_;
+  size_t           pos_ {0};
+};
+
+enum class Evaluation
+{
+  kUnknown,
+  kEnabled,
+  kDisabled
+};
+
+Evaluation evaluation(bool enabled)
+{
+  return enabled ? Evaluation::kEnabled : Evaluation::kDisabled;
+}
+
+Evaluation evaluation(MacroDefineInfo info, MacroDefineInfo enablingInfo)
+{
+  if (info == MacroDefineInfo::kNoInfo)
+    return Evaluation::kUnknown;
+  return evaluation(info == enablingInfo);
+}
+
+/**
+ * Scans the source once, tracking just enough of lexer state to know where declarations end.
+ */
+class BoundaryScanner
+{
+public:
+  BoundaryScanner(const char* stm, size_t stmSize, const ParserConfig& config)
+    : stm_(stm)
+    , end_(strnlen(stm, stmSize))
+    , config_(config)
+  {
+  }
+
+  TopLevelBoundaries scan();
+
+private:
+  struct Bracket
+  {
+    char closer;
+    bool endsDeclaration; // Closing brace of e.g. function or namespace ends the declaration, of a class it doesn't.
+    bool isExternCBlock;
+    bool isBlob; // Lexer consumes bodies of enums or functions as a blob when configured so.
+  };
+
+  struct Conditional
+  {
+    bool evaluated; // Conditions that lexer evaluates. Others are parsed as free standing preprocessor members.
+  };
+
+  bool scanToken();
+  bool scanDirective();
+  bool skipDisabledCode();
+
+  Evaluation evaluateConditional(std::string_view line) const;
+
+  void skipLineComment();
+  void skipBlockComment();
+  void skipQuoted(char quote);
+  void skipRawString();
+  void skipPastLineEnd(size_t& pos) const;
+  size_t directiveEnd() const;
+
+  bool atCandidateLevel() const
+  {
+    return brackets_.empty() || ((brackets_.size() == 1) && brackets_.front().isExternCBlock);
+  }
+  bool insideBlob() const
+  {
+    return !brackets_.empty() && brackets_.back().isBlob;
+  }
+
+  void onSignificantToken();
+  void onDeclarationEnd();
+  void onNewLine();
+  void addBoundary(size_t offset);
+
+  void openBracket(char closer, bool isBlob);
+  bool closeBracket(char closer);
+
+private:
+  const char*         stm_;
+  const size_t        end_;
+  const ParserConfig& config_;
+
+  size_t pos_ {0};
+  size_t contentEnd_ {0}; // End of the last thing that is not white space.
+  bool   atLineStart_ {true};
+
+  std::vector<Bracket>     brackets_;
+  std::vector<Conditional> conditionals_;
+  size_t                   numEvaluatedConditionals_ {0};
+
+  bool boundaryPending_ {false};  // A declaration ended and the next line can begin a chunk.
+  bool midDeclaration_ {false};   // Some token of a declaration is seen after the previous one ended.
+  bool headHasTypeOrInit_ {false}; // Declaration so far has class, struct, union, enum, or =.
+  bool headHasEnum_ {false};
+  bool afterCloseParen_ {false};  // Last tokens were ')' possibly followed by identifiers like const or override.
+  bool externCPending_ {false};   // Last token was extern "C".
+
+  std::vector<size_t> fileLevel_ {0};
+  std::vector<size_t> externCBlockLevel_;
+  std::vector<size_t> currentExternCBlock_;
+};
+
+TopLevelBoundaries BoundaryScanner::scan()
+{
+  TopLevelBoundaries result;
+  result.end = end_;
+
+  while (pos_ < end_)
+  {
+    if (atLineStart_)
+    {
+      atLineStart_ = false;
+      while ((pos_ < end_) && isSpace(stm_[pos_]))
+        ++pos_;
+      if ((pos_ < end_) && (stm_[pos_] == '#') && !insideBlob())
+      {
+        if (!scanDirective())
+        {
+          result.fileLevel = {0};
+          return result;
+        }
+        continue;
+      }
+    }
+    if (!scanToken())
+    {
+      result.fileLevel = {0};
+      return result;
+    }
+  }
+
+  if (!brackets_.empty())
+  {
+    result.fileLevel = {0};
+    return result;
+  }
+
+  // Trailing white space is not worth a chunk of its own.
+  while ((fileLevel_.size() > 1) && (fileLevel_.back() >= contentEnd_))
+    fileLevel_.pop_back();
+
+  result.fileLevel = std::move(fileLevel_);
+  // At least 2 chunks are needed for the block to be worth splitting.
+  if (externCBlockLevel_.size() >= 3)
+    result.externCBlockLevel = std::move(externCBlockLevel_);
+
+  return result;
+}
+
+bool BoundaryScanner::scanToken()
+{
+  const char c    = stm_[pos_];
+  const char next = (pos_ + 1 < end_) ? stm_[pos_ + 1] : '\0';
+
+  if (c == '\n')
+  {
+    ++pos_;
+    onNewLine();
+    return true;
+  }
+  if (isSpace(c))
+  {
+    ++pos_;
+    return true;
+  }
+  if ((c == '/') && (next == '/'))
+  {
+    skipLineComment();
+    return true;
+  }
+  if ((c == '/') && (next == '*'))
+  {
+    skipBlockComment();
+    return true;
+  }
+
+  const bool wasExternC        = externCPending_;
+  const bool wasAfterCloseParen = afterCloseParen_;
+  onSignificantToken();
+  switch (c)
+  {
+    case '"':
+    case '\'':
+      skipQuoted(c);
+      break;
+
+    case '{':
+      ++pos_;
+      openBracket('}',
+                  (config_.parseEnumBodyAsBlob && headHasEnum_)
+                    || (config_.parseFunctionBodyAsBlob && wasAfterCloseParen));
+      headHasEnum_ = false;
+      if (brackets_.size() == 1)
+      {
+        brackets_.back().isExternCBlock = wasExternC;
+        if (wasExternC)
+        {
+          currentExternCBlock_.clear();
+          // Body of the block can begin right after the opening brace.
+          onDeclarationEnd();
+        }
+      }
+      break;
+
+    case '(':
+    case '[':
+      ++pos_;
+      openBracket((c == '(') ? ')' : ']', false);
+      break;
+
+    case '}':
+    case ')':
+    case ']':
+      ++pos_;
+      if (!closeBracket(c))
+        return false;
+      afterCloseParen_ = (c == ')');
+      break;
+
+    case ';':
+      ++pos_;
+      headHasEnum_ = false;
+      if (atCandidateLevel())
+        onDeclarationEnd();
+      break;
+
+    case '=':
+      ++pos_;
+      headHasTypeOrInit_ = true;
+      break;
+
+    default:
+      if (isIdStart(c))
+      {
+        const auto start = pos_;
+        while ((pos_ < end_) && isIdChar(stm_[pos_]))
+          ++pos_;
+        const std::string_view token(stm_ + start, pos_ - start);
+        if ((pos_ < end_) && (stm_[pos_] == '"') && isRawStringPrefix(token))
+        {
+          skipRawString();
+        }
+        else if ((pos_ < end_) && (stm_[pos_] == '\'') && ((token == "L") || (token == "u") || (token == "U")))
+        {
+          skipQuoted('\'');
+        }
+        else if (token == "extern")
+        {
+          // Lexer recognizes extern "C" only when separated by spaces on the same line.
+          auto p = pos_;
+          while ((p < end_) && ((stm_[p] == ' ') || (stm_[p] == '\t')))
+            ++p;
+          if ((p != pos_) && (strncmp(stm_ + p, "\"C\"", 3) == 0))
+          {
+            pos_            = p + 3;
+            externCPending_ = true;
+          }
+        }
+        else if ((token == "class") || (token == "struct") || (token == "union"))
+        {
+          headHasTypeOrInit_ = true;
+        }
+        else if (token == "enum")
+        {
+          headHasTypeOrInit_ = true;
+          headHasEnum_       = true;
+        }
+        else
+        {
+          // Identifiers like const, noexcept, or override can follow the parameter list of a function.
+          afterCloseParen_ = wasAfterCloseParen;
+        }
+      }
+      else if (isDigit(c) || ((c == '.') && isDigit(next)))
+      {
+        // Numbers can have digit separators which must not be mistaken as char literals.
+        ++pos_;
+        while ((pos_ < end_) && (isIdChar(stm_[pos_]) || (stm_[pos_] == '.') || (stm_[pos_] == '\'')))
+          ++pos_;
+      }
+      else
+      {
+        ++pos_;
+      }
+  }
+
+  contentEnd_ = pos_;
+  return true;
+}
+
+bool BoundaryScanner::scanDirective()
+{
+  const auto* lineFeed    = static_cast<const char*>(memchr(stm_ + pos_, '\n', end_ - pos_));
+  const auto  physicalEnd = lineFeed ? static_cast<size_t>(lineFeed - stm_) : end_;
+  const std::string_view line(stm_ + pos_, physicalEnd - pos_);
+
+  pos_        = directiveEnd();
+  contentEnd_ = pos_;
+
+  DirectiveLine directive(line);
+  directive.consume("#");
+  directive.skipSpaces();
+  const auto keyword             = directive.consumeId();
+  bool       skippedDisabledCode = false;
+  if ((keyword == "if") || (keyword == "ifdef") || (keyword == "ifndef"))
+  {
+    const auto eval = evaluateConditional(line);
+    conditionals_.push_back({eval != Evaluation::kUnknown});
+    if (conditionals_.back().evaluated)
+      ++numEvaluatedConditionals_;
+    skippedDisabledCode = (eval == Evaluation::kDisabled);
+    if (skippedDisabledCode && !skipDisabledCode())
+      return false;
+  }
+  else if (keyword == "else")
+  {
+    // Lexer doesn't evaluate #elif, the code after it stays enabled till #else.
+    skippedDisabledCode = !conditionals_.empty() && conditionals_.back().evaluated;
+    if (skippedDisabledCode && !skipDisabledCode())
+      return false;
+  }
+  else if (keyword == "endif")
+  {
+    if (!conditionals_.empty())
+    {
+      if (conditionals_.back().evaluated)
+        --numEvaluatedConditionals_;
+      conditionals_.pop_back();
+    }
+  }
+
+  // Preprocessor lines that lexer doesn't consume are members of their own.
+  // Lexer still tokenizes comments in disabled code and merges them with the comments around it,
+  // so the declaration after disabled code stays in the same chunk.
+  if (atCandidateLevel() && !midDeclaration_ && !skippedDisabledCode)
+    boundaryPending_ = true;
+
+  return true;
+}
+
+bool BoundaryScanner::skipDisabledCode()
+{
+  // Lexer looks only for conditional directives in disabled code, comments and literals are not tokenized there.
+  size_t numNestedConditionals = 0;
+  while (pos_ < end_)
+  {
+    ++pos_; // Past the new line of previous line.
+    const auto* lineFeed = static_cast<const char*>(memchr(stm_ + pos_, '\n', end_ - pos_));
+    const auto  lineEnd  = lineFeed ? static_cast<size_t>(lineFeed - stm_) : end_;
+    DirectiveLine line(std::string_view(stm_ + pos_, lineEnd - pos_));
+    pos_ = lineEnd;
+
+    line.skipSpaces();
+    if (!line.consume("#"))
+      continue;
+    line.skipSpaces();
+    if (line.consume("if"))
+    {
+      ++numNestedConditionals;
+    }
+    else if (line.consumeKeyword("else"))
+    {
+      if (numNestedConditionals == 0)
+        return true;
+    }
+    else if (line.consume("endif"))
+    {
+      if (numNestedConditionals == 0)
+      {
+        conditionals_.pop_back();
+        --numEvaluatedConditionals_;
+        return true;
+      }
+      --numNestedConditionals;
+    }
+  }
+
+  return true;
+}
+
+Evaluation BoundaryScanner::evaluateConditional(std::string_view line) const
+{
+  DirectiveLine directive(line);
+  directive.consume("#");
+  directive.skipSpaces();
+
+  const bool isIfDef = directive.consumeKeyword("ifdef");
+  if (isIfDef || directive.consumeKeyword("ifndef"))
+  {
+    if (!directive.skipSpaces())
+      return Evaluation::kUnknown;
+    const auto id = directive.consumeId();
+    if (id.empty() || !directive.atIgnorableTrailingContext())
+      return Evaluation::kUnknown;
+    const auto enablingInfo = isIfDef ? MacroDefineInfo::kDefined : MacroDefineInfo::kUndefined;
+    return evaluation(getMacroDefineInfo(config_, id), enablingInfo);
+  }
+
+  if (!directive.consumeKeyword("if") || !directive.skipSpaces())
+    return Evaluation::kUnknown;
+  if (directive.peek('0'))
+    return Evaluation::kDisabled;
+
+  if (directive.consume("!"))
+  {
+    const auto id = directive.consumeId();
+    if (id.empty() || !directive.atIgnorableTrailingContext())
+      return Evaluation::kUnknown;
+    const auto idVal = getIdValue(config_, id);
+    return idVal.has_value() ? evaluation(idVal.value() == 0) : Evaluation::kUnknown;
+  }
+
+  if (directive.consume("defined("))
+  {
+    directive.skipSpaces();
+    const auto id = directive.consumeId();
+    directive.skipSpaces();
+    if (id.empty() || !directive.consume(")") || !directive.atIgnorableTrailingContext())
+      return Evaluation::kUnknown;
+    return evaluation(getMacroDefineInfo(config_, id), MacroDefineInfo::kDefined);
+  }
+
+  const auto id    = directive.consumeId();
+  const auto idVal = id.empty() ? std::nullopt : getIdValue(config_, id);
+  if (!idVal.has_value())
+    return Evaluation::kUnknown;
+
+  directive.skipSpaces();
+  if (directive.consume(">="))
+  {
+    directive.skipSpaces();
+    const auto num = directive.consumeNumber();
+    if (num.empty() || !directive.atIgnorableTrailingContext())
+      return Evaluation::kUnknown;
+    return evaluation(idVal.value() >= atoi(num.c_str()));
+  }
+
+  if (directive.atEnd() || ((directive.consume("//") || directive.consume("/*")) && directive.atEnd()))
+    return evaluation(idVal.value() != 0);
+
+  return Evaluation::kUnknown;
+}
+
+void BoundaryScanner::skipLineComment()
+{
+  const auto* lineFeed = static_cast<const char*>(memchr(stm_ + pos_, '\n', end_ - pos_));
+  pos_                 = lineFeed ? static_cast<size_t>(lineFeed - stm_) : end_;
+  contentEnd_          = pos_;
+}
+
+void BoundaryScanner::skipBlockComment()
+{
+  const auto* commentEnd = strstr(stm_ + pos_ + 2, "*/");
+  pos_        = (commentEnd && (commentEnd < stm_ + end_)) ? static_cast<size_t>(commentEnd - stm_) + 2 : end_;
+  contentEnd_ = pos_;
+}
+
+void BoundaryScanner::skipQuoted(char quote)
+{
+  for (++pos_; pos_ < end_; ++pos_)
+  {
+    if (stm_[pos_] == '\\')
+    {
+      ++pos_;
+    }
+    else if (stm_[pos_] == quote)
+    {
+      ++pos_;
+      return;
+    }
+    else if (stm_[pos_] == '\n')
+    {
+      // Unterminated literal, let the new line be seen as usual.
+      return;
+    }
+  }
+  pos_ = end_;
+}
+
+void BoundaryScanner::skipRawString()
+{
+  // pos_ is at the opening quote of R"delimiter( ... )delimiter"
+  const auto delimStart = pos_ + 1;
+  auto       delimEnd   = delimStart;
+  while ((delimEnd < end_) && (delimEnd - delimStart <= 16) && (stm_[delimEnd] != '(') && !isSpace(stm_[delimEnd])
+         && (stm_[delimEnd] != '\n'))
+  {
+    ++delimEnd;
+  }
+  if ((delimEnd >= end_) || (stm_[delimEnd] != '('))
+  {
+    skipQuoted('"');
+    return;
+  }
+
+  const auto closing = ")" + std::string(stm_ + delimStart, delimEnd - delimStart) + "\"";
+  const auto itr     = std::string_view(stm_, end_).find(closing, delimEnd + 1);
+  pos_               = (itr == std::string_view::npos) ? end_ : itr + closing.size();
+}
+
+size_t BoundaryScanner::directiveEnd() const
+{
+  // Logical line of a directive continues after a trailing backslash and in a block comment.
+  auto p = pos_;
+  while (p < end_)
+  {
+    if (stm_[p] == '\n')
+      return p;
+    if (stm_[p] == '\\')
+    {
+      auto q = p + 1;
+      while ((q < end_) && isSpace(stm_[q]))
+        ++q;
+      p = ((q < end_) && (stm_[q] == '\n')) ? q + 1 : p + 1;
+    }
+    else if ((stm_[p] == '/') && (p + 1 < end_) && (stm_[p + 1] == '/'))
+    {
+      const auto* lineFeed = static_cast<const char*>(memchr(stm_ + p, '\n', end_ - p));
+      return lineFeed ? static_cast<size_t>(lineFeed - stm_) : end_;
+    }
+    else if ((stm_[p] == '/') && (p + 1 < end_) && (stm_[p + 1] == '*'))
+    {
+      const auto* commentEnd = strstr(stm_ + p + 2, "*/");
+      p = (commentEnd && (commentEnd < stm_ + end_)) ? static_cast<size_t>(commentEnd - stm_) + 2 : end_;
+    }
+    else
+    {
+      ++p;
+    }
+  }
+
+  return end_;
+}
+
+void BoundaryScanner::onSignificantToken()
+{
+  boundaryPending_ = false;
+  midDeclaration_  = true;
+  externCPending_  = false;
+  afterCloseParen_ = false;
+}
+
+void BoundaryScanner::onDeclarationEnd()
+{
+  boundaryPending_   = true;
+  midDeclaration_    = false;
+  headHasTypeOrInit_ = false;
+  headHasEnum_       = false;
+}
+
+void BoundaryScanner::onNewLine()
+{
+  atLineStart_ = true;
+  if (boundaryPending_ && atCandidateLevel() && (numEvaluatedConditionals_ == 0))
+    addBoundary(pos_);
+  boundaryPending_ = false;
+}
+
+void BoundaryScanner::addBoundary(size_t offset)
+{
+  if (offset >= end_)
+    return;
+  auto& boundaries = brackets_.empty() ? fileLevel_ : currentExternCBlock_;
+  if (boundaries.empty() || (boundaries.back() != offset))
+    boundaries.push_back(offset);
+}
+
+void BoundaryScanner::openBracket(char closer, bool isBlob)
+{
+  brackets_.push_back({closer, !headHasTypeOrInit_, false, isBlob});
+}
+
+bool BoundaryScanner::closeBracket(char closer)
+{
+  if (brackets_.empty() || (brackets_.back().closer != closer))
+    return false;
+
+  const auto closed = brackets_.back();
+  brackets_.pop_back();
+  if ((closer != '}') || !atCandidateLevel())
+    return true;
+
+  if (closed.isExternCBlock)
+  {
+    if (currentExternCBlock_.size() > externCBlockLevel_.size())
+      externCBlockLevel_ = std::move(currentExternCBlock_);
+    currentExternCBlock_.clear();
+    onDeclarationEnd();
+  }
+  else if (closed.endsDeclaration)
+  {
+    onDeclarationEnd();
+  }
+
+  return true;
+}
+
+} // namespace
+
+TopLevelBoundaries findTopLevelBoundaries(const char* stm, size_t stmSize, const ParserConfig& config)
+{
+  return BoundaryScanner(stm, stmSize, config).scan();
+}
@@ -0,0 +1,55 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+struct ParserConfig;
+
+/**
+ * Lines of a source where one top level declaration ends and the next one begins.
+ * At these lines the lexer is in the same state as at the start of input and the parser has nothing pending,
+ * so text between two boundaries can be parsed on its own and yields the same members as a parse of the whole source.
+ */
+struct TopLevelBoundaries
+{
+  /// Offsets of lines that begin a file level declaration, in increasing order. The first one is always 0.
+  std::vector<size_t> fileLevel;
+
+  /// Boundaries inside the biggest extern "C" block of the source, empty if that block can't be split.
+  /// Text of the block before the first one and after the last one belongs to the enclosing file level chunk.
+  std::vector<size_t> externCBlockLevel;
+
+  /// Offset where the source ends, i.e. the size of stm or the position of the first null character in it.
+  size_t end {0};
+};
+
+/**
+ * Finds top level declaration boundaries of stm.
+ * Brackets, comments, string and char literals, preprocessor lines, and the conditional code that is enabled or
+ * disabled using definitions in config are all accounted in the same way as the lexer does.
+ * When stm has anything that the scan can't account, e.g. unbalanced brackets, no boundary other than 0 is returned.
+ */
+TopLevelBoundaries findTopLevelBoundaries(const char* stm, size_t stmSize, const ParserConfig& config);
@@ -0,0 +1,134 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @return Number of threads runOnWorkStealingPool() uses for the given request, 0 means all hardware threads.
+ */
+inline size_t resolveThreadCount(size_t numThreads)
+{
+  return numThreads ? numThreads : std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+/**
+ * Runs task(worker, index) for every index in tasks, worker is the index of the thread running it.
+ * worker is always less than resolveThreadCount(numThreads), callers can use it to keep per thread data.
+ *
+ * Indices are dealt to workers round robin in the given order and every worker consumes its own queue from the front.
+ * A worker that runs out of work steals the front of the fullest queue of other workers.
+ * So, when the most expensive tasks come first they also start first and no worker is left with a big task at the end.
+ *
+ * If task throws, the first exception (in the order of tasks) is rethrown after all workers have finished.
+ */
+template <typename Task>
+void runOnWorkStealingPool(const std::vector<size_t>& tasks, size_t numThreads, Task task)
+{
+  numThreads = std::min(resolveThreadCount(numThreads), tasks.size());
+  if (numThreads <= 1)
+  {
+    for (auto idx : tasks)
+      task(0, idx);
+    return;
+  }
+
+  struct WorkQueue
+  {
+    std::mutex         mutex;
+    std::deque<size_t> indices;
+  };
+
+  std::vector<WorkQueue> queues(numThreads);
+  for (size_t i = 0; i < tasks.size(); ++i)
+    queues[i % numThreads].indices.push_back(i);
+
+  const auto popFront = [&](WorkQueue& queue, size_t& idx) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.indices.empty())
+      return false;
+    idx = queue.indices.front();
+    queue.indices.pop_front();
+    return true;
+  };
+
+  const auto steal = [&](size_t thief, size_t& idx) {
+    for (;;)
+    {
+      WorkQueue* victim     = nullptr;
+      size_t     victimSize = 0;
+      for (size_t i = 0; i < numThreads; ++i)
+      {
+        if (i == thief)
+          continue;
+        std::lock_guard<std::mutex> lock(queues[i].mutex);
+        if (queues[i].indices.size() > victimSize)
+        {
+          victim     = &queues[i];
+          victimSize = queues[i].indices.size();
+        }
+      }
+      if (victim == nullptr)
+        return false;
+      // Someone else may have emptied the victim meanwhile, look again in that case.
+      if (popFront(*victim, idx))
+        return true;
+    }
+  };
+
+  std::vector<std::exception_ptr> errors(tasks.size());
+  const auto                      worker = [&](size_t self) {
+    size_t idx = 0;
+    while (popFront(queues[self], idx) || steal(self, idx))
+    {
+      try
+      {
+        task(self, tasks[idx]);
+      }
+      catch (...)
+      {
+        errors[idx] = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < numThreads; ++i)
+    threads.emplace_back(worker, i);
+  worker(0);
+  for (auto& t : threads)
+    t.join();
+
+  for (const auto& error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
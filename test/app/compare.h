@@ -111,23 +111,22 @@ inline FileCompareResult compareFiles(const bfs::path& path1, const bfs::path& p
 inline void reportFileComparisonError(FileCompareResult    result,
                                       const bfs::path&     path1,
                                       const bfs::path&     path2,
-                                      std::pair<int, int>& diffStartsAt)
+                                      std::pair<int, int>& diffStartsAt,
+                                      std::ostream&        stm = std::cerr)
 {
   if (result == kFailedToOpen1stFile)
   {
-    std::cerr << "CppParserTest: Could not open file " << path1.string() << "\n";
+    stm << "CppParserTest: Could not open file " << path1.string() << "\n";
   }
   else if (result == kFailedToOpen2ndFile)
   {
-    std::cerr << "CppParserTest: Could not open file " << path2.string() << "\n";
+    stm << "CppParserTest: Could not open file " << path2.string() << "\n";
   }
   else if (result == kDifferentFiles)
   {
     int r, c;
     std::tie(r, c) = diffStartsAt;
-    std::cerr << "CppParserTest: File comparison failed while comparing " << path1.string() << " " << path2.string()
-              << "\n";
-    std::cerr << "CppParserTest: Error is around line#" << r << " and column#" << c << " in file " << path1.string()
-              << "\n";
+    stm << "CppParserTest: File comparison failed while comparing " << path1.string() << " " << path2.string() << "\n";
+    stm << "CppParserTest: Error is around line#" << r << " and column#" << c << " in file " << path1.string() << "\n";
   }
 }
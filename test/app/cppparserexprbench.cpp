@@ -0,0 +1,157 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Parses a file repeated many times over and reports heap allocations made per expression.
+// Usage: cppparserexprbench [file [times]], by default test/e2e/test_input/expr.cpp repeated 1000 times.
+
+#include "cppast.h"
+#include "cppparser.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+namespace bfs = boost::filesystem;
+
+namespace {
+
+std::atomic<size_t> gNumAllocations {0};
+
+const auto kDefaultInputPath = bfs::path(__FILE__).parent_path().parent_path() / "e2e/test_input/expr.cpp";
+
+size_t countExprs(const CppExprAtom& atom);
+
+size_t countExprs(const CppExpr* expr)
+{
+  if (expr == nullptr)
+    return 0;
+  return 1 + countExprs(expr->expr1_) + countExprs(expr->expr2_) + countExprs(expr->expr3_);
+}
+
+size_t countExprs(const CppExprAtom& atom)
+{
+  return (atom.type == CppExprAtom::kExpr) ? countExprs(atom.expr) : 0;
+}
+
+size_t countExprs(const CppCompound* compound)
+{
+  size_t numExprs = 0;
+  for (const auto& member : compound->members())
+  {
+    if (member->objType_ == CppExpr::kObjectType)
+      numExprs += countExprs(static_cast<const CppExpr*>(member.get()));
+  }
+  return numExprs;
+}
+
+void runBenchmark(const char* name, CppObjFactoryPtr objFactory, std::string source)
+{
+  source.append(2, '\0');
+  CppParser parser(std::move(objFactory));
+
+  const auto numAllocationsBefore = gNumAllocations.load();
+  const auto startTime            = std::chrono::steady_clock::now();
+  const auto ast                  = parser.parseStream(&source[0], source.size());
+  const auto endTime              = std::chrono::steady_clock::now();
+  const auto numAllocations       = gNumAllocations.load() - numAllocationsBefore;
+  if (!ast)
+  {
+    std::cerr << name << ": parsing failed.\n";
+    return;
+  }
+
+  const auto numExprs = countExprs(ast.get());
+  std::cout << name << ": " << numExprs << " expressions, " << numAllocations << " allocations, "
+            << static_cast<double>(numAllocations) / numExprs << " allocations per expression, "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count() << " ms\n";
+}
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+  ++gNumAllocations;
+  if (void* ptr = std::malloc(size ? size : 1))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+// Slabs of arena are allocated aligned.
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  ++gNumAllocations;
+  const auto align = static_cast<std::size_t>(alignment);
+  if (void* ptr = std::aligned_alloc(align, (size + align - 1) / align * align))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+  std::free(ptr);
+}
+
+int main(int argc, char** argv)
+{
+  const std::string inputPath = (argc > 1) ? argv[1] : kDefaultInputPath.string();
+  const size_t      numTimes  = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 1000;
+
+  std::ifstream stm(inputPath, std::ios_base::binary);
+  if (!stm)
+  {
+    std::cerr << "Unable to read " << inputPath << ".\n";
+    return 1;
+  }
+  const std::string content((std::istreambuf_iterator<char>(stm)), std::istreambuf_iterator<char>());
+  std::string       source;
+  source.reserve((content.size() + 1) * numTimes);
+  for (size_t i = 0; i < numTimes; ++i)
+    source.append(content).append("\n");
+
+  runBenchmark("heap", nullptr, source);
+  runBenchmark("arena", CppObjFactoryPtr(new CppArenaObjFactory), source);
+
+  return 0;
+}
@@ -0,0 +1,189 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Parses files and reports how long repeated traversal of their ASTs takes using traversePreorder()
+// and using CppFrozenAst made from them.
+// Usage: cppparserfrozenbench [path [times]], by default all files of test/e2e/test_input traversed 100 times.
+
+#include "cppast.h"
+#include "cppcompound-info-accessor.h"
+#include "cppfrozen-ast.h"
+#include "cppparser.h"
+#include "e2e-parser-config.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+namespace bfs = boost::filesystem;
+
+namespace {
+
+const auto kDefaultInputPath = bfs::path(__FILE__).parent_path().parent_path() / "e2e/test_input";
+
+struct TraversalResult
+{
+  size_t numVisited {0};
+  size_t checksum {0};
+};
+
+// Touches what an analysis pass typically reads from every node, its type, and name of compounds.
+TraversalResult traverseAst(const CppCompound* ast)
+{
+  TraversalResult result;
+  traversePreorder(ast, [&result](const CppObj* obj) {
+    ++result.numVisited;
+    result.checksum += static_cast<size_t>(obj->objType_);
+    if (obj->objType_ == CppObjType::kCompound)
+      result.checksum += static_cast<const CppCompound*>(obj)->name().size();
+    return false;
+  });
+  return result;
+}
+
+// Visits the same nodes as traverseAst(), subtrees of nodes other than namespace-like compounds are skipped.
+TraversalResult traverseFrozenAst(const CppFrozenAst& ast)
+{
+  TraversalResult result;
+  for (CppFrozenNodeId id = 1; id < ast.numNodes();)
+  {
+    ++result.numVisited;
+    const auto objType = ast.objType(id);
+    result.checksum += static_cast<size_t>(objType);
+    if ((objType == CppObjType::kCompound) && (ast.compound(id).compoundType() & CppCompoundType::kNamespace))
+    {
+      result.checksum += ast.name(id).size();
+      ++id;
+    }
+    else
+    {
+      if (objType == CppObjType::kCompound)
+        result.checksum += ast.name(id).size();
+      id = ast.subtreeEnd(id);
+    }
+  }
+  return result;
+}
+
+// Visits every node of frozen AST, including function bodies and parameters.
+TraversalResult scanFrozenAst(const CppFrozenAst& ast)
+{
+  TraversalResult result;
+  for (CppFrozenNodeId id = 1; id < ast.numNodes(); ++id)
+  {
+    ++result.numVisited;
+    result.checksum += static_cast<size_t>(ast.objType(id)) + ast.name(id).size();
+  }
+  return result;
+}
+
+template <typename _Asts, typename _Traverse>
+TraversalResult timeTraversals(const char* what, const _Asts& asts, size_t numTimes, const _Traverse& traverse)
+{
+  TraversalResult total;
+  const auto      startTime = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < numTimes; ++i)
+  {
+    for (const auto& ast : asts)
+    {
+      const auto result = traverse(ast);
+      total.numVisited += result.numVisited;
+      total.checksum += result.checksum;
+    }
+  }
+  const auto endTime = std::chrono::steady_clock::now();
+
+  const auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+  std::cout << what << ": " << total.numVisited / numTimes << " nodes " << numTimes << " times in "
+            << elapsedNs / 1000000 << " ms, " << static_cast<double>(elapsedNs) / static_cast<double>(total.numVisited)
+            << " ns per node (checksum " << total.checksum << ")\n";
+  return total;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const bfs::path inputPath = (argc > 1) ? bfs::path(argv[1]) : kDefaultInputPath;
+  const size_t    numTimes  = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 100;
+
+  std::vector<std::string> files;
+  if (bfs::is_directory(inputPath))
+  {
+    for (const auto& entry : bfs::recursive_directory_iterator(inputPath))
+    {
+      if (bfs::is_regular_file(entry.path()))
+        files.push_back(entry.path().string());
+    }
+  }
+  else
+  {
+    files.push_back(inputPath.string());
+  }
+
+  auto parser = constructCppParserForTest();
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+
+  std::vector<CppCompoundPtr> asts;
+  for (const auto& file : files)
+  {
+    if (auto ast = parser.parseFile(file))
+      asts.push_back(std::move(ast));
+  }
+  if (asts.empty())
+  {
+    std::cerr << "Nothing to traverse in " << inputPath.string() << ".\n";
+    return 1;
+  }
+
+  const auto                freezeStart = std::chrono::steady_clock::now();
+  std::vector<CppFrozenAst> frozenAsts;
+  size_t                    frozenBytes = 0;
+  frozenAsts.reserve(asts.size());
+  for (const auto& ast : asts)
+  {
+    frozenAsts.emplace_back(*ast);
+    frozenBytes += frozenAsts.back().numBytes();
+  }
+  const auto freezeNs =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - freezeStart).count();
+  std::cout << asts.size() << " files frozen in " << freezeNs / 1000000 << " ms into " << frozenBytes << " bytes\n";
+
+  const auto astResult    = timeTraversals("traversePreorder", asts, numTimes, [](const CppCompoundPtr& ast) {
+    return traverseAst(ast.get());
+  });
+  const auto frozenResult = timeTraversals("CppFrozenAst", frozenAsts, numTimes, traverseFrozenAst);
+  timeTraversals("CppFrozenAst, every node", frozenAsts, numTimes, scanFrozenAst);
+
+  if ((astResult.numVisited != frozenResult.numVisited) || (astResult.checksum != frozenResult.checksum))
+  {
+    std::cerr << "Frozen AST traversal visited different nodes.\n";
+    return 1;
+  }
+
+  return 0;
+}
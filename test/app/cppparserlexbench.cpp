@@ -0,0 +1,138 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Reports lexer throughput, in tokens/s and MB/s, for each directory of input and how it compares with parsing.
+// Usage: cppparserlexbench [path [times]], by default each directory of test/e2e/test_input lexed 10 times.
+
+#include "cppparser.h"
+#include "e2e-parser-config.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+namespace bfs = boost::filesystem;
+
+namespace {
+
+const auto kDefaultInputPath = bfs::path(__FILE__).parent_path().parent_path() / "e2e/test_input";
+
+// Contents of files padded with the null chars that lexer needs at the end.
+using Sources = std::vector<std::string>;
+
+std::map<std::string, Sources> readSourcesByDirectory(const bfs::path& inputPath)
+{
+  std::map<std::string, Sources> sourcesByDir;
+  const auto                     addSource = [&sourcesByDir](const std::string& dir, const bfs::path& file) {
+    std::ifstream stm(file.string(), std::ios_base::binary);
+    std::string   source((std::istreambuf_iterator<char>(stm)), std::istreambuf_iterator<char>());
+    source.append(2, '\0');
+    sourcesByDir[dir].push_back(std::move(source));
+  };
+
+  if (!bfs::is_directory(inputPath))
+  {
+    addSource(inputPath.filename().string(), inputPath);
+    return sourcesByDir;
+  }
+  for (bfs::recursive_directory_iterator dirItr(inputPath); dirItr != bfs::recursive_directory_iterator(); ++dirItr)
+  {
+    if (!bfs::is_regular_file(*dirItr))
+      continue;
+    // Files directly inside input path are grouped together under the name of input path.
+    const auto relPath = bfs::relative(dirItr->path(), inputPath);
+    const auto dir     = (std::distance(relPath.begin(), relPath.end()) > 1) ? relPath.begin()->string()
+                                                                               : inputPath.filename().string();
+    addSource(dir, dirItr->path());
+  }
+
+  return sourcesByDir;
+}
+
+double elapsedSeconds(std::chrono::steady_clock::time_point startTime)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void runBenchmark(const std::string& dir, Sources& sources, size_t numTimes)
+{
+  auto parser = constructCppParserForTest();
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+
+  size_t numBytes = 0;
+  for (const auto& source : sources)
+    numBytes += source.size() - 2;
+
+  size_t     numTokens = 0;
+  const auto lexStart  = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < numTimes; ++i)
+  {
+    for (auto& source : sources)
+      numTokens += parser.tokenize(&source[0], source.size()).size();
+  }
+  const auto lexSeconds = elapsedSeconds(lexStart) / numTimes;
+  numTokens /= numTimes;
+
+  size_t     numParsed  = 0;
+  const auto parseStart = std::chrono::steady_clock::now();
+  for (auto& source : sources)
+  {
+    if (parser.parseStream(&source[0], source.size()))
+      ++numParsed;
+  }
+  const auto parseSeconds = elapsedSeconds(parseStart);
+
+  const auto megaBytes = static_cast<double>(numBytes) / (1024 * 1024);
+  std::cout << dir << ": " << sources.size() << " files, " << megaBytes << " MB, " << numTokens << " tokens\n"
+            << "  lexing:  " << lexSeconds * 1000 << " ms, " << numTokens / lexSeconds << " tokens/s, "
+            << megaBytes / lexSeconds << " MB/s\n"
+            << "  parsing: " << parseSeconds * 1000 << " ms, " << megaBytes / parseSeconds << " MB/s, " << numParsed
+            << " files parsed, lexing takes " << 100 * lexSeconds / parseSeconds << "% of that time\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const bfs::path inputPath = (argc > 1) ? bfs::path(argv[1]) : kDefaultInputPath;
+  const size_t    numTimes  = (argc > 2) ? std::max<size_t>(1, std::strtoul(argv[2], nullptr, 10)) : 10;
+
+  auto sourcesByDir = readSourcesByDirectory(inputPath);
+  if (sourcesByDir.empty())
+  {
+    std::cerr << "Nothing to lex in " << inputPath.string() << ".\n";
+    return 1;
+  }
+  for (auto& dirAndSources : sourcesByDir)
+    runBenchmark(dirAndSources.first, dirAndSources.second, numTimes);
+
+  return 0;
+}
@@ -0,0 +1,191 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Parses files and reports how long repeated traversal of enum items, inheritance lists, member initializers,
+// and template parameters takes.
+// Usage: cppparsertraversalbench [path [times]], by default all files of test/e2e/test_input traversed 1000 times.
+
+#include "cppast.h"
+#include "cppparser.h"
+#include "e2e-parser-config.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+namespace bfs = boost::filesystem;
+
+namespace {
+
+const auto kDefaultInputPath = bfs::path(__FILE__).parent_path().parent_path() / "e2e/test_input";
+
+struct TraversedLists
+{
+  std::vector<const CppEnumItemList*>      enumItemLists;
+  std::vector<const CppInheritanceList*>   inheritanceLists;
+  std::vector<const CppMemInitList*>       memInitLists;
+  std::vector<const CppTemplateParamList*> templateParamLists;
+};
+
+void addTemplateParamList(const CppTemplateParamList* templParamList, TraversedLists& lists)
+{
+  if (templParamList)
+    lists.templateParamLists.push_back(templParamList);
+}
+
+void collectLists(const CppCompound* compound, TraversedLists& lists)
+{
+  if (compound->inheritanceList())
+    lists.inheritanceLists.push_back(compound->inheritanceList().get());
+  addTemplateParamList(compound->templateParamList(), lists);
+
+  for (const auto& member : compound->members())
+  {
+    switch (member->objType_)
+    {
+      case CppObjType::kCompound:
+        collectLists(static_cast<const CppCompound*>(member.get()), lists);
+        break;
+      case CppObjType::kEnum:
+        if (const auto& itemList = static_cast<const CppEnum*>(member.get())->itemList_)
+          lists.enumItemLists.push_back(itemList.get());
+        break;
+      case CppObjType::kConstructor:
+      {
+        const auto* ctor = static_cast<const CppConstructor*>(member.get());
+        if (!ctor->memInits_.memInitListIsABlob_ && ctor->memInits_.memInitList)
+          lists.memInitLists.push_back(ctor->memInits_.memInitList);
+        addTemplateParamList(ctor->templateParamList(), lists);
+      }
+      break;
+      case CppObjType::kFunction:
+        addTemplateParamList(static_cast<const CppFunction*>(member.get())->templateParamList(), lists);
+        break;
+      case CppObjType::kFwdClsDecl:
+        addTemplateParamList(static_cast<const CppFwdClsDecl*>(member.get())->templateParamList(), lists);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+// Touches what a consumer like CppWriter reads from every element.
+size_t traverse(const TraversedLists& lists)
+{
+  size_t checksum = 0;
+  for (const auto* itemList : lists.enumItemLists)
+  {
+    for (const auto& item : *itemList)
+      checksum += item.name_.size() + (item.val_ != nullptr);
+  }
+  for (const auto* inheritanceList : lists.inheritanceLists)
+  {
+    for (const auto& inheritInfo : *inheritanceList)
+      checksum += inheritInfo.baseName.size() + static_cast<size_t>(inheritInfo.inhType);
+  }
+  for (const auto* memInitList : lists.memInitLists)
+  {
+    for (const auto& memInit : *memInitList)
+      checksum += memInit.first.size() + (memInit.second != nullptr);
+  }
+  for (const auto* templParamList : lists.templateParamLists)
+  {
+    for (const auto& templParam : *templParamList)
+      checksum += (templParam.paramType_ != nullptr) + (templParam.defaultArg() != nullptr);
+  }
+  return checksum;
+}
+
+template <typename Lists>
+size_t countElements(const Lists& lists)
+{
+  size_t numElements = 0;
+  for (const auto* list : lists)
+    numElements += list->size();
+  return numElements;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const bfs::path inputPath = (argc > 1) ? bfs::path(argv[1]) : kDefaultInputPath;
+  const size_t    numTimes  = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 1000;
+
+  std::vector<std::string> files;
+  if (bfs::is_directory(inputPath))
+  {
+    for (const auto& entry : bfs::recursive_directory_iterator(inputPath))
+    {
+      if (bfs::is_regular_file(entry.path()))
+        files.push_back(entry.path().string());
+    }
+  }
+  else
+  {
+    files.push_back(inputPath.string());
+  }
+
+  auto parser = constructCppParserForTest();
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+
+  std::vector<CppCompoundPtr> asts;
+  TraversedLists              lists;
+  for (const auto& file : files)
+  {
+    auto ast = parser.parseFile(file);
+    if (!ast)
+      continue;
+    collectLists(ast.get(), lists);
+    asts.push_back(std::move(ast));
+  }
+
+  const auto numElements = countElements(lists.enumItemLists) + countElements(lists.inheritanceLists)
+                           + countElements(lists.memInitLists) + countElements(lists.templateParamLists);
+  if (numElements == 0)
+  {
+    std::cerr << "Nothing to traverse in " << inputPath.string() << ".\n";
+    return 1;
+  }
+
+  size_t     checksum  = 0;
+  const auto startTime = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < numTimes; ++i)
+    checksum += traverse(lists);
+  const auto endTime = std::chrono::steady_clock::now();
+
+  const auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+  std::cout << asts.size() << " files, " << countElements(lists.enumItemLists) << " enum items, "
+            << countElements(lists.inheritanceLists) << " base classes, " << countElements(lists.memInitLists)
+            << " member initializers, " << countElements(lists.templateParamLists) << " template params\n";
+  std::cout << numTimes << " traversals in " << elapsedNs / 1000000 << " ms, "
+            << static_cast<double>(elapsedNs) / (static_cast<double>(numElements) * numTimes)
+            << " ns per element (checksum " << checksum << ")\n";
+
+  return 0;
+}
@@ -37,6 +37,9 @@ struct TestParam
   bfs::path inputPath;
   bfs::path outputPath;
   bfs::path masterPath;
+  bfs::path latencyReportPath;
+  bfs::path memReportPath; // Empty if memory report is not sought.
+  size_t    numJobs {1}; // 0 means one per hardware thread.
 
   bool isValid() const
   {
@@ -67,6 +70,7 @@ public:
   enum ParseResult
   {
     kHelpSought,
+    kPrintNodeSizes,
     kParseSingleFile,
     kParseAndCompare,
     kParseAndCompareUsingDefaultPaths = kParseAndCompare,
@@ -86,7 +90,19 @@ public:
       "master-files-folder,m",
       bpo::value<std::string>(),
       "Folder where master files are kept that are used to compare with actuals.")(
-      "parse-single-file,p", bpo::value<std::string>(), "To test parsing of single file.");
+      "parse-single-file,p", bpo::value<std::string>(), "To test parsing of single file.")(
+      "node-sizes", "Print size of every AST node type along with its size budget.")(
+      "jobs,j",
+      bpo::value<size_t>(),
+      "Number of files to test in parallel, 0 means one per hardware thread. Default is 1.")(
+      "latency-report,r",
+      bpo::value<std::string>(),
+      "File to write parse time, emit time, and AST size of each file into, slowest first.\n"
+      "Default is latency-report.tsv in output folder.")(
+      "mem-report",
+      bpo::value<std::string>()->implicit_value(""),
+      "File to write memory used by AST of every node type, and of each file relative to its size, into.\n"
+      "Default is mem-report.tsv in output folder.");
   }
 
   ParseResult parse(int argc, char** argv)
@@ -100,6 +116,8 @@ public:
       return kHelpSought;
     }
 
+    if (vm_.count("node-sizes") != 0)
+      return kPrintNodeSizes;
     if (vm_.count("parse-single-file") != 0)
       return kParseSingleFile;
     if ((vm_.count("input-folder") == 0) && (vm_.count("output-folder") == 0)
@@ -128,6 +146,18 @@ public:
       param.masterPath = vm_["master-files-folder"].as<std::string>();
     else
       param.masterPath = defaultTestFolderParent / "test_master";
+    if (vm_.count("latency-report"))
+      param.latencyReportPath = vm_["latency-report"].as<std::string>();
+    else
+      param.latencyReportPath = param.outputPath / "latency-report.tsv";
+    if (vm_.count("mem-report"))
+    {
+      param.memReportPath = vm_["mem-report"].as<std::string>();
+      if (param.memReportPath.empty())
+        param.memReportPath = param.outputPath / "mem-report.tsv";
+    }
+    if (vm_.count("jobs"))
+      param.numJobs = vm_["jobs"].as<size_t>();
 
     param.setup();
     return param;
@@ -0,0 +1,107 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include "cppobjfactory.h"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+CppParser constructParser(CppObjFactoryPtr objFactory)
+{
+  auto parser = constructCppParserForTest(std::move(objFactory));
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+
+  return parser;
+}
+
+} // namespace
+
+TEST_CASE("AST created by arena backed factory is same as the one created on heap")
+{
+  auto heapParser  = constructParser(nullptr);
+  auto arenaParser = constructParser(CppObjFactoryPtr(new CppArenaObjFactory));
+
+  std::vector<CppCompoundPtr> arenaAsts;
+  for (const auto& file : collectE2eInputFiles())
+  {
+    INFO(file);
+    auto arenaAst = arenaParser.parseFile(file);
+    CHECK(emit(arenaAst) == emit(heapParser.parseFile(file)));
+    arenaAsts.push_back(std::move(arenaAst));
+  }
+  REQUIRE(!arenaAsts.empty());
+
+  // Nodes must be deletable from a thread other than the one that allocated them.
+  std::thread([&arenaAsts]() { arenaAsts.clear(); }).join();
+}
+
+TEST_CASE("Arena backed AST can outlive the thread that parsed it")
+{
+  const auto     source = std::string("class A { int x; void f(); };\nnamespace N { enum E { a, b }; }\n");
+  CppCompoundPtr ast;
+  std::thread([&]() {
+    auto parser = constructParser(CppObjFactoryPtr(new CppArenaObjFactory));
+    ast         = parse(parser, source);
+  }).join();
+
+  REQUIRE(ast != nullptr);
+  CHECK(emit(ast).find("namespace N") != std::string::npos);
+}
+
+TEST_CASE("Nodes of heap and of arena can be mixed in one AST")
+{
+  const CppObjFactory      heapFactory;
+  const CppArenaObjFactory arenaFactory;
+
+  // Enough nodes to fill many slabs, deleted in an order other than the one they are created in.
+  constexpr size_t kNumNodes = 100000;
+  auto             ast       = std::make_unique<CppCompound>(CppCompoundType::kCppFile);
+  for (size_t i = 0; i < kNumNodes; ++i)
+  {
+    const auto& objFactory = (i % 3 == 0) ? static_cast<const CppObjFactory&>(heapFactory) : arenaFactory;
+    ast->addMember(objFactory.Create<CppExpr>("a" + std::to_string(i)));
+  }
+  REQUIRE(ast->members().size() == kNumNodes);
+  CHECK(emit(ast.get()).find("a99999;") != std::string::npos);
+
+  std::vector<CppObjPtr> members;
+  while (!ast->members().empty())
+    members.push_back(ast->deassocMemberAt(ast->members().size() - 1));
+  std::thread([&members]() {
+    constexpr size_t kStride = 7;
+    for (size_t start = 0; start < kStride; ++start)
+    {
+      for (size_t i = start; i < members.size(); i += kStride)
+        members[i].reset();
+    }
+  }).join();
+  CHECK(std::all_of(members.begin(), members.end(), [](const CppObjPtr& mem) { return mem == nullptr; }));
+}
@@ -68,14 +68,14 @@ TEST_CASE_METHOD(CppAtributeTest, "Attribute specifier sequence")
 
   CppExprEPtr classAttrib1 = classAttribSeq->at(1);
   REQUIRE(classAttrib1);
-  REQUIRE(classAttrib1->expr1_.atom);
-  CHECK(*(classAttrib1->expr1_.atom) == "xnet::Route");
+  REQUIRE(classAttrib1->expr1_.type == CppExprAtom::kAtom);
+  CHECK(classAttrib1->expr1_.atom() == "xnet::Route");
   CHECK(classAttrib1->oper_ == CppOperator::kFunctionCall);
   const auto funcArgs = classAttrib1->expr2_.expr;
   REQUIRE(funcArgs);
   CHECK(funcArgs->expr1_.type == CppExprAtom::kAtom);
-  REQUIRE(funcArgs->expr1_.atom);
-  CHECK(*(funcArgs->expr1_.atom) == "\"/plakmp\"");
+  REQUIRE(funcArgs->expr1_.type == CppExprAtom::kAtom);
+  CHECK(funcArgs->expr1_.atom() == "\"/plakmp\"");
 
   const auto& classMembers = classDefn->members();
   REQUIRE(classMembers.size() == 3);
@@ -95,12 +95,12 @@ TEST_CASE_METHOD(CppAtributeTest, "Attribute specifier sequence")
 
   CppExprEPtr methodAttrib1 = attribSeqGetPlakMpPlayers->at(1);
   REQUIRE(methodAttrib1);
-  REQUIRE(methodAttrib1->expr1_.atom);
-  CHECK(*(methodAttrib1->expr1_.atom) == "xnet::Route");
+  REQUIRE(methodAttrib1->expr1_.type == CppExprAtom::kAtom);
+  CHECK(methodAttrib1->expr1_.atom() == "xnet::Route");
   CHECK(methodAttrib1->oper_ == CppOperator::kFunctionCall);
   const auto funcArgs2 = methodAttrib1->expr2_.expr;
   REQUIRE(funcArgs2);
   CHECK(funcArgs2->expr1_.type == CppExprAtom::kAtom);
-  REQUIRE(funcArgs2->expr1_.atom);
-  CHECK(*(funcArgs2->expr1_.atom) == "\"/players\"");
+  REQUIRE(funcArgs2->expr1_.type == CppExprAtom::kAtom);
+  CHECK(funcArgs2->expr1_.atom() == "\"/players\"");
 }
@@ -0,0 +1,159 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include "blob-skipper.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<size_t> lineStartOffsets(const std::string& text)
+{
+  std::vector<const char*> lineStarts;
+  appendLineStarts(text.data(), text.data() + text.size(), lineStarts);
+  std::vector<size_t> offsets;
+  for (const auto* lineStart : lineStarts)
+    offsets.push_back(lineStart - text.data());
+  return offsets;
+}
+
+// Offset where skipping of function body that starts at offset from of body stops.
+size_t functionBodySkipStop(const std::string& body, size_t from, bool stopAtDirective = false)
+{
+  const auto* input = body.data();
+  return skipFunctionBody(input, input + body.size(), input + from, 0, stopAtDirective).stop - input;
+}
+
+} // namespace
+
+TEST_CASE("Line starts are found the way lexer counts new lines")
+{
+  CHECK(lineStartOffsets("").empty());
+  CHECK(lineStartOffsets("a\nb\r\nc\rd") == std::vector<size_t> {2, 5, 7});
+
+  // Long enough to be scanned a block at a time, with "\r\n" split at every possible position.
+  std::string text;
+  for (int i = 0; i < 40; ++i)
+    text += (i % 3 == 0) ? "ab\r\n" : ((i % 3 == 1) ? "c\n" : "def\r");
+  for (size_t pos = 0; pos < 64; ++pos)
+  {
+    const auto prefix  = std::string(pos, ' ') + text;
+    const auto offsets = lineStartOffsets(prefix);
+    REQUIRE(offsets.size() == 40);
+    CHECK(offsets[0] == pos + 4);
+    CHECK(offsets[39] == prefix.size());
+  }
+}
+
+TEST_CASE("Function body is skipped till the char before its closing brace")
+{
+  const std::string body = "\n"
+                           "  if (x) {\n"
+                           "    s = \"}\\\"\";\n"
+                           "    c = '{';\n"
+                           "    r = R\"raw(})raw\";\n"
+                           "  }\n"
+                           "  // }\n"
+                           "  n = 1'000 + u'}';\n"
+                           "}";
+  const auto* input = body.data();
+  const auto  skip  = skipFunctionBody(input, input + body.size(), input, 0, false);
+  CHECK(skip.stop == input + body.size() - 2);
+  CHECK(skip.depth == 0);
+
+  // Brace of a nested block that closes right before the body is left for lexer.
+  const std::string nested = " if (x) { y(); }}";
+  const auto        nestedSkip = skipFunctionBody(nested.data(), nested.data() + nested.size(), nested.data(), 0, false);
+  CHECK(nestedSkip.stop == nested.data() + nested.size() - 2);
+  CHECK(nestedSkip.depth == 1);
+
+  CHECK(functionBodySkipStop("}", 0) == 0);
+  CHECK(functionBodySkipStop(" x; /* } */ }", 0) == 4);
+  CHECK(functionBodySkipStop(" x;\n  #ifdef A\n }", 0) == 15);
+  CHECK(functionBodySkipStop(" x;\n  #ifdef A\n }", 0, true) == 4);
+  CHECK(functionBodySkipStop(" x = a # b;\n }", 0, true) == 12);
+}
+
+TEST_CASE("Disabled code and block comments are skipped a line at a time")
+{
+  const std::string disabled = "int x;\n"
+                               "char* s = \"{\";\n"
+                               "  int y; // comment\n"
+                               "# endif\n";
+  const auto* input = disabled.data();
+  const auto  skip  = skipDisabledCode(input, input + disabled.size(), input);
+  CHECK(skip.stop == input + disabled.find("  int y"));
+
+  // From the middle of a line which has '/' nothing is skipped.
+  const auto* midLine = input + disabled.find("y;");
+  CHECK(skipDisabledCode(input, input + disabled.size(), midLine).stop == midLine);
+
+  const std::string blockComment = " * Some text\n"
+                                   " * more # text\r\n"
+                                   " * and/or\n"
+                                   " */";
+  const auto* commentInput = blockComment.data();
+  const auto  commentSkip  = skipBlockComment(commentInput, commentInput + blockComment.size(), commentInput);
+  CHECK(commentSkip.stop == commentInput + blockComment.find(" * and"));
+
+  const std::string loneCr = " text\n text\r text\n";
+  CHECK(skipBlockComment(loneCr.data(), loneCr.data() + loneCr.size(), loneCr.data()).stop == loneCr.data() + 6);
+}
+
+TEST_CASE("End of block comment is found past slashes inside it")
+{
+  const std::string comment = "/ a/b ** //\n */ int x;";
+  const auto*       input   = comment.data();
+  CHECK(findBlockCommentEnd(input, input + comment.size()) == input + comment.find(" int"));
+
+  const std::string unclosed = " text */";
+  CHECK(findBlockCommentEnd(unclosed.data(), unclosed.data() + 6) == unclosed.data() + 6);
+}
+
+TEST_CASE("Braces in literals of function body parsed as blob")
+{
+  CppParser parser;
+  parser.parseFunctionBodyAsBlob(true);
+  const auto ast = parse(parser,
+                         "void f()\n"
+                         "{\n"
+                         "  const char* s = \"}\";\n"
+                         "  char c = '{';\n"
+                         "}\n"
+                         "int x;\n");
+  REQUIRE(ast != nullptr);
+
+  const auto& members = ast->members();
+  REQUIRE(members.size() == 2);
+  CppConstFunctionEPtr func = members[0];
+  REQUIRE(func);
+  REQUIRE(func->defn());
+  CHECK(func->defn()->hasASingleBlobMember());
+  CppConstVarEPtr var = members[1];
+  CHECK(var);
+}
@@ -0,0 +1,169 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include "cppprog.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bfs = boost::filesystem;
+
+namespace {
+
+CppParser constructParser()
+{
+  auto parser = constructCppParserForTest();
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+
+  return parser;
+}
+
+std::string parseAndEmit(CppParser& parser, const std::string& file)
+{
+  return emit(parser.parseFile(file));
+}
+
+void compareTypeTrees(const CppTypeTreeNode& lhs, const CppTypeTreeNode& rhs)
+{
+  CHECK(lhs.cppObjSet.size() == rhs.cppObjSet.size());
+  REQUIRE(lhs.children.size() == rhs.children.size());
+  for (const auto& lhsChild : lhs.children)
+  {
+    const auto rhsItr = rhs.children.find(lhsChild.first);
+    REQUIRE(rhsItr != rhs.children.end());
+    compareTypeTrees(lhsChild.second, rhsItr->second);
+  }
+}
+
+} // namespace
+
+TEST_CASE("Parsing e2e test inputs from many threads matches single threaded parsing")
+{
+  const auto files = collectE2eInputFiles();
+  REQUIRE(!files.empty());
+
+  std::vector<std::string> expected;
+  {
+    auto parser = constructParser();
+    for (const auto& file : files)
+      expected.push_back(parseAndEmit(parser, file));
+  }
+
+  constexpr size_t         kNumThreads = 16;
+  std::vector<std::string> actual(files.size());
+  std::atomic<size_t>      nextFile {0};
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kNumThreads; ++i)
+  {
+    threads.emplace_back([&]() {
+      auto parser = constructParser();
+      for (auto idx = nextFile++; idx < files.size(); idx = nextFile++)
+        actual[idx] = parseAndEmit(parser, files[idx]);
+    });
+  }
+  for (auto& t : threads)
+    t.join();
+
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    INFO(files[i]);
+    CHECK(actual[i] == expected[i]);
+  }
+}
+
+TEST_CASE("CppProgram built using many threads is same as the one built serially")
+{
+  const CppProgram serialProgram(kE2eInputPath.string(), constructParser());
+  const CppProgram parallelProgram(kE2eInputPath.string(), 16, constructParser);
+
+  const auto& serialAsts   = serialProgram.getFileAsts();
+  const auto& parallelAsts = parallelProgram.getFileAsts();
+  REQUIRE(serialAsts.size() == parallelAsts.size());
+  for (size_t i = 0; i < serialAsts.size(); ++i)
+    CHECK(serialAsts[i]->name() == parallelAsts[i]->name());
+
+  // Type tree node of nullptr is the root of the tree.
+  compareTypeTrees(*serialProgram.typeTreeNodeFromCppObj(nullptr), *parallelProgram.typeTreeNodeFromCppObj(nullptr));
+}
+
+TEST_CASE("Parsing a file in pieces on many threads matches parsing it serially")
+{
+  auto parser = constructParser();
+  for (const auto& file : collectE2eInputFiles())
+  {
+    // Smaller files are parsed serially anyway.
+    if (bfs::file_size(file) < 16 * 1024)
+      continue;
+    INFO(file);
+    CHECK(emit(parser.parseFileInParallel(file, 8)) == parseAndEmit(parser, file));
+  }
+}
+
+TEST_CASE("Errors of a file parsed on many threads are reported like when parsed serially")
+{
+  std::string source;
+  for (int i = 0; i < 4000; ++i)
+  {
+    source += "int var" + std::to_string(i) + ";\n";
+    if (i == 2500)
+      source += "callFunc(x, y, );\n";
+  }
+  source = lexerBuffer(std::move(source));
+
+  std::vector<size_t> errorLines;
+  CppParser           parser;
+  parser.setErrorHandler([&](const char*, size_t lineNum, size_t, int) { errorLines.push_back(lineNum); });
+
+  auto       serialSource     = source;
+  const auto serialAst        = parser.parseStream(serialSource.data(), serialSource.size());
+  const auto serialErrorLines = errorLines;
+  REQUIRE(!serialErrorLines.empty());
+
+  errorLines.clear();
+  const auto parallelAst = parser.parseStreamInParallel(source.data(), source.size(), 8);
+  CHECK(emit(parallelAst) == emit(serialAst));
+  CHECK(errorLines == serialErrorLines);
+}
+
+TEST_CASE("Comments around disabled code are same when file is parsed on many threads")
+{
+  std::string source;
+  for (int i = 0; i < 4000; ++i)
+  {
+    source += "int var" + std::to_string(i) + ";\n";
+    if (i % 10 == 0)
+      source += "// Before\n#if 0\nint disabled;\n// Inside\n#endif\n// After\n";
+  }
+
+  CppParser  parser;
+  const auto serialAst = parse(parser, source);
+  REQUIRE(serialAst != nullptr);
+  source = lexerBuffer(std::move(source));
+  CHECK(emit(parser.parseStreamInParallel(source.data(), source.size(), 8)) == emit(serialAst));
+}
@@ -0,0 +1,345 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include "ast-serializer.h"
+#include "cppcompound-info-accessor.h"
+#include "cppobjfactory.h"
+#include "parser.h"
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#  include <pthread.h>
+#endif
+
+// Deep ASTs are parsed, traversed, emitted, and deleted on a thread whose stack is too small for doing that recursively.
+// Time limit is far more than what these tests need and is only meant to catch quadratic behavior.
+
+namespace {
+
+constexpr size_t kStackSize = 512 * 1024;
+constexpr auto   kTimeLimit = std::chrono::seconds(30);
+
+/**
+ * Runs \a fn on a thread with a stack of kStackSize, or on the calling thread where that isn't supported.
+ * \note Catch assertions are not thread safe and so \a fn must not use them.
+ */
+void runWithSmallStack(const std::function<void()>& fn)
+{
+#ifndef _WIN32
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, kStackSize);
+  pthread_t  thread;
+  const auto threadFn = [](void* arg) -> void* {
+    (*static_cast<const std::function<void()>*>(arg))();
+    return nullptr;
+  };
+  const auto threadCreated = pthread_create(&thread, &attr, threadFn, const_cast<std::function<void()>*>(&fn)) == 0;
+  pthread_attr_destroy(&attr);
+  REQUIRE(threadCreated);
+  pthread_join(thread, nullptr);
+#else
+  fn();
+#endif
+}
+
+template <typename _Clock>
+bool withinTimeLimit(typename _Clock::time_point startTime)
+{
+  return (_Clock::now() - startTime) < kTimeLimit;
+}
+
+
+} // namespace
+
+TEST_CASE("Expression with 100k terms")
+{
+  constexpr size_t kNumTerms = 100000;
+
+  std::string expected = "a0";
+  for (size_t i = 1; i < kNumTerms; ++i)
+    expected += " + a" + std::to_string(i);
+  expected += ";\n";
+
+  std::string emitted;
+  const auto  start = std::chrono::steady_clock::now();
+  runWithSmallStack([&]() {
+    auto* expr = new CppExpr("a0");
+    for (size_t i = 1; i < kNumTerms; ++i)
+      expr = new CppExpr(expr, CppOperator::kPlus, CppExprAtom("a" + std::to_string(i)));
+    const auto exprPtr = CppExprPtr(expr);
+    emitted            = emit(exprPtr.get());
+  });
+
+  CHECK(withinTimeLimit<std::chrono::steady_clock>(start));
+  CHECK(emitted == expected);
+}
+
+TEST_CASE("Brace initializer list with 100k items")
+{
+  constexpr size_t kNumItems = 100000;
+
+  std::string expected = "{0";
+  for (size_t i = 1; i < kNumItems; ++i)
+    expected += ", " + std::to_string(i);
+  expected += "};\n";
+
+  std::string emitted;
+  const auto  start = std::chrono::steady_clock::now();
+  runWithSmallStack([&]() {
+    auto* items = new CppExpr("0");
+    for (size_t i = 1; i < kNumItems; ++i)
+      items = new CppExpr(items, CppOperator::kComma, CppExprAtom(std::to_string(i)));
+    const auto initList = CppExprPtr(new CppExpr(items, CppExpr::kInitializer));
+    emitted             = emit(initList.get());
+  });
+
+  CHECK(withinTimeLimit<std::chrono::steady_clock>(start));
+  CHECK(emitted == expected);
+}
+
+TEST_CASE("Else-if ladder 50k deep")
+{
+  constexpr size_t kDepth = 50000;
+  // Writer nests else part in a block, so size of emitted ladder grows quadratically with its depth.
+  constexpr size_t kEmittedDepth = 1000;
+
+  const auto buildLadder = [](size_t depth) {
+    CppObj* ladder = nullptr;
+    for (size_t i = depth; i > 0; --i)
+      ladder = new CppIfBlock(new CppExpr("c" + std::to_string(i)), new CppExpr("s" + std::to_string(i)), ladder);
+    return std::unique_ptr<CppObj>(ladder);
+  };
+
+  size_t     numIfLines = 0;
+  const auto start      = std::chrono::steady_clock::now();
+  runWithSmallStack([&]() {
+    auto ladder = buildLadder(kDepth);
+    ladder.reset();
+
+    ladder = buildLadder(kEmittedDepth);
+    std::istringstream emitted(emit(ladder.get()));
+    for (std::string line; std::getline(emitted, line);)
+    {
+      if (line.find("if (c") != std::string::npos)
+        ++numIfLines;
+    }
+  });
+
+  CHECK(withinTimeLimit<std::chrono::steady_clock>(start));
+  CHECK(numIfLines == kEmittedDepth);
+}
+
+TEST_CASE("Namespaces nested 50k deep")
+{
+  constexpr size_t kDepth = 50000;
+
+  size_t     numVisited            = 0;
+  size_t     numVisitedPreorder    = 0;
+  bool       innermostVisitedFirst = false;
+  const auto start                 = std::chrono::steady_clock::now();
+  runWithSmallStack([&]() {
+    auto  ast   = std::make_unique<CppCompound>(CppCompoundType::kCppFile);
+    auto* outer = ast.get();
+    for (size_t i = 0; i < kDepth; ++i)
+    {
+      auto* inner = new CppCompound("ns" + std::to_string(i), CppCompoundType::kNamespace);
+      outer->addMember(inner);
+      outer = inner;
+    }
+    outer->addMember(new CppExpr("x"));
+
+    traverse(ast.get(), [&](const CppObj* obj) {
+      if (numVisited++ == 0)
+        innermostVisitedFirst = (obj->objType_ == CppObjType::kExpression);
+      return false;
+    });
+    traversePreorder(ast.get(), [&](const CppObj*) {
+      ++numVisitedPreorder;
+      return false;
+    });
+  });
+
+  CHECK(withinTimeLimit<std::chrono::steady_clock>(start));
+  CHECK(numVisited == kDepth + 1);
+  CHECK(numVisitedPreorder == kDepth + 1);
+  CHECK(innermostVisitedFirst);
+}
+
+TEST_CASE("Visitor returning true stops traversal of only the compound owning the visited member")
+{
+  // namespace a { x1; namespace b { y1; y2; } x2; } z;
+  CppCompound ast(CppCompoundType::kCppFile);
+  auto*       a  = new CppCompound("a", CppCompoundType::kNamespace);
+  auto*       b  = new CppCompound("b", CppCompoundType::kNamespace);
+  auto*       x1 = new CppExpr("x1");
+  auto*       y1 = new CppExpr("y1");
+  auto*       y2 = new CppExpr("y2");
+  auto*       x2 = new CppExpr("x2");
+  auto*       z  = new CppExpr("z");
+  b->addMember(y1);
+  b->addMember(y2);
+  a->addMember(x1);
+  a->addMember(b);
+  a->addMember(x2);
+  ast.addMember(a);
+  ast.addMember(z);
+
+  using Visited        = std::vector<const CppObj*>;
+  const auto visitTill = [](const CppObj* stopAt, Visited& visited) {
+    return [stopAt, &visited](const CppObj* obj) {
+      visited.push_back(obj);
+      return obj == stopAt;
+    };
+  };
+
+  Visited visited;
+  CHECK(!traverse(&ast, visitTill(y1, visited)));
+  CHECK(visited == Visited {x1, y1, b, x2, a, z});
+
+  visited.clear();
+  CHECK(!traverse(&ast, visitTill(b, visited)));
+  CHECK(visited == Visited {x1, y1, y2, b, a, z});
+
+  // Members of namespace-like members are visited the way traverse() does it.
+  visited.clear();
+  CHECK(!traversePreorder(&ast, visitTill(nullptr, visited)));
+  CHECK(visited == Visited {a, x1, y1, y2, b, x2, z});
+
+  visited.clear();
+  CHECK(!traversePreorder(&ast, visitTill(y1, visited)));
+  CHECK(visited == Visited {a, x1, y1, b, x2, z});
+
+  visited.clear();
+  CHECK(!traversePreorder(&ast, visitTill(a, visited)));
+  CHECK(visited == Visited {a});
+}
+
+TEST_CASE("Parse expressions 100k long and 100k deep")
+{
+  constexpr size_t kNumTerms = 100000;
+
+  std::string sumSrc = "int x = a0";
+  for (size_t i = 1; i < kNumTerms; ++i)
+    sumSrc += " + a" + std::to_string(i);
+  sumSrc += ";\n";
+  const std::string notSrc = "int y = " + std::string(kNumTerms, '!') + "b;\n";
+
+  std::string emittedSum;
+  std::string emittedNot;
+  const auto  start = std::chrono::steady_clock::now();
+  runWithSmallStack([&]() {
+    // Second parse reuses stacks that have grown in the first one.
+    CppParser  parser;
+    const auto parseAndEmit = [&parser](const std::string& src) {
+      const auto ast = parse(parser, src);
+      return ast ? emit(ast.get()) : std::string();
+    };
+    emittedSum = parseAndEmit(sumSrc);
+    emittedNot = parseAndEmit(notSrc);
+  });
+
+  CHECK(withinTimeLimit<std::chrono::steady_clock>(start));
+  CHECK(emittedSum == sumSrc);
+  CHECK(emittedNot == notSrc);
+}
+
+TEST_CASE("Serialize and deserialize ASTs 100k deep")
+{
+  constexpr size_t kNumTerms = 100000;
+  constexpr size_t kDepth    = 50000;
+
+  std::string sumSrc = "int x = a0";
+  for (size_t i = 1; i < kNumTerms; ++i)
+    sumSrc += " + a" + std::to_string(i);
+  sumSrc += ";\n";
+
+  std::string emittedSum;
+  size_t      numVisited = 0;
+  const auto  start      = std::chrono::steady_clock::now();
+  runWithSmallStack([&]() {
+    const auto roundTrip = [](const CppCompound& ast) {
+      const auto data = serializeAst(ast);
+      return deserializeAst(data.data(), data.size(), CppObjFactory());
+    };
+
+    CppParser  parser;
+    const auto sumAst = parse(parser, sumSrc);
+    if (const auto sumCopy = sumAst ? roundTrip(*sumAst) : nullptr)
+      emittedSum = emit(sumCopy.get());
+
+    auto  nsAst = std::make_unique<CppCompound>(CppCompoundType::kCppFile);
+    auto* outer = nsAst.get();
+    for (size_t i = 0; i < kDepth; ++i)
+    {
+      auto* inner = new CppCompound("ns" + std::to_string(i), CppCompoundType::kNamespace);
+      outer->addMember(inner);
+      outer = inner;
+    }
+    outer->addMember(new CppExpr("x"));
+    if (const auto nsCopy = roundTrip(*nsAst))
+    {
+      traverse(nsCopy.get(), [&](const CppObj*) {
+        ++numVisited;
+        return false;
+      });
+    }
+  });
+
+  CHECK(withinTimeLimit<std::chrono::steady_clock>(start));
+  CHECK(emittedSum == sumSrc);
+  CHECK(numVisited == kDepth + 1);
+}
+
+TEST_CASE("Share var types of namespaces nested 50k deep")
+{
+  constexpr size_t kDepth = 50000;
+
+  bool       innermostShared = false;
+  const auto start           = std::chrono::steady_clock::now();
+  runWithSmallStack([&]() {
+    auto  ast   = std::make_unique<CppCompound>(CppCompoundType::kCppFile);
+    auto* outer = ast.get();
+    for (size_t i = 0; i < kDepth; ++i)
+    {
+      auto* inner = new CppCompound("ns" + std::to_string(i), CppCompoundType::kNamespace);
+      outer->addMember(inner);
+      outer = inner;
+    }
+    auto* var = new CppVar(new CppVarType("int"), CppVarDecl("v"));
+    outer->addMember(var);
+
+    shareVarTypes(ast.get());
+    innermostShared = var->varType()->shared();
+  });
+
+  CHECK(withinTimeLimit<std::chrono::steady_clock>(start));
+  CHECK(innermostShared);
+}
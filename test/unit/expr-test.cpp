@@ -226,3 +226,44 @@ TEST_CASE_METHOD(ExpressionTest, "b = x > y")
   CppExprEPtr expr = members[1];
   REQUIRE(expr);
 }
+
+TEST_CASE_METHOD(ExpressionTest, "atoms of any length")
+{
+#if TEST_CASE_SNIPPET_STARTS_FROM_NEXT_LINE
+  int    aVariableWithAVeryLongName = 1, b = 5;
+  aVariableWithAVeryLongName + b;
+#endif
+  auto testSnippet = getTestSnippetParseStream(__LINE__ - 2);
+
+  CppParser  parser;
+  const auto ast = parser.parseStream(testSnippet.data(), testSnippet.size());
+  REQUIRE(ast != nullptr);
+
+  const auto& members = ast->members();
+  REQUIRE(members.size() == 2);
+
+  CppExprEPtr topLevelOp = members[1];
+  REQUIRE(topLevelOp);
+  CHECK(topLevelOp->oper_ == kPlus);
+
+  const auto left = topLevelOp->expr1_.expr;
+  REQUIRE(left);
+  REQUIRE(left->expr1_.type == CppExprAtom::kAtom);
+  CHECK(left->expr1_.atom() == "aVariableWithAVeryLongName");
+
+  const auto right = topLevelOp->expr2_.expr;
+  REQUIRE(right);
+  REQUIRE(right->expr1_.type == CppExprAtom::kAtom);
+  CHECK(right->expr1_.atom() == "b");
+}
+
+TEST_CASE("Long atoms are owned by expression and not interned")
+{
+  const std::string longAtom = "aLongAtomThatOnlyThisTestUses";
+  {
+    CppExpr expr(longAtom);
+    CHECK(expr.expr1_.atom() == longAtom);
+    CHECK(expr.expr1_.ownedBytes() >= longAtom.size());
+  }
+  CHECK(!CppIdentifier::findInterned(longAtom));
+}
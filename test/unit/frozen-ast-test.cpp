@@ -0,0 +1,170 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include "cppcompound-info-accessor.h"
+#include "cppfrozen-ast.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+using VisitedNodes = std::vector<std::pair<CppObjType, std::string>>;
+
+VisitedNodes traverseAst(const CppCompound* ast)
+{
+  VisitedNodes visited;
+  traversePreorder(ast, [&visited](const CppObj* obj) {
+    visited.emplace_back(obj->objType_, isCompound(obj) ? static_cast<const CppCompound*>(obj)->name() : "");
+    return false;
+  });
+  return visited;
+}
+
+bool isFrozenNamespaceLike(const CppFrozenAst& ast, CppFrozenNodeId id)
+{
+  return (ast.objType(id) == CppObjType::kCompound) && (ast.compound(id).compoundType() & CppCompoundType::kNamespace);
+}
+
+void visitFrozenNode(const CppFrozenAst& ast, CppFrozenNodeId id, VisitedNodes& visited)
+{
+  const auto isCompound = (ast.objType(id) == CppObjType::kCompound);
+  visited.emplace_back(ast.objType(id), isCompound ? std::string(ast.name(id)) : "");
+}
+
+// Visits members of compound in the order traverse() does.
+void traverseFrozenCompound(const CppFrozenAst& ast, CppFrozenNodeId id, VisitedNodes& visited)
+{
+  for (const auto mem : ast.compound(id).members())
+  {
+    if (isFrozenNamespaceLike(ast, mem))
+      traverseFrozenCompound(ast, mem, visited);
+    visitFrozenNode(ast, mem, visited);
+  }
+}
+
+// Visits nodes in the order traversePreorder() does.
+VisitedNodes traverseFrozenAst(const CppFrozenAst& ast)
+{
+  VisitedNodes visited;
+  for (const auto mem : ast.compound(ast.root()).members())
+  {
+    visitFrozenNode(ast, mem, visited);
+    if (isFrozenNamespaceLike(ast, mem))
+      traverseFrozenCompound(ast, mem, visited);
+  }
+  return visited;
+}
+
+} // namespace
+
+TEST_CASE("Frozen AST has declarations of AST it is made from")
+{
+  CppParser  parser;
+  const auto ast = parse(parser,
+                         "namespace N {\n"
+                         "class A : public virtual B\n"
+                         "{\n"
+                         "public:\n"
+                         "  int x;\n"
+                         "  virtual const char* f(int a, char** b) const { return 0; }\n"
+                         "};\n"
+                         "}\n"
+                         "void g();\n");
+  REQUIRE(ast != nullptr);
+
+  const CppFrozenAst frozenAst(*ast);
+  REQUIRE(frozenAst.numNodes() == 10);
+
+  const auto fileCompound = frozenAst.compound(frozenAst.root());
+  CHECK(fileCompound.compoundType() == CppCompoundType::kCppFile);
+  CHECK(fileCompound.owner() == kNoFrozenNode);
+  REQUIRE(fileCompound.members().size() == 2);
+  CHECK(frozenAst.subtreeEnd(frozenAst.root()) == frozenAst.numNodes());
+
+  const auto ns = frozenAst.compound(fileCompound.members()[0]);
+  CHECK(ns.name() == "N");
+  CHECK(ns.compoundType() == CppCompoundType::kNamespace);
+  REQUIRE(ns.members().size() == 1);
+
+  const auto classA = frozenAst.compound(ns.members()[0]);
+  CHECK(classA.name() == "A");
+  CHECK(classA.owner() == ns.id());
+  CHECK(classA.compoundType() == CppCompoundType::kClass);
+  REQUIRE(classA.numBases() == 1);
+  CHECK(classA.base(0).baseName == "B");
+  CHECK(classA.base(0).inhType == CppAccessType::kPublic);
+  CHECK(classA.base(0).isVirtual);
+  REQUIRE(classA.members().size() == 2);
+
+  const auto x = frozenAst.var(classA.members()[0]);
+  CHECK(x.objType() == CppObjType::kVar);
+  CHECK(x.name() == "x");
+  CHECK(x.accessType() == CppAccessType::kPublic);
+  CHECK(x.varType().baseType == "int");
+
+  const auto f = frozenAst.function(classA.members()[1]);
+  CHECK(f.objType() == CppObjType::kFunction);
+  CHECK(f.name() == "f");
+  CHECK(f.hasAttr(kVirtual | kConst));
+  REQUIRE(f.hasReturnType());
+  CHECK(f.returnType().baseType == "char");
+  CHECK(f.returnType().typeModifier.ptrLevel_ == 1);
+  REQUIRE(f.params().size() == 2);
+  CHECK(frozenAst.var(f.params()[0]).name() == "a");
+  CHECK(frozenAst.var(f.params()[1]).name() == "b");
+  CHECK(frozenAst.var(f.params()[1]).varType().typeModifier.ptrLevel_ == 2);
+  REQUIRE(f.defn() != kNoFrozenNode);
+  CHECK(frozenAst.objType(f.defn()) == CppObjType::kCompound);
+  CHECK(frozenAst.subtreeEnd(ns.id()) == fileCompound.members()[1]);
+
+  const auto g = frozenAst.function(fileCompound.members()[1]);
+  CHECK(g.name() == "g");
+  CHECK(g.params().empty());
+  CHECK(g.defn() == kNoFrozenNode);
+}
+
+TEST_CASE("Frozen AST is traversed in the same order as AST")
+{
+  auto parser = constructCppParserForTest();
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+  for (const auto& file : collectE2eInputFiles())
+  {
+    INFO(file);
+    const auto ast = parser.parseFile(file);
+    if (!ast)
+      continue;
+    const CppFrozenAst frozenAst(*ast);
+    CHECK(traverseFrozenAst(frozenAst) == traverseAst(ast.get()));
+
+    for (CppFrozenNodeId id = 0; id < frozenAst.numNodes(); ++id)
+    {
+      for (const auto child : frozenAst.children(id))
+        REQUIRE(frozenAst.parent(child) == id);
+    }
+  }
+}
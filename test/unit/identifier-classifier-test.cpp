@@ -0,0 +1,102 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include "identifier-classifier.h"
+#include "parser.h"
+
+#include <cstring>
+#include <string>
+
+namespace {
+
+constexpr int kOverrideToken = 1000;
+
+IdentifierKind kindOf(const IdentifierClassifier& classifier, const char* id)
+{
+  return classifier.classify(id, strlen(id)).kind;
+}
+
+} // namespace
+
+TEST_CASE("Identifier classifier finds every configured name")
+{
+  ParserConfig config;
+  config.ignorableMacroNames = {"IGNORABLE", "BOTH"};
+  config.macroNames          = {"DECLARE_MEMBERS", "BOTH"};
+  config.knownApiDecorNames  = {"DLL_API", "WINAPI"};
+  config.renamedKeywords     = {{"OVERRIDE", kOverrideToken}};
+  for (int i = 0; i < 100; ++i)
+    config.knownApiDecorNames.insert("API_" + std::to_string(i));
+
+  const IdentifierClassifier classifier(config);
+  CHECK(classifier.numNames() == 106);
+
+  CHECK(kindOf(classifier, "IGNORABLE") == IdentifierKind::kIgnorableMacro);
+  CHECK(kindOf(classifier, "DECLARE_MEMBERS") == IdentifierKind::kMacro);
+  CHECK(kindOf(classifier, "BOTH") == IdentifierKind::kIgnorableMacro);
+  CHECK(kindOf(classifier, "DLL_API") == IdentifierKind::kApiDecor);
+  CHECK(kindOf(classifier, "API_99") == IdentifierKind::kApiDecor);
+  CHECK(classifier.classify("OVERRIDE", 8).kind == IdentifierKind::kRenamedKeyword);
+  CHECK(classifier.classify("OVERRIDE", 8).keywordToken == kOverrideToken);
+
+  CHECK(kindOf(classifier, "DLL") == IdentifierKind::kName);
+  CHECK(kindOf(classifier, "DLL_APIX") == IdentifierKind::kName);
+  CHECK(kindOf(classifier, "API_100") == IdentifierKind::kName);
+  CHECK(kindOf(classifier, "x") == IdentifierKind::kName);
+
+  // Identifiers are classified in place, in the middle of the input.
+  const char* input = "WINAPIDLL_API";
+  CHECK(classifier.classify(input, 6).kind == IdentifierKind::kApiDecor);
+  CHECK(classifier.classify(input + 6, 7).kind == IdentifierKind::kApiDecor);
+  CHECK(classifier.classify(input, 7).kind == IdentifierKind::kName);
+
+  const auto copied = classifier;
+  CHECK(kindOf(copied, "API_42") == IdentifierKind::kApiDecor);
+
+  CHECK(kindOf(IdentifierClassifier(ParserConfig()), "DLL_API") == IdentifierKind::kName);
+}
+
+TEST_CASE("Configured names added to parser are recognized by lexer")
+{
+  CppParser parser;
+  parser.addKnownApiDecor("DLL_API");
+  REQUIRE(parser.addRenamedKeyword("const", "MY_CONST"));
+
+  const auto ast = parse(parser,
+                         "DLL_API int x;\n"
+                         "int f() MY_CONST;\n");
+  REQUIRE(ast != nullptr);
+  REQUIRE(ast->members().size() == 2);
+
+  CppConstVarEPtr x = ast->members()[0];
+  REQUIRE(x);
+  CHECK(x->apidecor() == "DLL_API");
+
+  CppConstFunctionEPtr f = ast->members()[1];
+  REQUIRE(f);
+  CHECK((f->attr() & kConst) == kConst);
+}
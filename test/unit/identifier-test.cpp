@@ -0,0 +1,118 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include "cppprog.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+CppCompoundPtr parseSource(std::string source)
+{
+  CppParser parser;
+  return parse(parser, std::move(source));
+}
+
+} // namespace
+
+TEST_CASE("Identifiers of same string are same")
+{
+  const CppIdentifier id1(std::string("IdentifierTestName"));
+  const CppIdentifier id2("IdentifierTestName");
+  CHECK(id1 == id2);
+  CHECK(&id1.str() == &id2.str());
+  CHECK(id1 == "IdentifierTestName");
+  CHECK(id1 != CppIdentifier("IdentifierTestName2"));
+  CHECK(CppIdentifier().empty());
+  CHECK(CppIdentifier("") == CppIdentifier());
+
+  CHECK(!CppIdentifier::findInterned("IdentifierTestNameNeverUsed"));
+  const auto found = CppIdentifier::findInterned("IdentifierTestName");
+  REQUIRE(found);
+  CHECK(*found == id1);
+}
+
+TEST_CASE("Identifiers interned from many threads are same")
+{
+  constexpr size_t           kNumThreads = 8;
+  std::vector<CppIdentifier> ids(kNumThreads);
+  std::vector<std::thread>   threads;
+  for (size_t i = 0; i < kNumThreads; ++i)
+    threads.emplace_back([&ids, i]() { ids[i] = CppIdentifier(std::string("ConcurrentlyInterned")); });
+  for (auto& t : threads)
+    t.join();
+
+  for (const auto& id : ids)
+    CHECK(id == ids.front());
+}
+
+TEST_CASE("Names in different ASTs share identifiers")
+{
+  const auto ast1 = parseSource("class SharedName { SharedName(const SharedName&); };\n");
+  const auto ast2 = parseSource("SharedName var;\n");
+  REQUIRE(ast1 != nullptr);
+  REQUIRE(ast2 != nullptr);
+  REQUIRE(ast1->members().size() == 1);
+  REQUIRE(ast2->members().size() == 1);
+
+  CppConstCompoundEPtr cls = ast1->members().front().get();
+  REQUIRE(cls);
+  CppConstVarEPtr var = ast2->members().front().get();
+  REQUIRE(var);
+  CHECK(cls->nameId() == var->varType()->baseTypeId());
+  CHECK(cls->copyCtor() != nullptr);
+}
+
+TEST_CASE("CppProgram finds types by name")
+{
+  std::vector<std::string> noFiles;
+  CppProgram               program(noFiles);
+  program.addCppAst(parseSource("namespace Outer { class Inner {}; }\n"));
+
+  CHECK(program.nameLookup("Outer::Inner") != nullptr);
+  CHECK(program.searchTypeNode("Inner") != nullptr);
+  CHECK(program.nameLookup("Outer::NameNeverUsedAnywhere") == nullptr);
+  CHECK(program.searchTypeNode("NameNeverUsedAnywhere") == nullptr);
+}
+
+TEST_CASE("CppProgram searches types in alphabetical order of their parents")
+{
+  // Namespaces are declared in reverse order and each has a class of same name.
+  std::string source;
+  for (int i = 19; i >= 10; --i)
+    source += "namespace N" + std::to_string(i) + " { class T {}; }\n";
+
+  std::vector<std::string> noFiles;
+  CppProgram               program(noFiles);
+  program.addCppAst(parseSource(source));
+
+  const auto* found = program.searchTypeNode("T");
+  REQUIRE(found != nullptr);
+  CHECK(found == program.nameLookup("N10::T"));
+}
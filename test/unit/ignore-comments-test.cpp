@@ -0,0 +1,101 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include <string>
+
+namespace {
+
+CppParser constructParser(bool ignoreComments)
+{
+  CppParser parser;
+  parser.ignoreComments(ignoreComments);
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+
+  return parser;
+}
+
+size_t numDocComments(const CppCompoundPtr& ast)
+{
+  return ast->memoryReport().usage(CppObjType::kDocComment).numNodes;
+}
+
+} // namespace
+
+TEST_CASE("Ignored comments don't reach AST")
+{
+  const std::string source         = "/**\n"
+                                     " * Doc comment of a class.\n"
+                                     " */\n"
+                                     "class A // Side comment\n"
+                                     "{\n"
+                                     "  /* Comment inside class */\n"
+                                     "  int f(int x /* param */, /* another */ int y);\n"
+                                     "  // Line comment\n"
+                                     "  enum E { kA, /* in enum */ kB };\n"
+                                     "};\n";
+  const std::string strippedSource = "class A\n"
+                                     "{\n"
+                                     "  int f(int x, int y);\n"
+                                     "  enum E { kA, kB };\n"
+                                     "};\n";
+
+  auto       ignoringParser = constructParser(true);
+  const auto ast            = ignoringParser.parseStream(std::string_view(source));
+  REQUIRE(ast != nullptr);
+  CHECK(numDocComments(ast) == 0);
+  CHECK(emit(ast) == emit(ignoringParser.parseStream(std::string_view(strippedSource))));
+
+  auto       parser           = constructParser(false);
+  const auto astWithComments = parser.parseStream(std::string_view(source));
+  REQUIRE(astWithComments != nullptr);
+  CHECK(numDocComments(astWithComments) != 0);
+}
+
+TEST_CASE("Files are parsed when comments are ignored")
+{
+  auto parser         = constructCppParserForTest();
+  auto ignoringParser = constructCppParserForTest();
+  ignoringParser.ignoreComments(true);
+  for (const auto& file : collectE2eInputFiles())
+  {
+    INFO(file);
+    if (!parser.parseFile(file))
+      continue;
+    const auto ast = ignoringParser.parseFile(file);
+    REQUIRE(ast != nullptr);
+    CHECK(numDocComments(ast) == 0);
+  }
+}
+
+TEST_CASE("File that has only comments is parsed when comments are ignored")
+{
+  auto       ignoringParser = constructParser(true);
+  const auto ast            = ignoringParser.parseStream(std::string_view("/*\n * License\n */\n\n// Nothing yet\n"));
+  REQUIRE(ast != nullptr);
+  CHECK(ast->members().empty());
+  CHECK(emit(ast).empty());
+}
@@ -0,0 +1,59 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "line-index.h"
+
+#include <string>
+#include <vector>
+
+TEST_CASE("Line number is found for positions in any order")
+{
+  // Many chunks of lines, separated by line breaks of all kinds.
+  std::string         text;
+  std::vector<size_t> lineOffsets;
+  for (int i = 0; i < 20000; ++i)
+  {
+    lineOffsets.push_back(text.size());
+    text += "line " + std::to_string(i + 1) + ((i % 3 == 0) ? "\r\n" : ((i % 3 == 1) ? "\n" : "\r"));
+  }
+  // Line break at the end of a line belongs to that line.
+  const auto lineEnd = [&](int lineNo) { return text.data() + text.find_first_of("\r\n", lineOffsets[lineNo - 1]); };
+
+  LineIndex index;
+  index.reset(text.data(), text.data() + text.size());
+  CHECK(index.lineNumber(text.data()) == 1);
+  CHECK(index.lineNumber(text.data() + lineOffsets[19998]) == 19999);
+  CHECK(index.lineNumber(lineEnd(7)) == 7);
+  CHECK(index.lineNumber(lineEnd(1) + 1) == 1);
+  CHECK(index.lineNumber(text.data() + text.size()) == 20001);
+
+  LineIndex incrementalIndex;
+  incrementalIndex.reset(text.data(), text.data() + text.size());
+  for (int lineNo = 1; lineNo <= 20000; lineNo += 97)
+  {
+    CHECK(incrementalIndex.lineNumber(text.data() + lineOffsets[lineNo - 1]) == lineNo);
+    CHECK(incrementalIndex.lineNumber(lineEnd(lineNo)) == lineNo);
+  }
+}
@@ -0,0 +1,123 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include "cppprog.h"
+
+#include <boost/filesystem.hpp>
+
+#include <string>
+#include <vector>
+
+namespace bfs = boost::filesystem;
+
+namespace {
+
+const auto kHelloWorldPath = bfs::path(__FILE__).parent_path() / "test-files/hello-world.cpp";
+
+bool isSumOfParts(const CppAstMemoryUsage& usage)
+{
+  return usage.totalBytes() == (usage.shallowBytes + usage.stringBytes + usage.containerBytes);
+}
+
+} // namespace
+
+TEST_CASE("Memory report counts nodes of every type")
+{
+  CppParser  parser;
+  const auto ast = parse(parser,
+                         "class A : public B\n"
+                         "{\n"
+                         "  int x;\n"
+                         "  void f(int a);\n"
+                         "};\n"
+                         "enum E { e1, e2 };\n"
+                         "#define LONG_DEFINITION \"A definition that is too long to be stored inside std::string\"\n");
+  REQUIRE(ast != nullptr);
+
+  const auto report = ast->memoryReport();
+  CHECK(report.usage(CppObjType::kCompound).numNodes == 2);
+  CHECK(report.usage(CppObjType::kCompound).shallowBytes == 2 * sizeof(CppCompound));
+  CHECK(report.usage(CppObjType::kCompound).containerBytes
+        >= 4 * sizeof(CppObjPtr) + sizeof(CppInheritanceList) + sizeof(CppInheritInfo));
+  CHECK(report.usage(CppObjType::kVar).numNodes == 2);
+  CHECK(report.usage(CppObjType::kVarType).numNodes == 3);
+  CHECK(report.usage(CppObjType::kFunction).numNodes == 1);
+  CHECK(report.usage(CppObjType::kFunction).containerBytes >= sizeof(CppParamVector) + sizeof(CppObjPtr));
+  CHECK(report.usage(CppObjType::kEnum).numNodes == 1);
+  CHECK(report.usage(CppObjType::kHashDefine).numNodes == 1);
+  CHECK(report.usage(CppObjType::kHashDefine).stringBytes > 60);
+  CHECK(report.usage(CppObjType::kExpression).numNodes == 0);
+
+  const auto total = report.total();
+  CHECK(total.numNodes == 10);
+  CHECK(isSumOfParts(total));
+
+  const auto* classA      = static_cast<const CppCompound*>(ast->members().front().get());
+  const auto  classReport = classA->memoryReport();
+  CHECK(classReport.usage(CppObjType::kCompound).numNodes == 1);
+  CHECK(classReport.usage(CppObjType::kEnum).numNodes == 0);
+  CHECK(classReport.total().totalBytes() < total.totalBytes());
+}
+
+TEST_CASE("Shared var types are not accounted to AST that refers to them")
+{
+  const std::string source = "void f(int a, int b, int c);\n";
+
+  CppParser privateParser;
+  CppParser sharingParser;
+  sharingParser.shareVarTypes(true);
+  const auto privateAst = parse(privateParser, source);
+  const auto sharingAst = parse(sharingParser, source);
+  REQUIRE(privateAst != nullptr);
+  REQUIRE(sharingAst != nullptr);
+
+  const auto privateReport = privateAst->memoryReport();
+  const auto sharingReport = sharingAst->memoryReport();
+  CHECK(privateReport.usage(CppObjType::kVarType).numNodes == 4);
+  CHECK(sharingReport.usage(CppObjType::kVarType).numNodes == 1);
+  CHECK(sharingReport.usage(CppObjType::kVar).numNodes == 3);
+  CHECK(sharingReport.total().totalBytes() < privateReport.total().totalBytes());
+}
+
+TEST_CASE("Memory report of program has ratio of AST size to source size of every file")
+{
+  CppParser parser;
+  parser.retainSourceBuffer(true);
+  const CppProgram program(std::vector<std::string> {kHelloWorldPath.string()}, std::move(parser));
+  REQUIRE(program.getFileAsts().size() == 1);
+
+  const auto report = program.memoryReport();
+  REQUIRE(report.files.size() == 1);
+  const auto& fileReport = report.files.front();
+  CHECK(fileReport.file == kHelloWorldPath.string());
+  CHECK(fileReport.sourceBytes == bfs::file_size(kHelloWorldPath));
+  CHECK(fileReport.astToSourceRatio() > 0);
+  CHECK(fileReport.ast.total().totalBytes() == program.getFileAsts().front()->memoryReport().total().totalBytes());
+  // Retained source buffer belongs to AST of the file.
+  CHECK(fileReport.ast.usage(CppObjType::kCompound).stringBytes >= fileReport.sourceBytes);
+  CHECK(report.total().total().totalBytes() == fileReport.ast.total().totalBytes());
+}
@@ -0,0 +1,148 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include <string>
+
+namespace {
+
+CppParser constructParser(bool shareVarTypes)
+{
+  auto parser = constructCppParserForTest();
+  parser.shareVarTypes(shareVarTypes);
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+
+  return parser;
+}
+
+CppVar* paramAt(const CppObjPtr& func, size_t idx)
+{
+  return static_cast<CppVar*>(static_cast<const CppFunction*>(func.get())->params()->at(idx).get());
+}
+
+} // namespace
+
+TEST_CASE("AST with shared var types is same as the one with private var types")
+{
+  auto privateParser = constructParser(false);
+  auto sharingParser = constructParser(true);
+  for (const auto& file : collectE2eInputFiles())
+  {
+    INFO(file);
+    CHECK(emit(sharingParser.parseFile(file)) == emit(privateParser.parseFile(file)));
+  }
+}
+
+TEST_CASE("Structurally identical var types are shared")
+{
+  std::string src    = "void f(int a, const char* s, int b);\n"
+                       "void g(int c, const char* t);\n"
+                       "struct { int x; } anon;\n";
+  auto        parser = constructParser(true);
+  const auto  ast    = parse(parser, src);
+  REQUIRE(ast != nullptr);
+
+  const auto& members = ast->members();
+  REQUIRE(members.size() == 3);
+  auto* a = paramAt(members[0], 0);
+  auto* s = paramAt(members[0], 1);
+  auto* b = paramAt(members[0], 2);
+  auto* c = paramAt(members[1], 0);
+  auto* t = paramAt(members[1], 1);
+
+  CHECK(a->varType()->shared());
+  CHECK(a->varType() == b->varType());
+  CHECK(a->varType() == c->varType());
+  CHECK(s->varType() == t->varType());
+  CHECK(*a->varType() == *c->varType());
+  CHECK(*a->varType() != *s->varType());
+
+  // A type that defines a compound is never shared.
+  CppVarEPtr anon = members[2];
+  REQUIRE(anon);
+  CHECK(!anon->varType()->shared());
+
+  std::string otherSrc = "void h(int d);";
+  const auto  otherAst = parse(parser, otherSrc);
+  REQUIRE(otherAst != nullptr);
+  CHECK(paramAt(otherAst->members().front(), 0)->varType() == a->varType());
+}
+
+TEST_CASE("Mutating a var gives it its own copy of shared type")
+{
+  std::string src    = "void f(int a, int b);";
+  auto        parser = constructParser(true);
+  const auto  ast    = parse(parser, src);
+  REQUIRE(ast != nullptr);
+
+  auto* a = paramAt(ast->members().front(), 0);
+  auto* b = paramAt(ast->members().front(), 1);
+  REQUIRE(a->varType() == b->varType());
+
+  a->addAttr(kConst);
+  CHECK(!a->varType()->shared());
+  CHECK((a->varType()->typeModifier().constBits_ & 1) != 0);
+  CHECK(*a->varType() != *b->varType());
+  CHECK(b->varType()->shared());
+  CHECK(b->varType()->typeModifier().constBits_ == 0);
+}
+
+TEST_CASE("Mutable type of var is its own copy")
+{
+  std::string src    = "void f(int a, int b, int c);";
+  auto        parser = constructParser(true);
+  const auto  ast    = parse(parser, src);
+  REQUIRE(ast != nullptr);
+
+  auto* a = paramAt(ast->members().front(), 0);
+  auto* b = paramAt(ast->members().front(), 1);
+  auto* c = paramAt(ast->members().front(), 2);
+  REQUIRE(a->varType()->shared());
+
+  a->mutableVarType()->baseType("long");
+  b->mutableVarType()->typeModifier().ptrLevel_ = 1;
+  CHECK(a->varType()->baseType() == "long");
+  CHECK(b->varType()->typeModifier().ptrLevel_ == 1);
+  CHECK(!a->varType()->shared());
+  CHECK(!b->varType()->shared());
+
+  CHECK(c->varType()->shared());
+  CHECK(c->varType()->baseType() == "int");
+  CHECK(c->varType()->typeModifier().ptrLevel_ == 0);
+}
+
+TEST_CASE("Var types are not shared by default")
+{
+  std::string src    = "void f(int a, int b);";
+  auto        parser = CppParser();
+  const auto  ast    = parse(parser, src);
+  REQUIRE(ast != nullptr);
+
+  auto* a = paramAt(ast->members().front(), 0);
+  auto* b = paramAt(ast->members().front(), 1);
+  CHECK(!a->varType()->shared());
+  CHECK(a->varType() != b->varType());
+  CHECK(*a->varType() == *b->varType());
+}
@@ -0,0 +1,168 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace bfs = boost::filesystem;
+
+namespace {
+
+CppParser constructParser(bool retainSourceBuffer)
+{
+  auto parser = constructCppParserForTest();
+  parser.parseFunctionBodyAsBlob(true);
+  parser.retainSourceBuffer(retainSourceBuffer);
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+
+  return parser;
+}
+
+bool isInside(const CppSourceText& text, const CppSourceBuffer& source)
+{
+  return text.refersToSource() && (text.view().data() >= source.data())
+         && (text.view().data() + text.size() <= source.data() + source.size());
+}
+
+} // namespace
+
+TEST_CASE("AST that retains source buffer is same as the one that copies text")
+{
+  auto copyingParser   = constructParser(false);
+  auto retainingParser = constructParser(true);
+  for (const auto& file : collectE2eInputFiles())
+  {
+    INFO(file);
+    const auto copyingAst   = copyingParser.parseFile(file);
+    const auto retainingAst = retainingParser.parseFile(file);
+    CHECK(emit(retainingAst) == emit(copyingAst));
+    if (copyingAst)
+      CHECK(copyingAst->retainedSource() == nullptr);
+    if (retainingAst)
+      CHECK(retainingAst->retainedSource() != nullptr);
+  }
+}
+
+TEST_CASE("Verbatim text refers to retained source buffer")
+{
+  const auto testFilePath = bfs::path(__FILE__).parent_path() / "test-files/hello-world.cpp";
+  auto       parser       = constructParser(true);
+  const auto ast          = parser.parseFile(testFilePath.string());
+  REQUIRE(ast != nullptr);
+  REQUIRE(ast->retainedSource() != nullptr);
+
+  const auto& members = ast->members();
+  REQUIRE(members.size() == 2);
+  CppFunctionEPtr func = members[1];
+  REQUIRE(func);
+  REQUIRE(func->defn());
+  REQUIRE(func->defn()->hasASingleBlobMember());
+
+  const auto* blob = static_cast<const CppBlob*>(func->defn()->members().front().get());
+  CHECK(isInside(blob->blob_, *ast->retainedSource()));
+  CHECK(blob->blob_.str().find("Hello") != std::string::npos);
+}
+
+TEST_CASE("Parsing leaves retained source buffer same as the file")
+{
+  const auto testFilePath = bfs::path(__FILE__).parent_path() / "test-files/hello-world.cpp";
+  auto       parser       = constructParser(true);
+  const auto ast          = parser.parseFile(testFilePath.string());
+  REQUIRE(ast != nullptr);
+  const auto* source = ast->retainedSource();
+  REQUIRE(source != nullptr);
+#ifndef _WIN32
+  CHECK(source->isMapped());
+#endif
+
+  std::ifstream     stm(testFilePath.string(), std::ios_base::binary);
+  const std::string content((std::istreambuf_iterator<char>(stm)), std::istreambuf_iterator<char>());
+  CHECK(source->text() == content);
+}
+
+TEST_CASE("Source with CRLF line endings is parsed same as that with LF")
+{
+  const std::string lfSource = "#pragma once\n"
+                               "#define VALUE 1 // Value\n"
+                               "// Free standing comment\n"
+                               "#if VALUE\n"
+                               "int x; // Side comment\n"
+                               "#endif\n"
+                               "\n"
+                               "int main()\n"
+                               "{\n"
+                               "  return 0;\n"
+                               "}\n";
+  std::string       crlfSource;
+  for (const auto c : lfSource)
+    crlfSource += (c == '\n') ? "\r\n" : std::string(1, c);
+
+  auto       parser  = constructParser(false);
+  const auto lfAst   = parser.parseStream(std::string_view(lfSource));
+  const auto crlfAst = parser.parseStream(std::string_view(crlfSource));
+  REQUIRE(lfAst != nullptr);
+  CHECK(emit(crlfAst) == emit(lfAst));
+}
+
+TEST_CASE("Source buffer can't be made for a missing file")
+{
+  CHECK(CppSourceBuffer::fromFile((kE2eInputPath / "no-such-file.h").string()) == nullptr);
+  CHECK(CppParser().parseFile((kE2eInputPath / "no-such-file.h").string()) == nullptr);
+}
+
+TEST_CASE("TMP CRLF corpus")
+{
+  for (const bool blob : {true, false})
+  {
+    auto parser = constructCppParserForTest();
+    parser.parseFunctionBodyAsBlob(blob);
+    parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+    for (const auto& file : collectE2eInputFiles())
+    {
+      INFO(file << " blob " << blob);
+      std::ifstream stm(file, std::ios_base::binary);
+      std::string   content((std::istreambuf_iterator<char>(stm)), std::istreambuf_iterator<char>());
+      std::string   lf, crlf;
+      for (const auto c : content)
+        if (c != '\r')
+          lf += c;
+      for (const auto c : lf)
+        crlf += (c == '\n') ? "\r\n" : std::string(1, c);
+      const auto lfAst   = parser.parseStream(std::string_view(lf));
+      const auto crlfAst = parser.parseStream(std::string_view(crlf));
+      const auto a = emit(lfAst), b = emit(crlfAst);
+      if (a != b)
+      {
+        size_t i = 0;
+        while (i < a.size() && i < b.size() && a[i] == b[i]) ++i;
+        auto esc = [](std::string t) { std::string r; for (auto c : t) { if (c == '\r') r += "<CR>"; else if (c == '\n') r += "<LF>"; else r += c; } return r; };
+        std::ofstream("/tmp/crlfdiff.txt", std::ios_base::app) << file << " blob " << blob << "\n  lf:   " << esc(a.substr(i > 60 ? i - 60 : 0, 120)) << "\n  crlf: " << esc(b.substr(i > 60 ? i - 60 : 0, 120)) << "\n";
+      }
+    }
+  }
+}
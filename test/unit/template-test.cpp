@@ -56,6 +56,15 @@ TEST_CASE_METHOD(TemplateParsingTest, "template <int kGrowPercent = 75>", "[temp
   REQUIRE(members.size() == 1);
   CppCompoundEPtr compound = members[0];
   REQUIRE(compound);
+
+  const auto* templParams = compound->templateParamList();
+  REQUIRE(templParams != nullptr);
+  REQUIRE(templParams->size() == 1);
+  const auto& templParam = templParams->front();
+  CHECK(templParam.paramName_ == "kGrowPercent");
+  REQUIRE(templParam.paramType_ != nullptr);
+  CHECK(templParam.paramType_->objType_ == CppVarType::kObjectType);
+  CHECK(templParam.defaultArg() != nullptr);
 }
 
 /*
@@ -0,0 +1,99 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "cppast.h"
+#include "cppparser.h"
+#include "cppwriter.h"
+
+#include "../app/e2e-parser-config.h"
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Helpers shared by unit tests that parse code and compare emitted output.
+
+/**
+ * Folder of e2e test inputs, unit tests use its files as a corpus of real world code.
+ */
+inline const auto kE2eInputPath = boost::filesystem::path(__FILE__).parent_path().parent_path() / "e2e/test_input";
+
+/**
+ * Returns sorted paths of all files of e2e test inputs.
+ */
+inline std::vector<std::string> collectE2eInputFiles()
+{
+  namespace bfs = boost::filesystem;
+
+  std::vector<std::string> files;
+  for (bfs::recursive_directory_iterator dirItr(kE2eInputPath); dirItr != bfs::recursive_directory_iterator(); ++dirItr)
+  {
+    if (bfs::is_regular_file(*dirItr))
+      files.push_back(dirItr->path().string());
+  }
+  std::sort(files.begin(), files.end());
+
+  return files;
+}
+
+/**
+ * Returns \a source followed by the 2 null characters that lexer needs at the end of its buffer.
+ */
+inline std::string lexerBuffer(std::string source)
+{
+  source.append(2, '\0');
+  return source;
+}
+
+/**
+ * Parses \a source with \a parser.
+ */
+inline CppCompoundPtr parse(CppParser& parser, std::string source)
+{
+  source = lexerBuffer(std::move(source));
+  return parser.parseStream(&source[0], source.size());
+}
+
+/**
+ * Returns code emitted for \a cppObj, or a marker when parsing has failed and there is no \a cppObj.
+ */
+inline std::string emit(const CppObj* cppObj)
+{
+  if (!cppObj)
+    return "<parsing failed>";
+
+  std::ostringstream stm;
+  CppWriter().emit(cppObj, stm);
+
+  return stm.str();
+}
+
+inline std::string emit(const CppCompoundPtr& ast)
+{
+  return emit(ast.get());
+}
@@ -0,0 +1,116 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::string> tokenTexts(const std::string& source, const std::vector<CppLexToken>& tokens)
+{
+  std::vector<std::string> texts;
+  for (const auto& token : tokens)
+    texts.push_back(source.substr(token.offset, token.length));
+  return texts;
+}
+
+} // namespace
+
+TEST_CASE("Tokens refer to their text in source")
+{
+  auto       source   = lexerBuffer("int x = 10;\n"
+                                    "float* f(int a, char c);\n");
+  const auto original = source;
+
+  CppParser  parser;
+  const auto tokens = parser.tokenize(&source[0], source.size());
+  CHECK(source == original);
+  const std::vector<std::string> expectedTexts = {
+    "int", "x", "=", "10", ";", "float", "*", "f", "(", "int", "a", ",", "char", "c", ")", ";"};
+  CHECK(tokenTexts(source, tokens) == expectedTexts);
+  REQUIRE(tokens.size() == expectedTexts.size());
+  CHECK(tokens[2].kind == '=');
+  CHECK(tokens[4].kind == ';');
+  CHECK(tokens[1].kind == tokens[7].kind);
+  CHECK(tokens[0].kind == tokens[9].kind);
+}
+
+TEST_CASE("Line comment inside block comment is a token before the block comment")
+{
+  auto       source = lexerBuffer("/*\n"
+                                  "// Line comment with *\n"
+                                  "*/\n");
+  CppParser  parser;
+  const auto tokens = parser.tokenize(&source[0], source.size());
+
+  const std::vector<std::string> expectedTexts = {"// Line comment with *", "/*\n// Line comment with *\n*/"};
+  CHECK(tokenTexts(source, tokens) == expectedTexts);
+}
+
+TEST_CASE("Lexing goes on past unmatched closing braces")
+{
+  auto       source = lexerBuffer("}\n"
+                                  "}\n"
+                                  "int x;\n");
+  CppParser  parser;
+  const auto tokens = parser.tokenize(&source[0], source.size());
+
+  const std::vector<std::string> expectedTexts = {"}", "}", "int", "x", ";"};
+  CHECK(tokenTexts(source, tokens) == expectedTexts);
+}
+
+TEST_CASE("Tokens of files are in order and inside the file")
+{
+  CppParser parser;
+  for (const auto& file : collectE2eInputFiles())
+  {
+    INFO(file);
+    std::ifstream     stm(file, std::ios_base::binary);
+    const std::string text((std::istreambuf_iterator<char>(stm)), std::istreambuf_iterator<char>());
+    const auto        size   = text.size();
+    auto              source = lexerBuffer(text);
+
+    const auto tokens = parser.tokenize(&source[0], source.size());
+    size_t     start  = 0;
+    size_t     end    = 0;
+    for (const auto& token : tokens)
+    {
+      // Block comment comes after the line comments inside it and encloses them.
+      if (token.offset < end)
+      {
+        REQUIRE(source.compare(source.find_first_not_of(" \t", token.offset), 2, "/*") == 0);
+        REQUIRE(token.offset <= start);
+        REQUIRE(token.offset + token.length >= end);
+      }
+      REQUIRE(token.offset + token.length <= size);
+      start = token.offset;
+      end   = token.offset + token.length;
+    }
+  }
+}
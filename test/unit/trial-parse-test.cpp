@@ -0,0 +1,103 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include <string>
+
+namespace {
+
+std::string nestInNamespaces(const std::string& source, size_t depth)
+{
+  std::string nested;
+  for (size_t i = 0; i < depth; ++i)
+    nested += "namespace n" + std::to_string(i) + " {\n";
+  nested += source;
+  for (size_t i = 0; i < depth; ++i)
+    nested += "}\n";
+
+  return nested;
+}
+
+const std::string kAmbiguousCode = "void f()\n"
+                                   "{\n"
+                                   "  a < b;\n"
+                                   "  C<v != 0> x;\n"
+                                   "  x = (a < b) > c;\n"
+                                   "  f(a < b, c > d);\n"
+                                   "}\n";
+
+} // namespace
+
+TEST_CASE("Ambiguous code is parsed by backtracking")
+{
+  CppParser  parser;
+  const auto ast = parse(parser, kAmbiguousCode);
+  REQUIRE(ast != nullptr);
+  CHECK(emit(ast.get()) == kAmbiguousCode);
+
+  const auto numTrialParses          = parser.numTrialParses();
+  const auto numTokensReplayed       = parser.numTokensReplayed();
+  const auto numBytesCopiedForTrials = parser.numBytesCopiedForTrials();
+  CHECK(numTrialParses > 0);
+  CHECK(numTokensReplayed > 0);
+  CHECK(numBytesCopiedForTrials > 0);
+
+  // Counters add up over parses done by the same parser.
+  REQUIRE(parse(parser, kAmbiguousCode) != nullptr);
+  CHECK(parser.numTrialParses() == 2 * numTrialParses);
+  CHECK(parser.numTokensReplayed() == 2 * numTokensReplayed);
+  CHECK(parser.numBytesCopiedForTrials() == 2 * numBytesCopiedForTrials);
+}
+
+TEST_CASE("Backtracking copies no more of parser stacks when code is deeply nested")
+{
+  CppParser shallowParser;
+  REQUIRE(parse(shallowParser, nestInNamespaces(kAmbiguousCode, 1)) != nullptr);
+  CppParser deepParser;
+  REQUIRE(parse(deepParser, nestInNamespaces(kAmbiguousCode, 1000)) != nullptr);
+
+  CHECK(deepParser.numTrialParses() == shallowParser.numTrialParses());
+  CHECK(deepParser.numBytesCopiedForTrials() == shallowParser.numBytesCopiedForTrials());
+}
+
+TEST_CASE("Syntax error is reported where the farthest trial parse failed")
+{
+  std::string errLine;
+  size_t      errLineNum = 0;
+  size_t      errPos     = 0;
+  CppParser   parser;
+  parser.setErrorHandler([&](const char* errLineText, size_t lineNum, size_t errorStartPos, int) {
+    errLine    = errLineText;
+    errLineNum = lineNum;
+    errPos     = errorStartPos;
+  });
+
+  CHECK(parse(parser, "void f()\n{\n  C<v != 0> x = ;\n}\n") == nullptr);
+  CHECK(parser.numTrialParses() > 0);
+  CHECK(errLineNum == 3);
+  CHECK(errLine == "  C<v != 0> x = ;");
+  CHECK(errPos == errLine.find(';'));
+}
@@ -0,0 +1,92 @@
+/*
+   The MIT License (MIT)
+
+   Copyright (c) 2018 Satya Das
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy of
+   this software and associated documentation files (the "Software"), to deal in
+   the Software without restriction, including without limitation the rights to
+   use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+   the Software, and to permit persons to whom the Software is furnished to do so,
+   subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch/catch.hpp>
+
+#include "test-helper.h"
+
+#include <csignal>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace bfs = boost::filesystem;
+
+namespace {
+
+} // namespace
+
+TEST_CASE("ASTs parsed in worker processes are same as the ones parsed in process")
+{
+  const auto files = collectE2eInputFiles();
+  REQUIRE(!files.empty());
+
+  auto parser = constructCppParserForTest();
+  parser.setErrorHandler([](const char*, size_t, size_t, int) {});
+
+  const auto asts = parser.parseFilesInWorkerProcesses(files, 4);
+  REQUIRE(asts.size() == files.size());
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    INFO(files[i]);
+    const auto expected = parser.parseFile(files[i]);
+    CHECK(emit(asts[i].get()) == emit(expected.get()));
+    if (asts[i])
+      CHECK(asts[i]->name() == files[i]);
+  }
+}
+
+TEST_CASE("Crash of a worker process loses only the file it was parsing")
+{
+  const auto tempDir = bfs::temp_directory_path() / bfs::unique_path();
+  bfs::create_directories(tempDir);
+
+  std::vector<std::string> files;
+  for (int i = 0; i < 8; ++i)
+  {
+    files.push_back((tempDir / ("file" + std::to_string(i) + ".h")).string());
+    std::ofstream(files.back()) << ((i == 3) ? "callFunc(x, y, );\n" : "int x" + std::to_string(i) + ";\n");
+  }
+
+  CppParser parser;
+  // Error handler runs in the worker process, killing it is like a crash or the OOM killer.
+  parser.setErrorHandler([](const char*, size_t, size_t, int) { std::raise(SIGKILL); });
+
+  const auto asts = parser.parseFilesInWorkerProcesses(files, 2);
+  bfs::remove_all(tempDir);
+
+  REQUIRE(asts.size() == files.size());
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    INFO(files[i]);
+    if (i == 3)
+    {
+      CHECK(asts[i] == nullptr);
+    }
+    else
+    {
+      REQUIRE(asts[i] != nullptr);
+      CHECK(asts[i]->members().size() == 1);
+    }
+  }
+}
@@ -15,6 +15,7 @@ static char *banner[] =
     "",
     "/*",
     "** @(#)btyaccpar, based on byacc 1.8 (Berkeley)",
+    "** Reentrant variant: all parser state lives in struct yyparsecontext.",
     "*/",
     "#define YYBTYACC 1",
     "",
@@ -30,7 +31,7 @@ static char *banner[] =
 
 static char *tables[] =
 {
-    "#line 22 \"btyaccpa.ske\"",
+    "#line 23 \"btyaccpa.ske\"",
     "",
     "#ifdef __cplusplus",
     "#define _C_ \"C\"",
@@ -65,7 +66,7 @@ static char *tables[] =
 
 static char *header[] =
 {
-    "#line 52 \"btyaccpa.ske\"",
+    "#line 53 \"btyaccpa.ske\"",
     "",
     "/*",
     "** YYPOSN is user-defined text position type.",
@@ -103,6 +104,10 @@ static char *header[] =
     "",
     "#define yyerrok (yyps->errflag=0)",
     "",
+    "/*",
+    "** Initial size of the lexical queue. Queue and stacks double in size when full,",
+    "** so deep nesting costs amortized constant time per token.",
+    "*/",
     "#ifndef YYSTACKGROWTH",
     "#define YYSTACKGROWTH 16",
     "#endif",
@@ -111,25 +116,15 @@ static char *header[] =
     "#define YYDEFSTACKSIZE 12",
     "#endif",
     "",
-    "#ifdef YYDEBUG",
-    "int yydebug;",
-    "#endif",
-    "",
     "extern void yyerror(const char *, ...);",
     "",
-    "int yynerrs;",
-    "",
-    "/* These value/posn are taken from the lexer */",
-    "YYSTYPE yylval;",
-    "#ifdef YYPOSN",
-    "YYPOSN  yyposn;",
-    "#endif /* YYPOSN */",
-    "",
-    "/* These value/posn of the root non-terminal are returned to the caller */",
-    "YYSTYPE yyretlval;",
-    "#ifdef YYPOSN",
-    "YYPOSN  yyretposn;",
-    "#endif /* YYPOSN */",
+    "/*",
+    "** YYPARSE_PARAM_TYPE is the type of user data carried by the parser context.",
+    "** Actions and YYLEX can reach it as yyparam.",
+    "*/",
+    "#ifndef YYPARSE_PARAM_TYPE",
+    "#define YYPARSE_PARAM_TYPE void *",
+    "#endif",
     "",
     "#define YYABORT  goto yyabort",
     "#define YYACCEPT goto yyaccept",
@@ -156,44 +151,135 @@ static char *header[] =
     "  ptrdiff_t     lexeme;      /* index of the conflict lexeme in the lexical queue */",
     "  size_t        stacksize;   /* current maximum stack size */",
     "  Yshort        ctry;        /* index in yyctable[] for this conflict */",
+    "  ptrdiff_t     depth;       /* index of the top entry of a saved state */",
+    "  ptrdiff_t     from;        /* error state copies entries from here, those below are of the outermost saved state */",
+    "  size_t        trail;       /* length of the trail when the state was saved */",
+    "  ptrdiff_t     outer;       /* untouched index of the enclosing trial when the state was saved */",
     "};",
     "",
-    "/* Current parser state */",
-    "static struct yyparsestate *yyps=0;",
+    "/*",
+    "** Saved states do not copy the stacks. Instead an entry is copied to the trail",
+    "** just before it is overwritten, and backtracking copies the entries back from it.",
+    "** So, starting a trial is cheap and only entries that a trial pops get copied.",
+    "*/",
+    "struct yytrailentry {",
+    "  ptrdiff_t     index;       /* index of the entry in stacks */",
+    "  Yshort        state;",
+    "  YYSTYPE       val;",
+    "#ifdef YYPOSN",
+    "  YYPOSN        pos;",
+    "#endif /* YYPOSN */",
+    "};",
     "",
-    "/* yypath!=NULL: do the full parse, starting at *yypath parser state. */",
-    "static struct yyparsestate *yypath=0;",
+    "/*",
+    "** Everything a parse needs besides the tables. There are no globals, so any",
+    "** number of parses can run concurrently as long as each one has its own context.",
+    "*/",
+    "struct yyparsecontext {",
+    "#ifdef YYDEBUG",
+    "  int           debug;",
+    "#endif",
+    "  int           nerrs;",
+    "",
+    "  /* These value/posn are taken from the lexer */",
+    "  YYSTYPE       lval;",
+    "#ifdef YYPOSN",
+    "  YYPOSN        posn;",
+    "#endif /* YYPOSN */",
+    "",
+    "  /* These value/posn of the root non-terminal are returned to the caller */",
+    "  YYSTYPE       retlval;",
+    "#ifdef YYPOSN",
+    "  YYPOSN        retposn;",
+    "#endif /* YYPOSN */",
+    "",
+    "  /* Current parser state */",
+    "  struct yyparsestate *ps;",
+    "",
+    "  /* path!=NULL: do the full parse, starting at *path parser state. */",
+    "  struct yyparsestate *path;",
     "",
-    "/* Base of the lexical value queue */",
-    "static YYSTYPE *yylvals=0;",
+    "  /* Base of the lexical value queue */",
+    "  YYSTYPE      *lvals;",
     "",
-    "/* Current posistion at lexical value queue */",
-    "static YYSTYPE *yylvp=0;",
+    "  /* Current posistion at lexical value queue */",
+    "  YYSTYPE      *lvp;",
     "",
-    "/* End position of lexical value queue */",
-    "static YYSTYPE *yylve=0;",
+    "  /* End position of lexical value queue */",
+    "  YYSTYPE      *lve;",
     "",
-    "/* The last allocated position at the lexical value queue */",
-    "static YYSTYPE *yylvlim=0;",
+    "  /* The last allocated position at the lexical value queue */",
+    "  YYSTYPE      *lvlim;",
     "",
     "#ifdef YYPOSN",
-    "/* Base of the lexical position queue */",
-    "static YYPOSN *yylpsns=0;",
+    "  /* Base of the lexical position queue */",
+    "  YYPOSN       *lpsns;",
     "",
-    "/* Current posistion at lexical position queue */",
-    "static YYPOSN *yylpp=0;",
+    "  /* Current posistion at lexical position queue */",
+    "  YYPOSN       *lpp;",
     "",
-    "/* End position of lexical position queue */",
-    "static YYPOSN *yylpe=0;",
+    "  /* End position of lexical position queue */",
+    "  YYPOSN       *lpe;",
     "",
-    "/* The last allocated position at the lexical position queue */",
-    "static YYPOSN *yylplim=0;",
+    "  /* The last allocated position at the lexical position queue */",
+    "  YYPOSN       *lplim;",
     "#endif /* YYPOSN */",
     "",
-    "/* Current position at lexical token queue */",
-    "static Yshort *yylexp=0;",
+    "  /* Current position at lexical token queue */",
+    "  Yshort       *lexp;",
+    "",
+    "  Yshort       *lexemes;",
+    "",
+    "  /* Parser states with their stacks, kept for reuse by later conflicts and parses */",
+    "  struct yyparsestate *freestates;",
+    "",
+    "  /* Overwritten entries of the stacks that saved states still need */",
+    "  struct yytrailentry *trail;",
+    "  size_t        ntrail;",
+    "  size_t        trailsize;",
+    "",
+    "  /* Entries below this index are untouched since the innermost saved state */",
+    "  ptrdiff_t     untouched;",
+    "",
+    "  /* Entries below this index are untouched since the outermost saved state */",
+    "  ptrdiff_t     lowwritten;",
+    "",
+    "  /* Statistics of the last parse */",
+    "  long          ntrials;     /* trial parses started */",
+    "  long          nreplayed;   /* tokens read again from the lexical queue after backtracking */",
+    "  size_t        ncopied;     /* bytes of stack entries copied to save and restore parser states */",
     "",
-    "static Yshort *yylexemes=0;",
+    "  /* User data, not used by the parser itself */",
+    "  YYPARSE_PARAM_TYPE param;",
+    "};",
+    "",
+    "/*",
+    "** Old global names, all of them resolve through the context of the current parse.",
+    "*/",
+    "#ifdef YYDEBUG",
+    "#define yydebug   (yyctx->debug)",
+    "#endif",
+    "#define yynerrs   (yyctx->nerrs)",
+    "#define yylval    (yyctx->lval)",
+    "#define yyretlval (yyctx->retlval)",
+    "#ifdef YYPOSN",
+    "#define yyposn    (yyctx->posn)",
+    "#define yyretposn (yyctx->retposn)",
+    "#endif /* YYPOSN */",
+    "#define yyps      (yyctx->ps)",
+    "#define yypath    (yyctx->path)",
+    "#define yylvals   (yyctx->lvals)",
+    "#define yylvp     (yyctx->lvp)",
+    "#define yylve     (yyctx->lve)",
+    "#define yylvlim   (yyctx->lvlim)",
+    "#ifdef YYPOSN",
+    "#define yylpsns   (yyctx->lpsns)",
+    "#define yylpp     (yyctx->lpp)",
+    "#define yylpe     (yyctx->lpe)",
+    "#define yylplim   (yyctx->lplim)",
+    "#endif /* YYPOSN */",
+    "#define yylexp    (yyctx->lexp)",
+    "#define yylexemes (yyctx->lexemes)",
     "",
     "/*",
     "** For use in generated program",
@@ -204,13 +290,18 @@ static char *header[] =
     "#define yypsp   (yyps->psp)",
     "#define yypos   (yyps->pos)",
     "#define yydepth (yyps->ssp - yyps->ss)",
+    "#define yyparam (yyctx->param)",
     "",
     "",
     "/*",
     "** Local prototypes.",
+    "** YYLEX is how the next token is read, user may define it to pass yyparam to the lexer.",
     "*/",
-    "int yyparse(void);",
+    "int yyparse(struct yyparsecontext *yyctx);",
+    "#ifndef YYLEX",
+    "#define YYLEX yylex()",
     "int yylex(void);",
+    "#endif",
     "",
     "static void YYSCopy(YYSTYPE *to, YYSTYPE *from, ptrdiff_t size) {",
     "  ptrdiff_t i;",
@@ -226,23 +317,23 @@ static char *header[] =
     "}",
     "#endif /* YYPOSN */",
     "",
-    "static int yyexpand() {",
+    "static int yyexpand(struct yyparsecontext *yyctx) {",
     "  ptrdiff_t p = yylvp-yylvals;",
-    "  ptrdiff_t s = yylvlim-yylvals;",
-    "  s += YYSTACKGROWTH;",
+    "  ptrdiff_t os = yylvlim-yylvals;",
+    "  ptrdiff_t s = os * 2;",
     "#ifdef __cplusplus",
     "  Yshort  *tl = yylexemes; ",
     "  yylexemes = new Yshort[s];",
-    "  memcpy(yylexemes, tl, (s-YYSTACKGROWTH)*sizeof(Yshort));",
+    "  memcpy(yylexemes, tl, os*sizeof(Yshort));",
     "  delete[] tl;",
     "  YYSTYPE *tv = yylvals;",
     "  yylvals = new YYSTYPE[s];",
-    "  YYSCopy(yylvals, tv, s-YYSTACKGROWTH);",
+    "  YYSCopy(yylvals, tv, os);",
     "  delete[] tv;",
     "#ifdef YYPOSN",
     "  YYPOSN  *tp = yylpsns;",
     "  yylpsns = new YYPOSN[s];",
-    "  YYPCopy(yylpsns, tp, s-YYSTACKGROWTH);",
+    "  YYPCopy(yylpsns, tp, os);",
     "  delete[] tp;",
     "#endif /* YYPOSN */",
     "#else",
@@ -262,8 +353,9 @@ static char *header[] =
     "  return 0;",
     "}",
     "",
-    "static int YYLex1() {",
+    "static int YYLex1(struct yyparsecontext *yyctx) {",
     "  if(yylvp<yylve) {",
+    "    ++yyctx->nreplayed;",
     "    yylval = *yylvp++;",
     "#ifdef YYPOSN",
     "    yyposn = *yylpp++;",
@@ -272,9 +364,9 @@ static char *header[] =
     "  } else {",
     "    if(yyps->save) {",
     "      if(yylvp==yylvlim) {",
-    "\tyyexpand();",
+    "\tyyexpand(yyctx);",
     "      }",
-    "      *yylexp = yylex();",
+    "      *yylexp = YYLEX;",
     "      *yylvp++ = yylval;",
     "      yylve++;",
     "#ifdef YYPOSN",
@@ -283,54 +375,52 @@ static char *header[] =
     "#endif /* YYPOSN */",
     "      return *yylexp++;",
     "    } else {",
-    "      return yylex();",
+    "      return YYLEX;",
     "    }",
     "  }",
     "}",
     "",
-    "static void YYMoreStack(struct yyparsestate *yyps) {",
-    "  ptrdiff_t p = yyps->ssp - yyps->ss;",
+    "static void YYMoreStack(struct yyparsestate *st) {",
+    "  ptrdiff_t p = st->ssp - st->ss;",
     "#ifdef __cplusplus",
-    "  Yshort  *tss = yyps->ss;",
-    "  yyps->ss = new Yshort [yyps->stacksize + YYSTACKGROWTH];   ",
-    "  memcpy(yyps->ss, tss, yyps->stacksize * sizeof(Yshort));  ",
+    "  Yshort  *tss = st->ss;",
+    "  st->ss = new Yshort [st->stacksize * 2];   ",
+    "  memcpy(st->ss, tss, st->stacksize * sizeof(Yshort));  ",
     "  delete[] tss;",
-    "  YYSTYPE *tvs = yyps->vs;",
-    "  yyps->vs = new YYSTYPE[yyps->stacksize + YYSTACKGROWTH];  ",
-    "  YYSCopy(yyps->vs, tvs, yyps->stacksize);                  ",
+    "  YYSTYPE *tvs = st->vs;",
+    "  st->vs = new YYSTYPE[st->stacksize * 2];  ",
+    "  YYSCopy(st->vs, tvs, st->stacksize);                  ",
     "  delete[] tvs;",
     "#ifdef YYPOSN",
-    "  YYPOSN  *tps = yyps->ps;",
-    "  yyps->ps = new YYPOSN [yyps->stacksize + YYSTACKGROWTH];  ",
-    "  YYPCopy(yyps->ps, tps, yyps->stacksize);                  ",
+    "  YYPOSN  *tps = st->ps;",
+    "  st->ps = new YYPOSN [st->stacksize * 2];  ",
+    "  YYPCopy(st->ps, tps, st->stacksize);                  ",
     "  delete[] tps;",
     "#endif /* YYPOSN */",
-    "  yyps->stacksize += YYSTACKGROWTH;                           ",
+    "  st->stacksize *= 2;                           ",
     "#else",
-    "  yyps->stacksize += YYSTACKGROWTH;                           ",
-    "  yyps->ss = realloc(yyps->ss, sizeof(Yshort ) * yyps->stacksize);   ",
-    "  yyps->vs = realloc(yyps->vs, sizeof(YYSTYPE) * yyps->stacksize);  ",
+    "  st->stacksize *= 2;                           ",
+    "  st->ss = realloc(st->ss, sizeof(Yshort ) * st->stacksize);   ",
+    "  st->vs = realloc(st->vs, sizeof(YYSTYPE) * st->stacksize);  ",
     "#ifdef YYPOSN",
-    "  yyps->ps = realloc(yyps->ps, sizeof(YYPOSN ) * yyps->stacksize);  ",
+    "  st->ps = realloc(st->ps, sizeof(YYPOSN ) * st->stacksize);  ",
     "#endif /* YYPOSN */",
     "#endif",
-    "  yyps->ssp = yyps->ss + p;                                   ",
-    "  yyps->vsp = yyps->vs + p;                                   ",
+    "  st->ssp = st->ss + p;                                   ",
+    "  st->vsp = st->vs + p;                                   ",
     "#ifdef YYPOSN",
-    "  yyps->psp = yyps->ps + p;                                   ",
+    "  st->psp = st->ps + p;                                   ",
     "#endif /* YYPOSN */",
     "}",
     "",
-    "static struct yyparsestate *YYNewState(size_t size) {",
+    "static void YYAllocStacks(struct yyparsestate *p, size_t size) {",
     "#ifdef __cplusplus",
-    "  yyparsestate *p = new yyparsestate;",
     "  p->ss = new Yshort [size + 4];",
     "  p->vs = new YYSTYPE[size + 4];",
     "#ifdef YYPOSN",
     "  p->ps = new YYPOSN [size + 4];",
     "#endif /* YYPOSN */",
     "#else",
-    "  struct yyparsestate *p = malloc(sizeof(struct yyparsestate));",
     "  p->ss = malloc(sizeof(Yshort ) * (size + 4));",
     "  p->vs = malloc(sizeof(YYSTYPE) * (size + 4));",
     "#ifdef YYPOSN",
@@ -346,38 +436,237 @@ static char *header[] =
     "  memset(&p->ps[0], 0, (size+4)*sizeof(YYPOSN));",
     "#endif",
     "#endif /* YYPOSN */",
-    "  return p;",
     "}",
     "",
-    "static void YYFreeState(struct yyparsestate *p) {",
+    "static void YYFreeStacks(struct yyparsestate *p) {",
     "#ifdef __cplusplus",
     "  delete[] p->ss;",
     "  delete[] p->vs;",
     "#ifdef YYPOSN",
     "  delete[] p->ps;",
     "#endif /* YYPOSN */",
-    "  delete p;",
     "#else",
     "  free(p->ss);",
     "  free(p->vs);",
     "#ifdef YYPOSN",
     "  free(p->ps);",
     "#endif /* YYPOSN */",
-    "  free(p);",
     "#endif",
     "}",
     "",
+    "/*",
+    "** Returns a state whose stacks can hold at least size entries.",
+    "** States are taken from the free list, only a state whose stacks are too small is reallocated.",
+    "*/",
+    "static struct yyparsestate *YYNewState(struct yyparsecontext *yyctx, size_t size) {",
+    "  struct yyparsestate *p = yyctx->freestates;",
+    "  if (p) {",
+    "    yyctx->freestates = p->save;",
+    "    if (p->stacksize >= size + 4)",
+    "      return p;",
+    "    YYFreeStacks(p);",
+    "  } else {",
+    "#ifdef __cplusplus",
+    "    p = new yyparsestate;",
+    "#else",
+    "    p = malloc(sizeof(struct yyparsestate));",
+    "#endif",
+    "  }",
+    "  YYAllocStacks(p, size);",
+    "  return p;",
+    "}",
+    "",
+    "static void YYFreeState(struct yyparsecontext *yyctx, struct yyparsestate *p) {",
+    "  p->save = yyctx->freestates;",
+    "  yyctx->freestates = p;",
+    "}",
+    "",
+    "#ifdef YYPOSN",
+    "#define YYENTRYSIZE (sizeof(Yshort) + sizeof(YYSTYPE) + sizeof(YYPOSN))",
+    "#else",
+    "#define YYENTRYSIZE (sizeof(Yshort) + sizeof(YYSTYPE))",
+    "#endif /* YYPOSN */",
+    "",
+    "/* Copies entries from index top till the untouched one to the trail, they are about to be overwritten */",
+    "static void YYTrail(struct yyparsecontext *yyctx, ptrdiff_t top) {",
+    "  size_t n = yyctx->untouched - top;",
+    "  ptrdiff_t i;",
+    "  if (yyctx->ntrail + n > yyctx->trailsize) {",
+    "    size_t s = yyctx->trailsize ? yyctx->trailsize * 2 : YYSTACKGROWTH;",
+    "    if (s < yyctx->ntrail + n)",
+    "      s = yyctx->ntrail + n;",
+    "#ifdef __cplusplus",
+    "    struct yytrailentry *tt = yyctx->trail;",
+    "    yyctx->trail = new yytrailentry[s];",
+    "    for (i = 0; i < (ptrdiff_t)yyctx->ntrail; i++)",
+    "      yyctx->trail[i] = tt[i];",
+    "    delete[] tt;",
+    "#else",
+    "    yyctx->trail = realloc(yyctx->trail, sizeof(struct yytrailentry) * s);",
+    "#endif",
+    "    yyctx->trailsize = s;",
+    "  }",
+    "  for (i = top; i < yyctx->untouched; i++) {",
+    "    struct yytrailentry *e = &yyctx->trail[yyctx->ntrail++];",
+    "    e->index = i;",
+    "    e->state = yyps->ss[i];",
+    "    e->val   = yyps->vs[i];",
+    "#ifdef YYPOSN",
+    "    e->pos   = yyps->ps[i];",
+    "#endif /* YYPOSN */",
+    "  }",
+    "  yyctx->ncopied += n * YYENTRYSIZE;",
+    "  yyctx->untouched = top;",
+    "  if (yyctx->lowwritten > top)",
+    "    yyctx->lowwritten = top;",
+    "}",
+    "",
+    "/* Called before a push, the entry it overwrites may still be needed by a saved state */",
+    "#define YYTRAILTOP() \\",
+    "  if (yyps->ssp + 1 - yyps->ss < yyctx->untouched) \\",
+    "    YYTrail(yyctx, yyps->ssp + 1 - yyps->ss)",
+    "",
+    "/* Starts a trial, the returned state is to be pushed on the chain of saved states */",
+    "static struct yyparsestate *YYSaveState(struct yyparsecontext *yyctx) {",
+    "  struct yyparsestate *p = YYNewState(yyctx, 0);",
+    "  p->depth = yyps->ssp - yyps->ss;",
+    "  p->trail = yyctx->ntrail;",
+    "  p->outer = yyctx->untouched;",
+    "  if (!yyps->save)",
+    "    yyctx->lowwritten = p->depth + 1;",
+    "  if (yyctx->untouched < p->depth + 1)",
+    "    yyctx->untouched = p->depth + 1;",
+    "  return p;",
+    "}",
+    "",
+    "/* Makes the stacks same as when saved state p was saved, by undoing what the trail has since then */",
+    "static void YYRestoreState(struct yyparsecontext *yyctx, struct yyparsestate *p) {",
+    "  yyctx->ncopied += (yyctx->ntrail - p->trail) * YYENTRYSIZE;",
+    "  while (yyctx->ntrail > p->trail) {",
+    "    struct yytrailentry *e = &yyctx->trail[--yyctx->ntrail];",
+    "    yyps->ss[e->index] = e->state;",
+    "    yyps->vs[e->index] = e->val;",
+    "#ifdef YYPOSN",
+    "    yyps->ps[e->index] = e->pos;",
+    "#endif /* YYPOSN */",
+    "  }",
+    "  yyps->ssp = yyps->ss + p->depth;",
+    "  yyps->vsp = yyps->vs + p->depth;",
+    "#ifdef YYPOSN",
+    "  yyps->psp = yyps->ps + p->depth;",
+    "#endif /* YYPOSN */",
+    "  yyctx->untouched = (p->outer > p->depth + 1) ? p->outer : p->depth + 1;",
+    "}",
+    "",
+    "/*",
+    "** Saves the error state. It is restored only after backtracking to the outermost saved state,",
+    "** so only the entries that differ from that state are copied.",
+    "*/",
+    "static struct yyparsestate *YYSaveErrorState(struct yyparsecontext *yyctx) {",
+    "  ptrdiff_t depth = yyps->ssp - yyps->ss;",
+    "  ptrdiff_t from = (yyctx->lowwritten < depth + 1) ? yyctx->lowwritten : depth + 1;",
+    "  struct yyparsestate *p = YYNewState(yyctx, depth);",
+    "  p->depth = depth;",
+    "  p->from  = from;",
+    "  memcpy(p->ss + from, yyps->ss + from, (depth + 1 - from) * sizeof(Yshort));",
+    "  YYSCopy(p->vs + from, yyps->vs + from, depth + 1 - from);",
+    "#ifdef YYPOSN",
+    "  YYPCopy(p->ps + from, yyps->ps + from, depth + 1 - from);",
+    "#endif /* YYPOSN */",
+    "  yyctx->ncopied += (depth + 1 - from) * YYENTRYSIZE;",
+    "  return p;",
+    "}",
+    "",
+    "static void YYRestoreErrorState(struct yyparsecontext *yyctx, struct yyparsestate *p) {",
+    "  ptrdiff_t from = p->from;",
+    "  memcpy(yyps->ss + from, p->ss + from, (p->depth + 1 - from) * sizeof(Yshort));",
+    "  YYSCopy(yyps->vs + from, p->vs + from, p->depth + 1 - from);",
+    "#ifdef YYPOSN",
+    "  YYPCopy(yyps->ps + from, p->ps + from, p->depth + 1 - from);",
+    "#endif /* YYPOSN */",
+    "  yyctx->ncopied += (p->depth + 1 - from) * YYENTRYSIZE;",
+    "  yyps->ssp = yyps->ss + p->depth;",
+    "  yyps->vsp = yyps->vs + p->depth;",
+    "#ifdef YYPOSN",
+    "  yyps->psp = yyps->ps + p->depth;",
+    "#endif /* YYPOSN */",
+    "}",
+    "",
+    "/*",
+    "** Prepares a context for yyparse(). A context can be used for any number of",
+    "** parses, one at a time, and must be released with yyparse_destroy().",
+    "** Stacks and lexical queue are kept between parses, so reusing a context saves their allocation.",
+    "*/",
+    "void yyparse_init(struct yyparsecontext *yyctx, YYPARSE_PARAM_TYPE param) {",
+    "#ifdef YYDEBUG",
+    "  yydebug = 0;",
+    "#endif",
+    "  yynerrs = 0;",
+    "  yyps = 0;",
+    "  yypath = 0;",
+    "  yylvals = yylvp = yylve = yylvlim = 0;",
+    "#ifdef YYPOSN",
+    "  yylpsns = yylpp = yylpe = yylplim = 0;",
+    "#endif /* YYPOSN */",
+    "  yylexp = yylexemes = 0;",
+    "  yyctx->freestates = 0;",
+    "  yyctx->trail = 0;",
+    "  yyctx->ntrail = yyctx->trailsize = 0;",
+    "  yyctx->untouched = yyctx->lowwritten = 0;",
+    "  yyctx->ntrials = yyctx->nreplayed = 0;",
+    "  yyctx->ncopied = 0;",
+    "  yyparam = param;",
+    "}",
+    "",
+    "void yyparse_destroy(struct yyparsecontext *yyctx) {",
+    "#ifdef __cplusplus",
+    "  delete[] yylexemes;",
+    "  delete[] yylvals;",
+    "#ifdef YYPOSN",
+    "  delete[] yylpsns;",
+    "#endif /* YYPOSN */",
+    "#else",
+    "  free(yylexemes);",
+    "  free(yylvals);",
+    "#ifdef YYPOSN",
+    "  free(yylpsns);",
+    "#endif /* YYPOSN */",
+    "#endif",
+    "  yylvals = yylvp = yylve = yylvlim = 0;",
+    "#ifdef YYPOSN",
+    "  yylpsns = yylpp = yylpe = yylplim = 0;",
+    "#endif /* YYPOSN */",
+    "  yylexp = yylexemes = 0;",
+    "#ifdef __cplusplus",
+    "  delete[] yyctx->trail;",
+    "#else",
+    "  free(yyctx->trail);",
+    "#endif",
+    "  yyctx->trail = 0;",
+    "  yyctx->ntrail = yyctx->trailsize = 0;",
+    "  while (yyctx->freestates) {",
+    "    struct yyparsestate *p = yyctx->freestates;",
+    "    yyctx->freestates = p->save;",
+    "    YYFreeStacks(p);",
+    "#ifdef __cplusplus",
+    "    delete p;",
+    "#else",
+    "    free(p);",
+    "#endif",
+    "  }",
+    "}",
+    "",
     0
 };
 
 static char *body[] =
 {
-    "#line 354 \"btyaccpa.ske\"",
+    "#line 643 \"btyaccpa.ske\"",
     "",
     "/*",
     "** Parser function",
     "*/",
-    "int yyparse() {",
+    "int yyparse(struct yyparsecontext *yyctx) {",
     "  int yym, yyn, yystate, yychar, yynewerrflag;",
     "  struct yyparsestate *yyerrctx = NULL;",
     "#ifdef YYREDUCEPOSNFUNC",
@@ -396,11 +685,22 @@ static char *body[] =
     "  ",
     "  yym = 0;",
     "  yyn = 0;",
-    "  yyps = YYNewState(YYDEFSTACKSIZE);",
+    "  yyps = YYNewState(yyctx, YYDEFSTACKSIZE);",
     "  yyps->save = 0;",
+    "  yyctx->ntrail = 0;",
+    "  yyctx->untouched = 0;",
+    "  yyctx->ntrials = yyctx->nreplayed = 0;",
+    "  yyctx->ncopied = 0;",
     "  yynerrs = 0;",
     "  yyps->errflag = 0;",
     "  yychar = (-1);",
+    "",
+    "  /* Lexical queue is kept from the previous parse with this context */",
+    "  yylvp = yylve = yylvals;",
+    "#ifdef YYPOSN",
+    "  yylpp = yylpe = yylpsns;",
+    "#endif /* YYPOSN */",
+    "  yylexp = yylexemes;",
     "  ",
     "  yyps->ssp = yyps->ss;",
     "  yyps->vsp = yyps->vs;",
@@ -422,7 +722,7 @@ static char *body[] =
     "  ** Read one token",
     "  */",
     "  if (yychar < 0) {",
-    "    if ((yychar = YYLex1()) < 0) yychar = 0;",
+    "    if ((yychar = YYLex1(yyctx)) < 0) yychar = 0;",
     "#if YYDEBUG",
     "    if (yydebug) {",
     "      yys = 0;",
@@ -462,7 +762,7 @@ static char *body[] =
     "      ctry = save->ctry;",
     "      if (save->state != yystate) ",
     "        goto yyabort;",
-    "      YYFreeState(save); ",
+    "      YYFreeState(yyctx, save); ",
     "",
     "    } else {",
     "",
@@ -478,18 +778,11 @@ static char *body[] =
     "        printf(\"\\n\");",
     "      }",
     "#endif",
-    "      struct yyparsestate *save = YYNewState(yyps->ssp - yyps->ss);",
+    "      struct yyparsestate *save = YYSaveState(yyctx);",
     "      save->save    = yyps->save;",
     "      save->state   = yystate;",
     "      save->errflag = yyps->errflag;",
-    "      save->ssp     = save->ss + (yyps->ssp - yyps->ss);",
-    "      save->vsp     = save->vs + (yyps->vsp - yyps->vs);",
-    "      memcpy (save->ss, yyps->ss, (yyps->ssp - yyps->ss + 1)*sizeof(Yshort));",
-    "      YYSCopy(save->vs, yyps->vs, (yyps->ssp - yyps->ss + 1));",
-    "#ifdef YYPOSN",
-    "      save->psp     = save->ps + (yyps->psp - yyps->ps);",
-    "      YYPCopy(save->ps, yyps->ps, (yyps->ssp - yyps->ss + 1));",
-    "#endif /* YYPOSN */",
+    "      ++yyctx->ntrials;",
     "      ctry = yytable[yyn];",
     "      if (yyctable[ctry] == -1) {",
     "#if YYDEBUG",
@@ -590,6 +883,7 @@ static char *body[] =
     "    if (yyps->ssp >= yyps->ss + yyps->stacksize - 1) {",
     "      YYMoreStack(yyps);",
     "    }",
+    "    YYTRAILTOP();",
     "    *++(yyps->ssp) = yystate;",
     "    *++(yyps->vsp) = yylval;",
     "#ifdef YYPOSN",
@@ -640,34 +934,21 @@ static char *body[] =
     "     * it's really an error. */",
     "    if(yyerrctx==NULL || yyerrctx->lexeme<yylvp-yylvals) {",
     "      /* Free old saved error context state */",
-    "      if(yyerrctx) YYFreeState(yyerrctx);",
+    "      if(yyerrctx) YYFreeState(yyctx, yyerrctx);",
     "      /* Create and fill out new saved error context state */",
-    "      yyerrctx = YYNewState(yyps->ssp - yyps->ss);",
+    "      yyerrctx = YYSaveErrorState(yyctx);",
     "      yyerrctx->save = yyps->save;",
     "      yyerrctx->state = yystate;",
     "      yyerrctx->errflag = yyps->errflag;",
-    "      yyerrctx->ssp = yyerrctx->ss + (yyps->ssp - yyps->ss);",
-    "      yyerrctx->vsp = yyerrctx->vs + (yyps->vsp - yyps->vs);",
-    "      memcpy(yyerrctx->ss, yyps->ss, (yyps->ssp - yyps->ss + 1)*sizeof(Yshort));",
-    "      YYSCopy(yyerrctx->vs, yyps->vs, (yyps->ssp - yyps->ss + 1));",
-    "#ifdef YYPOSN",
-    "      yyerrctx->psp = yyerrctx->ps + (yyps->psp - yyps->ps);",
-    "      YYPCopy(yyerrctx->ps, yyps->ps, (yyps->ssp - yyps->ss + 1));",
-    "#endif /* YYPOSN */",
     "      yyerrctx->lexeme = yylvp - yylvals;",
     "    }",
     "    yychar = -1;",
     "    yylexp = yylexemes + save->lexeme;",
-    "    yyps->ssp = yyps->ss + (save->ssp - save->ss);",
-    "    memcpy (yyps->ss, save->ss, (yyps->ssp - yyps->ss + 1) * sizeof(Yshort));",
     "    yylvp = yylvals + save->lexeme;",
-    "    yyps->vsp = yyps->vs + (save->vsp - save->vs);",
-    "    YYSCopy(yyps->vs, save->vs,  yyps->vsp - yyps->vs + 1);",
     "#ifdef YYPOSN",
     "    yylpp  = yylpsns + save->lexeme;",
-    "    yyps->psp = yyps->ps + (save->psp - save->ps);",
-    "    YYPCopy(yyps->ps, save->ps,  yyps->psp - yyps->ps + 1);",
     "#endif /* YYPOSN */",
+    "    YYRestoreState(yyctx, save);",
     "    ctry = ++save->ctry;",
     "    yystate = save->state;",
     "    /* We tried shift, try reduce now */",
@@ -675,7 +956,8 @@ static char *body[] =
     "      goto yyreduce;",
     "    }",
     "    yyps->save = save->save;",
-    "    YYFreeState(save);",
+    "    yyctx->untouched = save->outer;",
+    "    YYFreeState(yyctx, save);",
     "    /*",
     "    ** Nothing left on the stack -- error",
     "    */",
@@ -689,27 +971,22 @@ static char *body[] =
     "      /* Restore state as it was in the most forward-advanced error */",
     "      yylexp = yylexemes + yyerrctx->lexeme;",
     "      yychar = yylexp[-1];",
-    "      yyps->ssp = yyps->ss + (yyerrctx->ssp - yyerrctx->ss);",
-    "      memcpy(yyps->ss, yyerrctx->ss, (yyps->ssp - yyps->ss + 1)*sizeof(Yshort));",
     "      yylvp = yylvals   + yyerrctx->lexeme;",
     "      yylval = yylvp[-1];",
-    "      yyps->vsp = yyps->vs + (yyerrctx->vsp - yyerrctx->vs);",
-    "      YYSCopy(yyps->vs, yyerrctx->vs,  yyps->vsp - yyps->vs + 1);",
     "#ifdef YYPOSN",
     "      yylpp  = yylpsns   + yyerrctx->lexeme;",
     "      yyposn = yylpp[-1];",
-    "      yyps->psp = yyps->ps + (yyerrctx->psp - yyerrctx->ps);",
-    "      YYPCopy(yyps->ps, yyerrctx->ps,  yyps->psp - yyps->ps + 1);",
     "#endif /* YYPOSN */",
+    "      YYRestoreErrorState(yyctx, yyerrctx);",
     "      yystate = yyerrctx->state;",
-    "      YYFreeState(yyerrctx);",
+    "      YYFreeState(yyctx, yyerrctx);",
     "      yyerrctx = NULL;",
     "    }",
     "    yynewerrflag = 1; ",
     "  }",
     "  if (yynewerrflag) {",
     "#ifdef YYERROR_DETAILED",
-    "    yyerror_detailed(\"syntax error\", yychar, yylval, yyposn);",
+    "    yyerror_detailed(yyctx, \"syntax error\", yychar, yylval, yyposn);",
     "#else",
     "    yyerror(\"syntax error\");",
     "#endif",
@@ -770,7 +1047,7 @@ static char *body[] =
     "    }",
     "#ifdef YYDESTRUCT",
     "    if (yychar > 0)",
-    "      YYDESTRUCT(yytrial!=0, yyastable[yyttable[yychar]], &yylval, &yyposn);",
+    "      YYDESTRUCT(yytrial!=0, yychar, &yylval, &yyposn);",
     "#endif /* YYDESTRUCT */",
     "    yychar = (-1);",
     "    goto yyloop;",
@@ -825,7 +1102,7 @@ static char *body[] =
 
 static char *trailer[] =
 {
-    "#line 802 \"btyaccpa.ske\"",
+    "#line 1079 \"btyaccpa.ske\"",
     "",
     "  default:",
     "    break;",
@@ -864,6 +1141,7 @@ static char *trailer[] =
     "    }",
     "#endif",
     "    yystate = YYFINAL;",
+    "    YYTRAILTOP();",
     "    *++(yyps->ssp) = YYFINAL;",
     "    *++(yyps->vsp) = yyps->val;",
     "    yyretlval = yyps->val;  /* return value of root non-terminal to yylval */",
@@ -872,7 +1150,7 @@ static char *trailer[] =
     "    yyretposn = yyps->pos;  /* return value of root position to yyposn */",
     "#endif /* YYPOSN */",
     "    if (yychar < 0) {",
-    "      if ((yychar = YYLex1()) < 0) {",
+    "      if ((yychar = YYLex1(yyctx)) < 0) {",
     "        yychar = 0;",
     "      }",
     "#if YYDEBUG",
@@ -903,6 +1181,7 @@ static char *trailer[] =
     "  if (yyps->ssp >= yyps->ss + yyps->stacksize - 1) {",
     "    YYMoreStack(yyps);",
     "  }",
+    "  YYTRAILTOP();",
     "  *++(yyps->ssp) = yystate;",
     "  *++(yyps->vsp) = yyps->val;",
     "#ifdef YYPOSN",
@@ -932,26 +1211,23 @@ static char *trailer[] =
     "\t   (int)(yylvp - yylvals - yypath->lexeme));",
     "#endif",
     "  if(yyerrctx) {",
-    "    YYFreeState(yyerrctx); yyerrctx = NULL;",
+    "    YYFreeState(yyctx, yyerrctx); yyerrctx = NULL;",
     "  }",
     "  yychar = -1;",
-    "  yyps->ssp = yyps->ss + (yypath->ssp - yypath->ss);",
-    "  memcpy (yyps->ss, yypath->ss, (yyps->ssp - yyps->ss + 1) * sizeof(Yshort));",
     "  yylexp = yylexemes + yypath->lexeme;",
-    "  yyps->vsp = yyps->vs + (yypath->vsp - yypath->vs);",
-    "  YYSCopy(yyps->vs, yypath->vs,  yyps->vsp - yyps->vs + 1);",
     "  yylvp = yylvals + yypath->lexeme;",
     "#ifdef YYPOSN",
-    "  yyps->psp = yyps->ps + (yypath->psp - yypath->ps);",
-    "  YYPCopy(yyps->ps, yypath->ps,  yyps->psp - yyps->ps + 1);",
     "  yylpp = yylpsns + yypath->lexeme;",
     "#endif /* YYPOSN */",
+    "  /* First state on the path is the outermost one, no trial is left after restoring it */",
+    "  YYRestoreState(yyctx, yypath);",
+    "  yyctx->untouched = yypath->outer;",
     "  yystate = yypath->state;",
     "  goto yyloop;",
     "",
     "yyabort:",
     "  if(yyerrctx) {",
-    "    YYFreeState(yyerrctx); yyerrctx = NULL;",
+    "    YYFreeState(yyctx, yyerrctx); yyerrctx = NULL;",
     "  }",
     "",
     "  {",
@@ -975,15 +1251,16 @@ static char *trailer[] =
     "#endif /* YYPOSN */",
     "  }",
     "",
-    "  while (yyps) {",
-    "    struct yyparsestate *save = yyps;",
-    "    yyps = save->save;",
-    "    YYFreeState(save);",
-    "  }",
+    "  /* Main state goes last to the free list, so the next parse starts with its big stacks */",
     "  while (yypath) {",
     "    struct yyparsestate *save = yypath;",
     "    yypath = save->save;",
-    "    YYFreeState(save); ",
+    "    YYFreeState(yyctx, save); ",
+    "  }",
+    "  while (yyps) {",
+    "    struct yyparsestate *save = yyps;",
+    "    yyps = save->save;",
+    "    YYFreeState(yyctx, save);",
     "  }",
     "  return (1);",
     "",
@@ -991,17 +1268,18 @@ static char *trailer[] =
     "yyaccept:",
     "  if (yyps->save) goto yyvalid;",
     "  if(yyerrctx) {",
-    "    YYFreeState(yyerrctx); yyerrctx = NULL;",
-    "  }",
-    "  while (yyps) {",
-    "    struct yyparsestate *save = yyps;",
-    "    yyps = save->save;",
-    "    YYFreeState(save);",
+    "    YYFreeState(yyctx, yyerrctx); yyerrctx = NULL;",
     "  }",
+    "  /* Main state goes last to the free list, so the next parse starts with its big stacks */",
     "  while (yypath) {",
     "    struct yyparsestate *save = yypath;",
     "    yypath = save->save;",
-    "    YYFreeState(save); ",
+    "    YYFreeState(yyctx, save); ",
+    "  }",
+    "  while (yyps) {",
+    "    struct yyparsestate *save = yyps;",
+    "    yyps = save->save;",
+    "    YYFreeState(yyctx, save);",
     "  }",
     "  return (0);",
     "}",